@@ -26,6 +26,7 @@ const util = require('util');
 const EventEmitter = require('events');
 const debug = util.debuglog('http');
 const { async_id_symbol } = require('internal/async_hooks').symbols;
+const { ERR_INVALID_OPT_VALUE } = require('internal/errors').codes;
 
 // New Agent code.
 
@@ -59,9 +60,14 @@ function Agent(options) {
   this.keepAlive = this.options.keepAlive || false;
   this.maxSockets = this.options.maxSockets || Agent.defaultMaxSockets;
   this.maxFreeSockets = this.options.maxFreeSockets || 256;
+  this.scheduling = this.options.scheduling || 'fifo';
+
+  if (this.scheduling !== 'fifo' && this.scheduling !== 'lifo')
+    throw new ERR_INVALID_OPT_VALUE('scheduling', this.scheduling);
 
   this.on('free', (socket, options) => {
-    var name = this.getName(options);
+    // Sockets created by createSocket() carry the name they are pooled under.
+    var name = options._agentKey || this.getName(options);
     debug('agent.on(free)', name);
 
     if (socket.writable &&
@@ -158,12 +164,24 @@ Agent.prototype.addRequest = function addRequest(req, options, port/* legacy */,
     this.sockets[name] = [];
   }
 
-  var freeLen = this.freeSockets[name] ? this.freeSockets[name].length : 0;
-  var sockLen = freeLen + this.sockets[name].length;
+  var freeSockets = this.freeSockets[name];
+  var socket;
+  while (freeSockets !== undefined && freeSockets.length > 0) {
+    socket = this.scheduling === 'lifo' ?
+      freeSockets.pop() : freeSockets.shift();
+    if (isSocketAlive(socket))
+      break;
+    debug('skipping closed free socket');
+    socket.destroy();
+    socket = undefined;
+  }
+
+  // don't leak
+  if (freeSockets !== undefined && freeSockets.length === 0)
+    delete this.freeSockets[name];
 
-  if (freeLen) {
+  if (socket !== undefined) {
     // we have a free socket, so use that.
-    var socket = this.freeSockets[name].shift();
     // Guard against an uninitialized or user supplied Socket.
     if (socket._handle && typeof socket._handle.asyncReset === 'function') {
       // Assign the handle a new asyncId and run any init() hooks.
@@ -171,15 +189,11 @@ Agent.prototype.addRequest = function addRequest(req, options, port/* legacy */,
       socket[async_id_symbol] = socket._handle.getAsyncId();
     }
 
-    // don't leak
-    if (!this.freeSockets[name].length)
-      delete this.freeSockets[name];
-
     this.reuseSocket(socket, req);
     req.onSocket(socket);
     this.sockets[name].push(socket);
-  } else if (sockLen < this.maxSockets) {
-    debug('call onSocket', sockLen, freeLen);
+  } else if (this.sockets[name].length < this.maxSockets) {
+    debug('call onSocket', this.sockets[name].length);
     // If we are under maxSockets create a new one.
     this.createSocket(req, options, handleSocketCreation(req, true));
   } else {
@@ -228,6 +242,14 @@ Agent.prototype.createSocket = function createSocket(req, options, cb) {
     oncreate(null, newSocket);
 };
 
+// A free socket that was destroyed, or that the peer has closed, while it was
+// idle is only dropped from the pool by its 'close' event, which may not have
+// happened yet. A socket that has not connected yet is not readable either,
+// so the end of its readable side is checked instead.
+function isSocketAlive(socket) {
+  return !socket.destroyed && !socket._readableState.ended;
+}
+
 function calculateServerName(options, req) {
   let servername = options.host;
   const hostHeader = req.getHeader('host');
@@ -281,7 +303,7 @@ function installListeners(agent, s, options) {
 }
 
 Agent.prototype.removeSocket = function removeSocket(s, options) {
-  var name = this.getName(options);
+  var name = options._agentKey || this.getName(options);
   debug('removeSocket', name, 'writable:', s.writable);
   var sets = [this.sockets];
 
@@ -323,6 +345,22 @@ Agent.prototype.reuseSocket = function reuseSocket(socket, req) {
   socket.ref();
 };
 
+Agent.prototype.getPoolStats = function getPoolStats() {
+  const stats = {};
+  const sets = [this.freeSockets, this.sockets, this.requests];
+  const fields = ['free', 'active', 'pending'];
+  for (var s = 0; s < sets.length; s++) {
+    const keys = Object.keys(sets[s]);
+    for (var k = 0; k < keys.length; k++) {
+      const name = keys[k];
+      if (stats[name] === undefined)
+        stats[name] = { free: 0, active: 0, pending: 0 };
+      stats[name][fields[s]] = sets[s][name].length;
+    }
+  }
+  return stats;
+};
+
 Agent.prototype.destroy = function destroy() {
   var sets = [this.freeSockets, this.sockets];
   for (var s = 0; s < sets.length; s++) {
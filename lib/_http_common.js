@@ -40,6 +40,7 @@ const kOnHeadersComplete = HTTPParser.kOnHeadersComplete | 0;
 const kOnBody = HTTPParser.kOnBody | 0;
 const kOnMessageComplete = HTTPParser.kOnMessageComplete | 0;
 const kOnExecute = HTTPParser.kOnExecute | 0;
+const kOnMessages = HTTPParser.kOnMessages | 0;
 
 const MAX_HEADER_PAIRS = 2000;
 
@@ -109,6 +110,27 @@ function parserOnHeadersComplete(versionMajor, versionMinor, headers, method,
   return parser.onIncoming(incoming, shouldKeepAlive);
 }
 
+// Called instead of parserOnHeadersComplete() and parserOnMessageComplete()
+// for all requests that were parsed by one execute() call, when the parser
+// batches requests. Every request takes up seven entries of `messages`,
+// see Parser::QueueRequest() in src/node_http_parser.cc.
+function parserOnMessages(messages) {
+  for (var i = 0; i < messages.length; i += 7) {
+    parserOnHeadersComplete.call(this,
+                                 messages[i],
+                                 messages[i + 1],
+                                 messages[i + 2],
+                                 messages[i + 3],
+                                 messages[i + 4],
+                                 undefined,
+                                 undefined,
+                                 false,
+                                 messages[i + 5]);
+    if (messages[i + 6])
+      parserOnMessageComplete.call(this);
+  }
+}
+
 // XXX This is a mess.
 // TODO: http.Parser should be a Writable emits request/response events.
 function parserOnBody(b, start, len) {
@@ -169,6 +191,7 @@ const parsers = new FreeList('parsers', 1000, function() {
   parser[kOnBody] = parserOnBody;
   parser[kOnMessageComplete] = parserOnMessageComplete;
   parser[kOnExecute] = null;
+  parser[kOnMessages] = null;
 
   return parser;
 });
@@ -195,6 +218,7 @@ function freeParser(parser, req, socket) {
     parser.incoming = null;
     parser.outgoing = null;
     parser[kOnExecute] = null;
+    parser[kOnMessages] = null;
     if (parsers.free(parser) === false) {
       // Make sure the parser's stack has unwound before deleting the
       // corresponding C++ object through .close().
@@ -250,6 +274,7 @@ module.exports = {
   freeParser,
   httpSocketSetup,
   methods,
+  parserOnMessages,
   parsers,
   kIncomingMessage
 };
@@ -31,6 +31,7 @@ const common = require('_http_common');
 const checkIsHttpToken = common._checkIsHttpToken;
 const checkInvalidHeaderChar = common._checkInvalidHeaderChar;
 const { outHeadersKey } = require('internal/http');
+const { serializeHeaders } = process.binding('http_parser');
 const {
   defaultTriggerAsyncIdScope,
   symbols: { async_id_symbol }
@@ -293,33 +294,36 @@ function _storeHeader(firstLine, headers) {
     date: false,
     expect: false,
     trailer: false,
-    header: firstLine
+    validate: false,
+    fields: []
   };
 
   var key;
   if (headers === this[outHeadersKey]) {
     for (key in headers) {
       const entry = headers[key];
-      processHeader(this, state, entry[0], entry[1], false);
+      processHeader(this, state, entry[0], entry[1]);
     }
   } else if (Array.isArray(headers)) {
+    state.validate = true;
     for (var i = 0; i < headers.length; i++) {
       const entry = headers[i];
-      processHeader(this, state, entry[0], entry[1], true);
+      processHeader(this, state, entry[0], entry[1]);
     }
   } else if (headers) {
+    state.validate = true;
     for (key in headers) {
       if (hasOwnProperty(headers, key)) {
-        processHeader(this, state, key, headers[key], true);
+        processHeader(this, state, key, headers[key]);
       }
     }
   }
 
-  let { header } = state;
+  const { fields } = state;
 
   // Date header
   if (this.sendDate && !state.date) {
-    header += 'Date: ' + utcDate() + CRLF;
+    fields.push('Date', utcDate());
   }
 
   // Force the connection to close when the response is a 204 No Content or
@@ -349,10 +353,10 @@ function _storeHeader(firstLine, headers) {
     const shouldSendKeepAlive = this.shouldKeepAlive &&
         (state.contLen || this.useChunkedEncodingByDefault || this.agent);
     if (shouldSendKeepAlive) {
-      header += 'Connection: keep-alive\r\n';
+      fields.push('Connection', 'keep-alive');
     } else {
       this._last = true;
-      header += 'Connection: close\r\n';
+      fields.push('Connection', 'close');
     }
   }
 
@@ -365,9 +369,9 @@ function _storeHeader(firstLine, headers) {
     } else if (!state.trailer &&
                !this._removedContLen &&
                typeof this._contentLength === 'number') {
-      header += 'Content-Length: ' + this._contentLength + CRLF;
+      fields.push('Content-Length', this._contentLength);
     } else if (!this._removedTE) {
-      header += 'Transfer-Encoding: chunked\r\n';
+      fields.push('Transfer-Encoding', 'chunked');
       this.chunkedEncoding = true;
     } else {
       // We should only be able to get here if both Content-Length and
@@ -377,6 +381,16 @@ function _storeHeader(firstLine, headers) {
     }
   }
 
+  // Validation (if needed), escaping and concatenation of all fields happen
+  // in a single pass in C++.
+  const header = serializeHeaders(firstLine, fields, state.validate);
+  if (typeof header === 'number') {
+    // The index of the first invalid field was returned, let the validators
+    // throw the appropriate error for it.
+    validateHeaderName(fields[header]);
+    validateHeaderValue(fields[header], fields[header + 1]);
+  }
+
   // Test non-chunked message does not have trailer header set,
   // message will be terminated by the first empty line after the
   // header fields, regardless of the header fields present in the
@@ -385,7 +399,7 @@ function _storeHeader(firstLine, headers) {
     throw new ERR_HTTP_TRAILER_INVALID();
   }
 
-  this._header = header + CRLF;
+  this._header = header;
   this._headerSent = false;
 
   // wait until the first body chunk, or close(), is sent to flush,
@@ -393,29 +407,27 @@ function _storeHeader(firstLine, headers) {
   if (state.expect) this._send('');
 }
 
-function processHeader(self, state, key, value, validate) {
-  if (validate)
-    validateHeaderName(key);
+function processHeader(self, state, key, value) {
   if (Array.isArray(value)) {
+    if (value.length === 0 && state.validate)
+      validateHeaderName(key);
     if (value.length < 2 || !isCookieField(key)) {
       for (var i = 0; i < value.length; i++)
-        storeHeader(self, state, key, value[i], validate);
+        storeHeader(self, state, key, value[i]);
       return;
     }
     value = value.join('; ');
   }
-  storeHeader(self, state, key, value, validate);
+  storeHeader(self, state, key, value);
 }
 
-function storeHeader(self, state, key, value, validate) {
-  if (validate)
-    validateHeaderValue(key, value);
-  state.header += key + ': ' + escapeHeaderValue(value) + CRLF;
+function storeHeader(self, state, key, value) {
+  state.fields.push(key, value);
   matchHeader(self, state, key, value);
 }
 
 function matchHeader(self, state, field, value) {
-  if (field.length < 4 || field.length > 17)
+  if (typeof field !== 'string' || field.length < 4 || field.length > 17)
     return;
   field = field.toLowerCase();
   switch (field) {
@@ -34,6 +34,7 @@ const {
   chunkExpression,
   httpSocketSetup,
   kIncomingMessage,
+  parserOnMessages,
   _checkInvalidHeaderChar: checkInvalidHeaderChar
 } = require('_http_common');
 const { OutgoingMessage } = require('_http_outgoing');
@@ -51,6 +52,7 @@ const {
 const Buffer = require('buffer').Buffer;
 
 const kServerResponse = Symbol('ServerResponse');
+const kBatchRequests = Symbol('batchRequests');
 
 const STATUS_CODES = {
   100: 'Continue',
@@ -119,6 +121,7 @@ const STATUS_CODES = {
 };
 
 const kOnExecute = HTTPParser.kOnExecute | 0;
+const kOnMessages = HTTPParser.kOnMessages | 0;
 
 
 function ServerResponse(req) {
@@ -285,6 +288,7 @@ function Server(options, requestListener) {
 
   this[kIncomingMessage] = options.IncomingMessage || IncomingMessage;
   this[kServerResponse] = options.ServerResponse || ServerResponse;
+  this[kBatchRequests] = Boolean(options.batchRequests);
 
   net.Server.call(this, { allowHalfOpen: true });
 
@@ -391,6 +395,8 @@ function connectionListenerInternal(server, socket) {
   }
   parser[kOnExecute] =
     onParserExecute.bind(undefined, server, socket, parser, state);
+  if (server[kBatchRequests])
+    parser[kOnMessages] = parserOnMessages;
 
   socket._paused = false;
 }
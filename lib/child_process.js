@@ -36,6 +36,7 @@ const {
   ERR_CHILD_PROCESS_IPC_REQUIRED,
   ERR_CHILD_PROCESS_STDIO_MAXBUFFER,
   ERR_INVALID_ARG_TYPE,
+  ERR_INVALID_CALLBACK,
   ERR_INVALID_OPT_VALUE,
   ERR_OUT_OF_RANGE
 } = require('internal/errors').codes;
@@ -110,12 +111,12 @@ exports.fork = function fork(modulePath /* , args, options */) {
 };
 
 
-exports._forkChild = function _forkChild(fd) {
+exports._forkChild = function _forkChild(fd, serializationMode) {
   // set process.send()
   var p = new Pipe(PipeConstants.IPC);
   p.open(fd);
   p.unref();
-  const control = setupChannel(process, p);
+  const control = setupChannel(process, p, serializationMode);
   process.on('newListener', function onNewListener(name) {
     if (name === 'message' || name === 'disconnect') control.ref();
   });
@@ -535,19 +536,18 @@ var spawn = exports.spawn = function spawn(/* file, args, options */) {
     envPairs: opts.envPairs,
     stdio: options.stdio,
     uid: options.uid,
-    gid: options.gid
+    gid: options.gid,
+    serialization: options.serialization
   });
 
   return child;
 };
 
-function spawnSync(/* file, args, options */) {
-  var opts = normalizeSpawnArguments.apply(null, arguments);
-
+// Validates and translates the options of spawnSync() and spawnCollect() for
+// spawn_sync.spawn() and ProcessRunner.
+function normalizeSpawnSyncOptions(opts) {
   var options = opts.options;
 
-  debug('spawnSync', opts.args, options);
-
   // Validate the timeout, if present.
   validateTimeout(options.timeout);
 
@@ -584,12 +584,37 @@ function spawnSync(/* file, args, options */) {
       }
     }
   }
+}
+
+function spawnSync(/* file, args, options */) {
+  var opts = normalizeSpawnArguments.apply(null, arguments);
+
+  debug('spawnSync', opts.args, opts.options);
+
+  normalizeSpawnSyncOptions(opts);
 
   return child_process.spawnSync(opts);
 }
 exports.spawnSync = spawnSync;
 
 
+function spawnCollect(/* file, args, options, callback */) {
+  var args = Array.prototype.slice.call(arguments, 0, -1);
+  var callback = arguments[arguments.length - 1];
+  if (typeof callback !== 'function')
+    throw new ERR_INVALID_CALLBACK();
+
+  var opts = normalizeSpawnArguments.apply(null, args);
+
+  debug('spawnCollect', opts.args, opts.options);
+
+  normalizeSpawnSyncOptions(opts);
+
+  child_process.spawnCollect(opts, callback);
+}
+exports.spawnCollect = spawnCollect;
+
+
 function checkExecSyncError(ret, args, cmd) {
   var err;
   if (ret.error) {
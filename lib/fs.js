@@ -48,17 +48,29 @@ const errors = require('internal/errors');
 const {
   ERR_FS_FILE_TOO_LARGE,
   ERR_INVALID_ARG_TYPE,
-  ERR_INVALID_CALLBACK
+  ERR_INVALID_CALLBACK,
+  ERR_INVALID_OPT_VALUE,
+  ERR_OUT_OF_RANGE
 } = errors.codes;
 
 const { FSReqWrap, statValues } = binding;
 const internalFS = require('internal/fs/utils');
 const { getPathFromURL } = require('internal/url');
+const {
+  Dir,
+  opendir,
+  opendirSync
+} = require('internal/fs/dir');
+const { Walker, walk } = require('internal/fs/walk');
 const internalUtil = require('internal/util');
 const {
   copyObject,
+  Dirent,
+  getDirents,
   getOptions,
+  handleErrorFromBinding,
   nullCheck,
+  packReadRanges,
   preprocessSymlinkDestination,
   Stats,
   getStatsFromBinding,
@@ -66,7 +78,9 @@ const {
   stringToFlags,
   stringToSymlinkType,
   toUnixTimestamp,
+  unpackReadRanges,
   validateBuffer,
+  validateBufferArray,
   validateOffsetLengthRead,
   validateOffsetLengthWrite,
   validatePath
@@ -90,7 +104,6 @@ let fs;
 // Lazy loaded
 let promises;
 let watchers;
-let ReadFileContext;
 let ReadStream;
 let WriteStream;
 
@@ -112,20 +125,6 @@ function showTruncateDeprecation() {
   }
 }
 
-function handleErrorFromBinding(ctx) {
-  if (ctx.errno !== undefined) {  // libuv error numbers
-    const err = errors.uvException(ctx);
-    Error.captureStackTrace(err, handleErrorFromBinding);
-    throw err;
-  } else if (ctx.error !== undefined) {  // errors created in C++ land.
-    // TODO(joyeecheung): currently, ctx.error are encoding errors
-    // usually caused by memory problems. We need to figure out proper error
-    // code(s) for this.
-    Error.captureStackTrace(ctx.error, handleErrorFromBinding);
-    throw ctx.error;
-  }
-}
-
 function maybeCallback(cb) {
   if (typeof cb === 'function')
     return cb;
@@ -235,74 +234,25 @@ function existsSync(path) {
   }
 }
 
-function readFileAfterOpen(err, fd) {
-  const context = this.context;
-
-  if (err) {
-    context.callback(err);
-    return;
-  }
-
-  context.fd = fd;
-
-  const req = new FSReqWrap();
-  req.oncomplete = readFileAfterStat;
-  req.context = context;
-  binding.fstat(fd, req);
-}
-
-function readFileAfterStat(err, stats) {
-  const context = this.context;
-
-  if (err)
-    return context.close(err);
-
-  const size = context.size = isFileType(stats, S_IFREG) ? stats[8] : 0;
-
-  if (size === 0) {
-    context.buffers = [];
-    context.read();
-    return;
-  }
-
-  if (size > kMaxLength) {
-    err = new ERR_FS_FILE_TOO_LARGE(size);
-    return context.close(err);
-  }
-
-  try {
-    context.buffer = Buffer.allocUnsafeSlow(size);
-  } catch (err) {
-    return context.close(err);
-  }
-  context.read();
-}
-
+// The whole file is read by a single thread pool job, see ReadFileWork in
+// src/node_file.cc.
 function readFile(path, options, callback) {
   callback = maybeCallback(callback || options);
   options = getOptions(options, { flag: 'r' });
-  if (!ReadFileContext)
-    ReadFileContext = require('internal/fs/read_file_context');
-  const context = new ReadFileContext(callback, options.encoding);
-  context.isUserFd = isFd(path); // file descriptor ownership
-
   const req = new FSReqWrap();
-  req.context = context;
-  req.oncomplete = readFileAfterOpen;
+  req.oncomplete = callback;
 
-  if (context.isUserFd) {
-    process.nextTick(function tick() {
-      req.oncomplete(null, path);
-    });
+  if (isFd(path)) { // file descriptor ownership stays with the caller
+    binding.readFile(path, 0, options.encoding, req);
     return;
   }
 
   path = getPathFromURL(path);
   validatePath(path);
-  binding.open(pathModule.toNamespacedPath(path),
-               stringToFlags(options.flag || 'r'),
-               0o666,
-               req);
+  binding.readFile(pathModule.toNamespacedPath(path),
+                   stringToFlags(options.flag || 'r'),
+                   options.encoding,
+                   req);
 }
 
 function tryStatSync(fd, isUserFd) {
@@ -499,6 +449,97 @@ function readSync(fd, buffer, offset, length, position) {
   return result;
 }
 
+function readv(fd, buffers, position, callback) {
+  if (typeof position === 'function') {
+    callback = position;
+    position = null;
+  }
+  validateUint32(fd, 'fd');
+  validateBufferArray(buffers);
+  callback = makeCallback(callback);
+
+  if (!isUint32(position))
+    position = -1;
+
+  const req = new FSReqWrap();
+  req.oncomplete = (err, bytesRead) => callback(err, bytesRead || 0, buffers);
+  binding.readBuffers(fd, buffers, position, req);
+}
+
+Object.defineProperty(readv, internalUtil.customPromisifyArgs,
+                      { value: ['bytesRead', 'buffers'], enumerable: false });
+
+function readvSync(fd, buffers, position) {
+  validateUint32(fd, 'fd');
+  validateBufferArray(buffers);
+
+  if (!isUint32(position))
+    position = -1;
+
+  const ctx = {};
+  const result = binding.readBuffers(fd, buffers, position, undefined, ctx);
+  handleErrorFromBinding(ctx);
+  return result;
+}
+
+function readRanges(fd, ranges, callback) {
+  validateUint32(fd, 'fd');
+  const packed = packReadRanges(ranges);
+  callback = makeCallback(callback);
+
+  const req = new FSReqWrap();
+  req.oncomplete = (err, result) => {
+    if (err)
+      return callback(err);
+    callback(null, unpackReadRanges(packed, result));
+  };
+  binding.readRanges(fd, packed, req);
+}
+
+// Indexes into kMmapAdvice in src/node_file.cc.
+const kMmapAdvice = ['normal', 'sequential', 'random', 'willneed'];
+
+function mmapSync(fd, options = {}) {
+  validateUint32(fd, 'fd');
+  if (options === null || typeof options !== 'object')
+    throw new ERR_INVALID_ARG_TYPE('options', 'Object', options);
+  const { offset = 0, shared = false, advice = 'normal' } = options;
+  let { length } = options;
+
+  validateInteger(offset, 'options.offset');
+  if (offset < 0)
+    throw new ERR_OUT_OF_RANGE('options.offset', '>= 0', offset);
+  const adviceIndex = kMmapAdvice.indexOf(advice);
+  if (adviceIndex === -1)
+    throw new ERR_INVALID_OPT_VALUE('advice', advice);
+
+  // Touching pages past the end of the file raises SIGBUS, so the mapping
+  // must not extend beyond it.
+  const ctx = {};
+  const stats = binding.fstat(fd, undefined, ctx);
+  handleErrorFromBinding(ctx);
+  const available = Math.max(stats[8] - offset, 0);
+
+  if (length === undefined) {
+    length = available;
+    if (length > kMaxLength)
+      throw new ERR_FS_FILE_TOO_LARGE(length);
+  } else {
+    validateInteger(length, 'options.length');
+    const max = Math.min(available, kMaxLength);
+    if (length < 0 || length > max)
+      throw new ERR_OUT_OF_RANGE('options.length', `>= 0 && <= ${max}`, length);
+  }
+
+  if (length === 0)
+    return Buffer.alloc(0);
+
+  const result = binding.mmap(fd, offset, length, !!shared, adviceIndex,
+                              undefined, ctx);
+  handleErrorFromBinding(ctx);
+  return result;
+}
+
 // usage:
 //  fs.write(fd, buffer[, offset[, length[, position]]], callback);
 // OR
@@ -745,8 +786,19 @@ function readdir(path, options, callback) {
   validatePath(path);
 
   const req = new FSReqWrap();
-  req.oncomplete = callback;
-  binding.readdir(pathModule.toNamespacedPath(path), options.encoding, req);
+  if (!options.withFileTypes) {
+    req.oncomplete = callback;
+  } else {
+    req.oncomplete = (err, result) => {
+      if (err) {
+        callback(err);
+        return;
+      }
+      getDirents(path, result, callback);
+    };
+  }
+  binding.readdir(pathModule.toNamespacedPath(path), options.encoding,
+                  !!options.withFileTypes, req);
 }
 
 function readdirSync(path, options) {
@@ -755,9 +807,10 @@ function readdirSync(path, options) {
   validatePath(path);
   const ctx = { path };
   const result = binding.readdir(pathModule.toNamespacedPath(path),
-                                 options.encoding, undefined, ctx);
+                                 options.encoding, !!options.withFileTypes,
+                                 undefined, ctx);
   handleErrorFromBinding(ctx);
-  return result;
+  return options.withFileTypes ? getDirents(path, result) : result;
 }
 
 function fstat(fd, callback) {
@@ -1753,12 +1806,18 @@ module.exports = fs = {
   mkdirSync,
   mkdtemp,
   mkdtempSync,
+  mmapSync,
   open,
   openSync,
+  opendir,
+  opendirSync,
   readdir,
   readdirSync,
   read,
   readSync,
+  readv,
+  readvSync,
+  readRanges,
   readFile,
   readFileSync,
   readlink,
@@ -1780,13 +1839,17 @@ module.exports = fs = {
   unlinkSync,
   utimes,
   utimesSync,
+  walk,
   watch,
   watchFile,
   writeFile,
   writeFileSync,
   write,
   writeSync,
+  Dir,
+  Dirent,
   Stats,
+  Walker,
 
   get ReadStream() {
     lazyLoadStreams();
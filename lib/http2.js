@@ -7,6 +7,7 @@ process.emitWarning(
 );
 
 const {
+  compileHeaders,
   constants,
   getDefaultSettings,
   getPackedSettings,
@@ -15,10 +16,12 @@ const {
   createSecureServer,
   connect,
   Http2ServerRequest,
-  Http2ServerResponse
+  Http2ServerResponse,
+  sensitiveHeaders
 } = require('internal/http2/core');
 
 module.exports = {
+  compileHeaders,
   constants,
   getDefaultSettings,
   getPackedSettings,
@@ -27,5 +30,6 @@ module.exports = {
   createSecureServer,
   connect,
   Http2ServerResponse,
-  Http2ServerRequest
+  Http2ServerRequest,
+  sensitiveHeaders
 };
@@ -46,9 +46,6 @@ const {
 
 const { SocketListSend, SocketListReceive } = SocketList;
 
-// Lazy loaded for startup performance.
-let StringDecoder;
-
 const MAX_HANDLE_RETRANSMISSIONS = 3;
 
 // this object contain function to convert TCP objects to native handle objects
@@ -294,6 +291,11 @@ ChildProcess.prototype.spawn = function(options) {
     throw new ERR_INVALID_ARG_TYPE('options', 'Object', options);
   }
 
+  const serialization = options.serialization || 'json';
+  if (serialization !== 'json' && serialization !== 'advanced') {
+    throw new ERR_INVALID_OPT_VALUE('options.serialization', serialization);
+  }
+
   // If no `stdio` option was given - use default
   var stdio = options.stdio || 'pipe';
 
@@ -314,6 +316,7 @@ ChildProcess.prototype.spawn = function(options) {
     }
 
     options.envPairs.push('NODE_CHANNEL_FD=' + ipcFd);
+    options.envPairs.push('NODE_CHANNEL_SERIALIZATION_MODE=' + serialization);
   }
 
   if (typeof options.file !== 'string') {
@@ -396,7 +399,7 @@ ChildProcess.prototype.spawn = function(options) {
     this.stdio.push(stdio[i].socket === undefined ? null : stdio[i].socket);
 
   // Add .send() method and start listening for IPC data
-  if (ipc !== undefined) setupChannel(this, ipc);
+  if (ipc !== undefined) setupChannel(this, ipc, serialization);
 
   return err;
 };
@@ -463,7 +466,7 @@ class Control extends EventEmitter {
   }
 }
 
-function setupChannel(target, channel) {
+function setupChannel(target, channel, serializationMode) {
   target.channel = channel;
 
   // _channel can be deprecated in version 8
@@ -478,13 +481,35 @@ function setupChannel(target, channel) {
 
   const control = new Control(channel);
 
-  if (StringDecoder === undefined)
-    StringDecoder = require('string_decoder').StringDecoder;
-  var decoder = new StringDecoder('utf8');
-  var jsonBuffer = '';
+  if (serializationMode === undefined)
+    serializationMode = 'json';
+  const {
+    initMessageChannel,
+    parseChannelMessages,
+    writeChannelMessage
+  } = require('internal/child_process/serialization')[serializationMode];
+
   var pendingHandle = null;
   channel.buffering = false;
   channel.pendingHandle = null;
+  initMessageChannel(channel);
+
+  function onMessage(message) {
+    // There will be at most one NODE_HANDLE message in every chunk we
+    // read because SCM_RIGHTS messages don't get coalesced. Make sure
+    // that we deliver the handle with the right message however.
+    if (isInternal(message)) {
+      if (message.cmd === 'NODE_HANDLE') {
+        handleMessage(message, pendingHandle, true);
+        pendingHandle = null;
+      } else {
+        handleMessage(message, undefined, true);
+      }
+    } else {
+      handleMessage(message, undefined, false);
+    }
+  }
+
   channel.onread = function(nread, pool) {
     const recvHandle = channel.pendingHandle;
     channel.pendingHandle = null;
@@ -493,38 +518,7 @@ function setupChannel(target, channel) {
       if (recvHandle)
         pendingHandle = recvHandle;
 
-      // Linebreak is used as a message end sign
-      var chunks = decoder.write(pool).split('\n');
-      var numCompleteChunks = chunks.length - 1;
-      // Last line does not have trailing linebreak
-      var incompleteChunk = chunks[numCompleteChunks];
-      if (numCompleteChunks === 0) {
-        jsonBuffer += incompleteChunk;
-        this.buffering = jsonBuffer.length !== 0;
-        return;
-      }
-      chunks[0] = jsonBuffer + chunks[0];
-
-      for (var i = 0; i < numCompleteChunks; i++) {
-        var message = JSON.parse(chunks[i]);
-
-        // There will be at most one NODE_HANDLE message in every chunk we
-        // read because SCM_RIGHTS messages don't get coalesced. Make sure
-        // that we deliver the handle with the right message however.
-        if (isInternal(message)) {
-          if (message.cmd === 'NODE_HANDLE') {
-            handleMessage(message, pendingHandle, true);
-            pendingHandle = null;
-          } else {
-            handleMessage(message, undefined, true);
-          }
-        } else {
-          handleMessage(message, undefined, false);
-        }
-      }
-      jsonBuffer = incompleteChunk;
-      this.buffering = jsonBuffer.length !== 0;
-
+      parseChannelMessages(channel, pool, onMessage);
     } else {
       this.buffering = false;
       target.disconnect();
@@ -711,8 +705,7 @@ function setupChannel(target, channel) {
     var req = new WriteWrap();
     req.async = false;
 
-    var string = JSON.stringify(message) + '\n';
-    var err = channel.writeUtf8String(req, string, handle);
+    var err = writeChannelMessage(channel, req, message, handle);
 
     if (err === 0) {
       if (handle) {
@@ -962,9 +955,10 @@ function maybeClose(subprocess) {
   }
 }
 
-function spawnSync(opts) {
+// Turns the result object of spawn_sync.spawn() and ProcessRunner into the one
+// that is returned by child_process.spawnSync().
+function finishSpawnResult(result, opts, syscall) {
   var options = opts.options;
-  var result = spawn_sync.spawn(options);
 
   if (result.output && options.encoding && options.encoding !== 'buffer') {
     for (var i = 0; i < result.output.length; i++) {
@@ -978,7 +972,7 @@ function spawnSync(opts) {
   result.stderr = result.output && result.output[2];
 
   if (result.error) {
-    result.error = errnoException(result.error, 'spawnSync ' + opts.file);
+    result.error = errnoException(result.error, `${syscall} ${opts.file}`);
     result.error.path = opts.file;
     result.error.spawnargs = opts.args.slice(1);
   }
@@ -986,9 +980,26 @@ function spawnSync(opts) {
   return result;
 }
 
+function spawnSync(opts) {
+  var result = spawn_sync.spawn(opts.options);
+  return finishSpawnResult(result, opts, 'spawnSync');
+}
+
+function spawnCollect(opts, callback) {
+  const runner = new spawn_sync.ProcessRunner();
+  // Keep the input buffers alive while the process runs.
+  runner.options = opts.options;
+  runner.oncomplete = (result) => {
+    finishSpawnResult(result, opts, 'spawn');
+    callback(result.error || null, result);
+  };
+  runner.spawn(opts.options);
+}
+
 module.exports = {
   ChildProcess,
   setupChannel,
   _validateStdio,
+  spawnCollect,
   spawnSync
 };
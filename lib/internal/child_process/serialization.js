@@ -0,0 +1,187 @@
+'use strict';
+
+const { Buffer } = require('buffer');
+const { FastBuffer } = require('internal/buffer');
+const { ERR_OUT_OF_RANGE } = require('internal/errors').codes;
+const { isUint8Array } = require('internal/util/types');
+const { DefaultSerializer, DefaultDeserializer } = require('v8');
+
+// Lazy loaded for startup performance.
+let StringDecoder;
+
+const kJSONBuffer = Symbol('kJSONBuffer');
+const kStringDecoder = Symbol('kStringDecoder');
+const kMessageBuffer = Symbol('kMessageBuffer');
+const kMessageBufferSize = Symbol('kMessageBufferSize');
+const kOutOfBand = Symbol('kOutOfBand');
+const kOutOfBandOffset = Symbol('kOutOfBandOffset');
+
+// Every message in the 'advanced' mode is preceded by a header that holds
+// the size of the message following it, and the size of its serialized part.
+// The bytes of any out-of-band buffers follow the serialized part.
+const kHeaderSize = 8;
+const kMaxMessageSize = 2 ** 32 - 1;
+
+// Buffers that are at least this large are written from their own memory,
+// instead of being copied into the serialized message first.
+const kOutOfBandThreshold = 4 * 1024;
+
+const kInlineTag = 0;
+const kBufferTag = 1;
+const kUint8ArrayTag = 2;
+
+class ChildProcessSerializer extends DefaultSerializer {
+  constructor() {
+    super();
+    this[kOutOfBand] = [];
+  }
+
+  _writeHostObject(abView) {
+    if (abView.byteLength < kOutOfBandThreshold || !isUint8Array(abView)) {
+      this.writeUint32(kInlineTag);
+      return super._writeHostObject(abView);
+    }
+    this.writeUint32(abView.constructor === Buffer ? kBufferTag :
+      kUint8ArrayTag);
+    this.writeUint32(abView.byteLength);
+    this[kOutOfBand].push(abView);
+  }
+}
+
+class ChildProcessDeserializer extends DefaultDeserializer {
+  constructor(buffer) {
+    super(buffer);
+    this[kOutOfBandOffset] = buffer.byteOffset + buffer.length;
+  }
+
+  _readHostObject() {
+    const tag = this.readUint32();
+    if (tag === kInlineTag)
+      return super._readHostObject();
+
+    // Out-of-band buffers are laid out in the order in which they were
+    // serialized, which is also the order in which they are deserialized.
+    const byteLength = this.readUint32();
+    const offset = this[kOutOfBandOffset];
+    this[kOutOfBandOffset] += byteLength;
+    if (tag === kBufferTag)
+      return new FastBuffer(this.buffer.buffer, offset, byteLength);
+    return new Uint8Array(this.buffer.buffer, offset, byteLength);
+  }
+}
+
+const headerPlaceholder = Buffer.alloc(kHeaderSize);
+
+const advanced = {
+  initMessageChannel(channel) {
+    channel[kMessageBuffer] = [];
+    channel[kMessageBufferSize] = 0;
+  },
+
+  parseChannelMessages(channel, readData, onMessage) {
+    const chunks = channel[kMessageBuffer];
+    chunks.push(readData);
+    channel[kMessageBufferSize] += readData.length;
+
+    while (channel[kMessageBufferSize] >= kHeaderSize) {
+      if (chunks[0].length < kHeaderSize)
+        chunks.splice(0, chunks.length,
+                      Buffer.concat(chunks, channel[kMessageBufferSize]));
+
+      const size = kHeaderSize + chunks[0].readUInt32BE(0);
+      if (channel[kMessageBufferSize] < size)
+        break;
+
+      // Messages that arrive in one read are not copied. Larger ones are
+      // copied into a single buffer once they are complete.
+      if (chunks[0].length < size)
+        chunks.splice(0, chunks.length,
+                      Buffer.concat(chunks, channel[kMessageBufferSize]));
+
+      const message = chunks[0].slice(0, size);
+      if (chunks[0].length === size)
+        chunks.shift();
+      else
+        chunks[0] = chunks[0].slice(size);
+      channel[kMessageBufferSize] -= size;
+
+      const serializedSize = message.readUInt32BE(4);
+      const deserializer = new ChildProcessDeserializer(
+        message.slice(kHeaderSize, kHeaderSize + serializedSize));
+      deserializer.readHeader();
+      onMessage(deserializer.readValue());
+    }
+
+    channel.buffering = channel[kMessageBufferSize] !== 0;
+  },
+
+  writeChannelMessage(channel, req, message, handle) {
+    const ser = new ChildProcessSerializer();
+    // Reserve room for the header, so that it does not need to be written
+    // separately.
+    ser.writeRawBytes(headerPlaceholder);
+    ser.writeHeader();
+    ser.writeValue(message);
+    const serialized = ser.releaseBuffer();
+    const outOfBand = ser[kOutOfBand];
+
+    let size = serialized.length - kHeaderSize;
+    for (var i = 0; i < outOfBand.length; i++)
+      size += outOfBand[i].byteLength;
+    if (size > kMaxMessageSize)
+      throw new ERR_OUT_OF_RANGE('message size', `<= ${kMaxMessageSize}`, size);
+
+    serialized.writeUInt32BE(size, 0);
+    serialized.writeUInt32BE(serialized.length - kHeaderSize, 4);
+
+    if (outOfBand.length === 0)
+      return channel.writeBuffer(req, serialized, handle);
+
+    const chunks = [serialized].concat(outOfBand);
+    if (typeof channel.writev !== 'function') {
+      return channel.writeBuffer(req,
+                                 Buffer.concat(chunks, kHeaderSize + size),
+                                 handle);
+    }
+
+    const err = channel.writev(req, chunks, true, handle);
+    if (err === 0) req._chunks = chunks;
+    return err;
+  }
+};
+
+const json = {
+  initMessageChannel(channel) {
+    channel[kJSONBuffer] = '';
+    if (StringDecoder === undefined)
+      StringDecoder = require('string_decoder').StringDecoder;
+    channel[kStringDecoder] = new StringDecoder('utf8');
+  },
+
+  parseChannelMessages(channel, readData, onMessage) {
+    // Linebreak is used as a message end sign
+    var chunks = channel[kStringDecoder].write(readData).split('\n');
+    var numCompleteChunks = chunks.length - 1;
+    // Last line does not have trailing linebreak
+    var incompleteChunk = chunks[numCompleteChunks];
+    if (numCompleteChunks === 0) {
+      channel[kJSONBuffer] += incompleteChunk;
+      channel.buffering = channel[kJSONBuffer].length !== 0;
+      return;
+    }
+    chunks[0] = channel[kJSONBuffer] + chunks[0];
+
+    for (var i = 0; i < numCompleteChunks; i++)
+      onMessage(JSON.parse(chunks[i]));
+
+    channel[kJSONBuffer] = incompleteChunk;
+    channel.buffering = channel[kJSONBuffer].length !== 0;
+  },
+
+  writeChannelMessage(channel, req, message, handle) {
+    var string = JSON.stringify(message) + '\n';
+    return channel.writeUtf8String(req, string, handle);
+  }
+};
+
+module.exports = { advanced, json };
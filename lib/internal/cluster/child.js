@@ -4,6 +4,7 @@ const util = require('util');
 const path = require('path');
 const EventEmitter = require('events');
 const Worker = require('internal/cluster/worker');
+const { constants: TCPConstants } = process.binding('tcp_wrap');
 const { internal, sendHelper } = require('internal/cluster/utils');
 const cluster = new EventEmitter();
 const handles = {};
@@ -84,6 +85,8 @@ cluster._getServer = function(obj, options, cb) {
 
     if (handle)
       shared(reply, handle, indexesKey, cb);  // Shared listen socket.
+    else if (reply.reusePort)
+      reusePort(reply, indexesKey, cb);       // Kernel balanced sockets.
     else
       rr(reply, indexesKey, cb);              // Round-robin.
   });
@@ -115,6 +118,28 @@ function shared(message, handle, indexesKey, cb) {
   cb(message.errno, handle);
 }
 
+// SO_REUSEPORT. Bind a socket of our own to the address that the master
+// reserved for us.
+function reusePort(message, indexesKey, cb) {
+  const key = message.key;
+
+  if (message.errno === 0) {
+    const { address, port, family } = message.sockname;
+    const rval = require('net')._createServerHandle(
+      address, port, family === 'IPv6' ? 6 : 4, undefined,
+      TCPConstants.REUSEPORT);
+
+    if (typeof rval !== 'number')
+      return shared(message, rval, indexesKey, cb);
+
+    message.errno = rval;
+  }
+
+  send({ act: 'close', key });
+  delete indexes[indexesKey];
+  cb(message.errno, null);
+}
+
 // Round-robin. Master distributes handles across workers.
 function rr(message, indexesKey, cb) {
   if (message.errno)
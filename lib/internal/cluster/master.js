@@ -4,6 +4,7 @@ const { fork } = require('child_process');
 const util = require('util');
 const path = require('path');
 const EventEmitter = require('events');
+const ReusePortHandle = require('internal/cluster/reuse_port_handle');
 const RoundRobinHandle = require('internal/cluster/round_robin_handle');
 const SharedHandle = require('internal/cluster/shared_handle');
 const Worker = require('internal/cluster/worker');
@@ -14,6 +15,7 @@ const cluster = new EventEmitter();
 const intercom = new EventEmitter();
 const SCHED_NONE = 1;
 const SCHED_RR = 2;
+const SCHED_REUSEPORT = 3;
 const { isLegalPort } = require('internal/net');
 const [ minPort, maxPort ] = [ 1024, 65535 ];
 
@@ -26,6 +28,7 @@ cluster.workers = {};
 cluster.settings = {};
 cluster.SCHED_NONE = SCHED_NONE;  // Leave it to the operating system.
 cluster.SCHED_RR = SCHED_RR;      // Master distributes connections.
+cluster.SCHED_REUSEPORT = SCHED_REUSEPORT;  // Workers accept directly.
 
 var ids = 0;
 var debugPortOffset = 1;
@@ -34,7 +37,8 @@ var initialized = false;
 // XXX(bnoordhuis) Fold cluster.schedulingPolicy into cluster.settings?
 var schedulingPolicy = {
   'none': SCHED_NONE,
-  'rr': SCHED_RR
+  'rr': SCHED_RR,
+  'reuseport': SCHED_REUSEPORT
 }[process.env.NODE_CLUSTER_SCHED_POLICY];
 
 if (schedulingPolicy === undefined) {
@@ -71,7 +75,8 @@ cluster.setupMaster = function(options) {
 
   initialized = true;
   schedulingPolicy = cluster.schedulingPolicy;  // Freeze policy.
-  assert(schedulingPolicy === SCHED_NONE || schedulingPolicy === SCHED_RR,
+  assert(schedulingPolicy === SCHED_NONE || schedulingPolicy === SCHED_RR ||
+         schedulingPolicy === SCHED_REUSEPORT,
          `Bad cluster.schedulingPolicy: ${schedulingPolicy}`);
 
   process.nextTick(setupSettingsNT, settings);
@@ -139,7 +144,8 @@ function createWorkerProcess(id, env) {
     execArgv: execArgv,
     stdio: cluster.settings.stdio,
     gid: cluster.settings.gid,
-    uid: cluster.settings.uid
+    uid: cluster.settings.uid,
+    serialization: cluster.settings.serialization
   });
 }
 
@@ -296,9 +302,14 @@ function queryServer(worker, message) {
     // UDP is exempt from round-robin connection balancing for what should
     // be obvious reasons: it's connectionless. There is nothing to send to
     // the workers except raw datagrams and that's pointless.
-    if (schedulingPolicy !== SCHED_RR ||
-        message.addressType === 'udp4' ||
-        message.addressType === 'udp6') {
+    if (message.addressType === 'udp4' || message.addressType === 'udp6') {
+      constructor = SharedHandle;
+    } else if (schedulingPolicy === SCHED_REUSEPORT) {
+      // UNIX sockets and inherited file descriptors cannot be bound again
+      // by every worker, so those fall back to round-robin.
+      if (message.port >= 0 && !(message.fd >= 0))
+        constructor = ReusePortHandle;
+    } else if (schedulingPolicy !== SCHED_RR) {
       constructor = SharedHandle;
     }
 
@@ -0,0 +1,59 @@
+'use strict';
+const assert = require('assert');
+const net = require('net');
+const { constants: TCPConstants } = process.binding('tcp_wrap');
+
+module.exports = ReusePortHandle;
+
+// Workers bind and listen on their own SO_REUSEPORT sockets and the kernel
+// balances new connections across them. The master only binds, without
+// listening, to reserve the port (and to resolve port 0) for as long as any
+// worker still uses it.
+function ReusePortHandle(key, address, port, addressType, fd) {
+  this.key = key;
+  this.workers = [];
+  this.handle = null;
+  this.errno = 0;
+  this.sockname = null;
+
+  const rval = net._createServerHandle(address, port, addressType, fd,
+                                       TCPConstants.REUSEPORT);
+
+  if (typeof rval === 'number') {
+    this.errno = rval;
+    return;
+  }
+
+  const out = {};
+  this.errno = rval.getsockname(out);
+
+  if (this.errno === 0) {
+    this.handle = rval;
+    this.sockname = out;
+  } else {
+    rval.close();
+  }
+}
+
+ReusePortHandle.prototype.add = function(worker, send) {
+  assert(this.workers.indexOf(worker) === -1);
+  this.workers.push(worker);
+  send(this.errno, { reusePort: true, sockname: this.sockname }, null);
+};
+
+ReusePortHandle.prototype.remove = function(worker) {
+  const index = this.workers.indexOf(worker);
+
+  if (index === -1)
+    return false; // The worker wasn't using this handle.
+
+  this.workers.splice(index, 1);
+
+  if (this.workers.length !== 0)
+    return false;
+
+  if (this.handle !== null)
+    this.handle.close();
+  this.handle = null;
+  return true;
+};
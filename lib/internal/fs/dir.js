@@ -0,0 +1,224 @@
+'use strict';
+
+const binding = process.binding('fs');
+const {
+  ERR_DIR_CLOSED,
+  ERR_DIR_CONCURRENT_OPERATION,
+  ERR_INVALID_CALLBACK
+} = require('internal/errors').codes;
+const { getPathFromURL } = require('internal/url');
+const { promisify } = require('internal/util');
+const {
+  getDirent,
+  getOptions,
+  handleErrorFromBinding,
+  validatePath
+} = require('internal/fs/utils');
+const { validateUint32 } = require('internal/validators');
+const pathModule = require('path');
+
+const { FSReqWrap, kUsePromises } = binding;
+
+const kDirHandle = Symbol('kDirHandle');
+const kDirPath = Symbol('kDirPath');
+const kDirOptions = Symbol('kDirOptions');
+const kDirBufferedEntries = Symbol('kDirBufferedEntries');
+const kDirClosed = Symbol('kDirClosed');
+const kDirOperationQueue = Symbol('kDirOperationQueue');
+const kDirReadPromisified = Symbol('kDirReadPromisified');
+const kDirClosePromisified = Symbol('kDirClosePromisified');
+
+// An open directory stream. Entries are read from the native handle in
+// batches of `options.bufferSize` and handed out one at a time, so that the
+// memory needed to iterate a directory does not depend on its size.
+class Dir {
+  constructor(handle, path, options) {
+    this[kDirHandle] = handle;
+    this[kDirPath] = path;
+    this[kDirOptions] = options;
+    // Flat [name, type, name, type, ...] list as returned by the binding.
+    this[kDirBufferedEntries] = [];
+    this[kDirClosed] = false;
+    // Operations requested while an asynchronous one is in progress.
+    this[kDirOperationQueue] = null;
+
+    this[kDirReadPromisified] = promisify(this.read).bind(this);
+    this[kDirClosePromisified] = promisify(this.close).bind(this);
+  }
+
+  get path() {
+    return this[kDirPath];
+  }
+
+  read(callback) {
+    if (callback === undefined)
+      return this[kDirReadPromisified]();
+    if (typeof callback !== 'function')
+      throw new ERR_INVALID_CALLBACK();
+    if (this[kDirClosed])
+      throw new ERR_DIR_CLOSED();
+
+    if (this[kDirOperationQueue] !== null) {
+      this[kDirOperationQueue].push(() => this.read(callback));
+      return;
+    }
+
+    if (this[kDirBufferedEntries].length > 0) {
+      const [name, type] = this[kDirBufferedEntries].splice(0, 2);
+      getDirent(this[kDirPath], name, type, callback);
+      return;
+    }
+
+    const req = new FSReqWrap();
+    req.oncomplete = (err, result) => {
+      const queue = this[kDirOperationQueue];
+      this[kDirOperationQueue] = null;
+      if (err) {
+        callback(err);
+      } else if (result === null) {
+        callback(null, null);
+      } else {
+        this[kDirBufferedEntries] = result;
+        const [name, type] = this[kDirBufferedEntries].splice(0, 2);
+        getDirent(this[kDirPath], name, type, callback);
+      }
+      for (const operation of queue)
+        operation();
+    };
+
+    this[kDirOperationQueue] = [];
+    this[kDirHandle].read(this[kDirOptions].encoding,
+                          this[kDirOptions].bufferSize, req);
+  }
+
+  readSync() {
+    if (this[kDirClosed])
+      throw new ERR_DIR_CLOSED();
+    if (this[kDirOperationQueue] !== null)
+      throw new ERR_DIR_CONCURRENT_OPERATION();
+
+    if (this[kDirBufferedEntries].length === 0) {
+      const ctx = { path: this[kDirPath] };
+      const result = this[kDirHandle].read(this[kDirOptions].encoding,
+                                           this[kDirOptions].bufferSize,
+                                           undefined, ctx);
+      handleErrorFromBinding(ctx);
+      if (result === null)
+        return null;
+      this[kDirBufferedEntries] = result;
+    }
+
+    const [name, type] = this[kDirBufferedEntries].splice(0, 2);
+    return getDirent(this[kDirPath], name, type);
+  }
+
+  close(callback) {
+    if (callback === undefined)
+      return this[kDirClosePromisified]();
+    if (typeof callback !== 'function')
+      throw new ERR_INVALID_CALLBACK();
+    if (this[kDirClosed])
+      throw new ERR_DIR_CLOSED();
+
+    if (this[kDirOperationQueue] !== null) {
+      this[kDirOperationQueue].push(() => this.close(callback));
+      return;
+    }
+
+    this[kDirClosed] = true;
+    this[kDirBufferedEntries] = [];
+    const req = new FSReqWrap();
+    req.oncomplete = callback;
+    this[kDirHandle].close(req);
+  }
+
+  closeSync() {
+    if (this[kDirClosed])
+      throw new ERR_DIR_CLOSED();
+    if (this[kDirOperationQueue] !== null)
+      throw new ERR_DIR_CONCURRENT_OPERATION();
+
+    this[kDirClosed] = true;
+    this[kDirBufferedEntries] = [];
+    const ctx = { path: this[kDirPath] };
+    this[kDirHandle].close(undefined, ctx);
+    handleErrorFromBinding(ctx);
+  }
+
+  async* entries() {
+    try {
+      while (true) {
+        const dirent = await this[kDirReadPromisified]();
+        if (dirent === null)
+          break;
+        yield dirent;
+      }
+    } finally {
+      if (!this[kDirClosed])
+        await this[kDirClosePromisified]();
+    }
+  }
+}
+
+Object.defineProperty(Dir.prototype, Symbol.asyncIterator, {
+  value: Dir.prototype.entries,
+  enumerable: false,
+  writable: true,
+  configurable: true
+});
+
+function getDirOptions(options) {
+  options = getOptions(options, { encoding: 'utf8', bufferSize: 32 });
+  if (options.bufferSize === undefined)
+    options = Object.assign({}, options, { bufferSize: 32 });
+  validateUint32(options.bufferSize, 'options.bufferSize', true);
+  return options;
+}
+
+function opendir(path, options, callback) {
+  callback = typeof options === 'function' ? options : callback;
+  if (typeof callback !== 'function')
+    throw new ERR_INVALID_CALLBACK();
+  path = getPathFromURL(path);
+  validatePath(path);
+  options = getDirOptions(options);
+
+  const req = new FSReqWrap();
+  req.oncomplete = (err, handle) => {
+    if (err) {
+      callback(err);
+      return;
+    }
+    callback(null, new Dir(handle, path, options));
+  };
+  binding.opendir(pathModule.toNamespacedPath(path), req);
+}
+
+function opendirSync(path, options) {
+  path = getPathFromURL(path);
+  validatePath(path);
+  options = getDirOptions(options);
+
+  const ctx = { path };
+  const handle = binding.opendir(pathModule.toNamespacedPath(path),
+                                 undefined, ctx);
+  handleErrorFromBinding(ctx);
+  return new Dir(handle, path, options);
+}
+
+async function opendirPromise(path, options) {
+  path = getPathFromURL(path);
+  validatePath(path);
+  options = getDirOptions(options);
+
+  const handle = await binding.opendir(pathModule.toNamespacedPath(path),
+                                       kUsePromises);
+  return new Dir(handle, path, options);
+}
+
+module.exports = {
+  Dir,
+  opendir,
+  opendirSync,
+  opendirPromise
+};
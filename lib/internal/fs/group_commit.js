@@ -0,0 +1,140 @@
+'use strict';
+
+// Group commit for appends: appends to the same file descriptor that arrive
+// within a short window, or while an earlier batch is being committed, are
+// gathered into one batch, which is written with writev() and then made
+// durable with a single fdatasync(). Each append's callback is called once
+// the batch that holds its data has been synced.
+
+const {
+  FSReqWrap,
+  fdatasync,
+  writeBuffers
+} = process.binding('fs');
+const { ERR_INVALID_ARG_TYPE } = require('internal/errors').codes;
+const { validateUint32 } = require('internal/validators');
+
+const kDefaultMaxBytes = 1024 * 1024;
+
+// Committers by file descriptor. An entry is removed as soon as it has no
+// batch in progress, so that a reused descriptor starts afresh.
+const committers = new Map();
+
+function getGroupCommitOptions(options, name) {
+  if (options === true)
+    options = {};
+  if (options === null || typeof options !== 'object')
+    throw new ERR_INVALID_ARG_TYPE(name, ['boolean', 'Object'], options);
+  const { maxDelay = 0, maxBytes = kDefaultMaxBytes } = options;
+  validateUint32(maxDelay, `${name}.maxDelay`);
+  validateUint32(maxBytes, `${name}.maxBytes`, true);
+  return { maxDelay, maxBytes };
+}
+
+// Writes all of `chunks` at the current file position, retrying short
+// writes.
+function writeAll(fd, chunks, callback) {
+  if (chunks.length === 0)
+    return process.nextTick(callback, null);
+  const req = new FSReqWrap();
+  req.oncomplete = (err, written) => {
+    if (err)
+      return callback(err);
+    while (chunks.length > 0 && written >= chunks[0].length) {
+      written -= chunks[0].length;
+      chunks.shift();
+    }
+    if (chunks.length === 0)
+      return callback(null);
+    chunks[0] = chunks[0].slice(written);
+    writeAll(fd, chunks, callback);
+  };
+  writeBuffers(fd, chunks, null, req);
+}
+
+class GroupCommit {
+  constructor(fd, { maxDelay, maxBytes }) {
+    this.fd = fd;
+    this.maxDelay = maxDelay;
+    this.maxBytes = maxBytes;
+    this.chunks = [];
+    this.callbacks = [];
+    this.bytes = 0;
+    this.committing = false;
+    this.timeout = null;
+    this.immediate = null;
+  }
+
+  append(chunks, callback) {
+    for (var i = 0; i < chunks.length; i++) {
+      this.chunks.push(chunks[i]);
+      this.bytes += chunks[i].length;
+    }
+    this.callbacks.push(callback);
+
+    // Appends that arrive during a commit go into the next batch, which is
+    // started as soon as the current one is done.
+    if (this.committing)
+      return;
+    if (this.bytes >= this.maxBytes)
+      this.commit();
+    else if (this.maxDelay > 0 && this.timeout === null)
+      this.timeout = setTimeout(() => this.commit(), this.maxDelay);
+    else if (this.maxDelay === 0 && this.immediate === null)
+      this.immediate = setImmediate(() => this.commit());
+  }
+
+  commit() {
+    if (this.timeout !== null) {
+      clearTimeout(this.timeout);
+      this.timeout = null;
+    }
+    if (this.immediate !== null) {
+      clearImmediate(this.immediate);
+      this.immediate = null;
+    }
+
+    const callbacks = this.callbacks;
+    const chunks = this.chunks;
+    this.callbacks = [];
+    this.chunks = [];
+    this.bytes = 0;
+    this.committing = true;
+
+    writeAll(this.fd, chunks, (err) => {
+      if (err)
+        return this.done(err, callbacks);
+      const req = new FSReqWrap();
+      req.oncomplete = (err) => this.done(err, callbacks);
+      fdatasync(this.fd, req);
+    });
+  }
+
+  done(err, callbacks) {
+    this.committing = false;
+    if (this.callbacks.length > 0)
+      this.commit();
+    else
+      committers.delete(this.fd);
+
+    for (var i = 0; i < callbacks.length; i++)
+      callbacks[i](err);
+  }
+}
+
+// Appends `chunks`, an array of Buffers, to `fd` as part of the next batch.
+// `options` are the ones returned by getGroupCommitOptions(), and only take
+// effect if no batch is being gathered for `fd` yet.
+function groupCommit(fd, chunks, options, callback) {
+  let committer = committers.get(fd);
+  if (committer === undefined) {
+    committer = new GroupCommit(fd, options);
+    committers.set(fd, committer);
+  }
+  committer.append(chunks, callback);
+}
+
+module.exports = {
+  getGroupCommitOptions,
+  groupCommit
+};
@@ -18,14 +18,18 @@ const { getPathFromURL } = require('internal/url');
 const { isUint8Array } = require('internal/util/types');
 const {
   copyObject,
+  getDirents,
   getOptions,
   getStatsFromBinding,
   nullCheck,
+  packReadRanges,
   preprocessSymlinkDestination,
   stringToFlags,
   stringToSymlinkType,
   toUnixTimestamp,
+  unpackReadRanges,
   validateBuffer,
+  validateBufferArray,
   validateOffsetLengthRead,
   validateOffsetLengthWrite,
   validatePath
@@ -36,11 +40,19 @@ const {
   validateInteger,
   validateUint32
 } = require('internal/validators');
+const { opendirPromise: opendir } = require('internal/fs/dir');
+const {
+  getGroupCommitOptions,
+  groupCommit: appendToGroupCommit
+} = require('internal/fs/group_commit');
+const { promisify } = require('internal/util');
 const pathModule = require('path');
 
 const kHandle = Symbol('handle');
 const { kUsePromises } = binding;
 
+const getDirentsPromise = promisify(getDirents);
+
 class FileHandle {
   constructor(filehandle) {
     this[kHandle] = filehandle;
@@ -70,6 +82,10 @@ class FileHandle {
     return fdatasync(this);
   }
 
+  groupCommit(data, options) {
+    return groupCommit(this, data, options);
+  }
+
   sync() {
     return fsync(this);
   }
@@ -78,6 +94,14 @@ class FileHandle {
     return read(this, buffer, offset, length, position);
   }
 
+  readv(buffers, position) {
+    return readv(this, buffers, position);
+  }
+
+  readRanges(ranges) {
+    return readRanges(this, ranges);
+  }
+
   readFile(options) {
     return readFile(this, options);
   }
@@ -220,6 +244,44 @@ async function read(handle, buffer, offset, length, position) {
   return { bytesRead, buffer };
 }
 
+async function readv(handle, buffers, position) {
+  validateFileHandle(handle);
+  validateBufferArray(buffers);
+
+  if (!isUint32(position))
+    position = -1;
+
+  const bytesRead = (await binding.readBuffers(handle.fd, buffers, position,
+                                               kUsePromises)) || 0;
+  return { bytesRead, buffers };
+}
+
+async function readRanges(handle, ranges) {
+  validateFileHandle(handle);
+  const packed = packReadRanges(ranges);
+  const result = await binding.readRanges(handle.fd, packed, kUsePromises);
+  return unpackReadRanges(packed, result);
+}
+
+async function groupCommit(handle, data, options = true) {
+  validateFileHandle(handle);
+  if (typeof data === 'string')
+    data = Buffer.from(data);
+  else if (!isUint8Array(data))
+    throw new ERR_INVALID_ARG_TYPE('data', ['string', 'Buffer', 'Uint8Array'],
+                                   data);
+  options = getGroupCommitOptions(options, 'options');
+
+  return new Promise((resolve, reject) => {
+    appendToGroupCommit(handle.fd, [data], options, (err) => {
+      if (err)
+        reject(err);
+      else
+        resolve();
+    });
+  });
+}
+
 async function write(handle, buffer, offset, length, position) {
   validateFileHandle(handle);
 
@@ -295,8 +357,12 @@ async function readdir(path, options) {
   options = getOptions(options, {});
   path = getPathFromURL(path);
   validatePath(path);
-  return binding.readdir(pathModule.toNamespacedPath(path),
-                         options.encoding, kUsePromises);
+  const result = await binding.readdir(pathModule.toNamespacedPath(path),
+                                       options.encoding,
+                                       !!options.withFileTypes, kUsePromises);
+  return options.withFileTypes ?
+    getDirentsPromise(path, result) :
+    result;
 }
 
 async function readlink(path, options) {
@@ -470,6 +536,7 @@ module.exports = {
   truncate,
   rmdir,
   mkdir,
+  opendir,
   readdir,
   readlink,
   symlink,
@@ -6,6 +6,7 @@ const {
 } = process.binding('fs');
 const {
   ERR_INVALID_ARG_TYPE,
+  ERR_INVALID_OPT_VALUE,
   ERR_OUT_OF_RANGE
 } = require('internal/errors').codes;
 const fs = require('fs');
@@ -14,11 +15,16 @@ const {
   copyObject,
   getOptions,
 } = require('internal/fs/utils');
+const {
+  getGroupCommitOptions,
+  groupCommit
+} = require('internal/fs/group_commit');
 const { Readable, Writable } = require('stream');
 const { getPathFromURL } = require('internal/url');
 const util = require('util');
 
 const kMinPoolSpace = 128;
+const kGroupCommit = Symbol('kGroupCommit');
 
 let pool;
 
@@ -246,6 +252,16 @@ function WriteStream(path, options) {
     this.pos = this.start;
   }
 
+  if (options.groupCommit === undefined || options.groupCommit === false) {
+    this[kGroupCommit] = null;
+  } else {
+    // Batches are appended at the current file position.
+    if (this.start !== undefined)
+      throw new ERR_INVALID_OPT_VALUE('start', this.start);
+    this[kGroupCommit] = getGroupCommitOptions(options.groupCommit,
+                                               'options.groupCommit');
+  }
+
   if (options.encoding)
     this.setDefaultEncoding(options.encoding);
 
@@ -291,6 +307,9 @@ WriteStream.prototype._write = function(data, encoding, cb) {
     });
   }
 
+  if (this[kGroupCommit] !== null)
+    return commit(this, [data], data.length, cb);
+
   fs.write(this.fd, data, 0, data.length, this.pos, (er, bytes) => {
     if (er) {
       if (this.autoClose) {
@@ -319,6 +338,21 @@ function writev(fd, chunks, position, callback) {
 }
 
 
+// Calls `cb` once `chunks` have been written and synced as part of a group
+// commit, see lib/internal/fs/group_commit.js.
+function commit(stream, chunks, size, cb) {
+  groupCommit(stream.fd, chunks, stream[kGroupCommit], (er) => {
+    if (er) {
+      if (stream.autoClose) {
+        stream.destroy();
+      }
+      return cb(er);
+    }
+    stream.bytesWritten += size;
+    cb();
+  });
+}
+
 WriteStream.prototype._writev = function(data, cb) {
   if (typeof this.fd !== 'number') {
     return this.once('open', function() {
@@ -338,6 +372,9 @@ WriteStream.prototype._writev = function(data, cb) {
     size += chunk.length;
   }
 
+  if (this[kGroupCommit] !== null)
+    return commit(this, chunks, size, cb);
+
   writev(this.fd, chunks, this.pos, function(er, bytes) {
     if (er) {
       self.destroy();
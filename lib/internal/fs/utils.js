@@ -9,6 +9,7 @@ const {
   ERR_INVALID_OPT_VALUE_ENCODING,
   ERR_OUT_OF_RANGE
 } = require('internal/errors').codes;
+const { uvException } = require('internal/errors');
 const { isUint8Array } = require('internal/util/types');
 const pathModule = require('path');
 const util = require('util');
@@ -30,12 +31,30 @@ const {
   S_IFMT,
   S_IFREG,
   S_IFSOCK,
+  UV_DIRENT_UNKNOWN,
+  UV_DIRENT_FILE,
+  UV_DIRENT_DIR,
+  UV_DIRENT_LINK,
+  UV_DIRENT_FIFO,
+  UV_DIRENT_SOCKET,
+  UV_DIRENT_CHAR,
+  UV_DIRENT_BLOCK,
   UV_FS_SYMLINK_DIR,
   UV_FS_SYMLINK_JUNCTION
 } = process.binding('constants').fs;
 
 const isWindows = process.platform === 'win32';
 
+const kType = Symbol('type');
+const kStats = Symbol('stats');
+
+let fs;
+function lazyLoadFs() {
+  if (!fs)
+    fs = require('fs');
+  return fs;
+}
+
 function assertEncoding(encoding) {
   if (encoding && !Buffer.isEncoding(encoding)) {
     throw new ERR_INVALID_OPT_VALUE_ENCODING(encoding);
@@ -49,6 +68,139 @@ function copyObject(source) {
   return target;
 }
 
+function handleErrorFromBinding(ctx) {
+  if (ctx.errno !== undefined) {  // libuv error numbers
+    const err = uvException(ctx);
+    Error.captureStackTrace(err, handleErrorFromBinding);
+    throw err;
+  } else if (ctx.error !== undefined) {  // errors created in C++ land.
+    // TODO(joyeecheung): currently, ctx.error are encoding errors
+    // usually caused by memory problems. We need to figure out proper error
+    // code(s) for this.
+    Error.captureStackTrace(ctx.error, handleErrorFromBinding);
+    throw ctx.error;
+  }
+}
+
+class Dirent {
+  constructor(name, type) {
+    this.name = name;
+    this[kType] = type;
+  }
+
+  isDirectory() {
+    return this[kType] === UV_DIRENT_DIR;
+  }
+
+  isFile() {
+    return this[kType] === UV_DIRENT_FILE;
+  }
+
+  isBlockDevice() {
+    return this[kType] === UV_DIRENT_BLOCK;
+  }
+
+  isCharacterDevice() {
+    return this[kType] === UV_DIRENT_CHAR;
+  }
+
+  isSymbolicLink() {
+    return this[kType] === UV_DIRENT_LINK;
+  }
+
+  isFIFO() {
+    return this[kType] === UV_DIRENT_FIFO;
+  }
+
+  isSocket() {
+    return this[kType] === UV_DIRENT_SOCKET;
+  }
+}
+
+// Used for entries whose type the file system did not report.
+class DirentFromStats extends Dirent {
+  constructor(name, stats) {
+    super(name, null);
+    this[kStats] = stats;
+  }
+}
+
+for (const name of Reflect.ownKeys(Dirent.prototype)) {
+  if (name === 'constructor')
+    continue;
+  DirentFromStats.prototype[name] = function() {
+    return this[kStats][name]();
+  };
+}
+
+function joinDirentPath(dir, name) {
+  if (typeof dir === 'string' && typeof name === 'string')
+    return pathModule.join(dir, name);
+  return Buffer.concat([Buffer.from(dir), Buffer.from(pathModule.sep),
+                        Buffer.from(name)]);
+}
+
+// Turns a single directory entry into a Dirent, calling lstat() only if the
+// type is unknown. Returns the Dirent if `callback` is not a function.
+function getDirent(dir, name, type, callback) {
+  if (typeof callback === 'function') {
+    if (type !== UV_DIRENT_UNKNOWN) {
+      process.nextTick(callback, null, new Dirent(name, type));
+      return;
+    }
+    lazyLoadFs().lstat(joinDirentPath(dir, name), (err, stats) => {
+      if (err) {
+        callback(err);
+        return;
+      }
+      callback(null, new DirentFromStats(name, stats));
+    });
+  } else {
+    if (type !== UV_DIRENT_UNKNOWN)
+      return new Dirent(name, type);
+    const stats = lazyLoadFs().lstatSync(joinDirentPath(dir, name));
+    return new DirentFromStats(name, stats);
+  }
+}
+
+// Turns the [names, types] result of binding.readdir() with file types into
+// an array of Dirents, see getDirent().
+function getDirents(dir, [names, types], callback) {
+  const len = names.length;
+  if (typeof callback === 'function') {
+    let pending = 1;
+    let failed = false;
+    const done = (err) => {
+      if (failed)
+        return;
+      if (err) {
+        failed = true;
+        callback(err);
+      } else if (--pending === 0) {
+        callback(null, names);
+      }
+    };
+    for (var i = 0; i < len; i++) {
+      if (types[i] !== UV_DIRENT_UNKNOWN) {
+        names[i] = new Dirent(names[i], types[i]);
+        continue;
+      }
+      const idx = i;
+      pending++;
+      getDirent(dir, names[i], types[i], (err, dirent) => {
+        if (!err)
+          names[idx] = dirent;
+        done(err);
+      });
+    }
+    done();
+  } else {
+    for (var j = 0; j < len; j++)
+      names[j] = getDirent(dir, names[j], types[j]);
+    return names;
+  }
+}
+
 function getOptions(options, defaultOptions) {
   if (options === null || options === undefined ||
       typeof options === 'function') {
@@ -282,6 +434,61 @@ function validateBuffer(buffer) {
   }
 }
 
+function validateBufferArray(buffers) {
+  if (!Array.isArray(buffers) || !buffers.every(isUint8Array)) {
+    const err = new ERR_INVALID_ARG_TYPE('buffers',
+                                         ['Buffer[]', 'Uint8Array[]'], buffers);
+    Error.captureStackTrace(err, validateBufferArray);
+    throw err;
+  }
+}
+
+// Turns an array of `{ position, length }` objects into the Float64Array of
+// position, length pairs that binding.readRanges() expects.
+function packReadRanges(ranges) {
+  if (!Array.isArray(ranges))
+    throw new ERR_INVALID_ARG_TYPE('ranges', 'Array', ranges);
+
+  const packed = new Float64Array(ranges.length * 2);
+  let total = 0;
+  for (var i = 0; i < ranges.length; i++) {
+    const range = ranges[i];
+    if (range === null || typeof range !== 'object')
+      throw new ERR_INVALID_ARG_TYPE(`ranges[${i}]`, 'Object', range);
+    const { position, length } = range;
+    if (typeof position !== 'number')
+      throw new ERR_INVALID_ARG_TYPE(`ranges[${i}].position`, 'number',
+                                     position);
+    if (!Number.isSafeInteger(position) || position < 0)
+      throw new ERR_OUT_OF_RANGE(`ranges[${i}].position`,
+                                 'a non-negative integer', position);
+    if (typeof length !== 'number')
+      throw new ERR_INVALID_ARG_TYPE(`ranges[${i}].length`, 'number', length);
+    if (!Number.isSafeInteger(length) || length < 0)
+      throw new ERR_OUT_OF_RANGE(`ranges[${i}].length`,
+                                 'a non-negative integer', length);
+    total += length;
+    if (total > kMaxLength)
+      throw new ERR_OUT_OF_RANGE('the total length of ranges',
+                                 `<= ${kMaxLength}`, total);
+    packed[2 * i] = position;
+    packed[2 * i + 1] = length;
+  }
+  return packed;
+}
+
+// Splits the [buffer, bytesRead] result of binding.readRanges() into one
+// Buffer per range, which share the memory of the packed buffer.
+function unpackReadRanges(packed, [buffer, bytesRead]) {
+  const buffers = new Array(bytesRead.length);
+  let offset = 0;
+  for (var i = 0; i < bytesRead.length; i++) {
+    buffers[i] = buffer.slice(offset, offset + bytesRead[i]);
+    offset += packed[2 * i + 1];
+  }
+  return buffers;
+}
+
 function validateOffsetLengthRead(offset, length, bufferLength) {
   let err;
 
@@ -334,8 +541,13 @@ function validatePath(path, propName = 'path') {
 module.exports = {
   assertEncoding,
   copyObject,
+  Dirent,
+  getDirent,
+  getDirents,
   getOptions,
+  handleErrorFromBinding,
   nullCheck,
+  packReadRanges,
   preprocessSymlinkDestination,
   realpathCacheKey: Symbol('realpathCacheKey'),
   getStatsFromBinding,
@@ -343,7 +555,9 @@ module.exports = {
   stringToSymlinkType,
   Stats,
   toUnixTimestamp,
+  unpackReadRanges,
   validateBuffer,
+  validateBufferArray,
   validateOffsetLengthRead,
   validateOffsetLengthWrite,
   validatePath
@@ -0,0 +1,139 @@
+'use strict';
+
+const {
+  FSReqWrap,
+  FSWalker,
+  kFsStatsFieldsLength
+} = process.binding('fs');
+const {
+  ERR_INVALID_ARG_TYPE,
+  ERR_INVALID_CALLBACK
+} = require('internal/errors').codes;
+const { getPathFromURL } = require('internal/url');
+const { promisify } = require('internal/util');
+const {
+  getOptions,
+  getStatsFromBinding,
+  validatePath
+} = require('internal/fs/utils');
+const { validateUint32 } = require('internal/validators');
+
+const kHandle = Symbol('kHandle');
+const kPath = Symbol('kPath');
+const kReading = Symbol('kReading');
+const kQueue = Symbol('kQueue');
+const kReadPromisified = Symbol('kReadPromisified');
+
+// A batch of entries found by a Walker. `statValues` holds the
+// `kFsStatsFieldsLength` stat fields of every entry back to back, in the
+// layout that fs.Stats objects are created from.
+class WalkBatch {
+  constructor(paths, statValues) {
+    this.paths = paths;
+    this.statValues = statValues;
+  }
+
+  get length() {
+    return this.paths.length;
+  }
+
+  stats(index) {
+    return getStatsFromBinding(this.statValues, index * kFsStatsFieldsLength);
+  }
+}
+
+class Walker {
+  constructor(path, options) {
+    this[kPath] = path;
+    this[kHandle] = new FSWalker(path, options.encoding,
+                                 options.include, options.exclude,
+                                 options.batchSize, options.concurrency);
+    this[kReading] = false;
+    this[kQueue] = [];
+    this[kReadPromisified] = promisify(this.read).bind(this);
+  }
+
+  get path() {
+    return this[kPath];
+  }
+
+  read(callback) {
+    if (callback === undefined)
+      return this[kReadPromisified]();
+    if (typeof callback !== 'function')
+      throw new ERR_INVALID_CALLBACK();
+
+    if (this[kReading]) {
+      this[kQueue].push(callback);
+      return;
+    }
+
+    this[kReading] = true;
+    const req = new FSReqWrap();
+    req.oncomplete = (err, result) => {
+      this[kReading] = false;
+      if (err)
+        callback(err);
+      else
+        callback(null, result === null ? null : new WalkBatch(...result));
+      if (this[kQueue].length > 0)
+        this.read(this[kQueue].shift());
+    };
+    this[kHandle].read(req);
+  }
+
+  close() {
+    this[kHandle].close();
+  }
+
+  async* [Symbol.asyncIterator]() {
+    try {
+      while (true) {
+        const batch = await this[kReadPromisified]();
+        if (batch === null)
+          break;
+        yield batch;
+      }
+    } finally {
+      this.close();
+    }
+  }
+}
+
+function validatePatterns(patterns, name) {
+  if (patterns === undefined)
+    return [];
+  if (typeof patterns === 'string')
+    return [patterns];
+  if (!Array.isArray(patterns) ||
+      !patterns.every((pattern) => typeof pattern === 'string')) {
+    throw new ERR_INVALID_ARG_TYPE(name, ['string', 'string[]'], patterns);
+  }
+  return patterns;
+}
+
+function walk(path, options) {
+  path = getPathFromURL(path);
+  validatePath(path);
+  options = getOptions(options, {});
+  const {
+    batchSize = 512,
+    concurrency = 4
+  } = options;
+  validateUint32(batchSize, 'options.batchSize', true);
+  validateUint32(concurrency, 'options.concurrency', true);
+
+  return new Walker(path, {
+    encoding: options.encoding,
+    include: validatePatterns(options.include, 'options.include'),
+    exclude: validatePatterns(options.exclude, 'options.exclude'),
+    batchSize,
+    concurrency
+  });
+}
+
+module.exports = {
+  WalkBatch,
+  Walker,
+  walk
+};
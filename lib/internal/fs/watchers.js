@@ -112,6 +112,17 @@ function FSWatcher() {
       this.emit('change', eventType, filename);
     }
   };
+
+  // Recursive watchers on Linux deliver coalesced events in batches of
+  // [eventType, filename] pairs.
+  this._handle.onbatch = (changes) => {
+    for (var i = 0; i < changes.length; i += 2) {
+      // Stop if a listener has closed the watcher.
+      if (!this._handle.initialized)
+        return;
+      this.emit('change', changes[i], changes[i + 1]);
+    }
+  };
 }
 util.inherits(FSWatcher, EventEmitter);
 
@@ -11,6 +11,7 @@ const http = require('http');
 const binding = process.binding('http2');
 const { FileHandle } = process.binding('fs');
 const { StreamPipe } = internalBinding('stream_pipe');
+const { FastBuffer } = require('internal/buffer');
 const assert = require('assert');
 const EventEmitter = require('events');
 const net = require('net');
@@ -90,11 +91,14 @@ const {
   assertValidPseudoHeaderResponse,
   assertValidPseudoHeaderTrailer,
   assertWithinRange,
+  compileHeaders,
   getDefaultSettings,
+  getHeaderBlock,
   getSessionState,
   getSettings,
   getStreamState,
   isPayloadMeaningless,
+  kSensitiveHeaders,
   kSocket,
   mapToHeaders,
   NghttpError,
@@ -140,6 +144,7 @@ const kProtocol = Symbol('protocol');
 const kProxySocket = Symbol('proxy-socket');
 const kRemoteSettings = Symbol('remote-settings');
 const kSentHeaders = Symbol('sent-headers');
+const kSentCompiledHeaders = Symbol('sent-compiled-headers');
 const kSentTrailers = Symbol('sent-trailers');
 const kServer = Symbol('server');
 const kSession = Symbol('session');
@@ -393,6 +398,19 @@ function onStreamRead(nread, buf) {
   }
 }
 
+// Receives the DATA chunks from a single socket read for any number of
+// streams when the `batchReads` option is set. For each stream handle in
+// `handles`, `ranges` holds the offset of its chunk into `buffer` followed
+// by its length.
+function onSessionReadBatch(buffer, handles, ranges) {
+  for (var i = 0; i < handles.length; i++) {
+    const offset = ranges[2 * i];
+    const length = ranges[2 * i + 1];
+    onStreamRead.call(handles[i], length,
+                      new FastBuffer(buffer, offset, length));
+  }
+}
+
 // Called when the remote peer settings have been updated.
 // Resets the cached settings.
 function onSettings() {
@@ -780,10 +798,16 @@ function setupHandle(socket, type, options) {
   handle.onframeerror = onFrameError;
   handle.ongoawaydata = onGoawayData;
   handle.onaltsvc = onAltSvc;
+  handle.onreadbatch = onSessionReadBatch;
 
   if (typeof options.selectPadding === 'function')
     handle.ongetpadding = onSelectPadding(options.selectPadding);
 
+  if (Array.isArray(options.sensitiveHeaders)) {
+    handle.setSensitiveHeaders(
+      options.sensitiveHeaders.map((name) => `${name}`.toLowerCase()));
+  }
+
   assert(socket._handle !== undefined,
          'Internal HTTP/2 Failure. The socket is not connected. Please ' +
          'report this as a bug in Node.js');
@@ -1595,6 +1619,13 @@ class Http2Stream extends Duplex {
   }
 
   get sentHeaders() {
+    const compiled = this[kSentCompiledHeaders];
+    if (compiled !== undefined) {
+      this[kSentHeaders] = Object.assign(Object.create(null),
+                                         compiled.headers,
+                                         this[kSentHeaders]);
+      this[kSentCompiledHeaders] = undefined;
+    }
     return this[kSentHeaders];
   }
 
@@ -2180,13 +2211,16 @@ class ServerHttp2Stream extends Http2Stream {
       headRequest = options.endStream = true;
     options.readable = !options.endStream;
 
-    const headersList = mapToHeaders(headers);
+    const compiled = options.compiledHeaders;
+    const headerBlock = getHeaderBlock(compiled);
+    const headersList = mapToHeaders(headers, undefined, compiled);
     if (!Array.isArray(headersList))
       throw headersList;
 
     const streamOptions = options.endStream ? STREAM_OPTION_EMPTY_PAYLOAD : 0;
 
-    const ret = this[kHandle].pushPromise(headersList, streamOptions);
+    const ret = this[kHandle].pushPromise(headersList, streamOptions,
+                                          headerBlock);
     let err;
     if (typeof ret === 'number') {
       switch (ret) {
@@ -2207,6 +2241,7 @@ class ServerHttp2Stream extends Http2Stream {
     const id = ret.id();
     const stream = new ServerHttp2Stream(session, ret, id, options, headers);
     stream[kSentHeaders] = headers;
+    stream[kSentCompiledHeaders] = compiled;
 
     if (options.endStream)
       stream.end();
@@ -2258,10 +2293,14 @@ class ServerHttp2Stream extends Http2Stream {
       options.endStream = true;
     }
 
-    const headersList = mapToHeaders(headers, assertValidPseudoHeaderResponse);
+    const compiled = options.compiledHeaders;
+    const headerBlock = getHeaderBlock(compiled);
+    const headersList = mapToHeaders(headers, assertValidPseudoHeaderResponse,
+                                     compiled);
     if (!Array.isArray(headersList))
       throw headersList;
     this[kSentHeaders] = headers;
+    this[kSentCompiledHeaders] = compiled;
 
     state.flags |= STREAM_FLAGS_HEADERS_SENT;
 
@@ -2269,7 +2308,7 @@ class ServerHttp2Stream extends Http2Stream {
     if (options.endStream)
       this.end();
 
-    const ret = this[kHandle].respond(headersList, streamOptions);
+    const ret = this[kHandle].respond(headersList, streamOptions, headerBlock);
     if (ret < 0)
       this.destroy(new NghttpError(ret));
   }
@@ -2806,6 +2845,7 @@ function getUnpackedSettings(buf, options = {}) {
 
 // Exports
 module.exports = {
+  compileHeaders,
   constants,
   getDefaultSettings,
   getPackedSettings,
@@ -2816,7 +2856,8 @@ module.exports = {
   Http2Session,
   Http2Stream,
   Http2ServerRequest,
-  Http2ServerResponse
+  Http2ServerResponse,
+  sensitiveHeaders: kSensitiveHeaders
 };
 
 /* eslint-enable no-use-before-define */
@@ -12,6 +12,8 @@ const {
 const kSocket = Symbol('socket');
 
 const {
+  NGHTTP2_NV_FLAG_NONE,
+  NGHTTP2_NV_FLAG_NO_INDEX,
   NGHTTP2_SESSION_CLIENT,
   NGHTTP2_SESSION_SERVER,
 
@@ -182,7 +184,8 @@ const IDX_OPTIONS_MAX_HEADER_LIST_PAIRS = 5;
 const IDX_OPTIONS_MAX_OUTSTANDING_PINGS = 6;
 const IDX_OPTIONS_MAX_OUTSTANDING_SETTINGS = 7;
 const IDX_OPTIONS_MAX_SESSION_MEMORY = 8;
-const IDX_OPTIONS_FLAGS = 9;
+const IDX_OPTIONS_BATCH_READS = 9;
+const IDX_OPTIONS_FLAGS = 10;
 
 function updateOptionsBuffer(options) {
   var flags = 0;
@@ -231,6 +234,10 @@ function updateOptionsBuffer(options) {
     optionsBuffer[IDX_OPTIONS_MAX_SESSION_MEMORY] =
       Math.max(1, options.maxSessionMemory);
   }
+  if (typeof options.batchReads === 'boolean') {
+    flags |= (1 << IDX_OPTIONS_BATCH_READS);
+    optionsBuffer[IDX_OPTIONS_BATCH_READS] = options.batchReads ? 1 : 0;
+  }
   optionsBuffer[IDX_OPTIONS_FLAGS] = flags;
 }
 
@@ -408,12 +415,39 @@ function assertValidPseudoHeaderTrailer(key) {
   return err;
 }
 
+// Headers objects may list header names under this symbol whose values must
+// never be added to the HPACK dynamic table, e.g. because they are secrets or
+// have so many distinct values that indexing them would only evict others.
+const kSensitiveHeaders = Symbol('nodejs.http2.sensitiveHeaders');
+
+// Each header is serialized as name\0value\0 followed by its nghttp2_nv flags.
+const kNoHeaderFlags = String.fromCharCode(NGHTTP2_NV_FLAG_NONE);
+const kNeverIndexFlag = String.fromCharCode(NGHTTP2_NV_FLAG_NO_INDEX);
+
+function getSensitiveHeaders(map) {
+  const names = map[kSensitiveHeaders];
+  if (names === undefined)
+    return undefined;
+  if (!Array.isArray(names)) {
+    throw new ERR_INVALID_ARG_TYPE('headers[http2.sensitiveHeaders]',
+                                   'Array', names);
+  }
+  const neverIndex = new Set();
+  for (var i = 0; i < names.length; i++)
+    neverIndex.add(String(names[i]).toLowerCase());
+  return neverIndex;
+}
+
+// `compiled` is an optional CompiledHeaders instance that is sent along with
+// the returned list. Single-value headers must not appear in both.
 function mapToHeaders(map,
-                      assertValuePseudoHeader = assertValidPseudoHeader) {
+                      assertValuePseudoHeader = assertValidPseudoHeader,
+                      compiled) {
   let ret = '';
   let count = 0;
   const keys = Object.keys(map);
   const singles = new Set();
+  const neverIndex = getSensitiveHeaders(map);
   for (var i = 0; i < keys.length; i++) {
     let key = keys[i];
     let value = map[key];
@@ -438,7 +472,8 @@ function mapToHeaders(map,
       value = String(value);
     }
     if (isSingleValueHeader) {
-      if (singles.has(key))
+      if (singles.has(key) ||
+          (compiled !== undefined && compiled[kSingles].has(key)))
         return new ERR_HTTP2_HEADER_SINGLE_VALUE(key);
       singles.add(key);
     }
@@ -446,20 +481,22 @@ function mapToHeaders(map,
       const err = assertValuePseudoHeader(key);
       if (err !== undefined)
         return err;
-      ret = `${key}\0${value}\0${ret}`;
+      ret = `${key}\0${value}\0${kNoHeaderFlags}${ret}`;
       count++;
     } else {
       if (isIllegalConnectionSpecificHeader(key, value)) {
         return new ERR_HTTP2_INVALID_CONNECTION_HEADERS(key);
       }
+      const flags = neverIndex !== undefined && neverIndex.has(key) ?
+        kNeverIndexFlag : kNoHeaderFlags;
       if (isArray) {
         for (var k = 0; k < value.length; k++) {
           const val = String(value[k]);
-          ret += `${key}\0${val}\0`;
+          ret += `${key}\0${val}\0${flags}`;
         }
         count += value.length;
       } else {
-        ret += `${key}\0${value}\0`;
+        ret += `${key}\0${value}\0${flags}`;
         count++;
       }
     }
@@ -468,6 +505,59 @@ function mapToHeaders(map,
   return [ret, count];
 }
 
+const kHandle = Symbol('handle');
+const kHeaders = Symbol('headers');
+const kSingles = Symbol('singles');
+
+// A set of headers that is validated and serialized once, and can then be
+// sent with any number of responses and push promises without repeating
+// that work. Pseudo-headers and the `date` header, which differ from one
+// response to the next, are not allowed.
+class CompiledHeaders {
+  constructor(headers) {
+    assertIsObject(headers, 'headers');
+    headers = Object.assign(Object.create(null), headers);
+    const headersList = mapToHeaders(headers, assertValidPseudoHeaderTrailer);
+    if (!Array.isArray(headersList))
+      throw headersList;
+
+    const singles = new Set();
+    const keys = Object.keys(headers);
+    for (var i = 0; i < keys.length; i++) {
+      const key = keys[i].toLowerCase();
+      if (headers[keys[i]] !== undefined && kSingleValueHeaders.has(key))
+        singles.add(key);
+    }
+    if (singles.has(HTTP2_HEADER_DATE))
+      throw new ERR_HTTP2_HEADER_SINGLE_VALUE(HTTP2_HEADER_DATE);
+
+    this[kHandle] = new binding.Http2HeaderBlock(headersList);
+    this[kHeaders] = Object.freeze(headers);
+    this[kSingles] = singles;
+  }
+
+  get headers() {
+    return this[kHeaders];
+  }
+}
+
+// Returns the native header block of `options.compiledHeaders`, if any.
+function getHeaderBlock(compiled) {
+  if (compiled === undefined)
+    return undefined;
+  if (!(compiled instanceof CompiledHeaders)) {
+    const err = new ERR_INVALID_ARG_TYPE('options.compiledHeaders',
+                                         'CompiledHeaders', compiled);
+    Error.captureStackTrace(err, getHeaderBlock);
+    throw err;
+  }
+  return compiled[kHandle];
+}
+
+function compileHeaders(headers) {
+  return new CompiledHeaders(headers);
+}
+
 class NghttpError extends Error {
   constructor(ret) {
     super(binding.nghttp2ErrorString(ret));
@@ -567,11 +657,15 @@ module.exports = {
   assertValidPseudoHeaderResponse,
   assertValidPseudoHeaderTrailer,
   assertWithinRange,
+  compileHeaders,
+  CompiledHeaders,
   getDefaultSettings,
+  getHeaderBlock,
   getSessionState,
   getSettings,
   getStreamState,
   isPayloadMeaningless,
+  kSensitiveHeaders,
   kSocket,
   mapToHeaders,
   NghttpError,
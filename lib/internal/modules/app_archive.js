@@ -0,0 +1,59 @@
+'use strict';
+
+// Application archives bundle the sources, package.json files and code caches
+// of an application into a single memory-mapped file, see
+// src/node_app_archive.h. An archive is mounted at its own path through the
+// NODE_APP_ARCHIVE environment variable, after which the module loaders serve
+// every path below it from the archive without touching the file system.
+
+const { internalBinding } = require('internal/bootstrap/loaders');
+const path = require('path');
+const { safeGetenv } = process.binding('util');
+const { UV_EINVAL, UV_ENOENT } = process.binding('uv');
+const {
+  uvException,
+  codes: { ERR_INVALID_APP_ARCHIVE }
+} = require('internal/errors');
+const { CHAR_FORWARD_SLASH } = require('internal/constants');
+const binding = internalBinding('app_archive');
+
+let root = null;
+
+function mount(filename) {
+  filename = path.resolve(filename);
+  const err = binding.mount(filename);
+  if (err === UV_EINVAL)
+    throw new ERR_INVALID_APP_ARCHIVE(filename);
+  if (err !== 0)
+    throw uvException({ errno: err, syscall: 'open', path: filename });
+  root = filename;
+}
+
+function contains(filename) {
+  return root !== null &&
+         filename.startsWith(root) &&
+         (filename.length === root.length ||
+          filename.charCodeAt(root.length) === CHAR_FORWARD_SLASH);
+}
+
+function readFileUtf8(filename) {
+  const content = binding.readFileUtf8(filename);
+  if (content === undefined)
+    throw uvException({ errno: UV_ENOENT, syscall: 'open', path: filename });
+  return content;
+}
+
+// Returns undefined if the archive holds no usable code cache for the file.
+function readCodeCache(filename) {
+  return binding.readCodeCache(filename);
+}
+
+const archive = safeGetenv('NODE_APP_ARCHIVE');
+if (archive)
+  mount(archive);
+
+module.exports = {
+  contains,
+  readFileUtf8,
+  readCodeCache
+};
@@ -0,0 +1,162 @@
+'use strict';
+
+// On-disk code cache for CommonJS modules, enabled through the
+// NODE_COMPILE_CACHE environment variable.
+//
+// Every cache entry lives in a directory that is specific to the V8 version
+// and flag configuration (through `cachedDataVersionTag()`) and is named after
+// a hash of the module's filename. The entry records the filename, mtime and
+// size of the source it was produced from, so that an edited file is never
+// matched with a stale cache. Entries are written to a temporary file first
+// and then renamed into place, so concurrently starting processes never
+// observe partially written data.
+//
+// The cache is strictly best-effort: any error while reading or writing an
+// entry is ignored and the module is compiled as usual.
+
+const fs = require('fs');
+const path = require('path');
+const util = require('util');
+const { Buffer } = require('buffer');
+const { cachedDataVersionTag } = process.binding('v8');
+
+const debug = util.debuglog('module');
+
+const kMagic = 0x4e434301;
+// magic, version tag, mtime, size, filename length.
+const kHeaderSize = 4 + 4 + 8 + 8 + 4;
+
+let cacheDir = null;
+let versionTag = 0;
+let tmpCounter = 0;
+
+function setup(dir) {
+  versionTag = cachedDataVersionTag();
+  cacheDir = path.join(path.resolve(dir),
+                       `v8-${process.versions.v8}-${versionTag.toString(16)}`);
+}
+
+// 32-bit FNV-1a hash of the filename. Collisions merely cause cache misses
+// because the full filename is verified when an entry is loaded.
+function hashFilename(filename) {
+  let hash = 0x811c9dc5;
+  for (var i = 0; i < filename.length; i++) {
+    hash ^= filename.charCodeAt(i);
+    hash = Math.imul(hash, 0x01000193);
+  }
+  return (hash >>> 0).toString(16).padStart(8, '0');
+}
+
+// Must be called before the module source is read. An entry saved for a file
+// that was modified after this point records the old mtime, which will not
+// match on the next start.
+function lookup(filename) {
+  let stats;
+  try {
+    stats = fs.statSync(filename);
+  } catch (err) {
+    return undefined;
+  }
+
+  const entry = {
+    filename,
+    cachePath: path.join(cacheDir, `${hashFilename(filename)}.cache`),
+    mtimeMs: stats.mtimeMs,
+    size: stats.size,
+    cachedData: undefined
+  };
+
+  let data;
+  try {
+    data = fs.readFileSync(entry.cachePath);
+  } catch (err) {
+    debug('compile cache miss for %j', filename);
+    return entry;
+  }
+
+  if (data.length >= kHeaderSize &&
+      data.readUInt32LE(0) === kMagic &&
+      data.readUInt32LE(4) === versionTag &&
+      data.readDoubleLE(8) === entry.mtimeMs &&
+      data.readDoubleLE(16) === entry.size) {
+    const nameLength = data.readUInt32LE(24);
+    const dataStart = kHeaderSize + nameLength;
+    if (dataStart <= data.length &&
+        data.toString('utf8', kHeaderSize, dataStart) === filename) {
+      debug('compile cache hit for %j', filename);
+      entry.cachedData = data.slice(dataStart);
+      return entry;
+    }
+  }
+
+  debug('compile cache stale for %j', filename);
+  return entry;
+}
+
+// Must be called after the module source is read. V8 only validates the
+// length of the source against the code cache, so a hit is only trusted if the
+// file did not change while it was being read.
+function verify(entry) {
+  if (entry.cachedData === undefined)
+    return true;
+  let stats;
+  try {
+    stats = fs.statSync(entry.filename);
+  } catch (err) {
+    return false;
+  }
+  return stats.mtimeMs === entry.mtimeMs && stats.size === entry.size;
+}
+
+function mkdirp(dir) {
+  try {
+    fs.mkdirSync(dir);
+  } catch (err) {
+    if (err.code === 'EEXIST')
+      return;
+    if (err.code !== 'ENOENT' || path.dirname(dir) === dir)
+      throw err;
+    mkdirp(path.dirname(dir));
+    mkdirp(dir);
+  }
+}
+
+// Called after the module has been executed, so that the code cache also
+// covers the functions that were compiled while it ran.
+function save(entry, script) {
+  const tmpPath = `${entry.cachePath}.${process.pid}.${tmpCounter++}.tmp`;
+  try {
+    const cachedData = script.createCachedData();
+    if (cachedData.length === 0)
+      return;
+
+    const nameLength = Buffer.byteLength(entry.filename);
+    const header = Buffer.allocUnsafe(kHeaderSize + nameLength);
+    header.writeUInt32LE(kMagic, 0);
+    header.writeUInt32LE(versionTag, 4);
+    header.writeDoubleLE(entry.mtimeMs, 8);
+    header.writeDoubleLE(entry.size, 16);
+    header.writeUInt32LE(nameLength, 24);
+    header.write(entry.filename, kHeaderSize, nameLength, 'utf8');
+
+    mkdirp(cacheDir);
+    fs.writeFileSync(tmpPath, Buffer.concat([header, cachedData]),
+                     { mode: 0o600 });
+    fs.renameSync(tmpPath, entry.cachePath);
+    debug('compile cache written for %j', entry.filename);
+  } catch (err) {
+    debug('compile cache write failed for %j: %s', entry.filename, err);
+    try {
+      fs.unlinkSync(tmpPath);
+    } catch (err) {
+      // Ignore, the temporary file was most likely never created.
+    }
+  }
+}
+
+module.exports = {
+  setup,
+  lookup,
+  verify,
+  save
+};
@@ -29,8 +29,10 @@ const fs = require('fs');
 const internalFS = require('internal/fs/utils');
 const path = require('path');
 const {
+  internalModuleFindPath,
   internalModuleReadJSON,
-  internalModuleStat
+  internalModuleStat,
+  internalModuleStatCache
 } = process.binding('fs');
 const { safeGetenv } = process.binding('util');
 const {
@@ -39,10 +41,17 @@ const {
   stripBOM,
   stripShebang
 } = require('internal/modules/cjs/helpers');
+const appArchive = require('internal/modules/app_archive');
 const preserveSymlinks = !!process.binding('config').preserveSymlinks;
 const preserveSymlinksMain = !!process.binding('config').preserveSymlinksMain;
 const experimentalModules = !!process.binding('config').experimentalModules;
 
+let compileCache = null;
+if (safeGetenv('NODE_COMPILE_CACHE')) {
+  compileCache = require('internal/modules/cjs/compile_cache');
+  compileCache.setup(safeGetenv('NODE_COMPILE_CACHE'));
+}
+
 const {
   ERR_INVALID_ARG_TYPE,
   ERR_INVALID_ARG_VALUE,
@@ -199,6 +208,9 @@ function tryFile(requestPath, isMain) {
 }
 
 function toRealPath(requestPath) {
+  // Archives contain no symbolic links.
+  if (appArchive.contains(requestPath))
+    return path.resolve(requestPath);
   return fs.realpathSync(requestPath, {
     [internalFS.realpathCacheKey]: realpathCache
   });
@@ -216,6 +228,20 @@ function tryExtensions(p, exts, isMain) {
   return false;
 }
 
+// The native lookup only implements POSIX path semantics.
+const useNativeFindPath = process.platform !== 'win32';
+
+// Turns a result of internalModuleFindPath() into a filename the same way
+// Module._findPath() and tryFile() do.
+function nativeFoundPath(filename, exact, isMain) {
+  if (exact && isMain) {
+    return preserveSymlinksMain ? path.resolve(filename) : toRealPath(filename);
+  }
+  if (preserveSymlinks && !isMain)
+    return path.resolve(filename);
+  return toRealPath(filename);
+}
+
 var warned = false;
 Module._findPath = function(request, paths, isMain) {
   if (path.isAbsolute(request)) {
@@ -237,6 +263,21 @@ Module._findPath = function(request, paths, isMain) {
     trailingSlash = /(?:^|\/)\.?\.$/.test(request);
   }
 
+  if (useNativeFindPath) {
+    // A null result means that a package.json was invalid, in which case the
+    // lookup below takes care of reporting the error.
+    const result = internalModuleFindPath(
+      request, paths, Object.keys(Module._extensions), trailingSlash);
+    if (result === undefined)
+      return false;
+    if (result !== null) {
+      const filename = nativeFoundPath(result[0], result[2], isMain);
+      warnIfResolvedOutsidePackage(request, result[1]);
+      Module._pathCache[cacheKey] = filename;
+      return filename;
+    }
+  }
+
   // For each path
   for (var i = 0; i < paths.length; i++) {
     // Don't search further if path doesn't exist
@@ -288,18 +329,7 @@ Module._findPath = function(request, paths, isMain) {
     }
 
     if (filename) {
-      // Warn once if '.' resolved outside the module dir
-      if (request === '.' && i > 0) {
-        if (!warned) {
-          warned = true;
-          process.emitWarning(
-            'warning: require(\'.\') resolved outside the package ' +
-            'directory. This functionality is deprecated and will be removed ' +
-            'soon.',
-            'DeprecationWarning', 'DEP0019');
-        }
-      }
-
+      warnIfResolvedOutsidePackage(request, i);
       Module._pathCache[cacheKey] = filename;
       return filename;
     }
@@ -307,6 +337,20 @@ Module._findPath = function(request, paths, isMain) {
   return false;
 };
 
+// Warn once if '.' resolved outside the module dir
+function warnIfResolvedOutsidePackage(request, pathIndex) {
+  if (request === '.' && pathIndex > 0) {
+    if (!warned) {
+      warned = true;
+      process.emitWarning(
+        'warning: require(\'.\') resolved outside the package ' +
+        'directory. This functionality is deprecated and will be removed ' +
+        'soon.',
+        'DeprecationWarning', 'DEP0019');
+    }
+  }
+}
+
 // 'node_modules' character codes reversed
 var nmChars = [ 115, 101, 108, 117, 100, 111, 109, 95, 101, 100, 111, 110 ];
 var nmLen = nmChars.length;
@@ -660,18 +704,23 @@ var resolvedArgv;
 // the correct helper variables (require, module, exports) to
 // the file.
 // Returns exception, if any.
-Module.prototype._compile = function(content, filename) {
+// `cacheEntry` is only passed for unmodified file contents, see
+// Module._extensions['.js']. Its `cachedData` is used to skip compilation,
+// and it is written back to the compile cache if it has a `cachePath`.
+Module.prototype._compile = function(content, filename, cacheEntry) {
 
   content = stripShebang(content);
 
   // create wrapper function
   var wrapper = Module.wrap(content);
 
-  var compiledWrapper = vm.runInThisContext(wrapper, {
+  var script = new vm.Script(wrapper, {
     filename: filename,
     lineOffset: 0,
-    displayErrors: true
+    displayErrors: true,
+    cachedData: cacheEntry !== undefined ? cacheEntry.cachedData : undefined
   });
+  var compiledWrapper = script.runInThisContext({ displayErrors: true });
 
   var inspectorWrapper = null;
   if (process._breakFirstLine && process._eval == null) {
@@ -693,7 +742,10 @@ Module.prototype._compile = function(content, filename) {
   var dirname = path.dirname(filename);
   var require = makeRequireFunction(this);
   var depth = requireDepth;
-  if (depth === 0) stat.cache = new Map();
+  if (depth === 0) {
+    stat.cache = new Map();
+    internalModuleStatCache(true);
+  }
   var result;
   if (inspectorWrapper) {
     result = inspectorWrapper(compiledWrapper, this.exports, this.exports,
@@ -702,21 +754,40 @@ Module.prototype._compile = function(content, filename) {
     result = compiledWrapper.call(this.exports, this.exports, require, this,
                                   filename, dirname);
   }
-  if (depth === 0) stat.cache = null;
+  if (depth === 0) {
+    stat.cache = null;
+    internalModuleStatCache(false);
+  }
+  if (cacheEntry !== undefined && cacheEntry.cachePath !== undefined &&
+      (cacheEntry.cachedData === undefined || script.cachedDataRejected)) {
+    compileCache.save(cacheEntry, script);
+  }
   return result;
 };
 
 
 // Native extension for .js
 Module._extensions['.js'] = function(module, filename) {
+  if (appArchive.contains(filename)) {
+    const cachedData = appArchive.readCodeCache(filename);
+    module._compile(stripBOM(appArchive.readFileUtf8(filename)), filename,
+                    cachedData !== undefined ? { cachedData } : undefined);
+    return;
+  }
+  var cacheEntry;
+  if (compileCache !== null)
+    cacheEntry = compileCache.lookup(filename);
   var content = fs.readFileSync(filename, 'utf8');
-  module._compile(stripBOM(content), filename);
+  if (cacheEntry !== undefined && !compileCache.verify(cacheEntry))
+    cacheEntry = undefined;
+  module._compile(stripBOM(content), filename, cacheEntry);
 };
 
 
 // Native extension for .json
 Module._extensions['.json'] = function(module, filename) {
-  var content = fs.readFileSync(filename, 'utf8');
+  var content = appArchive.contains(filename) ?
+    appArchive.readFileUtf8(filename) : fs.readFileSync(filename, 'utf8');
   try {
     module.exports = JSON.parse(stripBOM(content));
   } catch (err) {
@@ -2,6 +2,7 @@
 
 const { URL } = require('url');
 const CJSmodule = require('internal/modules/cjs/loader');
+const appArchive = require('internal/modules/app_archive');
 const internalFS = require('internal/fs/utils');
 const { NativeModule, internalBinding } = require('internal/bootstrap/loaders');
 const { extname } = require('path');
@@ -72,7 +73,9 @@ function resolve(specifier, parentURL) {
 
   const isMain = parentURL === undefined;
 
-  if (isMain ? !preserveSymlinksMain : !preserveSymlinks) {
+  // Archives contain no symbolic links.
+  if ((isMain ? !preserveSymlinksMain : !preserveSymlinks) &&
+      !appArchive.contains(getPathFromURL(url))) {
     const real = realpathSync(getPathFromURL(url), {
       [internalFS.realpathCacheKey]: realpathCache
     });
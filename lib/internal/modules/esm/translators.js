@@ -7,6 +7,7 @@ const {
   stripBOM
 } = require('internal/modules/cjs/helpers');
 const CJSModule = require('internal/modules/cjs/loader');
+const appArchive = require('internal/modules/app_archive');
 const internalURLModule = require('internal/url');
 const createDynamicModule = require(
   'internal/modules/esm/create_dynamic_module');
@@ -25,7 +26,10 @@ module.exports = translators;
 
 // Strategy for loading a standard JavaScript module
 translators.set('esm', async (url) => {
-  const source = `${await readFileAsync(new URL(url))}`;
+  const pathname = internalURLModule.getPathFromURL(new URL(url));
+  const source = appArchive.contains(pathname) ?
+    appArchive.readFileUtf8(pathname) :
+    `${await readFileAsync(new URL(url))}`;
   debug(`Translating StandardModule ${url}`);
   return {
     module: new ModuleWrap(stripShebang(source), url),
@@ -91,7 +95,8 @@ translators.set('json', async (url) => {
   return createDynamicModule(['default'], url, (reflect) => {
     debug(`Loading JSONModule ${url}`);
     const pathname = internalURLModule.getPathFromURL(new URL(url));
-    const content = readFileSync(pathname, 'utf8');
+    const content = appArchive.contains(pathname) ?
+      appArchive.readFileUtf8(pathname) : readFileSync(pathname, 'utf8');
     try {
       const exports = JsonParse(stripBOM(content));
       reflect.exports.default.set(exports);
@@ -0,0 +1,93 @@
+'use strict';
+
+const EventEmitter = require('events');
+const { WebSocketParser } = process.binding('websocket');
+const {
+  kOnMessage,
+  kOnPing,
+  kOnPong,
+  kOnClose,
+  kOnError
+} = WebSocketParser;
+
+const kParser = Symbol('kParser');
+const kSocket = Symbol('kSocket');
+const kOnData = Symbol('kOnData');
+
+// Reads WebSocket frames from a socket once the opening handshake is done.
+//
+// If the socket is backed by a native stream, the parser consumes it directly
+// the way the HTTP server does, so that reads never reach JS land and the
+// socket does not emit 'data'. Other streams are fed to the parser from their
+// 'data' events.
+class WebSocketReceiver extends EventEmitter {
+  constructor(socket, { isServer = true, maxPayload = 0, head } = {}) {
+    super();
+    const parser = new WebSocketParser(isServer, maxPayload);
+    parser[kOnMessage] = (data, isText) => this.emit('message', data, isText);
+    parser[kOnPing] = (data) => this.emit('ping', data);
+    parser[kOnPong] = (data) => this.emit('pong', data);
+    parser[kOnClose] = (code, reason) => {
+      this.destroy();
+      this.emit('close', code, reason);
+    };
+    parser[kOnError] = (code, message) => {
+      this.destroy();
+      this.emit('protocolError', code, message);
+    };
+    this[kParser] = parser;
+    this[kSocket] = socket;
+    this[kOnData] = null;
+
+    // Reading starts on the next tick, so that listeners can be attached
+    // before any frames are parsed.
+    process.nextTick(startReading, this, head);
+  }
+
+  get consumed() {
+    return this[kParser]._consumed === true;
+  }
+
+  // Stops reading frames. The socket is left open.
+  destroy() {
+    const parser = this[kParser];
+    const socket = this[kSocket];
+    if (socket === null)
+      return;
+    this[kSocket] = null;
+    parser.close();
+    if (parser._consumed) {
+      parser._consumed = false;
+      if (socket._handle)
+        socket._handle._consumed = false;
+    }
+    if (this[kOnData] !== null) {
+      socket.removeListener('data', this[kOnData]);
+      this[kOnData] = null;
+    }
+  }
+}
+
+function startReading(receiver, head) {
+  const parser = receiver[kParser];
+  const socket = receiver[kSocket];
+
+  // Data that was read along with the handshake, such as the `head` of an
+  // 'upgrade' event, comes before anything else on the socket.
+  if (socket !== null && head !== undefined && head.length > 0)
+    parser.execute(head);
+  if (receiver[kSocket] === null)
+    return;
+
+  const handle = socket._handle;
+  if (handle && handle._externalStream && !handle._consumed) {
+    handle._consumed = true;
+    parser._consumed = true;
+    parser.consume(handle._externalStream);
+  } else {
+    receiver[kOnData] = (chunk) => parser.execute(chunk);
+    socket.on('data', receiver[kOnData]);
+  }
+}
+
+module.exports = { WebSocketReceiver };
@@ -220,6 +220,9 @@ function initSocketHandle(self) {
 
 const kBytesRead = Symbol('kBytesRead');
 const kBytesWritten = Symbol('kBytesWritten');
+const kMaxConnections = Symbol('kMaxConnections');
+const kRejectingConnections = Symbol('kRejectingConnections');
+const kRejectedConnections = Symbol('kRejectedConnections');
 
 
 function Socket(options) {
@@ -606,6 +609,7 @@ Socket.prototype._destroy = function(exception, cb) {
     COUNTER_NET_SERVER_CONNECTION_CLOSE(this);
     debug('has server');
     this._server._connections--;
+    updateConnectionAdmission(this._server);
     if (this._server._emitCloseIfDrained) {
       this._server._emitCloseIfDrained();
     }
@@ -1210,6 +1214,8 @@ function Server(options, connectionListener) {
   });
 
   this[async_id_symbol] = -1;
+  this[kRejectingConnections] = false;
+  this[kRejectedConnections] = 0;
   this._handle = null;
   this._usingWorkers = false;
   this._workers = [];
@@ -1224,7 +1230,7 @@ util.inherits(Server, EventEmitter);
 function toNumber(x) { return (x = Number(x)) >= 0 ? x : false; }
 
 // Returns handle if it can be created, or error code if it can't
-function createServerHandle(address, port, addressType, fd) {
+function createServerHandle(address, port, addressType, fd, flags) {
   var err = 0;
   // assign handle in listen, and clean up if bind or listen fails
   var handle;
@@ -1259,16 +1265,16 @@ function createServerHandle(address, port, addressType, fd) {
     debug('bind to', address || 'any');
     if (!address) {
       // Try binding to ipv6 first
-      err = handle.bind6('::', port);
+      err = handle.bind6('::', port, flags);
       if (err) {
         handle.close();
         // Fallback to ipv4
-        return createServerHandle('0.0.0.0', port);
+        return createServerHandle('0.0.0.0', port, 4, undefined, flags);
       }
     } else if (addressType === 6) {
-      err = handle.bind6(address, port);
+      err = handle.bind6(address, port, flags);
     } else {
-      err = handle.bind(address, port);
+      err = handle.bind(address, port, flags);
     }
   }
 
@@ -1280,8 +1286,8 @@ function createServerHandle(address, port, addressType, fd) {
   return handle;
 }
 
-function setupListenHandle(address, port, addressType, backlog, fd) {
-  debug('setupListenHandle', address, port, addressType, backlog, fd);
+function setupListenHandle(address, port, addressType, backlog, fd, flags) {
+  debug('setupListenHandle', address, port, addressType, backlog, fd, flags);
 
   // If there is not yet a handle, we need to create one and bind.
   // In the case of a server sent via IPC, we don't need to do this.
@@ -1294,7 +1300,7 @@ function setupListenHandle(address, port, addressType, backlog, fd) {
 
     // Try to bind to the unspecified IPv6 address, see if IPv6 is available
     if (!address && typeof fd !== 'number') {
-      rval = createServerHandle('::', port, 6, fd);
+      rval = createServerHandle('::', port, 6, fd, flags);
 
       if (typeof rval === 'number') {
         rval = null;
@@ -1307,7 +1313,7 @@ function setupListenHandle(address, port, addressType, backlog, fd) {
     }
 
     if (rval === null)
-      rval = createServerHandle(address, port, addressType, fd);
+      rval = createServerHandle(address, port, addressType, fd, flags);
 
     if (typeof rval === 'number') {
       var error = exceptionWithHostPort(rval, 'listen', address, port);
@@ -1366,16 +1372,19 @@ function emitListeningNT(self) {
 
 
 function listenInCluster(server, address, port, addressType,
-                         backlog, fd, exclusive) {
+                         backlog, fd, exclusive, flags) {
   exclusive = !!exclusive;
+  flags = flags | 0;
 
   if (cluster === undefined) cluster = require('cluster');
 
-  if (cluster.isMaster || exclusive) {
+  // Sockets bound with SO_REUSEPORT are balanced by the kernel, so every
+  // worker can simply bind its own.
+  if (cluster.isMaster || exclusive || (flags & TCPConstants.REUSEPORT)) {
     // Will create a new handle
     // _listen2 sets up the listened handle, it is still named like this
     // to avoid breaking code that wraps this method
-    server._listen2(address, port, addressType, backlog, fd);
+    server._listen2(address, port, addressType, backlog, fd, flags);
     return;
   }
 
@@ -1456,14 +1465,15 @@ Server.prototype.listen = function(...args) {
       throw new ERR_SOCKET_BAD_PORT(options.port);
     }
     backlog = options.backlog || backlogFromArgs;
+    const flags = options.reusePort ? TCPConstants.REUSEPORT : 0;
     // start TCP server listening on host:port
     if (options.host) {
       lookupAndListen(this, options.port | 0, options.host, backlog,
-                      options.exclusive);
+                      options.exclusive, flags);
     } else { // Undefined host, listens on unspecified address
       // Default addressType 4 will be used to search for master server
       listenInCluster(this, null, options.port | 0, 4,
-                      backlog, undefined, options.exclusive);
+                      backlog, undefined, options.exclusive, flags);
     }
     return this;
   }
@@ -1494,7 +1504,7 @@ Server.prototype.listen = function(...args) {
   throw new ERR_INVALID_OPT_VALUE('options', util.inspect(options));
 };
 
-function lookupAndListen(self, port, address, backlog, exclusive) {
+function lookupAndListen(self, port, address, backlog, exclusive, flags) {
   if (dns === undefined) dns = require('dns');
   dns.lookup(address, function doListen(err, ip, addressType) {
     if (err) {
@@ -1502,7 +1512,7 @@ function lookupAndListen(self, port, address, backlog, exclusive) {
     } else {
       addressType = ip ? addressType : 4;
       listenInCluster(self, ip, port, addressType,
-                      backlog, undefined, exclusive);
+                      backlog, undefined, exclusive, flags);
     }
   });
 }
@@ -1542,6 +1552,7 @@ function onconnection(err, clientHandle) {
   }
 
   if (self.maxConnections && self._connections >= self.maxConnections) {
+    self[kRejectedConnections]++;
     clientHandle.close();
     return;
   }
@@ -1555,6 +1566,7 @@ function onconnection(err, clientHandle) {
   });
 
   self._connections++;
+  updateConnectionAdmission(self);
   socket.server = self;
   socket._server = self;
 
@@ -1564,6 +1576,48 @@ function onconnection(err, clientHandle) {
 }
 
 
+// While a server is at its maxConnections limit, let the listening handle
+// turn further connections away natively, so that no objects are created
+// for them in the first place.
+function updateConnectionAdmission(server) {
+  const handle = server._handle;
+  // Handles shared with the cluster master do not accept connections.
+  if (handle === null || typeof handle.setRejectConnections !== 'function')
+    return;
+  const reject = server.maxConnections > 0 &&
+                 server._connections >= server.maxConnections;
+  if (reject !== server[kRejectingConnections]) {
+    server[kRejectingConnections] = reject;
+    handle.setRejectConnections(reject);
+  }
+}
+
+Object.defineProperty(Server.prototype, 'maxConnections', {
+  configurable: true,
+  enumerable: true,
+  get() {
+    return this[kMaxConnections];
+  },
+  set(value) {
+    this[kMaxConnections] = value;
+    updateConnectionAdmission(this);
+  }
+});
+
+Object.defineProperty(Server.prototype, 'rejectedConnections', {
+  configurable: true,
+  enumerable: true,
+  get() {
+    const handle = this._handle;
+    if (handle === null ||
+        typeof handle.getRejectedConnections !== 'function') {
+      return this[kRejectedConnections];
+    }
+    return this[kRejectedConnections] + handle.getRejectedConnections();
+  }
+});
+
+
 Server.prototype.getConnections = function(cb) {
   const self = this;
 
@@ -1614,6 +1668,8 @@ Server.prototype.close = function(cb) {
   }
 
   if (this._handle) {
+    // Keep the count of the connections that the handle turned away.
+    this[kRejectedConnections] = this.rejectedConnections;
     this._handle.close();
     this._handle = null;
   }
@@ -82,6 +82,11 @@ const IDX_SESSION_STATS_STREAMAVERAGEDURATION = 5;
 const IDX_SESSION_STATS_DATA_SENT = 6;
 const IDX_SESSION_STATS_DATA_RECEIVED = 7;
 const IDX_SESSION_STATS_MAX_CONCURRENT_STREAMS = 8;
+const IDX_SESSION_STATS_HEADER_BYTES_SENT = 9;
+const IDX_SESSION_STATS_HEADER_BLOCK_BYTES_SENT = 10;
+const IDX_SESSION_STATS_HEADER_BYTES_RECEIVED = 11;
+const IDX_SESSION_STATS_DEFLATE_DYNAMIC_TABLE_SIZE = 12;
+const IDX_SESSION_STATS_INFLATE_DYNAMIC_TABLE_SIZE = 13;
 
 let sessionStats;
 let streamStats;
@@ -125,6 +130,16 @@ function collectHttp2Stats(entry) {
         sessionStats[IDX_SESSION_STATS_DATA_RECEIVED];
       entry.maxConcurrentStreams =
         sessionStats[IDX_SESSION_STATS_MAX_CONCURRENT_STREAMS];
+      entry.headerBytesSent =
+        sessionStats[IDX_SESSION_STATS_HEADER_BYTES_SENT];
+      entry.headerBlockBytesSent =
+        sessionStats[IDX_SESSION_STATS_HEADER_BLOCK_BYTES_SENT];
+      entry.headerBytesReceived =
+        sessionStats[IDX_SESSION_STATS_HEADER_BYTES_RECEIVED];
+      entry.deflateDynamicTableSize =
+        sessionStats[IDX_SESSION_STATS_DEFLATE_DYNAMIC_TABLE_SIZE];
+      entry.inflateDynamicTableSize =
+        sessionStats[IDX_SESSION_STATS_INFLATE_DYNAMIC_TABLE_SIZE];
       break;
   }
 }
@@ -143,7 +143,7 @@ const arrayBufferViewTypeToIndex = new Map();
   }
 }
 
-const bufferConstructorIndex = arrayBufferViewTypes.push(Buffer) - 1;
+const bufferConstructorIndex = arrayBufferViewTypes.push(FastBuffer) - 1;
 
 class DefaultSerializer extends Serializer {
   constructor() {
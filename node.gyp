@@ -84,8 +84,10 @@
       'lib/internal/buffer.js',
       'lib/internal/cli_table.js',
       'lib/internal/child_process.js',
+      'lib/internal/child_process/serialization.js',
       'lib/internal/cluster/child.js',
       'lib/internal/cluster/master.js',
+      'lib/internal/cluster/reuse_port_handle.js',
       'lib/internal/cluster/round_robin_handle.js',
       'lib/internal/cluster/shared_handle.js',
       'lib/internal/cluster/utils.js',
@@ -103,15 +105,19 @@
       'lib/internal/errors.js',
       'lib/internal/fixed_queue.js',
       'lib/internal/freelist.js',
+      'lib/internal/fs/dir.js',
+      'lib/internal/fs/group_commit.js',
       'lib/internal/fs/promises.js',
-      'lib/internal/fs/read_file_context.js',
       'lib/internal/fs/streams.js',
       'lib/internal/fs/sync_write_stream.js',
       'lib/internal/fs/utils.js',
+      'lib/internal/fs/walk.js',
       'lib/internal/fs/watchers.js',
       'lib/internal/http.js',
       'lib/internal/inspector_async_hook.js',
       'lib/internal/linkedlist.js',
+      'lib/internal/modules/app_archive.js',
+      'lib/internal/modules/cjs/compile_cache.js',
       'lib/internal/modules/cjs/helpers.js',
       'lib/internal/modules/cjs/loader.js',
       'lib/internal/modules/esm/loader.js',
@@ -156,6 +162,7 @@
       'lib/internal/validators.js',
       'lib/internal/stream_base_commons.js',
       'lib/internal/vm/module.js',
+      'lib/internal/websocket.js',
       'lib/internal/streams/lazy_transform.js',
       'lib/internal/streams/async_iterator.js',
       'lib/internal/streams/buffer_list.js',
@@ -323,6 +330,7 @@
         'src/node_api.cc',
         'src/node_api.h',
         'src/node_api_types.h',
+        'src/node_app_archive.cc',
         'src/node_buffer.cc',
         'src/node_config.cc',
         'src/node_constants.cc',
@@ -331,6 +339,8 @@
         'src/node_domain.cc',
         'src/node_errors.h',
         'src/node_file.cc',
+        'src/node_fs_uring.cc',
+        'src/node_fs_walk.cc',
         'src/node_http2.cc',
         'src/node_http_parser.cc',
         'src/node_os.cc',
@@ -343,8 +353,10 @@
         'src/node_url.cc',
         'src/node_util.cc',
         'src/node_v8.cc',
+        'src/node_spawn_zygote.cc',
         'src/node_stat_watcher.cc',
         'src/node_watchdog.cc',
+        'src/node_websocket.cc',
         'src/node_zlib.cc',
         'src/node_i18n.cc',
         'src/pipe_wrap.cc',
@@ -380,11 +392,14 @@
         'src/js_stream.h',
         'src/module_wrap.h',
         'src/node.h',
+        'src/node_app_archive.h',
         'src/node_buffer.h',
         'src/node_constants.h',
         'src/node_contextify.h',
         'src/node_debug_options.h',
         'src/node_file.h',
+        'src/node_fs_uring.h',
+        'src/node_fs_walk.h',
         'src/node_http2.h',
         'src/node_http2_state.h',
         'src/node_internals.h',
@@ -395,6 +410,7 @@
         'src/node_persistent.h',
         'src/node_platform.h',
         'src/node_root_certs.h',
+        'src/node_spawn_zygote.h',
         'src/node_version.h',
         'src/node_watchdog.h',
         'src/node_wrap.h',
@@ -0,0 +1,6115 @@
+// Copyright 2011 Google Inc. All Rights Reserved.
+
+// This file was generated from .js source files by GYP.  If you
+// want to make changes to this file you should either change the
+// javascript source files or the GYP script.
+
+#include "src/v8.h"
+#include "src/snapshot/natives.h"
+#include "src/utils.h"
+
+namespace v8 {
+namespace internal {
+
+  static const char sources[] = { 10, 40, 102, 117, 110, 99, 116, 105, 111, 110, 40, 97, 44, 98, 41, 123, 10, 34,
+117, 115, 101, 32, 115, 116, 114, 105, 99, 116, 34, 59, 10, 118, 97, 114, 32,
+99, 61, 97, 46, 65, 114, 114, 97, 121, 59, 10, 118, 97, 114, 32, 100, 61, 97,
+46, 105, 115, 78, 97, 78, 59, 10, 118, 97, 114, 32, 101, 61, 97, 46, 74, 83, 79,
+78, 46, 115, 116, 114, 105, 110, 103, 105, 102, 121, 59, 10, 118, 97, 114, 32,
+102, 61, 97, 46, 77, 97, 112, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101,
+46, 101, 110, 116, 114, 105, 101, 115, 59, 10, 118, 97, 114, 32, 103, 61, 40,
+110, 101, 119, 32, 97, 46, 77, 97, 112, 41, 46, 101, 110, 116, 114, 105, 101,
+115, 40, 41, 46, 110, 101, 120, 116, 59, 10, 118, 97, 114, 32, 104, 61, 40, 110,
+101, 119, 32, 97, 46, 83, 101, 116, 41, 46, 118, 97, 108, 117, 101, 115, 40, 41,
+46, 110, 101, 120, 116, 59, 10, 118, 97, 114, 32, 105, 61, 97, 46, 83, 101, 116,
+46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 118, 97, 108, 117, 101,
+115, 59, 10, 118, 97, 114, 32, 106, 61, 123, 10, 85, 78, 68, 69, 70, 73, 78, 69,
+68, 95, 84, 89, 80, 69, 58, 39, 117, 110, 100, 101, 102, 105, 110, 101, 100, 39,
+44, 10, 78, 85, 76, 76, 95, 84, 89, 80, 69, 58, 39, 110, 117, 108, 108, 39, 44,
+10, 66, 79, 79, 76, 69, 65, 78, 95, 84, 89, 80, 69, 58, 39, 98, 111, 111, 108,
+101, 97, 110, 39, 44, 10, 78, 85, 77, 66, 69, 82, 95, 84, 89, 80, 69, 58, 39,
+110, 117, 109, 98, 101, 114, 39, 44, 10, 83, 84, 82, 73, 78, 71, 95, 84, 89, 80,
+69, 58, 39, 115, 116, 114, 105, 110, 103, 39, 44, 10, 83, 89, 77, 66, 79, 76,
+95, 84, 89, 80, 69, 58, 39, 115, 121, 109, 98, 111, 108, 39, 44, 10, 79, 66, 74,
+69, 67, 84, 95, 84, 89, 80, 69, 58, 39, 111, 98, 106, 101, 99, 116, 39, 44, 10,
+70, 85, 78, 67, 84, 73, 79, 78, 95, 84, 89, 80, 69, 58, 39, 102, 117, 110, 99,
+116, 105, 111, 110, 39, 44, 10, 82, 69, 71, 69, 88, 80, 95, 84, 89, 80, 69, 58,
+39, 114, 101, 103, 101, 120, 112, 39, 44, 10, 69, 82, 82, 79, 82, 95, 84, 89,
+80, 69, 58, 39, 101, 114, 114, 111, 114, 39, 44, 10, 80, 82, 79, 80, 69, 82, 84,
+89, 95, 84, 89, 80, 69, 58, 39, 112, 114, 111, 112, 101, 114, 116, 121, 39, 44,
+10, 73, 78, 84, 69, 82, 78, 65, 76, 95, 80, 82, 79, 80, 69, 82, 84, 89, 95, 84,
+89, 80, 69, 58, 39, 105, 110, 116, 101, 114, 110, 97, 108, 80, 114, 111, 112,
+101, 114, 116, 121, 39, 44, 10, 70, 82, 65, 77, 69, 95, 84, 89, 80, 69, 58, 39,
+102, 114, 97, 109, 101, 39, 44, 10, 83, 67, 82, 73, 80, 84, 95, 84, 89, 80, 69,
+58, 39, 115, 99, 114, 105, 112, 116, 39, 44, 10, 67, 79, 78, 84, 69, 88, 84, 95,
+84, 89, 80, 69, 58, 39, 99, 111, 110, 116, 101, 120, 116, 39, 44, 10, 83, 67,
+79, 80, 69, 95, 84, 89, 80, 69, 58, 39, 115, 99, 111, 112, 101, 39, 44, 10, 80,
+82, 79, 77, 73, 83, 69, 95, 84, 89, 80, 69, 58, 39, 112, 114, 111, 109, 105,
+115, 101, 39, 44, 10, 77, 65, 80, 95, 84, 89, 80, 69, 58, 39, 109, 97, 112, 39,
+44, 10, 83, 69, 84, 95, 84, 89, 80, 69, 58, 39, 115, 101, 116, 39, 44, 10, 73,
+84, 69, 82, 65, 84, 79, 82, 95, 84, 89, 80, 69, 58, 39, 105, 116, 101, 114, 97,
+116, 111, 114, 39, 44, 10, 71, 69, 78, 69, 82, 65, 84, 79, 82, 95, 84, 89, 80,
+69, 58, 39, 103, 101, 110, 101, 114, 97, 116, 111, 114, 39, 44, 10, 125, 10,
+102, 117, 110, 99, 116, 105, 111, 110, 32, 77, 97, 107, 101, 77, 105, 114, 114,
+111, 114, 40, 107, 41, 123, 10, 118, 97, 114, 32, 108, 59, 10, 105, 102, 40, 40,
+107, 61, 61, 61, 40, 118, 111, 105, 100, 32, 48, 41, 41, 41, 123, 10, 108, 61,
+110, 101, 119, 32, 85, 110, 100, 101, 102, 105, 110, 101, 100, 77, 105, 114,
+114, 111, 114, 40, 41, 59, 10, 125, 101, 108, 115, 101, 32, 105, 102, 40, 40,
+107, 61, 61, 61, 110, 117, 108, 108, 41, 41, 123, 10, 108, 61, 110, 101, 119,
+32, 78, 117, 108, 108, 77, 105, 114, 114, 111, 114, 40, 41, 59, 10, 125, 101,
+108, 115, 101, 32, 105, 102, 40, 40, 116, 121, 112, 101, 111, 102, 40, 107, 41,
+61, 61, 61, 39, 98, 111, 111, 108, 101, 97, 110, 39, 41, 10, 41, 123, 10, 108,
+61, 110, 101, 119, 32, 66, 111, 111, 108, 101, 97, 110, 77, 105, 114, 114, 111,
+114, 40, 107, 41, 59, 10, 125, 101, 108, 115, 101, 32, 105, 102, 40, 40, 116,
+121, 112, 101, 111, 102, 40, 107, 41, 61, 61, 61, 39, 110, 117, 109, 98, 101,
+114, 39, 41, 41, 123, 10, 108, 61, 110, 101, 119, 32, 78, 117, 109, 98, 101,
+114, 77, 105, 114, 114, 111, 114, 40, 107, 41, 59, 10, 125, 101, 108, 115, 101,
+32, 105, 102, 40, 40, 116, 121, 112, 101, 111, 102, 40, 107, 41, 61, 61, 61, 39,
+115, 116, 114, 105, 110, 103, 39, 41, 41, 123, 10, 108, 61, 110, 101, 119, 32,
+83, 116, 114, 105, 110, 103, 77, 105, 114, 114, 111, 114, 40, 107, 41, 59, 10,
+125, 101, 108, 115, 101, 32, 105, 102, 40, 40, 116, 121, 112, 101, 111, 102, 40,
+107, 41, 61, 61, 61, 39, 115, 121, 109, 98, 111, 108, 39, 41, 41, 123, 10, 108,
+61, 110, 101, 119, 32, 83, 121, 109, 98, 111, 108, 77, 105, 114, 114, 111, 114,
+40, 107, 41, 59, 10, 125, 101, 108, 115, 101, 32, 105, 102, 40, 40, 37, 95, 73,
+115, 65, 114, 114, 97, 121, 40, 107, 41, 41, 41, 123, 10, 108, 61, 110, 101,
+119, 32, 65, 114, 114, 97, 121, 77, 105, 114, 114, 111, 114, 40, 107, 41, 59,
+10, 125, 101, 108, 115, 101, 32, 105, 102, 40, 40, 37, 73, 115, 68, 97, 116,
+101, 40, 107, 41, 41, 10, 41, 123, 10, 108, 61, 110, 101, 119, 32, 68, 97, 116,
+101, 77, 105, 114, 114, 111, 114, 40, 107, 41, 59, 10, 125, 101, 108, 115, 101,
+32, 105, 102, 40, 40, 37, 73, 115, 70, 117, 110, 99, 116, 105, 111, 110, 40,
+107, 41, 41, 41, 123, 10, 108, 61, 110, 101, 119, 32, 70, 117, 110, 99, 116,
+105, 111, 110, 77, 105, 114, 114, 111, 114, 40, 107, 41, 59, 10, 125, 101, 108,
+115, 101, 32, 105, 102, 40, 37, 73, 115, 82, 101, 103, 69, 120, 112, 40, 107,
+41, 41, 123, 10, 108, 61, 110, 101, 119, 32, 82, 101, 103, 69, 120, 112, 77,
+105, 114, 114, 111, 114, 40, 107, 41, 59, 10, 125, 101, 108, 115, 101, 32, 105,
+102, 40, 40, 37, 73, 115, 74, 83, 69, 114, 114, 111, 114, 40, 107, 41, 41, 10,
+41, 123, 10, 108, 61, 110, 101, 119, 32, 69, 114, 114, 111, 114, 77, 105, 114,
+114, 111, 114, 40, 107, 41, 59, 10, 125, 101, 108, 115, 101, 32, 105, 102, 40,
+40, 37, 73, 115, 83, 99, 114, 105, 112, 116, 87, 114, 97, 112, 112, 101, 114,
+40, 107, 41, 41, 10, 41, 123, 10, 108, 61, 110, 101, 119, 32, 83, 99, 114, 105,
+112, 116, 77, 105, 114, 114, 111, 114, 40, 107, 41, 59, 10, 125, 101, 108, 115,
+101, 32, 105, 102, 40, 40, 37, 95, 73, 115, 74, 83, 77, 97, 112, 40, 107, 41,
+41, 10, 124, 124, 40, 37, 95, 73, 115, 74, 83, 87, 101, 97, 107, 77, 97, 112,
+40, 107, 41, 41, 41, 123, 10, 108, 61, 110, 101, 119, 32, 77, 97, 112, 77, 105,
+114, 114, 111, 114, 40, 107, 41, 59, 10, 125, 101, 108, 115, 101, 32, 105, 102,
+40, 40, 37, 95, 73, 115, 74, 83, 83, 101, 116, 40, 107, 41, 41, 10, 124, 124,
+40, 37, 95, 73, 115, 74, 83, 87, 101, 97, 107, 83, 101, 116, 40, 107, 41, 41,
+41, 123, 10, 108, 61, 110, 101, 119, 32, 83, 101, 116, 77, 105, 114, 114, 111,
+114, 40, 107, 41, 59, 10, 125, 101, 108, 115, 101, 32, 105, 102, 40, 40, 37, 73,
+115, 74, 83, 77, 97, 112, 73, 116, 101, 114, 97, 116, 111, 114, 40, 107, 41, 41,
+10, 124, 124, 40, 37, 73, 115, 74, 83, 83, 101, 116, 73, 116, 101, 114, 97, 116,
+111, 114, 40, 107, 41, 41, 10, 41, 123, 10, 108, 61, 110, 101, 119, 32, 73, 116,
+101, 114, 97, 116, 111, 114, 77, 105, 114, 114, 111, 114, 40, 107, 41, 59, 10,
+125, 101, 108, 115, 101, 32, 105, 102, 40, 37, 105, 115, 95, 112, 114, 111, 109,
+105, 115, 101, 40, 107, 41, 41, 123, 10, 108, 61, 110, 101, 119, 32, 80, 114,
+111, 109, 105, 115, 101, 77, 105, 114, 114, 111, 114, 40, 107, 41, 59, 10, 125,
+101, 108, 115, 101, 32, 105, 102, 40, 40, 37, 73, 115, 74, 83, 71, 101, 110,
+101, 114, 97, 116, 111, 114, 79, 98, 106, 101, 99, 116, 40, 107, 41, 41, 10, 41,
+123, 10, 108, 61, 110, 101, 119, 32, 71, 101, 110, 101, 114, 97, 116, 111, 114,
+77, 105, 114, 114, 111, 114, 40, 107, 41, 59, 10, 125, 101, 108, 115, 101, 123,
+10, 108, 61, 110, 101, 119, 32, 79, 98, 106, 101, 99, 116, 77, 105, 114, 114,
+111, 114, 40, 107, 44, 106, 46, 79, 66, 74, 69, 67, 84, 95, 84, 89, 80, 69, 41,
+59, 10, 125, 10, 114, 101, 116, 117, 114, 110, 32, 108, 59, 10, 125, 10, 102,
+117, 110, 99, 116, 105, 111, 110, 32, 71, 101, 116, 85, 110, 100, 101, 102, 105,
+110, 101, 100, 77, 105, 114, 114, 111, 114, 40, 41, 123, 10, 114, 101, 116, 117,
+114, 110, 32, 77, 97, 107, 101, 77, 105, 114, 114, 111, 114, 40, 40, 118, 111,
+105, 100, 32, 48, 41, 41, 59, 10, 125, 10, 102, 117, 110, 99, 116, 105, 111,
+110, 32, 105, 110, 104, 101, 114, 105, 116, 115, 40, 109, 44, 110, 41, 123, 10,
+118, 97, 114, 32, 111, 61, 102, 117, 110, 99, 116, 105, 111, 110, 40, 41, 123,
+125, 59, 10, 111, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 61, 110, 46,
+112, 114, 111, 116, 111, 116, 121, 112, 101, 59, 10, 109, 46, 115, 117, 112,
+101, 114, 95, 61, 110, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 59, 10,
+109, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 61, 110, 101, 119, 32,
+111, 40, 41, 59, 10, 109, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46,
+99, 111, 110, 115, 116, 114, 117, 99, 116, 111, 114, 61, 109, 59, 10, 125, 10,
+118, 97, 114, 32, 112, 61, 56, 48, 59, 10, 118, 97, 114, 32, 113, 61, 123, 125,
+59, 10, 113, 46, 68, 97, 116, 97, 61, 48, 59, 10, 113, 46, 65, 99, 99, 101, 115,
+115, 111, 114, 61, 49, 59, 10, 118, 97, 114, 32, 114, 61, 123, 125, 59, 10, 114,
+46, 78, 111, 110, 101, 61, 48, 59, 10, 114, 46, 82, 101, 97, 100, 79, 110, 108,
+121, 61, 49, 59, 10, 114, 46, 68, 111, 110, 116, 69, 110, 117, 109, 61, 50, 59,
+10, 114, 46, 68, 111, 110, 116, 68, 101, 108, 101, 116, 101, 61, 52, 59, 10,
+118, 97, 114, 32, 115, 61, 123, 71, 108, 111, 98, 97, 108, 58, 48, 44, 10, 76,
+111, 99, 97, 108, 58, 49, 44, 10, 87, 105, 116, 104, 58, 50, 44, 10, 67, 108,
+111, 115, 117, 114, 101, 58, 51, 44, 10, 67, 97, 116, 99, 104, 58, 52, 44, 10,
+66, 108, 111, 99, 107, 58, 53, 44, 10, 83, 99, 114, 105, 112, 116, 58, 54, 44,
+10, 69, 118, 97, 108, 58, 55, 44, 10, 77, 111, 100, 117, 108, 101, 58, 56, 44,
+10, 125, 59, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 77, 105, 114, 114,
+111, 114, 40, 116, 41, 123, 10, 116, 104, 105, 115, 46, 116, 121, 112, 101, 95,
+61, 116, 59, 10, 125, 10, 77, 105, 114, 114, 111, 114, 46, 112, 114, 111, 116,
+111, 116, 121, 112, 101, 46, 116, 121, 112, 101, 61, 102, 117, 110, 99, 116,
+105, 111, 110, 40, 41, 123, 10, 114, 101, 116, 117, 114, 110, 32, 116, 104, 105,
+115, 46, 116, 121, 112, 101, 95, 59, 10, 125, 59, 10, 77, 105, 114, 114, 111,
+114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 105, 115, 86, 97, 108,
+117, 101, 61, 102, 117, 110, 99, 116, 105, 111, 110, 40, 41, 123, 10, 114, 101,
+116, 117, 114, 110, 32, 116, 104, 105, 115, 32, 105, 110, 115, 116, 97, 110, 99,
+101, 111, 102, 32, 86, 97, 108, 117, 101, 77, 105, 114, 114, 111, 114, 59, 10,
+125, 59, 10, 77, 105, 114, 114, 111, 114, 46, 112, 114, 111, 116, 111, 116, 121,
+112, 101, 46, 105, 115, 85, 110, 100, 101, 102, 105, 110, 101, 100, 61, 102,
+117, 110, 99, 116, 105, 111, 110, 40, 41, 123, 10, 114, 101, 116, 117, 114, 110,
+32, 116, 104, 105, 115, 32, 105, 110, 115, 116, 97, 110, 99, 101, 111, 102, 32,
+85, 110, 100, 101, 102, 105, 110, 101, 100, 77, 105, 114, 114, 111, 114, 59, 10,
+125, 59, 10, 77, 105, 114, 114, 111, 114, 46, 112, 114, 111, 116, 111, 116, 121,
+112, 101, 46, 105, 115, 78, 117, 108, 108, 61, 102, 117, 110, 99, 116, 105, 111,
+110, 40, 41, 123, 10, 114, 101, 116, 117, 114, 110, 32, 116, 104, 105, 115, 32,
+105, 110, 115, 116, 97, 110, 99, 101, 111, 102, 32, 78, 117, 108, 108, 77, 105,
+114, 114, 111, 114, 59, 10, 125, 59, 10, 77, 105, 114, 114, 111, 114, 46, 112,
+114, 111, 116, 111, 116, 121, 112, 101, 46, 105, 115, 66, 111, 111, 108, 101,
+97, 110, 61, 102, 117, 110, 99, 116, 105, 111, 110, 40, 41, 123, 10, 114, 101,
+116, 117, 114, 110, 32, 116, 104, 105, 115, 32, 105, 110, 115, 116, 97, 110, 99,
+101, 111, 102, 32, 66, 111, 111, 108, 101, 97, 110, 77, 105, 114, 114, 111, 114,
+59, 10, 125, 59, 10, 77, 105, 114, 114, 111, 114, 46, 112, 114, 111, 116, 111,
+116, 121, 112, 101, 46, 105, 115, 78, 117, 109, 98, 101, 114, 61, 102, 117, 110,
+99, 116, 105, 111, 110, 40, 41, 123, 10, 114, 101, 116, 117, 114, 110, 32, 116,
+104, 105, 115, 32, 105, 110, 115, 116, 97, 110, 99, 101, 111, 102, 32, 78, 117,
+109, 98, 101, 114, 77, 105, 114, 114, 111, 114, 59, 10, 125, 59, 10, 77, 105,
+114, 114, 111, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 105,
+115, 83, 116, 114, 105, 110, 103, 61, 102, 117, 110, 99, 116, 105, 111, 110, 40,
+41, 123, 10, 114, 101, 116, 117, 114, 110, 32, 116, 104, 105, 115, 32, 105, 110,
+115, 116, 97, 110, 99, 101, 111, 102, 32, 83, 116, 114, 105, 110, 103, 77, 105,
+114, 114, 111, 114, 59, 10, 125, 59, 10, 77, 105, 114, 114, 111, 114, 46, 112,
+114, 111, 116, 111, 116, 121, 112, 101, 46, 105, 115, 83, 121, 109, 98, 111,
+108, 61, 102, 117, 110, 99, 116, 105, 111, 110, 40, 41, 123, 10, 114, 101, 116,
+117, 114, 110, 32, 116, 104, 105, 115, 32, 105, 110, 115, 116, 97, 110, 99, 101,
+111, 102, 32, 83, 121, 109, 98, 111, 108, 77, 105, 114, 114, 111, 114, 59, 10,
+125, 59, 10, 77, 105, 114, 114, 111, 114, 46, 112, 114, 111, 116, 111, 116, 121,
+112, 101, 46, 105, 115, 79, 98, 106, 101, 99, 116, 61, 102, 117, 110, 99, 116,
+105, 111, 110, 40, 41, 123, 10, 114, 101, 116, 117, 114, 110, 32, 116, 104, 105,
+115, 32, 105, 110, 115, 116, 97, 110, 99, 101, 111, 102, 32, 79, 98, 106, 101,
+99, 116, 77, 105, 114, 114, 111, 114, 59, 10, 125, 59, 10, 77, 105, 114, 114,
+111, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 105, 115, 70,
+117, 110, 99, 116, 105, 111, 110, 61, 102, 117, 110, 99, 116, 105, 111, 110, 40,
+41, 123, 10, 114, 101, 116, 117, 114, 110, 32, 116, 104, 105, 115, 32, 105, 110,
+115, 116, 97, 110, 99, 101, 111, 102, 32, 70, 117, 110, 99, 116, 105, 111, 110,
+77, 105, 114, 114, 111, 114, 59, 10, 125, 59, 10, 77, 105, 114, 114, 111, 114,
+46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 105, 115, 85, 110, 114,
+101, 115, 111, 108, 118, 101, 100, 70, 117, 110, 99, 116, 105, 111, 110, 61,
+102, 117, 110, 99, 116, 105, 111, 110, 40, 41, 123, 10, 114, 101, 116, 117, 114,
+110, 32, 116, 104, 105, 115, 32, 105, 110, 115, 116, 97, 110, 99, 101, 111, 102,
+32, 85, 110, 114, 101, 115, 111, 108, 118, 101, 100, 70, 117, 110, 99, 116, 105,
+111, 110, 77, 105, 114, 114, 111, 114, 59, 10, 125, 59, 10, 77, 105, 114, 114,
+111, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 105, 115, 65,
+114, 114, 97, 121, 61, 102, 117, 110, 99, 116, 105, 111, 110, 40, 41, 123, 10,
+114, 101, 116, 117, 114, 110, 32, 116, 104, 105, 115, 32, 105, 110, 115, 116,
+97, 110, 99, 101, 111, 102, 32, 65, 114, 114, 97, 121, 77, 105, 114, 114, 111,
+114, 59, 10, 125, 59, 10, 77, 105, 114, 114, 111, 114, 46, 112, 114, 111, 116,
+111, 116, 121, 112, 101, 46, 105, 115, 68, 97, 116, 101, 61, 102, 117, 110, 99,
+116, 105, 111, 110, 40, 41, 123, 10, 114, 101, 116, 117, 114, 110, 32, 116, 104,
+105, 115, 32, 105, 110, 115, 116, 97, 110, 99, 101, 111, 102, 32, 68, 97, 116,
+101, 77, 105, 114, 114, 111, 114, 59, 10, 125, 59, 10, 77, 105, 114, 114, 111,
+114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 105, 115, 82, 101,
+103, 69, 120, 112, 61, 102, 117, 110, 99, 116, 105, 111, 110, 40, 41, 123, 10,
+114, 101, 116, 117, 114, 110, 32, 116, 104, 105, 115, 32, 105, 110, 115, 116,
+97, 110, 99, 101, 111, 102, 32, 82, 101, 103, 69, 120, 112, 77, 105, 114, 114,
+111, 114, 59, 10, 125, 59, 10, 77, 105, 114, 114, 111, 114, 46, 112, 114, 111,
+116, 111, 116, 121, 112, 101, 46, 105, 115, 69, 114, 114, 111, 114, 61, 102,
+117, 110, 99, 116, 105, 111, 110, 40, 41, 123, 10, 114, 101, 116, 117, 114, 110,
+32, 116, 104, 105, 115, 32, 105, 110, 115, 116, 97, 110, 99, 101, 111, 102, 32,
+69, 114, 114, 111, 114, 77, 105, 114, 114, 111, 114, 59, 10, 125, 59, 10, 77,
+105, 114, 114, 111, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46,
+105, 115, 80, 114, 111, 109, 105, 115, 101, 61, 102, 117, 110, 99, 116, 105,
+111, 110, 40, 41, 123, 10, 114, 101, 116, 117, 114, 110, 32, 116, 104, 105, 115,
+32, 105, 110, 115, 116, 97, 110, 99, 101, 111, 102, 32, 80, 114, 111, 109, 105,
+115, 101, 77, 105, 114, 114, 111, 114, 59, 10, 125, 59, 10, 77, 105, 114, 114,
+111, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 105, 115, 71,
+101, 110, 101, 114, 97, 116, 111, 114, 61, 102, 117, 110, 99, 116, 105, 111,
+110, 40, 41, 123, 10, 114, 101, 116, 117, 114, 110, 32, 116, 104, 105, 115, 32,
+105, 110, 115, 116, 97, 110, 99, 101, 111, 102, 32, 71, 101, 110, 101, 114, 97,
+116, 111, 114, 77, 105, 114, 114, 111, 114, 59, 10, 125, 59, 10, 77, 105, 114,
+114, 111, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 105, 115,
+80, 114, 111, 112, 101, 114, 116, 121, 61, 102, 117, 110, 99, 116, 105, 111,
+110, 40, 41, 123, 10, 114, 101, 116, 117, 114, 110, 32, 116, 104, 105, 115, 32,
+105, 110, 115, 116, 97, 110, 99, 101, 111, 102, 32, 80, 114, 111, 112, 101, 114,
+116, 121, 77, 105, 114, 114, 111, 114, 59, 10, 125, 59, 10, 77, 105, 114, 114,
+111, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 105, 115, 73,
+110, 116, 101, 114, 110, 97, 108, 80, 114, 111, 112, 101, 114, 116, 121, 61,
+102, 117, 110, 99, 116, 105, 111, 110, 40, 41, 123, 10, 114, 101, 116, 117, 114,
+110, 32, 116, 104, 105, 115, 32, 105, 110, 115, 116, 97, 110, 99, 101, 111, 102,
+32, 73, 110, 116, 101, 114, 110, 97, 108, 80, 114, 111, 112, 101, 114, 116, 121,
+77, 105, 114, 114, 111, 114, 59, 10, 125, 59, 10, 77, 105, 114, 114, 111, 114,
+46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 105, 115, 70, 114, 97, 109,
+101, 61, 102, 117, 110, 99, 116, 105, 111, 110, 40, 41, 123, 10, 114, 101, 116,
+117, 114, 110, 32, 116, 104, 105, 115, 32, 105, 110, 115, 116, 97, 110, 99, 101,
+111, 102, 32, 70, 114, 97, 109, 101, 77, 105, 114, 114, 111, 114, 59, 10, 125,
+59, 10, 77, 105, 114, 114, 111, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112,
+101, 46, 105, 115, 83, 99, 114, 105, 112, 116, 61, 102, 117, 110, 99, 116, 105,
+111, 110, 40, 41, 123, 10, 114, 101, 116, 117, 114, 110, 32, 116, 104, 105, 115,
+32, 105, 110, 115, 116, 97, 110, 99, 101, 111, 102, 32, 83, 99, 114, 105, 112,
+116, 77, 105, 114, 114, 111, 114, 59, 10, 125, 59, 10, 77, 105, 114, 114, 111,
+114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 105, 115, 67, 111,
+110, 116, 101, 120, 116, 61, 102, 117, 110, 99, 116, 105, 111, 110, 40, 41, 123,
+10, 114, 101, 116, 117, 114, 110, 32, 116, 104, 105, 115, 32, 105, 110, 115,
+116, 97, 110, 99, 101, 111, 102, 32, 67, 111, 110, 116, 101, 120, 116, 77, 105,
+114, 114, 111, 114, 59, 10, 125, 59, 10, 77, 105, 114, 114, 111, 114, 46, 112,
+114, 111, 116, 111, 116, 121, 112, 101, 46, 105, 115, 83, 99, 111, 112, 101, 61,
+102, 117, 110, 99, 116, 105, 111, 110, 40, 41, 123, 10, 114, 101, 116, 117, 114,
+110, 32, 116, 104, 105, 115, 32, 105, 110, 115, 116, 97, 110, 99, 101, 111, 102,
+32, 83, 99, 111, 112, 101, 77, 105, 114, 114, 111, 114, 59, 10, 125, 59, 10, 77,
+105, 114, 114, 111, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46,
+105, 115, 77, 97, 112, 61, 102, 117, 110, 99, 116, 105, 111, 110, 40, 41, 123,
+10, 114, 101, 116, 117, 114, 110, 32, 116, 104, 105, 115, 32, 105, 110, 115,
+116, 97, 110, 99, 101, 111, 102, 32, 77, 97, 112, 77, 105, 114, 114, 111, 114,
+59, 10, 125, 59, 10, 77, 105, 114, 114, 111, 114, 46, 112, 114, 111, 116, 111,
+116, 121, 112, 101, 46, 105, 115, 83, 101, 116, 61, 102, 117, 110, 99, 116, 105,
+111, 110, 40, 41, 123, 10, 114, 101, 116, 117, 114, 110, 32, 116, 104, 105, 115,
+32, 105, 110, 115, 116, 97, 110, 99, 101, 111, 102, 32, 83, 101, 116, 77, 105,
+114, 114, 111, 114, 59, 10, 125, 59, 10, 77, 105, 114, 114, 111, 114, 46, 112,
+114, 111, 116, 111, 116, 121, 112, 101, 46, 105, 115, 73, 116, 101, 114, 97,
+116, 111, 114, 61, 102, 117, 110, 99, 116, 105, 111, 110, 40, 41, 123, 10, 114,
+101, 116, 117, 114, 110, 32, 116, 104, 105, 115, 32, 105, 110, 115, 116, 97,
+110, 99, 101, 111, 102, 32, 73, 116, 101, 114, 97, 116, 111, 114, 77, 105, 114,
+114, 111, 114, 59, 10, 125, 59, 10, 77, 105, 114, 114, 111, 114, 46, 112, 114,
+111, 116, 111, 116, 121, 112, 101, 46, 116, 111, 84, 101, 120, 116, 61, 102,
+117, 110, 99, 116, 105, 111, 110, 40, 41, 123, 10, 114, 101, 116, 117, 114, 110,
+34, 35, 60, 34, 43, 116, 104, 105, 115, 46, 99, 111, 110, 115, 116, 114, 117,
+99, 116, 111, 114, 46, 110, 97, 109, 101, 43, 34, 62, 34, 59, 10, 125, 59, 10,
+102, 117, 110, 99, 116, 105, 111, 110, 32, 86, 97, 108, 117, 101, 77, 105, 114,
+114, 111, 114, 40, 116, 44, 107, 41, 123, 10, 37, 95, 67, 97, 108, 108, 40, 77,
+105, 114, 114, 111, 114, 44, 116, 104, 105, 115, 44, 116, 41, 59, 10, 116, 104,
+105, 115, 46, 118, 97, 108, 117, 101, 95, 61, 107, 59, 10, 125, 10, 105, 110,
+104, 101, 114, 105, 116, 115, 40, 86, 97, 108, 117, 101, 77, 105, 114, 114, 111,
+114, 44, 77, 105, 114, 114, 111, 114, 41, 59, 10, 86, 97, 108, 117, 101, 77,
+105, 114, 114, 111, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46,
+105, 115, 80, 114, 105, 109, 105, 116, 105, 118, 101, 61, 102, 117, 110, 99,
+116, 105, 111, 110, 40, 41, 123, 10, 118, 97, 114, 32, 116, 61, 116, 104, 105,
+115, 46, 116, 121, 112, 101, 40, 41, 59, 10, 114, 101, 116, 117, 114, 110, 32,
+116, 61, 61, 61, 39, 117, 110, 100, 101, 102, 105, 110, 101, 100, 39, 124, 124,
+10, 116, 61, 61, 61, 39, 110, 117, 108, 108, 39, 124, 124, 10, 116, 61, 61, 61,
+39, 98, 111, 111, 108, 101, 97, 110, 39, 124, 124, 10, 116, 61, 61, 61, 39, 110,
+117, 109, 98, 101, 114, 39, 124, 124, 10, 116, 61, 61, 61, 39, 115, 116, 114,
+105, 110, 103, 39, 124, 124, 10, 116, 61, 61, 61, 39, 115, 121, 109, 98, 111,
+108, 39, 59, 10, 125, 59, 10, 86, 97, 108, 117, 101, 77, 105, 114, 114, 111,
+114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 118, 97, 108, 117,
+101, 61, 102, 117, 110, 99, 116, 105, 111, 110, 40, 41, 123, 10, 114, 101, 116,
+117, 114, 110, 32, 116, 104, 105, 115, 46, 118, 97, 108, 117, 101, 95, 59, 10,
+125, 59, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 85, 110, 100, 101, 102,
+105, 110, 101, 100, 77, 105, 114, 114, 111, 114, 40, 41, 123, 10, 37, 95, 67,
+97, 108, 108, 40, 86, 97, 108, 117, 101, 77, 105, 114, 114, 111, 114, 44, 116,
+104, 105, 115, 44, 106, 46, 85, 78, 68, 69, 70, 73, 78, 69, 68, 95, 84, 89, 80,
+69, 44, 40, 118, 111, 105, 100, 32, 48, 41, 41, 59, 10, 125, 10, 105, 110, 104,
+101, 114, 105, 116, 115, 40, 85, 110, 100, 101, 102, 105, 110, 101, 100, 77,
+105, 114, 114, 111, 114, 44, 86, 97, 108, 117, 101, 77, 105, 114, 114, 111, 114,
+41, 59, 10, 85, 110, 100, 101, 102, 105, 110, 101, 100, 77, 105, 114, 114, 111,
+114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 116, 111, 84, 101,
+120, 116, 61, 102, 117, 110, 99, 116, 105, 111, 110, 40, 41, 123, 10, 114, 101,
+116, 117, 114, 110, 39, 117, 110, 100, 101, 102, 105, 110, 101, 100, 39, 59, 10,
+125, 59, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 78, 117, 108, 108, 77,
+105, 114, 114, 111, 114, 40, 41, 123, 10, 37, 95, 67, 97, 108, 108, 40, 86, 97,
+108, 117, 101, 77, 105, 114, 114, 111, 114, 44, 116, 104, 105, 115, 44, 106, 46,
+78, 85, 76, 76, 95, 84, 89, 80, 69, 44, 110, 117, 108, 108, 41, 59, 10, 125, 10,
+105, 110, 104, 101, 114, 105, 116, 115, 40, 78, 117, 108, 108, 77, 105, 114,
+114, 111, 114, 44, 86, 97, 108, 117, 101, 77, 105, 114, 114, 111, 114, 41, 59,
+10, 78, 117, 108, 108, 77, 105, 114, 114, 111, 114, 46, 112, 114, 111, 116, 111,
+116, 121, 112, 101, 46, 116, 111, 84, 101, 120, 116, 61, 102, 117, 110, 99, 116,
+105, 111, 110, 40, 41, 123, 10, 114, 101, 116, 117, 114, 110, 39, 110, 117, 108,
+108, 39, 59, 10, 125, 59, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 66,
+111, 111, 108, 101, 97, 110, 77, 105, 114, 114, 111, 114, 40, 107, 41, 123, 10,
+37, 95, 67, 97, 108, 108, 40, 86, 97, 108, 117, 101, 77, 105, 114, 114, 111,
+114, 44, 116, 104, 105, 115, 44, 106, 46, 66, 79, 79, 76, 69, 65, 78, 95, 84,
+89, 80, 69, 44, 107, 41, 59, 10, 125, 10, 105, 110, 104, 101, 114, 105, 116,
+115, 40, 66, 111, 111, 108, 101, 97, 110, 77, 105, 114, 114, 111, 114, 44, 86,
+97, 108, 117, 101, 77, 105, 114, 114, 111, 114, 41, 59, 10, 66, 111, 111, 108,
+101, 97, 110, 77, 105, 114, 114, 111, 114, 46, 112, 114, 111, 116, 111, 116,
+121, 112, 101, 46, 116, 111, 84, 101, 120, 116, 61, 102, 117, 110, 99, 116, 105,
+111, 110, 40, 41, 123, 10, 114, 101, 116, 117, 114, 110, 32, 116, 104, 105, 115,
+46, 118, 97, 108, 117, 101, 95, 63, 39, 116, 114, 117, 101, 39, 58, 39, 102, 97,
+108, 115, 101, 39, 59, 10, 125, 59, 10, 102, 117, 110, 99, 116, 105, 111, 110,
+32, 78, 117, 109, 98, 101, 114, 77, 105, 114, 114, 111, 114, 40, 107, 41, 123,
+10, 37, 95, 67, 97, 108, 108, 40, 86, 97, 108, 117, 101, 77, 105, 114, 114, 111,
+114, 44, 116, 104, 105, 115, 44, 106, 46, 78, 85, 77, 66, 69, 82, 95, 84, 89,
+80, 69, 44, 107, 41, 59, 10, 125, 10, 105, 110, 104, 101, 114, 105, 116, 115,
+40, 78, 117, 109, 98, 101, 114, 77, 105, 114, 114, 111, 114, 44, 86, 97, 108,
+117, 101, 77, 105, 114, 114, 111, 114, 41, 59, 10, 78, 117, 109, 98, 101, 114,
+77, 105, 114, 114, 111, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101,
+46, 116, 111, 84, 101, 120, 116, 61, 102, 117, 110, 99, 116, 105, 111, 110, 40,
+41, 123, 10, 114, 101, 116, 117, 114, 110, 39, 39, 43, 116, 104, 105, 115, 46,
+118, 97, 108, 117, 101, 95, 59, 10, 125, 59, 10, 102, 117, 110, 99, 116, 105,
+111, 110, 32, 83, 116, 114, 105, 110, 103, 77, 105, 114, 114, 111, 114, 40, 107,
+41, 123, 10, 37, 95, 67, 97, 108, 108, 40, 86, 97, 108, 117, 101, 77, 105, 114,
+114, 111, 114, 44, 116, 104, 105, 115, 44, 106, 46, 83, 84, 82, 73, 78, 71, 95,
+84, 89, 80, 69, 44, 107, 41, 59, 10, 125, 10, 105, 110, 104, 101, 114, 105, 116,
+115, 40, 83, 116, 114, 105, 110, 103, 77, 105, 114, 114, 111, 114, 44, 86, 97,
+108, 117, 101, 77, 105, 114, 114, 111, 114, 41, 59, 10, 83, 116, 114, 105, 110,
+103, 77, 105, 114, 114, 111, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112,
+101, 46, 108, 101, 110, 103, 116, 104, 61, 102, 117, 110, 99, 116, 105, 111,
+110, 40, 41, 123, 10, 114, 101, 116, 117, 114, 110, 32, 116, 104, 105, 115, 46,
+118, 97, 108, 117, 101, 95, 46, 108, 101, 110, 103, 116, 104, 59, 10, 125, 59,
+10, 83, 116, 114, 105, 110, 103, 77, 105, 114, 114, 111, 114, 46, 112, 114, 111,
+116, 111, 116, 121, 112, 101, 46, 103, 101, 116, 84, 114, 117, 110, 99, 97, 116,
+101, 100, 86, 97, 108, 117, 101, 61, 102, 117, 110, 99, 116, 105, 111, 110, 40,
+117, 41, 123, 10, 105, 102, 40, 117, 33, 61, 45, 49, 38, 38, 116, 104, 105, 115,
+46, 108, 101, 110, 103, 116, 104, 40, 41, 62, 117, 41, 123, 10, 114, 101, 116,
+117, 114, 110, 32, 116, 104, 105, 115, 46, 118, 97, 108, 117, 101, 95, 46, 115,
+117, 98, 115, 116, 114, 105, 110, 103, 40, 48, 44, 117, 41, 43, 10, 39, 46, 46,
+46, 32, 40, 108, 101, 110, 103, 116, 104, 58, 32, 39, 43, 116, 104, 105, 115,
+46, 108, 101, 110, 103, 116, 104, 40, 41, 43, 39, 41, 39, 59, 10, 125, 10, 114,
+101, 116, 117, 114, 110, 32, 116, 104, 105, 115, 46, 118, 97, 108, 117, 101, 95,
+59, 10, 125, 59, 10, 83, 116, 114, 105, 110, 103, 77, 105, 114, 114, 111, 114,
+46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 116, 111, 84, 101, 120,
+116, 61, 102, 117, 110, 99, 116, 105, 111, 110, 40, 41, 123, 10, 114, 101, 116,
+117, 114, 110, 32, 116, 104, 105, 115, 46, 103, 101, 116, 84, 114, 117, 110, 99,
+97, 116, 101, 100, 86, 97, 108, 117, 101, 40, 112, 41, 59, 10, 125, 59, 10, 102,
+117, 110, 99, 116, 105, 111, 110, 32, 83, 121, 109, 98, 111, 108, 77, 105, 114,
+114, 111, 114, 40, 107, 41, 123, 10, 37, 95, 67, 97, 108, 108, 40, 86, 97, 108,
+117, 101, 77, 105, 114, 114, 111, 114, 44, 116, 104, 105, 115, 44, 106, 46, 83,
+89, 77, 66, 79, 76, 95, 84, 89, 80, 69, 44, 107, 41, 59, 10, 125, 10, 105, 110,
+104, 101, 114, 105, 116, 115, 40, 83, 121, 109, 98, 111, 108, 77, 105, 114, 114,
+111, 114, 44, 86, 97, 108, 117, 101, 77, 105, 114, 114, 111, 114, 41, 59, 10,
+83, 121, 109, 98, 111, 108, 77, 105, 114, 114, 111, 114, 46, 112, 114, 111, 116,
+111, 116, 121, 112, 101, 46, 100, 101, 115, 99, 114, 105, 112, 116, 105, 111,
+110, 61, 102, 117, 110, 99, 116, 105, 111, 110, 40, 41, 123, 10, 114, 101, 116,
+117, 114, 110, 32, 37, 83, 121, 109, 98, 111, 108, 68, 101, 115, 99, 114, 105,
+112, 116, 105, 111, 110, 40, 37, 86, 97, 108, 117, 101, 79, 102, 40, 116, 104,
+105, 115, 46, 118, 97, 108, 117, 101, 95, 41, 41, 59, 10, 125, 10, 83, 121, 109,
+98, 111, 108, 77, 105, 114, 114, 111, 114, 46, 112, 114, 111, 116, 111, 116,
+121, 112, 101, 46, 116, 111, 84, 101, 120, 116, 61, 102, 117, 110, 99, 116, 105,
+111, 110, 40, 41, 123, 10, 114, 101, 116, 117, 114, 110, 32, 37, 83, 121, 109,
+98, 111, 108, 68, 101, 115, 99, 114, 105, 112, 116, 105, 118, 101, 83, 116, 114,
+105, 110, 103, 40, 37, 86, 97, 108, 117, 101, 79, 102, 40, 116, 104, 105, 115,
+46, 118, 97, 108, 117, 101, 95, 41, 41, 59, 10, 125, 10, 102, 117, 110, 99, 116,
+105, 111, 110, 32, 79, 98, 106, 101, 99, 116, 77, 105, 114, 114, 111, 114, 40,
+107, 44, 116, 41, 123, 10, 116, 61, 116, 124, 124, 106, 46, 79, 66, 74, 69, 67,
+84, 95, 84, 89, 80, 69, 59, 10, 37, 95, 67, 97, 108, 108, 40, 86, 97, 108, 117,
+101, 77, 105, 114, 114, 111, 114, 44, 116, 104, 105, 115, 44, 116, 44, 107, 41,
+59, 10, 125, 10, 105, 110, 104, 101, 114, 105, 116, 115, 40, 79, 98, 106, 101,
+99, 116, 77, 105, 114, 114, 111, 114, 44, 86, 97, 108, 117, 101, 77, 105, 114,
+114, 111, 114, 41, 59, 10, 79, 98, 106, 101, 99, 116, 77, 105, 114, 114, 111,
+114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 99, 108, 97, 115, 115,
+78, 97, 109, 101, 61, 102, 117, 110, 99, 116, 105, 111, 110, 40, 41, 123, 10,
+114, 101, 116, 117, 114, 110, 32, 37, 67, 108, 97, 115, 115, 79, 102, 40, 116,
+104, 105, 115, 46, 118, 97, 108, 117, 101, 95, 41, 59, 10, 125, 59, 10, 79, 98,
+106, 101, 99, 116, 77, 105, 114, 114, 111, 114, 46, 112, 114, 111, 116, 111,
+116, 121, 112, 101, 46, 99, 111, 110, 115, 116, 114, 117, 99, 116, 111, 114, 70,
+117, 110, 99, 116, 105, 111, 110, 61, 102, 117, 110, 99, 116, 105, 111, 110, 40,
+41, 123, 10, 114, 101, 116, 117, 114, 110, 32, 77, 97, 107, 101, 77, 105, 114,
+114, 111, 114, 40, 37, 68, 101, 98, 117, 103, 71, 101, 116, 80, 114, 111, 112,
+101, 114, 116, 121, 40, 116, 104, 105, 115, 46, 118, 97, 108, 117, 101, 95, 44,
+39, 99, 111, 110, 115, 116, 114, 117, 99, 116, 111, 114, 39, 41, 41, 59, 10,
+125, 59, 10, 79, 98, 106, 101, 99, 116, 77, 105, 114, 114, 111, 114, 46, 112,
+114, 111, 116, 111, 116, 121, 112, 101, 46, 112, 114, 111, 116, 111, 116, 121,
+112, 101, 79, 98, 106, 101, 99, 116, 61, 102, 117, 110, 99, 116, 105, 111, 110,
+40, 41, 123, 10, 114, 101, 116, 117, 114, 110, 32, 77, 97, 107, 101, 77, 105,
+114, 114, 111, 114, 40, 37, 68, 101, 98, 117, 103, 71, 101, 116, 80, 114, 111,
+112, 101, 114, 116, 121, 40, 116, 104, 105, 115, 46, 118, 97, 108, 117, 101, 95,
+44, 39, 112, 114, 111, 116, 111, 116, 121, 112, 101, 39, 41, 41, 59, 10, 125,
+59, 10, 79, 98, 106, 101, 99, 116, 77, 105, 114, 114, 111, 114, 46, 112, 114,
+111, 116, 111, 116, 121, 112, 101, 46, 112, 114, 111, 116, 111, 79, 98, 106,
+101, 99, 116, 61, 102, 117, 110, 99, 116, 105, 111, 110, 40, 41, 123, 10, 114,
+101, 116, 117, 114, 110, 32, 77, 97, 107, 101, 77, 105, 114, 114, 111, 114, 40,
+37, 68, 101, 98, 117, 103, 71, 101, 116, 80, 114, 111, 116, 111, 116, 121, 112,
+101, 40, 116, 104, 105, 115, 46, 118, 97, 108, 117, 101, 95, 41, 41, 59, 10,
+125, 59, 10, 79, 98, 106, 101, 99, 116, 77, 105, 114, 114, 111, 114, 46, 112,
+114, 111, 116, 111, 116, 121, 112, 101, 46, 104, 97, 115, 78, 97, 109, 101, 100,
+73, 110, 116, 101, 114, 99, 101, 112, 116, 111, 114, 61, 102, 117, 110, 99, 116,
+105, 111, 110, 40, 41, 123, 10, 118, 97, 114, 32, 118, 61, 37, 71, 101, 116, 73,
+110, 116, 101, 114, 99, 101, 112, 116, 111, 114, 73, 110, 102, 111, 40, 116,
+104, 105, 115, 46, 118, 97, 108, 117, 101, 95, 41, 59, 10, 114, 101, 116, 117,
+114, 110, 40, 118, 38, 50, 41, 33, 61, 48, 59, 10, 125, 59, 10, 79, 98, 106,
+101, 99, 116, 77, 105, 114, 114, 111, 114, 46, 112, 114, 111, 116, 111, 116,
+121, 112, 101, 46, 104, 97, 115, 73, 110, 100, 101, 120, 101, 100, 73, 110, 116,
+101, 114, 99, 101, 112, 116, 111, 114, 61, 102, 117, 110, 99, 116, 105, 111,
+110, 40, 41, 123, 10, 118, 97, 114, 32, 118, 61, 37, 71, 101, 116, 73, 110, 116,
+101, 114, 99, 101, 112, 116, 111, 114, 73, 110, 102, 111, 40, 116, 104, 105,
+115, 46, 118, 97, 108, 117, 101, 95, 41, 59, 10, 114, 101, 116, 117, 114, 110,
+40, 118, 38, 49, 41, 33, 61, 48, 59, 10, 125, 59, 10, 79, 98, 106, 101, 99, 116,
+77, 105, 114, 114, 111, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101,
+46, 112, 114, 111, 112, 101, 114, 116, 121, 78, 97, 109, 101, 115, 61, 102, 117,
+110, 99, 116, 105, 111, 110, 40, 41, 123, 10, 114, 101, 116, 117, 114, 110, 32,
+37, 71, 101, 116, 79, 119, 110, 80, 114, 111, 112, 101, 114, 116, 121, 75, 101,
+121, 115, 40, 116, 104, 105, 115, 46, 118, 97, 108, 117, 101, 95, 44, 48, 41,
+59, 10, 125, 59, 10, 79, 98, 106, 101, 99, 116, 77, 105, 114, 114, 111, 114, 46,
+112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 112, 114, 111, 112, 101, 114,
+116, 105, 101, 115, 61, 102, 117, 110, 99, 116, 105, 111, 110, 40, 41, 123, 10,
+118, 97, 114, 32, 119, 61, 116, 104, 105, 115, 46, 112, 114, 111, 112, 101, 114,
+116, 121, 78, 97, 109, 101, 115, 40, 41, 59, 10, 118, 97, 114, 32, 120, 61, 110,
+101, 119, 32, 99, 40, 119, 46, 108, 101, 110, 103, 116, 104, 41, 59, 10, 102,
+111, 114, 40, 118, 97, 114, 32, 121, 61, 48, 59, 121, 60, 119, 46, 108, 101,
+110, 103, 116, 104, 59, 121, 43, 43, 41, 123, 10, 120, 91, 121, 93, 61, 116,
+104, 105, 115, 46, 112, 114, 111, 112, 101, 114, 116, 121, 40, 119, 91, 121, 93,
+41, 59, 10, 125, 10, 114, 101, 116, 117, 114, 110, 32, 120, 59, 10, 125, 59, 10,
+79, 98, 106, 101, 99, 116, 77, 105, 114, 114, 111, 114, 46, 112, 114, 111, 116,
+111, 116, 121, 112, 101, 46, 105, 110, 116, 101, 114, 110, 97, 108, 80, 114,
+111, 112, 101, 114, 116, 105, 101, 115, 61, 102, 117, 110, 99, 116, 105, 111,
+110, 40, 41, 123, 10, 114, 101, 116, 117, 114, 110, 32, 79, 98, 106, 101, 99,
+116, 77, 105, 114, 114, 111, 114, 46, 71, 101, 116, 73, 110, 116, 101, 114, 110,
+97, 108, 80, 114, 111, 112, 101, 114, 116, 105, 101, 115, 40, 116, 104, 105,
+115, 46, 118, 97, 108, 117, 101, 95, 41, 59, 10, 125, 10, 79, 98, 106, 101, 99,
+116, 77, 105, 114, 114, 111, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112,
+101, 46, 112, 114, 111, 112, 101, 114, 116, 121, 61, 102, 117, 110, 99, 116,
+105, 111, 110, 40, 122, 41, 123, 10, 118, 97, 114, 32, 65, 61, 37, 68, 101, 98,
+117, 103, 71, 101, 116, 80, 114, 111, 112, 101, 114, 116, 121, 68, 101, 116, 97,
+105, 108, 115, 40, 116, 104, 105, 115, 46, 118, 97, 108, 117, 101, 95, 44, 122,
+41, 59, 10, 105, 102, 40, 65, 41, 123, 10, 114, 101, 116, 117, 114, 110, 32,
+110, 101, 119, 32, 80, 114, 111, 112, 101, 114, 116, 121, 77, 105, 114, 114,
+111, 114, 40, 116, 104, 105, 115, 44, 122, 44, 65, 41, 59, 10, 125, 10, 114,
+101, 116, 117, 114, 110, 32, 71, 101, 116, 85, 110, 100, 101, 102, 105, 110,
+101, 100, 77, 105, 114, 114, 111, 114, 40, 41, 59, 10, 125, 59, 10, 79, 98, 106,
+101, 99, 116, 77, 105, 114, 114, 111, 114, 46, 112, 114, 111, 116, 111, 116,
+121, 112, 101, 46, 108, 111, 111, 107, 117, 112, 80, 114, 111, 112, 101, 114,
+116, 121, 61, 102, 117, 110, 99, 116, 105, 111, 110, 40, 107, 41, 123, 10, 118,
+97, 114, 32, 120, 61, 116, 104, 105, 115, 46, 112, 114, 111, 112, 101, 114, 116,
+105, 101, 115, 40, 41, 59, 10, 102, 111, 114, 40, 118, 97, 114, 32, 121, 61, 48,
+59, 121, 60, 120, 46, 108, 101, 110, 103, 116, 104, 59, 121, 43, 43, 41, 123,
+10, 118, 97, 114, 32, 66, 61, 120, 91, 121, 93, 59, 10, 105, 102, 40, 66, 46,
+112, 114, 111, 112, 101, 114, 116, 121, 84, 121, 112, 101, 40, 41, 61, 61, 113,
+46, 68, 97, 116, 97, 41, 123, 10, 105, 102, 40, 66, 46, 118, 97, 108, 117, 101,
+95, 61, 61, 61, 107, 46, 118, 97, 108, 117, 101, 95, 41, 123, 10, 114, 101, 116,
+117, 114, 110, 32, 66, 59, 10, 125, 10, 125, 10, 125, 10, 114, 101, 116, 117,
+114, 110, 32, 71, 101, 116, 85, 110, 100, 101, 102, 105, 110, 101, 100, 77, 105,
+114, 114, 111, 114, 40, 41, 59, 10, 125, 59, 10, 79, 98, 106, 101, 99, 116, 77,
+105, 114, 114, 111, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46,
+114, 101, 102, 101, 114, 101, 110, 99, 101, 100, 66, 121, 61, 102, 117, 110, 99,
+116, 105, 111, 110, 40, 67, 41, 123, 10, 118, 97, 114, 32, 68, 61, 37, 68, 101,
+98, 117, 103, 82, 101, 102, 101, 114, 101, 110, 99, 101, 100, 66, 121, 40, 116,
+104, 105, 115, 46, 118, 97, 108, 117, 101, 95, 44, 10, 77, 105, 114, 114, 111,
+114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 44, 67, 124, 124, 48, 41,
+59, 10, 102, 111, 114, 40, 118, 97, 114, 32, 121, 61, 48, 59, 121, 60, 68, 46,
+108, 101, 110, 103, 116, 104, 59, 121, 43, 43, 41, 123, 10, 68, 91, 121, 93, 61,
+77, 97, 107, 101, 77, 105, 114, 114, 111, 114, 40, 68, 91, 121, 93, 41, 59, 10,
+125, 10, 114, 101, 116, 117, 114, 110, 32, 68, 59, 10, 125, 59, 10, 79, 98, 106,
+101, 99, 116, 77, 105, 114, 114, 111, 114, 46, 112, 114, 111, 116, 111, 116,
+121, 112, 101, 46, 116, 111, 84, 101, 120, 116, 61, 102, 117, 110, 99, 116, 105,
+111, 110, 40, 41, 123, 10, 118, 97, 114, 32, 122, 59, 10, 118, 97, 114, 32, 109,
+61, 116, 104, 105, 115, 46, 99, 111, 110, 115, 116, 114, 117, 99, 116, 111, 114,
+70, 117, 110, 99, 116, 105, 111, 110, 40, 41, 59, 10, 105, 102, 40, 33, 109, 46,
+105, 115, 70, 117, 110, 99, 116, 105, 111, 110, 40, 41, 41, 123, 10, 122, 61,
+116, 104, 105, 115, 46, 99, 108, 97, 115, 115, 78, 97, 109, 101, 40, 41, 59, 10,
+125, 101, 108, 115, 101, 123, 10, 122, 61, 109, 46, 110, 97, 109, 101, 40, 41,
+59, 10, 105, 102, 40, 33, 122, 41, 123, 10, 122, 61, 116, 104, 105, 115, 46, 99,
+108, 97, 115, 115, 78, 97, 109, 101, 40, 41, 59, 10, 125, 10, 125, 10, 114, 101,
+116, 117, 114, 110, 39, 35, 60, 39, 43, 122, 43, 39, 62, 39, 59, 10, 125, 59,
+10, 79, 98, 106, 101, 99, 116, 77, 105, 114, 114, 111, 114, 46, 71, 101, 116,
+73, 110, 116, 101, 114, 110, 97, 108, 80, 114, 111, 112, 101, 114, 116, 105,
+101, 115, 61, 102, 117, 110, 99, 116, 105, 111, 110, 40, 107, 41, 123, 10, 118,
+97, 114, 32, 120, 61, 37, 68, 101, 98, 117, 103, 71, 101, 116, 73, 110, 116,
+101, 114, 110, 97, 108, 80, 114, 111, 112, 101, 114, 116, 105, 101, 115, 40,
+107, 41, 59, 10, 118, 97, 114, 32, 68, 61, 91, 93, 59, 10, 102, 111, 114, 40,
+118, 97, 114, 32, 121, 61, 48, 59, 121, 60, 120, 46, 108, 101, 110, 103, 116,
+104, 59, 121, 43, 61, 50, 41, 123, 10, 68, 46, 112, 117, 115, 104, 40, 110, 101,
+119, 32, 73, 110, 116, 101, 114, 110, 97, 108, 80, 114, 111, 112, 101, 114, 116,
+121, 77, 105, 114, 114, 111, 114, 40, 120, 91, 121, 93, 44, 120, 91, 121, 43,
+49, 93, 41, 41, 59, 10, 125, 10, 114, 101, 116, 117, 114, 110, 32, 68, 59, 10,
+125, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 70, 117, 110, 99, 116, 105,
+111, 110, 77, 105, 114, 114, 111, 114, 40, 107, 41, 123, 10, 37, 95, 67, 97,
+108, 108, 40, 79, 98, 106, 101, 99, 116, 77, 105, 114, 114, 111, 114, 44, 116,
+104, 105, 115, 44, 107, 44, 106, 46, 70, 85, 78, 67, 84, 73, 79, 78, 95, 84, 89,
+80, 69, 41, 59, 10, 116, 104, 105, 115, 46, 114, 101, 115, 111, 108, 118, 101,
+100, 95, 61, 116, 114, 117, 101, 59, 10, 125, 10, 105, 110, 104, 101, 114, 105,
+116, 115, 40, 70, 117, 110, 99, 116, 105, 111, 110, 77, 105, 114, 114, 111, 114,
+44, 79, 98, 106, 101, 99, 116, 77, 105, 114, 114, 111, 114, 41, 59, 10, 70, 117,
+110, 99, 116, 105, 111, 110, 77, 105, 114, 114, 111, 114, 46, 112, 114, 111,
+116, 111, 116, 121, 112, 101, 46, 114, 101, 115, 111, 108, 118, 101, 100, 61,
+102, 117, 110, 99, 116, 105, 111, 110, 40, 41, 123, 10, 114, 101, 116, 117, 114,
+110, 32, 116, 104, 105, 115, 46, 114, 101, 115, 111, 108, 118, 101, 100, 95, 59,
+10, 125, 59, 10, 70, 117, 110, 99, 116, 105, 111, 110, 77, 105, 114, 114, 111,
+114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 110, 97, 109, 101, 61,
+102, 117, 110, 99, 116, 105, 111, 110, 40, 41, 123, 10, 114, 101, 116, 117, 114,
+110, 32, 37, 70, 117, 110, 99, 116, 105, 111, 110, 71, 101, 116, 78, 97, 109,
+101, 40, 116, 104, 105, 115, 46, 118, 97, 108, 117, 101, 95, 41, 59, 10, 125,
+59, 10, 70, 117, 110, 99, 116, 105, 111, 110, 77, 105, 114, 114, 111, 114, 46,
+112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 100, 101, 98, 117, 103, 78, 97,
+109, 101, 61, 102, 117, 110, 99, 116, 105, 111, 110, 40, 41, 123, 10, 114, 101,
+116, 117, 114, 110, 32, 37, 70, 117, 110, 99, 116, 105, 111, 110, 71, 101, 116,
+68, 101, 98, 117, 103, 78, 97, 109, 101, 40, 116, 104, 105, 115, 46, 118, 97,
+108, 117, 101, 95, 41, 59, 10, 125, 10, 70, 117, 110, 99, 116, 105, 111, 110,
+77, 105, 114, 114, 111, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101,
+46, 105, 110, 102, 101, 114, 114, 101, 100, 78, 97, 109, 101, 61, 102, 117, 110,
+99, 116, 105, 111, 110, 40, 41, 123, 10, 114, 101, 116, 117, 114, 110, 32, 37,
+70, 117, 110, 99, 116, 105, 111, 110, 71, 101, 116, 73, 110, 102, 101, 114, 114,
+101, 100, 78, 97, 109, 101, 40, 116, 104, 105, 115, 46, 118, 97, 108, 117, 101,
+95, 41, 59, 10, 125, 59, 10, 70, 117, 110, 99, 116, 105, 111, 110, 77, 105, 114,
+114, 111, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 115, 111,
+117, 114, 99, 101, 61, 102, 117, 110, 99, 116, 105, 111, 110, 40, 41, 123, 10,
+105, 102, 40, 116, 104, 105, 115, 46, 114, 101, 115, 111, 108, 118, 101, 100,
+40, 41, 41, 123, 10, 114, 101, 116, 117, 114, 110, 32, 37, 70, 117, 110, 99,
+116, 105, 111, 110, 84, 111, 83, 116, 114, 105, 110, 103, 40, 116, 104, 105,
+115, 46, 118, 97, 108, 117, 101, 95, 41, 59, 10, 125, 10, 125, 59, 10, 70, 117,
+110, 99, 116, 105, 111, 110, 77, 105, 114, 114, 111, 114, 46, 112, 114, 111,
+116, 111, 116, 121, 112, 101, 46, 115, 99, 114, 105, 112, 116, 61, 102, 117,
+110, 99, 116, 105, 111, 110, 40, 41, 123, 10, 105, 102, 40, 116, 104, 105, 115,
+46, 114, 101, 115, 111, 108, 118, 101, 100, 40, 41, 41, 123, 10, 105, 102, 40,
+116, 104, 105, 115, 46, 115, 99, 114, 105, 112, 116, 95, 41, 123, 10, 114, 101,
+116, 117, 114, 110, 32, 116, 104, 105, 115, 46, 115, 99, 114, 105, 112, 116, 95,
+59, 10, 125, 10, 118, 97, 114, 32, 69, 61, 37, 70, 117, 110, 99, 116, 105, 111,
+110, 71, 101, 116, 83, 99, 114, 105, 112, 116, 40, 116, 104, 105, 115, 46, 118,
+97, 108, 117, 101, 95, 41, 59, 10, 105, 102, 40, 69, 41, 123, 10, 114, 101, 116,
+117, 114, 110, 32, 116, 104, 105, 115, 46, 115, 99, 114, 105, 112, 116, 95, 61,
+77, 97, 107, 101, 77, 105, 114, 114, 111, 114, 40, 69, 41, 59, 10, 125, 10, 125,
+10, 125, 59, 10, 70, 117, 110, 99, 116, 105, 111, 110, 77, 105, 114, 114, 111,
+114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 115, 111, 117, 114,
+99, 101, 80, 111, 115, 105, 116, 105, 111, 110, 95, 61, 102, 117, 110, 99, 116,
+105, 111, 110, 40, 41, 123, 10, 105, 102, 40, 116, 104, 105, 115, 46, 114, 101,
+115, 111, 108, 118, 101, 100, 40, 41, 41, 123, 10, 114, 101, 116, 117, 114, 110,
+32, 37, 70, 117, 110, 99, 116, 105, 111, 110, 71, 101, 116, 83, 99, 114, 105,
+112, 116, 83, 111, 117, 114, 99, 101, 80, 111, 115, 105, 116, 105, 111, 110, 40,
+116, 104, 105, 115, 46, 118, 97, 108, 117, 101, 95, 41, 59, 10, 125, 10, 125,
+59, 10, 70, 117, 110, 99, 116, 105, 111, 110, 77, 105, 114, 114, 111, 114, 46,
+112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 115, 111, 117, 114, 99, 101,
+76, 111, 99, 97, 116, 105, 111, 110, 61, 102, 117, 110, 99, 116, 105, 111, 110,
+40, 41, 123, 10, 105, 102, 40, 116, 104, 105, 115, 46, 114, 101, 115, 111, 108,
+118, 101, 100, 40, 41, 41, 123, 10, 118, 97, 114, 32, 69, 61, 116, 104, 105,
+115, 46, 115, 99, 114, 105, 112, 116, 40, 41, 59, 10, 105, 102, 40, 69, 41, 123,
+10, 114, 101, 116, 117, 114, 110, 32, 69, 46, 108, 111, 99, 97, 116, 105, 111,
+110, 70, 114, 111, 109, 80, 111, 115, 105, 116, 105, 111, 110, 40, 116, 104,
+105, 115, 46, 115, 111, 117, 114, 99, 101, 80, 111, 115, 105, 116, 105, 111,
+110, 95, 40, 41, 44, 116, 114, 117, 101, 41, 59, 10, 125, 10, 125, 10, 125, 59,
+10, 70, 117, 110, 99, 116, 105, 111, 110, 77, 105, 114, 114, 111, 114, 46, 112,
+114, 111, 116, 111, 116, 121, 112, 101, 46, 99, 111, 110, 115, 116, 114, 117,
+99, 116, 101, 100, 66, 121, 61, 102, 117, 110, 99, 116, 105, 111, 110, 40, 70,
+41, 123, 10, 105, 102, 40, 116, 104, 105, 115, 46, 114, 101, 115, 111, 108, 118,
+101, 100, 40, 41, 41, 123, 10, 118, 97, 114, 32, 68, 61, 37, 68, 101, 98, 117,
+103, 67, 111, 110, 115, 116, 114, 117, 99, 116, 101, 100, 66, 121, 40, 116, 104,
+105, 115, 46, 118, 97, 108, 117, 101, 95, 44, 70, 124, 124, 48, 41, 59, 10, 102,
+111, 114, 40, 118, 97, 114, 32, 121, 61, 48, 59, 121, 60, 68, 46, 108, 101, 110,
+103, 116, 104, 59, 121, 43, 43, 41, 123, 10, 68, 91, 121, 93, 61, 77, 97, 107,
+101, 77, 105, 114, 114, 111, 114, 40, 68, 91, 121, 93, 41, 59, 10, 125, 10, 114,
+101, 116, 117, 114, 110, 32, 68, 59, 10, 125, 101, 108, 115, 101, 123, 10, 114,
+101, 116, 117, 114, 110, 91, 93, 59, 10, 125, 10, 125, 59, 10, 70, 117, 110, 99,
+116, 105, 111, 110, 77, 105, 114, 114, 111, 114, 46, 112, 114, 111, 116, 111,
+116, 121, 112, 101, 46, 115, 99, 111, 112, 101, 67, 111, 117, 110, 116, 61, 102,
+117, 110, 99, 116, 105, 111, 110, 40, 41, 123, 10, 105, 102, 40, 116, 104, 105,
+115, 46, 114, 101, 115, 111, 108, 118, 101, 100, 40, 41, 41, 123, 10, 105, 102,
+40, 40, 116, 104, 105, 115, 46, 115, 99, 111, 112, 101, 67, 111, 117, 110, 116,
+95, 61, 61, 61, 40, 118, 111, 105, 100, 32, 48, 41, 41, 41, 123, 10, 116, 104,
+105, 115, 46, 115, 99, 111, 112, 101, 67, 111, 117, 110, 116, 95, 61, 37, 71,
+101, 116, 70, 117, 110, 99, 116, 105, 111, 110, 83, 99, 111, 112, 101, 67, 111,
+117, 110, 116, 40, 116, 104, 105, 115, 46, 118, 97, 108, 117, 101, 40, 41, 41,
+59, 10, 125, 10, 114, 101, 116, 117, 114, 110, 32, 116, 104, 105, 115, 46, 115,
+99, 111, 112, 101, 67, 111, 117, 110, 116, 95, 59, 10, 125, 101, 108, 115, 101,
+123, 10, 114, 101, 116, 117, 114, 110, 32, 48, 59, 10, 125, 10, 125, 59, 10, 70,
+117, 110, 99, 116, 105, 111, 110, 77, 105, 114, 114, 111, 114, 46, 112, 114,
+111, 116, 111, 116, 121, 112, 101, 46, 115, 99, 111, 112, 101, 61, 102, 117,
+110, 99, 116, 105, 111, 110, 40, 71, 41, 123, 10, 105, 102, 40, 116, 104, 105,
+115, 46, 114, 101, 115, 111, 108, 118, 101, 100, 40, 41, 41, 123, 10, 114, 101,
+116, 117, 114, 110, 32, 110, 101, 119, 32, 83, 99, 111, 112, 101, 77, 105, 114,
+114, 111, 114, 40, 40, 118, 111, 105, 100, 32, 48, 41, 44, 116, 104, 105, 115,
+44, 40, 118, 111, 105, 100, 32, 48, 41, 44, 71, 41, 59, 10, 125, 10, 125, 59,
+10, 70, 117, 110, 99, 116, 105, 111, 110, 77, 105, 114, 114, 111, 114, 46, 112,
+114, 111, 116, 111, 116, 121, 112, 101, 46, 116, 111, 84, 101, 120, 116, 61,
+102, 117, 110, 99, 116, 105, 111, 110, 40, 41, 123, 10, 114, 101, 116, 117, 114,
+110, 32, 116, 104, 105, 115, 46, 115, 111, 117, 114, 99, 101, 40, 41, 59, 10,
+125, 59, 10, 70, 117, 110, 99, 116, 105, 111, 110, 77, 105, 114, 114, 111, 114,
+46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 99, 111, 110, 116, 101,
+120, 116, 61, 102, 117, 110, 99, 116, 105, 111, 110, 40, 41, 123, 10, 105, 102,
+40, 116, 104, 105, 115, 46, 114, 101, 115, 111, 108, 118, 101, 100, 40, 41, 41,
+123, 10, 105, 102, 40, 33, 116, 104, 105, 115, 46, 95, 99, 111, 110, 116, 101,
+120, 116, 41, 10, 116, 104, 105, 115, 46, 95, 99, 111, 110, 116, 101, 120, 116,
+61, 110, 101, 119, 32, 67, 111, 110, 116, 101, 120, 116, 77, 105, 114, 114, 111,
+114, 40, 37, 70, 117, 110, 99, 116, 105, 111, 110, 71, 101, 116, 67, 111, 110,
+116, 101, 120, 116, 68, 97, 116, 97, 40, 116, 104, 105, 115, 46, 118, 97, 108,
+117, 101, 95, 41, 41, 59, 10, 114, 101, 116, 117, 114, 110, 32, 116, 104, 105,
+115, 46, 95, 99, 111, 110, 116, 101, 120, 116, 59, 10, 125, 10, 125, 59, 10,
+102, 117, 110, 99, 116, 105, 111, 110, 32, 85, 110, 114, 101, 115, 111, 108,
+118, 101, 100, 70, 117, 110, 99, 116, 105, 111, 110, 77, 105, 114, 114, 111,
+114, 40, 107, 41, 123, 10, 37, 95, 67, 97, 108, 108, 40, 86, 97, 108, 117, 101,
+77, 105, 114, 114, 111, 114, 44, 116, 104, 105, 115, 44, 106, 46, 70, 85, 78,
+67, 84, 73, 79, 78, 95, 84, 89, 80, 69, 44, 107, 41, 59, 10, 116, 104, 105, 115,
+46, 112, 114, 111, 112, 101, 114, 116, 121, 67, 111, 117, 110, 116, 95, 61, 48,
+59, 10, 116, 104, 105, 115, 46, 101, 108, 101, 109, 101, 110, 116, 67, 111, 117,
+110, 116, 95, 61, 48, 59, 10, 116, 104, 105, 115, 46, 114, 101, 115, 111, 108,
+118, 101, 100, 95, 61, 102, 97, 108, 115, 101, 59, 10, 125, 10, 105, 110, 104,
+101, 114, 105, 116, 115, 40, 85, 110, 114, 101, 115, 111, 108, 118, 101, 100,
+70, 117, 110, 99, 116, 105, 111, 110, 77, 105, 114, 114, 111, 114, 44, 70, 117,
+110, 99, 116, 105, 111, 110, 77, 105, 114, 114, 111, 114, 41, 59, 10, 85, 110,
+114, 101, 115, 111, 108, 118, 101, 100, 70, 117, 110, 99, 116, 105, 111, 110,
+77, 105, 114, 114, 111, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101,
+46, 99, 108, 97, 115, 115, 78, 97, 109, 101, 61, 102, 117, 110, 99, 116, 105,
+111, 110, 40, 41, 123, 10, 114, 101, 116, 117, 114, 110, 39, 70, 117, 110, 99,
+116, 105, 111, 110, 39, 59, 10, 125, 59, 10, 85, 110, 114, 101, 115, 111, 108,
+118, 101, 100, 70, 117, 110, 99, 116, 105, 111, 110, 77, 105, 114, 114, 111,
+114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 99, 111, 110, 115,
+116, 114, 117, 99, 116, 111, 114, 70, 117, 110, 99, 116, 105, 111, 110, 61, 102,
+117, 110, 99, 116, 105, 111, 110, 40, 41, 123, 10, 114, 101, 116, 117, 114, 110,
+32, 71, 101, 116, 85, 110, 100, 101, 102, 105, 110, 101, 100, 77, 105, 114, 114,
+111, 114, 40, 41, 59, 10, 125, 59, 10, 85, 110, 114, 101, 115, 111, 108, 118,
+101, 100, 70, 117, 110, 99, 116, 105, 111, 110, 77, 105, 114, 114, 111, 114, 46,
+112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 112, 114, 111, 116, 111, 116,
+121, 112, 101, 79, 98, 106, 101, 99, 116, 61, 102, 117, 110, 99, 116, 105, 111,
+110, 40, 41, 123, 10, 114, 101, 116, 117, 114, 110, 32, 71, 101, 116, 85, 110,
+100, 101, 102, 105, 110, 101, 100, 77, 105, 114, 114, 111, 114, 40, 41, 59, 10,
+125, 59, 10, 85, 110, 114, 101, 115, 111, 108, 118, 101, 100, 70, 117, 110, 99,
+116, 105, 111, 110, 77, 105, 114, 114, 111, 114, 46, 112, 114, 111, 116, 111,
+116, 121, 112, 101, 46, 112, 114, 111, 116, 111, 79, 98, 106, 101, 99, 116, 61,
+102, 117, 110, 99, 116, 105, 111, 110, 40, 41, 123, 10, 114, 101, 116, 117, 114,
+110, 32, 71, 101, 116, 85, 110, 100, 101, 102, 105, 110, 101, 100, 77, 105, 114,
+114, 111, 114, 40, 41, 59, 10, 125, 59, 10, 85, 110, 114, 101, 115, 111, 108,
+118, 101, 100, 70, 117, 110, 99, 116, 105, 111, 110, 77, 105, 114, 114, 111,
+114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 110, 97, 109, 101, 61,
+102, 117, 110, 99, 116, 105, 111, 110, 40, 41, 123, 10, 114, 101, 116, 117, 114,
+110, 32, 116, 104, 105, 115, 46, 118, 97, 108, 117, 101, 95, 59, 10, 125, 59,
+10, 85, 110, 114, 101, 115, 111, 108, 118, 101, 100, 70, 117, 110, 99, 116, 105,
+111, 110, 77, 105, 114, 114, 111, 114, 46, 112, 114, 111, 116, 111, 116, 121,
+112, 101, 46, 100, 101, 98, 117, 103, 78, 97, 109, 101, 61, 102, 117, 110, 99,
+116, 105, 111, 110, 40, 41, 123, 10, 114, 101, 116, 117, 114, 110, 32, 116, 104,
+105, 115, 46, 118, 97, 108, 117, 101, 95, 59, 10, 125, 59, 10, 85, 110, 114,
+101, 115, 111, 108, 118, 101, 100, 70, 117, 110, 99, 116, 105, 111, 110, 77,
+105, 114, 114, 111, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46,
+105, 110, 102, 101, 114, 114, 101, 100, 78, 97, 109, 101, 61, 102, 117, 110, 99,
+116, 105, 111, 110, 40, 41, 123, 10, 114, 101, 116, 117, 114, 110, 40, 118, 111,
+105, 100, 32, 48, 41, 59, 10, 125, 59, 10, 85, 110, 114, 101, 115, 111, 108,
+118, 101, 100, 70, 117, 110, 99, 116, 105, 111, 110, 77, 105, 114, 114, 111,
+114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 112, 114, 111, 112,
+101, 114, 116, 121, 78, 97, 109, 101, 115, 61, 102, 117, 110, 99, 116, 105, 111,
+110, 40, 72, 44, 73, 41, 123, 10, 114, 101, 116, 117, 114, 110, 91, 93, 59, 10,
+125, 59, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 65, 114, 114, 97, 121,
+77, 105, 114, 114, 111, 114, 40, 107, 41, 123, 10, 37, 95, 67, 97, 108, 108, 40,
+79, 98, 106, 101, 99, 116, 77, 105, 114, 114, 111, 114, 44, 116, 104, 105, 115,
+44, 107, 41, 59, 10, 125, 10, 105, 110, 104, 101, 114, 105, 116, 115, 40, 65,
+114, 114, 97, 121, 77, 105, 114, 114, 111, 114, 44, 79, 98, 106, 101, 99, 116,
+77, 105, 114, 114, 111, 114, 41, 59, 10, 65, 114, 114, 97, 121, 77, 105, 114,
+114, 111, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 108, 101,
+110, 103, 116, 104, 61, 102, 117, 110, 99, 116, 105, 111, 110, 40, 41, 123, 10,
+114, 101, 116, 117, 114, 110, 32, 116, 104, 105, 115, 46, 118, 97, 108, 117,
+101, 95, 46, 108, 101, 110, 103, 116, 104, 59, 10, 125, 59, 10, 65, 114, 114,
+97, 121, 77, 105, 114, 114, 111, 114, 46, 112, 114, 111, 116, 111, 116, 121,
+112, 101, 46, 105, 110, 100, 101, 120, 101, 100, 80, 114, 111, 112, 101, 114,
+116, 105, 101, 115, 70, 114, 111, 109, 82, 97, 110, 103, 101, 61, 102, 117, 110,
+99, 116, 105, 111, 110, 40, 111, 112, 116, 95, 102, 114, 111, 109, 95, 105, 110,
+100, 101, 120, 44, 10, 111, 112, 116, 95, 116, 111, 95, 105, 110, 100, 101, 120,
+41, 123, 10, 118, 97, 114, 32, 74, 61, 111, 112, 116, 95, 102, 114, 111, 109,
+95, 105, 110, 100, 101, 120, 124, 124, 48, 59, 10, 118, 97, 114, 32, 75, 61,
+111, 112, 116, 95, 116, 111, 95, 105, 110, 100, 101, 120, 124, 124, 116, 104,
+105, 115, 46, 108, 101, 110, 103, 116, 104, 40, 41, 45, 49, 59, 10, 105, 102,
+40, 74, 62, 75, 41, 114, 101, 116, 117, 114, 110, 32, 110, 101, 119, 32, 99, 40,
+41, 59, 10, 118, 97, 114, 32, 76, 61, 110, 101, 119, 32, 99, 40, 75, 45, 74, 43,
+49, 41, 59, 10, 102, 111, 114, 40, 118, 97, 114, 32, 121, 61, 74, 59, 121, 60,
+61, 75, 59, 121, 43, 43, 41, 123, 10, 118, 97, 114, 32, 65, 61, 37, 68, 101, 98,
+117, 103, 71, 101, 116, 80, 114, 111, 112, 101, 114, 116, 121, 68, 101, 116, 97,
+105, 108, 115, 40, 116, 104, 105, 115, 46, 118, 97, 108, 117, 101, 95, 44, 40,
+37, 95, 84, 111, 83, 116, 114, 105, 110, 103, 40, 121, 41, 41, 41, 59, 10, 118,
+97, 114, 32, 107, 59, 10, 105, 102, 40, 65, 41, 123, 10, 107, 61, 110, 101, 119,
+32, 80, 114, 111, 112, 101, 114, 116, 121, 77, 105, 114, 114, 111, 114, 40, 116,
+104, 105, 115, 44, 121, 44, 65, 41, 59, 10, 125, 101, 108, 115, 101, 123, 10,
+107, 61, 71, 101, 116, 85, 110, 100, 101, 102, 105, 110, 101, 100, 77, 105, 114,
+114, 111, 114, 40, 41, 59, 10, 125, 10, 76, 91, 121, 45, 74, 93, 61, 107, 59,
+10, 125, 10, 114, 101, 116, 117, 114, 110, 32, 76, 59, 10, 125, 59, 10, 102,
+117, 110, 99, 116, 105, 111, 110, 32, 68, 97, 116, 101, 77, 105, 114, 114, 111,
+114, 40, 107, 41, 123, 10, 37, 95, 67, 97, 108, 108, 40, 79, 98, 106, 101, 99,
+116, 77, 105, 114, 114, 111, 114, 44, 116, 104, 105, 115, 44, 107, 41, 59, 10,
+125, 10, 105, 110, 104, 101, 114, 105, 116, 115, 40, 68, 97, 116, 101, 77, 105,
+114, 114, 111, 114, 44, 79, 98, 106, 101, 99, 116, 77, 105, 114, 114, 111, 114,
+41, 59, 10, 68, 97, 116, 101, 77, 105, 114, 114, 111, 114, 46, 112, 114, 111,
+116, 111, 116, 121, 112, 101, 46, 116, 111, 84, 101, 120, 116, 61, 102, 117,
+110, 99, 116, 105, 111, 110, 40, 41, 123, 10, 118, 97, 114, 32, 77, 61, 101, 40,
+116, 104, 105, 115, 46, 118, 97, 108, 117, 101, 95, 41, 59, 10, 114, 101, 116,
+117, 114, 110, 32, 77, 46, 115, 117, 98, 115, 116, 114, 105, 110, 103, 40, 49,
+44, 77, 46, 108, 101, 110, 103, 116, 104, 45, 49, 41, 59, 10, 125, 59, 10, 102,
+117, 110, 99, 116, 105, 111, 110, 32, 82, 101, 103, 69, 120, 112, 77, 105, 114,
+114, 111, 114, 40, 107, 41, 123, 10, 37, 95, 67, 97, 108, 108, 40, 79, 98, 106,
+101, 99, 116, 77, 105, 114, 114, 111, 114, 44, 116, 104, 105, 115, 44, 107, 44,
+106, 46, 82, 69, 71, 69, 88, 80, 95, 84, 89, 80, 69, 41, 59, 10, 125, 10, 105,
+110, 104, 101, 114, 105, 116, 115, 40, 82, 101, 103, 69, 120, 112, 77, 105, 114,
+114, 111, 114, 44, 79, 98, 106, 101, 99, 116, 77, 105, 114, 114, 111, 114, 41,
+59, 10, 82, 101, 103, 69, 120, 112, 77, 105, 114, 114, 111, 114, 46, 112, 114,
+111, 116, 111, 116, 121, 112, 101, 46, 115, 111, 117, 114, 99, 101, 61, 102,
+117, 110, 99, 116, 105, 111, 110, 40, 41, 123, 10, 114, 101, 116, 117, 114, 110,
+32, 116, 104, 105, 115, 46, 118, 97, 108, 117, 101, 95, 46, 115, 111, 117, 114,
+99, 101, 59, 10, 125, 59, 10, 82, 101, 103, 69, 120, 112, 77, 105, 114, 114,
+111, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 103, 108, 111,
+98, 97, 108, 61, 102, 117, 110, 99, 116, 105, 111, 110, 40, 41, 123, 10, 114,
+101, 116, 117, 114, 110, 32, 116, 104, 105, 115, 46, 118, 97, 108, 117, 101, 95,
+46, 103, 108, 111, 98, 97, 108, 59, 10, 125, 59, 10, 82, 101, 103, 69, 120, 112,
+77, 105, 114, 114, 111, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101,
+46, 105, 103, 110, 111, 114, 101, 67, 97, 115, 101, 61, 102, 117, 110, 99, 116,
+105, 111, 110, 40, 41, 123, 10, 114, 101, 116, 117, 114, 110, 32, 116, 104, 105,
+115, 46, 118, 97, 108, 117, 101, 95, 46, 105, 103, 110, 111, 114, 101, 67, 97,
+115, 101, 59, 10, 125, 59, 10, 82, 101, 103, 69, 120, 112, 77, 105, 114, 114,
+111, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 109, 117, 108,
+116, 105, 108, 105, 110, 101, 61, 102, 117, 110, 99, 116, 105, 111, 110, 40, 41,
+123, 10, 114, 101, 116, 117, 114, 110, 32, 116, 104, 105, 115, 46, 118, 97, 108,
+117, 101, 95, 46, 109, 117, 108, 116, 105, 108, 105, 110, 101, 59, 10, 125, 59,
+10, 82, 101, 103, 69, 120, 112, 77, 105, 114, 114, 111, 114, 46, 112, 114, 111,
+116, 111, 116, 121, 112, 101, 46, 115, 116, 105, 99, 107, 121, 61, 102, 117,
+110, 99, 116, 105, 111, 110, 40, 41, 123, 10, 114, 101, 116, 117, 114, 110, 32,
+116, 104, 105, 115, 46, 118, 97, 108, 117, 101, 95, 46, 115, 116, 105, 99, 107,
+121, 59, 10, 125, 59, 10, 82, 101, 103, 69, 120, 112, 77, 105, 114, 114, 111,
+114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 117, 110, 105, 99,
+111, 100, 101, 61, 102, 117, 110, 99, 116, 105, 111, 110, 40, 41, 123, 10, 114,
+101, 116, 117, 114, 110, 32, 116, 104, 105, 115, 46, 118, 97, 108, 117, 101, 95,
+46, 117, 110, 105, 99, 111, 100, 101, 59, 10, 125, 59, 10, 82, 101, 103, 69,
+120, 112, 77, 105, 114, 114, 111, 114, 46, 112, 114, 111, 116, 111, 116, 121,
+112, 101, 46, 116, 111, 84, 101, 120, 116, 61, 102, 117, 110, 99, 116, 105, 111,
+110, 40, 41, 123, 10, 114, 101, 116, 117, 114, 110, 34, 47, 34, 43, 116, 104,
+105, 115, 46, 115, 111, 117, 114, 99, 101, 40, 41, 43, 34, 47, 34, 59, 10, 125,
+59, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 69, 114, 114, 111, 114, 77,
+105, 114, 114, 111, 114, 40, 107, 41, 123, 10, 37, 95, 67, 97, 108, 108, 40, 79,
+98, 106, 101, 99, 116, 77, 105, 114, 114, 111, 114, 44, 116, 104, 105, 115, 44,
+107, 44, 106, 46, 69, 82, 82, 79, 82, 95, 84, 89, 80, 69, 41, 59, 10, 125, 10,
+105, 110, 104, 101, 114, 105, 116, 115, 40, 69, 114, 114, 111, 114, 77, 105,
+114, 114, 111, 114, 44, 79, 98, 106, 101, 99, 116, 77, 105, 114, 114, 111, 114,
+41, 59, 10, 69, 114, 114, 111, 114, 77, 105, 114, 114, 111, 114, 46, 112, 114,
+111, 116, 111, 116, 121, 112, 101, 46, 109, 101, 115, 115, 97, 103, 101, 61,
+102, 117, 110, 99, 116, 105, 111, 110, 40, 41, 123, 10, 114, 101, 116, 117, 114,
+110, 32, 116, 104, 105, 115, 46, 118, 97, 108, 117, 101, 95, 46, 109, 101, 115,
+115, 97, 103, 101, 59, 10, 125, 59, 10, 69, 114, 114, 111, 114, 77, 105, 114,
+114, 111, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 116, 111,
+84, 101, 120, 116, 61, 102, 117, 110, 99, 116, 105, 111, 110, 40, 41, 123, 10,
+118, 97, 114, 32, 78, 59, 10, 116, 114, 121, 123, 10, 78, 61, 37, 69, 114, 114,
+111, 114, 84, 111, 83, 116, 114, 105, 110, 103, 40, 116, 104, 105, 115, 46, 118,
+97, 108, 117, 101, 95, 41, 59, 10, 125, 99, 97, 116, 99, 104, 40, 101, 41, 123,
+10, 78, 61, 39, 35, 60, 69, 114, 114, 111, 114, 62, 39, 59, 10, 125, 10, 114,
+101, 116, 117, 114, 110, 32, 78, 59, 10, 125, 59, 10, 102, 117, 110, 99, 116,
+105, 111, 110, 32, 80, 114, 111, 109, 105, 115, 101, 77, 105, 114, 114, 111,
+114, 40, 107, 41, 123, 10, 37, 95, 67, 97, 108, 108, 40, 79, 98, 106, 101, 99,
+116, 77, 105, 114, 114, 111, 114, 44, 116, 104, 105, 115, 44, 107, 44, 106, 46,
+80, 82, 79, 77, 73, 83, 69, 95, 84, 89, 80, 69, 41, 59, 10, 125, 10, 105, 110,
+104, 101, 114, 105, 116, 115, 40, 80, 114, 111, 109, 105, 115, 101, 77, 105,
+114, 114, 111, 114, 44, 79, 98, 106, 101, 99, 116, 77, 105, 114, 114, 111, 114,
+41, 59, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 80, 114, 111, 109, 105,
+115, 101, 71, 101, 116, 83, 116, 97, 116, 117, 115, 95, 40, 107, 41, 123, 10,
+118, 97, 114, 32, 79, 61, 37, 80, 114, 111, 109, 105, 115, 101, 83, 116, 97,
+116, 117, 115, 40, 107, 41, 59, 10, 105, 102, 40, 79, 61, 61, 48, 41, 114, 101,
+116, 117, 114, 110, 34, 112, 101, 110, 100, 105, 110, 103, 34, 59, 10, 105, 102,
+40, 79, 61, 61, 49, 41, 114, 101, 116, 117, 114, 110, 34, 114, 101, 115, 111,
+108, 118, 101, 100, 34, 59, 10, 114, 101, 116, 117, 114, 110, 34, 114, 101, 106,
+101, 99, 116, 101, 100, 34, 59, 10, 125, 10, 102, 117, 110, 99, 116, 105, 111,
+110, 32, 80, 114, 111, 109, 105, 115, 101, 71, 101, 116, 86, 97, 108, 117, 101,
+95, 40, 107, 41, 123, 10, 114, 101, 116, 117, 114, 110, 32, 37, 80, 114, 111,
+109, 105, 115, 101, 82, 101, 115, 117, 108, 116, 40, 107, 41, 59, 10, 125, 10,
+80, 114, 111, 109, 105, 115, 101, 77, 105, 114, 114, 111, 114, 46, 112, 114,
+111, 116, 111, 116, 121, 112, 101, 46, 115, 116, 97, 116, 117, 115, 61, 102,
+117, 110, 99, 116, 105, 111, 110, 40, 41, 123, 10, 114, 101, 116, 117, 114, 110,
+32, 80, 114, 111, 109, 105, 115, 101, 71, 101, 116, 83, 116, 97, 116, 117, 115,
+95, 40, 116, 104, 105, 115, 46, 118, 97, 108, 117, 101, 95, 41, 59, 10, 125, 59,
+10, 80, 114, 111, 109, 105, 115, 101, 77, 105, 114, 114, 111, 114, 46, 112, 114,
+111, 116, 111, 116, 121, 112, 101, 46, 112, 114, 111, 109, 105, 115, 101, 86,
+97, 108, 117, 101, 61, 102, 117, 110, 99, 116, 105, 111, 110, 40, 41, 123, 10,
+114, 101, 116, 117, 114, 110, 32, 77, 97, 107, 101, 77, 105, 114, 114, 111, 114,
+40, 80, 114, 111, 109, 105, 115, 101, 71, 101, 116, 86, 97, 108, 117, 101, 95,
+40, 116, 104, 105, 115, 46, 118, 97, 108, 117, 101, 95, 41, 41, 59, 10, 125, 59,
+10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 77, 97, 112, 77, 105, 114, 114,
+111, 114, 40, 107, 41, 123, 10, 37, 95, 67, 97, 108, 108, 40, 79, 98, 106, 101,
+99, 116, 77, 105, 114, 114, 111, 114, 44, 116, 104, 105, 115, 44, 107, 44, 106,
+46, 77, 65, 80, 95, 84, 89, 80, 69, 41, 59, 10, 125, 10, 105, 110, 104, 101,
+114, 105, 116, 115, 40, 77, 97, 112, 77, 105, 114, 114, 111, 114, 44, 79, 98,
+106, 101, 99, 116, 77, 105, 114, 114, 111, 114, 41, 59, 10, 77, 97, 112, 77,
+105, 114, 114, 111, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46,
+101, 110, 116, 114, 105, 101, 115, 61, 102, 117, 110, 99, 116, 105, 111, 110,
+40, 80, 41, 123, 10, 118, 97, 114, 32, 68, 61, 91, 93, 59, 10, 105, 102, 40, 40,
+37, 95, 73, 115, 74, 83, 87, 101, 97, 107, 77, 97, 112, 40, 116, 104, 105, 115,
+46, 118, 97, 108, 117, 101, 95, 41, 41, 41, 123, 10, 118, 97, 114, 32, 81, 61,
+37, 71, 101, 116, 87, 101, 97, 107, 77, 97, 112, 69, 110, 116, 114, 105, 101,
+115, 40, 116, 104, 105, 115, 46, 118, 97, 108, 117, 101, 95, 44, 80, 124, 124,
+48, 41, 59, 10, 102, 111, 114, 40, 118, 97, 114, 32, 121, 61, 48, 59, 121, 60,
+81, 46, 108, 101, 110, 103, 116, 104, 59, 121, 43, 61, 50, 41, 123, 10, 68, 46,
+112, 117, 115, 104, 40, 123, 10, 107, 101, 121, 58, 81, 91, 121, 93, 44, 10,
+118, 97, 108, 117, 101, 58, 81, 91, 121, 43, 49, 93, 10, 125, 41, 59, 10, 125,
+10, 114, 101, 116, 117, 114, 110, 32, 68, 59, 10, 125, 10, 118, 97, 114, 32, 82,
+61, 37, 95, 67, 97, 108, 108, 40, 102, 44, 116, 104, 105, 115, 46, 118, 97, 108,
+117, 101, 95, 41, 59, 10, 118, 97, 114, 32, 83, 59, 10, 119, 104, 105, 108, 101,
+40, 40, 33, 80, 124, 124, 68, 46, 108, 101, 110, 103, 116, 104, 60, 80, 41, 38,
+38, 10, 33, 40, 83, 61, 82, 46, 110, 101, 120, 116, 40, 41, 41, 46, 100, 111,
+110, 101, 41, 123, 10, 68, 46, 112, 117, 115, 104, 40, 123, 10, 107, 101, 121,
+58, 83, 46, 118, 97, 108, 117, 101, 91, 48, 93, 44, 10, 118, 97, 108, 117, 101,
+58, 83, 46, 118, 97, 108, 117, 101, 91, 49, 93, 10, 125, 41, 59, 10, 125, 10,
+114, 101, 116, 117, 114, 110, 32, 68, 59, 10, 125, 59, 10, 102, 117, 110, 99,
+116, 105, 111, 110, 32, 83, 101, 116, 77, 105, 114, 114, 111, 114, 40, 107, 41,
+123, 10, 37, 95, 67, 97, 108, 108, 40, 79, 98, 106, 101, 99, 116, 77, 105, 114,
+114, 111, 114, 44, 116, 104, 105, 115, 44, 107, 44, 106, 46, 83, 69, 84, 95, 84,
+89, 80, 69, 41, 59, 10, 125, 10, 105, 110, 104, 101, 114, 105, 116, 115, 40, 83,
+101, 116, 77, 105, 114, 114, 111, 114, 44, 79, 98, 106, 101, 99, 116, 77, 105,
+114, 114, 111, 114, 41, 59, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 73,
+116, 101, 114, 97, 116, 111, 114, 71, 101, 116, 86, 97, 108, 117, 101, 115, 95,
+40, 82, 44, 84, 44, 80, 41, 123, 10, 118, 97, 114, 32, 68, 61, 91, 93, 59, 10,
+118, 97, 114, 32, 83, 59, 10, 119, 104, 105, 108, 101, 40, 40, 33, 80, 124, 124,
+68, 46, 108, 101, 110, 103, 116, 104, 60, 80, 41, 38, 38, 10, 33, 40, 83, 61,
+37, 95, 67, 97, 108, 108, 40, 84, 44, 82, 41, 41, 46, 100, 111, 110, 101, 41,
+123, 10, 68, 46, 112, 117, 115, 104, 40, 83, 46, 118, 97, 108, 117, 101, 41, 59,
+10, 125, 10, 114, 101, 116, 117, 114, 110, 32, 68, 59, 10, 125, 10, 83, 101,
+116, 77, 105, 114, 114, 111, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112,
+101, 46, 118, 97, 108, 117, 101, 115, 61, 102, 117, 110, 99, 116, 105, 111, 110,
+40, 80, 41, 123, 10, 105, 102, 40, 40, 37, 95, 73, 115, 74, 83, 87, 101, 97,
+107, 83, 101, 116, 40, 116, 104, 105, 115, 46, 118, 97, 108, 117, 101, 95, 41,
+41, 41, 123, 10, 114, 101, 116, 117, 114, 110, 32, 37, 71, 101, 116, 87, 101,
+97, 107, 83, 101, 116, 86, 97, 108, 117, 101, 115, 40, 116, 104, 105, 115, 46,
+118, 97, 108, 117, 101, 95, 44, 80, 124, 124, 48, 41, 59, 10, 125, 10, 118, 97,
+114, 32, 82, 61, 37, 95, 67, 97, 108, 108, 40, 105, 44, 116, 104, 105, 115, 46,
+118, 97, 108, 117, 101, 95, 41, 59, 10, 114, 101, 116, 117, 114, 110, 32, 73,
+116, 101, 114, 97, 116, 111, 114, 71, 101, 116, 86, 97, 108, 117, 101, 115, 95,
+40, 82, 44, 104, 44, 80, 41, 59, 10, 125, 59, 10, 102, 117, 110, 99, 116, 105,
+111, 110, 32, 73, 116, 101, 114, 97, 116, 111, 114, 77, 105, 114, 114, 111, 114,
+40, 107, 41, 123, 10, 37, 95, 67, 97, 108, 108, 40, 79, 98, 106, 101, 99, 116,
+77, 105, 114, 114, 111, 114, 44, 116, 104, 105, 115, 44, 107, 44, 106, 46, 73,
+84, 69, 82, 65, 84, 79, 82, 95, 84, 89, 80, 69, 41, 59, 10, 125, 10, 105, 110,
+104, 101, 114, 105, 116, 115, 40, 73, 116, 101, 114, 97, 116, 111, 114, 77, 105,
+114, 114, 111, 114, 44, 79, 98, 106, 101, 99, 116, 77, 105, 114, 114, 111, 114,
+41, 59, 10, 73, 116, 101, 114, 97, 116, 111, 114, 77, 105, 114, 114, 111, 114,
+46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 112, 114, 101, 118, 105,
+101, 119, 61, 102, 117, 110, 99, 116, 105, 111, 110, 40, 80, 41, 123, 10, 105,
+102, 40, 40, 37, 73, 115, 74, 83, 77, 97, 112, 73, 116, 101, 114, 97, 116, 111,
+114, 40, 116, 104, 105, 115, 46, 118, 97, 108, 117, 101, 95, 41, 41, 10, 41,
+123, 10, 114, 101, 116, 117, 114, 110, 32, 73, 116, 101, 114, 97, 116, 111, 114,
+71, 101, 116, 86, 97, 108, 117, 101, 115, 95, 40, 37, 77, 97, 112, 73, 116, 101,
+114, 97, 116, 111, 114, 67, 108, 111, 110, 101, 40, 116, 104, 105, 115, 46, 118,
+97, 108, 117, 101, 95, 41, 44, 10, 103, 44, 10, 80, 41, 59, 10, 125, 101, 108,
+115, 101, 32, 105, 102, 40, 40, 37, 73, 115, 74, 83, 83, 101, 116, 73, 116, 101,
+114, 97, 116, 111, 114, 40, 116, 104, 105, 115, 46, 118, 97, 108, 117, 101, 95,
+41, 41, 10, 41, 123, 10, 114, 101, 116, 117, 114, 110, 32, 73, 116, 101, 114,
+97, 116, 111, 114, 71, 101, 116, 86, 97, 108, 117, 101, 115, 95, 40, 37, 83,
+101, 116, 73, 116, 101, 114, 97, 116, 111, 114, 67, 108, 111, 110, 101, 40, 116,
+104, 105, 115, 46, 118, 97, 108, 117, 101, 95, 41, 44, 10, 104, 44, 10, 80, 41,
+59, 10, 125, 10, 125, 59, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 71,
+101, 110, 101, 114, 97, 116, 111, 114, 77, 105, 114, 114, 111, 114, 40, 107, 41,
+123, 10, 37, 95, 67, 97, 108, 108, 40, 79, 98, 106, 101, 99, 116, 77, 105, 114,
+114, 111, 114, 44, 116, 104, 105, 115, 44, 107, 44, 106, 46, 71, 69, 78, 69, 82,
+65, 84, 79, 82, 95, 84, 89, 80, 69, 41, 59, 10, 125, 10, 105, 110, 104, 101,
+114, 105, 116, 115, 40, 71, 101, 110, 101, 114, 97, 116, 111, 114, 77, 105, 114,
+114, 111, 114, 44, 79, 98, 106, 101, 99, 116, 77, 105, 114, 114, 111, 114, 41,
+59, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 71, 101, 110, 101, 114, 97,
+116, 111, 114, 71, 101, 116, 83, 116, 97, 116, 117, 115, 95, 40, 107, 41, 123,
+10, 118, 97, 114, 32, 85, 61, 37, 71, 101, 110, 101, 114, 97, 116, 111, 114, 71,
+101, 116, 67, 111, 110, 116, 105, 110, 117, 97, 116, 105, 111, 110, 40, 107, 41,
+59, 10, 105, 102, 40, 85, 60, 45, 49, 41, 114, 101, 116, 117, 114, 110, 34, 114,
+117, 110, 110, 105, 110, 103, 34, 59, 10, 105, 102, 40, 85, 61, 61, 45, 49, 41,
+114, 101, 116, 117, 114, 110, 34, 99, 108, 111, 115, 101, 100, 34, 59, 10, 114,
+101, 116, 117, 114, 110, 34, 115, 117, 115, 112, 101, 110, 100, 101, 100, 34,
+59, 10, 125, 10, 71, 101, 110, 101, 114, 97, 116, 111, 114, 77, 105, 114, 114,
+111, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 115, 116, 97,
+116, 117, 115, 61, 102, 117, 110, 99, 116, 105, 111, 110, 40, 41, 123, 10, 114,
+101, 116, 117, 114, 110, 32, 71, 101, 110, 101, 114, 97, 116, 111, 114, 71, 101,
+116, 83, 116, 97, 116, 117, 115, 95, 40, 116, 104, 105, 115, 46, 118, 97, 108,
+117, 101, 95, 41, 59, 10, 125, 59, 10, 71, 101, 110, 101, 114, 97, 116, 111,
+114, 77, 105, 114, 114, 111, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112,
+101, 46, 115, 111, 117, 114, 99, 101, 80, 111, 115, 105, 116, 105, 111, 110, 95,
+61, 102, 117, 110, 99, 116, 105, 111, 110, 40, 41, 123, 10, 114, 101, 116, 117,
+114, 110, 32, 37, 71, 101, 110, 101, 114, 97, 116, 111, 114, 71, 101, 116, 83,
+111, 117, 114, 99, 101, 80, 111, 115, 105, 116, 105, 111, 110, 40, 116, 104,
+105, 115, 46, 118, 97, 108, 117, 101, 95, 41, 59, 10, 125, 59, 10, 71, 101, 110,
+101, 114, 97, 116, 111, 114, 77, 105, 114, 114, 111, 114, 46, 112, 114, 111,
+116, 111, 116, 121, 112, 101, 46, 115, 111, 117, 114, 99, 101, 76, 111, 99, 97,
+116, 105, 111, 110, 61, 102, 117, 110, 99, 116, 105, 111, 110, 40, 41, 123, 10,
+118, 97, 114, 32, 86, 61, 116, 104, 105, 115, 46, 115, 111, 117, 114, 99, 101,
+80, 111, 115, 105, 116, 105, 111, 110, 95, 40, 41, 59, 10, 105, 102, 40, 33, 40,
+86, 61, 61, 61, 40, 118, 111, 105, 100, 32, 48, 41, 41, 41, 123, 10, 118, 97,
+114, 32, 69, 61, 116, 104, 105, 115, 46, 102, 117, 110, 99, 40, 41, 46, 115, 99,
+114, 105, 112, 116, 40, 41, 59, 10, 105, 102, 40, 69, 41, 123, 10, 114, 101,
+116, 117, 114, 110, 32, 69, 46, 108, 111, 99, 97, 116, 105, 111, 110, 70, 114,
+111, 109, 80, 111, 115, 105, 116, 105, 111, 110, 40, 86, 44, 116, 114, 117, 101,
+41, 59, 10, 125, 10, 125, 10, 125, 59, 10, 71, 101, 110, 101, 114, 97, 116, 111,
+114, 77, 105, 114, 114, 111, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112,
+101, 46, 102, 117, 110, 99, 61, 102, 117, 110, 99, 116, 105, 111, 110, 40, 41,
+123, 10, 105, 102, 40, 33, 116, 104, 105, 115, 46, 102, 117, 110, 99, 95, 41,
+123, 10, 116, 104, 105, 115, 46, 102, 117, 110, 99, 95, 61, 77, 97, 107, 101,
+77, 105, 114, 114, 111, 114, 40, 37, 71, 101, 110, 101, 114, 97, 116, 111, 114,
+71, 101, 116, 70, 117, 110, 99, 116, 105, 111, 110, 40, 116, 104, 105, 115, 46,
+118, 97, 108, 117, 101, 95, 41, 41, 59, 10, 125, 10, 114, 101, 116, 117, 114,
+110, 32, 116, 104, 105, 115, 46, 102, 117, 110, 99, 95, 59, 10, 125, 59, 10, 71,
+101, 110, 101, 114, 97, 116, 111, 114, 77, 105, 114, 114, 111, 114, 46, 112,
+114, 111, 116, 111, 116, 121, 112, 101, 46, 114, 101, 99, 101, 105, 118, 101,
+114, 61, 102, 117, 110, 99, 116, 105, 111, 110, 40, 41, 123, 10, 105, 102, 40,
+33, 116, 104, 105, 115, 46, 114, 101, 99, 101, 105, 118, 101, 114, 95, 41, 123,
+10, 116, 104, 105, 115, 46, 114, 101, 99, 101, 105, 118, 101, 114, 95, 61, 77,
+97, 107, 101, 77, 105, 114, 114, 111, 114, 40, 37, 71, 101, 110, 101, 114, 97,
+116, 111, 114, 71, 101, 116, 82, 101, 99, 101, 105, 118, 101, 114, 40, 116, 104,
+105, 115, 46, 118, 97, 108, 117, 101, 95, 41, 41, 59, 10, 125, 10, 114, 101,
+116, 117, 114, 110, 32, 116, 104, 105, 115, 46, 114, 101, 99, 101, 105, 118,
+101, 114, 95, 59, 10, 125, 59, 10, 71, 101, 110, 101, 114, 97, 116, 111, 114,
+77, 105, 114, 114, 111, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101,
+46, 115, 99, 111, 112, 101, 67, 111, 117, 110, 116, 61, 102, 117, 110, 99, 116,
+105, 111, 110, 40, 41, 123, 10, 114, 101, 116, 117, 114, 110, 32, 37, 71, 101,
+116, 71, 101, 110, 101, 114, 97, 116, 111, 114, 83, 99, 111, 112, 101, 67, 111,
+117, 110, 116, 40, 116, 104, 105, 115, 46, 118, 97, 108, 117, 101, 40, 41, 41,
+59, 10, 125, 59, 10, 71, 101, 110, 101, 114, 97, 116, 111, 114, 77, 105, 114,
+114, 111, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 115, 99,
+111, 112, 101, 61, 102, 117, 110, 99, 116, 105, 111, 110, 40, 71, 41, 123, 10,
+114, 101, 116, 117, 114, 110, 32, 110, 101, 119, 32, 83, 99, 111, 112, 101, 77,
+105, 114, 114, 111, 114, 40, 40, 118, 111, 105, 100, 32, 48, 41, 44, 40, 118,
+111, 105, 100, 32, 48, 41, 44, 116, 104, 105, 115, 44, 71, 41, 59, 10, 125, 59,
+10, 71, 101, 110, 101, 114, 97, 116, 111, 114, 77, 105, 114, 114, 111, 114, 46,
+112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 97, 108, 108, 83, 99, 111, 112,
+101, 115, 61, 102, 117, 110, 99, 116, 105, 111, 110, 40, 41, 123, 10, 118, 97,
+114, 32, 87, 61, 91, 93, 59, 10, 102, 111, 114, 40, 108, 101, 116, 32, 121, 61,
+48, 59, 121, 60, 116, 104, 105, 115, 46, 115, 99, 111, 112, 101, 67, 111, 117,
+110, 116, 40, 41, 59, 121, 43, 43, 41, 123, 10, 87, 46, 112, 117, 115, 104, 40,
+116, 104, 105, 115, 46, 115, 99, 111, 112, 101, 40, 121, 41, 41, 59, 10, 125,
+10, 114, 101, 116, 117, 114, 110, 32, 87, 59, 10, 125, 59, 10, 102, 117, 110,
+99, 116, 105, 111, 110, 32, 80, 114, 111, 112, 101, 114, 116, 121, 77, 105, 114,
+114, 111, 114, 40, 108, 44, 122, 44, 65, 41, 123, 10, 37, 95, 67, 97, 108, 108,
+40, 77, 105, 114, 114, 111, 114, 44, 116, 104, 105, 115, 44, 106, 46, 80, 82,
+79, 80, 69, 82, 84, 89, 95, 84, 89, 80, 69, 41, 59, 10, 116, 104, 105, 115, 46,
+109, 105, 114, 114, 111, 114, 95, 61, 108, 59, 10, 116, 104, 105, 115, 46, 110,
+97, 109, 101, 95, 61, 122, 59, 10, 116, 104, 105, 115, 46, 118, 97, 108, 117,
+101, 95, 61, 65, 91, 48, 93, 59, 10, 116, 104, 105, 115, 46, 100, 101, 116, 97,
+105, 108, 115, 95, 61, 65, 91, 49, 93, 59, 10, 116, 104, 105, 115, 46, 105, 115,
+95, 105, 110, 116, 101, 114, 99, 101, 112, 116, 111, 114, 95, 61, 65, 91, 50,
+93, 59, 10, 105, 102, 40, 65, 46, 108, 101, 110, 103, 116, 104, 62, 51, 41, 123,
+10, 116, 104, 105, 115, 46, 101, 120, 99, 101, 112, 116, 105, 111, 110, 95, 61,
+65, 91, 51, 93, 59, 10, 116, 104, 105, 115, 46, 103, 101, 116, 116, 101, 114,
+95, 61, 65, 91, 52, 93, 59, 10, 116, 104, 105, 115, 46, 115, 101, 116, 116, 101,
+114, 95, 61, 65, 91, 53, 93, 59, 10, 125, 10, 125, 10, 105, 110, 104, 101, 114,
+105, 116, 115, 40, 80, 114, 111, 112, 101, 114, 116, 121, 77, 105, 114, 114,
+111, 114, 44, 77, 105, 114, 114, 111, 114, 41, 59, 10, 80, 114, 111, 112, 101,
+114, 116, 121, 77, 105, 114, 114, 111, 114, 46, 112, 114, 111, 116, 111, 116,
+121, 112, 101, 46, 105, 115, 82, 101, 97, 100, 79, 110, 108, 121, 61, 102, 117,
+110, 99, 116, 105, 111, 110, 40, 41, 123, 10, 114, 101, 116, 117, 114, 110, 40,
+116, 104, 105, 115, 46, 97, 116, 116, 114, 105, 98, 117, 116, 101, 115, 40, 41,
+38, 114, 46, 82, 101, 97, 100, 79, 110, 108, 121, 41, 33, 61, 48, 59, 10, 125,
+59, 10, 80, 114, 111, 112, 101, 114, 116, 121, 77, 105, 114, 114, 111, 114, 46,
+112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 105, 115, 69, 110, 117, 109,
+61, 102, 117, 110, 99, 116, 105, 111, 110, 40, 41, 123, 10, 114, 101, 116, 117,
+114, 110, 40, 116, 104, 105, 115, 46, 97, 116, 116, 114, 105, 98, 117, 116, 101,
+115, 40, 41, 38, 114, 46, 68, 111, 110, 116, 69, 110, 117, 109, 41, 61, 61, 48,
+59, 10, 125, 59, 10, 80, 114, 111, 112, 101, 114, 116, 121, 77, 105, 114, 114,
+111, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 99, 97, 110, 68,
+101, 108, 101, 116, 101, 61, 102, 117, 110, 99, 116, 105, 111, 110, 40, 41, 123,
+10, 114, 101, 116, 117, 114, 110, 40, 116, 104, 105, 115, 46, 97, 116, 116, 114,
+105, 98, 117, 116, 101, 115, 40, 41, 38, 114, 46, 68, 111, 110, 116, 68, 101,
+108, 101, 116, 101, 41, 61, 61, 48, 59, 10, 125, 59, 10, 80, 114, 111, 112, 101,
+114, 116, 121, 77, 105, 114, 114, 111, 114, 46, 112, 114, 111, 116, 111, 116,
+121, 112, 101, 46, 110, 97, 109, 101, 61, 102, 117, 110, 99, 116, 105, 111, 110,
+40, 41, 123, 10, 114, 101, 116, 117, 114, 110, 32, 116, 104, 105, 115, 46, 110,
+97, 109, 101, 95, 59, 10, 125, 59, 10, 80, 114, 111, 112, 101, 114, 116, 121,
+77, 105, 114, 114, 111, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101,
+46, 116, 111, 84, 101, 120, 116, 61, 102, 117, 110, 99, 116, 105, 111, 110, 40,
+41, 123, 10, 105, 102, 40, 40, 116, 121, 112, 101, 111, 102, 40, 116, 104, 105,
+115, 46, 110, 97, 109, 101, 95, 41, 61, 61, 61, 39, 115, 121, 109, 98, 111, 108,
+39, 41, 41, 114, 101, 116, 117, 114, 110, 32, 37, 83, 121, 109, 98, 111, 108,
+68, 101, 115, 99, 114, 105, 112, 116, 105, 118, 101, 83, 116, 114, 105, 110,
+103, 40, 116, 104, 105, 115, 46, 110, 97, 109, 101, 95, 41, 59, 10, 114, 101,
+116, 117, 114, 110, 32, 116, 104, 105, 115, 46, 110, 97, 109, 101, 95, 59, 10,
+125, 59, 10, 80, 114, 111, 112, 101, 114, 116, 121, 77, 105, 114, 114, 111, 114,
+46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 105, 115, 73, 110, 100,
+101, 120, 101, 100, 61, 102, 117, 110, 99, 116, 105, 111, 110, 40, 41, 123, 10,
+102, 111, 114, 40, 118, 97, 114, 32, 121, 61, 48, 59, 121, 60, 116, 104, 105,
+115, 46, 110, 97, 109, 101, 95, 46, 108, 101, 110, 103, 116, 104, 59, 121, 43,
+43, 41, 123, 10, 105, 102, 40, 116, 104, 105, 115, 46, 110, 97, 109, 101, 95,
+91, 121, 93, 60, 39, 48, 39, 124, 124, 39, 57, 39, 60, 116, 104, 105, 115, 46,
+110, 97, 109, 101, 95, 91, 121, 93, 41, 123, 10, 114, 101, 116, 117, 114, 110,
+32, 102, 97, 108, 115, 101, 59, 10, 125, 10, 125, 10, 114, 101, 116, 117, 114,
+110, 32, 116, 114, 117, 101, 59, 10, 125, 59, 10, 80, 114, 111, 112, 101, 114,
+116, 121, 77, 105, 114, 114, 111, 114, 46, 112, 114, 111, 116, 111, 116, 121,
+112, 101, 46, 118, 97, 108, 117, 101, 61, 102, 117, 110, 99, 116, 105, 111, 110,
+40, 41, 123, 10, 114, 101, 116, 117, 114, 110, 32, 77, 97, 107, 101, 77, 105,
+114, 114, 111, 114, 40, 116, 104, 105, 115, 46, 118, 97, 108, 117, 101, 95, 44,
+102, 97, 108, 115, 101, 41, 59, 10, 125, 59, 10, 80, 114, 111, 112, 101, 114,
+116, 121, 77, 105, 114, 114, 111, 114, 46, 112, 114, 111, 116, 111, 116, 121,
+112, 101, 46, 105, 115, 69, 120, 99, 101, 112, 116, 105, 111, 110, 61, 102, 117,
+110, 99, 116, 105, 111, 110, 40, 41, 123, 10, 114, 101, 116, 117, 114, 110, 32,
+116, 104, 105, 115, 46, 101, 120, 99, 101, 112, 116, 105, 111, 110, 95, 63, 116,
+114, 117, 101, 58, 102, 97, 108, 115, 101, 59, 10, 125, 59, 10, 80, 114, 111,
+112, 101, 114, 116, 121, 77, 105, 114, 114, 111, 114, 46, 112, 114, 111, 116,
+111, 116, 121, 112, 101, 46, 97, 116, 116, 114, 105, 98, 117, 116, 101, 115, 61,
+102, 117, 110, 99, 116, 105, 111, 110, 40, 41, 123, 10, 114, 101, 116, 117, 114,
+110, 32, 37, 68, 101, 98, 117, 103, 80, 114, 111, 112, 101, 114, 116, 121, 65,
+116, 116, 114, 105, 98, 117, 116, 101, 115, 70, 114, 111, 109, 68, 101, 116, 97,
+105, 108, 115, 40, 116, 104, 105, 115, 46, 100, 101, 116, 97, 105, 108, 115, 95,
+41, 59, 10, 125, 59, 10, 80, 114, 111, 112, 101, 114, 116, 121, 77, 105, 114,
+114, 111, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 112, 114,
+111, 112, 101, 114, 116, 121, 84, 121, 112, 101, 61, 102, 117, 110, 99, 116,
+105, 111, 110, 40, 41, 123, 10, 114, 101, 116, 117, 114, 110, 32, 37, 68, 101,
+98, 117, 103, 80, 114, 111, 112, 101, 114, 116, 121, 75, 105, 110, 100, 70, 114,
+111, 109, 68, 101, 116, 97, 105, 108, 115, 40, 116, 104, 105, 115, 46, 100, 101,
+116, 97, 105, 108, 115, 95, 41, 59, 10, 125, 59, 10, 80, 114, 111, 112, 101,
+114, 116, 121, 77, 105, 114, 114, 111, 114, 46, 112, 114, 111, 116, 111, 116,
+121, 112, 101, 46, 104, 97, 115, 71, 101, 116, 116, 101, 114, 61, 102, 117, 110,
+99, 116, 105, 111, 110, 40, 41, 123, 10, 114, 101, 116, 117, 114, 110, 32, 116,
+104, 105, 115, 46, 103, 101, 116, 116, 101, 114, 95, 63, 116, 114, 117, 101, 58,
+102, 97, 108, 115, 101, 59, 10, 125, 59, 10, 80, 114, 111, 112, 101, 114, 116,
+121, 77, 105, 114, 114, 111, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112,
+101, 46, 104, 97, 115, 83, 101, 116, 116, 101, 114, 61, 102, 117, 110, 99, 116,
+105, 111, 110, 40, 41, 123, 10, 114, 101, 116, 117, 114, 110, 32, 116, 104, 105,
+115, 46, 115, 101, 116, 116, 101, 114, 95, 63, 116, 114, 117, 101, 58, 102, 97,
+108, 115, 101, 59, 10, 125, 59, 10, 80, 114, 111, 112, 101, 114, 116, 121, 77,
+105, 114, 114, 111, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46,
+103, 101, 116, 116, 101, 114, 61, 102, 117, 110, 99, 116, 105, 111, 110, 40, 41,
+123, 10, 105, 102, 40, 116, 104, 105, 115, 46, 104, 97, 115, 71, 101, 116, 116,
+101, 114, 40, 41, 41, 123, 10, 114, 101, 116, 117, 114, 110, 32, 77, 97, 107,
+101, 77, 105, 114, 114, 111, 114, 40, 116, 104, 105, 115, 46, 103, 101, 116,
+116, 101, 114, 95, 41, 59, 10, 125, 101, 108, 115, 101, 123, 10, 114, 101, 116,
+117, 114, 110, 32, 71, 101, 116, 85, 110, 100, 101, 102, 105, 110, 101, 100, 77,
+105, 114, 114, 111, 114, 40, 41, 59, 10, 125, 10, 125, 59, 10, 80, 114, 111,
+112, 101, 114, 116, 121, 77, 105, 114, 114, 111, 114, 46, 112, 114, 111, 116,
+111, 116, 121, 112, 101, 46, 115, 101, 116, 116, 101, 114, 61, 102, 117, 110,
+99, 116, 105, 111, 110, 40, 41, 123, 10, 105, 102, 40, 116, 104, 105, 115, 46,
+104, 97, 115, 83, 101, 116, 116, 101, 114, 40, 41, 41, 123, 10, 114, 101, 116,
+117, 114, 110, 32, 77, 97, 107, 101, 77, 105, 114, 114, 111, 114, 40, 116, 104,
+105, 115, 46, 115, 101, 116, 116, 101, 114, 95, 41, 59, 10, 125, 101, 108, 115,
+101, 123, 10, 114, 101, 116, 117, 114, 110, 32, 71, 101, 116, 85, 110, 100, 101,
+102, 105, 110, 101, 100, 77, 105, 114, 114, 111, 114, 40, 41, 59, 10, 125, 10,
+125, 59, 10, 80, 114, 111, 112, 101, 114, 116, 121, 77, 105, 114, 114, 111, 114,
+46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 105, 115, 78, 97, 116, 105,
+118, 101, 61, 102, 117, 110, 99, 116, 105, 111, 110, 40, 41, 123, 10, 114, 101,
+116, 117, 114, 110, 32, 116, 104, 105, 115, 46, 105, 115, 95, 105, 110, 116,
+101, 114, 99, 101, 112, 116, 111, 114, 95, 124, 124, 10, 40, 40, 116, 104, 105,
+115, 46, 112, 114, 111, 112, 101, 114, 116, 121, 84, 121, 112, 101, 40, 41, 61,
+61, 113, 46, 65, 99, 99, 101, 115, 115, 111, 114, 41, 38, 38, 10, 33, 116, 104,
+105, 115, 46, 104, 97, 115, 71, 101, 116, 116, 101, 114, 40, 41, 38, 38, 33,
+116, 104, 105, 115, 46, 104, 97, 115, 83, 101, 116, 116, 101, 114, 40, 41, 41,
+59, 10, 125, 59, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 73, 110, 116,
+101, 114, 110, 97, 108, 80, 114, 111, 112, 101, 114, 116, 121, 77, 105, 114,
+114, 111, 114, 40, 122, 44, 107, 41, 123, 10, 37, 95, 67, 97, 108, 108, 40, 77,
+105, 114, 114, 111, 114, 44, 116, 104, 105, 115, 44, 106, 46, 73, 78, 84, 69,
+82, 78, 65, 76, 95, 80, 82, 79, 80, 69, 82, 84, 89, 95, 84, 89, 80, 69, 41, 59,
+10, 116, 104, 105, 115, 46, 110, 97, 109, 101, 95, 61, 122, 59, 10, 116, 104,
+105, 115, 46, 118, 97, 108, 117, 101, 95, 61, 107, 59, 10, 125, 10, 105, 110,
+104, 101, 114, 105, 116, 115, 40, 73, 110, 116, 101, 114, 110, 97, 108, 80, 114,
+111, 112, 101, 114, 116, 121, 77, 105, 114, 114, 111, 114, 44, 77, 105, 114,
+114, 111, 114, 41, 59, 10, 73, 110, 116, 101, 114, 110, 97, 108, 80, 114, 111,
+112, 101, 114, 116, 121, 77, 105, 114, 114, 111, 114, 46, 112, 114, 111, 116,
+111, 116, 121, 112, 101, 46, 110, 97, 109, 101, 61, 102, 117, 110, 99, 116, 105,
+111, 110, 40, 41, 123, 10, 114, 101, 116, 117, 114, 110, 32, 116, 104, 105, 115,
+46, 110, 97, 109, 101, 95, 59, 10, 125, 59, 10, 73, 110, 116, 101, 114, 110, 97,
+108, 80, 114, 111, 112, 101, 114, 116, 121, 77, 105, 114, 114, 111, 114, 46,
+112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 118, 97, 108, 117, 101, 61,
+102, 117, 110, 99, 116, 105, 111, 110, 40, 41, 123, 10, 114, 101, 116, 117, 114,
+110, 32, 77, 97, 107, 101, 77, 105, 114, 114, 111, 114, 40, 116, 104, 105, 115,
+46, 118, 97, 108, 117, 101, 95, 44, 102, 97, 108, 115, 101, 41, 59, 10, 125, 59,
+10, 118, 97, 114, 32, 88, 61, 48, 59, 10, 118, 97, 114, 32, 89, 61, 49, 59, 10,
+118, 97, 114, 32, 90, 61, 50, 59, 10, 118, 97, 114, 32, 97, 97, 61, 51, 59, 10,
+118, 97, 114, 32, 97, 98, 61, 52, 59, 10, 118, 97, 114, 32, 97, 99, 61, 53, 59,
+10, 118, 97, 114, 32, 97, 100, 61, 54, 59, 10, 118, 97, 114, 32, 97, 101, 61,
+55, 59, 10, 118, 97, 114, 32, 97, 102, 61, 56, 59, 10, 118, 97, 114, 32, 97,
+103, 61, 57, 59, 10, 118, 97, 114, 32, 97, 104, 61, 49, 48, 59, 10, 118, 97,
+114, 32, 97, 105, 61, 48, 59, 10, 118, 97, 114, 32, 97, 106, 61, 49, 59, 10,
+118, 97, 114, 32, 97, 107, 61, 50, 59, 10, 118, 97, 114, 32, 97, 108, 61, 49,
+60, 60, 48, 59, 10, 118, 97, 114, 32, 97, 109, 61, 49, 60, 60, 49, 59, 10, 118,
+97, 114, 32, 97, 110, 61, 55, 60, 60, 50, 59, 10, 102, 117, 110, 99, 116, 105,
+111, 110, 32, 70, 114, 97, 109, 101, 68, 101, 116, 97, 105, 108, 115, 40, 97,
+111, 44, 71, 41, 123, 10, 116, 104, 105, 115, 46, 98, 114, 101, 97, 107, 95,
+105, 100, 95, 61, 97, 111, 59, 10, 116, 104, 105, 115, 46, 100, 101, 116, 97,
+105, 108, 115, 95, 61, 37, 71, 101, 116, 70, 114, 97, 109, 101, 68, 101, 116,
+97, 105, 108, 115, 40, 97, 111, 44, 71, 41, 59, 10, 125, 10, 70, 114, 97, 109,
+101, 68, 101, 116, 97, 105, 108, 115, 46, 112, 114, 111, 116, 111, 116, 121,
+112, 101, 46, 102, 114, 97, 109, 101, 73, 100, 61, 102, 117, 110, 99, 116, 105,
+111, 110, 40, 41, 123, 10, 37, 67, 104, 101, 99, 107, 69, 120, 101, 99, 117,
+116, 105, 111, 110, 83, 116, 97, 116, 101, 40, 116, 104, 105, 115, 46, 98, 114,
+101, 97, 107, 95, 105, 100, 95, 41, 59, 10, 114, 101, 116, 117, 114, 110, 32,
+116, 104, 105, 115, 46, 100, 101, 116, 97, 105, 108, 115, 95, 91, 88, 93, 59,
+10, 125, 59, 10, 70, 114, 97, 109, 101, 68, 101, 116, 97, 105, 108, 115, 46,
+112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 114, 101, 99, 101, 105, 118,
+101, 114, 61, 102, 117, 110, 99, 116, 105, 111, 110, 40, 41, 123, 10, 37, 67,
+104, 101, 99, 107, 69, 120, 101, 99, 117, 116, 105, 111, 110, 83, 116, 97, 116,
+101, 40, 116, 104, 105, 115, 46, 98, 114, 101, 97, 107, 95, 105, 100, 95, 41,
+59, 10, 114, 101, 116, 117, 114, 110, 32, 116, 104, 105, 115, 46, 100, 101, 116,
+97, 105, 108, 115, 95, 91, 89, 93, 59, 10, 125, 59, 10, 70, 114, 97, 109, 101,
+68, 101, 116, 97, 105, 108, 115, 46, 112, 114, 111, 116, 111, 116, 121, 112,
+101, 46, 102, 117, 110, 99, 61, 102, 117, 110, 99, 116, 105, 111, 110, 40, 41,
+123, 10, 37, 67, 104, 101, 99, 107, 69, 120, 101, 99, 117, 116, 105, 111, 110,
+83, 116, 97, 116, 101, 40, 116, 104, 105, 115, 46, 98, 114, 101, 97, 107, 95,
+105, 100, 95, 41, 59, 10, 114, 101, 116, 117, 114, 110, 32, 116, 104, 105, 115,
+46, 100, 101, 116, 97, 105, 108, 115, 95, 91, 90, 93, 59, 10, 125, 59, 10, 70,
+114, 97, 109, 101, 68, 101, 116, 97, 105, 108, 115, 46, 112, 114, 111, 116, 111,
+116, 121, 112, 101, 46, 115, 99, 114, 105, 112, 116, 61, 102, 117, 110, 99, 116,
+105, 111, 110, 40, 41, 123, 10, 37, 67, 104, 101, 99, 107, 69, 120, 101, 99,
+117, 116, 105, 111, 110, 83, 116, 97, 116, 101, 40, 116, 104, 105, 115, 46, 98,
+114, 101, 97, 107, 95, 105, 100, 95, 41, 59, 10, 114, 101, 116, 117, 114, 110,
+32, 116, 104, 105, 115, 46, 100, 101, 116, 97, 105, 108, 115, 95, 91, 97, 97,
+93, 59, 10, 125, 59, 10, 70, 114, 97, 109, 101, 68, 101, 116, 97, 105, 108, 115,
+46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 105, 115, 67, 111, 110,
+115, 116, 114, 117, 99, 116, 67, 97, 108, 108, 61, 102, 117, 110, 99, 116, 105,
+111, 110, 40, 41, 123, 10, 37, 67, 104, 101, 99, 107, 69, 120, 101, 99, 117,
+116, 105, 111, 110, 83, 116, 97, 116, 101, 40, 116, 104, 105, 115, 46, 98, 114,
+101, 97, 107, 95, 105, 100, 95, 41, 59, 10, 114, 101, 116, 117, 114, 110, 32,
+116, 104, 105, 115, 46, 100, 101, 116, 97, 105, 108, 115, 95, 91, 97, 101, 93,
+59, 10, 125, 59, 10, 70, 114, 97, 109, 101, 68, 101, 116, 97, 105, 108, 115, 46,
+112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 105, 115, 65, 116, 82, 101,
+116, 117, 114, 110, 61, 102, 117, 110, 99, 116, 105, 111, 110, 40, 41, 123, 10,
+37, 67, 104, 101, 99, 107, 69, 120, 101, 99, 117, 116, 105, 111, 110, 83, 116,
+97, 116, 101, 40, 116, 104, 105, 115, 46, 98, 114, 101, 97, 107, 95, 105, 100,
+95, 41, 59, 10, 114, 101, 116, 117, 114, 110, 32, 116, 104, 105, 115, 46, 100,
+101, 116, 97, 105, 108, 115, 95, 91, 97, 102, 93, 59, 10, 125, 59, 10, 70, 114,
+97, 109, 101, 68, 101, 116, 97, 105, 108, 115, 46, 112, 114, 111, 116, 111, 116,
+121, 112, 101, 46, 105, 115, 68, 101, 98, 117, 103, 103, 101, 114, 70, 114, 97,
+109, 101, 61, 102, 117, 110, 99, 116, 105, 111, 110, 40, 41, 123, 10, 37, 67,
+104, 101, 99, 107, 69, 120, 101, 99, 117, 116, 105, 111, 110, 83, 116, 97, 116,
+101, 40, 116, 104, 105, 115, 46, 98, 114, 101, 97, 107, 95, 105, 100, 95, 41,
+59, 10, 118, 97, 114, 32, 97, 112, 61, 97, 108, 59, 10, 114, 101, 116, 117, 114,
+110, 40, 116, 104, 105, 115, 46, 100, 101, 116, 97, 105, 108, 115, 95, 91, 97,
+103, 93, 38, 97, 112, 41, 61, 61, 97, 112, 59, 10, 125, 59, 10, 70, 114, 97,
+109, 101, 68, 101, 116, 97, 105, 108, 115, 46, 112, 114, 111, 116, 111, 116,
+121, 112, 101, 46, 105, 115, 79, 112, 116, 105, 109, 105, 122, 101, 100, 70,
+114, 97, 109, 101, 61, 102, 117, 110, 99, 116, 105, 111, 110, 40, 41, 123, 10,
+37, 67, 104, 101, 99, 107, 69, 120, 101, 99, 117, 116, 105, 111, 110, 83, 116,
+97, 116, 101, 40, 116, 104, 105, 115, 46, 98, 114, 101, 97, 107, 95, 105, 100,
+95, 41, 59, 10, 118, 97, 114, 32, 97, 112, 61, 97, 109, 59, 10, 114, 101, 116,
+117, 114, 110, 40, 116, 104, 105, 115, 46, 100, 101, 116, 97, 105, 108, 115, 95,
+91, 97, 103, 93, 38, 97, 112, 41, 61, 61, 97, 112, 59, 10, 125, 59, 10, 70, 114,
+97, 109, 101, 68, 101, 116, 97, 105, 108, 115, 46, 112, 114, 111, 116, 111, 116,
+121, 112, 101, 46, 105, 115, 73, 110, 108, 105, 110, 101, 100, 70, 114, 97, 109,
+101, 61, 102, 117, 110, 99, 116, 105, 111, 110, 40, 41, 123, 10, 114, 101, 116,
+117, 114, 110, 32, 116, 104, 105, 115, 46, 105, 110, 108, 105, 110, 101, 100,
+70, 114, 97, 109, 101, 73, 110, 100, 101, 120, 40, 41, 62, 48, 59, 10, 125, 59,
+10, 70, 114, 97, 109, 101, 68, 101, 116, 97, 105, 108, 115, 46, 112, 114, 111,
+116, 111, 116, 121, 112, 101, 46, 105, 110, 108, 105, 110, 101, 100, 70, 114,
+97, 109, 101, 73, 110, 100, 101, 120, 61, 102, 117, 110, 99, 116, 105, 111, 110,
+40, 41, 123, 10, 37, 67, 104, 101, 99, 107, 69, 120, 101, 99, 117, 116, 105,
+111, 110, 83, 116, 97, 116, 101, 40, 116, 104, 105, 115, 46, 98, 114, 101, 97,
+107, 95, 105, 100, 95, 41, 59, 10, 118, 97, 114, 32, 97, 112, 61, 97, 110, 59,
+10, 114, 101, 116, 117, 114, 110, 40, 116, 104, 105, 115, 46, 100, 101, 116, 97,
+105, 108, 115, 95, 91, 97, 103, 93, 38, 97, 112, 41, 62, 62, 50, 59, 10, 125,
+59, 10, 70, 114, 97, 109, 101, 68, 101, 116, 97, 105, 108, 115, 46, 112, 114,
+111, 116, 111, 116, 121, 112, 101, 46, 97, 114, 103, 117, 109, 101, 110, 116,
+67, 111, 117, 110, 116, 61, 102, 117, 110, 99, 116, 105, 111, 110, 40, 41, 123,
+10, 37, 67, 104, 101, 99, 107, 69, 120, 101, 99, 117, 116, 105, 111, 110, 83,
+116, 97, 116, 101, 40, 116, 104, 105, 115, 46, 98, 114, 101, 97, 107, 95, 105,
+100, 95, 41, 59, 10, 114, 101, 116, 117, 114, 110, 32, 116, 104, 105, 115, 46,
+100, 101, 116, 97, 105, 108, 115, 95, 91, 97, 98, 93, 59, 10, 125, 59, 10, 70,
+114, 97, 109, 101, 68, 101, 116, 97, 105, 108, 115, 46, 112, 114, 111, 116, 111,
+116, 121, 112, 101, 46, 97, 114, 103, 117, 109, 101, 110, 116, 78, 97, 109, 101,
+61, 102, 117, 110, 99, 116, 105, 111, 110, 40, 71, 41, 123, 10, 37, 67, 104,
+101, 99, 107, 69, 120, 101, 99, 117, 116, 105, 111, 110, 83, 116, 97, 116, 101,
+40, 116, 104, 105, 115, 46, 98, 114, 101, 97, 107, 95, 105, 100, 95, 41, 59, 10,
+105, 102, 40, 71, 62, 61, 48, 38, 38, 71, 60, 116, 104, 105, 115, 46, 97, 114,
+103, 117, 109, 101, 110, 116, 67, 111, 117, 110, 116, 40, 41, 41, 123, 10, 114,
+101, 116, 117, 114, 110, 32, 116, 104, 105, 115, 46, 100, 101, 116, 97, 105,
+108, 115, 95, 91, 97, 104, 43, 10, 71, 42, 97, 107, 43, 10, 97, 105, 93, 59, 10,
+125, 10, 125, 59, 10, 70, 114, 97, 109, 101, 68, 101, 116, 97, 105, 108, 115,
+46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 97, 114, 103, 117, 109,
+101, 110, 116, 86, 97, 108, 117, 101, 61, 102, 117, 110, 99, 116, 105, 111, 110,
+40, 71, 41, 123, 10, 37, 67, 104, 101, 99, 107, 69, 120, 101, 99, 117, 116, 105,
+111, 110, 83, 116, 97, 116, 101, 40, 116, 104, 105, 115, 46, 98, 114, 101, 97,
+107, 95, 105, 100, 95, 41, 59, 10, 105, 102, 40, 71, 62, 61, 48, 38, 38, 71, 60,
+116, 104, 105, 115, 46, 97, 114, 103, 117, 109, 101, 110, 116, 67, 111, 117,
+110, 116, 40, 41, 41, 123, 10, 114, 101, 116, 117, 114, 110, 32, 116, 104, 105,
+115, 46, 100, 101, 116, 97, 105, 108, 115, 95, 91, 97, 104, 43, 10, 71, 42, 97,
+107, 43, 10, 97, 106, 93, 59, 10, 125, 10, 125, 59, 10, 70, 114, 97, 109, 101,
+68, 101, 116, 97, 105, 108, 115, 46, 112, 114, 111, 116, 111, 116, 121, 112,
+101, 46, 108, 111, 99, 97, 108, 67, 111, 117, 110, 116, 61, 102, 117, 110, 99,
+116, 105, 111, 110, 40, 41, 123, 10, 37, 67, 104, 101, 99, 107, 69, 120, 101,
+99, 117, 116, 105, 111, 110, 83, 116, 97, 116, 101, 40, 116, 104, 105, 115, 46,
+98, 114, 101, 97, 107, 95, 105, 100, 95, 41, 59, 10, 114, 101, 116, 117, 114,
+110, 32, 116, 104, 105, 115, 46, 100, 101, 116, 97, 105, 108, 115, 95, 91, 97,
+99, 93, 59, 10, 125, 59, 10, 70, 114, 97, 109, 101, 68, 101, 116, 97, 105, 108,
+115, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 115, 111, 117, 114,
+99, 101, 80, 111, 115, 105, 116, 105, 111, 110, 61, 102, 117, 110, 99, 116, 105,
+111, 110, 40, 41, 123, 10, 37, 67, 104, 101, 99, 107, 69, 120, 101, 99, 117,
+116, 105, 111, 110, 83, 116, 97, 116, 101, 40, 116, 104, 105, 115, 46, 98, 114,
+101, 97, 107, 95, 105, 100, 95, 41, 59, 10, 114, 101, 116, 117, 114, 110, 32,
+116, 104, 105, 115, 46, 100, 101, 116, 97, 105, 108, 115, 95, 91, 97, 100, 93,
+59, 10, 125, 59, 10, 70, 114, 97, 109, 101, 68, 101, 116, 97, 105, 108, 115, 46,
+112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 108, 111, 99, 97, 108, 78, 97,
+109, 101, 61, 102, 117, 110, 99, 116, 105, 111, 110, 40, 71, 41, 123, 10, 37,
+67, 104, 101, 99, 107, 69, 120, 101, 99, 117, 116, 105, 111, 110, 83, 116, 97,
+116, 101, 40, 116, 104, 105, 115, 46, 98, 114, 101, 97, 107, 95, 105, 100, 95,
+41, 59, 10, 105, 102, 40, 71, 62, 61, 48, 38, 38, 71, 60, 116, 104, 105, 115,
+46, 108, 111, 99, 97, 108, 67, 111, 117, 110, 116, 40, 41, 41, 123, 10, 118, 97,
+114, 32, 97, 113, 61, 97, 104, 43, 10, 116, 104, 105, 115, 46, 97, 114, 103,
+117, 109, 101, 110, 116, 67, 111, 117, 110, 116, 40, 41, 42, 97, 107, 59, 10,
+114, 101, 116, 117, 114, 110, 32, 116, 104, 105, 115, 46, 100, 101, 116, 97,
+105, 108, 115, 95, 91, 97, 113, 43, 10, 71, 42, 97, 107, 43, 10, 97, 105, 93,
+59, 10, 125, 10, 125, 59, 10, 70, 114, 97, 109, 101, 68, 101, 116, 97, 105, 108,
+115, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 108, 111, 99, 97, 108,
+86, 97, 108, 117, 101, 61, 102, 117, 110, 99, 116, 105, 111, 110, 40, 71, 41,
+123, 10, 37, 67, 104, 101, 99, 107, 69, 120, 101, 99, 117, 116, 105, 111, 110,
+83, 116, 97, 116, 101, 40, 116, 104, 105, 115, 46, 98, 114, 101, 97, 107, 95,
+105, 100, 95, 41, 59, 10, 105, 102, 40, 71, 62, 61, 48, 38, 38, 71, 60, 116,
+104, 105, 115, 46, 108, 111, 99, 97, 108, 67, 111, 117, 110, 116, 40, 41, 41,
+123, 10, 118, 97, 114, 32, 97, 113, 61, 97, 104, 43, 10, 116, 104, 105, 115, 46,
+97, 114, 103, 117, 109, 101, 110, 116, 67, 111, 117, 110, 116, 40, 41, 42, 97,
+107, 59, 10, 114, 101, 116, 117, 114, 110, 32, 116, 104, 105, 115, 46, 100, 101,
+116, 97, 105, 108, 115, 95, 91, 97, 113, 43, 10, 71, 42, 97, 107, 43, 10, 97,
+106, 93, 59, 10, 125, 10, 125, 59, 10, 70, 114, 97, 109, 101, 68, 101, 116, 97,
+105, 108, 115, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 114, 101,
+116, 117, 114, 110, 86, 97, 108, 117, 101, 61, 102, 117, 110, 99, 116, 105, 111,
+110, 40, 41, 123, 10, 37, 67, 104, 101, 99, 107, 69, 120, 101, 99, 117, 116,
+105, 111, 110, 83, 116, 97, 116, 101, 40, 116, 104, 105, 115, 46, 98, 114, 101,
+97, 107, 95, 105, 100, 95, 41, 59, 10, 118, 97, 114, 32, 97, 114, 61, 10, 97,
+104, 43, 10, 40, 116, 104, 105, 115, 46, 97, 114, 103, 117, 109, 101, 110, 116,
+67, 111, 117, 110, 116, 40, 41, 43, 116, 104, 105, 115, 46, 108, 111, 99, 97,
+108, 67, 111, 117, 110, 116, 40, 41, 41, 42, 97, 107, 59, 10, 105, 102, 40, 116,
+104, 105, 115, 46, 100, 101, 116, 97, 105, 108, 115, 95, 91, 97, 102, 93, 41,
+123, 10, 114, 101, 116, 117, 114, 110, 32, 116, 104, 105, 115, 46, 100, 101,
+116, 97, 105, 108, 115, 95, 91, 97, 114, 93, 59, 10, 125, 10, 125, 59, 10, 70,
+114, 97, 109, 101, 68, 101, 116, 97, 105, 108, 115, 46, 112, 114, 111, 116, 111,
+116, 121, 112, 101, 46, 115, 99, 111, 112, 101, 67, 111, 117, 110, 116, 61, 102,
+117, 110, 99, 116, 105, 111, 110, 40, 41, 123, 10, 105, 102, 40, 40, 116, 104,
+105, 115, 46, 115, 99, 111, 112, 101, 67, 111, 117, 110, 116, 95, 61, 61, 61,
+40, 118, 111, 105, 100, 32, 48, 41, 41, 41, 123, 10, 116, 104, 105, 115, 46,
+115, 99, 111, 112, 101, 67, 111, 117, 110, 116, 95, 61, 37, 71, 101, 116, 83,
+99, 111, 112, 101, 67, 111, 117, 110, 116, 40, 116, 104, 105, 115, 46, 98, 114,
+101, 97, 107, 95, 105, 100, 95, 44, 116, 104, 105, 115, 46, 102, 114, 97, 109,
+101, 73, 100, 40, 41, 41, 59, 10, 125, 10, 114, 101, 116, 117, 114, 110, 32,
+116, 104, 105, 115, 46, 115, 99, 111, 112, 101, 67, 111, 117, 110, 116, 95, 59,
+10, 125, 59, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 70, 114, 97, 109,
+101, 77, 105, 114, 114, 111, 114, 40, 97, 111, 44, 71, 41, 123, 10, 37, 95, 67,
+97, 108, 108, 40, 77, 105, 114, 114, 111, 114, 44, 116, 104, 105, 115, 44, 106,
+46, 70, 82, 65, 77, 69, 95, 84, 89, 80, 69, 41, 59, 10, 116, 104, 105, 115, 46,
+98, 114, 101, 97, 107, 95, 105, 100, 95, 61, 97, 111, 59, 10, 116, 104, 105,
+115, 46, 105, 110, 100, 101, 120, 95, 61, 71, 59, 10, 116, 104, 105, 115, 46,
+100, 101, 116, 97, 105, 108, 115, 95, 61, 110, 101, 119, 32, 70, 114, 97, 109,
+101, 68, 101, 116, 97, 105, 108, 115, 40, 97, 111, 44, 71, 41, 59, 10, 125, 10,
+105, 110, 104, 101, 114, 105, 116, 115, 40, 70, 114, 97, 109, 101, 77, 105, 114,
+114, 111, 114, 44, 77, 105, 114, 114, 111, 114, 41, 59, 10, 70, 114, 97, 109,
+101, 77, 105, 114, 114, 111, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112,
+101, 46, 100, 101, 116, 97, 105, 108, 115, 61, 102, 117, 110, 99, 116, 105, 111,
+110, 40, 41, 123, 10, 114, 101, 116, 117, 114, 110, 32, 116, 104, 105, 115, 46,
+100, 101, 116, 97, 105, 108, 115, 95, 59, 10, 125, 59, 10, 70, 114, 97, 109,
+101, 77, 105, 114, 114, 111, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112,
+101, 46, 105, 110, 100, 101, 120, 61, 102, 117, 110, 99, 116, 105, 111, 110, 40,
+41, 123, 10, 114, 101, 116, 117, 114, 110, 32, 116, 104, 105, 115, 46, 105, 110,
+100, 101, 120, 95, 59, 10, 125, 59, 10, 70, 114, 97, 109, 101, 77, 105, 114,
+114, 111, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 102, 117,
+110, 99, 61, 102, 117, 110, 99, 116, 105, 111, 110, 40, 41, 123, 10, 105, 102,
+40, 116, 104, 105, 115, 46, 102, 117, 110, 99, 95, 41, 123, 10, 114, 101, 116,
+117, 114, 110, 32, 116, 104, 105, 115, 46, 102, 117, 110, 99, 95, 59, 10, 125,
+10, 118, 97, 114, 32, 97, 112, 61, 116, 104, 105, 115, 46, 100, 101, 116, 97,
+105, 108, 115, 95, 46, 102, 117, 110, 99, 40, 41, 59, 10, 105, 102, 40, 40, 37,
+73, 115, 70, 117, 110, 99, 116, 105, 111, 110, 40, 97, 112, 41, 41, 41, 123, 10,
+114, 101, 116, 117, 114, 110, 32, 116, 104, 105, 115, 46, 102, 117, 110, 99, 95,
+61, 77, 97, 107, 101, 77, 105, 114, 114, 111, 114, 40, 97, 112, 41, 59, 10, 125,
+101, 108, 115, 101, 123, 10, 114, 101, 116, 117, 114, 110, 32, 110, 101, 119,
+32, 85, 110, 114, 101, 115, 111, 108, 118, 101, 100, 70, 117, 110, 99, 116, 105,
+111, 110, 77, 105, 114, 114, 111, 114, 40, 97, 112, 41, 59, 10, 125, 10, 125,
+59, 10, 70, 114, 97, 109, 101, 77, 105, 114, 114, 111, 114, 46, 112, 114, 111,
+116, 111, 116, 121, 112, 101, 46, 115, 99, 114, 105, 112, 116, 61, 102, 117,
+110, 99, 116, 105, 111, 110, 40, 41, 123, 10, 105, 102, 40, 33, 116, 104, 105,
+115, 46, 115, 99, 114, 105, 112, 116, 95, 41, 123, 10, 116, 104, 105, 115, 46,
+115, 99, 114, 105, 112, 116, 95, 61, 77, 97, 107, 101, 77, 105, 114, 114, 111,
+114, 40, 116, 104, 105, 115, 46, 100, 101, 116, 97, 105, 108, 115, 95, 46, 115,
+99, 114, 105, 112, 116, 40, 41, 41, 59, 10, 125, 10, 114, 101, 116, 117, 114,
+110, 32, 116, 104, 105, 115, 46, 115, 99, 114, 105, 112, 116, 95, 59, 10, 125,
+10, 70, 114, 97, 109, 101, 77, 105, 114, 114, 111, 114, 46, 112, 114, 111, 116,
+111, 116, 121, 112, 101, 46, 114, 101, 99, 101, 105, 118, 101, 114, 61, 102,
+117, 110, 99, 116, 105, 111, 110, 40, 41, 123, 10, 114, 101, 116, 117, 114, 110,
+32, 77, 97, 107, 101, 77, 105, 114, 114, 111, 114, 40, 116, 104, 105, 115, 46,
+100, 101, 116, 97, 105, 108, 115, 95, 46, 114, 101, 99, 101, 105, 118, 101, 114,
+40, 41, 41, 59, 10, 125, 59, 10, 70, 114, 97, 109, 101, 77, 105, 114, 114, 111,
+114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 105, 115, 67, 111,
+110, 115, 116, 114, 117, 99, 116, 67, 97, 108, 108, 61, 102, 117, 110, 99, 116,
+105, 111, 110, 40, 41, 123, 10, 114, 101, 116, 117, 114, 110, 32, 116, 104, 105,
+115, 46, 100, 101, 116, 97, 105, 108, 115, 95, 46, 105, 115, 67, 111, 110, 115,
+116, 114, 117, 99, 116, 67, 97, 108, 108, 40, 41, 59, 10, 125, 59, 10, 70, 114,
+97, 109, 101, 77, 105, 114, 114, 111, 114, 46, 112, 114, 111, 116, 111, 116,
+121, 112, 101, 46, 105, 115, 65, 116, 82, 101, 116, 117, 114, 110, 61, 102, 117,
+110, 99, 116, 105, 111, 110, 40, 41, 123, 10, 114, 101, 116, 117, 114, 110, 32,
+116, 104, 105, 115, 46, 100, 101, 116, 97, 105, 108, 115, 95, 46, 105, 115, 65,
+116, 82, 101, 116, 117, 114, 110, 40, 41, 59, 10, 125, 59, 10, 70, 114, 97, 109,
+101, 77, 105, 114, 114, 111, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112,
+101, 46, 105, 115, 68, 101, 98, 117, 103, 103, 101, 114, 70, 114, 97, 109, 101,
+61, 102, 117, 110, 99, 116, 105, 111, 110, 40, 41, 123, 10, 114, 101, 116, 117,
+114, 110, 32, 116, 104, 105, 115, 46, 100, 101, 116, 97, 105, 108, 115, 95, 46,
+105, 115, 68, 101, 98, 117, 103, 103, 101, 114, 70, 114, 97, 109, 101, 40, 41,
+59, 10, 125, 59, 10, 70, 114, 97, 109, 101, 77, 105, 114, 114, 111, 114, 46,
+112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 105, 115, 79, 112, 116, 105,
+109, 105, 122, 101, 100, 70, 114, 97, 109, 101, 61, 102, 117, 110, 99, 116, 105,
+111, 110, 40, 41, 123, 10, 114, 101, 116, 117, 114, 110, 32, 116, 104, 105, 115,
+46, 100, 101, 116, 97, 105, 108, 115, 95, 46, 105, 115, 79, 112, 116, 105, 109,
+105, 122, 101, 100, 70, 114, 97, 109, 101, 40, 41, 59, 10, 125, 59, 10, 70, 114,
+97, 109, 101, 77, 105, 114, 114, 111, 114, 46, 112, 114, 111, 116, 111, 116,
+121, 112, 101, 46, 105, 115, 73, 110, 108, 105, 110, 101, 100, 70, 114, 97, 109,
+101, 61, 102, 117, 110, 99, 116, 105, 111, 110, 40, 41, 123, 10, 114, 101, 116,
+117, 114, 110, 32, 116, 104, 105, 115, 46, 100, 101, 116, 97, 105, 108, 115, 95,
+46, 105, 115, 73, 110, 108, 105, 110, 101, 100, 70, 114, 97, 109, 101, 40, 41,
+59, 10, 125, 59, 10, 70, 114, 97, 109, 101, 77, 105, 114, 114, 111, 114, 46,
+112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 105, 110, 108, 105, 110, 101,
+100, 70, 114, 97, 109, 101, 73, 110, 100, 101, 120, 61, 102, 117, 110, 99, 116,
+105, 111, 110, 40, 41, 123, 10, 114, 101, 116, 117, 114, 110, 32, 116, 104, 105,
+115, 46, 100, 101, 116, 97, 105, 108, 115, 95, 46, 105, 110, 108, 105, 110, 101,
+100, 70, 114, 97, 109, 101, 73, 110, 100, 101, 120, 40, 41, 59, 10, 125, 59, 10,
+70, 114, 97, 109, 101, 77, 105, 114, 114, 111, 114, 46, 112, 114, 111, 116, 111,
+116, 121, 112, 101, 46, 97, 114, 103, 117, 109, 101, 110, 116, 67, 111, 117,
+110, 116, 61, 102, 117, 110, 99, 116, 105, 111, 110, 40, 41, 123, 10, 114, 101,
+116, 117, 114, 110, 32, 116, 104, 105, 115, 46, 100, 101, 116, 97, 105, 108,
+115, 95, 46, 97, 114, 103, 117, 109, 101, 110, 116, 67, 111, 117, 110, 116, 40,
+41, 59, 10, 125, 59, 10, 70, 114, 97, 109, 101, 77, 105, 114, 114, 111, 114, 46,
+112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 97, 114, 103, 117, 109, 101,
+110, 116, 78, 97, 109, 101, 61, 102, 117, 110, 99, 116, 105, 111, 110, 40, 71,
+41, 123, 10, 114, 101, 116, 117, 114, 110, 32, 116, 104, 105, 115, 46, 100, 101,
+116, 97, 105, 108, 115, 95, 46, 97, 114, 103, 117, 109, 101, 110, 116, 78, 97,
+109, 101, 40, 71, 41, 59, 10, 125, 59, 10, 70, 114, 97, 109, 101, 77, 105, 114,
+114, 111, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 97, 114,
+103, 117, 109, 101, 110, 116, 86, 97, 108, 117, 101, 61, 102, 117, 110, 99, 116,
+105, 111, 110, 40, 71, 41, 123, 10, 114, 101, 116, 117, 114, 110, 32, 77, 97,
+107, 101, 77, 105, 114, 114, 111, 114, 40, 116, 104, 105, 115, 46, 100, 101,
+116, 97, 105, 108, 115, 95, 46, 97, 114, 103, 117, 109, 101, 110, 116, 86, 97,
+108, 117, 101, 40, 71, 41, 41, 59, 10, 125, 59, 10, 70, 114, 97, 109, 101, 77,
+105, 114, 114, 111, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46,
+108, 111, 99, 97, 108, 67, 111, 117, 110, 116, 61, 102, 117, 110, 99, 116, 105,
+111, 110, 40, 41, 123, 10, 114, 101, 116, 117, 114, 110, 32, 116, 104, 105, 115,
+46, 100, 101, 116, 97, 105, 108, 115, 95, 46, 108, 111, 99, 97, 108, 67, 111,
+117, 110, 116, 40, 41, 59, 10, 125, 59, 10, 70, 114, 97, 109, 101, 77, 105, 114,
+114, 111, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 108, 111,
+99, 97, 108, 78, 97, 109, 101, 61, 102, 117, 110, 99, 116, 105, 111, 110, 40,
+71, 41, 123, 10, 114, 101, 116, 117, 114, 110, 32, 116, 104, 105, 115, 46, 100,
+101, 116, 97, 105, 108, 115, 95, 46, 108, 111, 99, 97, 108, 78, 97, 109, 101,
+40, 71, 41, 59, 10, 125, 59, 10, 70, 114, 97, 109, 101, 77, 105, 114, 114, 111,
+114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 108, 111, 99, 97, 108,
+86, 97, 108, 117, 101, 61, 102, 117, 110, 99, 116, 105, 111, 110, 40, 71, 41,
+123, 10, 114, 101, 116, 117, 114, 110, 32, 77, 97, 107, 101, 77, 105, 114, 114,
+111, 114, 40, 116, 104, 105, 115, 46, 100, 101, 116, 97, 105, 108, 115, 95, 46,
+108, 111, 99, 97, 108, 86, 97, 108, 117, 101, 40, 71, 41, 41, 59, 10, 125, 59,
+10, 70, 114, 97, 109, 101, 77, 105, 114, 114, 111, 114, 46, 112, 114, 111, 116,
+111, 116, 121, 112, 101, 46, 114, 101, 116, 117, 114, 110, 86, 97, 108, 117,
+101, 61, 102, 117, 110, 99, 116, 105, 111, 110, 40, 41, 123, 10, 114, 101, 116,
+117, 114, 110, 32, 77, 97, 107, 101, 77, 105, 114, 114, 111, 114, 40, 116, 104,
+105, 115, 46, 100, 101, 116, 97, 105, 108, 115, 95, 46, 114, 101, 116, 117, 114,
+110, 86, 97, 108, 117, 101, 40, 41, 41, 59, 10, 125, 59, 10, 70, 114, 97, 109,
+101, 77, 105, 114, 114, 111, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112,
+101, 46, 115, 111, 117, 114, 99, 101, 80, 111, 115, 105, 116, 105, 111, 110, 61,
+102, 117, 110, 99, 116, 105, 111, 110, 40, 41, 123, 10, 114, 101, 116, 117, 114,
+110, 32, 116, 104, 105, 115, 46, 100, 101, 116, 97, 105, 108, 115, 95, 46, 115,
+111, 117, 114, 99, 101, 80, 111, 115, 105, 116, 105, 111, 110, 40, 41, 59, 10,
+125, 59, 10, 70, 114, 97, 109, 101, 77, 105, 114, 114, 111, 114, 46, 112, 114,
+111, 116, 111, 116, 121, 112, 101, 46, 115, 111, 117, 114, 99, 101, 76, 111, 99,
+97, 116, 105, 111, 110, 61, 102, 117, 110, 99, 116, 105, 111, 110, 40, 41, 123,
+10, 118, 97, 114, 32, 69, 61, 116, 104, 105, 115, 46, 115, 99, 114, 105, 112,
+116, 40, 41, 59, 10, 105, 102, 40, 69, 41, 123, 10, 114, 101, 116, 117, 114,
+110, 32, 69, 46, 108, 111, 99, 97, 116, 105, 111, 110, 70, 114, 111, 109, 80,
+111, 115, 105, 116, 105, 111, 110, 40, 116, 104, 105, 115, 46, 115, 111, 117,
+114, 99, 101, 80, 111, 115, 105, 116, 105, 111, 110, 40, 41, 44, 116, 114, 117,
+101, 41, 59, 10, 125, 10, 125, 59, 10, 70, 114, 97, 109, 101, 77, 105, 114, 114,
+111, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 115, 111, 117,
+114, 99, 101, 76, 105, 110, 101, 61, 102, 117, 110, 99, 116, 105, 111, 110, 40,
+41, 123, 10, 118, 97, 114, 32, 97, 115, 61, 116, 104, 105, 115, 46, 115, 111,
+117, 114, 99, 101, 76, 111, 99, 97, 116, 105, 111, 110, 40, 41, 59, 10, 105,
+102, 40, 97, 115, 41, 123, 10, 114, 101, 116, 117, 114, 110, 32, 97, 115, 46,
+108, 105, 110, 101, 59, 10, 125, 10, 125, 59, 10, 70, 114, 97, 109, 101, 77,
+105, 114, 114, 111, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46,
+115, 111, 117, 114, 99, 101, 67, 111, 108, 117, 109, 110, 61, 102, 117, 110, 99,
+116, 105, 111, 110, 40, 41, 123, 10, 118, 97, 114, 32, 97, 115, 61, 116, 104,
+105, 115, 46, 115, 111, 117, 114, 99, 101, 76, 111, 99, 97, 116, 105, 111, 110,
+40, 41, 59, 10, 105, 102, 40, 97, 115, 41, 123, 10, 114, 101, 116, 117, 114,
+110, 32, 97, 115, 46, 99, 111, 108, 117, 109, 110, 59, 10, 125, 10, 125, 59, 10,
+70, 114, 97, 109, 101, 77, 105, 114, 114, 111, 114, 46, 112, 114, 111, 116, 111,
+116, 121, 112, 101, 46, 115, 111, 117, 114, 99, 101, 76, 105, 110, 101, 84, 101,
+120, 116, 61, 102, 117, 110, 99, 116, 105, 111, 110, 40, 41, 123, 10, 118, 97,
+114, 32, 97, 115, 61, 116, 104, 105, 115, 46, 115, 111, 117, 114, 99, 101, 76,
+111, 99, 97, 116, 105, 111, 110, 40, 41, 59, 10, 105, 102, 40, 97, 115, 41, 123,
+10, 114, 101, 116, 117, 114, 110, 32, 97, 115, 46, 115, 111, 117, 114, 99, 101,
+84, 101, 120, 116, 59, 10, 125, 10, 125, 59, 10, 70, 114, 97, 109, 101, 77, 105,
+114, 114, 111, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 115,
+99, 111, 112, 101, 67, 111, 117, 110, 116, 61, 102, 117, 110, 99, 116, 105, 111,
+110, 40, 41, 123, 10, 114, 101, 116, 117, 114, 110, 32, 116, 104, 105, 115, 46,
+100, 101, 116, 97, 105, 108, 115, 95, 46, 115, 99, 111, 112, 101, 67, 111, 117,
+110, 116, 40, 41, 59, 10, 125, 59, 10, 70, 114, 97, 109, 101, 77, 105, 114, 114,
+111, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 115, 99, 111,
+112, 101, 61, 102, 117, 110, 99, 116, 105, 111, 110, 40, 71, 41, 123, 10, 114,
+101, 116, 117, 114, 110, 32, 110, 101, 119, 32, 83, 99, 111, 112, 101, 77, 105,
+114, 114, 111, 114, 40, 116, 104, 105, 115, 44, 40, 118, 111, 105, 100, 32, 48,
+41, 44, 40, 118, 111, 105, 100, 32, 48, 41, 44, 71, 41, 59, 10, 125, 59, 10, 70,
+114, 97, 109, 101, 77, 105, 114, 114, 111, 114, 46, 112, 114, 111, 116, 111,
+116, 121, 112, 101, 46, 97, 108, 108, 83, 99, 111, 112, 101, 115, 61, 102, 117,
+110, 99, 116, 105, 111, 110, 40, 97, 116, 41, 123, 10, 118, 97, 114, 32, 97,
+117, 61, 37, 71, 101, 116, 65, 108, 108, 83, 99, 111, 112, 101, 115, 68, 101,
+116, 97, 105, 108, 115, 40, 116, 104, 105, 115, 46, 98, 114, 101, 97, 107, 95,
+105, 100, 95, 44, 10, 116, 104, 105, 115, 46, 100, 101, 116, 97, 105, 108, 115,
+95, 46, 102, 114, 97, 109, 101, 73, 100, 40, 41, 44, 10, 116, 104, 105, 115, 46,
+100, 101, 116, 97, 105, 108, 115, 95, 46, 105, 110, 108, 105, 110, 101, 100, 70,
+114, 97, 109, 101, 73, 110, 100, 101, 120, 40, 41, 44, 10, 33, 33, 97, 116, 41,
+59, 10, 118, 97, 114, 32, 68, 61, 91, 93, 59, 10, 102, 111, 114, 40, 118, 97,
+114, 32, 121, 61, 48, 59, 121, 60, 97, 117, 46, 108, 101, 110, 103, 116, 104,
+59, 43, 43, 121, 41, 123, 10, 68, 46, 112, 117, 115, 104, 40, 110, 101, 119, 32,
+83, 99, 111, 112, 101, 77, 105, 114, 114, 111, 114, 40, 116, 104, 105, 115, 44,
+40, 118, 111, 105, 100, 32, 48, 41, 44, 40, 118, 111, 105, 100, 32, 48, 41, 44,
+121, 44, 10, 97, 117, 91, 121, 93, 41, 41, 59, 10, 125, 10, 114, 101, 116, 117,
+114, 110, 32, 68, 59, 10, 125, 59, 10, 70, 114, 97, 109, 101, 77, 105, 114, 114,
+111, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 101, 118, 97,
+108, 117, 97, 116, 101, 61, 102, 117, 110, 99, 116, 105, 111, 110, 40, 115, 111,
+117, 114, 99, 101, 44, 116, 104, 114, 111, 119, 95, 111, 110, 95, 115, 105, 100,
+101, 95, 101, 102, 102, 101, 99, 116, 61, 102, 97, 108, 115, 101, 41, 123, 10,
+114, 101, 116, 117, 114, 110, 32, 77, 97, 107, 101, 77, 105, 114, 114, 111, 114,
+40, 37, 68, 101, 98, 117, 103, 69, 118, 97, 108, 117, 97, 116, 101, 40, 116,
+104, 105, 115, 46, 98, 114, 101, 97, 107, 95, 105, 100, 95, 44, 10, 116, 104,
+105, 115, 46, 100, 101, 116, 97, 105, 108, 115, 95, 46, 102, 114, 97, 109, 101,
+73, 100, 40, 41, 44, 10, 116, 104, 105, 115, 46, 100, 101, 116, 97, 105, 108,
+115, 95, 46, 105, 110, 108, 105, 110, 101, 100, 70, 114, 97, 109, 101, 73, 110,
+100, 101, 120, 40, 41, 44, 10, 115, 111, 117, 114, 99, 101, 44, 10, 116, 104,
+114, 111, 119, 95, 111, 110, 95, 115, 105, 100, 101, 95, 101, 102, 102, 101, 99,
+116, 41, 41, 59, 10, 125, 59, 10, 70, 114, 97, 109, 101, 77, 105, 114, 114, 111,
+114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 105, 110, 118, 111,
+99, 97, 116, 105, 111, 110, 84, 101, 120, 116, 61, 102, 117, 110, 99, 116, 105,
+111, 110, 40, 41, 123, 10, 118, 97, 114, 32, 68, 61, 39, 39, 59, 10, 118, 97,
+114, 32, 97, 118, 61, 116, 104, 105, 115, 46, 102, 117, 110, 99, 40, 41, 59, 10,
+118, 97, 114, 32, 97, 119, 61, 116, 104, 105, 115, 46, 114, 101, 99, 101, 105,
+118, 101, 114, 40, 41, 59, 10, 105, 102, 40, 116, 104, 105, 115, 46, 105, 115,
+67, 111, 110, 115, 116, 114, 117, 99, 116, 67, 97, 108, 108, 40, 41, 41, 123,
+10, 68, 43, 61, 39, 110, 101, 119, 32, 39, 59, 10, 68, 43, 61, 97, 118, 46, 110,
+97, 109, 101, 40, 41, 63, 97, 118, 46, 110, 97, 109, 101, 40, 41, 58, 39, 91,
+97, 110, 111, 110, 121, 109, 111, 117, 115, 93, 39, 59, 10, 125, 101, 108, 115,
+101, 32, 105, 102, 40, 116, 104, 105, 115, 46, 105, 115, 68, 101, 98, 117, 103,
+103, 101, 114, 70, 114, 97, 109, 101, 40, 41, 41, 123, 10, 68, 43, 61, 39, 91,
+100, 101, 98, 117, 103, 103, 101, 114, 93, 39, 59, 10, 125, 101, 108, 115, 101,
+123, 10, 118, 97, 114, 32, 97, 120, 61, 10, 33, 97, 119, 46, 99, 108, 97, 115,
+115, 78, 97, 109, 101, 124, 124, 40, 97, 119, 46, 99, 108, 97, 115, 115, 78, 97,
+109, 101, 40, 41, 33, 61, 39, 103, 108, 111, 98, 97, 108, 39, 41, 59, 10, 105,
+102, 40, 97, 120, 41, 123, 10, 68, 43, 61, 97, 119, 46, 116, 111, 84, 101, 120,
+116, 40, 41, 59, 10, 125, 10, 118, 97, 114, 32, 66, 61, 71, 101, 116, 85, 110,
+100, 101, 102, 105, 110, 101, 100, 77, 105, 114, 114, 111, 114, 40, 41, 59, 10,
+105, 102, 40, 97, 119, 46, 105, 115, 79, 98, 106, 101, 99, 116, 40, 41, 41, 123,
+10, 102, 111, 114, 40, 118, 97, 114, 32, 97, 121, 61, 97, 119, 59, 10, 33, 97,
+121, 46, 105, 115, 78, 117, 108, 108, 40, 41, 38, 38, 66, 46, 105, 115, 85, 110,
+100, 101, 102, 105, 110, 101, 100, 40, 41, 59, 10, 97, 121, 61, 97, 121, 46,
+112, 114, 111, 116, 111, 79, 98, 106, 101, 99, 116, 40, 41, 41, 123, 10, 66, 61,
+97, 121, 46, 108, 111, 111, 107, 117, 112, 80, 114, 111, 112, 101, 114, 116,
+121, 40, 97, 118, 41, 59, 10, 125, 10, 125, 10, 105, 102, 40, 33, 66, 46, 105,
+115, 85, 110, 100, 101, 102, 105, 110, 101, 100, 40, 41, 41, 123, 10, 105, 102,
+40, 33, 66, 46, 105, 115, 73, 110, 100, 101, 120, 101, 100, 40, 41, 41, 123, 10,
+105, 102, 40, 97, 120, 41, 123, 10, 68, 43, 61, 39, 46, 39, 59, 10, 125, 10, 68,
+43, 61, 66, 46, 116, 111, 84, 101, 120, 116, 40, 41, 59, 10, 125, 101, 108, 115,
+101, 123, 10, 68, 43, 61, 39, 91, 39, 59, 10, 68, 43, 61, 66, 46, 116, 111, 84,
+101, 120, 116, 40, 41, 59, 10, 68, 43, 61, 39, 93, 39, 59, 10, 125, 10, 105,
+102, 40, 97, 118, 46, 110, 97, 109, 101, 40, 41, 38, 38, 97, 118, 46, 110, 97,
+109, 101, 40, 41, 33, 61, 66, 46, 110, 97, 109, 101, 40, 41, 41, 123, 10, 68,
+43, 61, 39, 40, 97, 107, 97, 32, 39, 43, 97, 118, 46, 110, 97, 109, 101, 40, 41,
+43, 39, 41, 39, 59, 10, 125, 10, 125, 101, 108, 115, 101, 123, 10, 105, 102, 40,
+97, 120, 41, 123, 10, 68, 43, 61, 39, 46, 39, 59, 10, 125, 10, 68, 43, 61, 97,
+118, 46, 110, 97, 109, 101, 40, 41, 63, 97, 118, 46, 110, 97, 109, 101, 40, 41,
+58, 39, 91, 97, 110, 111, 110, 121, 109, 111, 117, 115, 93, 39, 59, 10, 125, 10,
+125, 10, 105, 102, 40, 33, 116, 104, 105, 115, 46, 105, 115, 68, 101, 98, 117,
+103, 103, 101, 114, 70, 114, 97, 109, 101, 40, 41, 41, 123, 10, 68, 43, 61, 39,
+40, 39, 59, 10, 102, 111, 114, 40, 118, 97, 114, 32, 121, 61, 48, 59, 121, 60,
+116, 104, 105, 115, 46, 97, 114, 103, 117, 109, 101, 110, 116, 67, 111, 117,
+110, 116, 40, 41, 59, 121, 43, 43, 41, 123, 10, 105, 102, 40, 121, 33, 61, 48,
+41, 68, 43, 61, 39, 44, 32, 39, 59, 10, 105, 102, 40, 116, 104, 105, 115, 46,
+97, 114, 103, 117, 109, 101, 110, 116, 78, 97, 109, 101, 40, 121, 41, 41, 123,
+10, 68, 43, 61, 116, 104, 105, 115, 46, 97, 114, 103, 117, 109, 101, 110, 116,
+78, 97, 109, 101, 40, 121, 41, 59, 10, 68, 43, 61, 39, 61, 39, 59, 10, 125, 10,
+68, 43, 61, 116, 104, 105, 115, 46, 97, 114, 103, 117, 109, 101, 110, 116, 86,
+97, 108, 117, 101, 40, 121, 41, 46, 116, 111, 84, 101, 120, 116, 40, 41, 59, 10,
+125, 10, 68, 43, 61, 39, 41, 39, 59, 10, 125, 10, 105, 102, 40, 116, 104, 105,
+115, 46, 105, 115, 65, 116, 82, 101, 116, 117, 114, 110, 40, 41, 41, 123, 10,
+68, 43, 61, 39, 32, 114, 101, 116, 117, 114, 110, 105, 110, 103, 32, 39, 59, 10,
+68, 43, 61, 116, 104, 105, 115, 46, 114, 101, 116, 117, 114, 110, 86, 97, 108,
+117, 101, 40, 41, 46, 116, 111, 84, 101, 120, 116, 40, 41, 59, 10, 125, 10, 114,
+101, 116, 117, 114, 110, 32, 68, 59, 10, 125, 59, 10, 70, 114, 97, 109, 101, 77,
+105, 114, 114, 111, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46,
+115, 111, 117, 114, 99, 101, 65, 110, 100, 80, 111, 115, 105, 116, 105, 111,
+110, 84, 101, 120, 116, 61, 102, 117, 110, 99, 116, 105, 111, 110, 40, 41, 123,
+10, 118, 97, 114, 32, 68, 61, 39, 39, 59, 10, 118, 97, 114, 32, 97, 118, 61,
+116, 104, 105, 115, 46, 102, 117, 110, 99, 40, 41, 59, 10, 105, 102, 40, 97,
+118, 46, 114, 101, 115, 111, 108, 118, 101, 100, 40, 41, 41, 123, 10, 118, 97,
+114, 32, 69, 61, 97, 118, 46, 115, 99, 114, 105, 112, 116, 40, 41, 59, 10, 105,
+102, 40, 69, 41, 123, 10, 105, 102, 40, 69, 46, 110, 97, 109, 101, 40, 41, 41,
+123, 10, 68, 43, 61, 69, 46, 110, 97, 109, 101, 40, 41, 59, 10, 125, 101, 108,
+115, 101, 123, 10, 68, 43, 61, 39, 91, 117, 110, 110, 97, 109, 101, 100, 93, 39,
+59, 10, 125, 10, 105, 102, 40, 33, 116, 104, 105, 115, 46, 105, 115, 68, 101,
+98, 117, 103, 103, 101, 114, 70, 114, 97, 109, 101, 40, 41, 41, 123, 10, 118,
+97, 114, 32, 97, 115, 61, 116, 104, 105, 115, 46, 115, 111, 117, 114, 99, 101,
+76, 111, 99, 97, 116, 105, 111, 110, 40, 41, 59, 10, 68, 43, 61, 39, 32, 108,
+105, 110, 101, 32, 39, 59, 10, 68, 43, 61, 33, 40, 97, 115, 61, 61, 61, 40, 118,
+111, 105, 100, 32, 48, 41, 41, 63, 40, 97, 115, 46, 108, 105, 110, 101, 43, 49,
+41, 58, 39, 63, 39, 59, 10, 68, 43, 61, 39, 32, 99, 111, 108, 117, 109, 110, 32,
+39, 59, 10, 68, 43, 61, 33, 40, 97, 115, 61, 61, 61, 40, 118, 111, 105, 100, 32,
+48, 41, 41, 63, 40, 97, 115, 46, 99, 111, 108, 117, 109, 110, 43, 49, 41, 58,
+39, 63, 39, 59, 10, 105, 102, 40, 33, 40, 116, 104, 105, 115, 46, 115, 111, 117,
+114, 99, 101, 80, 111, 115, 105, 116, 105, 111, 110, 40, 41, 61, 61, 61, 40,
+118, 111, 105, 100, 32, 48, 41, 41, 41, 123, 10, 68, 43, 61, 39, 32, 40, 112,
+111, 115, 105, 116, 105, 111, 110, 32, 39, 43, 40, 116, 104, 105, 115, 46, 115,
+111, 117, 114, 99, 101, 80, 111, 115, 105, 116, 105, 111, 110, 40, 41, 43, 49,
+41, 43, 39, 41, 39, 59, 10, 125, 10, 125, 10, 125, 101, 108, 115, 101, 123, 10,
+68, 43, 61, 39, 91, 110, 111, 32, 115, 111, 117, 114, 99, 101, 93, 39, 59, 10,
+125, 10, 125, 101, 108, 115, 101, 123, 10, 68, 43, 61, 39, 91, 117, 110, 114,
+101, 115, 111, 108, 118, 101, 100, 93, 39, 59, 10, 125, 10, 114, 101, 116, 117,
+114, 110, 32, 68, 59, 10, 125, 59, 10, 70, 114, 97, 109, 101, 77, 105, 114, 114,
+111, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 108, 111, 99, 97,
+108, 115, 84, 101, 120, 116, 61, 102, 117, 110, 99, 116, 105, 111, 110, 40, 41,
+123, 10, 118, 97, 114, 32, 68, 61, 39, 39, 59, 10, 118, 97, 114, 32, 97, 122,
+61, 116, 104, 105, 115, 46, 108, 111, 99, 97, 108, 67, 111, 117, 110, 116, 40,
+41, 59, 10, 105, 102, 40, 97, 122, 62, 48, 41, 123, 10, 102, 111, 114, 40, 118,
+97, 114, 32, 121, 61, 48, 59, 121, 60, 97, 122, 59, 43, 43, 121, 41, 123, 10,
+68, 43, 61, 39, 32, 32, 32, 32, 32, 32, 118, 97, 114, 32, 39, 59, 10, 68, 43,
+61, 116, 104, 105, 115, 46, 108, 111, 99, 97, 108, 78, 97, 109, 101, 40, 121,
+41, 59, 10, 68, 43, 61, 39, 32, 61, 32, 39, 59, 10, 68, 43, 61, 116, 104, 105,
+115, 46, 108, 111, 99, 97, 108, 86, 97, 108, 117, 101, 40, 121, 41, 46, 116,
+111, 84, 101, 120, 116, 40, 41, 59, 10, 105, 102, 40, 121, 60, 97, 122, 45, 49,
+41, 68, 43, 61, 39, 92, 110, 39, 59, 10, 125, 10, 125, 10, 114, 101, 116, 117,
+114, 110, 32, 68, 59, 10, 125, 59, 10, 70, 114, 97, 109, 101, 77, 105, 114, 114,
+111, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 114, 101, 115,
+116, 97, 114, 116, 61, 102, 117, 110, 99, 116, 105, 111, 110, 40, 41, 123, 10,
+118, 97, 114, 32, 68, 61, 37, 76, 105, 118, 101, 69, 100, 105, 116, 82, 101,
+115, 116, 97, 114, 116, 70, 114, 97, 109, 101, 40, 116, 104, 105, 115, 46, 98,
+114, 101, 97, 107, 95, 105, 100, 95, 44, 116, 104, 105, 115, 46, 105, 110, 100,
+101, 120, 95, 41, 59, 10, 105, 102, 40, 40, 68, 61, 61, 61, 40, 118, 111, 105,
+100, 32, 48, 41, 41, 41, 123, 10, 68, 61, 34, 70, 97, 105, 108, 101, 100, 32,
+116, 111, 32, 102, 105, 110, 100, 32, 114, 101, 113, 117, 101, 115, 116, 101,
+100, 32, 102, 114, 97, 109, 101, 34, 59, 10, 125, 10, 114, 101, 116, 117, 114,
+110, 32, 68, 59, 10, 125, 59, 10, 70, 114, 97, 109, 101, 77, 105, 114, 114, 111,
+114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 116, 111, 84, 101,
+120, 116, 61, 102, 117, 110, 99, 116, 105, 111, 110, 40, 97, 65, 41, 123, 10,
+118, 97, 114, 32, 68, 61, 39, 39, 59, 10, 68, 43, 61, 39, 35, 39, 43, 40, 116,
+104, 105, 115, 46, 105, 110, 100, 101, 120, 40, 41, 60, 61, 57, 63, 39, 48, 39,
+58, 39, 39, 41, 43, 116, 104, 105, 115, 46, 105, 110, 100, 101, 120, 40, 41, 59,
+10, 68, 43, 61, 39, 32, 39, 59, 10, 68, 43, 61, 116, 104, 105, 115, 46, 105,
+110, 118, 111, 99, 97, 116, 105, 111, 110, 84, 101, 120, 116, 40, 41, 59, 10,
+68, 43, 61, 39, 32, 39, 59, 10, 68, 43, 61, 116, 104, 105, 115, 46, 115, 111,
+117, 114, 99, 101, 65, 110, 100, 80, 111, 115, 105, 116, 105, 111, 110, 84, 101,
+120, 116, 40, 41, 59, 10, 105, 102, 40, 97, 65, 41, 123, 10, 68, 43, 61, 39, 92,
+110, 39, 59, 10, 68, 43, 61, 116, 104, 105, 115, 46, 108, 111, 99, 97, 108, 115,
+84, 101, 120, 116, 40, 41, 59, 10, 125, 10, 114, 101, 116, 117, 114, 110, 32,
+68, 59, 10, 125, 59, 10, 118, 97, 114, 32, 97, 66, 61, 48, 59, 10, 118, 97, 114,
+32, 97, 67, 61, 49, 59, 10, 118, 97, 114, 32, 97, 68, 61, 50, 59, 10, 118, 97,
+114, 32, 97, 69, 61, 51, 59, 10, 118, 97, 114, 32, 97, 70, 61, 52, 59, 10, 118,
+97, 114, 32, 97, 71, 61, 53, 59, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32,
+83, 99, 111, 112, 101, 68, 101, 116, 97, 105, 108, 115, 40, 97, 72, 44, 97, 73,
+44, 97, 74, 44, 71, 44, 97, 75, 41, 123, 10, 105, 102, 40, 97, 72, 41, 123, 10,
+116, 104, 105, 115, 46, 98, 114, 101, 97, 107, 95, 105, 100, 95, 61, 97, 72, 46,
+98, 114, 101, 97, 107, 95, 105, 100, 95, 59, 10, 116, 104, 105, 115, 46, 100,
+101, 116, 97, 105, 108, 115, 95, 61, 97, 75, 124, 124, 10, 37, 71, 101, 116, 83,
+99, 111, 112, 101, 68, 101, 116, 97, 105, 108, 115, 40, 97, 72, 46, 98, 114,
+101, 97, 107, 95, 105, 100, 95, 44, 10, 97, 72, 46, 100, 101, 116, 97, 105, 108,
+115, 95, 46, 102, 114, 97, 109, 101, 73, 100, 40, 41, 44, 10, 97, 72, 46, 100,
+101, 116, 97, 105, 108, 115, 95, 46, 105, 110, 108, 105, 110, 101, 100, 70, 114,
+97, 109, 101, 73, 110, 100, 101, 120, 40, 41, 44, 10, 71, 41, 59, 10, 116, 104,
+105, 115, 46, 102, 114, 97, 109, 101, 95, 105, 100, 95, 61, 97, 72, 46, 100,
+101, 116, 97, 105, 108, 115, 95, 46, 102, 114, 97, 109, 101, 73, 100, 40, 41,
+59, 10, 116, 104, 105, 115, 46, 105, 110, 108, 105, 110, 101, 100, 95, 102, 114,
+97, 109, 101, 95, 105, 100, 95, 61, 97, 72, 46, 100, 101, 116, 97, 105, 108,
+115, 95, 46, 105, 110, 108, 105, 110, 101, 100, 70, 114, 97, 109, 101, 73, 110,
+100, 101, 120, 40, 41, 59, 10, 125, 101, 108, 115, 101, 32, 105, 102, 40, 97,
+73, 41, 123, 10, 116, 104, 105, 115, 46, 100, 101, 116, 97, 105, 108, 115, 95,
+61, 97, 75, 124, 124, 37, 71, 101, 116, 70, 117, 110, 99, 116, 105, 111, 110,
+83, 99, 111, 112, 101, 68, 101, 116, 97, 105, 108, 115, 40, 97, 73, 46, 118, 97,
+108, 117, 101, 40, 41, 44, 71, 41, 59, 10, 116, 104, 105, 115, 46, 102, 117,
+110, 95, 118, 97, 108, 117, 101, 95, 61, 97, 73, 46, 118, 97, 108, 117, 101, 40,
+41, 59, 10, 116, 104, 105, 115, 46, 98, 114, 101, 97, 107, 95, 105, 100, 95, 61,
+40, 118, 111, 105, 100, 32, 48, 41, 59, 10, 125, 101, 108, 115, 101, 123, 10,
+116, 104, 105, 115, 46, 100, 101, 116, 97, 105, 108, 115, 95, 61, 10, 97, 75,
+124, 124, 37, 71, 101, 116, 71, 101, 110, 101, 114, 97, 116, 111, 114, 83, 99,
+111, 112, 101, 68, 101, 116, 97, 105, 108, 115, 40, 97, 74, 46, 118, 97, 108,
+117, 101, 40, 41, 44, 71, 41, 59, 10, 116, 104, 105, 115, 46, 103, 101, 110, 95,
+118, 97, 108, 117, 101, 95, 61, 97, 74, 46, 118, 97, 108, 117, 101, 40, 41, 59,
+10, 116, 104, 105, 115, 46, 98, 114, 101, 97, 107, 95, 105, 100, 95, 61, 40,
+118, 111, 105, 100, 32, 48, 41, 59, 10, 125, 10, 116, 104, 105, 115, 46, 105,
+110, 100, 101, 120, 95, 61, 71, 59, 10, 125, 10, 83, 99, 111, 112, 101, 68, 101,
+116, 97, 105, 108, 115, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46,
+116, 121, 112, 101, 61, 102, 117, 110, 99, 116, 105, 111, 110, 40, 41, 123, 10,
+105, 102, 40, 33, 40, 116, 104, 105, 115, 46, 98, 114, 101, 97, 107, 95, 105,
+100, 95, 61, 61, 61, 40, 118, 111, 105, 100, 32, 48, 41, 41, 41, 123, 10, 37,
+67, 104, 101, 99, 107, 69, 120, 101, 99, 117, 116, 105, 111, 110, 83, 116, 97,
+116, 101, 40, 116, 104, 105, 115, 46, 98, 114, 101, 97, 107, 95, 105, 100, 95,
+41, 59, 10, 125, 10, 114, 101, 116, 117, 114, 110, 32, 116, 104, 105, 115, 46,
+100, 101, 116, 97, 105, 108, 115, 95, 91, 97, 66, 93, 59, 10, 125, 59, 10, 83,
+99, 111, 112, 101, 68, 101, 116, 97, 105, 108, 115, 46, 112, 114, 111, 116, 111,
+116, 121, 112, 101, 46, 111, 98, 106, 101, 99, 116, 61, 102, 117, 110, 99, 116,
+105, 111, 110, 40, 41, 123, 10, 105, 102, 40, 33, 40, 116, 104, 105, 115, 46,
+98, 114, 101, 97, 107, 95, 105, 100, 95, 61, 61, 61, 40, 118, 111, 105, 100, 32,
+48, 41, 41, 41, 123, 10, 37, 67, 104, 101, 99, 107, 69, 120, 101, 99, 117, 116,
+105, 111, 110, 83, 116, 97, 116, 101, 40, 116, 104, 105, 115, 46, 98, 114, 101,
+97, 107, 95, 105, 100, 95, 41, 59, 10, 125, 10, 114, 101, 116, 117, 114, 110,
+32, 116, 104, 105, 115, 46, 100, 101, 116, 97, 105, 108, 115, 95, 91, 97, 67,
+93, 59, 10, 125, 59, 10, 83, 99, 111, 112, 101, 68, 101, 116, 97, 105, 108, 115,
+46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 110, 97, 109, 101, 61, 102,
+117, 110, 99, 116, 105, 111, 110, 40, 41, 123, 10, 105, 102, 40, 33, 40, 116,
+104, 105, 115, 46, 98, 114, 101, 97, 107, 95, 105, 100, 95, 61, 61, 61, 40, 118,
+111, 105, 100, 32, 48, 41, 41, 41, 123, 10, 37, 67, 104, 101, 99, 107, 69, 120,
+101, 99, 117, 116, 105, 111, 110, 83, 116, 97, 116, 101, 40, 116, 104, 105, 115,
+46, 98, 114, 101, 97, 107, 95, 105, 100, 95, 41, 59, 10, 125, 10, 114, 101, 116,
+117, 114, 110, 32, 116, 104, 105, 115, 46, 100, 101, 116, 97, 105, 108, 115, 95,
+91, 97, 68, 93, 59, 10, 125, 59, 10, 83, 99, 111, 112, 101, 68, 101, 116, 97,
+105, 108, 115, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 115, 116,
+97, 114, 116, 80, 111, 115, 105, 116, 105, 111, 110, 61, 102, 117, 110, 99, 116,
+105, 111, 110, 40, 41, 123, 10, 105, 102, 40, 33, 40, 116, 104, 105, 115, 46,
+98, 114, 101, 97, 107, 95, 105, 100, 95, 61, 61, 61, 40, 118, 111, 105, 100, 32,
+48, 41, 41, 41, 123, 10, 37, 67, 104, 101, 99, 107, 69, 120, 101, 99, 117, 116,
+105, 111, 110, 83, 116, 97, 116, 101, 40, 116, 104, 105, 115, 46, 98, 114, 101,
+97, 107, 95, 105, 100, 95, 41, 59, 10, 125, 10, 114, 101, 116, 117, 114, 110,
+32, 116, 104, 105, 115, 46, 100, 101, 116, 97, 105, 108, 115, 95, 91, 97, 69,
+93, 59, 10, 125, 10, 83, 99, 111, 112, 101, 68, 101, 116, 97, 105, 108, 115, 46,
+112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 101, 110, 100, 80, 111, 115,
+105, 116, 105, 111, 110, 61, 102, 117, 110, 99, 116, 105, 111, 110, 40, 41, 123,
+10, 105, 102, 40, 33, 40, 116, 104, 105, 115, 46, 98, 114, 101, 97, 107, 95,
+105, 100, 95, 61, 61, 61, 40, 118, 111, 105, 100, 32, 48, 41, 41, 41, 123, 10,
+37, 67, 104, 101, 99, 107, 69, 120, 101, 99, 117, 116, 105, 111, 110, 83, 116,
+97, 116, 101, 40, 116, 104, 105, 115, 46, 98, 114, 101, 97, 107, 95, 105, 100,
+95, 41, 59, 10, 125, 10, 114, 101, 116, 117, 114, 110, 32, 116, 104, 105, 115,
+46, 100, 101, 116, 97, 105, 108, 115, 95, 91, 97, 70, 93, 59, 10, 125, 10, 83,
+99, 111, 112, 101, 68, 101, 116, 97, 105, 108, 115, 46, 112, 114, 111, 116, 111,
+116, 121, 112, 101, 46, 102, 117, 110, 99, 61, 102, 117, 110, 99, 116, 105, 111,
+110, 40, 41, 123, 10, 105, 102, 40, 33, 40, 116, 104, 105, 115, 46, 98, 114,
+101, 97, 107, 95, 105, 100, 95, 61, 61, 61, 40, 118, 111, 105, 100, 32, 48, 41,
+41, 41, 123, 10, 37, 67, 104, 101, 99, 107, 69, 120, 101, 99, 117, 116, 105,
+111, 110, 83, 116, 97, 116, 101, 40, 116, 104, 105, 115, 46, 98, 114, 101, 97,
+107, 95, 105, 100, 95, 41, 59, 10, 125, 10, 114, 101, 116, 117, 114, 110, 32,
+116, 104, 105, 115, 46, 100, 101, 116, 97, 105, 108, 115, 95, 91, 97, 71, 93,
+59, 10, 125, 10, 83, 99, 111, 112, 101, 68, 101, 116, 97, 105, 108, 115, 46,
+112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 115, 101, 116, 86, 97, 114,
+105, 97, 98, 108, 101, 86, 97, 108, 117, 101, 73, 109, 112, 108, 61, 102, 117,
+110, 99, 116, 105, 111, 110, 40, 122, 44, 97, 76, 41, 123, 10, 118, 97, 114, 32,
+97, 77, 59, 10, 105, 102, 40, 33, 40, 116, 104, 105, 115, 46, 98, 114, 101, 97,
+107, 95, 105, 100, 95, 61, 61, 61, 40, 118, 111, 105, 100, 32, 48, 41, 41, 41,
+123, 10, 37, 67, 104, 101, 99, 107, 69, 120, 101, 99, 117, 116, 105, 111, 110,
+83, 116, 97, 116, 101, 40, 116, 104, 105, 115, 46, 98, 114, 101, 97, 107, 95,
+105, 100, 95, 41, 59, 10, 97, 77, 61, 37, 83, 101, 116, 83, 99, 111, 112, 101,
+86, 97, 114, 105, 97, 98, 108, 101, 86, 97, 108, 117, 101, 40, 116, 104, 105,
+115, 46, 98, 114, 101, 97, 107, 95, 105, 100, 95, 44, 116, 104, 105, 115, 46,
+102, 114, 97, 109, 101, 95, 105, 100, 95, 44, 10, 116, 104, 105, 115, 46, 105,
+110, 108, 105, 110, 101, 100, 95, 102, 114, 97, 109, 101, 95, 105, 100, 95, 44,
+116, 104, 105, 115, 46, 105, 110, 100, 101, 120, 95, 44, 122, 44, 97, 76, 41,
+59, 10, 125, 101, 108, 115, 101, 32, 105, 102, 40, 33, 40, 116, 104, 105, 115,
+46, 102, 117, 110, 95, 118, 97, 108, 117, 101, 95, 61, 61, 61, 40, 118, 111,
+105, 100, 32, 48, 41, 41, 41, 123, 10, 97, 77, 61, 37, 83, 101, 116, 83, 99,
+111, 112, 101, 86, 97, 114, 105, 97, 98, 108, 101, 86, 97, 108, 117, 101, 40,
+116, 104, 105, 115, 46, 102, 117, 110, 95, 118, 97, 108, 117, 101, 95, 44, 110,
+117, 108, 108, 44, 110, 117, 108, 108, 44, 116, 104, 105, 115, 46, 105, 110,
+100, 101, 120, 95, 44, 10, 122, 44, 97, 76, 41, 59, 10, 125, 101, 108, 115, 101,
+123, 10, 97, 77, 61, 37, 83, 101, 116, 83, 99, 111, 112, 101, 86, 97, 114, 105,
+97, 98, 108, 101, 86, 97, 108, 117, 101, 40, 116, 104, 105, 115, 46, 103, 101,
+110, 95, 118, 97, 108, 117, 101, 95, 44, 110, 117, 108, 108, 44, 110, 117, 108,
+108, 44, 116, 104, 105, 115, 46, 105, 110, 100, 101, 120, 95, 44, 10, 122, 44,
+97, 76, 41, 59, 10, 125, 10, 105, 102, 40, 33, 97, 77, 41, 116, 104, 114, 111,
+119, 32, 37, 109, 97, 107, 101, 95, 101, 114, 114, 111, 114, 40, 50, 44, 34, 70,
+97, 105, 108, 101, 100, 32, 116, 111, 32, 115, 101, 116, 32, 118, 97, 114, 105,
+97, 98, 108, 101, 32, 118, 97, 108, 117, 101, 34, 41, 59, 10, 125, 59, 10, 102,
+117, 110, 99, 116, 105, 111, 110, 32, 83, 99, 111, 112, 101, 77, 105, 114, 114,
+111, 114, 40, 97, 72, 44, 97, 73, 44, 97, 74, 44, 71, 44, 97, 75, 41, 123, 10,
+37, 95, 67, 97, 108, 108, 40, 77, 105, 114, 114, 111, 114, 44, 116, 104, 105,
+115, 44, 106, 46, 83, 67, 79, 80, 69, 95, 84, 89, 80, 69, 41, 59, 10, 105, 102,
+40, 97, 72, 41, 123, 10, 116, 104, 105, 115, 46, 102, 114, 97, 109, 101, 95,
+105, 110, 100, 101, 120, 95, 61, 97, 72, 46, 105, 110, 100, 101, 120, 95, 59,
+10, 125, 101, 108, 115, 101, 123, 10, 116, 104, 105, 115, 46, 102, 114, 97, 109,
+101, 95, 105, 110, 100, 101, 120, 95, 61, 40, 118, 111, 105, 100, 32, 48, 41,
+59, 10, 125, 10, 116, 104, 105, 115, 46, 115, 99, 111, 112, 101, 95, 105, 110,
+100, 101, 120, 95, 61, 71, 59, 10, 116, 104, 105, 115, 46, 100, 101, 116, 97,
+105, 108, 115, 95, 61, 110, 101, 119, 32, 83, 99, 111, 112, 101, 68, 101, 116,
+97, 105, 108, 115, 40, 97, 72, 44, 97, 73, 44, 97, 74, 44, 71, 44, 97, 75, 41,
+59, 10, 125, 10, 105, 110, 104, 101, 114, 105, 116, 115, 40, 83, 99, 111, 112,
+101, 77, 105, 114, 114, 111, 114, 44, 77, 105, 114, 114, 111, 114, 41, 59, 10,
+83, 99, 111, 112, 101, 77, 105, 114, 114, 111, 114, 46, 112, 114, 111, 116, 111,
+116, 121, 112, 101, 46, 100, 101, 116, 97, 105, 108, 115, 61, 102, 117, 110, 99,
+116, 105, 111, 110, 40, 41, 123, 10, 114, 101, 116, 117, 114, 110, 32, 116, 104,
+105, 115, 46, 100, 101, 116, 97, 105, 108, 115, 95, 59, 10, 125, 59, 10, 83, 99,
+111, 112, 101, 77, 105, 114, 114, 111, 114, 46, 112, 114, 111, 116, 111, 116,
+121, 112, 101, 46, 102, 114, 97, 109, 101, 73, 110, 100, 101, 120, 61, 102, 117,
+110, 99, 116, 105, 111, 110, 40, 41, 123, 10, 114, 101, 116, 117, 114, 110, 32,
+116, 104, 105, 115, 46, 102, 114, 97, 109, 101, 95, 105, 110, 100, 101, 120, 95,
+59, 10, 125, 59, 10, 83, 99, 111, 112, 101, 77, 105, 114, 114, 111, 114, 46,
+112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 115, 99, 111, 112, 101, 73,
+110, 100, 101, 120, 61, 102, 117, 110, 99, 116, 105, 111, 110, 40, 41, 123, 10,
+114, 101, 116, 117, 114, 110, 32, 116, 104, 105, 115, 46, 115, 99, 111, 112,
+101, 95, 105, 110, 100, 101, 120, 95, 59, 10, 125, 59, 10, 83, 99, 111, 112,
+101, 77, 105, 114, 114, 111, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112,
+101, 46, 115, 99, 111, 112, 101, 84, 121, 112, 101, 61, 102, 117, 110, 99, 116,
+105, 111, 110, 40, 41, 123, 10, 114, 101, 116, 117, 114, 110, 32, 116, 104, 105,
+115, 46, 100, 101, 116, 97, 105, 108, 115, 95, 46, 116, 121, 112, 101, 40, 41,
+59, 10, 125, 59, 10, 83, 99, 111, 112, 101, 77, 105, 114, 114, 111, 114, 46,
+112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 115, 99, 111, 112, 101, 79, 98,
+106, 101, 99, 116, 61, 102, 117, 110, 99, 116, 105, 111, 110, 40, 41, 123, 10,
+114, 101, 116, 117, 114, 110, 32, 77, 97, 107, 101, 77, 105, 114, 114, 111, 114,
+40, 116, 104, 105, 115, 46, 100, 101, 116, 97, 105, 108, 115, 95, 46, 111, 98,
+106, 101, 99, 116, 40, 41, 41, 59, 10, 125, 59, 10, 83, 99, 111, 112, 101, 77,
+105, 114, 114, 111, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46,
+115, 101, 116, 86, 97, 114, 105, 97, 98, 108, 101, 86, 97, 108, 117, 101, 61,
+102, 117, 110, 99, 116, 105, 111, 110, 40, 122, 44, 97, 76, 41, 123, 10, 116,
+104, 105, 115, 46, 100, 101, 116, 97, 105, 108, 115, 95, 46, 115, 101, 116, 86,
+97, 114, 105, 97, 98, 108, 101, 86, 97, 108, 117, 101, 73, 109, 112, 108, 40,
+122, 44, 97, 76, 41, 59, 10, 125, 59, 10, 102, 117, 110, 99, 116, 105, 111, 110,
+32, 83, 99, 114, 105, 112, 116, 77, 105, 114, 114, 111, 114, 40, 69, 41, 123,
+10, 37, 95, 67, 97, 108, 108, 40, 77, 105, 114, 114, 111, 114, 44, 116, 104,
+105, 115, 44, 106, 46, 83, 67, 82, 73, 80, 84, 95, 84, 89, 80, 69, 41, 59, 10,
+116, 104, 105, 115, 46, 115, 99, 114, 105, 112, 116, 95, 61, 69, 59, 10, 116,
+104, 105, 115, 46, 99, 111, 110, 116, 101, 120, 116, 95, 61, 110, 101, 119, 32,
+67, 111, 110, 116, 101, 120, 116, 77, 105, 114, 114, 111, 114, 40, 69, 46, 99,
+111, 110, 116, 101, 120, 116, 95, 100, 97, 116, 97, 41, 59, 10, 125, 10, 105,
+110, 104, 101, 114, 105, 116, 115, 40, 83, 99, 114, 105, 112, 116, 77, 105, 114,
+114, 111, 114, 44, 77, 105, 114, 114, 111, 114, 41, 59, 10, 83, 99, 114, 105,
+112, 116, 77, 105, 114, 114, 111, 114, 46, 112, 114, 111, 116, 111, 116, 121,
+112, 101, 46, 118, 97, 108, 117, 101, 61, 102, 117, 110, 99, 116, 105, 111, 110,
+40, 41, 123, 10, 114, 101, 116, 117, 114, 110, 32, 116, 104, 105, 115, 46, 115,
+99, 114, 105, 112, 116, 95, 59, 10, 125, 59, 10, 83, 99, 114, 105, 112, 116, 77,
+105, 114, 114, 111, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46,
+110, 97, 109, 101, 61, 102, 117, 110, 99, 116, 105, 111, 110, 40, 41, 123, 10,
+114, 101, 116, 117, 114, 110, 32, 116, 104, 105, 115, 46, 115, 99, 114, 105,
+112, 116, 95, 46, 110, 97, 109, 101, 124, 124, 116, 104, 105, 115, 46, 115, 99,
+114, 105, 112, 116, 95, 46, 110, 97, 109, 101, 79, 114, 83, 111, 117, 114, 99,
+101, 85, 82, 76, 40, 41, 59, 10, 125, 59, 10, 83, 99, 114, 105, 112, 116, 77,
+105, 114, 114, 111, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46,
+105, 100, 61, 102, 117, 110, 99, 116, 105, 111, 110, 40, 41, 123, 10, 114, 101,
+116, 117, 114, 110, 32, 116, 104, 105, 115, 46, 115, 99, 114, 105, 112, 116, 95,
+46, 105, 100, 59, 10, 125, 59, 10, 83, 99, 114, 105, 112, 116, 77, 105, 114,
+114, 111, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 115, 111,
+117, 114, 99, 101, 61, 102, 117, 110, 99, 116, 105, 111, 110, 40, 41, 123, 10,
+114, 101, 116, 117, 114, 110, 32, 116, 104, 105, 115, 46, 115, 99, 114, 105,
+112, 116, 95, 46, 115, 111, 117, 114, 99, 101, 59, 10, 125, 59, 10, 83, 99, 114,
+105, 112, 116, 77, 105, 114, 114, 111, 114, 46, 112, 114, 111, 116, 111, 116,
+121, 112, 101, 46, 115, 101, 116, 83, 111, 117, 114, 99, 101, 61, 102, 117, 110,
+99, 116, 105, 111, 110, 40, 97, 78, 41, 123, 10, 105, 102, 40, 33, 40, 116, 121,
+112, 101, 111, 102, 40, 97, 78, 41, 61, 61, 61, 39, 115, 116, 114, 105, 110,
+103, 39, 41, 41, 116, 104, 114, 111, 119, 32, 37, 109, 97, 107, 101, 95, 101,
+114, 114, 111, 114, 40, 50, 44, 34, 83, 111, 117, 114, 99, 101, 32, 105, 115,
+32, 110, 111, 116, 32, 97, 32, 115, 116, 114, 105, 110, 103, 34, 41, 59, 10, 37,
+68, 101, 98, 117, 103, 83, 101, 116, 83, 99, 114, 105, 112, 116, 83, 111, 117,
+114, 99, 101, 40, 116, 104, 105, 115, 46, 115, 99, 114, 105, 112, 116, 95, 44,
+97, 78, 41, 59, 10, 125, 59, 10, 83, 99, 114, 105, 112, 116, 77, 105, 114, 114,
+111, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 108, 105, 110,
+101, 79, 102, 102, 115, 101, 116, 61, 102, 117, 110, 99, 116, 105, 111, 110, 40,
+41, 123, 10, 114, 101, 116, 117, 114, 110, 32, 116, 104, 105, 115, 46, 115, 99,
+114, 105, 112, 116, 95, 46, 108, 105, 110, 101, 95, 111, 102, 102, 115, 101,
+116, 59, 10, 125, 59, 10, 83, 99, 114, 105, 112, 116, 77, 105, 114, 114, 111,
+114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 99, 111, 108, 117,
+109, 110, 79, 102, 102, 115, 101, 116, 61, 102, 117, 110, 99, 116, 105, 111,
+110, 40, 41, 123, 10, 114, 101, 116, 117, 114, 110, 32, 116, 104, 105, 115, 46,
+115, 99, 114, 105, 112, 116, 95, 46, 99, 111, 108, 117, 109, 110, 95, 111, 102,
+102, 115, 101, 116, 59, 10, 125, 59, 10, 83, 99, 114, 105, 112, 116, 77, 105,
+114, 114, 111, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 100,
+97, 116, 97, 61, 102, 117, 110, 99, 116, 105, 111, 110, 40, 41, 123, 10, 114,
+101, 116, 117, 114, 110, 32, 116, 104, 105, 115, 46, 115, 99, 114, 105, 112,
+116, 95, 46, 100, 97, 116, 97, 59, 10, 125, 59, 10, 83, 99, 114, 105, 112, 116,
+77, 105, 114, 114, 111, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101,
+46, 115, 99, 114, 105, 112, 116, 84, 121, 112, 101, 61, 102, 117, 110, 99, 116,
+105, 111, 110, 40, 41, 123, 10, 114, 101, 116, 117, 114, 110, 32, 116, 104, 105,
+115, 46, 115, 99, 114, 105, 112, 116, 95, 46, 116, 121, 112, 101, 59, 10, 125,
+59, 10, 83, 99, 114, 105, 112, 116, 77, 105, 114, 114, 111, 114, 46, 112, 114,
+111, 116, 111, 116, 121, 112, 101, 46, 99, 111, 109, 112, 105, 108, 97, 116,
+105, 111, 110, 84, 121, 112, 101, 61, 102, 117, 110, 99, 116, 105, 111, 110, 40,
+41, 123, 10, 114, 101, 116, 117, 114, 110, 32, 116, 104, 105, 115, 46, 115, 99,
+114, 105, 112, 116, 95, 46, 99, 111, 109, 112, 105, 108, 97, 116, 105, 111, 110,
+95, 116, 121, 112, 101, 59, 10, 125, 59, 10, 83, 99, 114, 105, 112, 116, 77,
+105, 114, 114, 111, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46,
+108, 105, 110, 101, 67, 111, 117, 110, 116, 61, 102, 117, 110, 99, 116, 105,
+111, 110, 40, 41, 123, 10, 114, 101, 116, 117, 114, 110, 32, 37, 83, 99, 114,
+105, 112, 116, 76, 105, 110, 101, 67, 111, 117, 110, 116, 40, 116, 104, 105,
+115, 46, 115, 99, 114, 105, 112, 116, 95, 41, 59, 10, 125, 59, 10, 83, 99, 114,
+105, 112, 116, 77, 105, 114, 114, 111, 114, 46, 112, 114, 111, 116, 111, 116,
+121, 112, 101, 46, 108, 111, 99, 97, 116, 105, 111, 110, 70, 114, 111, 109, 80,
+111, 115, 105, 116, 105, 111, 110, 61, 102, 117, 110, 99, 116, 105, 111, 110,
+40, 10, 112, 111, 115, 105, 116, 105, 111, 110, 44, 105, 110, 99, 108, 117, 100,
+101, 95, 114, 101, 115, 111, 117, 114, 99, 101, 95, 111, 102, 102, 115, 101,
+116, 41, 123, 10, 114, 101, 116, 117, 114, 110, 32, 116, 104, 105, 115, 46, 115,
+99, 114, 105, 112, 116, 95, 46, 108, 111, 99, 97, 116, 105, 111, 110, 70, 114,
+111, 109, 80, 111, 115, 105, 116, 105, 111, 110, 40, 112, 111, 115, 105, 116,
+105, 111, 110, 44, 105, 110, 99, 108, 117, 100, 101, 95, 114, 101, 115, 111,
+117, 114, 99, 101, 95, 111, 102, 102, 115, 101, 116, 41, 59, 10, 125, 59, 10,
+83, 99, 114, 105, 112, 116, 77, 105, 114, 114, 111, 114, 46, 112, 114, 111, 116,
+111, 116, 121, 112, 101, 46, 99, 111, 110, 116, 101, 120, 116, 61, 102, 117,
+110, 99, 116, 105, 111, 110, 40, 41, 123, 10, 114, 101, 116, 117, 114, 110, 32,
+116, 104, 105, 115, 46, 99, 111, 110, 116, 101, 120, 116, 95, 59, 10, 125, 59,
+10, 83, 99, 114, 105, 112, 116, 77, 105, 114, 114, 111, 114, 46, 112, 114, 111,
+116, 111, 116, 121, 112, 101, 46, 101, 118, 97, 108, 70, 114, 111, 109, 83, 99,
+114, 105, 112, 116, 61, 102, 117, 110, 99, 116, 105, 111, 110, 40, 41, 123, 10,
+114, 101, 116, 117, 114, 110, 32, 77, 97, 107, 101, 77, 105, 114, 114, 111, 114,
+40, 116, 104, 105, 115, 46, 115, 99, 114, 105, 112, 116, 95, 46, 101, 118, 97,
+108, 95, 102, 114, 111, 109, 95, 115, 99, 114, 105, 112, 116, 41, 59, 10, 125,
+59, 10, 83, 99, 114, 105, 112, 116, 77, 105, 114, 114, 111, 114, 46, 112, 114,
+111, 116, 111, 116, 121, 112, 101, 46, 101, 118, 97, 108, 70, 114, 111, 109, 70,
+117, 110, 99, 116, 105, 111, 110, 78, 97, 109, 101, 61, 102, 117, 110, 99, 116,
+105, 111, 110, 40, 41, 123, 10, 114, 101, 116, 117, 114, 110, 32, 77, 97, 107,
+101, 77, 105, 114, 114, 111, 114, 40, 116, 104, 105, 115, 46, 115, 99, 114, 105,
+112, 116, 95, 46, 101, 118, 97, 108, 95, 102, 114, 111, 109, 95, 102, 117, 110,
+99, 116, 105, 111, 110, 95, 110, 97, 109, 101, 41, 59, 10, 125, 59, 10, 83, 99,
+114, 105, 112, 116, 77, 105, 114, 114, 111, 114, 46, 112, 114, 111, 116, 111,
+116, 121, 112, 101, 46, 101, 118, 97, 108, 70, 114, 111, 109, 76, 111, 99, 97,
+116, 105, 111, 110, 61, 102, 117, 110, 99, 116, 105, 111, 110, 40, 41, 123, 10,
+118, 97, 114, 32, 97, 79, 61, 116, 104, 105, 115, 46, 101, 118, 97, 108, 70,
+114, 111, 109, 83, 99, 114, 105, 112, 116, 40, 41, 59, 10, 105, 102, 40, 33, 97,
+79, 46, 105, 115, 85, 110, 100, 101, 102, 105, 110, 101, 100, 40, 41, 41, 123,
+10, 118, 97, 114, 32, 97, 80, 61, 116, 104, 105, 115, 46, 115, 99, 114, 105,
+112, 116, 95, 46, 101, 118, 97, 108, 95, 102, 114, 111, 109, 95, 115, 99, 114,
+105, 112, 116, 95, 112, 111, 115, 105, 116, 105, 111, 110, 59, 10, 114, 101,
+116, 117, 114, 110, 32, 97, 79, 46, 108, 111, 99, 97, 116, 105, 111, 110, 70,
+114, 111, 109, 80, 111, 115, 105, 116, 105, 111, 110, 40, 97, 80, 44, 116, 114,
+117, 101, 41, 59, 10, 125, 10, 125, 59, 10, 83, 99, 114, 105, 112, 116, 77, 105,
+114, 114, 111, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 116,
+111, 84, 101, 120, 116, 61, 102, 117, 110, 99, 116, 105, 111, 110, 40, 41, 123,
+10, 118, 97, 114, 32, 68, 61, 39, 39, 59, 10, 68, 43, 61, 116, 104, 105, 115,
+46, 110, 97, 109, 101, 40, 41, 59, 10, 68, 43, 61, 39, 32, 40, 108, 105, 110,
+101, 115, 58, 32, 39, 59, 10, 105, 102, 40, 116, 104, 105, 115, 46, 108, 105,
+110, 101, 79, 102, 102, 115, 101, 116, 40, 41, 62, 48, 41, 123, 10, 68, 43, 61,
+116, 104, 105, 115, 46, 108, 105, 110, 101, 79, 102, 102, 115, 101, 116, 40, 41,
+59, 10, 68, 43, 61, 39, 45, 39, 59, 10, 68, 43, 61, 116, 104, 105, 115, 46, 108,
+105, 110, 101, 79, 102, 102, 115, 101, 116, 40, 41, 43, 116, 104, 105, 115, 46,
+108, 105, 110, 101, 67, 111, 117, 110, 116, 40, 41, 45, 49, 59, 10, 125, 101,
+108, 115, 101, 123, 10, 68, 43, 61, 116, 104, 105, 115, 46, 108, 105, 110, 101,
+67, 111, 117, 110, 116, 40, 41, 59, 10, 125, 10, 68, 43, 61, 39, 41, 39, 59, 10,
+114, 101, 116, 117, 114, 110, 32, 68, 59, 10, 125, 59, 10, 102, 117, 110, 99,
+116, 105, 111, 110, 32, 67, 111, 110, 116, 101, 120, 116, 77, 105, 114, 114,
+111, 114, 40, 97, 81, 41, 123, 10, 37, 95, 67, 97, 108, 108, 40, 77, 105, 114,
+114, 111, 114, 44, 116, 104, 105, 115, 44, 106, 46, 67, 79, 78, 84, 69, 88, 84,
+95, 84, 89, 80, 69, 41, 59, 10, 116, 104, 105, 115, 46, 100, 97, 116, 97, 95,
+61, 97, 81, 59, 10, 125, 10, 105, 110, 104, 101, 114, 105, 116, 115, 40, 67,
+111, 110, 116, 101, 120, 116, 77, 105, 114, 114, 111, 114, 44, 77, 105, 114,
+114, 111, 114, 41, 59, 10, 67, 111, 110, 116, 101, 120, 116, 77, 105, 114, 114,
+111, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 100, 97, 116, 97,
+61, 102, 117, 110, 99, 116, 105, 111, 110, 40, 41, 123, 10, 114, 101, 116, 117,
+114, 110, 32, 116, 104, 105, 115, 46, 100, 97, 116, 97, 95, 59, 10, 125, 59, 10,
+98, 46, 73, 110, 115, 116, 97, 108, 108, 67, 111, 110, 115, 116, 97, 110, 116,
+115, 40, 97, 44, 91, 10, 34, 77, 97, 107, 101, 77, 105, 114, 114, 111, 114, 34,
+44, 77, 97, 107, 101, 77, 105, 114, 114, 111, 114, 44, 10, 34, 83, 99, 111, 112,
+101, 84, 121, 112, 101, 34, 44, 115, 44, 10, 34, 80, 114, 111, 112, 101, 114,
+116, 121, 84, 121, 112, 101, 34, 44, 113, 44, 10, 34, 80, 114, 111, 112, 101,
+114, 116, 121, 65, 116, 116, 114, 105, 98, 117, 116, 101, 34, 44, 114, 44, 10,
+34, 77, 105, 114, 114, 111, 114, 34, 44, 77, 105, 114, 114, 111, 114, 44, 10,
+34, 86, 97, 108, 117, 101, 77, 105, 114, 114, 111, 114, 34, 44, 86, 97, 108,
+117, 101, 77, 105, 114, 114, 111, 114, 44, 10, 34, 85, 110, 100, 101, 102, 105,
+110, 101, 100, 77, 105, 114, 114, 111, 114, 34, 44, 85, 110, 100, 101, 102, 105,
+110, 101, 100, 77, 105, 114, 114, 111, 114, 44, 10, 34, 78, 117, 108, 108, 77,
+105, 114, 114, 111, 114, 34, 44, 78, 117, 108, 108, 77, 105, 114, 114, 111, 114,
+44, 10, 34, 66, 111, 111, 108, 101, 97, 110, 77, 105, 114, 114, 111, 114, 34,
+44, 66, 111, 111, 108, 101, 97, 110, 77, 105, 114, 114, 111, 114, 44, 10, 34,
+78, 117, 109, 98, 101, 114, 77, 105, 114, 114, 111, 114, 34, 44, 78, 117, 109,
+98, 101, 114, 77, 105, 114, 114, 111, 114, 44, 10, 34, 83, 116, 114, 105, 110,
+103, 77, 105, 114, 114, 111, 114, 34, 44, 83, 116, 114, 105, 110, 103, 77, 105,
+114, 114, 111, 114, 44, 10, 34, 83, 121, 109, 98, 111, 108, 77, 105, 114, 114,
+111, 114, 34, 44, 83, 121, 109, 98, 111, 108, 77, 105, 114, 114, 111, 114, 44,
+10, 34, 79, 98, 106, 101, 99, 116, 77, 105, 114, 114, 111, 114, 34, 44, 79, 98,
+106, 101, 99, 116, 77, 105, 114, 114, 111, 114, 44, 10, 34, 70, 117, 110, 99,
+116, 105, 111, 110, 77, 105, 114, 114, 111, 114, 34, 44, 70, 117, 110, 99, 116,
+105, 111, 110, 77, 105, 114, 114, 111, 114, 44, 10, 34, 85, 110, 114, 101, 115,
+111, 108, 118, 101, 100, 70, 117, 110, 99, 116, 105, 111, 110, 77, 105, 114,
+114, 111, 114, 34, 44, 85, 110, 114, 101, 115, 111, 108, 118, 101, 100, 70, 117,
+110, 99, 116, 105, 111, 110, 77, 105, 114, 114, 111, 114, 44, 10, 34, 65, 114,
+114, 97, 121, 77, 105, 114, 114, 111, 114, 34, 44, 65, 114, 114, 97, 121, 77,
+105, 114, 114, 111, 114, 44, 10, 34, 68, 97, 116, 101, 77, 105, 114, 114, 111,
+114, 34, 44, 68, 97, 116, 101, 77, 105, 114, 114, 111, 114, 44, 10, 34, 82, 101,
+103, 69, 120, 112, 77, 105, 114, 114, 111, 114, 34, 44, 82, 101, 103, 69, 120,
+112, 77, 105, 114, 114, 111, 114, 44, 10, 34, 69, 114, 114, 111, 114, 77, 105,
+114, 114, 111, 114, 34, 44, 69, 114, 114, 111, 114, 77, 105, 114, 114, 111, 114,
+44, 10, 34, 80, 114, 111, 109, 105, 115, 101, 77, 105, 114, 114, 111, 114, 34,
+44, 80, 114, 111, 109, 105, 115, 101, 77, 105, 114, 114, 111, 114, 44, 10, 34,
+77, 97, 112, 77, 105, 114, 114, 111, 114, 34, 44, 77, 97, 112, 77, 105, 114,
+114, 111, 114, 44, 10, 34, 83, 101, 116, 77, 105, 114, 114, 111, 114, 34, 44,
+83, 101, 116, 77, 105, 114, 114, 111, 114, 44, 10, 34, 73, 116, 101, 114, 97,
+116, 111, 114, 77, 105, 114, 114, 111, 114, 34, 44, 73, 116, 101, 114, 97, 116,
+111, 114, 77, 105, 114, 114, 111, 114, 44, 10, 34, 71, 101, 110, 101, 114, 97,
+116, 111, 114, 77, 105, 114, 114, 111, 114, 34, 44, 71, 101, 110, 101, 114, 97,
+116, 111, 114, 77, 105, 114, 114, 111, 114, 44, 10, 34, 80, 114, 111, 112, 101,
+114, 116, 121, 77, 105, 114, 114, 111, 114, 34, 44, 80, 114, 111, 112, 101, 114,
+116, 121, 77, 105, 114, 114, 111, 114, 44, 10, 34, 73, 110, 116, 101, 114, 110,
+97, 108, 80, 114, 111, 112, 101, 114, 116, 121, 77, 105, 114, 114, 111, 114, 34,
+44, 73, 110, 116, 101, 114, 110, 97, 108, 80, 114, 111, 112, 101, 114, 116, 121,
+77, 105, 114, 114, 111, 114, 44, 10, 34, 70, 114, 97, 109, 101, 77, 105, 114,
+114, 111, 114, 34, 44, 70, 114, 97, 109, 101, 77, 105, 114, 114, 111, 114, 44,
+10, 34, 83, 99, 114, 105, 112, 116, 77, 105, 114, 114, 111, 114, 34, 44, 83, 99,
+114, 105, 112, 116, 77, 105, 114, 114, 111, 114, 44, 10, 34, 83, 99, 111, 112,
+101, 77, 105, 114, 114, 111, 114, 34, 44, 83, 99, 111, 112, 101, 77, 105, 114,
+114, 111, 114, 44, 10, 34, 70, 114, 97, 109, 101, 68, 101, 116, 97, 105, 108,
+115, 34, 44, 70, 114, 97, 109, 101, 68, 101, 116, 97, 105, 108, 115, 44, 10, 93,
+41, 59, 10, 125, 41, 10, 10, 10, 40, 102, 117, 110, 99, 116, 105, 111, 110, 40,
+97, 44, 98, 41, 123, 10, 34, 117, 115, 101, 32, 115, 116, 114, 105, 99, 116, 34,
+59, 10, 118, 97, 114, 32, 99, 61, 97, 46, 70, 114, 97, 109, 101, 77, 105, 114,
+114, 111, 114, 59, 10, 118, 97, 114, 32, 100, 61, 97, 46, 65, 114, 114, 97, 121,
+59, 10, 118, 97, 114, 32, 101, 61, 97, 46, 82, 101, 103, 69, 120, 112, 59, 10,
+118, 97, 114, 32, 102, 61, 97, 46, 105, 115, 78, 97, 78, 59, 10, 118, 97, 114,
+32, 103, 61, 97, 46, 77, 97, 107, 101, 77, 105, 114, 114, 111, 114, 59, 10, 118,
+97, 114, 32, 104, 61, 97, 46, 77, 97, 116, 104, 46, 109, 105, 110, 59, 10, 118,
+97, 114, 32, 105, 61, 97, 46, 77, 105, 114, 114, 111, 114, 59, 10, 118, 97, 114,
+32, 106, 61, 97, 46, 86, 97, 108, 117, 101, 77, 105, 114, 114, 111, 114, 59, 10,
+118, 97, 114, 32, 107, 61, 123, 125, 59, 10, 107, 46, 68, 101, 98, 117, 103, 69,
+118, 101, 110, 116, 61, 123, 66, 114, 101, 97, 107, 58, 49, 44, 10, 69, 120, 99,
+101, 112, 116, 105, 111, 110, 58, 50, 44, 10, 65, 102, 116, 101, 114, 67, 111,
+109, 112, 105, 108, 101, 58, 51, 44, 10, 67, 111, 109, 112, 105, 108, 101, 69,
+114, 114, 111, 114, 58, 52, 44, 10, 65, 115, 121, 110, 99, 84, 97, 115, 107, 69,
+118, 101, 110, 116, 58, 53, 125, 59, 10, 107, 46, 69, 120, 99, 101, 112, 116,
+105, 111, 110, 66, 114, 101, 97, 107, 61, 123, 67, 97, 117, 103, 104, 116, 58,
+48, 44, 10, 85, 110, 99, 97, 117, 103, 104, 116, 58, 49, 125, 59, 10, 107, 46,
+83, 116, 101, 112, 65, 99, 116, 105, 111, 110, 61, 123, 83, 116, 101, 112, 79,
+117, 116, 58, 48, 44, 10, 83, 116, 101, 112, 78, 101, 120, 116, 58, 49, 44, 10,
+83, 116, 101, 112, 73, 110, 58, 50, 125, 59, 10, 107, 46, 83, 99, 114, 105, 112,
+116, 84, 121, 112, 101, 61, 123, 78, 97, 116, 105, 118, 101, 58, 48, 44, 10, 69,
+120, 116, 101, 110, 115, 105, 111, 110, 58, 49, 44, 10, 78, 111, 114, 109, 97,
+108, 58, 50, 44, 10, 87, 97, 115, 109, 58, 51, 125, 59, 10, 107, 46, 83, 99,
+114, 105, 112, 116, 67, 111, 109, 112, 105, 108, 97, 116, 105, 111, 110, 84,
+121, 112, 101, 61, 123, 72, 111, 115, 116, 58, 48, 44, 10, 69, 118, 97, 108, 58,
+49, 44, 10, 74, 83, 79, 78, 58, 50, 125, 59, 10, 102, 117, 110, 99, 116, 105,
+111, 110, 32, 83, 99, 114, 105, 112, 116, 84, 121, 112, 101, 70, 108, 97, 103,
+40, 108, 41, 123, 10, 114, 101, 116, 117, 114, 110, 40, 49, 60, 60, 108, 41, 59,
+10, 125, 10, 118, 97, 114, 32, 109, 61, 123, 10, 98, 114, 101, 97, 107, 79, 110,
+67, 97, 117, 103, 104, 116, 69, 120, 99, 101, 112, 116, 105, 111, 110, 58, 123,
+10, 103, 101, 116, 86, 97, 108, 117, 101, 58, 102, 117, 110, 99, 116, 105, 111,
+110, 40, 41, 123, 114, 101, 116, 117, 114, 110, 32, 107, 46, 105, 115, 66, 114,
+101, 97, 107, 79, 110, 69, 120, 99, 101, 112, 116, 105, 111, 110, 40, 41, 59,
+125, 44, 10, 115, 101, 116, 86, 97, 108, 117, 101, 58, 102, 117, 110, 99, 116,
+105, 111, 110, 40, 110, 41, 123, 10, 105, 102, 40, 110, 41, 123, 10, 107, 46,
+115, 101, 116, 66, 114, 101, 97, 107, 79, 110, 69, 120, 99, 101, 112, 116, 105,
+111, 110, 40, 41, 59, 10, 125, 101, 108, 115, 101, 123, 10, 107, 46, 99, 108,
+101, 97, 114, 66, 114, 101, 97, 107, 79, 110, 69, 120, 99, 101, 112, 116, 105,
+111, 110, 40, 41, 59, 10, 125, 10, 125, 10, 125, 44, 10, 98, 114, 101, 97, 107,
+79, 110, 85, 110, 99, 97, 117, 103, 104, 116, 69, 120, 99, 101, 112, 116, 105,
+111, 110, 58, 123, 10, 103, 101, 116, 86, 97, 108, 117, 101, 58, 102, 117, 110,
+99, 116, 105, 111, 110, 40, 41, 123, 114, 101, 116, 117, 114, 110, 32, 107, 46,
+105, 115, 66, 114, 101, 97, 107, 79, 110, 85, 110, 99, 97, 117, 103, 104, 116,
+69, 120, 99, 101, 112, 116, 105, 111, 110, 40, 41, 59, 125, 44, 10, 115, 101,
+116, 86, 97, 108, 117, 101, 58, 102, 117, 110, 99, 116, 105, 111, 110, 40, 110,
+41, 123, 10, 105, 102, 40, 110, 41, 123, 10, 107, 46, 115, 101, 116, 66, 114,
+101, 97, 107, 79, 110, 85, 110, 99, 97, 117, 103, 104, 116, 69, 120, 99, 101,
+112, 116, 105, 111, 110, 40, 41, 59, 10, 125, 101, 108, 115, 101, 123, 10, 107,
+46, 99, 108, 101, 97, 114, 66, 114, 101, 97, 107, 79, 110, 85, 110, 99, 97, 117,
+103, 104, 116, 69, 120, 99, 101, 112, 116, 105, 111, 110, 40, 41, 59, 10, 125,
+10, 125, 10, 125, 44, 10, 125, 59, 10, 107, 46, 102, 105, 110, 100, 83, 99, 114,
+105, 112, 116, 61, 102, 117, 110, 99, 116, 105, 111, 110, 40, 111, 41, 123, 10,
+105, 102, 40, 40, 37, 73, 115, 70, 117, 110, 99, 116, 105, 111, 110, 40, 111,
+41, 41, 41, 123, 10, 114, 101, 116, 117, 114, 110, 32, 37, 70, 117, 110, 99,
+116, 105, 111, 110, 71, 101, 116, 83, 99, 114, 105, 112, 116, 40, 111, 41, 59,
+10, 125, 101, 108, 115, 101, 32, 105, 102, 40, 37, 73, 115, 82, 101, 103, 69,
+120, 112, 40, 111, 41, 41, 123, 10, 118, 97, 114, 32, 112, 61, 116, 104, 105,
+115, 46, 115, 99, 114, 105, 112, 116, 115, 40, 41, 59, 10, 118, 97, 114, 32,
+113, 61, 110, 117, 108, 108, 59, 10, 118, 97, 114, 32, 114, 61, 48, 59, 10, 102,
+111, 114, 40, 118, 97, 114, 32, 115, 32, 105, 110, 32, 112, 41, 123, 10, 118,
+97, 114, 32, 116, 61, 112, 91, 115, 93, 59, 10, 105, 102, 40, 111, 46, 116, 101,
+115, 116, 40, 116, 46, 110, 97, 109, 101, 41, 41, 123, 10, 113, 61, 116, 59, 10,
+114, 43, 43, 59, 10, 125, 10, 125, 10, 105, 102, 40, 114, 61, 61, 49, 41, 123,
+10, 114, 101, 116, 117, 114, 110, 32, 113, 59, 10, 125, 101, 108, 115, 101, 123,
+10, 114, 101, 116, 117, 114, 110, 40, 118, 111, 105, 100, 32, 48, 41, 59, 10,
+125, 10, 125, 101, 108, 115, 101, 123, 10, 114, 101, 116, 117, 114, 110, 32, 37,
+71, 101, 116, 83, 99, 114, 105, 112, 116, 40, 111, 41, 59, 10, 125, 10, 125, 59,
+10, 107, 46, 115, 99, 114, 105, 112, 116, 83, 111, 117, 114, 99, 101, 61, 102,
+117, 110, 99, 116, 105, 111, 110, 40, 111, 41, 123, 10, 114, 101, 116, 117, 114,
+110, 32, 116, 104, 105, 115, 46, 102, 105, 110, 100, 83, 99, 114, 105, 112, 116,
+40, 111, 41, 46, 115, 111, 117, 114, 99, 101, 59, 10, 125, 59, 10, 107, 46, 115,
+111, 117, 114, 99, 101, 61, 102, 117, 110, 99, 116, 105, 111, 110, 40, 117, 41,
+123, 10, 105, 102, 40, 33, 40, 37, 73, 115, 70, 117, 110, 99, 116, 105, 111,
+110, 40, 117, 41, 41, 41, 116, 104, 114, 111, 119, 32, 37, 109, 97, 107, 101,
+95, 116, 121, 112, 101, 95, 101, 114, 114, 111, 114, 40, 52, 55, 41, 59, 10,
+114, 101, 116, 117, 114, 110, 32, 37, 70, 117, 110, 99, 116, 105, 111, 110, 71,
+101, 116, 83, 111, 117, 114, 99, 101, 67, 111, 100, 101, 40, 117, 41, 59, 10,
+125, 59, 10, 107, 46, 115, 111, 117, 114, 99, 101, 80, 111, 115, 105, 116, 105,
+111, 110, 61, 102, 117, 110, 99, 116, 105, 111, 110, 40, 117, 41, 123, 10, 105,
+102, 40, 33, 40, 37, 73, 115, 70, 117, 110, 99, 116, 105, 111, 110, 40, 117, 41,
+41, 41, 116, 104, 114, 111, 119, 32, 37, 109, 97, 107, 101, 95, 116, 121, 112,
+101, 95, 101, 114, 114, 111, 114, 40, 52, 55, 41, 59, 10, 114, 101, 116, 117,
+114, 110, 32, 37, 70, 117, 110, 99, 116, 105, 111, 110, 71, 101, 116, 83, 99,
+114, 105, 112, 116, 83, 111, 117, 114, 99, 101, 80, 111, 115, 105, 116, 105,
+111, 110, 40, 117, 41, 59, 10, 125, 59, 10, 107, 46, 102, 105, 110, 100, 70,
+117, 110, 99, 116, 105, 111, 110, 83, 111, 117, 114, 99, 101, 76, 111, 99, 97,
+116, 105, 111, 110, 61, 102, 117, 110, 99, 116, 105, 111, 110, 40, 118, 44, 119,
+44, 120, 41, 123, 10, 118, 97, 114, 32, 116, 61, 37, 70, 117, 110, 99, 116, 105,
+111, 110, 71, 101, 116, 83, 99, 114, 105, 112, 116, 40, 118, 41, 59, 10, 118,
+97, 114, 32, 121, 61, 37, 70, 117, 110, 99, 116, 105, 111, 110, 71, 101, 116,
+83, 99, 114, 105, 112, 116, 83, 111, 117, 114, 99, 101, 80, 111, 115, 105, 116,
+105, 111, 110, 40, 118, 41, 59, 10, 114, 101, 116, 117, 114, 110, 32, 37, 83,
+99, 114, 105, 112, 116, 76, 111, 99, 97, 116, 105, 111, 110, 70, 114, 111, 109,
+76, 105, 110, 101, 40, 116, 44, 119, 44, 120, 44, 121, 41, 59, 10, 125, 59, 10,
+107, 46, 102, 105, 110, 100, 83, 99, 114, 105, 112, 116, 83, 111, 117, 114, 99,
+101, 80, 111, 115, 105, 116, 105, 111, 110, 61, 102, 117, 110, 99, 116, 105,
+111, 110, 40, 116, 44, 119, 44, 120, 41, 123, 10, 118, 97, 114, 32, 122, 61, 37,
+83, 99, 114, 105, 112, 116, 76, 111, 99, 97, 116, 105, 111, 110, 70, 114, 111,
+109, 76, 105, 110, 101, 40, 116, 44, 119, 44, 120, 44, 48, 41, 59, 10, 114, 101,
+116, 117, 114, 110, 32, 122, 63, 122, 46, 112, 111, 115, 105, 116, 105, 111,
+110, 58, 110, 117, 108, 108, 59, 10, 125, 59, 10, 107, 46, 99, 108, 101, 97,
+114, 83, 116, 101, 112, 112, 105, 110, 103, 61, 102, 117, 110, 99, 116, 105,
+111, 110, 40, 41, 123, 10, 37, 67, 108, 101, 97, 114, 83, 116, 101, 112, 112,
+105, 110, 103, 40, 41, 59, 10, 125, 59, 10, 107, 46, 115, 101, 116, 66, 114,
+101, 97, 107, 79, 110, 69, 120, 99, 101, 112, 116, 105, 111, 110, 61, 102, 117,
+110, 99, 116, 105, 111, 110, 40, 41, 123, 10, 114, 101, 116, 117, 114, 110, 32,
+37, 67, 104, 97, 110, 103, 101, 66, 114, 101, 97, 107, 79, 110, 69, 120, 99,
+101, 112, 116, 105, 111, 110, 40, 107, 46, 69, 120, 99, 101, 112, 116, 105, 111,
+110, 66, 114, 101, 97, 107, 46, 67, 97, 117, 103, 104, 116, 44, 116, 114, 117,
+101, 41, 59, 10, 125, 59, 10, 107, 46, 99, 108, 101, 97, 114, 66, 114, 101, 97,
+107, 79, 110, 69, 120, 99, 101, 112, 116, 105, 111, 110, 61, 102, 117, 110, 99,
+116, 105, 111, 110, 40, 41, 123, 10, 114, 101, 116, 117, 114, 110, 32, 37, 67,
+104, 97, 110, 103, 101, 66, 114, 101, 97, 107, 79, 110, 69, 120, 99, 101, 112,
+116, 105, 111, 110, 40, 107, 46, 69, 120, 99, 101, 112, 116, 105, 111, 110, 66,
+114, 101, 97, 107, 46, 67, 97, 117, 103, 104, 116, 44, 102, 97, 108, 115, 101,
+41, 59, 10, 125, 59, 10, 107, 46, 105, 115, 66, 114, 101, 97, 107, 79, 110, 69,
+120, 99, 101, 112, 116, 105, 111, 110, 61, 102, 117, 110, 99, 116, 105, 111,
+110, 40, 41, 123, 10, 114, 101, 116, 117, 114, 110, 33, 33, 37, 73, 115, 66,
+114, 101, 97, 107, 79, 110, 69, 120, 99, 101, 112, 116, 105, 111, 110, 40, 107,
+46, 69, 120, 99, 101, 112, 116, 105, 111, 110, 66, 114, 101, 97, 107, 46, 67,
+97, 117, 103, 104, 116, 41, 59, 10, 125, 59, 10, 107, 46, 115, 101, 116, 66,
+114, 101, 97, 107, 79, 110, 85, 110, 99, 97, 117, 103, 104, 116, 69, 120, 99,
+101, 112, 116, 105, 111, 110, 61, 102, 117, 110, 99, 116, 105, 111, 110, 40, 41,
+123, 10, 114, 101, 116, 117, 114, 110, 32, 37, 67, 104, 97, 110, 103, 101, 66,
+114, 101, 97, 107, 79, 110, 69, 120, 99, 101, 112, 116, 105, 111, 110, 40, 107,
+46, 69, 120, 99, 101, 112, 116, 105, 111, 110, 66, 114, 101, 97, 107, 46, 85,
+110, 99, 97, 117, 103, 104, 116, 44, 116, 114, 117, 101, 41, 59, 10, 125, 59,
+10, 107, 46, 99, 108, 101, 97, 114, 66, 114, 101, 97, 107, 79, 110, 85, 110, 99,
+97, 117, 103, 104, 116, 69, 120, 99, 101, 112, 116, 105, 111, 110, 61, 102, 117,
+110, 99, 116, 105, 111, 110, 40, 41, 123, 10, 114, 101, 116, 117, 114, 110, 32,
+37, 67, 104, 97, 110, 103, 101, 66, 114, 101, 97, 107, 79, 110, 69, 120, 99,
+101, 112, 116, 105, 111, 110, 40, 107, 46, 69, 120, 99, 101, 112, 116, 105, 111,
+110, 66, 114, 101, 97, 107, 46, 85, 110, 99, 97, 117, 103, 104, 116, 44, 102,
+97, 108, 115, 101, 41, 59, 10, 125, 59, 10, 107, 46, 105, 115, 66, 114, 101, 97,
+107, 79, 110, 85, 110, 99, 97, 117, 103, 104, 116, 69, 120, 99, 101, 112, 116,
+105, 111, 110, 61, 102, 117, 110, 99, 116, 105, 111, 110, 40, 41, 123, 10, 114,
+101, 116, 117, 114, 110, 33, 33, 37, 73, 115, 66, 114, 101, 97, 107, 79, 110,
+69, 120, 99, 101, 112, 116, 105, 111, 110, 40, 107, 46, 69, 120, 99, 101, 112,
+116, 105, 111, 110, 66, 114, 101, 97, 107, 46, 85, 110, 99, 97, 117, 103, 104,
+116, 41, 59, 10, 125, 59, 10, 107, 46, 115, 99, 114, 105, 112, 116, 115, 61,
+102, 117, 110, 99, 116, 105, 111, 110, 40, 41, 123, 10, 114, 101, 116, 117, 114,
+110, 32, 37, 68, 101, 98, 117, 103, 71, 101, 116, 76, 111, 97, 100, 101, 100,
+83, 99, 114, 105, 112, 116, 115, 40, 41, 59, 10, 125, 59, 10, 102, 117, 110, 99,
+116, 105, 111, 110, 32, 115, 99, 114, 105, 112, 116, 66, 121, 73, 100, 40, 65,
+41, 123, 10, 118, 97, 114, 32, 112, 61, 107, 46, 115, 99, 114, 105, 112, 116,
+115, 40, 41, 59, 10, 102, 111, 114, 40, 118, 97, 114, 32, 116, 32, 111, 102, 32,
+112, 41, 123, 10, 105, 102, 40, 116, 46, 105, 100, 61, 61, 65, 41, 114, 101,
+116, 117, 114, 110, 32, 116, 59, 10, 125, 10, 114, 101, 116, 117, 114, 110, 40,
+118, 111, 105, 100, 32, 48, 41, 59, 10, 125, 59, 10, 107, 46, 100, 101, 98, 117,
+103, 103, 101, 114, 70, 108, 97, 103, 115, 61, 102, 117, 110, 99, 116, 105, 111,
+110, 40, 41, 123, 10, 114, 101, 116, 117, 114, 110, 32, 109, 59, 10, 125, 59,
+10, 107, 46, 77, 97, 107, 101, 77, 105, 114, 114, 111, 114, 61, 103, 59, 10,
+102, 117, 110, 99, 116, 105, 111, 110, 32, 77, 97, 107, 101, 69, 120, 101, 99,
+117, 116, 105, 111, 110, 83, 116, 97, 116, 101, 40, 66, 41, 123, 10, 114, 101,
+116, 117, 114, 110, 32, 110, 101, 119, 32, 69, 120, 101, 99, 117, 116, 105, 111,
+110, 83, 116, 97, 116, 101, 40, 66, 41, 59, 10, 125, 10, 102, 117, 110, 99, 116,
+105, 111, 110, 32, 69, 120, 101, 99, 117, 116, 105, 111, 110, 83, 116, 97, 116,
+101, 40, 66, 41, 123, 10, 116, 104, 105, 115, 46, 98, 114, 101, 97, 107, 95,
+105, 100, 61, 66, 59, 10, 116, 104, 105, 115, 46, 115, 101, 108, 101, 99, 116,
+101, 100, 95, 102, 114, 97, 109, 101, 61, 48, 59, 10, 125, 10, 69, 120, 101, 99,
+117, 116, 105, 111, 110, 83, 116, 97, 116, 101, 46, 112, 114, 111, 116, 111,
+116, 121, 112, 101, 46, 112, 114, 101, 112, 97, 114, 101, 83, 116, 101, 112, 61,
+102, 117, 110, 99, 116, 105, 111, 110, 40, 67, 41, 123, 10, 105, 102, 40, 67,
+61, 61, 61, 107, 46, 83, 116, 101, 112, 65, 99, 116, 105, 111, 110, 46, 83, 116,
+101, 112, 73, 110, 124, 124, 10, 67, 61, 61, 61, 107, 46, 83, 116, 101, 112, 65,
+99, 116, 105, 111, 110, 46, 83, 116, 101, 112, 79, 117, 116, 124, 124, 10, 67,
+61, 61, 61, 107, 46, 83, 116, 101, 112, 65, 99, 116, 105, 111, 110, 46, 83, 116,
+101, 112, 78, 101, 120, 116, 41, 123, 10, 114, 101, 116, 117, 114, 110, 32, 37,
+80, 114, 101, 112, 97, 114, 101, 83, 116, 101, 112, 40, 116, 104, 105, 115, 46,
+98, 114, 101, 97, 107, 95, 105, 100, 44, 67, 41, 59, 10, 125, 10, 116, 104, 114,
+111, 119, 32, 37, 109, 97, 107, 101, 95, 116, 121, 112, 101, 95, 101, 114, 114,
+111, 114, 40, 52, 55, 41, 59, 10, 125, 59, 10, 69, 120, 101, 99, 117, 116, 105,
+111, 110, 83, 116, 97, 116, 101, 46, 112, 114, 111, 116, 111, 116, 121, 112,
+101, 46, 101, 118, 97, 108, 117, 97, 116, 101, 71, 108, 111, 98, 97, 108, 61,
+102, 117, 110, 99, 116, 105, 111, 110, 40, 68, 41, 123, 10, 114, 101, 116, 117,
+114, 110, 32, 103, 40, 37, 68, 101, 98, 117, 103, 69, 118, 97, 108, 117, 97,
+116, 101, 71, 108, 111, 98, 97, 108, 40, 116, 104, 105, 115, 46, 98, 114, 101,
+97, 107, 95, 105, 100, 44, 68, 41, 41, 59, 10, 125, 59, 10, 69, 120, 101, 99,
+117, 116, 105, 111, 110, 83, 116, 97, 116, 101, 46, 112, 114, 111, 116, 111,
+116, 121, 112, 101, 46, 102, 114, 97, 109, 101, 67, 111, 117, 110, 116, 61, 102,
+117, 110, 99, 116, 105, 111, 110, 40, 41, 123, 10, 114, 101, 116, 117, 114, 110,
+32, 37, 71, 101, 116, 70, 114, 97, 109, 101, 67, 111, 117, 110, 116, 40, 116,
+104, 105, 115, 46, 98, 114, 101, 97, 107, 95, 105, 100, 41, 59, 10, 125, 59, 10,
+69, 120, 101, 99, 117, 116, 105, 111, 110, 83, 116, 97, 116, 101, 46, 112, 114,
+111, 116, 111, 116, 121, 112, 101, 46, 102, 114, 97, 109, 101, 61, 102, 117,
+110, 99, 116, 105, 111, 110, 40, 69, 41, 123, 10, 105, 102, 40, 69, 61, 61, 110,
+117, 108, 108, 41, 69, 61, 116, 104, 105, 115, 46, 115, 101, 108, 101, 99, 116,
+101, 100, 95, 102, 114, 97, 109, 101, 59, 10, 105, 102, 40, 69, 60, 48, 124,
+124, 69, 62, 61, 116, 104, 105, 115, 46, 102, 114, 97, 109, 101, 67, 111, 117,
+110, 116, 40, 41, 41, 123, 10, 116, 104, 114, 111, 119, 32, 37, 109, 97, 107,
+101, 95, 116, 121, 112, 101, 95, 101, 114, 114, 111, 114, 40, 52, 54, 41, 59,
+10, 125, 10, 114, 101, 116, 117, 114, 110, 32, 110, 101, 119, 32, 99, 40, 116,
+104, 105, 115, 46, 98, 114, 101, 97, 107, 95, 105, 100, 44, 69, 41, 59, 10, 125,
+59, 10, 69, 120, 101, 99, 117, 116, 105, 111, 110, 83, 116, 97, 116, 101, 46,
+112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 115, 101, 116, 83, 101, 108,
+101, 99, 116, 101, 100, 70, 114, 97, 109, 101, 61, 102, 117, 110, 99, 116, 105,
+111, 110, 40, 70, 41, 123, 10, 118, 97, 114, 32, 115, 61, 40, 37, 95, 84, 111,
+78, 117, 109, 98, 101, 114, 40, 70, 41, 41, 59, 10, 105, 102, 40, 115, 60, 48,
+124, 124, 115, 62, 61, 116, 104, 105, 115, 46, 102, 114, 97, 109, 101, 67, 111,
+117, 110, 116, 40, 41, 41, 123, 10, 116, 104, 114, 111, 119, 32, 37, 109, 97,
+107, 101, 95, 116, 121, 112, 101, 95, 101, 114, 114, 111, 114, 40, 52, 54, 41,
+59, 10, 125, 10, 116, 104, 105, 115, 46, 115, 101, 108, 101, 99, 116, 101, 100,
+95, 102, 114, 97, 109, 101, 61, 115, 59, 10, 125, 59, 10, 69, 120, 101, 99, 117,
+116, 105, 111, 110, 83, 116, 97, 116, 101, 46, 112, 114, 111, 116, 111, 116,
+121, 112, 101, 46, 115, 101, 108, 101, 99, 116, 101, 100, 70, 114, 97, 109, 101,
+61, 102, 117, 110, 99, 116, 105, 111, 110, 40, 41, 123, 10, 114, 101, 116, 117,
+114, 110, 32, 116, 104, 105, 115, 46, 115, 101, 108, 101, 99, 116, 101, 100, 95,
+102, 114, 97, 109, 101, 59, 10, 125, 59, 10, 102, 117, 110, 99, 116, 105, 111,
+110, 32, 77, 97, 107, 101, 69, 120, 99, 101, 112, 116, 105, 111, 110, 69, 118,
+101, 110, 116, 40, 66, 44, 71, 44, 72, 44, 73, 41, 123, 10, 114, 101, 116, 117,
+114, 110, 32, 110, 101, 119, 32, 69, 120, 99, 101, 112, 116, 105, 111, 110, 69,
+118, 101, 110, 116, 40, 66, 44, 71, 44, 72, 44, 73, 41, 59, 10, 125, 10, 102,
+117, 110, 99, 116, 105, 111, 110, 32, 69, 120, 99, 101, 112, 116, 105, 111, 110,
+69, 118, 101, 110, 116, 40, 66, 44, 71, 44, 72, 44, 73, 41, 123, 10, 116, 104,
+105, 115, 46, 101, 120, 101, 99, 95, 115, 116, 97, 116, 101, 95, 61, 110, 101,
+119, 32, 69, 120, 101, 99, 117, 116, 105, 111, 110, 83, 116, 97, 116, 101, 40,
+66, 41, 59, 10, 116, 104, 105, 115, 46, 101, 120, 99, 101, 112, 116, 105, 111,
+110, 95, 61, 71, 59, 10, 116, 104, 105, 115, 46, 117, 110, 99, 97, 117, 103,
+104, 116, 95, 61, 72, 59, 10, 116, 104, 105, 115, 46, 112, 114, 111, 109, 105,
+115, 101, 95, 61, 73, 59, 10, 125, 10, 69, 120, 99, 101, 112, 116, 105, 111,
+110, 69, 118, 101, 110, 116, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101,
+46, 101, 118, 101, 110, 116, 84, 121, 112, 101, 61, 102, 117, 110, 99, 116, 105,
+111, 110, 40, 41, 123, 10, 114, 101, 116, 117, 114, 110, 32, 107, 46, 68, 101,
+98, 117, 103, 69, 118, 101, 110, 116, 46, 69, 120, 99, 101, 112, 116, 105, 111,
+110, 59, 10, 125, 59, 10, 69, 120, 99, 101, 112, 116, 105, 111, 110, 69, 118,
+101, 110, 116, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 101, 120,
+99, 101, 112, 116, 105, 111, 110, 61, 102, 117, 110, 99, 116, 105, 111, 110, 40,
+41, 123, 10, 114, 101, 116, 117, 114, 110, 32, 116, 104, 105, 115, 46, 101, 120,
+99, 101, 112, 116, 105, 111, 110, 95, 59, 10, 125, 59, 10, 69, 120, 99, 101,
+112, 116, 105, 111, 110, 69, 118, 101, 110, 116, 46, 112, 114, 111, 116, 111,
+116, 121, 112, 101, 46, 117, 110, 99, 97, 117, 103, 104, 116, 61, 102, 117, 110,
+99, 116, 105, 111, 110, 40, 41, 123, 10, 114, 101, 116, 117, 114, 110, 32, 116,
+104, 105, 115, 46, 117, 110, 99, 97, 117, 103, 104, 116, 95, 59, 10, 125, 59,
+10, 69, 120, 99, 101, 112, 116, 105, 111, 110, 69, 118, 101, 110, 116, 46, 112,
+114, 111, 116, 111, 116, 121, 112, 101, 46, 112, 114, 111, 109, 105, 115, 101,
+61, 102, 117, 110, 99, 116, 105, 111, 110, 40, 41, 123, 10, 114, 101, 116, 117,
+114, 110, 32, 116, 104, 105, 115, 46, 112, 114, 111, 109, 105, 115, 101, 95, 59,
+10, 125, 59, 10, 69, 120, 99, 101, 112, 116, 105, 111, 110, 69, 118, 101, 110,
+116, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 102, 117, 110, 99, 61,
+102, 117, 110, 99, 116, 105, 111, 110, 40, 41, 123, 10, 114, 101, 116, 117, 114,
+110, 32, 116, 104, 105, 115, 46, 101, 120, 101, 99, 95, 115, 116, 97, 116, 101,
+95, 46, 102, 114, 97, 109, 101, 40, 48, 41, 46, 102, 117, 110, 99, 40, 41, 59,
+10, 125, 59, 10, 69, 120, 99, 101, 112, 116, 105, 111, 110, 69, 118, 101, 110,
+116, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 115, 111, 117, 114,
+99, 101, 76, 105, 110, 101, 61, 102, 117, 110, 99, 116, 105, 111, 110, 40, 41,
+123, 10, 114, 101, 116, 117, 114, 110, 32, 116, 104, 105, 115, 46, 101, 120,
+101, 99, 95, 115, 116, 97, 116, 101, 95, 46, 102, 114, 97, 109, 101, 40, 48, 41,
+46, 115, 111, 117, 114, 99, 101, 76, 105, 110, 101, 40, 41, 59, 10, 125, 59, 10,
+69, 120, 99, 101, 112, 116, 105, 111, 110, 69, 118, 101, 110, 116, 46, 112, 114,
+111, 116, 111, 116, 121, 112, 101, 46, 115, 111, 117, 114, 99, 101, 67, 111,
+108, 117, 109, 110, 61, 102, 117, 110, 99, 116, 105, 111, 110, 40, 41, 123, 10,
+114, 101, 116, 117, 114, 110, 32, 116, 104, 105, 115, 46, 101, 120, 101, 99, 95,
+115, 116, 97, 116, 101, 95, 46, 102, 114, 97, 109, 101, 40, 48, 41, 46, 115,
+111, 117, 114, 99, 101, 67, 111, 108, 117, 109, 110, 40, 41, 59, 10, 125, 59,
+10, 69, 120, 99, 101, 112, 116, 105, 111, 110, 69, 118, 101, 110, 116, 46, 112,
+114, 111, 116, 111, 116, 121, 112, 101, 46, 115, 111, 117, 114, 99, 101, 76,
+105, 110, 101, 84, 101, 120, 116, 61, 102, 117, 110, 99, 116, 105, 111, 110, 40,
+41, 123, 10, 114, 101, 116, 117, 114, 110, 32, 116, 104, 105, 115, 46, 101, 120,
+101, 99, 95, 115, 116, 97, 116, 101, 95, 46, 102, 114, 97, 109, 101, 40, 48, 41,
+46, 115, 111, 117, 114, 99, 101, 76, 105, 110, 101, 84, 101, 120, 116, 40, 41,
+59, 10, 125, 59, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 77, 97, 107,
+101, 67, 111, 109, 112, 105, 108, 101, 69, 118, 101, 110, 116, 40, 116, 44, 108,
+41, 123, 10, 114, 101, 116, 117, 114, 110, 32, 110, 101, 119, 32, 67, 111, 109,
+112, 105, 108, 101, 69, 118, 101, 110, 116, 40, 116, 44, 108, 41, 59, 10, 125,
+10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 67, 111, 109, 112, 105, 108, 101,
+69, 118, 101, 110, 116, 40, 116, 44, 108, 41, 123, 10, 116, 104, 105, 115, 46,
+115, 99, 114, 105, 112, 116, 95, 61, 103, 40, 116, 41, 59, 10, 116, 104, 105,
+115, 46, 116, 121, 112, 101, 95, 61, 108, 59, 10, 125, 10, 67, 111, 109, 112,
+105, 108, 101, 69, 118, 101, 110, 116, 46, 112, 114, 111, 116, 111, 116, 121,
+112, 101, 46, 101, 118, 101, 110, 116, 84, 121, 112, 101, 61, 102, 117, 110, 99,
+116, 105, 111, 110, 40, 41, 123, 10, 114, 101, 116, 117, 114, 110, 32, 116, 104,
+105, 115, 46, 116, 121, 112, 101, 95, 59, 10, 125, 59, 10, 67, 111, 109, 112,
+105, 108, 101, 69, 118, 101, 110, 116, 46, 112, 114, 111, 116, 111, 116, 121,
+112, 101, 46, 115, 99, 114, 105, 112, 116, 61, 102, 117, 110, 99, 116, 105, 111,
+110, 40, 41, 123, 10, 114, 101, 116, 117, 114, 110, 32, 116, 104, 105, 115, 46,
+115, 99, 114, 105, 112, 116, 95, 59, 10, 125, 59, 10, 102, 117, 110, 99, 116,
+105, 111, 110, 32, 77, 97, 107, 101, 83, 99, 114, 105, 112, 116, 79, 98, 106,
+101, 99, 116, 95, 40, 116, 44, 74, 41, 123, 10, 118, 97, 114, 32, 75, 61, 123,
+105, 100, 58, 116, 46, 105, 100, 40, 41, 44, 10, 110, 97, 109, 101, 58, 116, 46,
+110, 97, 109, 101, 40, 41, 44, 10, 108, 105, 110, 101, 79, 102, 102, 115, 101,
+116, 58, 116, 46, 108, 105, 110, 101, 79, 102, 102, 115, 101, 116, 40, 41, 44,
+10, 99, 111, 108, 117, 109, 110, 79, 102, 102, 115, 101, 116, 58, 116, 46, 99,
+111, 108, 117, 109, 110, 79, 102, 102, 115, 101, 116, 40, 41, 44, 10, 108, 105,
+110, 101, 67, 111, 117, 110, 116, 58, 116, 46, 108, 105, 110, 101, 67, 111, 117,
+110, 116, 40, 41, 44, 10, 125, 59, 10, 105, 102, 40, 33, 40, 116, 46, 100, 97,
+116, 97, 40, 41, 61, 61, 61, 40, 118, 111, 105, 100, 32, 48, 41, 41, 41, 123,
+10, 75, 46, 100, 97, 116, 97, 61, 116, 46, 100, 97, 116, 97, 40, 41, 59, 10,
+125, 10, 105, 102, 40, 74, 41, 123, 10, 75, 46, 115, 111, 117, 114, 99, 101, 61,
+116, 46, 115, 111, 117, 114, 99, 101, 40, 41, 59, 10, 125, 10, 114, 101, 116,
+117, 114, 110, 32, 75, 59, 10, 125, 10, 102, 117, 110, 99, 116, 105, 111, 110,
+32, 77, 97, 107, 101, 65, 115, 121, 110, 99, 84, 97, 115, 107, 69, 118, 101,
+110, 116, 40, 108, 44, 76, 41, 123, 10, 114, 101, 116, 117, 114, 110, 32, 110,
+101, 119, 32, 65, 115, 121, 110, 99, 84, 97, 115, 107, 69, 118, 101, 110, 116,
+40, 108, 44, 76, 41, 59, 10, 125, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32,
+65, 115, 121, 110, 99, 84, 97, 115, 107, 69, 118, 101, 110, 116, 40, 108, 44,
+76, 41, 123, 10, 116, 104, 105, 115, 46, 116, 121, 112, 101, 95, 61, 108, 59,
+10, 116, 104, 105, 115, 46, 105, 100, 95, 61, 76, 59, 10, 125, 10, 65, 115, 121,
+110, 99, 84, 97, 115, 107, 69, 118, 101, 110, 116, 46, 112, 114, 111, 116, 111,
+116, 121, 112, 101, 46, 116, 121, 112, 101, 61, 102, 117, 110, 99, 116, 105,
+111, 110, 40, 41, 123, 10, 114, 101, 116, 117, 114, 110, 32, 116, 104, 105, 115,
+46, 116, 121, 112, 101, 95, 59, 10, 125, 10, 65, 115, 121, 110, 99, 84, 97, 115,
+107, 69, 118, 101, 110, 116, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101,
+46, 105, 100, 61, 102, 117, 110, 99, 116, 105, 111, 110, 40, 41, 123, 10, 114,
+101, 116, 117, 114, 110, 32, 116, 104, 105, 115, 46, 105, 100, 95, 59, 10, 125,
+10, 98, 46, 73, 110, 115, 116, 97, 108, 108, 67, 111, 110, 115, 116, 97, 110,
+116, 115, 40, 97, 44, 91, 10, 34, 68, 101, 98, 117, 103, 34, 44, 107, 44, 10,
+34, 67, 111, 109, 112, 105, 108, 101, 69, 118, 101, 110, 116, 34, 44, 67, 111,
+109, 112, 105, 108, 101, 69, 118, 101, 110, 116, 44, 10, 93, 41, 59, 10, 98, 46,
+73, 110, 115, 116, 97, 108, 108, 67, 111, 110, 115, 116, 97, 110, 116, 115, 40,
+98, 44, 91, 10, 34, 77, 97, 107, 101, 69, 120, 101, 99, 117, 116, 105, 111, 110,
+83, 116, 97, 116, 101, 34, 44, 77, 97, 107, 101, 69, 120, 101, 99, 117, 116,
+105, 111, 110, 83, 116, 97, 116, 101, 44, 10, 34, 77, 97, 107, 101, 69, 120, 99,
+101, 112, 116, 105, 111, 110, 69, 118, 101, 110, 116, 34, 44, 77, 97, 107, 101,
+69, 120, 99, 101, 112, 116, 105, 111, 110, 69, 118, 101, 110, 116, 44, 10, 34,
+77, 97, 107, 101, 67, 111, 109, 112, 105, 108, 101, 69, 118, 101, 110, 116, 34,
+44, 77, 97, 107, 101, 67, 111, 109, 112, 105, 108, 101, 69, 118, 101, 110, 116,
+44, 10, 34, 77, 97, 107, 101, 65, 115, 121, 110, 99, 84, 97, 115, 107, 69, 118,
+101, 110, 116, 34, 44, 77, 97, 107, 101, 65, 115, 121, 110, 99, 84, 97, 115,
+107, 69, 118, 101, 110, 116, 44, 10, 93, 41, 59, 10, 125, 41, 10, 10, 10, 40,
+102, 117, 110, 99, 116, 105, 111, 110, 40, 97, 44, 98, 41, 123, 10, 34, 117,
+115, 101, 32, 115, 116, 114, 105, 99, 116, 34, 59, 10, 118, 97, 114, 32, 99, 61,
+97, 46, 68, 101, 98, 117, 103, 46, 102, 105, 110, 100, 83, 99, 114, 105, 112,
+116, 83, 111, 117, 114, 99, 101, 80, 111, 115, 105, 116, 105, 111, 110, 59, 10,
+118, 97, 114, 32, 100, 61, 97, 46, 65, 114, 114, 97, 121, 59, 10, 118, 97, 114,
+32, 101, 61, 97, 46, 77, 97, 116, 104, 46, 102, 108, 111, 111, 114, 59, 10, 118,
+97, 114, 32, 102, 61, 97, 46, 77, 97, 116, 104, 46, 109, 97, 120, 59, 10, 118,
+97, 114, 32, 103, 61, 97, 46, 83, 121, 110, 116, 97, 120, 69, 114, 114, 111,
+114, 59, 10, 118, 97, 114, 32, 104, 59, 10, 102, 117, 110, 99, 116, 105, 111,
+110, 32, 65, 112, 112, 108, 121, 80, 97, 116, 99, 104, 77, 117, 108, 116, 105,
+67, 104, 117, 110, 107, 40, 115, 99, 114, 105, 112, 116, 44, 100, 105, 102, 102,
+95, 97, 114, 114, 97, 121, 44, 110, 101, 119, 95, 115, 111, 117, 114, 99, 101,
+44, 112, 114, 101, 118, 105, 101, 119, 95, 111, 110, 108, 121, 44, 10, 99, 104,
+97, 110, 103, 101, 95, 108, 111, 103, 41, 123, 10, 118, 97, 114, 32, 105, 61,
+115, 99, 114, 105, 112, 116, 46, 115, 111, 117, 114, 99, 101, 59, 10, 118, 97,
+114, 32, 106, 61, 71, 97, 116, 104, 101, 114, 67, 111, 109, 112, 105, 108, 101,
+73, 110, 102, 111, 40, 105, 44, 115, 99, 114, 105, 112, 116, 41, 59, 10, 118,
+97, 114, 32, 107, 61, 66, 117, 105, 108, 100, 67, 111, 100, 101, 73, 110, 102,
+111, 84, 114, 101, 101, 40, 106, 41, 59, 10, 118, 97, 114, 32, 108, 61, 110,
+101, 119, 32, 80, 111, 115, 84, 114, 97, 110, 115, 108, 97, 116, 111, 114, 40,
+100, 105, 102, 102, 95, 97, 114, 114, 97, 121, 41, 59, 10, 77, 97, 114, 107, 67,
+104, 97, 110, 103, 101, 100, 70, 117, 110, 99, 116, 105, 111, 110, 115, 40, 107,
+44, 108, 46, 71, 101, 116, 67, 104, 117, 110, 107, 115, 40, 41, 41, 59, 10, 70,
+105, 110, 100, 76, 105, 118, 101, 83, 104, 97, 114, 101, 100, 73, 110, 102, 111,
+115, 40, 107, 44, 115, 99, 114, 105, 112, 116, 41, 59, 10, 118, 97, 114, 32,
+109, 59, 10, 116, 114, 121, 123, 10, 109, 61, 71, 97, 116, 104, 101, 114, 67,
+111, 109, 112, 105, 108, 101, 73, 110, 102, 111, 40, 110, 101, 119, 95, 115,
+111, 117, 114, 99, 101, 44, 115, 99, 114, 105, 112, 116, 41, 59, 10, 125, 99,
+97, 116, 99, 104, 40, 101, 41, 123, 10, 118, 97, 114, 32, 110, 61, 10, 110, 101,
+119, 32, 70, 97, 105, 108, 117, 114, 101, 40, 34, 70, 97, 105, 108, 101, 100,
+32, 116, 111, 32, 99, 111, 109, 112, 105, 108, 101, 32, 110, 101, 119, 32, 118,
+101, 114, 115, 105, 111, 110, 32, 111, 102, 32, 115, 99, 114, 105, 112, 116, 58,
+32, 34, 43, 101, 41, 59, 10, 105, 102, 40, 101, 32, 105, 110, 115, 116, 97, 110,
+99, 101, 111, 102, 32, 103, 41, 123, 10, 118, 97, 114, 32, 111, 61, 123, 10,
+116, 121, 112, 101, 58, 34, 108, 105, 118, 101, 101, 100, 105, 116, 95, 99, 111,
+109, 112, 105, 108, 101, 95, 101, 114, 114, 111, 114, 34, 44, 10, 115, 121, 110,
+116, 97, 120, 69, 114, 114, 111, 114, 77, 101, 115, 115, 97, 103, 101, 58, 101,
+46, 109, 101, 115, 115, 97, 103, 101, 10, 125, 59, 10, 67, 111, 112, 121, 69,
+114, 114, 111, 114, 80, 111, 115, 105, 116, 105, 111, 110, 84, 111, 68, 101,
+116, 97, 105, 108, 115, 40, 101, 44, 111, 41, 59, 10, 110, 46, 100, 101, 116,
+97, 105, 108, 115, 61, 111, 59, 10, 125, 10, 116, 104, 114, 111, 119, 32, 110,
+59, 10, 125, 10, 118, 97, 114, 32, 112, 61, 109, 46, 114, 101, 100, 117, 99,
+101, 40, 10, 40, 109, 97, 120, 44, 105, 110, 102, 111, 41, 61, 62, 102, 40, 109,
+97, 120, 44, 105, 110, 102, 111, 46, 102, 117, 110, 99, 116, 105, 111, 110, 95,
+108, 105, 116, 101, 114, 97, 108, 95, 105, 100, 41, 44, 48, 41, 59, 10, 118, 97,
+114, 32, 113, 61, 66, 117, 105, 108, 100, 67, 111, 100, 101, 73, 110, 102, 111,
+84, 114, 101, 101, 40, 109, 41, 59, 10, 70, 105, 110, 100, 67, 111, 114, 114,
+101, 115, 112, 111, 110, 100, 105, 110, 103, 70, 117, 110, 99, 116, 105, 111,
+110, 115, 40, 107, 44, 113, 41, 59, 10, 118, 97, 114, 32, 114, 61, 110, 101,
+119, 32, 100, 40, 41, 59, 10, 118, 97, 114, 32, 115, 61, 110, 101, 119, 32, 100,
+40, 41, 59, 10, 118, 97, 114, 32, 116, 61, 110, 101, 119, 32, 100, 40, 41, 59,
+10, 118, 97, 114, 32, 117, 61, 110, 101, 119, 32, 100, 40, 41, 59, 10, 102, 117,
+110, 99, 116, 105, 111, 110, 32, 72, 97, 114, 118, 101, 115, 116, 84, 111, 100,
+111, 40, 118, 41, 123, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 67, 111,
+108, 108, 101, 99, 116, 68, 97, 109, 97, 103, 101, 100, 40, 119, 41, 123, 10,
+115, 46, 112, 117, 115, 104, 40, 119, 41, 59, 10, 102, 111, 114, 40, 118, 97,
+114, 32, 120, 61, 48, 59, 120, 60, 119, 46, 99, 104, 105, 108, 100, 114, 101,
+110, 46, 108, 101, 110, 103, 116, 104, 59, 120, 43, 43, 41, 123, 10, 67, 111,
+108, 108, 101, 99, 116, 68, 97, 109, 97, 103, 101, 100, 40, 119, 46, 99, 104,
+105, 108, 100, 114, 101, 110, 91, 120, 93, 41, 59, 10, 125, 10, 125, 10, 102,
+117, 110, 99, 116, 105, 111, 110, 32, 67, 111, 108, 108, 101, 99, 116, 78, 101,
+119, 40, 121, 41, 123, 10, 102, 111, 114, 40, 118, 97, 114, 32, 120, 61, 48, 59,
+120, 60, 121, 46, 108, 101, 110, 103, 116, 104, 59, 120, 43, 43, 41, 123, 10,
+116, 46, 112, 117, 115, 104, 40, 121, 91, 120, 93, 41, 59, 10, 67, 111, 108,
+108, 101, 99, 116, 78, 101, 119, 40, 121, 91, 120, 93, 46, 99, 104, 105, 108,
+100, 114, 101, 110, 41, 59, 10, 125, 10, 125, 10, 105, 102, 40, 118, 46, 115,
+116, 97, 116, 117, 115, 61, 61, 104, 46, 68, 65, 77, 65, 71, 69, 68, 41, 123,
+10, 67, 111, 108, 108, 101, 99, 116, 68, 97, 109, 97, 103, 101, 100, 40, 118,
+41, 59, 10, 114, 101, 116, 117, 114, 110, 59, 10, 125, 10, 105, 102, 40, 118,
+46, 115, 116, 97, 116, 117, 115, 61, 61, 104, 46, 85, 78, 67, 72, 65, 78, 71,
+69, 68, 41, 123, 10, 117, 46, 112, 117, 115, 104, 40, 118, 41, 59, 10, 125, 101,
+108, 115, 101, 32, 105, 102, 40, 118, 46, 115, 116, 97, 116, 117, 115, 61, 61,
+104, 46, 83, 79, 85, 82, 67, 69, 95, 67, 72, 65, 78, 71, 69, 68, 41, 123, 10,
+117, 46, 112, 117, 115, 104, 40, 118, 41, 59, 10, 125, 101, 108, 115, 101, 32,
+105, 102, 40, 118, 46, 115, 116, 97, 116, 117, 115, 61, 61, 104, 46, 67, 72, 65,
+78, 71, 69, 68, 41, 123, 10, 114, 46, 112, 117, 115, 104, 40, 118, 41, 59, 10,
+67, 111, 108, 108, 101, 99, 116, 78, 101, 119, 40, 118, 46, 117, 110, 109, 97,
+116, 99, 104, 101, 100, 95, 110, 101, 119, 95, 110, 111, 100, 101, 115, 41, 59,
+10, 125, 10, 102, 111, 114, 40, 118, 97, 114, 32, 120, 61, 48, 59, 120, 60, 118,
+46, 99, 104, 105, 108, 100, 114, 101, 110, 46, 108, 101, 110, 103, 116, 104, 59,
+120, 43, 43, 41, 123, 10, 72, 97, 114, 118, 101, 115, 116, 84, 111, 100, 111,
+40, 118, 46, 99, 104, 105, 108, 100, 114, 101, 110, 91, 120, 93, 41, 59, 10,
+125, 10, 125, 10, 118, 97, 114, 32, 122, 61, 123, 10, 99, 104, 97, 110, 103,
+101, 95, 116, 114, 101, 101, 58, 68, 101, 115, 99, 114, 105, 98, 101, 67, 104,
+97, 110, 103, 101, 84, 114, 101, 101, 40, 107, 41, 44, 10, 116, 101, 120, 116,
+117, 97, 108, 95, 100, 105, 102, 102, 58, 123, 10, 111, 108, 100, 95, 108, 101,
+110, 58, 105, 46, 108, 101, 110, 103, 116, 104, 44, 10, 110, 101, 119, 95, 108,
+101, 110, 58, 110, 101, 119, 95, 115, 111, 117, 114, 99, 101, 46, 108, 101, 110,
+103, 116, 104, 44, 10, 99, 104, 117, 110, 107, 115, 58, 100, 105, 102, 102, 95,
+97, 114, 114, 97, 121, 10, 125, 44, 10, 117, 112, 100, 97, 116, 101, 100, 58,
+102, 97, 108, 115, 101, 10, 125, 59, 10, 105, 102, 40, 112, 114, 101, 118, 105,
+101, 119, 95, 111, 110, 108, 121, 41, 123, 10, 114, 101, 116, 117, 114, 110, 32,
+122, 59, 10, 125, 10, 72, 97, 114, 118, 101, 115, 116, 84, 111, 100, 111, 40,
+107, 41, 59, 10, 118, 97, 114, 32, 65, 61, 110, 101, 119, 32, 100, 40, 41, 59,
+10, 118, 97, 114, 32, 66, 61, 110, 101, 119, 32, 100, 40, 41, 59, 10, 102, 111,
+114, 40, 118, 97, 114, 32, 120, 61, 48, 59, 120, 60, 114, 46, 108, 101, 110,
+103, 116, 104, 59, 120, 43, 43, 41, 123, 10, 118, 97, 114, 32, 67, 61, 114, 91,
+120, 93, 46, 108, 105, 118, 101, 95, 115, 104, 97, 114, 101, 100, 95, 102, 117,
+110, 99, 116, 105, 111, 110, 95, 105, 110, 102, 111, 115, 59, 10, 118, 97, 114,
+32, 68, 61, 10, 114, 91, 120, 93, 46, 99, 111, 114, 114, 101, 115, 112, 111,
+110, 100, 105, 110, 103, 95, 110, 111, 100, 101, 46, 105, 110, 102, 111, 46,
+115, 104, 97, 114, 101, 100, 95, 102, 117, 110, 99, 116, 105, 111, 110, 95, 105,
+110, 102, 111, 59, 10, 105, 102, 40, 67, 41, 123, 10, 102, 111, 114, 40, 118,
+97, 114, 32, 69, 61, 48, 59, 69, 60, 67, 46, 108, 101, 110, 103, 116, 104, 59,
+69, 43, 43, 41, 123, 10, 65, 46, 112, 117, 115, 104, 40, 67, 91, 69, 93, 41, 59,
+10, 66, 46, 112, 117, 115, 104, 40, 68, 41, 59, 10, 125, 10, 125, 10, 125, 10,
+118, 97, 114, 32, 70, 61, 10, 67, 104, 101, 99, 107, 83, 116, 97, 99, 107, 65,
+99, 116, 105, 118, 97, 116, 105, 111, 110, 115, 40, 65, 44, 10, 66, 44, 10, 99,
+104, 97, 110, 103, 101, 95, 108, 111, 103, 41, 59, 10, 122, 46, 115, 116, 97,
+99, 107, 95, 109, 111, 100, 105, 102, 105, 101, 100, 61, 70, 33, 61, 48, 59, 10,
+118, 97, 114, 32, 71, 59, 10, 105, 102, 40, 115, 46, 108, 101, 110, 103, 116,
+104, 61, 61, 48, 41, 123, 10, 37, 76, 105, 118, 101, 69, 100, 105, 116, 82, 101,
+112, 108, 97, 99, 101, 83, 99, 114, 105, 112, 116, 40, 115, 99, 114, 105, 112,
+116, 44, 110, 101, 119, 95, 115, 111, 117, 114, 99, 101, 44, 110, 117, 108, 108,
+41, 59, 10, 71, 61, 40, 118, 111, 105, 100, 32, 48, 41, 59, 10, 125, 101, 108,
+115, 101, 123, 10, 118, 97, 114, 32, 72, 61, 67, 114, 101, 97, 116, 101, 78, 97,
+109, 101, 70, 111, 114, 79, 108, 100, 83, 99, 114, 105, 112, 116, 40, 115, 99,
+114, 105, 112, 116, 41, 59, 10, 71, 61, 37, 76, 105, 118, 101, 69, 100, 105,
+116, 82, 101, 112, 108, 97, 99, 101, 83, 99, 114, 105, 112, 116, 40, 115, 99,
+114, 105, 112, 116, 44, 110, 101, 119, 95, 115, 111, 117, 114, 99, 101, 44, 72,
+41, 59, 10, 118, 97, 114, 32, 73, 61, 110, 101, 119, 32, 100, 40, 41, 59, 10,
+99, 104, 97, 110, 103, 101, 95, 108, 111, 103, 46, 112, 117, 115, 104, 40, 123,
+108, 105, 110, 107, 101, 100, 95, 116, 111, 95, 111, 108, 100, 95, 115, 99, 114,
+105, 112, 116, 58, 73, 125, 41, 59, 10, 102, 111, 114, 40, 118, 97, 114, 32,
+120, 61, 48, 59, 120, 60, 115, 46, 108, 101, 110, 103, 116, 104, 59, 120, 43,
+43, 41, 123, 10, 76, 105, 110, 107, 84, 111, 79, 108, 100, 83, 99, 114, 105,
+112, 116, 40, 115, 91, 120, 93, 44, 71, 44, 10, 73, 41, 59, 10, 125, 10, 122,
+46, 99, 114, 101, 97, 116, 101, 100, 95, 115, 99, 114, 105, 112, 116, 95, 110,
+97, 109, 101, 61, 72, 59, 10, 125, 10, 102, 111, 114, 40, 118, 97, 114, 32, 120,
+61, 48, 59, 120, 60, 114, 46, 108, 101, 110, 103, 116, 104, 59, 120, 43, 43, 41,
+123, 10, 80, 97, 116, 99, 104, 70, 117, 110, 99, 116, 105, 111, 110, 67, 111,
+100, 101, 40, 114, 91, 120, 93, 44, 99, 104, 97, 110, 103, 101, 95, 108, 111,
+103, 41, 59, 10, 125, 10, 118, 97, 114, 32, 74, 61, 110, 101, 119, 32, 100, 40,
+41, 59, 10, 99, 104, 97, 110, 103, 101, 95, 108, 111, 103, 46, 112, 117, 115,
+104, 40, 123, 112, 111, 115, 105, 116, 105, 111, 110, 95, 112, 97, 116, 99, 104,
+101, 100, 58, 74, 125, 41, 59, 10, 102, 111, 114, 40, 118, 97, 114, 32, 120, 61,
+48, 59, 120, 60, 117, 46, 108, 101, 110, 103, 116, 104, 59, 120, 43, 43, 41,
+123, 10, 80, 97, 116, 99, 104, 80, 111, 115, 105, 116, 105, 111, 110, 115, 40,
+117, 91, 120, 93, 44, 100, 105, 102, 102, 95, 97, 114, 114, 97, 121, 44, 10, 74,
+41, 59, 10, 105, 102, 40, 117, 91, 120, 93, 46, 108, 105, 118, 101, 95, 115,
+104, 97, 114, 101, 100, 95, 102, 117, 110, 99, 116, 105, 111, 110, 95, 105, 110,
+102, 111, 115, 41, 123, 10, 118, 97, 114, 32, 75, 61, 10, 117, 91, 120, 93, 10,
+46, 99, 111, 114, 114, 101, 115, 112, 111, 110, 100, 105, 110, 103, 95, 110,
+111, 100, 101, 46, 105, 110, 102, 111, 46, 102, 117, 110, 99, 116, 105, 111,
+110, 95, 108, 105, 116, 101, 114, 97, 108, 95, 105, 100, 59, 10, 117, 91, 120,
+93, 46, 108, 105, 118, 101, 95, 115, 104, 97, 114, 101, 100, 95, 102, 117, 110,
+99, 116, 105, 111, 110, 95, 105, 110, 102, 111, 115, 46, 102, 111, 114, 69, 97,
+99, 104, 40, 102, 117, 110, 99, 116, 105, 111, 110, 40, 10, 105, 110, 102, 111,
+41, 123, 10, 37, 76, 105, 118, 101, 69, 100, 105, 116, 70, 117, 110, 99, 116,
+105, 111, 110, 83, 111, 117, 114, 99, 101, 85, 112, 100, 97, 116, 101, 100, 40,
+10, 105, 110, 102, 111, 46, 114, 97, 119, 95, 97, 114, 114, 97, 121, 44, 75, 41,
+59, 10, 125, 41, 59, 10, 125, 10, 125, 10, 37, 76, 105, 118, 101, 69, 100, 105,
+116, 70, 105, 120, 117, 112, 83, 99, 114, 105, 112, 116, 40, 115, 99, 114, 105,
+112, 116, 44, 112, 41, 59, 10, 102, 111, 114, 40, 118, 97, 114, 32, 120, 61, 48,
+59, 120, 60, 116, 46, 108, 101, 110, 103, 116, 104, 59, 120, 43, 43, 41, 123,
+10, 37, 76, 105, 118, 101, 69, 100, 105, 116, 70, 117, 110, 99, 116, 105, 111,
+110, 83, 101, 116, 83, 99, 114, 105, 112, 116, 40, 10, 116, 91, 120, 93, 46,
+105, 110, 102, 111, 46, 115, 104, 97, 114, 101, 100, 95, 102, 117, 110, 99, 116,
+105, 111, 110, 95, 105, 110, 102, 111, 44, 115, 99, 114, 105, 112, 116, 41, 59,
+10, 125, 10, 122, 46, 117, 112, 100, 97, 116, 101, 100, 61, 116, 114, 117, 101,
+59, 10, 114, 101, 116, 117, 114, 110, 32, 122, 59, 10, 125, 10, 102, 117, 110,
+99, 116, 105, 111, 110, 32, 71, 97, 116, 104, 101, 114, 67, 111, 109, 112, 105,
+108, 101, 73, 110, 102, 111, 40, 76, 44, 77, 41, 123, 10, 118, 97, 114, 32, 78,
+61, 37, 76, 105, 118, 101, 69, 100, 105, 116, 71, 97, 116, 104, 101, 114, 67,
+111, 109, 112, 105, 108, 101, 73, 110, 102, 111, 40, 77, 44, 76, 41, 59, 10,
+118, 97, 114, 32, 79, 61, 110, 101, 119, 32, 100, 40, 41, 59, 10, 118, 97, 114,
+32, 80, 61, 110, 101, 119, 32, 100, 40, 41, 59, 10, 102, 111, 114, 40, 118, 97,
+114, 32, 120, 61, 48, 59, 120, 60, 78, 46, 108, 101, 110, 103, 116, 104, 59,
+120, 43, 43, 41, 123, 10, 118, 97, 114, 32, 81, 61, 110, 101, 119, 32, 70, 117,
+110, 99, 116, 105, 111, 110, 67, 111, 109, 112, 105, 108, 101, 73, 110, 102,
+111, 40, 78, 91, 120, 93, 41, 59, 10, 37, 76, 105, 118, 101, 69, 100, 105, 116,
+70, 117, 110, 99, 116, 105, 111, 110, 83, 101, 116, 83, 99, 114, 105, 112, 116,
+40, 81, 46, 115, 104, 97, 114, 101, 100, 95, 102, 117, 110, 99, 116, 105, 111,
+110, 95, 105, 110, 102, 111, 44, 40, 118, 111, 105, 100, 32, 48, 41, 41, 59, 10,
+79, 46, 112, 117, 115, 104, 40, 81, 41, 59, 10, 80, 46, 112, 117, 115, 104, 40,
+120, 41, 59, 10, 125, 10, 102, 111, 114, 40, 118, 97, 114, 32, 120, 61, 48, 59,
+120, 60, 79, 46, 108, 101, 110, 103, 116, 104, 59, 120, 43, 43, 41, 123, 10,
+118, 97, 114, 32, 82, 61, 120, 59, 10, 102, 111, 114, 40, 118, 97, 114, 32, 69,
+61, 120, 43, 49, 59, 69, 60, 79, 46, 108, 101, 110, 103, 116, 104, 59, 69, 43,
+43, 41, 123, 10, 105, 102, 40, 79, 91, 82, 93, 46, 115, 116, 97, 114, 116, 95,
+112, 111, 115, 105, 116, 105, 111, 110, 62, 79, 91, 69, 93, 46, 115, 116, 97,
+114, 116, 95, 112, 111, 115, 105, 116, 105, 111, 110, 41, 123, 10, 82, 61, 69,
+59, 10, 125, 10, 125, 10, 105, 102, 40, 82, 33, 61, 120, 41, 123, 10, 118, 97,
+114, 32, 83, 61, 79, 91, 82, 93, 59, 10, 118, 97, 114, 32, 84, 61, 80, 91, 82,
+93, 59, 10, 79, 91, 82, 93, 61, 79, 91, 120, 93, 59, 10, 80, 91, 82, 93, 61, 80,
+91, 120, 93, 59, 10, 79, 91, 120, 93, 61, 83, 59, 10, 80, 91, 120, 93, 61, 84,
+59, 10, 125, 10, 125, 10, 118, 97, 114, 32, 85, 61, 48, 59, 10, 102, 117, 110,
+99, 116, 105, 111, 110, 32, 82, 101, 115, 101, 116, 73, 110, 100, 101, 120, 101,
+115, 40, 86, 44, 87, 41, 123, 10, 118, 97, 114, 32, 88, 61, 45, 49, 59, 10, 119,
+104, 105, 108, 101, 40, 85, 60, 79, 46, 108, 101, 110, 103, 116, 104, 38, 38,
+10, 79, 91, 85, 93, 46, 111, 117, 116, 101, 114, 95, 105, 110, 100, 101, 120,
+61, 61, 87, 41, 123, 10, 118, 97, 114, 32, 89, 61, 85, 59, 10, 79, 91, 89, 93,
+46, 111, 117, 116, 101, 114, 95, 105, 110, 100, 101, 120, 61, 86, 59, 10, 105,
+102, 40, 88, 33, 61, 45, 49, 41, 123, 10, 79, 91, 88, 93, 46, 110, 101, 120,
+116, 95, 115, 105, 98, 108, 105, 110, 103, 95, 105, 110, 100, 101, 120, 61, 89,
+59, 10, 125, 10, 88, 61, 89, 59, 10, 85, 43, 43, 59, 10, 82, 101, 115, 101, 116,
+73, 110, 100, 101, 120, 101, 115, 40, 89, 44, 80, 91, 89, 93, 41, 59, 10, 125,
+10, 105, 102, 40, 88, 33, 61, 45, 49, 41, 123, 10, 79, 91, 88, 93, 46, 110, 101,
+120, 116, 95, 115, 105, 98, 108, 105, 110, 103, 95, 105, 110, 100, 101, 120, 61,
+45, 49, 59, 10, 125, 10, 125, 10, 82, 101, 115, 101, 116, 73, 110, 100, 101,
+120, 101, 115, 40, 45, 49, 44, 45, 49, 41, 59, 10, 65, 115, 115, 101, 114, 116,
+40, 85, 61, 61, 79, 46, 108, 101, 110, 103, 116, 104, 41, 59, 10, 114, 101, 116,
+117, 114, 110, 32, 79, 59, 10, 125, 10, 102, 117, 110, 99, 116, 105, 111, 110,
+32, 80, 97, 116, 99, 104, 70, 117, 110, 99, 116, 105, 111, 110, 67, 111, 100,
+101, 40, 118, 44, 90, 41, 123, 10, 118, 97, 114, 32, 68, 61, 118, 46, 99, 111,
+114, 114, 101, 115, 112, 111, 110, 100, 105, 110, 103, 95, 110, 111, 100, 101,
+46, 105, 110, 102, 111, 59, 10, 105, 102, 40, 118, 46, 108, 105, 118, 101, 95,
+115, 104, 97, 114, 101, 100, 95, 102, 117, 110, 99, 116, 105, 111, 110, 95, 105,
+110, 102, 111, 115, 41, 123, 10, 118, 46, 108, 105, 118, 101, 95, 115, 104, 97,
+114, 101, 100, 95, 102, 117, 110, 99, 116, 105, 111, 110, 95, 105, 110, 102,
+111, 115, 46, 102, 111, 114, 69, 97, 99, 104, 40, 102, 117, 110, 99, 116, 105,
+111, 110, 40, 97, 97, 41, 123, 10, 37, 76, 105, 118, 101, 69, 100, 105, 116, 82,
+101, 112, 108, 97, 99, 101, 70, 117, 110, 99, 116, 105, 111, 110, 67, 111, 100,
+101, 40, 68, 46, 114, 97, 119, 95, 97, 114, 114, 97, 121, 44, 10, 97, 97, 46,
+114, 97, 119, 95, 97, 114, 114, 97, 121, 41, 59, 10, 102, 111, 114, 40, 118, 97,
+114, 32, 120, 61, 48, 59, 120, 60, 118, 46, 99, 104, 105, 108, 100, 114, 101,
+110, 46, 108, 101, 110, 103, 116, 104, 59, 120, 43, 43, 41, 123, 10, 105, 102,
+40, 118, 46, 99, 104, 105, 108, 100, 114, 101, 110, 91, 120, 93, 46, 99, 111,
+114, 114, 101, 115, 112, 111, 110, 100, 105, 110, 103, 95, 110, 111, 100, 101,
+41, 123, 10, 118, 97, 114, 32, 97, 98, 61, 10, 118, 46, 99, 104, 105, 108, 100,
+114, 101, 110, 91, 120, 93, 46, 99, 111, 114, 114, 101, 115, 112, 111, 110, 100,
+105, 110, 103, 95, 110, 111, 100, 101, 46, 105, 110, 102, 111, 46, 10, 115, 104,
+97, 114, 101, 100, 95, 102, 117, 110, 99, 116, 105, 111, 110, 95, 105, 110, 102,
+111, 59, 10, 105, 102, 40, 118, 46, 99, 104, 105, 108, 100, 114, 101, 110, 91,
+120, 93, 46, 108, 105, 118, 101, 95, 115, 104, 97, 114, 101, 100, 95, 102, 117,
+110, 99, 116, 105, 111, 110, 95, 105, 110, 102, 111, 115, 41, 123, 10, 118, 46,
+99, 104, 105, 108, 100, 114, 101, 110, 91, 120, 93, 46, 108, 105, 118, 101, 95,
+115, 104, 97, 114, 101, 100, 95, 102, 117, 110, 99, 116, 105, 111, 110, 95, 105,
+110, 102, 111, 115, 46, 10, 102, 111, 114, 69, 97, 99, 104, 40, 102, 117, 110,
+99, 116, 105, 111, 110, 40, 97, 99, 41, 123, 10, 37, 76, 105, 118, 101, 69, 100,
+105, 116, 82, 101, 112, 108, 97, 99, 101, 82, 101, 102, 84, 111, 78, 101, 115,
+116, 101, 100, 70, 117, 110, 99, 116, 105, 111, 110, 40, 10, 97, 97, 46, 105,
+110, 102, 111, 44, 10, 97, 98, 44, 10, 97, 99, 46, 105, 110, 102, 111, 41, 59,
+10, 125, 41, 59, 10, 125, 10, 125, 10, 125, 10, 125, 41, 59, 10, 90, 46, 112,
+117, 115, 104, 40, 123, 102, 117, 110, 99, 116, 105, 111, 110, 95, 112, 97, 116,
+99, 104, 101, 100, 58, 68, 46, 102, 117, 110, 99, 116, 105, 111, 110, 95, 110,
+97, 109, 101, 125, 41, 59, 10, 125, 101, 108, 115, 101, 123, 10, 90, 46, 112,
+117, 115, 104, 40, 123, 102, 117, 110, 99, 116, 105, 111, 110, 95, 112, 97, 116,
+99, 104, 101, 100, 58, 68, 46, 102, 117, 110, 99, 116, 105, 111, 110, 95, 110,
+97, 109, 101, 44, 10, 102, 117, 110, 99, 116, 105, 111, 110, 95, 105, 110, 102,
+111, 95, 110, 111, 116, 95, 102, 111, 117, 110, 100, 58, 116, 114, 117, 101,
+125, 41, 59, 10, 125, 10, 125, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32,
+76, 105, 110, 107, 84, 111, 79, 108, 100, 83, 99, 114, 105, 112, 116, 40, 97,
+100, 44, 71, 44, 97, 101, 41, 123, 10, 105, 102, 40, 97, 100, 46, 108, 105, 118,
+101, 95, 115, 104, 97, 114, 101, 100, 95, 102, 117, 110, 99, 116, 105, 111, 110,
+95, 105, 110, 102, 111, 115, 41, 123, 10, 97, 100, 46, 108, 105, 118, 101, 95,
+115, 104, 97, 114, 101, 100, 95, 102, 117, 110, 99, 116, 105, 111, 110, 95, 105,
+110, 102, 111, 115, 46, 10, 102, 111, 114, 69, 97, 99, 104, 40, 102, 117, 110,
+99, 116, 105, 111, 110, 40, 81, 41, 123, 10, 37, 76, 105, 118, 101, 69, 100,
+105, 116, 70, 117, 110, 99, 116, 105, 111, 110, 83, 101, 116, 83, 99, 114, 105,
+112, 116, 40, 81, 46, 105, 110, 102, 111, 44, 71, 41, 59, 10, 125, 41, 59, 10,
+97, 101, 46, 112, 117, 115, 104, 40, 123, 110, 97, 109, 101, 58, 97, 100, 46,
+105, 110, 102, 111, 46, 102, 117, 110, 99, 116, 105, 111, 110, 95, 110, 97, 109,
+101, 125, 41, 59, 10, 125, 101, 108, 115, 101, 123, 10, 97, 101, 46, 112, 117,
+115, 104, 40, 10, 123, 110, 97, 109, 101, 58, 97, 100, 46, 105, 110, 102, 111,
+46, 102, 117, 110, 99, 116, 105, 111, 110, 95, 110, 97, 109, 101, 44, 110, 111,
+116, 95, 102, 111, 117, 110, 100, 58, 116, 114, 117, 101, 125, 41, 59, 10, 125,
+10, 125, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 65, 115, 115, 101, 114,
+116, 40, 97, 102, 44, 97, 103, 41, 123, 10, 105, 102, 40, 33, 97, 102, 41, 123,
+10, 105, 102, 40, 97, 103, 41, 123, 10, 116, 104, 114, 111, 119, 34, 65, 115,
+115, 101, 114, 116, 32, 34, 43, 97, 103, 59, 10, 125, 101, 108, 115, 101, 123,
+10, 116, 104, 114, 111, 119, 34, 65, 115, 115, 101, 114, 116, 34, 59, 10, 125,
+10, 125, 10, 125, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 68, 105, 102,
+102, 67, 104, 117, 110, 107, 40, 97, 104, 44, 97, 105, 44, 97, 106, 44, 97, 107,
+41, 123, 10, 116, 104, 105, 115, 46, 112, 111, 115, 49, 61, 97, 104, 59, 10,
+116, 104, 105, 115, 46, 112, 111, 115, 50, 61, 97, 105, 59, 10, 116, 104, 105,
+115, 46, 108, 101, 110, 49, 61, 97, 106, 59, 10, 116, 104, 105, 115, 46, 108,
+101, 110, 50, 61, 97, 107, 59, 10, 125, 10, 102, 117, 110, 99, 116, 105, 111,
+110, 32, 80, 111, 115, 84, 114, 97, 110, 115, 108, 97, 116, 111, 114, 40, 97,
+108, 41, 123, 10, 118, 97, 114, 32, 97, 109, 61, 110, 101, 119, 32, 100, 40, 41,
+59, 10, 118, 97, 114, 32, 97, 110, 61, 48, 59, 10, 102, 111, 114, 40, 118, 97,
+114, 32, 120, 61, 48, 59, 120, 60, 97, 108, 46, 108, 101, 110, 103, 116, 104,
+59, 120, 43, 61, 51, 41, 123, 10, 118, 97, 114, 32, 97, 111, 61, 97, 108, 91,
+120, 93, 59, 10, 118, 97, 114, 32, 97, 112, 61, 97, 111, 43, 97, 110, 59, 10,
+118, 97, 114, 32, 97, 113, 61, 97, 108, 91, 120, 43, 49, 93, 59, 10, 118, 97,
+114, 32, 97, 114, 61, 97, 108, 91, 120, 43, 50, 93, 59, 10, 97, 109, 46, 112,
+117, 115, 104, 40, 110, 101, 119, 32, 68, 105, 102, 102, 67, 104, 117, 110, 107,
+40, 97, 111, 44, 97, 112, 44, 97, 113, 45, 97, 111, 44, 10, 97, 114, 45, 97,
+112, 41, 41, 59, 10, 97, 110, 61, 97, 114, 45, 97, 113, 59, 10, 125, 10, 116,
+104, 105, 115, 46, 99, 104, 117, 110, 107, 115, 61, 97, 109, 59, 10, 125, 10,
+80, 111, 115, 84, 114, 97, 110, 115, 108, 97, 116, 111, 114, 46, 112, 114, 111,
+116, 111, 116, 121, 112, 101, 46, 71, 101, 116, 67, 104, 117, 110, 107, 115, 61,
+102, 117, 110, 99, 116, 105, 111, 110, 40, 41, 123, 10, 114, 101, 116, 117, 114,
+110, 32, 116, 104, 105, 115, 46, 99, 104, 117, 110, 107, 115, 59, 10, 125, 59,
+10, 80, 111, 115, 84, 114, 97, 110, 115, 108, 97, 116, 111, 114, 46, 112, 114,
+111, 116, 111, 116, 121, 112, 101, 46, 84, 114, 97, 110, 115, 108, 97, 116, 101,
+61, 102, 117, 110, 99, 116, 105, 111, 110, 40, 97, 115, 44, 97, 116, 41, 123,
+10, 118, 97, 114, 32, 97, 117, 61, 116, 104, 105, 115, 46, 99, 104, 117, 110,
+107, 115, 59, 10, 105, 102, 40, 97, 117, 46, 108, 101, 110, 103, 116, 104, 61,
+61, 48, 124, 124, 97, 115, 60, 97, 117, 91, 48, 93, 46, 112, 111, 115, 49, 41,
+123, 10, 114, 101, 116, 117, 114, 110, 32, 97, 115, 59, 10, 125, 10, 118, 97,
+114, 32, 97, 118, 61, 48, 59, 10, 118, 97, 114, 32, 97, 119, 61, 97, 117, 46,
+108, 101, 110, 103, 116, 104, 45, 49, 59, 10, 119, 104, 105, 108, 101, 40, 97,
+118, 60, 97, 119, 41, 123, 10, 118, 97, 114, 32, 97, 120, 61, 101, 40, 40, 97,
+118, 43, 97, 119, 41, 47, 50, 41, 59, 10, 105, 102, 40, 97, 115, 60, 97, 117,
+91, 97, 120, 43, 49, 93, 46, 112, 111, 115, 49, 41, 123, 10, 97, 119, 61, 97,
+120, 59, 10, 125, 101, 108, 115, 101, 123, 10, 97, 118, 61, 97, 120, 43, 49, 59,
+10, 125, 10, 125, 10, 118, 97, 114, 32, 97, 121, 61, 97, 117, 91, 97, 118, 93,
+59, 10, 105, 102, 40, 97, 115, 62, 61, 97, 121, 46, 112, 111, 115, 49, 43, 97,
+121, 46, 108, 101, 110, 49, 41, 123, 10, 114, 101, 116, 117, 114, 110, 32, 97,
+115, 43, 97, 121, 46, 112, 111, 115, 50, 43, 97, 121, 46, 108, 101, 110, 50, 45,
+97, 121, 46, 112, 111, 115, 49, 45, 97, 121, 46, 108, 101, 110, 49, 59, 10, 125,
+10, 105, 102, 40, 33, 97, 116, 41, 123, 10, 97, 116, 61, 80, 111, 115, 84, 114,
+97, 110, 115, 108, 97, 116, 111, 114, 46, 68, 101, 102, 97, 117, 108, 116, 73,
+110, 115, 105, 100, 101, 67, 104, 117, 110, 107, 72, 97, 110, 100, 108, 101,
+114, 59, 10, 125, 10, 114, 101, 116, 117, 114, 110, 32, 97, 116, 40, 97, 115,
+44, 97, 121, 41, 59, 10, 125, 59, 10, 80, 111, 115, 84, 114, 97, 110, 115, 108,
+97, 116, 111, 114, 46, 68, 101, 102, 97, 117, 108, 116, 73, 110, 115, 105, 100,
+101, 67, 104, 117, 110, 107, 72, 97, 110, 100, 108, 101, 114, 61, 102, 117, 110,
+99, 116, 105, 111, 110, 40, 97, 115, 44, 97, 122, 41, 123, 10, 65, 115, 115,
+101, 114, 116, 40, 102, 97, 108, 115, 101, 44, 34, 67, 97, 110, 110, 111, 116,
+32, 116, 114, 97, 110, 115, 108, 97, 116, 101, 32, 112, 111, 115, 105, 116, 105,
+111, 110, 32, 105, 110, 32, 99, 104, 97, 110, 103, 101, 100, 32, 97, 114, 101,
+97, 34, 41, 59, 10, 125, 59, 10, 80, 111, 115, 84, 114, 97, 110, 115, 108, 97,
+116, 111, 114, 46, 83, 104, 105, 102, 116, 87, 105, 116, 104, 84, 111, 112, 73,
+110, 115, 105, 100, 101, 67, 104, 117, 110, 107, 72, 97, 110, 100, 108, 101,
+114, 61, 10, 102, 117, 110, 99, 116, 105, 111, 110, 40, 97, 115, 44, 97, 122,
+41, 123, 10, 114, 101, 116, 117, 114, 110, 32, 97, 115, 45, 97, 122, 46, 112,
+111, 115, 49, 43, 97, 122, 46, 112, 111, 115, 50, 59, 10, 125, 59, 10, 118, 97,
+114, 32, 104, 61, 123, 10, 85, 78, 67, 72, 65, 78, 71, 69, 68, 58, 34, 117, 110,
+99, 104, 97, 110, 103, 101, 100, 34, 44, 10, 83, 79, 85, 82, 67, 69, 95, 67, 72,
+65, 78, 71, 69, 68, 58, 34, 115, 111, 117, 114, 99, 101, 32, 99, 104, 97, 110,
+103, 101, 100, 34, 44, 10, 67, 72, 65, 78, 71, 69, 68, 58, 34, 99, 104, 97, 110,
+103, 101, 100, 34, 44, 10, 68, 65, 77, 65, 71, 69, 68, 58, 34, 100, 97, 109, 97,
+103, 101, 100, 34, 10, 125, 59, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32,
+67, 111, 100, 101, 73, 110, 102, 111, 84, 114, 101, 101, 78, 111, 100, 101, 40,
+97, 65, 44, 97, 66, 44, 97, 67, 41, 123, 10, 116, 104, 105, 115, 46, 105, 110,
+102, 111, 61, 97, 65, 59, 10, 116, 104, 105, 115, 46, 99, 104, 105, 108, 100,
+114, 101, 110, 61, 97, 66, 59, 10, 116, 104, 105, 115, 46, 97, 114, 114, 97,
+121, 95, 105, 110, 100, 101, 120, 61, 97, 67, 59, 10, 116, 104, 105, 115, 46,
+112, 97, 114, 101, 110, 116, 61, 40, 118, 111, 105, 100, 32, 48, 41, 59, 10,
+116, 104, 105, 115, 46, 115, 116, 97, 116, 117, 115, 61, 104, 46, 85, 78, 67,
+72, 65, 78, 71, 69, 68, 59, 10, 116, 104, 105, 115, 46, 115, 116, 97, 116, 117,
+115, 95, 101, 120, 112, 108, 97, 110, 97, 116, 105, 111, 110, 61, 40, 118, 111,
+105, 100, 32, 48, 41, 59, 10, 116, 104, 105, 115, 46, 110, 101, 119, 95, 115,
+116, 97, 114, 116, 95, 112, 111, 115, 61, 40, 118, 111, 105, 100, 32, 48, 41,
+59, 10, 116, 104, 105, 115, 46, 110, 101, 119, 95, 101, 110, 100, 95, 112, 111,
+115, 61, 40, 118, 111, 105, 100, 32, 48, 41, 59, 10, 116, 104, 105, 115, 46, 99,
+111, 114, 114, 101, 115, 112, 111, 110, 100, 105, 110, 103, 95, 110, 111, 100,
+101, 61, 40, 118, 111, 105, 100, 32, 48, 41, 59, 10, 116, 104, 105, 115, 46,
+117, 110, 109, 97, 116, 99, 104, 101, 100, 95, 110, 101, 119, 95, 110, 111, 100,
+101, 115, 61, 40, 118, 111, 105, 100, 32, 48, 41, 59, 10, 116, 104, 105, 115,
+46, 116, 101, 120, 116, 117, 97, 108, 95, 99, 111, 114, 114, 101, 115, 112, 111,
+110, 100, 105, 110, 103, 95, 110, 111, 100, 101, 61, 40, 118, 111, 105, 100, 32,
+48, 41, 59, 10, 116, 104, 105, 115, 46, 116, 101, 120, 116, 117, 97, 108, 108,
+121, 95, 117, 110, 109, 97, 116, 99, 104, 101, 100, 95, 110, 101, 119, 95, 110,
+111, 100, 101, 115, 61, 40, 118, 111, 105, 100, 32, 48, 41, 59, 10, 116, 104,
+105, 115, 46, 108, 105, 118, 101, 95, 115, 104, 97, 114, 101, 100, 95, 102, 117,
+110, 99, 116, 105, 111, 110, 95, 105, 110, 102, 111, 115, 61, 40, 118, 111, 105,
+100, 32, 48, 41, 59, 10, 125, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 66,
+117, 105, 108, 100, 67, 111, 100, 101, 73, 110, 102, 111, 84, 114, 101, 101, 40,
+97, 68, 41, 123, 10, 118, 97, 114, 32, 97, 69, 61, 48, 59, 10, 102, 117, 110,
+99, 116, 105, 111, 110, 32, 66, 117, 105, 108, 100, 78, 111, 100, 101, 40, 41,
+123, 10, 118, 97, 114, 32, 97, 70, 61, 97, 69, 59, 10, 97, 69, 43, 43, 59, 10,
+118, 97, 114, 32, 97, 71, 61, 110, 101, 119, 32, 100, 40, 41, 59, 10, 119, 104,
+105, 108, 101, 40, 97, 69, 60, 97, 68, 46, 108, 101, 110, 103, 116, 104, 38, 38,
+10, 97, 68, 91, 97, 69, 93, 46, 111, 117, 116, 101, 114, 95, 105, 110, 100, 101,
+120, 61, 61, 97, 70, 41, 123, 10, 97, 71, 46, 112, 117, 115, 104, 40, 66, 117,
+105, 108, 100, 78, 111, 100, 101, 40, 41, 41, 59, 10, 125, 10, 118, 97, 114, 32,
+119, 61, 110, 101, 119, 32, 67, 111, 100, 101, 73, 110, 102, 111, 84, 114, 101,
+101, 78, 111, 100, 101, 40, 97, 68, 91, 97, 70, 93, 44, 97, 71, 44, 10, 97, 70,
+41, 59, 10, 102, 111, 114, 40, 118, 97, 114, 32, 120, 61, 48, 59, 120, 60, 97,
+71, 46, 108, 101, 110, 103, 116, 104, 59, 120, 43, 43, 41, 123, 10, 97, 71, 91,
+120, 93, 46, 112, 97, 114, 101, 110, 116, 61, 119, 59, 10, 125, 10, 114, 101,
+116, 117, 114, 110, 32, 119, 59, 10, 125, 10, 118, 97, 114, 32, 97, 72, 61, 66,
+117, 105, 108, 100, 78, 111, 100, 101, 40, 41, 59, 10, 65, 115, 115, 101, 114,
+116, 40, 97, 69, 61, 61, 97, 68, 46, 108, 101, 110, 103, 116, 104, 41, 59, 10,
+114, 101, 116, 117, 114, 110, 32, 97, 72, 59, 10, 125, 10, 102, 117, 110, 99,
+116, 105, 111, 110, 32, 77, 97, 114, 107, 67, 104, 97, 110, 103, 101, 100, 70,
+117, 110, 99, 116, 105, 111, 110, 115, 40, 97, 73, 44, 97, 109, 41, 123, 10,
+118, 97, 114, 32, 97, 74, 61, 110, 101, 119, 32, 102, 117, 110, 99, 116, 105,
+111, 110, 40, 41, 123, 10, 118, 97, 114, 32, 97, 75, 61, 48, 59, 10, 118, 97,
+114, 32, 97, 76, 61, 48, 59, 10, 116, 104, 105, 115, 46, 99, 117, 114, 114, 101,
+110, 116, 61, 102, 117, 110, 99, 116, 105, 111, 110, 40, 41, 123, 114, 101, 116,
+117, 114, 110, 32, 97, 109, 91, 97, 75, 93, 59, 125, 59, 10, 116, 104, 105, 115,
+46, 110, 101, 120, 116, 61, 102, 117, 110, 99, 116, 105, 111, 110, 40, 41, 123,
+10, 118, 97, 114, 32, 97, 121, 61, 97, 109, 91, 97, 75, 93, 59, 10, 97, 76, 61,
+97, 121, 46, 112, 111, 115, 50, 43, 97, 121, 46, 108, 101, 110, 50, 45, 40, 97,
+121, 46, 112, 111, 115, 49, 43, 97, 121, 46, 108, 101, 110, 49, 41, 59, 10, 97,
+75, 43, 43, 59, 10, 125, 59, 10, 116, 104, 105, 115, 46, 100, 111, 110, 101, 61,
+102, 117, 110, 99, 116, 105, 111, 110, 40, 41, 123, 114, 101, 116, 117, 114,
+110, 32, 97, 75, 62, 61, 97, 109, 46, 108, 101, 110, 103, 116, 104, 59, 125, 59,
+10, 116, 104, 105, 115, 46, 84, 114, 97, 110, 115, 108, 97, 116, 101, 80, 111,
+115, 61, 102, 117, 110, 99, 116, 105, 111, 110, 40, 97, 115, 41, 123, 114, 101,
+116, 117, 114, 110, 32, 97, 115, 43, 97, 76, 59, 125, 59, 10, 125, 59, 10, 102,
+117, 110, 99, 116, 105, 111, 110, 32, 80, 114, 111, 99, 101, 115, 115, 73, 110,
+116, 101, 114, 110, 97, 108, 115, 40, 97, 77, 41, 123, 10, 97, 77, 46, 110, 101,
+119, 95, 115, 116, 97, 114, 116, 95, 112, 111, 115, 61, 97, 74, 46, 84, 114, 97,
+110, 115, 108, 97, 116, 101, 80, 111, 115, 40, 10, 97, 77, 46, 105, 110, 102,
+111, 46, 115, 116, 97, 114, 116, 95, 112, 111, 115, 105, 116, 105, 111, 110, 41,
+59, 10, 118, 97, 114, 32, 97, 78, 61, 48, 59, 10, 118, 97, 114, 32, 97, 79, 61,
+102, 97, 108, 115, 101, 59, 10, 118, 97, 114, 32, 97, 80, 61, 102, 97, 108, 115,
+101, 59, 10, 119, 104, 105, 108, 101, 40, 33, 97, 74, 46, 100, 111, 110, 101,
+40, 41, 38, 38, 10, 97, 74, 46, 99, 117, 114, 114, 101, 110, 116, 40, 41, 46,
+112, 111, 115, 49, 60, 97, 77, 46, 105, 110, 102, 111, 46, 101, 110, 100, 95,
+112, 111, 115, 105, 116, 105, 111, 110, 41, 123, 10, 105, 102, 40, 97, 78, 60,
+97, 77, 46, 99, 104, 105, 108, 100, 114, 101, 110, 46, 108, 101, 110, 103, 116,
+104, 41, 123, 10, 118, 97, 114, 32, 97, 81, 61, 97, 77, 46, 99, 104, 105, 108,
+100, 114, 101, 110, 91, 97, 78, 93, 59, 10, 105, 102, 40, 97, 81, 46, 105, 110,
+102, 111, 46, 101, 110, 100, 95, 112, 111, 115, 105, 116, 105, 111, 110, 60, 61,
+97, 74, 46, 99, 117, 114, 114, 101, 110, 116, 40, 41, 46, 112, 111, 115, 49, 41,
+123, 10, 80, 114, 111, 99, 101, 115, 115, 85, 110, 99, 104, 97, 110, 103, 101,
+100, 67, 104, 105, 108, 100, 40, 97, 81, 41, 59, 10, 97, 78, 43, 43, 59, 10, 99,
+111, 110, 116, 105, 110, 117, 101, 59, 10, 125, 101, 108, 115, 101, 32, 105,
+102, 40, 97, 81, 46, 105, 110, 102, 111, 46, 115, 116, 97, 114, 116, 95, 112,
+111, 115, 105, 116, 105, 111, 110, 62, 61, 10, 97, 74, 46, 99, 117, 114, 114,
+101, 110, 116, 40, 41, 46, 112, 111, 115, 49, 43, 97, 74, 46, 99, 117, 114, 114,
+101, 110, 116, 40, 41, 46, 108, 101, 110, 49, 41, 123, 10, 97, 79, 61, 116, 114,
+117, 101, 59, 10, 97, 74, 46, 110, 101, 120, 116, 40, 41, 59, 10, 99, 111, 110,
+116, 105, 110, 117, 101, 59, 10, 125, 101, 108, 115, 101, 32, 105, 102, 40, 97,
+81, 46, 105, 110, 102, 111, 46, 115, 116, 97, 114, 116, 95, 112, 111, 115, 105,
+116, 105, 111, 110, 60, 61, 97, 74, 46, 99, 117, 114, 114, 101, 110, 116, 40,
+41, 46, 112, 111, 115, 49, 38, 38, 10, 97, 81, 46, 105, 110, 102, 111, 46, 101,
+110, 100, 95, 112, 111, 115, 105, 116, 105, 111, 110, 62, 61, 97, 74, 46, 99,
+117, 114, 114, 101, 110, 116, 40, 41, 46, 112, 111, 115, 49, 43, 10, 97, 74, 46,
+99, 117, 114, 114, 101, 110, 116, 40, 41, 46, 108, 101, 110, 49, 41, 123, 10,
+80, 114, 111, 99, 101, 115, 115, 73, 110, 116, 101, 114, 110, 97, 108, 115, 40,
+97, 81, 41, 59, 10, 97, 80, 61, 97, 80, 124, 124, 10, 40, 97, 81, 46, 115, 116,
+97, 116, 117, 115, 33, 61, 104, 46, 85, 78, 67, 72, 65, 78, 71, 69, 68, 41, 59,
+10, 97, 79, 61, 97, 79, 124, 124, 10, 40, 97, 81, 46, 115, 116, 97, 116, 117,
+115, 61, 61, 104, 46, 68, 65, 77, 65, 71, 69, 68, 41, 59, 10, 97, 78, 43, 43,
+59, 10, 99, 111, 110, 116, 105, 110, 117, 101, 59, 10, 125, 101, 108, 115, 101,
+123, 10, 97, 79, 61, 116, 114, 117, 101, 59, 10, 97, 81, 46, 115, 116, 97, 116,
+117, 115, 61, 104, 46, 68, 65, 77, 65, 71, 69, 68, 59, 10, 97, 81, 46, 115, 116,
+97, 116, 117, 115, 95, 101, 120, 112, 108, 97, 110, 97, 116, 105, 111, 110, 61,
+10, 34, 84, 101, 120, 116, 32, 100, 105, 102, 102, 32, 111, 118, 101, 114, 108,
+97, 112, 115, 32, 119, 105, 116, 104, 32, 102, 117, 110, 99, 116, 105, 111, 110,
+32, 98, 111, 117, 110, 100, 97, 114, 121, 34, 59, 10, 97, 78, 43, 43, 59, 10,
+99, 111, 110, 116, 105, 110, 117, 101, 59, 10, 125, 10, 125, 101, 108, 115, 101,
+123, 10, 105, 102, 40, 97, 74, 46, 99, 117, 114, 114, 101, 110, 116, 40, 41, 46,
+112, 111, 115, 49, 43, 97, 74, 46, 99, 117, 114, 114, 101, 110, 116, 40, 41, 46,
+108, 101, 110, 49, 60, 61, 10, 97, 77, 46, 105, 110, 102, 111, 46, 101, 110,
+100, 95, 112, 111, 115, 105, 116, 105, 111, 110, 41, 123, 10, 97, 77, 46, 115,
+116, 97, 116, 117, 115, 61, 104, 46, 67, 72, 65, 78, 71, 69, 68, 59, 10, 97, 74,
+46, 110, 101, 120, 116, 40, 41, 59, 10, 99, 111, 110, 116, 105, 110, 117, 101,
+59, 10, 125, 101, 108, 115, 101, 123, 10, 97, 77, 46, 115, 116, 97, 116, 117,
+115, 61, 104, 46, 68, 65, 77, 65, 71, 69, 68, 59, 10, 97, 77, 46, 115, 116, 97,
+116, 117, 115, 95, 101, 120, 112, 108, 97, 110, 97, 116, 105, 111, 110, 61, 10,
+34, 84, 101, 120, 116, 32, 100, 105, 102, 102, 32, 111, 118, 101, 114, 108, 97,
+112, 115, 32, 119, 105, 116, 104, 32, 102, 117, 110, 99, 116, 105, 111, 110, 32,
+98, 111, 117, 110, 100, 97, 114, 121, 34, 59, 10, 114, 101, 116, 117, 114, 110,
+59, 10, 125, 10, 125, 10, 65, 115, 115, 101, 114, 116, 40, 34, 85, 110, 114,
+101, 97, 99, 104, 97, 98, 108, 101, 34, 44, 102, 97, 108, 115, 101, 41, 59, 10,
+125, 10, 119, 104, 105, 108, 101, 40, 97, 78, 60, 97, 77, 46, 99, 104, 105, 108,
+100, 114, 101, 110, 46, 108, 101, 110, 103, 116, 104, 41, 123, 10, 118, 97, 114,
+32, 97, 81, 61, 97, 77, 46, 99, 104, 105, 108, 100, 114, 101, 110, 91, 97, 78,
+93, 59, 10, 80, 114, 111, 99, 101, 115, 115, 85, 110, 99, 104, 97, 110, 103,
+101, 100, 67, 104, 105, 108, 100, 40, 97, 81, 41, 59, 10, 97, 78, 43, 43, 59,
+10, 125, 10, 105, 102, 40, 97, 79, 41, 123, 10, 97, 77, 46, 115, 116, 97, 116,
+117, 115, 61, 104, 46, 67, 72, 65, 78, 71, 69, 68, 59, 10, 125, 101, 108, 115,
+101, 32, 105, 102, 40, 97, 80, 41, 123, 10, 97, 77, 46, 115, 116, 97, 116, 117,
+115, 61, 104, 46, 83, 79, 85, 82, 67, 69, 95, 67, 72, 65, 78, 71, 69, 68, 59,
+10, 125, 10, 97, 77, 46, 110, 101, 119, 95, 101, 110, 100, 95, 112, 111, 115,
+61, 10, 97, 74, 46, 84, 114, 97, 110, 115, 108, 97, 116, 101, 80, 111, 115, 40,
+97, 77, 46, 105, 110, 102, 111, 46, 101, 110, 100, 95, 112, 111, 115, 105, 116,
+105, 111, 110, 41, 59, 10, 125, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32,
+80, 114, 111, 99, 101, 115, 115, 85, 110, 99, 104, 97, 110, 103, 101, 100, 67,
+104, 105, 108, 100, 40, 119, 41, 123, 10, 119, 46, 110, 101, 119, 95, 115, 116,
+97, 114, 116, 95, 112, 111, 115, 61, 97, 74, 46, 84, 114, 97, 110, 115, 108, 97,
+116, 101, 80, 111, 115, 40, 119, 46, 105, 110, 102, 111, 46, 115, 116, 97, 114,
+116, 95, 112, 111, 115, 105, 116, 105, 111, 110, 41, 59, 10, 119, 46, 110, 101,
+119, 95, 101, 110, 100, 95, 112, 111, 115, 61, 97, 74, 46, 84, 114, 97, 110,
+115, 108, 97, 116, 101, 80, 111, 115, 40, 119, 46, 105, 110, 102, 111, 46, 101,
+110, 100, 95, 112, 111, 115, 105, 116, 105, 111, 110, 41, 59, 10, 125, 10, 80,
+114, 111, 99, 101, 115, 115, 73, 110, 116, 101, 114, 110, 97, 108, 115, 40, 97,
+73, 41, 59, 10, 125, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 70, 105,
+110, 100, 67, 111, 114, 114, 101, 115, 112, 111, 110, 100, 105, 110, 103, 70,
+117, 110, 99, 116, 105, 111, 110, 115, 40, 97, 82, 44, 97, 83, 41, 123, 10, 102,
+117, 110, 99, 116, 105, 111, 110, 32, 80, 114, 111, 99, 101, 115, 115, 78, 111,
+100, 101, 40, 118, 44, 97, 84, 41, 123, 10, 118, 97, 114, 32, 97, 85, 61, 10,
+73, 115, 70, 117, 110, 99, 116, 105, 111, 110, 67, 111, 110, 116, 101, 120, 116,
+76, 111, 99, 97, 108, 115, 67, 104, 97, 110, 103, 101, 100, 40, 118, 46, 105,
+110, 102, 111, 44, 97, 84, 46, 105, 110, 102, 111, 41, 59, 10, 105, 102, 40, 97,
+85, 41, 123, 10, 118, 46, 115, 116, 97, 116, 117, 115, 61, 104, 46, 67, 72, 65,
+78, 71, 69, 68, 59, 10, 125, 10, 118, 97, 114, 32, 97, 86, 61, 118, 46, 99, 104,
+105, 108, 100, 114, 101, 110, 59, 10, 118, 97, 114, 32, 97, 87, 61, 97, 84, 46,
+99, 104, 105, 108, 100, 114, 101, 110, 59, 10, 118, 97, 114, 32, 97, 88, 61, 91,
+93, 59, 10, 118, 97, 114, 32, 97, 89, 61, 91, 93, 59, 10, 118, 97, 114, 32, 97,
+90, 61, 48, 59, 10, 118, 97, 114, 32, 98, 97, 61, 48, 59, 10, 119, 104, 105,
+108, 101, 40, 97, 90, 60, 97, 86, 46, 108, 101, 110, 103, 116, 104, 41, 123, 10,
+105, 102, 40, 97, 86, 91, 97, 90, 93, 46, 115, 116, 97, 116, 117, 115, 61, 61,
+104, 46, 68, 65, 77, 65, 71, 69, 68, 41, 123, 10, 97, 90, 43, 43, 59, 10, 125,
+101, 108, 115, 101, 32, 105, 102, 40, 98, 97, 60, 97, 87, 46, 108, 101, 110,
+103, 116, 104, 41, 123, 10, 105, 102, 40, 97, 87, 91, 98, 97, 93, 46, 105, 110,
+102, 111, 46, 115, 116, 97, 114, 116, 95, 112, 111, 115, 105, 116, 105, 111,
+110, 60, 10, 97, 86, 91, 97, 90, 93, 46, 110, 101, 119, 95, 115, 116, 97, 114,
+116, 95, 112, 111, 115, 41, 123, 10, 97, 88, 46, 112, 117, 115, 104, 40, 97, 87,
+91, 98, 97, 93, 41, 59, 10, 97, 89, 46, 112, 117, 115, 104, 40, 97, 87, 91, 98,
+97, 93, 41, 59, 10, 98, 97, 43, 43, 59, 10, 125, 101, 108, 115, 101, 32, 105,
+102, 40, 97, 87, 91, 98, 97, 93, 46, 105, 110, 102, 111, 46, 115, 116, 97, 114,
+116, 95, 112, 111, 115, 105, 116, 105, 111, 110, 61, 61, 10, 97, 86, 91, 97, 90,
+93, 46, 110, 101, 119, 95, 115, 116, 97, 114, 116, 95, 112, 111, 115, 41, 123,
+10, 105, 102, 40, 97, 87, 91, 98, 97, 93, 46, 105, 110, 102, 111, 46, 101, 110,
+100, 95, 112, 111, 115, 105, 116, 105, 111, 110, 61, 61, 10, 97, 86, 91, 97, 90,
+93, 46, 110, 101, 119, 95, 101, 110, 100, 95, 112, 111, 115, 41, 123, 10, 97,
+86, 91, 97, 90, 93, 46, 99, 111, 114, 114, 101, 115, 112, 111, 110, 100, 105,
+110, 103, 95, 110, 111, 100, 101, 61, 10, 97, 87, 91, 98, 97, 93, 59, 10, 97,
+86, 91, 97, 90, 93, 46, 116, 101, 120, 116, 117, 97, 108, 95, 99, 111, 114, 114,
+101, 115, 112, 111, 110, 100, 105, 110, 103, 95, 110, 111, 100, 101, 61, 10, 97,
+87, 91, 98, 97, 93, 59, 10, 105, 102, 40, 97, 85, 41, 123, 10, 97, 86, 91, 97,
+90, 93, 46, 115, 116, 97, 116, 117, 115, 61, 104, 46, 68, 65, 77, 65, 71, 69,
+68, 59, 10, 97, 86, 91, 97, 90, 93, 46, 115, 116, 97, 116, 117, 115, 95, 101,
+120, 112, 108, 97, 110, 97, 116, 105, 111, 110, 61, 10, 34, 69, 110, 99, 108,
+111, 115, 105, 110, 103, 32, 102, 117, 110, 99, 116, 105, 111, 110, 32, 105,
+115, 32, 110, 111, 119, 32, 105, 110, 99, 111, 109, 112, 97, 116, 105, 98, 108,
+101, 46, 32, 34, 43, 10, 97, 85, 59, 10, 97, 86, 91, 97, 90, 93, 46, 99, 111,
+114, 114, 101, 115, 112, 111, 110, 100, 105, 110, 103, 95, 110, 111, 100, 101,
+61, 40, 118, 111, 105, 100, 32, 48, 41, 59, 10, 125, 101, 108, 115, 101, 32,
+105, 102, 40, 97, 86, 91, 97, 90, 93, 46, 115, 116, 97, 116, 117, 115, 33, 61,
+10, 104, 46, 85, 78, 67, 72, 65, 78, 71, 69, 68, 41, 123, 10, 80, 114, 111, 99,
+101, 115, 115, 78, 111, 100, 101, 40, 97, 86, 91, 97, 90, 93, 44, 10, 97, 87,
+91, 98, 97, 93, 41, 59, 10, 105, 102, 40, 97, 86, 91, 97, 90, 93, 46, 115, 116,
+97, 116, 117, 115, 61, 61, 104, 46, 68, 65, 77, 65, 71, 69, 68, 41, 123, 10, 97,
+88, 46, 112, 117, 115, 104, 40, 10, 97, 86, 91, 97, 90, 93, 46, 99, 111, 114,
+114, 101, 115, 112, 111, 110, 100, 105, 110, 103, 95, 110, 111, 100, 101, 41,
+59, 10, 97, 86, 91, 97, 90, 93, 46, 99, 111, 114, 114, 101, 115, 112, 111, 110,
+100, 105, 110, 103, 95, 110, 111, 100, 101, 61, 40, 118, 111, 105, 100, 32, 48,
+41, 59, 10, 118, 46, 115, 116, 97, 116, 117, 115, 61, 104, 46, 67, 72, 65, 78,
+71, 69, 68, 59, 10, 125, 10, 125, 101, 108, 115, 101, 123, 10, 80, 114, 111, 99,
+101, 115, 115, 78, 111, 100, 101, 40, 97, 86, 91, 97, 90, 93, 44, 97, 87, 91,
+98, 97, 93, 41, 59, 10, 125, 10, 125, 101, 108, 115, 101, 123, 10, 97, 86, 91,
+97, 90, 93, 46, 115, 116, 97, 116, 117, 115, 61, 104, 46, 68, 65, 77, 65, 71,
+69, 68, 59, 10, 97, 86, 91, 97, 90, 93, 46, 115, 116, 97, 116, 117, 115, 95,
+101, 120, 112, 108, 97, 110, 97, 116, 105, 111, 110, 61, 10, 34, 78, 111, 32,
+99, 111, 114, 114, 101, 115, 112, 111, 110, 100, 105, 110, 103, 32, 102, 117,
+110, 99, 116, 105, 111, 110, 32, 105, 110, 32, 110, 101, 119, 32, 115, 99, 114,
+105, 112, 116, 32, 102, 111, 117, 110, 100, 34, 59, 10, 118, 46, 115, 116, 97,
+116, 117, 115, 61, 104, 46, 67, 72, 65, 78, 71, 69, 68, 59, 10, 97, 88, 46, 112,
+117, 115, 104, 40, 97, 87, 91, 98, 97, 93, 41, 59, 10, 97, 89, 46, 112, 117,
+115, 104, 40, 97, 87, 91, 98, 97, 93, 41, 59, 10, 125, 10, 98, 97, 43, 43, 59,
+10, 97, 90, 43, 43, 59, 10, 125, 101, 108, 115, 101, 123, 10, 97, 86, 91, 97,
+90, 93, 46, 115, 116, 97, 116, 117, 115, 61, 104, 46, 68, 65, 77, 65, 71, 69,
+68, 59, 10, 97, 86, 91, 97, 90, 93, 46, 115, 116, 97, 116, 117, 115, 95, 101,
+120, 112, 108, 97, 110, 97, 116, 105, 111, 110, 61, 10, 34, 78, 111, 32, 99,
+111, 114, 114, 101, 115, 112, 111, 110, 100, 105, 110, 103, 32, 102, 117, 110,
+99, 116, 105, 111, 110, 32, 105, 110, 32, 110, 101, 119, 32, 115, 99, 114, 105,
+112, 116, 32, 102, 111, 117, 110, 100, 34, 59, 10, 118, 46, 115, 116, 97, 116,
+117, 115, 61, 104, 46, 67, 72, 65, 78, 71, 69, 68, 59, 10, 97, 90, 43, 43, 59,
+10, 125, 10, 125, 101, 108, 115, 101, 123, 10, 97, 86, 91, 97, 90, 93, 46, 115,
+116, 97, 116, 117, 115, 61, 104, 46, 68, 65, 77, 65, 71, 69, 68, 59, 10, 97, 86,
+91, 97, 90, 93, 46, 115, 116, 97, 116, 117, 115, 95, 101, 120, 112, 108, 97,
+110, 97, 116, 105, 111, 110, 61, 10, 34, 78, 111, 32, 99, 111, 114, 114, 101,
+115, 112, 111, 110, 100, 105, 110, 103, 32, 102, 117, 110, 99, 116, 105, 111,
+110, 32, 105, 110, 32, 110, 101, 119, 32, 115, 99, 114, 105, 112, 116, 32, 102,
+111, 117, 110, 100, 34, 59, 10, 118, 46, 115, 116, 97, 116, 117, 115, 61, 104,
+46, 67, 72, 65, 78, 71, 69, 68, 59, 10, 97, 90, 43, 43, 59, 10, 125, 10, 125,
+10, 119, 104, 105, 108, 101, 40, 98, 97, 60, 97, 87, 46, 108, 101, 110, 103,
+116, 104, 41, 123, 10, 97, 88, 46, 112, 117, 115, 104, 40, 97, 87, 91, 98, 97,
+93, 41, 59, 10, 97, 89, 46, 112, 117, 115, 104, 40, 97, 87, 91, 98, 97, 93, 41,
+59, 10, 98, 97, 43, 43, 59, 10, 125, 10, 105, 102, 40, 118, 46, 115, 116, 97,
+116, 117, 115, 61, 61, 104, 46, 67, 72, 65, 78, 71, 69, 68, 41, 123, 10, 105,
+102, 40, 118, 46, 105, 110, 102, 111, 46, 112, 97, 114, 97, 109, 95, 110, 117,
+109, 33, 61, 97, 84, 46, 105, 110, 102, 111, 46, 112, 97, 114, 97, 109, 95, 110,
+117, 109, 41, 123, 10, 118, 46, 115, 116, 97, 116, 117, 115, 61, 104, 46, 68,
+65, 77, 65, 71, 69, 68, 59, 10, 118, 46, 115, 116, 97, 116, 117, 115, 95, 101,
+120, 112, 108, 97, 110, 97, 116, 105, 111, 110, 61, 34, 67, 104, 97, 110, 103,
+101, 100, 32, 112, 97, 114, 97, 109, 101, 116, 101, 114, 32, 110, 117, 109, 98,
+101, 114, 58, 32, 34, 43, 10, 118, 46, 105, 110, 102, 111, 46, 112, 97, 114, 97,
+109, 95, 110, 117, 109, 43, 34, 32, 97, 110, 100, 32, 34, 43, 97, 84, 46, 105,
+110, 102, 111, 46, 112, 97, 114, 97, 109, 95, 110, 117, 109, 59, 10, 125, 10,
+125, 10, 118, 46, 117, 110, 109, 97, 116, 99, 104, 101, 100, 95, 110, 101, 119,
+95, 110, 111, 100, 101, 115, 61, 97, 88, 59, 10, 118, 46, 116, 101, 120, 116,
+117, 97, 108, 108, 121, 95, 117, 110, 109, 97, 116, 99, 104, 101, 100, 95, 110,
+101, 119, 95, 110, 111, 100, 101, 115, 61, 10, 97, 89, 59, 10, 125, 10, 80, 114,
+111, 99, 101, 115, 115, 78, 111, 100, 101, 40, 97, 82, 44, 97, 83, 41, 59, 10,
+97, 82, 46, 99, 111, 114, 114, 101, 115, 112, 111, 110, 100, 105, 110, 103, 95,
+110, 111, 100, 101, 61, 97, 83, 59, 10, 97, 82, 46, 116, 101, 120, 116, 117, 97,
+108, 95, 99, 111, 114, 114, 101, 115, 112, 111, 110, 100, 105, 110, 103, 95,
+110, 111, 100, 101, 61, 97, 83, 59, 10, 65, 115, 115, 101, 114, 116, 40, 97, 82,
+46, 115, 116, 97, 116, 117, 115, 33, 61, 104, 46, 68, 65, 77, 65, 71, 69, 68,
+44, 10, 34, 83, 99, 114, 105, 112, 116, 32, 98, 101, 99, 97, 109, 101, 32, 100,
+97, 109, 97, 103, 101, 100, 34, 41, 59, 10, 125, 10, 102, 117, 110, 99, 116,
+105, 111, 110, 32, 70, 105, 110, 100, 76, 105, 118, 101, 83, 104, 97, 114, 101,
+100, 73, 110, 102, 111, 115, 40, 97, 82, 44, 77, 41, 123, 10, 118, 97, 114, 32,
+98, 98, 61, 37, 76, 105, 118, 101, 69, 100, 105, 116, 70, 105, 110, 100, 83,
+104, 97, 114, 101, 100, 70, 117, 110, 99, 116, 105, 111, 110, 73, 110, 102, 111,
+115, 70, 111, 114, 83, 99, 114, 105, 112, 116, 40, 77, 41, 59, 10, 118, 97, 114,
+32, 98, 99, 61, 110, 101, 119, 32, 100, 40, 41, 59, 10, 102, 111, 114, 40, 118,
+97, 114, 32, 120, 61, 48, 59, 120, 60, 98, 98, 46, 108, 101, 110, 103, 116, 104,
+59, 120, 43, 43, 41, 123, 10, 98, 99, 46, 112, 117, 115, 104, 40, 110, 101, 119,
+32, 83, 104, 97, 114, 101, 100, 73, 110, 102, 111, 87, 114, 97, 112, 112, 101,
+114, 40, 98, 98, 91, 120, 93, 41, 41, 59, 10, 125, 10, 102, 117, 110, 99, 116,
+105, 111, 110, 32, 70, 105, 110, 100, 70, 117, 110, 99, 116, 105, 111, 110, 73,
+110, 102, 111, 115, 40, 79, 41, 123, 10, 118, 97, 114, 32, 98, 100, 61, 91, 93,
+59, 10, 102, 111, 114, 40, 118, 97, 114, 32, 120, 61, 48, 59, 120, 60, 98, 99,
+46, 108, 101, 110, 103, 116, 104, 59, 120, 43, 43, 41, 123, 10, 118, 97, 114,
+32, 98, 101, 61, 98, 99, 91, 120, 93, 59, 10, 105, 102, 40, 98, 101, 46, 115,
+116, 97, 114, 116, 95, 112, 111, 115, 105, 116, 105, 111, 110, 61, 61, 79, 46,
+115, 116, 97, 114, 116, 95, 112, 111, 115, 105, 116, 105, 111, 110, 38, 38, 10,
+98, 101, 46, 101, 110, 100, 95, 112, 111, 115, 105, 116, 105, 111, 110, 61, 61,
+79, 46, 101, 110, 100, 95, 112, 111, 115, 105, 116, 105, 111, 110, 41, 123, 10,
+98, 100, 46, 112, 117, 115, 104, 40, 98, 101, 41, 59, 10, 125, 10, 125, 10, 105,
+102, 40, 98, 100, 46, 108, 101, 110, 103, 116, 104, 62, 48, 41, 123, 10, 114,
+101, 116, 117, 114, 110, 32, 98, 100, 59, 10, 125, 10, 125, 10, 102, 117, 110,
+99, 116, 105, 111, 110, 32, 84, 114, 97, 118, 101, 114, 115, 101, 84, 114, 101,
+101, 40, 119, 41, 123, 10, 119, 46, 108, 105, 118, 101, 95, 115, 104, 97, 114,
+101, 100, 95, 102, 117, 110, 99, 116, 105, 111, 110, 95, 105, 110, 102, 111,
+115, 61, 70, 105, 110, 100, 70, 117, 110, 99, 116, 105, 111, 110, 73, 110, 102,
+111, 115, 40, 119, 46, 105, 110, 102, 111, 41, 59, 10, 102, 111, 114, 40, 118,
+97, 114, 32, 120, 61, 48, 59, 120, 60, 119, 46, 99, 104, 105, 108, 100, 114,
+101, 110, 46, 108, 101, 110, 103, 116, 104, 59, 120, 43, 43, 41, 123, 10, 84,
+114, 97, 118, 101, 114, 115, 101, 84, 114, 101, 101, 40, 119, 46, 99, 104, 105,
+108, 100, 114, 101, 110, 91, 120, 93, 41, 59, 10, 125, 10, 125, 10, 84, 114, 97,
+118, 101, 114, 115, 101, 84, 114, 101, 101, 40, 97, 82, 41, 59, 10, 125, 10,
+102, 117, 110, 99, 116, 105, 111, 110, 32, 70, 117, 110, 99, 116, 105, 111, 110,
+67, 111, 109, 112, 105, 108, 101, 73, 110, 102, 111, 40, 98, 102, 41, 123, 10,
+116, 104, 105, 115, 46, 102, 117, 110, 99, 116, 105, 111, 110, 95, 110, 97, 109,
+101, 61, 98, 102, 91, 48, 93, 59, 10, 116, 104, 105, 115, 46, 115, 116, 97, 114,
+116, 95, 112, 111, 115, 105, 116, 105, 111, 110, 61, 98, 102, 91, 49, 93, 59,
+10, 116, 104, 105, 115, 46, 101, 110, 100, 95, 112, 111, 115, 105, 116, 105,
+111, 110, 61, 98, 102, 91, 50, 93, 59, 10, 116, 104, 105, 115, 46, 112, 97, 114,
+97, 109, 95, 110, 117, 109, 61, 98, 102, 91, 51, 93, 59, 10, 116, 104, 105, 115,
+46, 115, 99, 111, 112, 101, 95, 105, 110, 102, 111, 61, 98, 102, 91, 52, 93, 59,
+10, 116, 104, 105, 115, 46, 111, 117, 116, 101, 114, 95, 105, 110, 100, 101,
+120, 61, 98, 102, 91, 53, 93, 59, 10, 116, 104, 105, 115, 46, 115, 104, 97, 114,
+101, 100, 95, 102, 117, 110, 99, 116, 105, 111, 110, 95, 105, 110, 102, 111, 61,
+98, 102, 91, 54, 93, 59, 10, 116, 104, 105, 115, 46, 102, 117, 110, 99, 116,
+105, 111, 110, 95, 108, 105, 116, 101, 114, 97, 108, 95, 105, 100, 61, 98, 102,
+91, 55, 93, 59, 10, 116, 104, 105, 115, 46, 110, 101, 120, 116, 95, 115, 105,
+98, 108, 105, 110, 103, 95, 105, 110, 100, 101, 120, 61, 110, 117, 108, 108, 59,
+10, 116, 104, 105, 115, 46, 114, 97, 119, 95, 97, 114, 114, 97, 121, 61, 98,
+102, 59, 10, 125, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 83, 104, 97,
+114, 101, 100, 73, 110, 102, 111, 87, 114, 97, 112, 112, 101, 114, 40, 98, 102,
+41, 123, 10, 116, 104, 105, 115, 46, 102, 117, 110, 99, 116, 105, 111, 110, 95,
+110, 97, 109, 101, 61, 98, 102, 91, 48, 93, 59, 10, 116, 104, 105, 115, 46, 115,
+116, 97, 114, 116, 95, 112, 111, 115, 105, 116, 105, 111, 110, 61, 98, 102, 91,
+49, 93, 59, 10, 116, 104, 105, 115, 46, 101, 110, 100, 95, 112, 111, 115, 105,
+116, 105, 111, 110, 61, 98, 102, 91, 50, 93, 59, 10, 116, 104, 105, 115, 46,
+105, 110, 102, 111, 61, 98, 102, 91, 51, 93, 59, 10, 116, 104, 105, 115, 46,
+114, 97, 119, 95, 97, 114, 114, 97, 121, 61, 98, 102, 59, 10, 125, 10, 102, 117,
+110, 99, 116, 105, 111, 110, 32, 80, 97, 116, 99, 104, 80, 111, 115, 105, 116,
+105, 111, 110, 115, 40, 97, 100, 44, 97, 108, 44, 97, 101, 41, 123, 10, 105,
+102, 40, 97, 100, 46, 108, 105, 118, 101, 95, 115, 104, 97, 114, 101, 100, 95,
+102, 117, 110, 99, 116, 105, 111, 110, 95, 105, 110, 102, 111, 115, 41, 123, 10,
+97, 100, 46, 108, 105, 118, 101, 95, 115, 104, 97, 114, 101, 100, 95, 102, 117,
+110, 99, 116, 105, 111, 110, 95, 105, 110, 102, 111, 115, 46, 102, 111, 114, 69,
+97, 99, 104, 40, 102, 117, 110, 99, 116, 105, 111, 110, 40, 81, 41, 123, 10, 37,
+76, 105, 118, 101, 69, 100, 105, 116, 80, 97, 116, 99, 104, 70, 117, 110, 99,
+116, 105, 111, 110, 80, 111, 115, 105, 116, 105, 111, 110, 115, 40, 81, 46, 114,
+97, 119, 95, 97, 114, 114, 97, 121, 44, 10, 97, 108, 41, 59, 10, 125, 41, 59,
+10, 97, 101, 46, 112, 117, 115, 104, 40, 123, 110, 97, 109, 101, 58, 97, 100,
+46, 105, 110, 102, 111, 46, 102, 117, 110, 99, 116, 105, 111, 110, 95, 110, 97,
+109, 101, 125, 41, 59, 10, 125, 101, 108, 115, 101, 123, 10, 97, 101, 46, 112,
+117, 115, 104, 40, 10, 123, 110, 97, 109, 101, 58, 97, 100, 46, 105, 110, 102,
+111, 46, 102, 117, 110, 99, 116, 105, 111, 110, 95, 110, 97, 109, 101, 44, 105,
+110, 102, 111, 95, 110, 111, 116, 95, 102, 111, 117, 110, 100, 58, 116, 114,
+117, 101, 125, 41, 59, 10, 125, 10, 125, 10, 102, 117, 110, 99, 116, 105, 111,
+110, 32, 67, 114, 101, 97, 116, 101, 78, 97, 109, 101, 70, 111, 114, 79, 108,
+100, 83, 99, 114, 105, 112, 116, 40, 77, 41, 123, 10, 114, 101, 116, 117, 114,
+110, 32, 77, 46, 110, 97, 109, 101, 43, 34, 32, 40, 111, 108, 100, 41, 34, 59,
+10, 125, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 73, 115, 70, 117, 110,
+99, 116, 105, 111, 110, 67, 111, 110, 116, 101, 120, 116, 76, 111, 99, 97, 108,
+115, 67, 104, 97, 110, 103, 101, 100, 40, 98, 103, 44, 98, 104, 41, 123, 10,
+118, 97, 114, 32, 98, 105, 61, 98, 103, 46, 115, 99, 111, 112, 101, 95, 105,
+110, 102, 111, 59, 10, 118, 97, 114, 32, 98, 106, 61, 98, 104, 46, 115, 99, 111,
+112, 101, 95, 105, 110, 102, 111, 59, 10, 118, 97, 114, 32, 98, 107, 59, 10,
+118, 97, 114, 32, 98, 108, 59, 10, 105, 102, 40, 98, 105, 41, 123, 10, 98, 107,
+61, 98, 105, 46, 116, 111, 83, 116, 114, 105, 110, 103, 40, 41, 59, 10, 125,
+101, 108, 115, 101, 123, 10, 98, 107, 61, 34, 34, 59, 10, 125, 10, 105, 102, 40,
+98, 106, 41, 123, 10, 98, 108, 61, 98, 106, 46, 116, 111, 83, 116, 114, 105,
+110, 103, 40, 41, 59, 10, 125, 101, 108, 115, 101, 123, 10, 98, 108, 61, 34, 34,
+59, 10, 125, 10, 105, 102, 40, 98, 107, 33, 61, 98, 108, 41, 123, 10, 114, 101,
+116, 117, 114, 110, 34, 86, 97, 114, 105, 97, 98, 108, 101, 32, 109, 97, 112,
+32, 99, 104, 97, 110, 103, 101, 100, 58, 32, 91, 34, 43, 98, 107, 43, 10, 34,
+93, 32, 61, 62, 32, 91, 34, 43, 98, 108, 43, 34, 93, 34, 59, 10, 125, 10, 114,
+101, 116, 117, 114, 110, 59, 10, 125, 10, 118, 97, 114, 32, 98, 109, 59, 10,
+102, 117, 110, 99, 116, 105, 111, 110, 32, 67, 104, 101, 99, 107, 83, 116, 97,
+99, 107, 65, 99, 116, 105, 118, 97, 116, 105, 111, 110, 115, 40, 111, 108, 100,
+95, 115, 104, 97, 114, 101, 100, 95, 119, 114, 97, 112, 112, 101, 114, 95, 108,
+105, 115, 116, 44, 10, 110, 101, 119, 95, 115, 104, 97, 114, 101, 100, 95, 108,
+105, 115, 116, 44, 10, 90, 41, 123, 10, 118, 97, 114, 32, 98, 110, 61, 110, 101,
+119, 32, 100, 40, 41, 59, 10, 102, 111, 114, 40, 118, 97, 114, 32, 120, 61, 48,
+59, 120, 60, 111, 108, 100, 95, 115, 104, 97, 114, 101, 100, 95, 119, 114, 97,
+112, 112, 101, 114, 95, 108, 105, 115, 116, 46, 108, 101, 110, 103, 116, 104,
+59, 120, 43, 43, 41, 123, 10, 98, 110, 91, 120, 93, 61, 111, 108, 100, 95, 115,
+104, 97, 114, 101, 100, 95, 119, 114, 97, 112, 112, 101, 114, 95, 108, 105, 115,
+116, 91, 120, 93, 46, 105, 110, 102, 111, 59, 10, 125, 10, 118, 97, 114, 32, 98,
+111, 61, 37, 76, 105, 118, 101, 69, 100, 105, 116, 67, 104, 101, 99, 107, 65,
+110, 100, 68, 114, 111, 112, 65, 99, 116, 105, 118, 97, 116, 105, 111, 110, 115,
+40, 10, 98, 110, 44, 110, 101, 119, 95, 115, 104, 97, 114, 101, 100, 95, 108,
+105, 115, 116, 44, 116, 114, 117, 101, 41, 59, 10, 105, 102, 40, 98, 111, 91,
+111, 108, 100, 95, 115, 104, 97, 114, 101, 100, 95, 119, 114, 97, 112, 112, 101,
+114, 95, 108, 105, 115, 116, 46, 108, 101, 110, 103, 116, 104, 93, 41, 123, 10,
+116, 104, 114, 111, 119, 32, 110, 101, 119, 32, 70, 97, 105, 108, 117, 114, 101,
+40, 98, 111, 91, 111, 108, 100, 95, 115, 104, 97, 114, 101, 100, 95, 119, 114,
+97, 112, 112, 101, 114, 95, 108, 105, 115, 116, 46, 108, 101, 110, 103, 116,
+104, 93, 41, 59, 10, 125, 10, 118, 97, 114, 32, 98, 112, 61, 110, 101, 119, 32,
+100, 40, 41, 59, 10, 118, 97, 114, 32, 98, 113, 61, 110, 101, 119, 32, 100, 40,
+41, 59, 10, 102, 111, 114, 40, 118, 97, 114, 32, 120, 61, 48, 59, 120, 60, 98,
+110, 46, 108, 101, 110, 103, 116, 104, 59, 120, 43, 43, 41, 123, 10, 118, 97,
+114, 32, 98, 114, 61, 111, 108, 100, 95, 115, 104, 97, 114, 101, 100, 95, 119,
+114, 97, 112, 112, 101, 114, 95, 108, 105, 115, 116, 91, 120, 93, 59, 10, 105,
+102, 40, 98, 111, 91, 120, 93, 61, 61, 98, 109, 46, 82, 69, 80, 76, 65, 67, 69,
+68, 95, 79, 78, 95, 65, 67, 84, 73, 86, 69, 95, 83, 84, 65, 67, 75, 41, 123, 10,
+98, 113, 46, 112, 117, 115, 104, 40, 123, 110, 97, 109, 101, 58, 98, 114, 46,
+102, 117, 110, 99, 116, 105, 111, 110, 95, 110, 97, 109, 101, 125, 41, 59, 10,
+125, 101, 108, 115, 101, 32, 105, 102, 40, 98, 111, 91, 120, 93, 33, 61, 98,
+109, 46, 65, 86, 65, 73, 76, 65, 66, 76, 69, 95, 70, 79, 82, 95, 80, 65, 84, 67,
+72, 41, 123, 10, 118, 97, 114, 32, 98, 115, 61, 123, 10, 110, 97, 109, 101, 58,
+98, 114, 46, 102, 117, 110, 99, 116, 105, 111, 110, 95, 110, 97, 109, 101, 44,
+10, 115, 116, 97, 114, 116, 95, 112, 111, 115, 58, 98, 114, 46, 115, 116, 97,
+114, 116, 95, 112, 111, 115, 105, 116, 105, 111, 110, 44, 10, 101, 110, 100, 95,
+112, 111, 115, 58, 98, 114, 46, 101, 110, 100, 95, 112, 111, 115, 105, 116, 105,
+111, 110, 44, 10, 114, 101, 112, 108, 97, 99, 101, 95, 112, 114, 111, 98, 108,
+101, 109, 58, 10, 98, 109, 46, 83, 121, 109, 98, 111, 108, 78, 97, 109, 101, 40,
+98, 111, 91, 120, 93, 41, 10, 125, 59, 10, 98, 112, 46, 112, 117, 115, 104, 40,
+98, 115, 41, 59, 10, 125, 10, 125, 10, 105, 102, 40, 98, 113, 46, 108, 101, 110,
+103, 116, 104, 62, 48, 41, 123, 10, 90, 46, 112, 117, 115, 104, 40, 123, 100,
+114, 111, 112, 112, 101, 100, 95, 102, 114, 111, 109, 95, 115, 116, 97, 99, 107,
+58, 98, 113, 125, 41, 59, 10, 125, 10, 105, 102, 40, 98, 112, 46, 108, 101, 110,
+103, 116, 104, 62, 48, 41, 123, 10, 90, 46, 112, 117, 115, 104, 40, 123, 102,
+117, 110, 99, 116, 105, 111, 110, 115, 95, 111, 110, 95, 115, 116, 97, 99, 107,
+58, 98, 112, 125, 41, 59, 10, 116, 104, 114, 111, 119, 32, 110, 101, 119, 32,
+70, 97, 105, 108, 117, 114, 101, 40, 34, 66, 108, 111, 99, 107, 101, 100, 32,
+98, 121, 32, 102, 117, 110, 99, 116, 105, 111, 110, 115, 32, 111, 110, 32, 115,
+116, 97, 99, 107, 34, 41, 59, 10, 125, 10, 114, 101, 116, 117, 114, 110, 32, 98,
+113, 46, 108, 101, 110, 103, 116, 104, 59, 10, 125, 10, 118, 97, 114, 32, 98,
+109, 61, 123, 10, 65, 86, 65, 73, 76, 65, 66, 76, 69, 95, 70, 79, 82, 95, 80,
+65, 84, 67, 72, 58, 49, 44, 10, 66, 76, 79, 67, 75, 69, 68, 95, 79, 78, 95, 65,
+67, 84, 73, 86, 69, 95, 83, 84, 65, 67, 75, 58, 50, 44, 10, 66, 76, 79, 67, 75,
+69, 68, 95, 79, 78, 95, 79, 84, 72, 69, 82, 95, 83, 84, 65, 67, 75, 58, 51, 44,
+10, 66, 76, 79, 67, 75, 69, 68, 95, 85, 78, 68, 69, 82, 95, 78, 65, 84, 73, 86,
+69, 95, 67, 79, 68, 69, 58, 52, 44, 10, 82, 69, 80, 76, 65, 67, 69, 68, 95, 79,
+78, 95, 65, 67, 84, 73, 86, 69, 95, 83, 84, 65, 67, 75, 58, 53, 44, 10, 66, 76,
+79, 67, 75, 69, 68, 95, 85, 78, 68, 69, 82, 95, 71, 69, 78, 69, 82, 65, 84, 79,
+82, 58, 54, 44, 10, 66, 76, 79, 67, 75, 69, 68, 95, 65, 67, 84, 73, 86, 69, 95,
+71, 69, 78, 69, 82, 65, 84, 79, 82, 58, 55, 44, 10, 66, 76, 79, 67, 75, 69, 68,
+95, 78, 79, 95, 78, 69, 87, 95, 84, 65, 82, 71, 69, 84, 95, 79, 78, 95, 82, 69,
+83, 84, 65, 82, 84, 58, 56, 10, 125, 59, 10, 98, 109, 46, 83, 121, 109, 98, 111,
+108, 78, 97, 109, 101, 61, 102, 117, 110, 99, 116, 105, 111, 110, 40, 98, 116,
+41, 123, 10, 118, 97, 114, 32, 98, 117, 61, 98, 109, 59, 10, 102, 111, 114, 40,
+118, 97, 114, 32, 98, 118, 32, 105, 110, 32, 98, 117, 41, 123, 10, 105, 102, 40,
+98, 117, 91, 98, 118, 93, 61, 61, 98, 116, 41, 123, 10, 114, 101, 116, 117, 114,
+110, 32, 98, 118, 59, 10, 125, 10, 125, 10, 125, 59, 10, 102, 117, 110, 99, 116,
+105, 111, 110, 32, 70, 97, 105, 108, 117, 114, 101, 40, 97, 103, 41, 123, 10,
+116, 104, 105, 115, 46, 109, 101, 115, 115, 97, 103, 101, 61, 97, 103, 59, 10,
+125, 10, 70, 97, 105, 108, 117, 114, 101, 46, 112, 114, 111, 116, 111, 116, 121,
+112, 101, 46, 116, 111, 83, 116, 114, 105, 110, 103, 61, 102, 117, 110, 99, 116,
+105, 111, 110, 40, 41, 123, 10, 114, 101, 116, 117, 114, 110, 34, 76, 105, 118,
+101, 69, 100, 105, 116, 32, 70, 97, 105, 108, 117, 114, 101, 58, 32, 34, 43,
+116, 104, 105, 115, 46, 109, 101, 115, 115, 97, 103, 101, 59, 10, 125, 59, 10,
+102, 117, 110, 99, 116, 105, 111, 110, 32, 67, 111, 112, 121, 69, 114, 114, 111,
+114, 80, 111, 115, 105, 116, 105, 111, 110, 84, 111, 68, 101, 116, 97, 105, 108,
+115, 40, 98, 119, 44, 111, 41, 123, 10, 102, 117, 110, 99, 116, 105, 111, 110,
+32, 99, 114, 101, 97, 116, 101, 80, 111, 115, 105, 116, 105, 111, 110, 83, 116,
+114, 117, 99, 116, 40, 77, 44, 98, 120, 41, 123, 10, 105, 102, 40, 98, 120, 61,
+61, 45, 49, 41, 114, 101, 116, 117, 114, 110, 59, 10, 118, 97, 114, 32, 98, 121,
+61, 77, 46, 108, 111, 99, 97, 116, 105, 111, 110, 70, 114, 111, 109, 80, 111,
+115, 105, 116, 105, 111, 110, 40, 98, 120, 44, 116, 114, 117, 101, 41, 59, 10,
+105, 102, 40, 98, 121, 61, 61, 110, 117, 108, 108, 41, 114, 101, 116, 117, 114,
+110, 59, 10, 114, 101, 116, 117, 114, 110, 123, 10, 108, 105, 110, 101, 58, 98,
+121, 46, 108, 105, 110, 101, 43, 49, 44, 10, 99, 111, 108, 117, 109, 110, 58,
+98, 121, 46, 99, 111, 108, 117, 109, 110, 43, 49, 44, 10, 112, 111, 115, 105,
+116, 105, 111, 110, 58, 98, 120, 10, 125, 59, 10, 125, 10, 105, 102, 40, 33, 40,
+34, 115, 99, 114, 105, 112, 116, 79, 98, 106, 101, 99, 116, 34, 105, 110, 32,
+98, 119, 41, 124, 124, 33, 40, 34, 115, 116, 97, 114, 116, 80, 111, 115, 105,
+116, 105, 111, 110, 34, 105, 110, 32, 98, 119, 41, 41, 123, 10, 114, 101, 116,
+117, 114, 110, 59, 10, 125, 10, 118, 97, 114, 32, 77, 61, 98, 119, 46, 115, 99,
+114, 105, 112, 116, 79, 98, 106, 101, 99, 116, 59, 10, 118, 97, 114, 32, 98,
+122, 61, 123, 10, 115, 116, 97, 114, 116, 58, 99, 114, 101, 97, 116, 101, 80,
+111, 115, 105, 116, 105, 111, 110, 83, 116, 114, 117, 99, 116, 40, 77, 44, 98,
+119, 46, 115, 116, 97, 114, 116, 80, 111, 115, 105, 116, 105, 111, 110, 41, 44,
+10, 101, 110, 100, 58, 99, 114, 101, 97, 116, 101, 80, 111, 115, 105, 116, 105,
+111, 110, 83, 116, 114, 117, 99, 116, 40, 77, 44, 98, 119, 46, 101, 110, 100,
+80, 111, 115, 105, 116, 105, 111, 110, 41, 10, 125, 59, 10, 111, 46, 112, 111,
+115, 105, 116, 105, 111, 110, 61, 98, 122, 59, 10, 125, 10, 102, 117, 110, 99,
+116, 105, 111, 110, 32, 83, 101, 116, 83, 99, 114, 105, 112, 116, 83, 111, 117,
+114, 99, 101, 40, 77, 44, 98, 65, 44, 98, 66, 44, 90, 41, 123, 10, 118, 97, 114,
+32, 105, 61, 77, 46, 115, 111, 117, 114, 99, 101, 59, 10, 118, 97, 114, 32, 98,
+67, 61, 67, 111, 109, 112, 97, 114, 101, 83, 116, 114, 105, 110, 103, 115, 40,
+105, 44, 98, 65, 41, 59, 10, 114, 101, 116, 117, 114, 110, 32, 65, 112, 112,
+108, 121, 80, 97, 116, 99, 104, 77, 117, 108, 116, 105, 67, 104, 117, 110, 107,
+40, 77, 44, 98, 67, 44, 98, 65, 44, 98, 66, 44, 10, 90, 41, 59, 10, 125, 10,
+102, 117, 110, 99, 116, 105, 111, 110, 32, 67, 111, 109, 112, 97, 114, 101, 83,
+116, 114, 105, 110, 103, 115, 40, 98, 68, 44, 98, 69, 41, 123, 10, 114, 101,
+116, 117, 114, 110, 32, 37, 76, 105, 118, 101, 69, 100, 105, 116, 67, 111, 109,
+112, 97, 114, 101, 83, 116, 114, 105, 110, 103, 115, 40, 98, 68, 44, 98, 69, 41,
+59, 10, 125, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 65, 112, 112, 108,
+121, 83, 105, 110, 103, 108, 101, 67, 104, 117, 110, 107, 80, 97, 116, 99, 104,
+40, 77, 44, 99, 104, 97, 110, 103, 101, 95, 112, 111, 115, 44, 99, 104, 97, 110,
+103, 101, 95, 108, 101, 110, 44, 110, 101, 119, 95, 115, 116, 114, 44, 10, 90,
+41, 123, 10, 118, 97, 114, 32, 105, 61, 77, 46, 115, 111, 117, 114, 99, 101, 59,
+10, 118, 97, 114, 32, 98, 65, 61, 105, 46, 115, 117, 98, 115, 116, 114, 105,
+110, 103, 40, 48, 44, 99, 104, 97, 110, 103, 101, 95, 112, 111, 115, 41, 43, 10,
+110, 101, 119, 95, 115, 116, 114, 43, 105, 46, 115, 117, 98, 115, 116, 114, 105,
+110, 103, 40, 99, 104, 97, 110, 103, 101, 95, 112, 111, 115, 43, 99, 104, 97,
+110, 103, 101, 95, 108, 101, 110, 41, 59, 10, 114, 101, 116, 117, 114, 110, 32,
+65, 112, 112, 108, 121, 80, 97, 116, 99, 104, 77, 117, 108, 116, 105, 67, 104,
+117, 110, 107, 40, 77, 44, 10, 91, 99, 104, 97, 110, 103, 101, 95, 112, 111,
+115, 44, 99, 104, 97, 110, 103, 101, 95, 112, 111, 115, 43, 99, 104, 97, 110,
+103, 101, 95, 108, 101, 110, 44, 99, 104, 97, 110, 103, 101, 95, 112, 111, 115,
+43, 110, 101, 119, 95, 115, 116, 114, 46, 108, 101, 110, 103, 116, 104, 93, 44,
+10, 98, 65, 44, 102, 97, 108, 115, 101, 44, 90, 41, 59, 10, 125, 10, 102, 117,
+110, 99, 116, 105, 111, 110, 32, 68, 101, 115, 99, 114, 105, 98, 101, 67, 104,
+97, 110, 103, 101, 84, 114, 101, 101, 40, 97, 82, 41, 123, 10, 102, 117, 110,
+99, 116, 105, 111, 110, 32, 80, 114, 111, 99, 101, 115, 115, 79, 108, 100, 78,
+111, 100, 101, 40, 119, 41, 123, 10, 118, 97, 114, 32, 98, 70, 61, 91, 93, 59,
+10, 102, 111, 114, 40, 118, 97, 114, 32, 120, 61, 48, 59, 120, 60, 119, 46, 99,
+104, 105, 108, 100, 114, 101, 110, 46, 108, 101, 110, 103, 116, 104, 59, 120,
+43, 43, 41, 123, 10, 118, 97, 114, 32, 97, 81, 61, 119, 46, 99, 104, 105, 108,
+100, 114, 101, 110, 91, 120, 93, 59, 10, 105, 102, 40, 97, 81, 46, 115, 116, 97,
+116, 117, 115, 33, 61, 104, 46, 85, 78, 67, 72, 65, 78, 71, 69, 68, 41, 123, 10,
+98, 70, 46, 112, 117, 115, 104, 40, 80, 114, 111, 99, 101, 115, 115, 79, 108,
+100, 78, 111, 100, 101, 40, 97, 81, 41, 41, 59, 10, 125, 10, 125, 10, 118, 97,
+114, 32, 98, 71, 61, 91, 93, 59, 10, 105, 102, 40, 119, 46, 116, 101, 120, 116,
+117, 97, 108, 108, 121, 95, 117, 110, 109, 97, 116, 99, 104, 101, 100, 95, 110,
+101, 119, 95, 110, 111, 100, 101, 115, 41, 123, 10, 102, 111, 114, 40, 118, 97,
+114, 32, 120, 61, 48, 59, 120, 60, 119, 46, 116, 101, 120, 116, 117, 97, 108,
+108, 121, 95, 117, 110, 109, 97, 116, 99, 104, 101, 100, 95, 110, 101, 119, 95,
+110, 111, 100, 101, 115, 46, 108, 101, 110, 103, 116, 104, 59, 120, 43, 43, 41,
+123, 10, 118, 97, 114, 32, 97, 81, 61, 119, 46, 116, 101, 120, 116, 117, 97,
+108, 108, 121, 95, 117, 110, 109, 97, 116, 99, 104, 101, 100, 95, 110, 101, 119,
+95, 110, 111, 100, 101, 115, 91, 120, 93, 59, 10, 98, 71, 46, 112, 117, 115,
+104, 40, 80, 114, 111, 99, 101, 115, 115, 78, 101, 119, 78, 111, 100, 101, 40,
+97, 81, 41, 41, 59, 10, 125, 10, 125, 10, 118, 97, 114, 32, 98, 72, 61, 123, 10,
+110, 97, 109, 101, 58, 119, 46, 105, 110, 102, 111, 46, 102, 117, 110, 99, 116,
+105, 111, 110, 95, 110, 97, 109, 101, 44, 10, 112, 111, 115, 105, 116, 105, 111,
+110, 115, 58, 68, 101, 115, 99, 114, 105, 98, 101, 80, 111, 115, 105, 116, 105,
+111, 110, 115, 40, 119, 41, 44, 10, 115, 116, 97, 116, 117, 115, 58, 119, 46,
+115, 116, 97, 116, 117, 115, 44, 10, 99, 104, 105, 108, 100, 114, 101, 110, 58,
+98, 70, 44, 10, 110, 101, 119, 95, 99, 104, 105, 108, 100, 114, 101, 110, 58,
+98, 71, 10, 125, 59, 10, 105, 102, 40, 119, 46, 115, 116, 97, 116, 117, 115, 95,
+101, 120, 112, 108, 97, 110, 97, 116, 105, 111, 110, 41, 123, 10, 98, 72, 46,
+115, 116, 97, 116, 117, 115, 95, 101, 120, 112, 108, 97, 110, 97, 116, 105, 111,
+110, 61, 119, 46, 115, 116, 97, 116, 117, 115, 95, 101, 120, 112, 108, 97, 110,
+97, 116, 105, 111, 110, 59, 10, 125, 10, 105, 102, 40, 119, 46, 116, 101, 120,
+116, 117, 97, 108, 95, 99, 111, 114, 114, 101, 115, 112, 111, 110, 100, 105,
+110, 103, 95, 110, 111, 100, 101, 41, 123, 10, 98, 72, 46, 110, 101, 119, 95,
+112, 111, 115, 105, 116, 105, 111, 110, 115, 61, 68, 101, 115, 99, 114, 105, 98,
+101, 80, 111, 115, 105, 116, 105, 111, 110, 115, 40, 119, 46, 116, 101, 120,
+116, 117, 97, 108, 95, 99, 111, 114, 114, 101, 115, 112, 111, 110, 100, 105,
+110, 103, 95, 110, 111, 100, 101, 41, 59, 10, 125, 10, 114, 101, 116, 117, 114,
+110, 32, 98, 72, 59, 10, 125, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 80,
+114, 111, 99, 101, 115, 115, 78, 101, 119, 78, 111, 100, 101, 40, 119, 41, 123,
+10, 118, 97, 114, 32, 98, 70, 61, 91, 93, 59, 10, 105, 102, 40, 102, 97, 108,
+115, 101, 41, 123, 10, 102, 111, 114, 40, 118, 97, 114, 32, 120, 61, 48, 59,
+120, 60, 119, 46, 99, 104, 105, 108, 100, 114, 101, 110, 46, 108, 101, 110, 103,
+116, 104, 59, 120, 43, 43, 41, 123, 10, 98, 70, 46, 112, 117, 115, 104, 40, 80,
+114, 111, 99, 101, 115, 115, 78, 101, 119, 78, 111, 100, 101, 40, 119, 46, 99,
+104, 105, 108, 100, 114, 101, 110, 91, 120, 93, 41, 41, 59, 10, 125, 10, 125,
+10, 118, 97, 114, 32, 98, 72, 61, 123, 10, 110, 97, 109, 101, 58, 119, 46, 105,
+110, 102, 111, 46, 102, 117, 110, 99, 116, 105, 111, 110, 95, 110, 97, 109, 101,
+44, 10, 112, 111, 115, 105, 116, 105, 111, 110, 115, 58, 68, 101, 115, 99, 114,
+105, 98, 101, 80, 111, 115, 105, 116, 105, 111, 110, 115, 40, 119, 41, 44, 10,
+99, 104, 105, 108, 100, 114, 101, 110, 58, 98, 70, 44, 10, 125, 59, 10, 114,
+101, 116, 117, 114, 110, 32, 98, 72, 59, 10, 125, 10, 102, 117, 110, 99, 116,
+105, 111, 110, 32, 68, 101, 115, 99, 114, 105, 98, 101, 80, 111, 115, 105, 116,
+105, 111, 110, 115, 40, 119, 41, 123, 10, 114, 101, 116, 117, 114, 110, 123, 10,
+115, 116, 97, 114, 116, 95, 112, 111, 115, 105, 116, 105, 111, 110, 58, 119, 46,
+105, 110, 102, 111, 46, 115, 116, 97, 114, 116, 95, 112, 111, 115, 105, 116,
+105, 111, 110, 44, 10, 101, 110, 100, 95, 112, 111, 115, 105, 116, 105, 111,
+110, 58, 119, 46, 105, 110, 102, 111, 46, 101, 110, 100, 95, 112, 111, 115, 105,
+116, 105, 111, 110, 10, 125, 59, 10, 125, 10, 114, 101, 116, 117, 114, 110, 32,
+80, 114, 111, 99, 101, 115, 115, 79, 108, 100, 78, 111, 100, 101, 40, 97, 82,
+41, 59, 10, 125, 10, 118, 97, 114, 32, 98, 73, 61, 123, 125, 59, 10, 98, 73, 46,
+83, 101, 116, 83, 99, 114, 105, 112, 116, 83, 111, 117, 114, 99, 101, 61, 83,
+101, 116, 83, 99, 114, 105, 112, 116, 83, 111, 117, 114, 99, 101, 59, 10, 98,
+73, 46, 65, 112, 112, 108, 121, 80, 97, 116, 99, 104, 77, 117, 108, 116, 105,
+67, 104, 117, 110, 107, 61, 65, 112, 112, 108, 121, 80, 97, 116, 99, 104, 77,
+117, 108, 116, 105, 67, 104, 117, 110, 107, 59, 10, 98, 73, 46, 70, 97, 105,
+108, 117, 114, 101, 61, 70, 97, 105, 108, 117, 114, 101, 59, 10, 98, 73, 46, 84,
+101, 115, 116, 65, 112, 105, 61, 123, 10, 80, 111, 115, 84, 114, 97, 110, 115,
+108, 97, 116, 111, 114, 58, 80, 111, 115, 84, 114, 97, 110, 115, 108, 97, 116,
+111, 114, 44, 10, 67, 111, 109, 112, 97, 114, 101, 83, 116, 114, 105, 110, 103,
+115, 58, 67, 111, 109, 112, 97, 114, 101, 83, 116, 114, 105, 110, 103, 115, 44,
+10, 65, 112, 112, 108, 121, 83, 105, 110, 103, 108, 101, 67, 104, 117, 110, 107,
+80, 97, 116, 99, 104, 58, 65, 112, 112, 108, 121, 83, 105, 110, 103, 108, 101,
+67, 104, 117, 110, 107, 80, 97, 116, 99, 104, 10, 125, 59, 10, 98, 46, 73, 110,
+115, 116, 97, 108, 108, 67, 111, 110, 115, 116, 97, 110, 116, 115, 40, 98, 44,
+91, 10, 34, 83, 101, 116, 83, 99, 114, 105, 112, 116, 83, 111, 117, 114, 99,
+101, 34, 44, 98, 73, 46, 83, 101, 116, 83, 99, 114, 105, 112, 116, 83, 111, 117,
+114, 99, 101, 44, 10, 93, 41, 59, 10, 97, 46, 68, 101, 98, 117, 103, 46, 76,
+105, 118, 101, 69, 100, 105, 116, 61, 98, 73, 59, 10, 125, 41, 10, 10, 10, 40,
+102, 117, 110, 99, 116, 105, 111, 110, 40, 97, 44, 98, 44, 99, 41, 123, 10, 34,
+117, 115, 101, 32, 115, 116, 114, 105, 99, 116, 34, 59, 10, 37, 67, 104, 101,
+99, 107, 73, 115, 66, 111, 111, 116, 115, 116, 114, 97, 112, 112, 105, 110, 103,
+40, 41, 59, 10, 118, 97, 114, 32, 100, 61, 40, 118, 111, 105, 100, 32, 48, 41,
+59, 10, 118, 97, 114, 32, 101, 61, 37, 69, 120, 112, 111, 114, 116, 70, 114,
+111, 109, 82, 117, 110, 116, 105, 109, 101, 40, 123, 125, 41, 59, 10, 102, 117,
+110, 99, 116, 105, 111, 110, 32, 69, 120, 112, 111, 114, 116, 40, 102, 41, 123,
+10, 102, 40, 101, 41, 59, 10, 125, 10, 102, 117, 110, 99, 116, 105, 111, 110,
+32, 73, 109, 112, 111, 114, 116, 40, 102, 41, 123, 10, 102, 46, 110, 101, 120,
+116, 61, 100, 59, 10, 100, 61, 102, 59, 10, 125, 10, 102, 117, 110, 99, 116,
+105, 111, 110, 32, 73, 109, 112, 111, 114, 116, 78, 111, 119, 40, 103, 41, 123,
+10, 114, 101, 116, 117, 114, 110, 32, 101, 91, 103, 93, 59, 10, 125, 10, 102,
+117, 110, 99, 116, 105, 111, 110, 32, 73, 110, 115, 116, 97, 108, 108, 67, 111,
+110, 115, 116, 97, 110, 116, 115, 40, 104, 44, 105, 41, 123, 10, 37, 67, 104,
+101, 99, 107, 73, 115, 66, 111, 111, 116, 115, 116, 114, 97, 112, 112, 105, 110,
+103, 40, 41, 59, 10, 37, 79, 112, 116, 105, 109, 105, 122, 101, 79, 98, 106,
+101, 99, 116, 70, 111, 114, 65, 100, 100, 105, 110, 103, 77, 117, 108, 116, 105,
+112, 108, 101, 80, 114, 111, 112, 101, 114, 116, 105, 101, 115, 40, 104, 44,
+105, 46, 108, 101, 110, 103, 116, 104, 62, 62, 49, 41, 59, 10, 118, 97, 114, 32,
+106, 61, 50, 124, 52, 124, 49, 59, 10, 102, 111, 114, 40, 118, 97, 114, 32, 107,
+61, 48, 59, 107, 60, 105, 46, 108, 101, 110, 103, 116, 104, 59, 107, 43, 61, 50,
+41, 123, 10, 118, 97, 114, 32, 103, 61, 105, 91, 107, 93, 59, 10, 118, 97, 114,
+32, 108, 61, 105, 91, 107, 43, 49, 93, 59, 10, 37, 65, 100, 100, 78, 97, 109,
+101, 100, 80, 114, 111, 112, 101, 114, 116, 121, 40, 104, 44, 103, 44, 108, 44,
+106, 41, 59, 10, 125, 10, 37, 84, 111, 70, 97, 115, 116, 80, 114, 111, 112, 101,
+114, 116, 105, 101, 115, 40, 104, 41, 59, 10, 125, 10, 102, 117, 110, 99, 116,
+105, 111, 110, 32, 83, 101, 116, 85, 112, 76, 111, 99, 107, 101, 100, 80, 114,
+111, 116, 111, 116, 121, 112, 101, 40, 10, 99, 111, 110, 115, 116, 114, 117, 99,
+116, 111, 114, 44, 102, 105, 101, 108, 100, 115, 44, 109, 101, 116, 104, 111,
+100, 115, 41, 123, 10, 37, 67, 104, 101, 99, 107, 73, 115, 66, 111, 111, 116,
+115, 116, 114, 97, 112, 112, 105, 110, 103, 40, 41, 59, 10, 118, 97, 114, 32,
+109, 61, 99, 111, 110, 115, 116, 114, 117, 99, 116, 111, 114, 46, 112, 114, 111,
+116, 111, 116, 121, 112, 101, 59, 10, 118, 97, 114, 32, 110, 61, 40, 109, 101,
+116, 104, 111, 100, 115, 46, 108, 101, 110, 103, 116, 104, 62, 62, 49, 41, 43,
+40, 102, 105, 101, 108, 100, 115, 63, 102, 105, 101, 108, 100, 115, 46, 108,
+101, 110, 103, 116, 104, 58, 48, 41, 59, 10, 105, 102, 40, 110, 62, 61, 52, 41,
+123, 10, 37, 79, 112, 116, 105, 109, 105, 122, 101, 79, 98, 106, 101, 99, 116,
+70, 111, 114, 65, 100, 100, 105, 110, 103, 77, 117, 108, 116, 105, 112, 108,
+101, 80, 114, 111, 112, 101, 114, 116, 105, 101, 115, 40, 109, 44, 110, 41, 59,
+10, 125, 10, 105, 102, 40, 102, 105, 101, 108, 100, 115, 41, 123, 10, 102, 111,
+114, 40, 118, 97, 114, 32, 107, 61, 48, 59, 107, 60, 102, 105, 101, 108, 100,
+115, 46, 108, 101, 110, 103, 116, 104, 59, 107, 43, 43, 41, 123, 10, 37, 65,
+100, 100, 78, 97, 109, 101, 100, 80, 114, 111, 112, 101, 114, 116, 121, 40, 109,
+44, 102, 105, 101, 108, 100, 115, 91, 107, 93, 44, 10, 40, 118, 111, 105, 100,
+32, 48, 41, 44, 50, 124, 52, 41, 59, 10, 125, 10, 125, 10, 102, 111, 114, 40,
+118, 97, 114, 32, 107, 61, 48, 59, 107, 60, 109, 101, 116, 104, 111, 100, 115,
+46, 108, 101, 110, 103, 116, 104, 59, 107, 43, 61, 50, 41, 123, 10, 118, 97,
+114, 32, 111, 61, 109, 101, 116, 104, 111, 100, 115, 91, 107, 93, 59, 10, 118,
+97, 114, 32, 102, 61, 109, 101, 116, 104, 111, 100, 115, 91, 107, 43, 49, 93,
+59, 10, 37, 65, 100, 100, 78, 97, 109, 101, 100, 80, 114, 111, 112, 101, 114,
+116, 121, 40, 109, 44, 111, 44, 102, 44, 50, 124, 52, 124, 49, 41, 59, 10, 37,
+83, 101, 116, 78, 97, 116, 105, 118, 101, 70, 108, 97, 103, 40, 102, 41, 59, 10,
+125, 10, 37, 73, 110, 116, 101, 114, 110, 97, 108, 83, 101, 116, 80, 114, 111,
+116, 111, 116, 121, 112, 101, 40, 109, 44, 110, 117, 108, 108, 41, 59, 10, 37,
+84, 111, 70, 97, 115, 116, 80, 114, 111, 112, 101, 114, 116, 105, 101, 115, 40,
+109, 41, 59, 10, 125, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 80, 111,
+115, 116, 78, 97, 116, 105, 118, 101, 115, 40, 98, 41, 123, 10, 37, 67, 104,
+101, 99, 107, 73, 115, 66, 111, 111, 116, 115, 116, 114, 97, 112, 112, 105, 110,
+103, 40, 41, 59, 10, 102, 111, 114, 40, 59, 33, 40, 100, 61, 61, 61, 40, 118,
+111, 105, 100, 32, 48, 41, 41, 59, 100, 61, 100, 46, 110, 101, 120, 116, 41,
+123, 10, 100, 40, 101, 41, 59, 10, 125, 10, 101, 61, 40, 118, 111, 105, 100, 32,
+48, 41, 59, 10, 98, 46, 69, 120, 112, 111, 114, 116, 61, 40, 118, 111, 105, 100,
+32, 48, 41, 59, 10, 98, 46, 73, 109, 112, 111, 114, 116, 61, 40, 118, 111, 105,
+100, 32, 48, 41, 59, 10, 98, 46, 73, 109, 112, 111, 114, 116, 78, 111, 119, 61,
+40, 118, 111, 105, 100, 32, 48, 41, 59, 10, 98, 46, 80, 111, 115, 116, 78, 97,
+116, 105, 118, 101, 115, 61, 40, 118, 111, 105, 100, 32, 48, 41, 59, 10, 125,
+10, 118, 97, 114, 32, 112, 61, 73, 109, 112, 111, 114, 116, 78, 111, 119, 40,
+34, 105, 116, 101, 114, 97, 116, 111, 114, 95, 115, 121, 109, 98, 111, 108, 34,
+41, 59, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 71, 101, 116, 77, 101,
+116, 104, 111, 100, 40, 113, 44, 114, 41, 123, 10, 118, 97, 114, 32, 115, 61,
+113, 91, 114, 93, 59, 10, 105, 102, 40, 40, 115, 61, 61, 110, 117, 108, 108, 41,
+41, 114, 101, 116, 117, 114, 110, 40, 118, 111, 105, 100, 32, 48, 41, 59, 10,
+105, 102, 40, 40, 116, 121, 112, 101, 111, 102, 40, 115, 41, 61, 61, 61, 39,
+102, 117, 110, 99, 116, 105, 111, 110, 39, 41, 41, 114, 101, 116, 117, 114, 110,
+32, 115, 59, 10, 116, 104, 114, 111, 119, 32, 37, 109, 97, 107, 101, 95, 116,
+121, 112, 101, 95, 101, 114, 114, 111, 114, 40, 50, 53, 44, 116, 121, 112, 101,
+111, 102, 32, 115, 41, 59, 10, 125, 10, 102, 117, 110, 99, 116, 105, 111, 110,
+32, 71, 101, 116, 73, 116, 101, 114, 97, 116, 111, 114, 40, 113, 44, 116, 41,
+123, 10, 105, 102, 40, 40, 116, 61, 61, 61, 40, 118, 111, 105, 100, 32, 48, 41,
+41, 41, 123, 10, 116, 61, 113, 91, 112, 93, 59, 10, 125, 10, 105, 102, 40, 33,
+40, 116, 121, 112, 101, 111, 102, 40, 116, 41, 61, 61, 61, 39, 102, 117, 110,
+99, 116, 105, 111, 110, 39, 41, 41, 123, 10, 116, 104, 114, 111, 119, 32, 37,
+109, 97, 107, 101, 95, 116, 121, 112, 101, 95, 101, 114, 114, 111, 114, 40, 56,
+57, 44, 113, 41, 59, 10, 125, 10, 118, 97, 114, 32, 117, 61, 37, 95, 67, 97,
+108, 108, 40, 116, 44, 113, 41, 59, 10, 105, 102, 40, 33, 40, 37, 95, 73, 115,
+74, 83, 82, 101, 99, 101, 105, 118, 101, 114, 40, 117, 41, 41, 41, 123, 10, 116,
+104, 114, 111, 119, 32, 37, 109, 97, 107, 101, 95, 116, 121, 112, 101, 95, 101,
+114, 114, 111, 114, 40, 56, 50, 44, 117, 41, 59, 10, 125, 10, 114, 101, 116,
+117, 114, 110, 32, 117, 59, 10, 125, 10, 101, 46, 71, 101, 116, 73, 116, 101,
+114, 97, 116, 111, 114, 61, 71, 101, 116, 73, 116, 101, 114, 97, 116, 111, 114,
+59, 10, 101, 46, 71, 101, 116, 77, 101, 116, 104, 111, 100, 61, 71, 101, 116,
+77, 101, 116, 104, 111, 100, 59, 10, 37, 79, 112, 116, 105, 109, 105, 122, 101,
+79, 98, 106, 101, 99, 116, 70, 111, 114, 65, 100, 100, 105, 110, 103, 77, 117,
+108, 116, 105, 112, 108, 101, 80, 114, 111, 112, 101, 114, 116, 105, 101, 115,
+40, 98, 44, 49, 52, 41, 59, 10, 98, 46, 73, 109, 112, 111, 114, 116, 61, 73,
+109, 112, 111, 114, 116, 59, 10, 98, 46, 73, 109, 112, 111, 114, 116, 78, 111,
+119, 61, 73, 109, 112, 111, 114, 116, 78, 111, 119, 59, 10, 98, 46, 69, 120,
+112, 111, 114, 116, 61, 69, 120, 112, 111, 114, 116, 59, 10, 98, 46, 73, 110,
+115, 116, 97, 108, 108, 67, 111, 110, 115, 116, 97, 110, 116, 115, 61, 73, 110,
+115, 116, 97, 108, 108, 67, 111, 110, 115, 116, 97, 110, 116, 115, 59, 10, 98,
+46, 83, 101, 116, 85, 112, 76, 111, 99, 107, 101, 100, 80, 114, 111, 116, 111,
+116, 121, 112, 101, 61, 83, 101, 116, 85, 112, 76, 111, 99, 107, 101, 100, 80,
+114, 111, 116, 111, 116, 121, 112, 101, 59, 10, 98, 46, 80, 111, 115, 116, 78,
+97, 116, 105, 118, 101, 115, 61, 80, 111, 115, 116, 78, 97, 116, 105, 118, 101,
+115, 59, 10, 37, 84, 111, 70, 97, 115, 116, 80, 114, 111, 112, 101, 114, 116,
+105, 101, 115, 40, 98, 41, 59, 10, 37, 79, 112, 116, 105, 109, 105, 122, 101,
+79, 98, 106, 101, 99, 116, 70, 111, 114, 65, 100, 100, 105, 110, 103, 77, 117,
+108, 116, 105, 112, 108, 101, 80, 114, 111, 112, 101, 114, 116, 105, 101, 115,
+40, 99, 44, 49, 49, 41, 59, 10, 99, 46, 108, 111, 103, 83, 116, 97, 99, 107, 84,
+114, 97, 99, 101, 61, 102, 117, 110, 99, 116, 105, 111, 110, 32, 108, 111, 103,
+83, 116, 97, 99, 107, 84, 114, 97, 99, 101, 40, 41, 123, 10, 37, 68, 101, 98,
+117, 103, 84, 114, 97, 99, 101, 40, 41, 59, 10, 125, 59, 10, 99, 46, 108, 111,
+103, 61, 102, 117, 110, 99, 116, 105, 111, 110, 32, 108, 111, 103, 40, 41, 123,
+10, 108, 101, 116, 32, 109, 101, 115, 115, 97, 103, 101, 61, 39, 39, 59, 10,
+102, 111, 114, 40, 99, 111, 110, 115, 116, 32, 97, 114, 103, 32, 111, 102, 32,
+97, 114, 103, 117, 109, 101, 110, 116, 115, 41, 123, 10, 109, 101, 115, 115, 97,
+103, 101, 43, 61, 97, 114, 103, 59, 10, 125, 10, 37, 71, 108, 111, 98, 97, 108,
+80, 114, 105, 110, 116, 40, 109, 101, 115, 115, 97, 103, 101, 41, 59, 10, 125,
+59, 10, 99, 46, 99, 114, 101, 97, 116, 101, 80, 114, 105, 118, 97, 116, 101, 83,
+121, 109, 98, 111, 108, 61, 102, 117, 110, 99, 116, 105, 111, 110, 32, 99, 114,
+101, 97, 116, 101, 80, 114, 105, 118, 97, 116, 101, 83, 121, 109, 98, 111, 108,
+40, 103, 41, 123, 10, 114, 101, 116, 117, 114, 110, 32, 37, 67, 114, 101, 97,
+116, 101, 80, 114, 105, 118, 97, 116, 101, 83, 121, 109, 98, 111, 108, 40, 103,
+41, 59, 10, 125, 59, 10, 99, 46, 117, 110, 99, 117, 114, 114, 121, 84, 104, 105,
+115, 61, 102, 117, 110, 99, 116, 105, 111, 110, 32, 117, 110, 99, 117, 114, 114,
+121, 84, 104, 105, 115, 40, 115, 41, 123, 10, 114, 101, 116, 117, 114, 110, 32,
+102, 117, 110, 99, 116, 105, 111, 110, 40, 116, 104, 105, 115, 65, 114, 103, 44,
+46, 46, 46, 97, 114, 103, 115, 41, 123, 10, 114, 101, 116, 117, 114, 110, 32,
+37, 114, 101, 102, 108, 101, 99, 116, 95, 97, 112, 112, 108, 121, 40, 115, 44,
+116, 104, 105, 115, 65, 114, 103, 44, 97, 114, 103, 115, 41, 59, 10, 125, 59,
+10, 125, 59, 10, 99, 46, 109, 97, 114, 107, 80, 114, 111, 109, 105, 115, 101,
+65, 115, 72, 97, 110, 100, 108, 101, 100, 61, 102, 117, 110, 99, 116, 105, 111,
+110, 32, 109, 97, 114, 107, 80, 114, 111, 109, 105, 115, 101, 65, 115, 72, 97,
+110, 100, 108, 101, 100, 40, 118, 41, 123, 10, 37, 80, 114, 111, 109, 105, 115,
+101, 77, 97, 114, 107, 65, 115, 72, 97, 110, 100, 108, 101, 100, 40, 118, 41,
+59, 10, 125, 59, 10, 99, 46, 112, 114, 111, 109, 105, 115, 101, 83, 116, 97,
+116, 101, 61, 102, 117, 110, 99, 116, 105, 111, 110, 32, 112, 114, 111, 109,
+105, 115, 101, 83, 116, 97, 116, 101, 40, 118, 41, 123, 10, 114, 101, 116, 117,
+114, 110, 32, 37, 80, 114, 111, 109, 105, 115, 101, 83, 116, 97, 116, 117, 115,
+40, 118, 41, 59, 10, 125, 59, 10, 99, 46, 107, 80, 82, 79, 77, 73, 83, 69, 95,
+80, 69, 78, 68, 73, 78, 71, 61, 48, 59, 10, 99, 46, 107, 80, 82, 79, 77, 73, 83,
+69, 95, 70, 85, 76, 70, 73, 76, 76, 69, 68, 61, 49, 59, 10, 99, 46, 107, 80, 82,
+79, 77, 73, 83, 69, 95, 82, 69, 74, 69, 67, 84, 69, 68, 61, 50, 59, 10, 37, 84,
+111, 70, 97, 115, 116, 80, 114, 111, 112, 101, 114, 116, 105, 101, 115, 40, 99,
+41, 59, 10, 125, 41, 10, 10, 10, 40, 102, 117, 110, 99, 116, 105, 111, 110, 40,
+97, 44, 98, 44, 99, 41, 123, 10, 34, 117, 115, 101, 32, 115, 116, 114, 105, 99,
+116, 34, 59, 10, 37, 67, 104, 101, 99, 107, 73, 115, 66, 111, 111, 116, 115,
+116, 114, 97, 112, 112, 105, 110, 103, 40, 41, 59, 10, 118, 97, 114, 32, 100,
+59, 10, 118, 97, 114, 32, 101, 59, 10, 118, 97, 114, 32, 102, 61, 97, 46, 65,
+114, 114, 97, 121, 59, 10, 118, 97, 114, 32, 103, 61, 98, 46, 73, 110, 116, 101,
+114, 110, 97, 108, 65, 114, 114, 97, 121, 59, 10, 118, 97, 114, 32, 104, 61, 97,
+46, 77, 97, 116, 104, 46, 109, 97, 120, 59, 10, 118, 97, 114, 32, 105, 61, 97,
+46, 77, 97, 116, 104, 46, 109, 105, 110, 59, 10, 118, 97, 114, 32, 106, 61, 97,
+46, 79, 98, 106, 101, 99, 116, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101,
+46, 104, 97, 115, 79, 119, 110, 80, 114, 111, 112, 101, 114, 116, 121, 59, 10,
+118, 97, 114, 32, 107, 61, 97, 46, 79, 98, 106, 101, 99, 116, 46, 112, 114, 111,
+116, 111, 116, 121, 112, 101, 46, 116, 111, 83, 116, 114, 105, 110, 103, 59, 10,
+118, 97, 114, 32, 108, 61, 98, 46, 73, 109, 112, 111, 114, 116, 78, 111, 119,
+40, 34, 105, 116, 101, 114, 97, 116, 111, 114, 95, 115, 121, 109, 98, 111, 108,
+34, 41, 59, 10, 118, 97, 114, 32, 109, 61, 98, 46, 73, 109, 112, 111, 114, 116,
+78, 111, 119, 40, 34, 117, 110, 115, 99, 111, 112, 97, 98, 108, 101, 115, 95,
+115, 121, 109, 98, 111, 108, 34, 41, 59, 10, 98, 46, 73, 109, 112, 111, 114,
+116, 40, 102, 117, 110, 99, 116, 105, 111, 110, 40, 110, 41, 123, 10, 100, 61,
+110, 46, 71, 101, 116, 73, 116, 101, 114, 97, 116, 111, 114, 59, 10, 101, 61,
+110, 46, 71, 101, 116, 77, 101, 116, 104, 111, 100, 59, 10, 125, 41, 59, 10,
+102, 117, 110, 99, 116, 105, 111, 110, 32, 65, 114, 114, 97, 121, 83, 112, 101,
+99, 105, 101, 115, 67, 114, 101, 97, 116, 101, 40, 111, 44, 112, 41, 123, 10,
+112, 61, 40, 40, 112, 41, 43, 48, 41, 10, 59, 10, 118, 97, 114, 32, 113, 61, 37,
+65, 114, 114, 97, 121, 83, 112, 101, 99, 105, 101, 115, 67, 111, 110, 115, 116,
+114, 117, 99, 116, 111, 114, 40, 111, 41, 59, 10, 114, 101, 116, 117, 114, 110,
+32, 110, 101, 119, 32, 113, 40, 112, 41, 59, 10, 125, 10, 102, 117, 110, 99,
+116, 105, 111, 110, 32, 75, 101, 121, 83, 111, 114, 116, 67, 111, 109, 112, 97,
+114, 101, 40, 114, 44, 115, 41, 123, 10, 114, 101, 116, 117, 114, 110, 32, 114,
+45, 115, 59, 10, 125, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 71, 101,
+116, 83, 111, 114, 116, 101, 100, 65, 114, 114, 97, 121, 75, 101, 121, 115, 40,
+111, 44, 116, 41, 123, 10, 105, 102, 40, 40, 116, 121, 112, 101, 111, 102, 40,
+116, 41, 61, 61, 61, 39, 110, 117, 109, 98, 101, 114, 39, 41, 41, 123, 10, 118,
+97, 114, 32, 117, 61, 116, 59, 10, 118, 97, 114, 32, 118, 61, 110, 101, 119, 32,
+103, 40, 41, 59, 10, 102, 111, 114, 40, 118, 97, 114, 32, 119, 61, 48, 59, 119,
+60, 117, 59, 43, 43, 119, 41, 123, 10, 118, 97, 114, 32, 120, 61, 111, 91, 119,
+93, 59, 10, 105, 102, 40, 33, 40, 120, 61, 61, 61, 40, 118, 111, 105, 100, 32,
+48, 41, 41, 124, 124, 119, 32, 105, 110, 32, 111, 41, 123, 10, 118, 46, 112,
+117, 115, 104, 40, 119, 41, 59, 10, 125, 10, 125, 10, 114, 101, 116, 117, 114,
+110, 32, 118, 59, 10, 125, 10, 114, 101, 116, 117, 114, 110, 32, 73, 110, 110,
+101, 114, 65, 114, 114, 97, 121, 83, 111, 114, 116, 40, 116, 44, 116, 46, 108,
+101, 110, 103, 116, 104, 44, 75, 101, 121, 83, 111, 114, 116, 67, 111, 109, 112,
+97, 114, 101, 41, 59, 10, 125, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32,
+83, 112, 97, 114, 115, 101, 74, 111, 105, 110, 87, 105, 116, 104, 83, 101, 112,
+97, 114, 97, 116, 111, 114, 74, 83, 40, 111, 44, 118, 44, 112, 44, 121, 44, 122,
+41, 123, 10, 118, 97, 114, 32, 65, 61, 118, 46, 108, 101, 110, 103, 116, 104,
+59, 10, 118, 97, 114, 32, 66, 61, 110, 101, 119, 32, 103, 40, 65, 42, 50, 41,
+59, 10, 102, 111, 114, 40, 118, 97, 114, 32, 119, 61, 48, 59, 119, 60, 65, 59,
+119, 43, 43, 41, 123, 10, 118, 97, 114, 32, 67, 61, 118, 91, 119, 93, 59, 10,
+66, 91, 119, 42, 50, 93, 61, 67, 59, 10, 66, 91, 119, 42, 50, 43, 49, 93, 61,
+67, 111, 110, 118, 101, 114, 116, 84, 111, 83, 116, 114, 105, 110, 103, 40, 121,
+44, 111, 91, 67, 93, 41, 59, 10, 125, 10, 114, 101, 116, 117, 114, 110, 32, 37,
+83, 112, 97, 114, 115, 101, 74, 111, 105, 110, 87, 105, 116, 104, 83, 101, 112,
+97, 114, 97, 116, 111, 114, 40, 66, 44, 112, 44, 122, 41, 59, 10, 125, 10, 102,
+117, 110, 99, 116, 105, 111, 110, 32, 83, 112, 97, 114, 115, 101, 74, 111, 105,
+110, 40, 111, 44, 118, 44, 121, 41, 123, 10, 118, 97, 114, 32, 65, 61, 118, 46,
+108, 101, 110, 103, 116, 104, 59, 10, 118, 97, 114, 32, 66, 61, 110, 101, 119,
+32, 103, 40, 65, 41, 59, 10, 102, 111, 114, 40, 118, 97, 114, 32, 119, 61, 48,
+59, 119, 60, 65, 59, 119, 43, 43, 41, 123, 10, 66, 91, 119, 93, 61, 67, 111,
+110, 118, 101, 114, 116, 84, 111, 83, 116, 114, 105, 110, 103, 40, 121, 44, 111,
+91, 118, 91, 119, 93, 93, 41, 59, 10, 125, 10, 114, 101, 116, 117, 114, 110, 32,
+37, 83, 116, 114, 105, 110, 103, 66, 117, 105, 108, 100, 101, 114, 67, 111, 110,
+99, 97, 116, 40, 66, 44, 65, 44, 39, 39, 41, 59, 10, 125, 10, 102, 117, 110, 99,
+116, 105, 111, 110, 32, 85, 115, 101, 83, 112, 97, 114, 115, 101, 86, 97, 114,
+105, 97, 110, 116, 40, 111, 44, 112, 44, 68, 44, 69, 41, 123, 10, 105, 102, 40,
+33, 68, 124, 124, 112, 60, 49, 48, 48, 48, 124, 124, 37, 72, 97, 115, 67, 111,
+109, 112, 108, 101, 120, 69, 108, 101, 109, 101, 110, 116, 115, 40, 111, 41, 41,
+123, 10, 114, 101, 116, 117, 114, 110, 32, 102, 97, 108, 115, 101, 59, 10, 125,
+10, 105, 102, 40, 33, 37, 95, 73, 115, 83, 109, 105, 40, 112, 41, 41, 123, 10,
+114, 101, 116, 117, 114, 110, 32, 116, 114, 117, 101, 59, 10, 125, 10, 118, 97,
+114, 32, 70, 61, 112, 62, 62, 50, 59, 10, 118, 97, 114, 32, 71, 61, 37, 69, 115,
+116, 105, 109, 97, 116, 101, 78, 117, 109, 98, 101, 114, 79, 102, 69, 108, 101,
+109, 101, 110, 116, 115, 40, 111, 41, 59, 10, 114, 101, 116, 117, 114, 110, 40,
+71, 60, 70, 41, 38, 38, 10, 40, 69, 62, 71, 42, 52, 41, 59, 10, 125, 10, 102,
+117, 110, 99, 116, 105, 111, 110, 32, 83, 116, 97, 99, 107, 40, 41, 123, 10,
+116, 104, 105, 115, 46, 108, 101, 110, 103, 116, 104, 61, 48, 59, 10, 116, 104,
+105, 115, 46, 118, 97, 108, 117, 101, 115, 61, 110, 101, 119, 32, 103, 40, 41,
+59, 10, 125, 10, 83, 116, 97, 99, 107, 46, 112, 114, 111, 116, 111, 116, 121,
+112, 101, 46, 108, 101, 110, 103, 116, 104, 61, 110, 117, 108, 108, 59, 10, 83,
+116, 97, 99, 107, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 118, 97,
+108, 117, 101, 115, 61, 110, 117, 108, 108, 59, 10, 102, 117, 110, 99, 116, 105,
+111, 110, 32, 83, 116, 97, 99, 107, 80, 117, 115, 104, 40, 72, 44, 73, 41, 123,
+10, 72, 46, 118, 97, 108, 117, 101, 115, 91, 72, 46, 108, 101, 110, 103, 116,
+104, 43, 43, 93, 61, 73, 59, 10, 125, 10, 102, 117, 110, 99, 116, 105, 111, 110,
+32, 83, 116, 97, 99, 107, 80, 111, 112, 40, 72, 41, 123, 10, 72, 46, 118, 97,
+108, 117, 101, 115, 91, 45, 45, 72, 46, 108, 101, 110, 103, 116, 104, 93, 61,
+110, 117, 108, 108, 10, 125, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 83,
+116, 97, 99, 107, 72, 97, 115, 40, 72, 44, 74, 41, 123, 10, 118, 97, 114, 32,
+112, 61, 72, 46, 108, 101, 110, 103, 116, 104, 59, 10, 118, 97, 114, 32, 75, 61,
+72, 46, 118, 97, 108, 117, 101, 115, 59, 10, 102, 111, 114, 40, 118, 97, 114,
+32, 119, 61, 48, 59, 119, 60, 112, 59, 119, 43, 43, 41, 123, 10, 105, 102, 40,
+75, 91, 119, 93, 61, 61, 61, 74, 41, 114, 101, 116, 117, 114, 110, 32, 116, 114,
+117, 101, 59, 10, 125, 10, 114, 101, 116, 117, 114, 110, 32, 102, 97, 108, 115,
+101, 59, 10, 125, 10, 118, 97, 114, 32, 76, 61, 110, 101, 119, 32, 83, 116, 97,
+99, 107, 40, 41, 59, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 68, 111, 74,
+111, 105, 110, 40, 111, 44, 112, 44, 68, 44, 122, 44, 121, 41, 123, 10, 105,
+102, 40, 85, 115, 101, 83, 112, 97, 114, 115, 101, 86, 97, 114, 105, 97, 110,
+116, 40, 111, 44, 112, 44, 68, 44, 112, 41, 41, 123, 10, 37, 78, 111, 114, 109,
+97, 108, 105, 122, 101, 69, 108, 101, 109, 101, 110, 116, 115, 40, 111, 41, 59,
+10, 118, 97, 114, 32, 118, 61, 71, 101, 116, 83, 111, 114, 116, 101, 100, 65,
+114, 114, 97, 121, 75, 101, 121, 115, 40, 111, 44, 37, 71, 101, 116, 65, 114,
+114, 97, 121, 75, 101, 121, 115, 40, 111, 44, 112, 41, 41, 59, 10, 105, 102, 40,
+122, 61, 61, 61, 39, 39, 41, 123, 10, 105, 102, 40, 118, 46, 108, 101, 110, 103,
+116, 104, 61, 61, 61, 48, 41, 114, 101, 116, 117, 114, 110, 39, 39, 59, 10, 114,
+101, 116, 117, 114, 110, 32, 83, 112, 97, 114, 115, 101, 74, 111, 105, 110, 40,
+111, 44, 118, 44, 121, 41, 59, 10, 125, 101, 108, 115, 101, 123, 10, 114, 101,
+116, 117, 114, 110, 32, 83, 112, 97, 114, 115, 101, 74, 111, 105, 110, 87, 105,
+116, 104, 83, 101, 112, 97, 114, 97, 116, 111, 114, 74, 83, 40, 10, 111, 44,
+118, 44, 112, 44, 121, 44, 122, 41, 59, 10, 125, 10, 125, 10, 105, 102, 40, 112,
+61, 61, 61, 49, 41, 123, 10, 114, 101, 116, 117, 114, 110, 32, 67, 111, 110,
+118, 101, 114, 116, 84, 111, 83, 116, 114, 105, 110, 103, 40, 121, 44, 111, 91,
+48, 93, 41, 59, 10, 125, 10, 118, 97, 114, 32, 66, 61, 110, 101, 119, 32, 103,
+40, 112, 41, 59, 10, 102, 111, 114, 40, 118, 97, 114, 32, 119, 61, 48, 59, 119,
+60, 112, 59, 119, 43, 43, 41, 123, 10, 66, 91, 119, 93, 61, 67, 111, 110, 118,
+101, 114, 116, 84, 111, 83, 116, 114, 105, 110, 103, 40, 121, 44, 111, 91, 119,
+93, 41, 59, 10, 125, 10, 105, 102, 40, 122, 61, 61, 61, 39, 39, 41, 123, 10,
+114, 101, 116, 117, 114, 110, 32, 37, 83, 116, 114, 105, 110, 103, 66, 117, 105,
+108, 100, 101, 114, 67, 111, 110, 99, 97, 116, 40, 66, 44, 112, 44, 39, 39, 41,
+59, 10, 125, 101, 108, 115, 101, 123, 10, 114, 101, 116, 117, 114, 110, 32, 37,
+83, 116, 114, 105, 110, 103, 66, 117, 105, 108, 100, 101, 114, 74, 111, 105,
+110, 40, 66, 44, 112, 44, 122, 41, 59, 10, 125, 10, 125, 10, 102, 117, 110, 99,
+116, 105, 111, 110, 32, 74, 111, 105, 110, 40, 111, 44, 112, 44, 122, 44, 121,
+41, 123, 10, 105, 102, 40, 112, 61, 61, 61, 48, 41, 114, 101, 116, 117, 114,
+110, 39, 39, 59, 10, 118, 97, 114, 32, 68, 61, 40, 37, 95, 73, 115, 65, 114,
+114, 97, 121, 40, 111, 41, 41, 59, 10, 105, 102, 40, 68, 41, 123, 10, 105, 102,
+40, 83, 116, 97, 99, 107, 72, 97, 115, 40, 76, 44, 111, 41, 41, 114, 101, 116,
+117, 114, 110, 39, 39, 59, 10, 83, 116, 97, 99, 107, 80, 117, 115, 104, 40, 76,
+44, 111, 41, 59, 10, 125, 10, 116, 114, 121, 123, 10, 114, 101, 116, 117, 114,
+110, 32, 68, 111, 74, 111, 105, 110, 40, 111, 44, 112, 44, 68, 44, 122, 44, 121,
+41, 59, 10, 125, 102, 105, 110, 97, 108, 108, 121, 123, 10, 105, 102, 40, 68,
+41, 83, 116, 97, 99, 107, 80, 111, 112, 40, 76, 41, 59, 10, 125, 10, 125, 10,
+102, 117, 110, 99, 116, 105, 111, 110, 32, 67, 111, 110, 118, 101, 114, 116, 84,
+111, 83, 116, 114, 105, 110, 103, 40, 121, 44, 77, 41, 123, 10, 105, 102, 40,
+40, 77, 61, 61, 110, 117, 108, 108, 41, 41, 114, 101, 116, 117, 114, 110, 39,
+39, 59, 10, 114, 101, 116, 117, 114, 110, 40, 37, 95, 84, 111, 83, 116, 114,
+105, 110, 103, 40, 121, 63, 77, 46, 116, 111, 76, 111, 99, 97, 108, 101, 83,
+116, 114, 105, 110, 103, 40, 41, 58, 77, 41, 41, 59, 10, 125, 10, 102, 117, 110,
+99, 116, 105, 111, 110, 32, 83, 112, 97, 114, 115, 101, 83, 108, 105, 99, 101,
+40, 111, 44, 78, 44, 79, 44, 80, 44, 81, 41, 123, 10, 118, 97, 114, 32, 116, 61,
+37, 71, 101, 116, 65, 114, 114, 97, 121, 75, 101, 121, 115, 40, 111, 44, 78, 43,
+79, 41, 59, 10, 105, 102, 40, 40, 116, 121, 112, 101, 111, 102, 40, 116, 41, 61,
+61, 61, 39, 110, 117, 109, 98, 101, 114, 39, 41, 41, 123, 10, 118, 97, 114, 32,
+117, 61, 116, 59, 10, 102, 111, 114, 40, 118, 97, 114, 32, 119, 61, 78, 59, 119,
+60, 117, 59, 43, 43, 119, 41, 123, 10, 118, 97, 114, 32, 82, 61, 111, 91, 119,
+93, 59, 10, 105, 102, 40, 33, 40, 82, 61, 61, 61, 40, 118, 111, 105, 100, 32,
+48, 41, 41, 124, 124, 119, 32, 105, 110, 32, 111, 41, 123, 10, 37, 67, 114, 101,
+97, 116, 101, 68, 97, 116, 97, 80, 114, 111, 112, 101, 114, 116, 121, 40, 81,
+44, 119, 45, 78, 44, 82, 41, 59, 10, 125, 10, 125, 10, 125, 101, 108, 115, 101,
+123, 10, 118, 97, 114, 32, 112, 61, 116, 46, 108, 101, 110, 103, 116, 104, 59,
+10, 102, 111, 114, 40, 118, 97, 114, 32, 83, 61, 48, 59, 83, 60, 112, 59, 43,
+43, 83, 41, 123, 10, 118, 97, 114, 32, 67, 61, 116, 91, 83, 93, 59, 10, 105,
+102, 40, 67, 62, 61, 78, 41, 123, 10, 118, 97, 114, 32, 82, 61, 111, 91, 67, 93,
+59, 10, 105, 102, 40, 33, 40, 82, 61, 61, 61, 40, 118, 111, 105, 100, 32, 48,
+41, 41, 124, 124, 67, 32, 105, 110, 32, 111, 41, 123, 10, 37, 67, 114, 101, 97,
+116, 101, 68, 97, 116, 97, 80, 114, 111, 112, 101, 114, 116, 121, 40, 81, 44,
+67, 45, 78, 44, 82, 41, 59, 10, 125, 10, 125, 10, 125, 10, 125, 10, 125, 10,
+102, 117, 110, 99, 116, 105, 111, 110, 32, 83, 112, 97, 114, 115, 101, 77, 111,
+118, 101, 40, 111, 44, 78, 44, 79, 44, 80, 44, 84, 41, 123, 10, 105, 102, 40,
+84, 61, 61, 61, 79, 41, 114, 101, 116, 117, 114, 110, 59, 10, 118, 97, 114, 32,
+85, 61, 110, 101, 119, 32, 103, 40, 10, 105, 40, 80, 45, 79, 43, 84, 44, 48,
+120, 102, 102, 102, 102, 102, 102, 102, 102, 41, 41, 59, 10, 118, 97, 114, 32,
+86, 59, 10, 118, 97, 114, 32, 116, 61, 37, 71, 101, 116, 65, 114, 114, 97, 121,
+75, 101, 121, 115, 40, 111, 44, 80, 41, 59, 10, 105, 102, 40, 40, 116, 121, 112,
+101, 111, 102, 40, 116, 41, 61, 61, 61, 39, 110, 117, 109, 98, 101, 114, 39, 41,
+41, 123, 10, 118, 97, 114, 32, 117, 61, 116, 59, 10, 102, 111, 114, 40, 118, 97,
+114, 32, 119, 61, 48, 59, 119, 60, 78, 38, 38, 119, 60, 117, 59, 43, 43, 119,
+41, 123, 10, 118, 97, 114, 32, 82, 61, 111, 91, 119, 93, 59, 10, 105, 102, 40,
+33, 40, 82, 61, 61, 61, 40, 118, 111, 105, 100, 32, 48, 41, 41, 124, 124, 119,
+32, 105, 110, 32, 111, 41, 123, 10, 85, 91, 119, 93, 61, 82, 59, 10, 125, 10,
+125, 10, 102, 111, 114, 40, 118, 97, 114, 32, 119, 61, 78, 43, 79, 59, 119, 60,
+117, 59, 43, 43, 119, 41, 123, 10, 118, 97, 114, 32, 82, 61, 111, 91, 119, 93,
+59, 10, 105, 102, 40, 33, 40, 82, 61, 61, 61, 40, 118, 111, 105, 100, 32, 48,
+41, 41, 124, 124, 119, 32, 105, 110, 32, 111, 41, 123, 10, 85, 91, 119, 45, 79,
+43, 84, 93, 61, 82, 59, 10, 125, 10, 125, 10, 125, 101, 108, 115, 101, 123, 10,
+118, 97, 114, 32, 112, 61, 116, 46, 108, 101, 110, 103, 116, 104, 59, 10, 102,
+111, 114, 40, 118, 97, 114, 32, 83, 61, 48, 59, 83, 60, 112, 59, 43, 43, 83, 41,
+123, 10, 118, 97, 114, 32, 67, 61, 116, 91, 83, 93, 59, 10, 105, 102, 40, 67,
+60, 78, 41, 123, 10, 118, 97, 114, 32, 82, 61, 111, 91, 67, 93, 59, 10, 105,
+102, 40, 33, 40, 82, 61, 61, 61, 40, 118, 111, 105, 100, 32, 48, 41, 41, 124,
+124, 67, 32, 105, 110, 32, 111, 41, 123, 10, 85, 91, 67, 93, 61, 82, 59, 10,
+125, 10, 125, 101, 108, 115, 101, 32, 105, 102, 40, 67, 62, 61, 78, 43, 79, 41,
+123, 10, 118, 97, 114, 32, 82, 61, 111, 91, 67, 93, 59, 10, 105, 102, 40, 33,
+40, 82, 61, 61, 61, 40, 118, 111, 105, 100, 32, 48, 41, 41, 124, 124, 67, 32,
+105, 110, 32, 111, 41, 123, 10, 118, 97, 114, 32, 87, 61, 67, 45, 79, 43, 84,
+59, 10, 85, 91, 87, 93, 61, 82, 59, 10, 105, 102, 40, 87, 62, 48, 120, 102, 102,
+102, 102, 102, 102, 102, 101, 41, 123, 10, 86, 61, 86, 124, 124, 110, 101, 119,
+32, 103, 40, 41, 59, 10, 86, 46, 112, 117, 115, 104, 40, 87, 41, 59, 10, 125,
+10, 125, 10, 125, 10, 125, 10, 125, 10, 37, 77, 111, 118, 101, 65, 114, 114, 97,
+121, 67, 111, 110, 116, 101, 110, 116, 115, 40, 85, 44, 111, 41, 59, 10, 105,
+102, 40, 33, 40, 86, 61, 61, 61, 40, 118, 111, 105, 100, 32, 48, 41, 41, 41,
+123, 10, 118, 97, 114, 32, 112, 61, 86, 46, 108, 101, 110, 103, 116, 104, 59,
+10, 102, 111, 114, 40, 118, 97, 114, 32, 119, 61, 48, 59, 119, 60, 112, 59, 43,
+43, 119, 41, 123, 10, 118, 97, 114, 32, 67, 61, 86, 91, 119, 93, 59, 10, 111,
+91, 67, 93, 61, 85, 91, 67, 93, 59, 10, 125, 10, 125, 10, 125, 10, 102, 117,
+110, 99, 116, 105, 111, 110, 32, 83, 105, 109, 112, 108, 101, 83, 108, 105, 99,
+101, 40, 111, 44, 78, 44, 79, 44, 80, 44, 81, 41, 123, 10, 102, 111, 114, 40,
+118, 97, 114, 32, 119, 61, 48, 59, 119, 60, 79, 59, 119, 43, 43, 41, 123, 10,
+118, 97, 114, 32, 88, 61, 78, 43, 119, 59, 10, 105, 102, 40, 88, 32, 105, 110,
+32, 111, 41, 123, 10, 118, 97, 114, 32, 82, 61, 111, 91, 88, 93, 59, 10, 37, 67,
+114, 101, 97, 116, 101, 68, 97, 116, 97, 80, 114, 111, 112, 101, 114, 116, 121,
+40, 81, 44, 119, 44, 82, 41, 59, 10, 125, 10, 125, 10, 125, 10, 102, 117, 110,
+99, 116, 105, 111, 110, 32, 83, 105, 109, 112, 108, 101, 77, 111, 118, 101, 40,
+111, 44, 78, 44, 79, 44, 80, 44, 84, 41, 123, 10, 105, 102, 40, 84, 33, 61, 61,
+79, 41, 123, 10, 105, 102, 40, 84, 62, 79, 41, 123, 10, 102, 111, 114, 40, 118,
+97, 114, 32, 119, 61, 80, 45, 79, 59, 119, 62, 78, 59, 119, 45, 45, 41, 123, 10,
+118, 97, 114, 32, 89, 61, 119, 43, 79, 45, 49, 59, 10, 118, 97, 114, 32, 90, 61,
+119, 43, 84, 45, 49, 59, 10, 105, 102, 40, 89, 32, 105, 110, 32, 111, 41, 123,
+10, 111, 91, 90, 93, 61, 111, 91, 89, 93, 59, 10, 125, 101, 108, 115, 101, 123,
+10, 100, 101, 108, 101, 116, 101, 32, 111, 91, 90, 93, 59, 10, 125, 10, 125, 10,
+125, 101, 108, 115, 101, 123, 10, 102, 111, 114, 40, 118, 97, 114, 32, 119, 61,
+78, 59, 119, 60, 80, 45, 79, 59, 119, 43, 43, 41, 123, 10, 118, 97, 114, 32, 89,
+61, 119, 43, 79, 59, 10, 118, 97, 114, 32, 90, 61, 119, 43, 84, 59, 10, 105,
+102, 40, 89, 32, 105, 110, 32, 111, 41, 123, 10, 111, 91, 90, 93, 61, 111, 91,
+89, 93, 59, 10, 125, 101, 108, 115, 101, 123, 10, 100, 101, 108, 101, 116, 101,
+32, 111, 91, 90, 93, 59, 10, 125, 10, 125, 10, 102, 111, 114, 40, 118, 97, 114,
+32, 119, 61, 80, 59, 119, 62, 80, 45, 79, 43, 84, 59, 119, 45, 45, 41, 123, 10,
+100, 101, 108, 101, 116, 101, 32, 111, 91, 119, 45, 49, 93, 59, 10, 125, 10,
+125, 10, 125, 10, 125, 10, 118, 97, 114, 32, 97, 97, 59, 10, 37, 68, 101, 102,
+105, 110, 101, 77, 101, 116, 104, 111, 100, 115, 73, 110, 116, 101, 114, 110,
+97, 108, 40, 102, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 44, 99, 108,
+97, 115, 115, 123, 116, 111, 83, 116, 114, 105, 110, 103, 40, 41, 123, 10, 118,
+97, 114, 32, 111, 59, 10, 118, 97, 114, 32, 97, 98, 59, 10, 105, 102, 40, 40,
+37, 95, 73, 115, 65, 114, 114, 97, 121, 40, 116, 104, 105, 115, 41, 41, 41, 123,
+10, 97, 98, 61, 116, 104, 105, 115, 46, 106, 111, 105, 110, 59, 10, 105, 102,
+40, 97, 98, 61, 61, 61, 97, 97, 41, 123, 10, 114, 101, 116, 117, 114, 110, 32,
+74, 111, 105, 110, 40, 116, 104, 105, 115, 44, 116, 104, 105, 115, 46, 108, 101,
+110, 103, 116, 104, 44, 39, 44, 39, 44, 102, 97, 108, 115, 101, 41, 59, 10, 125,
+10, 111, 61, 116, 104, 105, 115, 59, 10, 125, 101, 108, 115, 101, 123, 10, 111,
+61, 40, 37, 95, 84, 111, 79, 98, 106, 101, 99, 116, 40, 116, 104, 105, 115, 41,
+41, 59, 10, 97, 98, 61, 111, 46, 106, 111, 105, 110, 59, 10, 125, 10, 105, 102,
+40, 33, 40, 116, 121, 112, 101, 111, 102, 40, 97, 98, 41, 61, 61, 61, 39, 102,
+117, 110, 99, 116, 105, 111, 110, 39, 41, 41, 123, 10, 114, 101, 116, 117, 114,
+110, 32, 37, 95, 67, 97, 108, 108, 40, 107, 44, 111, 41, 59, 10, 125, 10, 114,
+101, 116, 117, 114, 110, 32, 37, 95, 67, 97, 108, 108, 40, 97, 98, 44, 111, 41,
+59, 10, 125, 125, 44, 45, 49, 41, 59, 10, 102, 117, 110, 99, 116, 105, 111, 110,
+32, 73, 110, 110, 101, 114, 65, 114, 114, 97, 121, 84, 111, 76, 111, 99, 97,
+108, 101, 83, 116, 114, 105, 110, 103, 40, 111, 44, 112, 41, 123, 10, 114, 101,
+116, 117, 114, 110, 32, 74, 111, 105, 110, 40, 111, 44, 40, 37, 95, 84, 111, 76,
+101, 110, 103, 116, 104, 40, 112, 41, 41, 44, 39, 44, 39, 44, 116, 114, 117,
+101, 41, 59, 10, 125, 10, 37, 68, 101, 102, 105, 110, 101, 77, 101, 116, 104,
+111, 100, 115, 73, 110, 116, 101, 114, 110, 97, 108, 40, 102, 46, 112, 114, 111,
+116, 111, 116, 121, 112, 101, 44, 99, 108, 97, 115, 115, 123, 116, 111, 76, 111,
+99, 97, 108, 101, 83, 116, 114, 105, 110, 103, 40, 41, 123, 10, 118, 97, 114,
+32, 111, 61, 40, 37, 95, 84, 111, 79, 98, 106, 101, 99, 116, 40, 116, 104, 105,
+115, 41, 41, 59, 10, 118, 97, 114, 32, 97, 99, 61, 111, 46, 108, 101, 110, 103,
+116, 104, 59, 10, 114, 101, 116, 117, 114, 110, 32, 73, 110, 110, 101, 114, 65,
+114, 114, 97, 121, 84, 111, 76, 111, 99, 97, 108, 101, 83, 116, 114, 105, 110,
+103, 40, 111, 44, 97, 99, 41, 59, 10, 125, 125, 44, 45, 49, 41, 59, 10, 102,
+117, 110, 99, 116, 105, 111, 110, 32, 73, 110, 110, 101, 114, 65, 114, 114, 97,
+121, 74, 111, 105, 110, 40, 122, 44, 111, 44, 112, 41, 123, 10, 105, 102, 40,
+40, 122, 61, 61, 61, 40, 118, 111, 105, 100, 32, 48, 41, 41, 41, 123, 10, 122,
+61, 39, 44, 39, 59, 10, 125, 101, 108, 115, 101, 123, 10, 122, 61, 40, 37, 95,
+84, 111, 83, 116, 114, 105, 110, 103, 40, 122, 41, 41, 59, 10, 125, 10, 105,
+102, 40, 112, 61, 61, 61, 49, 41, 123, 10, 118, 97, 114, 32, 120, 61, 111, 91,
+48, 93, 59, 10, 105, 102, 40, 40, 120, 61, 61, 110, 117, 108, 108, 41, 41, 114,
+101, 116, 117, 114, 110, 39, 39, 59, 10, 114, 101, 116, 117, 114, 110, 40, 37,
+95, 84, 111, 83, 116, 114, 105, 110, 103, 40, 120, 41, 41, 59, 10, 125, 10, 114,
+101, 116, 117, 114, 110, 32, 74, 111, 105, 110, 40, 111, 44, 112, 44, 122, 44,
+102, 97, 108, 115, 101, 41, 59, 10, 125, 10, 37, 68, 101, 102, 105, 110, 101,
+77, 101, 116, 104, 111, 100, 115, 73, 110, 116, 101, 114, 110, 97, 108, 40, 102,
+46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 44, 99, 108, 97, 115, 115, 123,
+106, 111, 105, 110, 40, 122, 41, 123, 10, 118, 97, 114, 32, 111, 61, 40, 37, 95,
+84, 111, 79, 98, 106, 101, 99, 116, 40, 116, 104, 105, 115, 41, 41, 59, 10, 118,
+97, 114, 32, 112, 61, 40, 37, 95, 84, 111, 76, 101, 110, 103, 116, 104, 40, 111,
+46, 108, 101, 110, 103, 116, 104, 41, 41, 59, 10, 114, 101, 116, 117, 114, 110,
+32, 73, 110, 110, 101, 114, 65, 114, 114, 97, 121, 74, 111, 105, 110, 40, 122,
+44, 111, 44, 112, 41, 59, 10, 125, 125, 44, 45, 49, 41, 59, 10, 102, 117, 110,
+99, 116, 105, 111, 110, 32, 65, 114, 114, 97, 121, 80, 111, 112, 70, 97, 108,
+108, 98, 97, 99, 107, 40, 41, 123, 10, 118, 97, 114, 32, 111, 61, 40, 37, 95,
+84, 111, 79, 98, 106, 101, 99, 116, 40, 116, 104, 105, 115, 41, 41, 59, 10, 118,
+97, 114, 32, 97, 100, 61, 40, 37, 95, 84, 111, 76, 101, 110, 103, 116, 104, 40,
+111, 46, 108, 101, 110, 103, 116, 104, 41, 41, 59, 10, 105, 102, 40, 97, 100,
+61, 61, 48, 41, 123, 10, 111, 46, 108, 101, 110, 103, 116, 104, 61, 97, 100, 59,
+10, 114, 101, 116, 117, 114, 110, 59, 10, 125, 10, 97, 100, 45, 45, 59, 10, 118,
+97, 114, 32, 73, 61, 111, 91, 97, 100, 93, 59, 10, 100, 101, 108, 101, 116, 101,
+32, 111, 91, 97, 100, 93, 59, 10, 111, 46, 108, 101, 110, 103, 116, 104, 61, 97,
+100, 59, 10, 114, 101, 116, 117, 114, 110, 32, 73, 59, 10, 125, 10, 102, 117,
+110, 99, 116, 105, 111, 110, 32, 65, 114, 114, 97, 121, 80, 117, 115, 104, 70,
+97, 108, 108, 98, 97, 99, 107, 40, 41, 123, 10, 118, 97, 114, 32, 111, 61, 40,
+37, 95, 84, 111, 79, 98, 106, 101, 99, 116, 40, 116, 104, 105, 115, 41, 41, 59,
+10, 118, 97, 114, 32, 97, 100, 61, 40, 37, 95, 84, 111, 76, 101, 110, 103, 116,
+104, 40, 111, 46, 108, 101, 110, 103, 116, 104, 41, 41, 59, 10, 118, 97, 114,
+32, 97, 101, 61, 97, 114, 103, 117, 109, 101, 110, 116, 115, 46, 108, 101, 110,
+103, 116, 104, 59, 10, 105, 102, 40, 97, 101, 62, 57, 48, 48, 55, 49, 57, 57,
+50, 53, 52, 55, 52, 48, 57, 57, 49, 45, 97, 100, 41, 116, 104, 114, 111, 119,
+32, 37, 109, 97, 107, 101, 95, 116, 121, 112, 101, 95, 101, 114, 114, 111, 114,
+40, 50, 53, 54, 44, 97, 101, 44, 97, 100, 41, 59, 10, 102, 111, 114, 40, 118,
+97, 114, 32, 119, 61, 48, 59, 119, 60, 97, 101, 59, 119, 43, 43, 41, 123, 10,
+111, 91, 119, 43, 97, 100, 93, 61, 97, 114, 103, 117, 109, 101, 110, 116, 115,
+91, 119, 93, 59, 10, 125, 10, 118, 97, 114, 32, 97, 102, 61, 97, 100, 43, 97,
+101, 59, 10, 111, 46, 108, 101, 110, 103, 116, 104, 61, 97, 102, 59, 10, 114,
+101, 116, 117, 114, 110, 32, 97, 102, 59, 10, 125, 10, 102, 117, 110, 99, 116,
+105, 111, 110, 32, 83, 112, 97, 114, 115, 101, 82, 101, 118, 101, 114, 115, 101,
+40, 111, 44, 80, 41, 123, 10, 118, 97, 114, 32, 118, 61, 71, 101, 116, 83, 111,
+114, 116, 101, 100, 65, 114, 114, 97, 121, 75, 101, 121, 115, 40, 111, 44, 37,
+71, 101, 116, 65, 114, 114, 97, 121, 75, 101, 121, 115, 40, 111, 44, 80, 41, 41,
+59, 10, 118, 97, 114, 32, 97, 103, 61, 118, 46, 108, 101, 110, 103, 116, 104,
+45, 49, 59, 10, 118, 97, 114, 32, 97, 104, 61, 48, 59, 10, 119, 104, 105, 108,
+101, 40, 97, 104, 60, 61, 97, 103, 41, 123, 10, 118, 97, 114, 32, 119, 61, 118,
+91, 97, 104, 93, 59, 10, 118, 97, 114, 32, 97, 105, 61, 118, 91, 97, 103, 93,
+59, 10, 118, 97, 114, 32, 97, 106, 61, 80, 45, 97, 105, 45, 49, 59, 10, 118, 97,
+114, 32, 97, 107, 44, 97, 108, 59, 10, 105, 102, 40, 97, 106, 60, 61, 119, 41,
+123, 10, 97, 108, 61, 97, 105, 59, 10, 119, 104, 105, 108, 101, 40, 118, 91, 45,
+45, 97, 103, 93, 61, 61, 97, 105, 41, 123, 125, 10, 97, 107, 61, 97, 106, 59,
+10, 125, 10, 105, 102, 40, 97, 106, 62, 61, 119, 41, 123, 10, 97, 107, 61, 119,
+59, 10, 119, 104, 105, 108, 101, 40, 118, 91, 43, 43, 97, 104, 93, 61, 61, 119,
+41, 123, 125, 10, 97, 108, 61, 80, 45, 119, 45, 49, 59, 10, 125, 10, 118, 97,
+114, 32, 97, 109, 61, 111, 91, 97, 107, 93, 59, 10, 105, 102, 40, 33, 40, 97,
+109, 61, 61, 61, 40, 118, 111, 105, 100, 32, 48, 41, 41, 124, 124, 97, 107, 32,
+105, 110, 32, 111, 41, 123, 10, 118, 97, 114, 32, 97, 110, 61, 111, 91, 97, 108,
+93, 59, 10, 105, 102, 40, 33, 40, 97, 110, 61, 61, 61, 40, 118, 111, 105, 100,
+32, 48, 41, 41, 124, 124, 97, 108, 32, 105, 110, 32, 111, 41, 123, 10, 111, 91,
+97, 107, 93, 61, 97, 110, 59, 10, 111, 91, 97, 108, 93, 61, 97, 109, 59, 10,
+125, 101, 108, 115, 101, 123, 10, 111, 91, 97, 108, 93, 61, 97, 109, 59, 10,
+100, 101, 108, 101, 116, 101, 32, 111, 91, 97, 107, 93, 59, 10, 125, 10, 125,
+101, 108, 115, 101, 123, 10, 118, 97, 114, 32, 97, 110, 61, 111, 91, 97, 108,
+93, 59, 10, 105, 102, 40, 33, 40, 97, 110, 61, 61, 61, 40, 118, 111, 105, 100,
+32, 48, 41, 41, 124, 124, 97, 108, 32, 105, 110, 32, 111, 41, 123, 10, 111, 91,
+97, 107, 93, 61, 97, 110, 59, 10, 100, 101, 108, 101, 116, 101, 32, 111, 91, 97,
+108, 93, 59, 10, 125, 10, 125, 10, 125, 10, 125, 10, 102, 117, 110, 99, 116,
+105, 111, 110, 32, 80, 97, 99, 107, 101, 100, 65, 114, 114, 97, 121, 82, 101,
+118, 101, 114, 115, 101, 40, 111, 44, 80, 41, 123, 10, 118, 97, 114, 32, 97,
+105, 61, 80, 45, 49, 59, 10, 102, 111, 114, 40, 118, 97, 114, 32, 119, 61, 48,
+59, 119, 60, 97, 105, 59, 119, 43, 43, 44, 97, 105, 45, 45, 41, 123, 10, 118,
+97, 114, 32, 97, 109, 61, 111, 91, 119, 93, 59, 10, 118, 97, 114, 32, 97, 110,
+61, 111, 91, 97, 105, 93, 59, 10, 111, 91, 119, 93, 61, 97, 110, 59, 10, 111,
+91, 97, 105, 93, 61, 97, 109, 59, 10, 125, 10, 114, 101, 116, 117, 114, 110, 32,
+111, 59, 10, 125, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 71, 101, 110,
+101, 114, 105, 99, 65, 114, 114, 97, 121, 82, 101, 118, 101, 114, 115, 101, 40,
+111, 44, 80, 41, 123, 10, 118, 97, 114, 32, 97, 105, 61, 80, 45, 49, 59, 10,
+102, 111, 114, 40, 118, 97, 114, 32, 119, 61, 48, 59, 119, 60, 97, 105, 59, 119,
+43, 43, 44, 97, 105, 45, 45, 41, 123, 10, 105, 102, 40, 119, 32, 105, 110, 32,
+111, 41, 123, 10, 118, 97, 114, 32, 97, 109, 61, 111, 91, 119, 93, 59, 10, 105,
+102, 40, 97, 105, 32, 105, 110, 32, 111, 41, 123, 10, 118, 97, 114, 32, 97, 110,
+61, 111, 91, 97, 105, 93, 59, 10, 111, 91, 119, 93, 61, 97, 110, 59, 10, 111,
+91, 97, 105, 93, 61, 97, 109, 59, 10, 125, 101, 108, 115, 101, 123, 10, 111, 91,
+97, 105, 93, 61, 97, 109, 59, 10, 100, 101, 108, 101, 116, 101, 32, 111, 91,
+119, 93, 59, 10, 125, 10, 125, 101, 108, 115, 101, 123, 10, 105, 102, 40, 97,
+105, 32, 105, 110, 32, 111, 41, 123, 10, 118, 97, 114, 32, 97, 110, 61, 111, 91,
+97, 105, 93, 59, 10, 111, 91, 119, 93, 61, 97, 110, 59, 10, 100, 101, 108, 101,
+116, 101, 32, 111, 91, 97, 105, 93, 59, 10, 125, 10, 125, 10, 125, 10, 114, 101,
+116, 117, 114, 110, 32, 111, 59, 10, 125, 10, 37, 68, 101, 102, 105, 110, 101,
+77, 101, 116, 104, 111, 100, 115, 73, 110, 116, 101, 114, 110, 97, 108, 40, 102,
+46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 44, 99, 108, 97, 115, 115, 123,
+114, 101, 118, 101, 114, 115, 101, 40, 41, 123, 10, 118, 97, 114, 32, 111, 61,
+40, 37, 95, 84, 111, 79, 98, 106, 101, 99, 116, 40, 116, 104, 105, 115, 41, 41,
+59, 10, 118, 97, 114, 32, 80, 61, 40, 37, 95, 84, 111, 76, 101, 110, 103, 116,
+104, 40, 111, 46, 108, 101, 110, 103, 116, 104, 41, 41, 59, 10, 118, 97, 114,
+32, 97, 111, 61, 40, 37, 95, 73, 115, 65, 114, 114, 97, 121, 40, 111, 41, 41,
+59, 10, 105, 102, 40, 85, 115, 101, 83, 112, 97, 114, 115, 101, 86, 97, 114,
+105, 97, 110, 116, 40, 111, 44, 80, 44, 97, 111, 44, 80, 41, 41, 123, 10, 37,
+78, 111, 114, 109, 97, 108, 105, 122, 101, 69, 108, 101, 109, 101, 110, 116,
+115, 40, 111, 41, 59, 10, 83, 112, 97, 114, 115, 101, 82, 101, 118, 101, 114,
+115, 101, 40, 111, 44, 80, 41, 59, 10, 114, 101, 116, 117, 114, 110, 32, 111,
+59, 10, 125, 101, 108, 115, 101, 32, 105, 102, 40, 97, 111, 38, 38, 37, 95, 72,
+97, 115, 70, 97, 115, 116, 80, 97, 99, 107, 101, 100, 69, 108, 101, 109, 101,
+110, 116, 115, 40, 111, 41, 41, 123, 10, 114, 101, 116, 117, 114, 110, 32, 80,
+97, 99, 107, 101, 100, 65, 114, 114, 97, 121, 82, 101, 118, 101, 114, 115, 101,
+40, 111, 44, 80, 41, 59, 10, 125, 101, 108, 115, 101, 123, 10, 114, 101, 116,
+117, 114, 110, 32, 71, 101, 110, 101, 114, 105, 99, 65, 114, 114, 97, 121, 82,
+101, 118, 101, 114, 115, 101, 40, 111, 44, 80, 41, 59, 10, 125, 10, 125, 125,
+44, 45, 49, 41, 59, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 65, 114, 114,
+97, 121, 83, 104, 105, 102, 116, 70, 97, 108, 108, 98, 97, 99, 107, 40, 41, 123,
+10, 118, 97, 114, 32, 111, 61, 40, 37, 95, 84, 111, 79, 98, 106, 101, 99, 116,
+40, 116, 104, 105, 115, 41, 41, 59, 10, 118, 97, 114, 32, 80, 61, 40, 37, 95,
+84, 111, 76, 101, 110, 103, 116, 104, 40, 111, 46, 108, 101, 110, 103, 116, 104,
+41, 41, 59, 10, 105, 102, 40, 80, 61, 61, 61, 48, 41, 123, 10, 111, 46, 108,
+101, 110, 103, 116, 104, 61, 48, 59, 10, 114, 101, 116, 117, 114, 110, 59, 10,
+125, 10, 105, 102, 40, 37, 111, 98, 106, 101, 99, 116, 95, 105, 115, 95, 115,
+101, 97, 108, 101, 100, 40, 111, 41, 41, 116, 104, 114, 111, 119, 32, 37, 109,
+97, 107, 101, 95, 116, 121, 112, 101, 95, 101, 114, 114, 111, 114, 40, 49, 53,
+41, 59, 10, 118, 97, 114, 32, 97, 112, 61, 111, 91, 48, 93, 59, 10, 105, 102,
+40, 85, 115, 101, 83, 112, 97, 114, 115, 101, 86, 97, 114, 105, 97, 110, 116,
+40, 111, 44, 80, 44, 40, 37, 95, 73, 115, 65, 114, 114, 97, 121, 40, 111, 41,
+41, 44, 80, 41, 41, 123, 10, 83, 112, 97, 114, 115, 101, 77, 111, 118, 101, 40,
+111, 44, 48, 44, 49, 44, 80, 44, 48, 41, 59, 10, 125, 101, 108, 115, 101, 123,
+10, 83, 105, 109, 112, 108, 101, 77, 111, 118, 101, 40, 111, 44, 48, 44, 49, 44,
+80, 44, 48, 41, 59, 10, 125, 10, 111, 46, 108, 101, 110, 103, 116, 104, 61, 80,
+45, 49, 59, 10, 114, 101, 116, 117, 114, 110, 32, 97, 112, 59, 10, 125, 10, 102,
+117, 110, 99, 116, 105, 111, 110, 32, 65, 114, 114, 97, 121, 85, 110, 115, 104,
+105, 102, 116, 70, 97, 108, 108, 98, 97, 99, 107, 40, 97, 113, 41, 123, 10, 118,
+97, 114, 32, 111, 61, 40, 37, 95, 84, 111, 79, 98, 106, 101, 99, 116, 40, 116,
+104, 105, 115, 41, 41, 59, 10, 118, 97, 114, 32, 80, 61, 40, 37, 95, 84, 111,
+76, 101, 110, 103, 116, 104, 40, 111, 46, 108, 101, 110, 103, 116, 104, 41, 41,
+59, 10, 118, 97, 114, 32, 97, 114, 61, 97, 114, 103, 117, 109, 101, 110, 116,
+115, 46, 108, 101, 110, 103, 116, 104, 59, 10, 105, 102, 40, 80, 62, 48, 38, 38,
+85, 115, 101, 83, 112, 97, 114, 115, 101, 86, 97, 114, 105, 97, 110, 116, 40,
+111, 44, 80, 44, 40, 37, 95, 73, 115, 65, 114, 114, 97, 121, 40, 111, 41, 41,
+44, 80, 41, 38, 38, 10, 33, 37, 111, 98, 106, 101, 99, 116, 95, 105, 115, 95,
+115, 101, 97, 108, 101, 100, 40, 111, 41, 41, 123, 10, 83, 112, 97, 114, 115,
+101, 77, 111, 118, 101, 40, 111, 44, 48, 44, 48, 44, 80, 44, 97, 114, 41, 59,
+10, 125, 101, 108, 115, 101, 123, 10, 83, 105, 109, 112, 108, 101, 77, 111, 118,
+101, 40, 111, 44, 48, 44, 48, 44, 80, 44, 97, 114, 41, 59, 10, 125, 10, 102,
+111, 114, 40, 118, 97, 114, 32, 119, 61, 48, 59, 119, 60, 97, 114, 59, 119, 43,
+43, 41, 123, 10, 111, 91, 119, 93, 61, 97, 114, 103, 117, 109, 101, 110, 116,
+115, 91, 119, 93, 59, 10, 125, 10, 118, 97, 114, 32, 97, 102, 61, 80, 43, 97,
+114, 59, 10, 111, 46, 108, 101, 110, 103, 116, 104, 61, 97, 102, 59, 10, 114,
+101, 116, 117, 114, 110, 32, 97, 102, 59, 10, 125, 10, 102, 117, 110, 99, 116,
+105, 111, 110, 32, 65, 114, 114, 97, 121, 83, 108, 105, 99, 101, 70, 97, 108,
+108, 98, 97, 99, 107, 40, 97, 115, 44, 97, 116, 41, 123, 10, 118, 97, 114, 32,
+111, 61, 40, 37, 95, 84, 111, 79, 98, 106, 101, 99, 116, 40, 116, 104, 105, 115,
+41, 41, 59, 10, 118, 97, 114, 32, 80, 61, 40, 37, 95, 84, 111, 76, 101, 110,
+103, 116, 104, 40, 111, 46, 108, 101, 110, 103, 116, 104, 41, 41, 59, 10, 118,
+97, 114, 32, 78, 61, 40, 37, 95, 84, 111, 73, 110, 116, 101, 103, 101, 114, 40,
+97, 115, 41, 41, 59, 10, 118, 97, 114, 32, 97, 117, 61, 80, 59, 10, 105, 102,
+40, 33, 40, 97, 116, 61, 61, 61, 40, 118, 111, 105, 100, 32, 48, 41, 41, 41, 97,
+117, 61, 40, 37, 95, 84, 111, 73, 110, 116, 101, 103, 101, 114, 40, 97, 116, 41,
+41, 59, 10, 105, 102, 40, 78, 60, 48, 41, 123, 10, 78, 43, 61, 80, 59, 10, 105,
+102, 40, 78, 60, 48, 41, 78, 61, 48, 59, 10, 125, 101, 108, 115, 101, 123, 10,
+105, 102, 40, 78, 62, 80, 41, 78, 61, 80, 59, 10, 125, 10, 105, 102, 40, 97,
+117, 60, 48, 41, 123, 10, 97, 117, 43, 61, 80, 59, 10, 105, 102, 40, 97, 117,
+60, 48, 41, 97, 117, 61, 48, 59, 10, 125, 101, 108, 115, 101, 123, 10, 105, 102,
+40, 97, 117, 62, 80, 41, 97, 117, 61, 80, 59, 10, 125, 10, 118, 97, 114, 32, 97,
+118, 61, 65, 114, 114, 97, 121, 83, 112, 101, 99, 105, 101, 115, 67, 114, 101,
+97, 116, 101, 40, 111, 44, 104, 40, 97, 117, 45, 78, 44, 48, 41, 41, 59, 10,
+105, 102, 40, 97, 117, 60, 78, 41, 114, 101, 116, 117, 114, 110, 32, 97, 118,
+59, 10, 105, 102, 40, 85, 115, 101, 83, 112, 97, 114, 115, 101, 86, 97, 114,
+105, 97, 110, 116, 40, 111, 44, 80, 44, 40, 37, 95, 73, 115, 65, 114, 114, 97,
+121, 40, 111, 41, 41, 44, 97, 117, 45, 78, 41, 41, 123, 10, 37, 78, 111, 114,
+109, 97, 108, 105, 122, 101, 69, 108, 101, 109, 101, 110, 116, 115, 40, 111, 41,
+59, 10, 105, 102, 40, 40, 37, 95, 73, 115, 65, 114, 114, 97, 121, 40, 97, 118,
+41, 41, 41, 37, 78, 111, 114, 109, 97, 108, 105, 122, 101, 69, 108, 101, 109,
+101, 110, 116, 115, 40, 97, 118, 41, 59, 10, 83, 112, 97, 114, 115, 101, 83,
+108, 105, 99, 101, 40, 111, 44, 78, 44, 97, 117, 45, 78, 44, 80, 44, 97, 118,
+41, 59, 10, 125, 101, 108, 115, 101, 123, 10, 83, 105, 109, 112, 108, 101, 83,
+108, 105, 99, 101, 40, 111, 44, 78, 44, 97, 117, 45, 78, 44, 80, 44, 97, 118,
+41, 59, 10, 125, 10, 97, 118, 46, 108, 101, 110, 103, 116, 104, 61, 97, 117, 45,
+78, 59, 10, 114, 101, 116, 117, 114, 110, 32, 97, 118, 59, 10, 125, 10, 102,
+117, 110, 99, 116, 105, 111, 110, 32, 67, 111, 109, 112, 117, 116, 101, 83, 112,
+108, 105, 99, 101, 83, 116, 97, 114, 116, 73, 110, 100, 101, 120, 40, 78, 44,
+80, 41, 123, 10, 105, 102, 40, 78, 60, 48, 41, 123, 10, 78, 43, 61, 80, 59, 10,
+114, 101, 116, 117, 114, 110, 32, 78, 60, 48, 63, 48, 58, 78, 59, 10, 125, 10,
+114, 101, 116, 117, 114, 110, 32, 78, 62, 80, 63, 80, 58, 78, 59, 10, 125, 10,
+102, 117, 110, 99, 116, 105, 111, 110, 32, 67, 111, 109, 112, 117, 116, 101, 83,
+112, 108, 105, 99, 101, 68, 101, 108, 101, 116, 101, 67, 111, 117, 110, 116, 40,
+97, 119, 44, 97, 114, 44, 80, 44, 78, 41, 123, 10, 118, 97, 114, 32, 79, 61, 48,
+59, 10, 105, 102, 40, 97, 114, 61, 61, 49, 41, 10, 114, 101, 116, 117, 114, 110,
+32, 80, 45, 78, 59, 10, 79, 61, 40, 37, 95, 84, 111, 73, 110, 116, 101, 103,
+101, 114, 40, 97, 119, 41, 41, 59, 10, 105, 102, 40, 79, 60, 48, 41, 10, 114,
+101, 116, 117, 114, 110, 32, 48, 59, 10, 105, 102, 40, 79, 62, 80, 45, 78, 41,
+10, 114, 101, 116, 117, 114, 110, 32, 80, 45, 78, 59, 10, 114, 101, 116, 117,
+114, 110, 32, 79, 59, 10, 125, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32,
+65, 114, 114, 97, 121, 83, 112, 108, 105, 99, 101, 70, 97, 108, 108, 98, 97, 99,
+107, 40, 97, 115, 44, 97, 119, 41, 123, 10, 118, 97, 114, 32, 97, 114, 61, 97,
+114, 103, 117, 109, 101, 110, 116, 115, 46, 108, 101, 110, 103, 116, 104, 59,
+10, 118, 97, 114, 32, 111, 61, 40, 37, 95, 84, 111, 79, 98, 106, 101, 99, 116,
+40, 116, 104, 105, 115, 41, 41, 59, 10, 118, 97, 114, 32, 80, 61, 40, 37, 95,
+84, 111, 76, 101, 110, 103, 116, 104, 40, 111, 46, 108, 101, 110, 103, 116, 104,
+41, 41, 59, 10, 118, 97, 114, 32, 78, 61, 67, 111, 109, 112, 117, 116, 101, 83,
+112, 108, 105, 99, 101, 83, 116, 97, 114, 116, 73, 110, 100, 101, 120, 40, 40,
+37, 95, 84, 111, 73, 110, 116, 101, 103, 101, 114, 40, 97, 115, 41, 41, 44, 80,
+41, 59, 10, 118, 97, 114, 32, 79, 61, 67, 111, 109, 112, 117, 116, 101, 83, 112,
+108, 105, 99, 101, 68, 101, 108, 101, 116, 101, 67, 111, 117, 110, 116, 40, 97,
+119, 44, 97, 114, 44, 80, 44, 10, 78, 41, 59, 10, 118, 97, 114, 32, 81, 61, 65,
+114, 114, 97, 121, 83, 112, 101, 99, 105, 101, 115, 67, 114, 101, 97, 116, 101,
+40, 111, 44, 79, 41, 59, 10, 81, 46, 108, 101, 110, 103, 116, 104, 61, 79, 59,
+10, 118, 97, 114, 32, 97, 120, 61, 97, 114, 62, 50, 63, 97, 114, 45, 50, 58, 48,
+59, 10, 105, 102, 40, 79, 33, 61, 97, 120, 38, 38, 37, 111, 98, 106, 101, 99,
+116, 95, 105, 115, 95, 115, 101, 97, 108, 101, 100, 40, 111, 41, 41, 123, 10,
+116, 104, 114, 111, 119, 32, 37, 109, 97, 107, 101, 95, 116, 121, 112, 101, 95,
+101, 114, 114, 111, 114, 40, 49, 53, 41, 59, 10, 125, 101, 108, 115, 101, 32,
+105, 102, 40, 79, 62, 48, 38, 38, 37, 111, 98, 106, 101, 99, 116, 95, 105, 115,
+95, 102, 114, 111, 122, 101, 110, 40, 111, 41, 41, 123, 10, 116, 104, 114, 111,
+119, 32, 37, 109, 97, 107, 101, 95, 116, 121, 112, 101, 95, 101, 114, 114, 111,
+114, 40, 49, 52, 41, 59, 10, 125, 10, 118, 97, 114, 32, 97, 121, 61, 79, 59, 10,
+105, 102, 40, 97, 120, 33, 61, 79, 41, 123, 10, 97, 121, 43, 61, 80, 45, 78, 45,
+79, 59, 10, 125, 10, 105, 102, 40, 85, 115, 101, 83, 112, 97, 114, 115, 101, 86,
+97, 114, 105, 97, 110, 116, 40, 111, 44, 80, 44, 40, 37, 95, 73, 115, 65, 114,
+114, 97, 121, 40, 111, 41, 41, 44, 97, 121, 41, 41, 123, 10, 37, 78, 111, 114,
+109, 97, 108, 105, 122, 101, 69, 108, 101, 109, 101, 110, 116, 115, 40, 111, 41,
+59, 10, 105, 102, 40, 40, 37, 95, 73, 115, 65, 114, 114, 97, 121, 40, 81, 41,
+41, 41, 37, 78, 111, 114, 109, 97, 108, 105, 122, 101, 69, 108, 101, 109, 101,
+110, 116, 115, 40, 81, 41, 59, 10, 83, 112, 97, 114, 115, 101, 83, 108, 105, 99,
+101, 40, 111, 44, 78, 44, 79, 44, 80, 44, 81, 41, 59, 10, 83, 112, 97, 114, 115,
+101, 77, 111, 118, 101, 40, 111, 44, 78, 44, 79, 44, 80, 44, 97, 120, 41, 59,
+10, 125, 101, 108, 115, 101, 123, 10, 83, 105, 109, 112, 108, 101, 83, 108, 105,
+99, 101, 40, 111, 44, 78, 44, 79, 44, 80, 44, 81, 41, 59, 10, 83, 105, 109, 112,
+108, 101, 77, 111, 118, 101, 40, 111, 44, 78, 44, 79, 44, 80, 44, 97, 120, 41,
+59, 10, 125, 10, 118, 97, 114, 32, 119, 61, 78, 59, 10, 118, 97, 114, 32, 97,
+122, 61, 50, 59, 10, 118, 97, 114, 32, 97, 65, 61, 97, 114, 103, 117, 109, 101,
+110, 116, 115, 46, 108, 101, 110, 103, 116, 104, 59, 10, 119, 104, 105, 108,
+101, 40, 97, 122, 60, 97, 65, 41, 123, 10, 111, 91, 119, 43, 43, 93, 61, 97,
+114, 103, 117, 109, 101, 110, 116, 115, 91, 97, 122, 43, 43, 93, 59, 10, 125,
+10, 111, 46, 108, 101, 110, 103, 116, 104, 61, 80, 45, 79, 43, 97, 120, 59, 10,
+114, 101, 116, 117, 114, 110, 32, 81, 59, 10, 125, 10, 102, 117, 110, 99, 116,
+105, 111, 110, 32, 73, 110, 110, 101, 114, 65, 114, 114, 97, 121, 83, 111, 114,
+116, 40, 111, 44, 112, 44, 97, 66, 41, 123, 10, 105, 102, 40, 33, 40, 116, 121,
+112, 101, 111, 102, 40, 97, 66, 41, 61, 61, 61, 39, 102, 117, 110, 99, 116, 105,
+111, 110, 39, 41, 41, 123, 10, 97, 66, 61, 102, 117, 110, 99, 116, 105, 111,
+110, 40, 77, 44, 97, 67, 41, 123, 10, 105, 102, 40, 77, 61, 61, 61, 97, 67, 41,
+114, 101, 116, 117, 114, 110, 32, 48, 59, 10, 105, 102, 40, 37, 95, 73, 115, 83,
+109, 105, 40, 77, 41, 38, 38, 37, 95, 73, 115, 83, 109, 105, 40, 97, 67, 41, 41,
+123, 10, 114, 101, 116, 117, 114, 110, 32, 37, 83, 109, 105, 76, 101, 120, 105,
+99, 111, 103, 114, 97, 112, 104, 105, 99, 67, 111, 109, 112, 97, 114, 101, 40,
+77, 44, 97, 67, 41, 59, 10, 125, 10, 77, 61, 40, 37, 95, 84, 111, 83, 116, 114,
+105, 110, 103, 40, 77, 41, 41, 59, 10, 97, 67, 61, 40, 37, 95, 84, 111, 83, 116,
+114, 105, 110, 103, 40, 97, 67, 41, 41, 59, 10, 105, 102, 40, 77, 61, 61, 97,
+67, 41, 114, 101, 116, 117, 114, 110, 32, 48, 59, 10, 101, 108, 115, 101, 32,
+114, 101, 116, 117, 114, 110, 32, 77, 60, 97, 67, 63, 45, 49, 58, 49, 59, 10,
+125, 59, 10, 125, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 73, 110, 115,
+101, 114, 116, 105, 111, 110, 83, 111, 114, 116, 40, 114, 44, 110, 44, 97, 68,
+41, 123, 10, 102, 111, 114, 40, 118, 97, 114, 32, 119, 61, 110, 43, 49, 59, 119,
+60, 97, 68, 59, 119, 43, 43, 41, 123, 10, 118, 97, 114, 32, 97, 69, 61, 114, 91,
+119, 93, 59, 10, 102, 111, 114, 40, 118, 97, 114, 32, 97, 105, 61, 119, 45, 49,
+59, 97, 105, 62, 61, 110, 59, 97, 105, 45, 45, 41, 123, 10, 118, 97, 114, 32,
+97, 70, 61, 114, 91, 97, 105, 93, 59, 10, 118, 97, 114, 32, 97, 71, 61, 97, 66,
+40, 97, 70, 44, 97, 69, 41, 59, 10, 105, 102, 40, 97, 71, 62, 48, 41, 123, 10,
+114, 91, 97, 105, 43, 49, 93, 61, 97, 70, 59, 10, 125, 101, 108, 115, 101, 123,
+10, 98, 114, 101, 97, 107, 59, 10, 125, 10, 125, 10, 114, 91, 97, 105, 43, 49,
+93, 61, 97, 69, 59, 10, 125, 10, 125, 59, 10, 102, 117, 110, 99, 116, 105, 111,
+110, 32, 71, 101, 116, 84, 104, 105, 114, 100, 73, 110, 100, 101, 120, 40, 114,
+44, 110, 44, 97, 68, 41, 123, 10, 118, 97, 114, 32, 97, 72, 61, 110, 101, 119,
+32, 103, 40, 41, 59, 10, 118, 97, 114, 32, 97, 73, 61, 50, 48, 48, 43, 40, 40,
+97, 68, 45, 110, 41, 38, 49, 53, 41, 59, 10, 118, 97, 114, 32, 97, 105, 61, 48,
+59, 10, 110, 43, 61, 49, 59, 10, 97, 68, 45, 61, 49, 59, 10, 102, 111, 114, 40,
+118, 97, 114, 32, 119, 61, 110, 59, 119, 60, 97, 68, 59, 119, 43, 61, 97, 73,
+41, 123, 10, 97, 72, 91, 97, 105, 93, 61, 91, 119, 44, 114, 91, 119, 93, 93, 59,
+10, 97, 105, 43, 43, 59, 10, 125, 10, 97, 72, 46, 115, 111, 114, 116, 40, 102,
+117, 110, 99, 116, 105, 111, 110, 40, 114, 44, 115, 41, 123, 10, 114, 101, 116,
+117, 114, 110, 32, 97, 66, 40, 114, 91, 49, 93, 44, 115, 91, 49, 93, 41, 59, 10,
+125, 41, 59, 10, 118, 97, 114, 32, 97, 74, 61, 97, 72, 91, 97, 72, 46, 108, 101,
+110, 103, 116, 104, 62, 62, 49, 93, 91, 48, 93, 59, 10, 114, 101, 116, 117, 114,
+110, 32, 97, 74, 59, 10, 125, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 81,
+117, 105, 99, 107, 83, 111, 114, 116, 40, 114, 44, 110, 44, 97, 68, 41, 123, 10,
+118, 97, 114, 32, 97, 74, 61, 48, 59, 10, 119, 104, 105, 108, 101, 40, 116, 114,
+117, 101, 41, 123, 10, 105, 102, 40, 97, 68, 45, 110, 60, 61, 49, 48, 41, 123,
+10, 73, 110, 115, 101, 114, 116, 105, 111, 110, 83, 111, 114, 116, 40, 114, 44,
+110, 44, 97, 68, 41, 59, 10, 114, 101, 116, 117, 114, 110, 59, 10, 125, 10, 105,
+102, 40, 97, 68, 45, 110, 62, 49, 48, 48, 48, 41, 123, 10, 97, 74, 61, 71, 101,
+116, 84, 104, 105, 114, 100, 73, 110, 100, 101, 120, 40, 114, 44, 110, 44, 97,
+68, 41, 59, 10, 125, 101, 108, 115, 101, 123, 10, 97, 74, 61, 110, 43, 40, 40,
+97, 68, 45, 110, 41, 62, 62, 49, 41, 59, 10, 125, 10, 118, 97, 114, 32, 97, 75,
+61, 114, 91, 110, 93, 59, 10, 118, 97, 114, 32, 97, 76, 61, 114, 91, 97, 68, 45,
+49, 93, 59, 10, 118, 97, 114, 32, 97, 77, 61, 114, 91, 97, 74, 93, 59, 10, 118,
+97, 114, 32, 97, 78, 61, 97, 66, 40, 97, 75, 44, 97, 76, 41, 59, 10, 105, 102,
+40, 97, 78, 62, 48, 41, 123, 10, 118, 97, 114, 32, 97, 70, 61, 97, 75, 59, 10,
+97, 75, 61, 97, 76, 59, 10, 97, 76, 61, 97, 70, 59, 10, 125, 10, 118, 97, 114,
+32, 97, 79, 61, 97, 66, 40, 97, 75, 44, 97, 77, 41, 59, 10, 105, 102, 40, 97,
+79, 62, 61, 48, 41, 123, 10, 118, 97, 114, 32, 97, 70, 61, 97, 75, 59, 10, 97,
+75, 61, 97, 77, 59, 10, 97, 77, 61, 97, 76, 59, 10, 97, 76, 61, 97, 70, 59, 10,
+125, 101, 108, 115, 101, 123, 10, 118, 97, 114, 32, 97, 80, 61, 97, 66, 40, 97,
+76, 44, 97, 77, 41, 59, 10, 105, 102, 40, 97, 80, 62, 48, 41, 123, 10, 118, 97,
+114, 32, 97, 70, 61, 97, 76, 59, 10, 97, 76, 61, 97, 77, 59, 10, 97, 77, 61, 97,
+70, 59, 10, 125, 10, 125, 10, 114, 91, 110, 93, 61, 97, 75, 59, 10, 114, 91, 97,
+68, 45, 49, 93, 61, 97, 77, 59, 10, 118, 97, 114, 32, 97, 81, 61, 97, 76, 59,
+10, 118, 97, 114, 32, 97, 82, 61, 110, 43, 49, 59, 10, 118, 97, 114, 32, 97, 83,
+61, 97, 68, 45, 49, 59, 10, 114, 91, 97, 74, 93, 61, 114, 91, 97, 82, 93, 59,
+10, 114, 91, 97, 82, 93, 61, 97, 81, 59, 10, 112, 97, 114, 116, 105, 116, 105,
+111, 110, 58, 102, 111, 114, 40, 118, 97, 114, 32, 119, 61, 97, 82, 43, 49, 59,
+119, 60, 97, 83, 59, 119, 43, 43, 41, 123, 10, 118, 97, 114, 32, 97, 69, 61,
+114, 91, 119, 93, 59, 10, 118, 97, 114, 32, 97, 71, 61, 97, 66, 40, 97, 69, 44,
+97, 81, 41, 59, 10, 105, 102, 40, 97, 71, 60, 48, 41, 123, 10, 114, 91, 119, 93,
+61, 114, 91, 97, 82, 93, 59, 10, 114, 91, 97, 82, 93, 61, 97, 69, 59, 10, 97,
+82, 43, 43, 59, 10, 125, 101, 108, 115, 101, 32, 105, 102, 40, 97, 71, 62, 48,
+41, 123, 10, 100, 111, 123, 10, 97, 83, 45, 45, 59, 10, 105, 102, 40, 97, 83,
+61, 61, 119, 41, 98, 114, 101, 97, 107, 32, 112, 97, 114, 116, 105, 116, 105,
+111, 110, 59, 10, 118, 97, 114, 32, 97, 84, 61, 114, 91, 97, 83, 93, 59, 10, 97,
+71, 61, 97, 66, 40, 97, 84, 44, 97, 81, 41, 59, 10, 125, 119, 104, 105, 108,
+101, 40, 97, 71, 62, 48, 41, 59, 10, 114, 91, 119, 93, 61, 114, 91, 97, 83, 93,
+59, 10, 114, 91, 97, 83, 93, 61, 97, 69, 59, 10, 105, 102, 40, 97, 71, 60, 48,
+41, 123, 10, 97, 69, 61, 114, 91, 119, 93, 59, 10, 114, 91, 119, 93, 61, 114,
+91, 97, 82, 93, 59, 10, 114, 91, 97, 82, 93, 61, 97, 69, 59, 10, 97, 82, 43, 43,
+59, 10, 125, 10, 125, 10, 125, 10, 105, 102, 40, 97, 68, 45, 97, 83, 60, 97, 82,
+45, 110, 41, 123, 10, 81, 117, 105, 99, 107, 83, 111, 114, 116, 40, 114, 44, 97,
+83, 44, 97, 68, 41, 59, 10, 97, 68, 61, 97, 82, 59, 10, 125, 101, 108, 115, 101,
+123, 10, 81, 117, 105, 99, 107, 83, 111, 114, 116, 40, 114, 44, 110, 44, 97, 82,
+41, 59, 10, 110, 61, 97, 83, 59, 10, 125, 10, 125, 10, 125, 59, 10, 102, 117,
+110, 99, 116, 105, 111, 110, 32, 67, 111, 112, 121, 70, 114, 111, 109, 80, 114,
+111, 116, 111, 116, 121, 112, 101, 40, 97, 85, 44, 112, 41, 123, 10, 118, 97,
+114, 32, 97, 86, 61, 48, 59, 10, 102, 111, 114, 40, 118, 97, 114, 32, 97, 87,
+61, 37, 111, 98, 106, 101, 99, 116, 95, 103, 101, 116, 95, 112, 114, 111, 116,
+111, 116, 121, 112, 101, 95, 111, 102, 40, 97, 85, 41, 59, 97, 87, 59, 10, 97,
+87, 61, 37, 111, 98, 106, 101, 99, 116, 95, 103, 101, 116, 95, 112, 114, 111,
+116, 111, 116, 121, 112, 101, 95, 111, 102, 40, 97, 87, 41, 41, 123, 10, 118,
+97, 114, 32, 116, 61, 40, 37, 95, 73, 115, 74, 83, 80, 114, 111, 120, 121, 40,
+97, 87, 41, 41, 10, 63, 112, 58, 37, 71, 101, 116, 65, 114, 114, 97, 121, 75,
+101, 121, 115, 40, 97, 87, 44, 112, 41, 59, 10, 105, 102, 40, 40, 116, 121, 112,
+101, 111, 102, 40, 116, 41, 61, 61, 61, 39, 110, 117, 109, 98, 101, 114, 39, 41,
+41, 123, 10, 118, 97, 114, 32, 97, 88, 61, 116, 59, 10, 102, 111, 114, 40, 118,
+97, 114, 32, 119, 61, 48, 59, 119, 60, 97, 88, 59, 119, 43, 43, 41, 123, 10,
+105, 102, 40, 33, 40, 37, 95, 67, 97, 108, 108, 40, 106, 44, 97, 85, 44, 119,
+41, 41, 38, 38, 40, 37, 95, 67, 97, 108, 108, 40, 106, 44, 97, 87, 44, 119, 41,
+41, 41, 123, 10, 97, 85, 91, 119, 93, 61, 97, 87, 91, 119, 93, 59, 10, 105, 102,
+40, 119, 62, 61, 97, 86, 41, 123, 97, 86, 61, 119, 43, 49, 59, 125, 10, 125, 10,
+125, 10, 125, 101, 108, 115, 101, 123, 10, 102, 111, 114, 40, 118, 97, 114, 32,
+119, 61, 48, 59, 119, 60, 116, 46, 108, 101, 110, 103, 116, 104, 59, 119, 43,
+43, 41, 123, 10, 118, 97, 114, 32, 88, 61, 116, 91, 119, 93, 59, 10, 105, 102,
+40, 33, 40, 37, 95, 67, 97, 108, 108, 40, 106, 44, 97, 85, 44, 88, 41, 41, 38,
+38, 40, 37, 95, 67, 97, 108, 108, 40, 106, 44, 97, 87, 44, 88, 41, 41, 41, 123,
+10, 97, 85, 91, 88, 93, 61, 97, 87, 91, 88, 93, 59, 10, 105, 102, 40, 88, 62,
+61, 97, 86, 41, 123, 97, 86, 61, 88, 43, 49, 59, 125, 10, 125, 10, 125, 10, 125,
+10, 125, 10, 114, 101, 116, 117, 114, 110, 32, 97, 86, 59, 10, 125, 59, 10, 102,
+117, 110, 99, 116, 105, 111, 110, 32, 83, 104, 97, 100, 111, 119, 80, 114, 111,
+116, 111, 116, 121, 112, 101, 69, 108, 101, 109, 101, 110, 116, 115, 40, 97, 85,
+44, 110, 44, 97, 68, 41, 123, 10, 102, 111, 114, 40, 118, 97, 114, 32, 97, 87,
+61, 37, 111, 98, 106, 101, 99, 116, 95, 103, 101, 116, 95, 112, 114, 111, 116,
+111, 116, 121, 112, 101, 95, 111, 102, 40, 97, 85, 41, 59, 97, 87, 59, 10, 97,
+87, 61, 37, 111, 98, 106, 101, 99, 116, 95, 103, 101, 116, 95, 112, 114, 111,
+116, 111, 116, 121, 112, 101, 95, 111, 102, 40, 97, 87, 41, 41, 123, 10, 118,
+97, 114, 32, 116, 61, 40, 37, 95, 73, 115, 74, 83, 80, 114, 111, 120, 121, 40,
+97, 87, 41, 41, 10, 63, 97, 68, 58, 37, 71, 101, 116, 65, 114, 114, 97, 121, 75,
+101, 121, 115, 40, 97, 87, 44, 97, 68, 41, 59, 10, 105, 102, 40, 40, 116, 121,
+112, 101, 111, 102, 40, 116, 41, 61, 61, 61, 39, 110, 117, 109, 98, 101, 114,
+39, 41, 41, 123, 10, 118, 97, 114, 32, 97, 88, 61, 116, 59, 10, 102, 111, 114,
+40, 118, 97, 114, 32, 119, 61, 110, 59, 119, 60, 97, 88, 59, 119, 43, 43, 41,
+123, 10, 105, 102, 40, 40, 37, 95, 67, 97, 108, 108, 40, 106, 44, 97, 87, 44,
+119, 41, 41, 41, 123, 10, 97, 85, 91, 119, 93, 61, 40, 118, 111, 105, 100, 32,
+48, 41, 59, 10, 125, 10, 125, 10, 125, 101, 108, 115, 101, 123, 10, 102, 111,
+114, 40, 118, 97, 114, 32, 119, 61, 48, 59, 119, 60, 116, 46, 108, 101, 110,
+103, 116, 104, 59, 119, 43, 43, 41, 123, 10, 118, 97, 114, 32, 88, 61, 116, 91,
+119, 93, 59, 10, 105, 102, 40, 110, 60, 61, 88, 38, 38, 40, 37, 95, 67, 97, 108,
+108, 40, 106, 44, 97, 87, 44, 88, 41, 41, 41, 123, 10, 97, 85, 91, 88, 93, 61,
+40, 118, 111, 105, 100, 32, 48, 41, 59, 10, 125, 10, 125, 10, 125, 10, 125, 10,
+125, 59, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 83, 97, 102, 101, 82,
+101, 109, 111, 118, 101, 65, 114, 114, 97, 121, 72, 111, 108, 101, 115, 40, 97,
+85, 41, 123, 10, 118, 97, 114, 32, 97, 89, 61, 48, 59, 10, 118, 97, 114, 32, 97,
+90, 61, 112, 45, 49, 59, 10, 118, 97, 114, 32, 98, 97, 61, 48, 59, 10, 119, 104,
+105, 108, 101, 40, 97, 89, 60, 97, 90, 41, 123, 10, 119, 104, 105, 108, 101, 40,
+97, 89, 60, 97, 90, 38, 38, 10, 33, 40, 97, 85, 91, 97, 89, 93, 61, 61, 61, 40,
+118, 111, 105, 100, 32, 48, 41, 41, 41, 123, 10, 97, 89, 43, 43, 59, 10, 125,
+10, 105, 102, 40, 33, 40, 37, 95, 67, 97, 108, 108, 40, 106, 44, 97, 85, 44, 97,
+89, 41, 41, 41, 123, 10, 98, 97, 43, 43, 59, 10, 125, 10, 119, 104, 105, 108,
+101, 40, 97, 89, 60, 97, 90, 38, 38, 10, 40, 97, 85, 91, 97, 90, 93, 61, 61, 61,
+40, 118, 111, 105, 100, 32, 48, 41, 41, 41, 123, 10, 105, 102, 40, 33, 40, 37,
+95, 67, 97, 108, 108, 40, 106, 44, 97, 85, 44, 97, 90, 41, 41, 41, 123, 10, 98,
+97, 43, 43, 59, 10, 125, 10, 97, 90, 45, 45, 59, 10, 125, 10, 105, 102, 40, 97,
+89, 60, 97, 90, 41, 123, 10, 97, 85, 91, 97, 89, 93, 61, 97, 85, 91, 97, 90, 93,
+59, 10, 97, 85, 91, 97, 90, 93, 61, 40, 118, 111, 105, 100, 32, 48, 41, 59, 10,
+125, 10, 125, 10, 105, 102, 40, 33, 40, 97, 85, 91, 97, 89, 93, 61, 61, 61, 40,
+118, 111, 105, 100, 32, 48, 41, 41, 41, 97, 89, 43, 43, 59, 10, 118, 97, 114,
+32, 119, 59, 10, 102, 111, 114, 40, 119, 61, 97, 89, 59, 119, 60, 112, 45, 98,
+97, 59, 119, 43, 43, 41, 123, 10, 97, 85, 91, 119, 93, 61, 40, 118, 111, 105,
+100, 32, 48, 41, 59, 10, 125, 10, 102, 111, 114, 40, 119, 61, 112, 45, 98, 97,
+59, 119, 60, 112, 59, 119, 43, 43, 41, 123, 10, 105, 102, 40, 119, 32, 105, 110,
+32, 37, 111, 98, 106, 101, 99, 116, 95, 103, 101, 116, 95, 112, 114, 111, 116,
+111, 116, 121, 112, 101, 95, 111, 102, 40, 97, 85, 41, 41, 123, 10, 97, 85, 91,
+119, 93, 61, 40, 118, 111, 105, 100, 32, 48, 41, 59, 10, 125, 101, 108, 115,
+101, 123, 10, 100, 101, 108, 101, 116, 101, 32, 97, 85, 91, 119, 93, 59, 10,
+125, 10, 125, 10, 114, 101, 116, 117, 114, 110, 32, 97, 89, 59, 10, 125, 59, 10,
+105, 102, 40, 112, 60, 50, 41, 114, 101, 116, 117, 114, 110, 32, 111, 59, 10,
+118, 97, 114, 32, 68, 61, 40, 37, 95, 73, 115, 65, 114, 114, 97, 121, 40, 111,
+41, 41, 59, 10, 118, 97, 114, 32, 98, 98, 59, 10, 105, 102, 40, 33, 68, 41, 123,
+10, 98, 98, 61, 67, 111, 112, 121, 70, 114, 111, 109, 80, 114, 111, 116, 111,
+116, 121, 112, 101, 40, 111, 44, 112, 41, 59, 10, 125, 10, 118, 97, 114, 32, 98,
+99, 61, 37, 82, 101, 109, 111, 118, 101, 65, 114, 114, 97, 121, 72, 111, 108,
+101, 115, 40, 111, 44, 112, 41, 59, 10, 105, 102, 40, 98, 99, 61, 61, 45, 49,
+41, 123, 10, 98, 99, 61, 83, 97, 102, 101, 82, 101, 109, 111, 118, 101, 65, 114,
+114, 97, 121, 72, 111, 108, 101, 115, 40, 111, 41, 59, 10, 125, 10, 81, 117,
+105, 99, 107, 83, 111, 114, 116, 40, 111, 44, 48, 44, 98, 99, 41, 59, 10, 105,
+102, 40, 33, 68, 38, 38, 40, 98, 99, 43, 49, 60, 98, 98, 41, 41, 123, 10, 83,
+104, 97, 100, 111, 119, 80, 114, 111, 116, 111, 116, 121, 112, 101, 69, 108,
+101, 109, 101, 110, 116, 115, 40, 111, 44, 98, 99, 44, 98, 98, 41, 59, 10, 125,
+10, 114, 101, 116, 117, 114, 110, 32, 111, 59, 10, 125, 10, 37, 68, 101, 102,
+105, 110, 101, 77, 101, 116, 104, 111, 100, 115, 73, 110, 116, 101, 114, 110,
+97, 108, 40, 102, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 44, 99, 108,
+97, 115, 115, 123, 115, 111, 114, 116, 40, 97, 66, 41, 123, 10, 105, 102, 40,
+33, 40, 97, 66, 61, 61, 61, 40, 118, 111, 105, 100, 32, 48, 41, 41, 38, 38, 33,
+40, 116, 121, 112, 101, 111, 102, 40, 97, 66, 41, 61, 61, 61, 39, 102, 117, 110,
+99, 116, 105, 111, 110, 39, 41, 41, 123, 10, 116, 104, 114, 111, 119, 32, 37,
+109, 97, 107, 101, 95, 116, 121, 112, 101, 95, 101, 114, 114, 111, 114, 40, 49,
+56, 44, 97, 66, 41, 59, 10, 125, 10, 118, 97, 114, 32, 111, 61, 40, 37, 95, 84,
+111, 79, 98, 106, 101, 99, 116, 40, 116, 104, 105, 115, 41, 41, 59, 10, 118, 97,
+114, 32, 112, 61, 40, 37, 95, 84, 111, 76, 101, 110, 103, 116, 104, 40, 111, 46,
+108, 101, 110, 103, 116, 104, 41, 41, 59, 10, 114, 101, 116, 117, 114, 110, 32,
+73, 110, 110, 101, 114, 65, 114, 114, 97, 121, 83, 111, 114, 116, 40, 111, 44,
+112, 44, 97, 66, 41, 59, 10, 125, 125, 44, 45, 49, 41, 59, 10, 37, 68, 101, 102,
+105, 110, 101, 77, 101, 116, 104, 111, 100, 115, 73, 110, 116, 101, 114, 110,
+97, 108, 40, 102, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 44, 99, 108,
+97, 115, 115, 123, 108, 97, 115, 116, 73, 110, 100, 101, 120, 79, 102, 40, 97,
+69, 44, 88, 41, 123, 10, 118, 97, 114, 32, 111, 61, 40, 37, 95, 84, 111, 79, 98,
+106, 101, 99, 116, 40, 116, 104, 105, 115, 41, 41, 59, 10, 118, 97, 114, 32,
+112, 61, 40, 37, 95, 84, 111, 76, 101, 110, 103, 116, 104, 40, 116, 104, 105,
+115, 46, 108, 101, 110, 103, 116, 104, 41, 41, 59, 10, 105, 102, 40, 112, 61,
+61, 48, 41, 114, 101, 116, 117, 114, 110, 45, 49, 59, 10, 105, 102, 40, 97, 114,
+103, 117, 109, 101, 110, 116, 115, 46, 108, 101, 110, 103, 116, 104, 60, 50, 41,
+123, 10, 88, 61, 112, 45, 49, 59, 10, 125, 101, 108, 115, 101, 123, 10, 88, 61,
+40, 40, 40, 37, 95, 84, 111, 73, 110, 116, 101, 103, 101, 114, 40, 88, 41, 41,
+41, 43, 48, 41, 10, 59, 10, 105, 102, 40, 88, 60, 48, 41, 88, 43, 61, 112, 59,
+10, 105, 102, 40, 88, 60, 48, 41, 114, 101, 116, 117, 114, 110, 45, 49, 59, 10,
+101, 108, 115, 101, 32, 105, 102, 40, 88, 62, 61, 112, 41, 88, 61, 112, 45, 49,
+59, 10, 125, 10, 118, 97, 114, 32, 98, 100, 61, 48, 59, 10, 118, 97, 114, 32,
+97, 86, 61, 88, 59, 10, 105, 102, 40, 85, 115, 101, 83, 112, 97, 114, 115, 101,
+86, 97, 114, 105, 97, 110, 116, 40, 111, 44, 112, 44, 40, 37, 95, 73, 115, 65,
+114, 114, 97, 121, 40, 111, 41, 41, 44, 88, 41, 41, 123, 10, 37, 78, 111, 114,
+109, 97, 108, 105, 122, 101, 69, 108, 101, 109, 101, 110, 116, 115, 40, 111, 41,
+59, 10, 118, 97, 114, 32, 116, 61, 37, 71, 101, 116, 65, 114, 114, 97, 121, 75,
+101, 121, 115, 40, 111, 44, 88, 43, 49, 41, 59, 10, 105, 102, 40, 40, 116, 121,
+112, 101, 111, 102, 40, 116, 41, 61, 61, 61, 39, 110, 117, 109, 98, 101, 114,
+39, 41, 41, 123, 10, 97, 86, 61, 116, 59, 10, 125, 101, 108, 115, 101, 123, 10,
+105, 102, 40, 116, 46, 108, 101, 110, 103, 116, 104, 61, 61, 48, 41, 114, 101,
+116, 117, 114, 110, 45, 49, 59, 10, 118, 97, 114, 32, 98, 101, 61, 71, 101, 116,
+83, 111, 114, 116, 101, 100, 65, 114, 114, 97, 121, 75, 101, 121, 115, 40, 111,
+44, 116, 41, 59, 10, 118, 97, 114, 32, 119, 61, 98, 101, 46, 108, 101, 110, 103,
+116, 104, 45, 49, 59, 10, 119, 104, 105, 108, 101, 40, 119, 62, 61, 48, 41, 123,
+10, 118, 97, 114, 32, 67, 61, 98, 101, 91, 119, 93, 59, 10, 105, 102, 40, 111,
+91, 67, 93, 61, 61, 61, 97, 69, 41, 114, 101, 116, 117, 114, 110, 32, 67, 59,
+10, 119, 45, 45, 59, 10, 125, 10, 114, 101, 116, 117, 114, 110, 45, 49, 59, 10,
+125, 10, 125, 10, 105, 102, 40, 33, 40, 97, 69, 61, 61, 61, 40, 118, 111, 105,
+100, 32, 48, 41, 41, 41, 123, 10, 102, 111, 114, 40, 118, 97, 114, 32, 119, 61,
+97, 86, 59, 119, 62, 61, 98, 100, 59, 119, 45, 45, 41, 123, 10, 105, 102, 40,
+111, 91, 119, 93, 61, 61, 61, 97, 69, 41, 114, 101, 116, 117, 114, 110, 32, 119,
+59, 10, 125, 10, 114, 101, 116, 117, 114, 110, 45, 49, 59, 10, 125, 10, 102,
+111, 114, 40, 118, 97, 114, 32, 119, 61, 97, 86, 59, 119, 62, 61, 98, 100, 59,
+119, 45, 45, 41, 123, 10, 105, 102, 40, 40, 111, 91, 119, 93, 61, 61, 61, 40,
+118, 111, 105, 100, 32, 48, 41, 41, 38, 38, 119, 32, 105, 110, 32, 111, 41, 123,
+10, 114, 101, 116, 117, 114, 110, 32, 119, 59, 10, 125, 10, 125, 10, 114, 101,
+116, 117, 114, 110, 45, 49, 59, 10, 125, 125, 44, 49, 41, 59, 10, 37, 68, 101,
+102, 105, 110, 101, 77, 101, 116, 104, 111, 100, 115, 73, 110, 116, 101, 114,
+110, 97, 108, 40, 102, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 44, 99,
+108, 97, 115, 115, 123, 99, 111, 112, 121, 87, 105, 116, 104, 105, 110, 40, 116,
+97, 114, 103, 101, 116, 44, 97, 115, 44, 97, 116, 41, 123, 10, 118, 97, 114, 32,
+111, 61, 40, 37, 95, 84, 111, 79, 98, 106, 101, 99, 116, 40, 116, 104, 105, 115,
+41, 41, 59, 10, 118, 97, 114, 32, 112, 61, 40, 37, 95, 84, 111, 76, 101, 110,
+103, 116, 104, 40, 111, 46, 108, 101, 110, 103, 116, 104, 41, 41, 59, 10, 116,
+97, 114, 103, 101, 116, 61, 40, 37, 95, 84, 111, 73, 110, 116, 101, 103, 101,
+114, 40, 116, 97, 114, 103, 101, 116, 41, 41, 59, 10, 118, 97, 114, 32, 97, 68,
+59, 10, 105, 102, 40, 116, 97, 114, 103, 101, 116, 60, 48, 41, 123, 10, 97, 68,
+61, 104, 40, 112, 43, 116, 97, 114, 103, 101, 116, 44, 48, 41, 59, 10, 125, 101,
+108, 115, 101, 123, 10, 97, 68, 61, 105, 40, 116, 97, 114, 103, 101, 116, 44,
+112, 41, 59, 10, 125, 10, 97, 115, 61, 40, 37, 95, 84, 111, 73, 110, 116, 101,
+103, 101, 114, 40, 97, 115, 41, 41, 59, 10, 118, 97, 114, 32, 110, 59, 10, 105,
+102, 40, 97, 115, 60, 48, 41, 123, 10, 110, 61, 104, 40, 112, 43, 97, 115, 44,
+48, 41, 59, 10, 125, 101, 108, 115, 101, 123, 10, 110, 61, 105, 40, 97, 115, 44,
+112, 41, 59, 10, 125, 10, 97, 116, 61, 40, 97, 116, 61, 61, 61, 40, 118, 111,
+105, 100, 32, 48, 41, 41, 63, 112, 58, 40, 37, 95, 84, 111, 73, 110, 116, 101,
+103, 101, 114, 40, 97, 116, 41, 41, 59, 10, 118, 97, 114, 32, 98, 102, 59, 10,
+105, 102, 40, 97, 116, 60, 48, 41, 123, 10, 98, 102, 61, 104, 40, 112, 43, 97,
+116, 44, 48, 41, 59, 10, 125, 101, 108, 115, 101, 123, 10, 98, 102, 61, 105, 40,
+97, 116, 44, 112, 41, 59, 10, 125, 10, 118, 97, 114, 32, 98, 103, 61, 105, 40,
+98, 102, 45, 110, 44, 112, 45, 97, 68, 41, 59, 10, 118, 97, 114, 32, 98, 104,
+61, 49, 59, 10, 105, 102, 40, 110, 60, 97, 68, 38, 38, 97, 68, 60, 40, 110, 43,
+98, 103, 41, 41, 123, 10, 98, 104, 61, 45, 49, 59, 10, 110, 61, 110, 43, 98,
+103, 45, 49, 59, 10, 97, 68, 61, 97, 68, 43, 98, 103, 45, 49, 59, 10, 125, 10,
+119, 104, 105, 108, 101, 40, 98, 103, 62, 48, 41, 123, 10, 105, 102, 40, 110,
+32, 105, 110, 32, 111, 41, 123, 10, 111, 91, 97, 68, 93, 61, 111, 91, 110, 93,
+59, 10, 125, 101, 108, 115, 101, 123, 10, 100, 101, 108, 101, 116, 101, 32, 111,
+91, 97, 68, 93, 59, 10, 125, 10, 110, 61, 110, 43, 98, 104, 59, 10, 97, 68, 61,
+97, 68, 43, 98, 104, 59, 10, 98, 103, 45, 45, 59, 10, 125, 10, 114, 101, 116,
+117, 114, 110, 32, 111, 59, 10, 125, 125, 44, 50, 41, 59, 10, 37, 68, 101, 102,
+105, 110, 101, 77, 101, 116, 104, 111, 100, 115, 73, 110, 116, 101, 114, 110,
+97, 108, 40, 102, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 44, 99, 108,
+97, 115, 115, 123, 102, 105, 108, 108, 40, 73, 44, 97, 115, 44, 97, 116, 41,
+123, 10, 118, 97, 114, 32, 111, 61, 40, 37, 95, 84, 111, 79, 98, 106, 101, 99,
+116, 40, 116, 104, 105, 115, 41, 41, 59, 10, 118, 97, 114, 32, 112, 61, 40, 37,
+95, 84, 111, 76, 101, 110, 103, 116, 104, 40, 111, 46, 108, 101, 110, 103, 116,
+104, 41, 41, 59, 10, 118, 97, 114, 32, 119, 61, 40, 97, 115, 61, 61, 61, 40,
+118, 111, 105, 100, 32, 48, 41, 41, 63, 48, 58, 40, 37, 95, 84, 111, 73, 110,
+116, 101, 103, 101, 114, 40, 97, 115, 41, 41, 59, 10, 118, 97, 114, 32, 97, 116,
+61, 40, 97, 116, 61, 61, 61, 40, 118, 111, 105, 100, 32, 48, 41, 41, 63, 112,
+58, 40, 37, 95, 84, 111, 73, 110, 116, 101, 103, 101, 114, 40, 97, 116, 41, 41,
+59, 10, 105, 102, 40, 119, 60, 48, 41, 123, 10, 119, 43, 61, 112, 59, 10, 105,
+102, 40, 119, 60, 48, 41, 119, 61, 48, 59, 10, 125, 101, 108, 115, 101, 123, 10,
+105, 102, 40, 119, 62, 112, 41, 119, 61, 112, 59, 10, 125, 10, 105, 102, 40, 97,
+116, 60, 48, 41, 123, 10, 97, 116, 43, 61, 112, 59, 10, 105, 102, 40, 97, 116,
+60, 48, 41, 97, 116, 61, 48, 59, 10, 125, 101, 108, 115, 101, 123, 10, 105, 102,
+40, 97, 116, 62, 112, 41, 97, 116, 61, 112, 59, 10, 125, 10, 105, 102, 40, 40,
+97, 116, 45, 119, 41, 62, 48, 38, 38, 37, 111, 98, 106, 101, 99, 116, 95, 105,
+115, 95, 102, 114, 111, 122, 101, 110, 40, 111, 41, 41, 123, 10, 116, 104, 114,
+111, 119, 32, 37, 109, 97, 107, 101, 95, 116, 121, 112, 101, 95, 101, 114, 114,
+111, 114, 40, 49, 52, 41, 59, 10, 125, 10, 102, 111, 114, 40, 59, 119, 60, 97,
+116, 59, 119, 43, 43, 41, 10, 111, 91, 119, 93, 61, 73, 59, 10, 114, 101, 116,
+117, 114, 110, 32, 111, 59, 10, 125, 125, 44, 49, 41, 59, 10, 118, 97, 114, 32,
+98, 105, 61, 123, 10, 95, 95, 112, 114, 111, 116, 111, 95, 95, 58, 110, 117,
+108, 108, 44, 10, 99, 111, 112, 121, 87, 105, 116, 104, 105, 110, 58, 116, 114,
+117, 101, 44, 10, 101, 110, 116, 114, 105, 101, 115, 58, 116, 114, 117, 101, 44,
+10, 102, 105, 108, 108, 58, 116, 114, 117, 101, 44, 10, 102, 105, 110, 100, 58,
+116, 114, 117, 101, 44, 10, 102, 105, 110, 100, 73, 110, 100, 101, 120, 58, 116,
+114, 117, 101, 44, 10, 105, 110, 99, 108, 117, 100, 101, 115, 58, 116, 114, 117,
+101, 44, 10, 107, 101, 121, 115, 58, 116, 114, 117, 101, 44, 10, 125, 59, 10,
+37, 84, 111, 70, 97, 115, 116, 80, 114, 111, 112, 101, 114, 116, 105, 101, 115,
+40, 98, 105, 41, 59, 10, 37, 65, 100, 100, 78, 97, 109, 101, 100, 80, 114, 111,
+112, 101, 114, 116, 121, 40, 102, 46, 112, 114, 111, 116, 111, 116, 121, 112,
+101, 44, 109, 44, 98, 105, 44, 10, 50, 124, 49, 41, 59, 10, 118, 97, 114, 32,
+98, 106, 61, 102, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 105, 110,
+100, 101, 120, 79, 102, 59, 10, 118, 97, 114, 32, 97, 97, 61, 102, 46, 112, 114,
+111, 116, 111, 116, 121, 112, 101, 46, 106, 111, 105, 110, 59, 10, 118, 97, 114,
+32, 98, 107, 61, 102, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 112,
+111, 112, 59, 10, 118, 97, 114, 32, 98, 108, 61, 102, 46, 112, 114, 111, 116,
+111, 116, 121, 112, 101, 46, 112, 117, 115, 104, 59, 10, 118, 97, 114, 32, 98,
+109, 61, 102, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 115, 108,
+105, 99, 101, 59, 10, 118, 97, 114, 32, 98, 110, 61, 102, 46, 112, 114, 111,
+116, 111, 116, 121, 112, 101, 46, 115, 104, 105, 102, 116, 59, 10, 118, 97, 114,
+32, 98, 111, 61, 102, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 115,
+111, 114, 116, 59, 10, 118, 97, 114, 32, 98, 112, 61, 102, 46, 112, 114, 111,
+116, 111, 116, 121, 112, 101, 46, 115, 112, 108, 105, 99, 101, 59, 10, 118, 97,
+114, 32, 98, 113, 61, 102, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46,
+116, 111, 83, 116, 114, 105, 110, 103, 59, 10, 118, 97, 114, 32, 98, 114, 61,
+102, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 117, 110, 115, 104,
+105, 102, 116, 59, 10, 118, 97, 114, 32, 98, 115, 61, 102, 46, 112, 114, 111,
+116, 111, 116, 121, 112, 101, 46, 101, 110, 116, 114, 105, 101, 115, 59, 10,
+118, 97, 114, 32, 98, 116, 61, 102, 46, 112, 114, 111, 116, 111, 116, 121, 112,
+101, 46, 102, 111, 114, 69, 97, 99, 104, 59, 10, 118, 97, 114, 32, 98, 117, 61,
+102, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 107, 101, 121, 115,
+59, 10, 118, 97, 114, 32, 98, 118, 61, 102, 46, 112, 114, 111, 116, 111, 116,
+121, 112, 101, 91, 108, 93, 59, 10, 98, 46, 83, 101, 116, 85, 112, 76, 111, 99,
+107, 101, 100, 80, 114, 111, 116, 111, 116, 121, 112, 101, 40, 103, 44, 102, 40,
+41, 44, 91, 10, 34, 105, 110, 100, 101, 120, 79, 102, 34, 44, 98, 106, 44, 10,
+34, 106, 111, 105, 110, 34, 44, 97, 97, 44, 10, 34, 112, 111, 112, 34, 44, 98,
+107, 44, 10, 34, 112, 117, 115, 104, 34, 44, 98, 108, 44, 10, 34, 115, 104, 105,
+102, 116, 34, 44, 98, 110, 44, 10, 34, 115, 111, 114, 116, 34, 44, 98, 111, 44,
+10, 34, 115, 112, 108, 105, 99, 101, 34, 44, 98, 112, 10, 93, 41, 59, 10, 98,
+46, 83, 101, 116, 85, 112, 76, 111, 99, 107, 101, 100, 80, 114, 111, 116, 111,
+116, 121, 112, 101, 40, 99, 46, 73, 110, 116, 101, 114, 110, 97, 108, 80, 97,
+99, 107, 101, 100, 65, 114, 114, 97, 121, 44, 102, 40, 41, 44, 91, 10, 34, 112,
+117, 115, 104, 34, 44, 98, 108, 44, 10, 34, 112, 111, 112, 34, 44, 98, 107, 44,
+10, 34, 115, 104, 105, 102, 116, 34, 44, 98, 110, 44, 10, 34, 117, 110, 115,
+104, 105, 102, 116, 34, 44, 98, 114, 44, 10, 34, 115, 112, 108, 105, 99, 101,
+34, 44, 98, 112, 44, 10, 34, 115, 108, 105, 99, 101, 34, 44, 98, 109, 10, 93,
+41, 59, 10, 98, 46, 69, 120, 112, 111, 114, 116, 40, 102, 117, 110, 99, 116,
+105, 111, 110, 40, 97, 68, 41, 123, 10, 97, 68, 46, 65, 114, 114, 97, 121, 74,
+111, 105, 110, 61, 97, 97, 59, 10, 97, 68, 46, 65, 114, 114, 97, 121, 80, 117,
+115, 104, 61, 98, 108, 59, 10, 97, 68, 46, 65, 114, 114, 97, 121, 84, 111, 83,
+116, 114, 105, 110, 103, 61, 98, 113, 59, 10, 97, 68, 46, 65, 114, 114, 97, 121,
+86, 97, 108, 117, 101, 115, 61, 98, 118, 59, 10, 97, 68, 46, 73, 110, 110, 101,
+114, 65, 114, 114, 97, 121, 74, 111, 105, 110, 61, 73, 110, 110, 101, 114, 65,
+114, 114, 97, 121, 74, 111, 105, 110, 59, 10, 97, 68, 46, 73, 110, 110, 101,
+114, 65, 114, 114, 97, 121, 83, 111, 114, 116, 61, 73, 110, 110, 101, 114, 65,
+114, 114, 97, 121, 83, 111, 114, 116, 59, 10, 97, 68, 46, 73, 110, 110, 101,
+114, 65, 114, 114, 97, 121, 84, 111, 76, 111, 99, 97, 108, 101, 83, 116, 114,
+105, 110, 103, 61, 73, 110, 110, 101, 114, 65, 114, 114, 97, 121, 84, 111, 76,
+111, 99, 97, 108, 101, 83, 116, 114, 105, 110, 103, 59, 10, 125, 41, 59, 10, 37,
+73, 110, 115, 116, 97, 108, 108, 84, 111, 67, 111, 110, 116, 101, 120, 116, 40,
+91, 10, 34, 97, 114, 114, 97, 121, 95, 101, 110, 116, 114, 105, 101, 115, 95,
+105, 116, 101, 114, 97, 116, 111, 114, 34, 44, 98, 115, 44, 10, 34, 97, 114,
+114, 97, 121, 95, 102, 111, 114, 95, 101, 97, 99, 104, 95, 105, 116, 101, 114,
+97, 116, 111, 114, 34, 44, 98, 116, 44, 10, 34, 97, 114, 114, 97, 121, 95, 107,
+101, 121, 115, 95, 105, 116, 101, 114, 97, 116, 111, 114, 34, 44, 98, 117, 44,
+10, 34, 97, 114, 114, 97, 121, 95, 118, 97, 108, 117, 101, 115, 95, 105, 116,
+101, 114, 97, 116, 111, 114, 34, 44, 98, 118, 44, 10, 34, 97, 114, 114, 97, 121,
+95, 112, 111, 112, 34, 44, 65, 114, 114, 97, 121, 80, 111, 112, 70, 97, 108,
+108, 98, 97, 99, 107, 44, 10, 34, 97, 114, 114, 97, 121, 95, 112, 117, 115, 104,
+34, 44, 65, 114, 114, 97, 121, 80, 117, 115, 104, 70, 97, 108, 108, 98, 97, 99,
+107, 44, 10, 34, 97, 114, 114, 97, 121, 95, 115, 104, 105, 102, 116, 34, 44, 65,
+114, 114, 97, 121, 83, 104, 105, 102, 116, 70, 97, 108, 108, 98, 97, 99, 107,
+44, 10, 34, 97, 114, 114, 97, 121, 95, 115, 112, 108, 105, 99, 101, 34, 44, 65,
+114, 114, 97, 121, 83, 112, 108, 105, 99, 101, 70, 97, 108, 108, 98, 97, 99,
+107, 44, 10, 34, 97, 114, 114, 97, 121, 95, 115, 108, 105, 99, 101, 34, 44, 65,
+114, 114, 97, 121, 83, 108, 105, 99, 101, 70, 97, 108, 108, 98, 97, 99, 107, 44,
+10, 34, 97, 114, 114, 97, 121, 95, 117, 110, 115, 104, 105, 102, 116, 34, 44,
+65, 114, 114, 97, 121, 85, 110, 115, 104, 105, 102, 116, 70, 97, 108, 108, 98,
+97, 99, 107, 44, 10, 93, 41, 59, 10, 125, 41, 59, 10, 10, 10, 40, 102, 117, 110,
+99, 116, 105, 111, 110, 40, 97, 44, 98, 41, 123, 10, 34, 117, 115, 101, 32, 115,
+116, 114, 105, 99, 116, 34, 59, 10, 37, 67, 104, 101, 99, 107, 73, 115, 66, 111,
+111, 116, 115, 116, 114, 97, 112, 112, 105, 110, 103, 40, 41, 59, 10, 118, 97,
+114, 32, 99, 61, 98, 46, 73, 109, 112, 111, 114, 116, 78, 111, 119, 40, 34, 65,
+114, 114, 97, 121, 84, 111, 83, 116, 114, 105, 110, 103, 34, 41, 59, 10, 118,
+97, 114, 32, 100, 59, 10, 118, 97, 114, 32, 101, 59, 10, 118, 97, 114, 32, 102,
+59, 10, 118, 97, 114, 32, 103, 59, 10, 118, 97, 114, 32, 104, 59, 10, 118, 97,
+114, 32, 105, 61, 98, 46, 73, 110, 116, 101, 114, 110, 97, 108, 65, 114, 114,
+97, 121, 59, 10, 118, 97, 114, 32, 106, 61, 98, 46, 73, 109, 112, 111, 114, 116,
+78, 111, 119, 40, 34, 105, 116, 101, 114, 97, 116, 111, 114, 95, 115, 121, 109,
+98, 111, 108, 34, 41, 59, 10, 118, 97, 114, 32, 107, 61, 97, 46, 85, 105, 110,
+116, 56, 65, 114, 114, 97, 121, 59, 10, 10, 118, 97, 114, 32, 108, 61, 97, 46,
+73, 110, 116, 56, 65, 114, 114, 97, 121, 59, 10, 10, 118, 97, 114, 32, 109, 61,
+97, 46, 85, 105, 110, 116, 49, 54, 65, 114, 114, 97, 121, 59, 10, 10, 118, 97,
+114, 32, 110, 61, 97, 46, 73, 110, 116, 49, 54, 65, 114, 114, 97, 121, 59, 10,
+10, 118, 97, 114, 32, 111, 61, 97, 46, 85, 105, 110, 116, 51, 50, 65, 114, 114,
+97, 121, 59, 10, 10, 118, 97, 114, 32, 112, 61, 97, 46, 73, 110, 116, 51, 50,
+65, 114, 114, 97, 121, 59, 10, 10, 118, 97, 114, 32, 113, 61, 97, 46, 70, 108,
+111, 97, 116, 51, 50, 65, 114, 114, 97, 121, 59, 10, 10, 118, 97, 114, 32, 114,
+61, 97, 46, 70, 108, 111, 97, 116, 54, 52, 65, 114, 114, 97, 121, 59, 10, 10,
+118, 97, 114, 32, 115, 61, 97, 46, 85, 105, 110, 116, 56, 67, 108, 97, 109, 112,
+101, 100, 65, 114, 114, 97, 121, 59, 10, 10, 118, 97, 114, 32, 116, 61, 97, 46,
+66, 105, 103, 85, 105, 110, 116, 54, 52, 65, 114, 114, 97, 121, 59, 10, 10, 118,
+97, 114, 32, 117, 61, 97, 46, 66, 105, 103, 73, 110, 116, 54, 52, 65, 114, 114,
+97, 121, 59, 10, 10, 10, 118, 97, 114, 32, 118, 61, 37, 111, 98, 106, 101, 99,
+116, 95, 103, 101, 116, 95, 112, 114, 111, 116, 111, 116, 121, 112, 101, 95,
+111, 102, 40, 107, 41, 59, 10, 98, 46, 73, 109, 112, 111, 114, 116, 40, 102,
+117, 110, 99, 116, 105, 111, 110, 40, 119, 41, 123, 10, 100, 61, 119, 46, 71,
+101, 116, 73, 116, 101, 114, 97, 116, 111, 114, 59, 10, 101, 61, 119, 46, 71,
+101, 116, 77, 101, 116, 104, 111, 100, 59, 10, 102, 61, 119, 46, 73, 110, 110,
+101, 114, 65, 114, 114, 97, 121, 74, 111, 105, 110, 59, 10, 103, 61, 119, 46,
+73, 110, 110, 101, 114, 65, 114, 114, 97, 121, 83, 111, 114, 116, 59, 10, 104,
+61, 119, 46, 73, 110, 110, 101, 114, 65, 114, 114, 97, 121, 84, 111, 76, 111,
+99, 97, 108, 101, 83, 116, 114, 105, 110, 103, 59, 10, 125, 41, 59, 10, 102,
+117, 110, 99, 116, 105, 111, 110, 32, 86, 97, 108, 105, 100, 97, 116, 101, 84,
+121, 112, 101, 100, 65, 114, 114, 97, 121, 40, 120, 44, 121, 41, 123, 10, 105,
+102, 40, 33, 40, 37, 95, 73, 115, 84, 121, 112, 101, 100, 65, 114, 114, 97, 121,
+40, 120, 41, 41, 10, 41, 116, 104, 114, 111, 119, 32, 37, 109, 97, 107, 101, 95,
+116, 121, 112, 101, 95, 101, 114, 114, 111, 114, 40, 57, 50, 41, 59, 10, 105,
+102, 40, 37, 95, 65, 114, 114, 97, 121, 66, 117, 102, 102, 101, 114, 86, 105,
+101, 119, 87, 97, 115, 78, 101, 117, 116, 101, 114, 101, 100, 40, 120, 41, 41,
+10, 116, 104, 114, 111, 119, 32, 37, 109, 97, 107, 101, 95, 116, 121, 112, 101,
+95, 101, 114, 114, 111, 114, 40, 53, 48, 44, 121, 41, 59, 10, 125, 10, 102, 117,
+110, 99, 116, 105, 111, 110, 32, 84, 121, 112, 101, 100, 65, 114, 114, 97, 121,
+67, 114, 101, 97, 116, 101, 40, 122, 44, 65, 44, 66, 44, 67, 41, 123, 10, 105,
+102, 40, 40, 66, 61, 61, 61, 40, 118, 111, 105, 100, 32, 48, 41, 41, 41, 123,
+10, 118, 97, 114, 32, 68, 61, 110, 101, 119, 32, 122, 40, 65, 41, 59, 10, 125,
+101, 108, 115, 101, 123, 10, 118, 97, 114, 32, 68, 61, 110, 101, 119, 32, 122,
+40, 65, 44, 66, 44, 67, 41, 59, 10, 125, 10, 86, 97, 108, 105, 100, 97, 116,
+101, 84, 121, 112, 101, 100, 65, 114, 114, 97, 121, 40, 68, 44, 34, 84, 121,
+112, 101, 100, 65, 114, 114, 97, 121, 67, 114, 101, 97, 116, 101, 34, 41, 59,
+10, 105, 102, 40, 40, 116, 121, 112, 101, 111, 102, 40, 65, 41, 61, 61, 61, 39,
+110, 117, 109, 98, 101, 114, 39, 41, 38, 38, 37, 95, 84, 121, 112, 101, 100, 65,
+114, 114, 97, 121, 71, 101, 116, 76, 101, 110, 103, 116, 104, 40, 68, 41, 60,
+65, 41, 123, 10, 116, 104, 114, 111, 119, 32, 37, 109, 97, 107, 101, 95, 116,
+121, 112, 101, 95, 101, 114, 114, 111, 114, 40, 50, 56, 52, 41, 59, 10, 125, 10,
+114, 101, 116, 117, 114, 110, 32, 68, 59, 10, 125, 10, 37, 68, 101, 102, 105,
+110, 101, 77, 101, 116, 104, 111, 100, 115, 73, 110, 116, 101, 114, 110, 97,
+108, 40, 118, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 44, 99, 108, 97,
+115, 115, 123, 115, 111, 114, 116, 40, 99, 111, 109, 112, 97, 114, 101, 102,
+110, 41, 123, 10, 86, 97, 108, 105, 100, 97, 116, 101, 84, 121, 112, 101, 100,
+65, 114, 114, 97, 121, 40, 116, 104, 105, 115, 44, 34, 37, 84, 121, 112, 101,
+100, 65, 114, 114, 97, 121, 37, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101,
+46, 115, 111, 114, 116, 34, 41, 59, 10, 105, 102, 40, 33, 40, 99, 111, 109, 112,
+97, 114, 101, 102, 110, 61, 61, 61, 40, 118, 111, 105, 100, 32, 48, 41, 41, 38,
+38, 33, 40, 116, 121, 112, 101, 111, 102, 40, 99, 111, 109, 112, 97, 114, 101,
+102, 110, 41, 61, 61, 61, 39, 102, 117, 110, 99, 116, 105, 111, 110, 39, 41, 41,
+123, 10, 116, 104, 114, 111, 119, 32, 37, 109, 97, 107, 101, 95, 116, 121, 112,
+101, 95, 101, 114, 114, 111, 114, 40, 49, 56, 44, 99, 111, 109, 112, 97, 114,
+101, 102, 110, 41, 59, 10, 125, 10, 118, 97, 114, 32, 69, 61, 37, 95, 84, 121,
+112, 101, 100, 65, 114, 114, 97, 121, 71, 101, 116, 76, 101, 110, 103, 116, 104,
+40, 116, 104, 105, 115, 41, 59, 10, 105, 102, 40, 40, 99, 111, 109, 112, 97,
+114, 101, 102, 110, 61, 61, 61, 40, 118, 111, 105, 100, 32, 48, 41, 41, 41, 123,
+10, 114, 101, 116, 117, 114, 110, 32, 37, 84, 121, 112, 101, 100, 65, 114, 114,
+97, 121, 83, 111, 114, 116, 70, 97, 115, 116, 40, 116, 104, 105, 115, 41, 59,
+10, 125, 10, 114, 101, 116, 117, 114, 110, 32, 103, 40, 116, 104, 105, 115, 44,
+69, 44, 99, 111, 109, 112, 97, 114, 101, 102, 110, 41, 59, 10, 125, 125, 44, 45,
+49, 41, 59, 10, 37, 68, 101, 102, 105, 110, 101, 77, 101, 116, 104, 111, 100,
+115, 73, 110, 116, 101, 114, 110, 97, 108, 40, 118, 46, 112, 114, 111, 116, 111,
+116, 121, 112, 101, 44, 99, 108, 97, 115, 115, 123, 116, 111, 76, 111, 99, 97,
+108, 101, 83, 116, 114, 105, 110, 103, 40, 41, 123, 10, 86, 97, 108, 105, 100,
+97, 116, 101, 84, 121, 112, 101, 100, 65, 114, 114, 97, 121, 40, 116, 104, 105,
+115, 44, 34, 37, 84, 121, 112, 101, 100, 65, 114, 114, 97, 121, 37, 46, 112,
+114, 111, 116, 111, 116, 121, 112, 101, 46, 116, 111, 76, 111, 99, 97, 108, 101,
+83, 116, 114, 105, 110, 103, 34, 41, 59, 10, 118, 97, 114, 32, 69, 61, 37, 95,
+84, 121, 112, 101, 100, 65, 114, 114, 97, 121, 71, 101, 116, 76, 101, 110, 103,
+116, 104, 40, 116, 104, 105, 115, 41, 59, 10, 114, 101, 116, 117, 114, 110, 32,
+104, 40, 116, 104, 105, 115, 44, 69, 41, 59, 10, 125, 125, 44, 45, 49, 41, 59,
+10, 37, 68, 101, 102, 105, 110, 101, 77, 101, 116, 104, 111, 100, 115, 73, 110,
+116, 101, 114, 110, 97, 108, 40, 118, 46, 112, 114, 111, 116, 111, 116, 121,
+112, 101, 44, 99, 108, 97, 115, 115, 123, 106, 111, 105, 110, 40, 115, 101, 112,
+97, 114, 97, 116, 111, 114, 41, 123, 10, 86, 97, 108, 105, 100, 97, 116, 101,
+84, 121, 112, 101, 100, 65, 114, 114, 97, 121, 40, 116, 104, 105, 115, 44, 34,
+37, 84, 121, 112, 101, 100, 65, 114, 114, 97, 121, 37, 46, 112, 114, 111, 116,
+111, 116, 121, 112, 101, 46, 106, 111, 105, 110, 34, 41, 59, 10, 118, 97, 114,
+32, 69, 61, 37, 95, 84, 121, 112, 101, 100, 65, 114, 114, 97, 121, 71, 101, 116,
+76, 101, 110, 103, 116, 104, 40, 116, 104, 105, 115, 41, 59, 10, 114, 101, 116,
+117, 114, 110, 32, 102, 40, 115, 101, 112, 97, 114, 97, 116, 111, 114, 44, 116,
+104, 105, 115, 44, 69, 41, 59, 10, 125, 125, 44, 45, 49, 41, 59, 10, 102, 117,
+110, 99, 116, 105, 111, 110, 32, 84, 121, 112, 101, 100, 65, 114, 114, 97, 121,
+67, 111, 110, 115, 116, 114, 117, 99, 116, 111, 114, 40, 41, 123, 10, 116, 104,
+114, 111, 119, 32, 37, 109, 97, 107, 101, 95, 116, 121, 112, 101, 95, 101, 114,
+114, 111, 114, 40, 51, 54, 44, 34, 84, 121, 112, 101, 100, 65, 114, 114, 97,
+121, 34, 41, 59, 10, 125, 10, 37, 83, 101, 116, 67, 111, 100, 101, 40, 118, 44,
+84, 121, 112, 101, 100, 65, 114, 114, 97, 121, 67, 111, 110, 115, 116, 114, 117,
+99, 116, 111, 114, 41, 59, 10, 37, 65, 100, 100, 78, 97, 109, 101, 100, 80, 114,
+111, 112, 101, 114, 116, 121, 40, 118, 46, 112, 114, 111, 116, 111, 116, 121,
+112, 101, 44, 34, 116, 111, 83, 116, 114, 105, 110, 103, 34, 44, 99, 44, 10, 50,
+41, 59, 10, 125, 41, 10, 10, 10, 40, 102, 117, 110, 99, 116, 105, 111, 110, 40,
+97, 44, 98, 41, 123, 10, 34, 117, 115, 101, 32, 115, 116, 114, 105, 99, 116, 34,
+59, 10, 37, 67, 104, 101, 99, 107, 73, 115, 66, 111, 111, 116, 115, 116, 114,
+97, 112, 112, 105, 110, 103, 40, 41, 59, 10, 118, 97, 114, 32, 99, 61, 98, 46,
+73, 109, 112, 111, 114, 116, 78, 111, 119, 40, 34, 83, 99, 114, 105, 112, 116,
+34, 41, 59, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 83, 99, 114, 105,
+112, 116, 76, 111, 99, 97, 116, 105, 111, 110, 70, 114, 111, 109, 80, 111, 115,
+105, 116, 105, 111, 110, 40, 112, 111, 115, 105, 116, 105, 111, 110, 44, 10,
+105, 110, 99, 108, 117, 100, 101, 95, 114, 101, 115, 111, 117, 114, 99, 101, 95,
+111, 102, 102, 115, 101, 116, 41, 123, 10, 114, 101, 116, 117, 114, 110, 32, 37,
+83, 99, 114, 105, 112, 116, 80, 111, 115, 105, 116, 105, 111, 110, 73, 110, 102,
+111, 40, 116, 104, 105, 115, 44, 112, 111, 115, 105, 116, 105, 111, 110, 44, 33,
+33, 105, 110, 99, 108, 117, 100, 101, 95, 114, 101, 115, 111, 117, 114, 99, 101,
+95, 111, 102, 102, 115, 101, 116, 41, 59, 10, 125, 10, 102, 117, 110, 99, 116,
+105, 111, 110, 32, 83, 99, 114, 105, 112, 116, 78, 97, 109, 101, 79, 114, 83,
+111, 117, 114, 99, 101, 85, 82, 76, 40, 41, 123, 10, 105, 102, 40, 116, 104,
+105, 115, 46, 115, 111, 117, 114, 99, 101, 95, 117, 114, 108, 41, 114, 101, 116,
+117, 114, 110, 32, 116, 104, 105, 115, 46, 115, 111, 117, 114, 99, 101, 95, 117,
+114, 108, 59, 10, 114, 101, 116, 117, 114, 110, 32, 116, 104, 105, 115, 46, 110,
+97, 109, 101, 59, 10, 125, 10, 98, 46, 83, 101, 116, 85, 112, 76, 111, 99, 107,
+101, 100, 80, 114, 111, 116, 111, 116, 121, 112, 101, 40, 99, 44, 91, 10, 34,
+115, 111, 117, 114, 99, 101, 34, 44, 10, 34, 110, 97, 109, 101, 34, 44, 10, 34,
+115, 111, 117, 114, 99, 101, 95, 117, 114, 108, 34, 44, 10, 34, 115, 111, 117,
+114, 99, 101, 95, 109, 97, 112, 112, 105, 110, 103, 95, 117, 114, 108, 34, 44,
+10, 34, 108, 105, 110, 101, 95, 111, 102, 102, 115, 101, 116, 34, 44, 10, 34,
+99, 111, 108, 117, 109, 110, 95, 111, 102, 102, 115, 101, 116, 34, 10, 93, 44,
+91, 10, 34, 108, 111, 99, 97, 116, 105, 111, 110, 70, 114, 111, 109, 80, 111,
+115, 105, 116, 105, 111, 110, 34, 44, 83, 99, 114, 105, 112, 116, 76, 111, 99,
+97, 116, 105, 111, 110, 70, 114, 111, 109, 80, 111, 115, 105, 116, 105, 111,
+110, 44, 10, 34, 110, 97, 109, 101, 79, 114, 83, 111, 117, 114, 99, 101, 85, 82,
+76, 34, 44, 83, 99, 114, 105, 112, 116, 78, 97, 109, 101, 79, 114, 83, 111, 117,
+114, 99, 101, 85, 82, 76, 44, 10, 93, 10, 41, 59, 10, 125, 41, 59, 10, 10, 10,
+40, 102, 117, 110, 99, 116, 105, 111, 110, 40, 97, 44, 98, 41, 123, 10, 34, 117,
+115, 101, 32, 115, 116, 114, 105, 99, 116, 34, 59, 10, 118, 97, 114, 32, 99, 61,
+98, 46, 73, 110, 116, 101, 114, 110, 97, 108, 65, 114, 114, 97, 121, 59, 10,
+102, 117, 110, 99, 116, 105, 111, 110, 32, 83, 112, 114, 101, 97, 100, 65, 114,
+103, 117, 109, 101, 110, 116, 115, 40, 41, 123, 10, 118, 97, 114, 32, 100, 61,
+97, 114, 103, 117, 109, 101, 110, 116, 115, 46, 108, 101, 110, 103, 116, 104,
+59, 10, 118, 97, 114, 32, 101, 61, 110, 101, 119, 32, 99, 40, 41, 59, 10, 102,
+111, 114, 40, 118, 97, 114, 32, 102, 61, 48, 59, 102, 60, 100, 59, 43, 43, 102,
+41, 123, 10, 118, 97, 114, 32, 103, 61, 97, 114, 103, 117, 109, 101, 110, 116,
+115, 91, 102, 93, 59, 10, 118, 97, 114, 32, 104, 61, 103, 46, 108, 101, 110,
+103, 116, 104, 59, 10, 102, 111, 114, 40, 118, 97, 114, 32, 105, 61, 48, 59,
+105, 60, 104, 59, 43, 43, 105, 41, 123, 10, 101, 46, 112, 117, 115, 104, 40,
+103, 91, 105, 93, 41, 59, 10, 125, 10, 125, 10, 114, 101, 116, 117, 114, 110,
+32, 101, 59, 10, 125, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 83, 112,
+114, 101, 97, 100, 73, 116, 101, 114, 97, 98, 108, 101, 40, 106, 41, 123, 10,
+105, 102, 40, 40, 106, 61, 61, 110, 117, 108, 108, 41, 41, 123, 10, 116, 104,
+114, 111, 119, 32, 37, 109, 97, 107, 101, 95, 116, 121, 112, 101, 95, 101, 114,
+114, 111, 114, 40, 56, 57, 44, 106, 41, 59, 10, 125, 10, 118, 97, 114, 32, 101,
+61, 110, 101, 119, 32, 99, 40, 41, 59, 10, 102, 111, 114, 40, 118, 97, 114, 32,
+107, 32, 111, 102, 32, 106, 41, 123, 10, 101, 46, 112, 117, 115, 104, 40, 107,
+41, 59, 10, 125, 10, 114, 101, 116, 117, 114, 110, 32, 101, 59, 10, 125, 10, 37,
+73, 110, 115, 116, 97, 108, 108, 84, 111, 67, 111, 110, 116, 101, 120, 116, 40,
+91, 10, 34, 115, 112, 114, 101, 97, 100, 95, 97, 114, 103, 117, 109, 101, 110,
+116, 115, 34, 44, 83, 112, 114, 101, 97, 100, 65, 114, 103, 117, 109, 101, 110,
+116, 115, 44, 10, 34, 115, 112, 114, 101, 97, 100, 95, 105, 116, 101, 114, 97,
+98, 108, 101, 34, 44, 83, 112, 114, 101, 97, 100, 73, 116, 101, 114, 97, 98,
+108, 101, 44, 10, 93, 41, 59, 10, 125, 41, 10, 10, 10, 40, 102, 117, 110, 99,
+116, 105, 111, 110, 40, 97, 44, 98, 41, 123, 10, 34, 117, 115, 101, 32, 115,
+116, 114, 105, 99, 116, 34, 59, 10, 37, 67, 104, 101, 99, 107, 73, 115, 66, 111,
+111, 116, 115, 116, 114, 97, 112, 112, 105, 110, 103, 40, 41, 59, 10, 118, 97,
+114, 32, 99, 59, 10, 118, 97, 114, 32, 100, 59, 10, 118, 97, 114, 32, 101, 61,
+97, 46, 68, 97, 116, 101, 59, 10, 118, 97, 114, 32, 102, 61, 97, 46, 73, 110,
+116, 108, 59, 10, 118, 97, 114, 32, 103, 61, 102, 46, 68, 97, 116, 101, 84, 105,
+109, 101, 70, 111, 114, 109, 97, 116, 59, 10, 118, 97, 114, 32, 104, 61, 102,
+46, 78, 117, 109, 98, 101, 114, 70, 111, 114, 109, 97, 116, 59, 10, 118, 97,
+114, 32, 105, 61, 102, 46, 67, 111, 108, 108, 97, 116, 111, 114, 59, 10, 118,
+97, 114, 32, 106, 61, 98, 46, 73, 109, 112, 111, 114, 116, 78, 111, 119, 40, 34,
+80, 108, 117, 114, 97, 108, 82, 117, 108, 101, 115, 34, 41, 59, 10, 118, 97,
+114, 32, 107, 61, 102, 46, 118, 56, 66, 114, 101, 97, 107, 73, 116, 101, 114,
+97, 116, 111, 114, 59, 10, 118, 97, 114, 32, 108, 61, 97, 46, 78, 117, 109, 98,
+101, 114, 59, 10, 118, 97, 114, 32, 109, 61, 97, 46, 82, 101, 103, 69, 120, 112,
+59, 10, 118, 97, 114, 32, 110, 61, 97, 46, 83, 116, 114, 105, 110, 103, 59, 10,
+118, 97, 114, 32, 111, 61, 98, 46, 73, 109, 112, 111, 114, 116, 78, 111, 119,
+40, 34, 105, 110, 116, 108, 95, 102, 97, 108, 108, 98, 97, 99, 107, 95, 115,
+121, 109, 98, 111, 108, 34, 41, 59, 10, 118, 97, 114, 32, 112, 61, 98, 46, 73,
+110, 116, 101, 114, 110, 97, 108, 65, 114, 114, 97, 121, 59, 10, 118, 97, 114,
+32, 113, 61, 97, 46, 77, 97, 116, 104, 46, 109, 97, 120, 59, 10, 118, 97, 114,
+32, 114, 61, 97, 46, 79, 98, 106, 101, 99, 116, 46, 112, 114, 111, 116, 111,
+116, 121, 112, 101, 46, 104, 97, 115, 79, 119, 110, 80, 114, 111, 112, 101, 114,
+116, 121, 59, 10, 118, 97, 114, 32, 115, 61, 97, 46, 79, 98, 106, 101, 99, 116,
+46, 107, 101, 121, 115, 59, 10, 118, 97, 114, 32, 116, 61, 98, 46, 73, 109, 112,
+111, 114, 116, 78, 111, 119, 40, 34, 105, 110, 116, 108, 95, 112, 97, 116, 116,
+101, 114, 110, 95, 115, 121, 109, 98, 111, 108, 34, 41, 59, 10, 118, 97, 114,
+32, 117, 61, 98, 46, 73, 109, 112, 111, 114, 116, 78, 111, 119, 40, 34, 105,
+110, 116, 108, 95, 114, 101, 115, 111, 108, 118, 101, 100, 95, 115, 121, 109,
+98, 111, 108, 34, 41, 59, 10, 118, 97, 114, 32, 118, 61, 110, 46, 112, 114, 111,
+116, 111, 116, 121, 112, 101, 46, 115, 117, 98, 115, 116, 114, 59, 10, 118, 97,
+114, 32, 119, 61, 110, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 115,
+117, 98, 115, 116, 114, 105, 110, 103, 59, 10, 98, 46, 73, 109, 112, 111, 114,
+116, 40, 102, 117, 110, 99, 116, 105, 111, 110, 40, 120, 41, 123, 10, 99, 61,
+120, 46, 65, 114, 114, 97, 121, 74, 111, 105, 110, 59, 10, 100, 61, 120, 46, 65,
+114, 114, 97, 121, 80, 117, 115, 104, 59, 10, 125, 41, 59, 10, 102, 117, 110,
+99, 116, 105, 111, 110, 32, 65, 100, 100, 66, 111, 117, 110, 100, 77, 101, 116,
+104, 111, 100, 40, 111, 98, 106, 44, 109, 101, 116, 104, 111, 100, 78, 97, 109,
+101, 44, 105, 109, 112, 108, 101, 109, 101, 110, 116, 97, 116, 105, 111, 110,
+44, 108, 101, 110, 103, 116, 104, 44, 116, 121, 112, 101, 110, 97, 109, 101, 44,
+10, 99, 111, 109, 112, 97, 116, 41, 123, 10, 37, 67, 104, 101, 99, 107, 73, 115,
+66, 111, 111, 116, 115, 116, 114, 97, 112, 112, 105, 110, 103, 40, 41, 59, 10,
+118, 97, 114, 32, 121, 61, 37, 67, 114, 101, 97, 116, 101, 80, 114, 105, 118,
+97, 116, 101, 83, 121, 109, 98, 111, 108, 40, 109, 101, 116, 104, 111, 100, 78,
+97, 109, 101, 41, 59, 10, 37, 68, 101, 102, 105, 110, 101, 77, 101, 116, 104,
+111, 100, 115, 73, 110, 116, 101, 114, 110, 97, 108, 40, 111, 98, 106, 46, 112,
+114, 111, 116, 111, 116, 121, 112, 101, 44, 99, 108, 97, 115, 115, 123, 103,
+101, 116, 91, 109, 101, 116, 104, 111, 100, 78, 97, 109, 101, 93, 40, 41, 123,
+10, 118, 97, 114, 32, 122, 61, 85, 110, 119, 114, 97, 112, 40, 116, 104, 105,
+115, 44, 116, 121, 112, 101, 110, 97, 109, 101, 44, 111, 98, 106, 44, 109, 101,
+116, 104, 111, 100, 78, 97, 109, 101, 44, 99, 111, 109, 112, 97, 116, 41, 59,
+10, 105, 102, 40, 40, 122, 91, 121, 93, 61, 61, 61, 40, 118, 111, 105, 100, 32,
+48, 41, 41, 41, 123, 10, 118, 97, 114, 32, 65, 59, 10, 105, 102, 40, 40, 108,
+101, 110, 103, 116, 104, 61, 61, 61, 40, 118, 111, 105, 100, 32, 48, 41, 41,
+124, 124, 108, 101, 110, 103, 116, 104, 61, 61, 61, 50, 41, 123, 10, 65, 61, 10,
+40, 48, 44, 40, 40, 102, 115, 116, 44, 115, 110, 100, 41, 61, 62, 105, 109, 112,
+108, 101, 109, 101, 110, 116, 97, 116, 105, 111, 110, 40, 122, 44, 102, 115,
+116, 44, 115, 110, 100, 41, 41, 41, 10, 59, 10, 125, 101, 108, 115, 101, 32,
+105, 102, 40, 108, 101, 110, 103, 116, 104, 61, 61, 61, 49, 41, 123, 10, 65, 61,
+40, 48, 44, 40, 102, 115, 116, 61, 62, 105, 109, 112, 108, 101, 109, 101, 110,
+116, 97, 116, 105, 111, 110, 40, 122, 44, 102, 115, 116, 41, 41, 41, 10, 59, 10,
+125, 101, 108, 115, 101, 123, 10, 65, 61, 40, 48, 44, 40, 40, 46, 46, 46, 97,
+114, 103, 115, 41, 61, 62, 123, 10, 105, 102, 40, 97, 114, 103, 115, 46, 108,
+101, 110, 103, 116, 104, 62, 48, 41, 123, 10, 114, 101, 116, 117, 114, 110, 32,
+105, 109, 112, 108, 101, 109, 101, 110, 116, 97, 116, 105, 111, 110, 40, 122,
+44, 97, 114, 103, 115, 91, 48, 93, 41, 59, 10, 125, 101, 108, 115, 101, 123, 10,
+114, 101, 116, 117, 114, 110, 32, 105, 109, 112, 108, 101, 109, 101, 110, 116,
+97, 116, 105, 111, 110, 40, 122, 41, 59, 10, 125, 10, 125, 41, 41, 10, 59, 10,
+125, 10, 37, 83, 101, 116, 78, 97, 116, 105, 118, 101, 70, 108, 97, 103, 40, 65,
+41, 59, 10, 122, 91, 121, 93, 61, 65, 59, 10, 125, 10, 114, 101, 116, 117, 114,
+110, 32, 122, 91, 121, 93, 59, 10, 125, 125, 44, 45, 49, 41, 59, 10, 125, 10,
+102, 117, 110, 99, 116, 105, 111, 110, 32, 73, 110, 116, 108, 67, 111, 110, 115,
+116, 114, 117, 99, 116, 40, 122, 44, 99, 111, 110, 115, 116, 114, 117, 99, 116,
+111, 114, 44, 99, 114, 101, 97, 116, 101, 44, 110, 101, 119, 84, 97, 114, 103,
+101, 116, 44, 97, 114, 103, 115, 44, 10, 99, 111, 109, 112, 97, 116, 41, 123,
+10, 118, 97, 114, 32, 66, 61, 97, 114, 103, 115, 91, 48, 93, 59, 10, 118, 97,
+114, 32, 67, 61, 97, 114, 103, 115, 91, 49, 93, 59, 10, 118, 97, 114, 32, 68,
+61, 99, 114, 101, 97, 116, 101, 40, 66, 44, 67, 41, 59, 10, 105, 102, 40, 99,
+111, 109, 112, 97, 116, 38, 38, 40, 110, 101, 119, 84, 97, 114, 103, 101, 116,
+61, 61, 61, 40, 118, 111, 105, 100, 32, 48, 41, 41, 38, 38, 122, 32, 105, 110,
+115, 116, 97, 110, 99, 101, 111, 102, 32, 99, 111, 110, 115, 116, 114, 117, 99,
+116, 111, 114, 41, 123, 10, 37, 111, 98, 106, 101, 99, 116, 95, 100, 101, 102,
+105, 110, 101, 95, 112, 114, 111, 112, 101, 114, 116, 121, 40, 122, 44, 111, 44,
+123, 118, 97, 108, 117, 101, 58, 68, 125, 41, 59, 10, 114, 101, 116, 117, 114,
+110, 32, 122, 59, 10, 125, 10, 114, 101, 116, 117, 114, 110, 32, 68, 59, 10,
+125, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 85, 110, 119, 114, 97, 112,
+40, 122, 44, 69, 44, 70, 44, 71, 44, 72, 41, 123, 10, 105, 102, 40, 33, 37, 73,
+115, 73, 110, 105, 116, 105, 97, 108, 105, 122, 101, 100, 73, 110, 116, 108, 79,
+98, 106, 101, 99, 116, 79, 102, 84, 121, 112, 101, 40, 122, 44, 69, 41, 41, 123,
+10, 105, 102, 40, 72, 38, 38, 122, 32, 105, 110, 115, 116, 97, 110, 99, 101,
+111, 102, 32, 70, 41, 123, 10, 108, 101, 116, 32, 102, 97, 108, 108, 98, 97, 99,
+107, 61, 122, 91, 111, 93, 59, 10, 105, 102, 40, 37, 73, 115, 73, 110, 105, 116,
+105, 97, 108, 105, 122, 101, 100, 73, 110, 116, 108, 79, 98, 106, 101, 99, 116,
+79, 102, 84, 121, 112, 101, 40, 102, 97, 108, 108, 98, 97, 99, 107, 44, 69, 41,
+41, 123, 10, 114, 101, 116, 117, 114, 110, 32, 102, 97, 108, 108, 98, 97, 99,
+107, 59, 10, 125, 10, 125, 10, 116, 104, 114, 111, 119, 32, 37, 109, 97, 107,
+101, 95, 116, 121, 112, 101, 95, 101, 114, 114, 111, 114, 40, 54, 49, 44, 71,
+44, 122, 41, 59, 10, 125, 10, 114, 101, 116, 117, 114, 110, 32, 122, 59, 10,
+125, 10, 118, 97, 114, 32, 73, 61, 123, 10, 39, 99, 111, 108, 108, 97, 116, 111,
+114, 39, 58, 40, 118, 111, 105, 100, 32, 48, 41, 44, 10, 39, 110, 117, 109, 98,
+101, 114, 102, 111, 114, 109, 97, 116, 39, 58, 40, 118, 111, 105, 100, 32, 48,
+41, 44, 10, 39, 100, 97, 116, 101, 102, 111, 114, 109, 97, 116, 39, 58, 40, 118,
+111, 105, 100, 32, 48, 41, 44, 10, 39, 98, 114, 101, 97, 107, 105, 116, 101,
+114, 97, 116, 111, 114, 39, 58, 40, 118, 111, 105, 100, 32, 48, 41, 44, 10, 39,
+112, 108, 117, 114, 97, 108, 114, 117, 108, 101, 115, 39, 58, 40, 118, 111, 105,
+100, 32, 48, 41, 44, 10, 125, 59, 10, 118, 97, 114, 32, 74, 61, 40, 118, 111,
+105, 100, 32, 48, 41, 59, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 71,
+101, 116, 68, 101, 102, 97, 117, 108, 116, 73, 67, 85, 76, 111, 99, 97, 108,
+101, 74, 83, 40, 41, 123, 10, 105, 102, 40, 40, 74, 61, 61, 61, 40, 118, 111,
+105, 100, 32, 48, 41, 41, 41, 123, 10, 74, 61, 37, 71, 101, 116, 68, 101, 102,
+97, 117, 108, 116, 73, 67, 85, 76, 111, 99, 97, 108, 101, 40, 41, 59, 10, 125,
+10, 114, 101, 116, 117, 114, 110, 32, 74, 59, 10, 125, 10, 118, 97, 114, 32, 75,
+61, 40, 118, 111, 105, 100, 32, 48, 41, 59, 10, 102, 117, 110, 99, 116, 105,
+111, 110, 32, 71, 101, 116, 85, 110, 105, 99, 111, 100, 101, 69, 120, 116, 101,
+110, 115, 105, 111, 110, 82, 69, 40, 41, 123, 10, 105, 102, 40, 40, 40, 118,
+111, 105, 100, 32, 48, 41, 61, 61, 61, 40, 118, 111, 105, 100, 32, 48, 41, 41,
+41, 123, 10, 75, 61, 110, 101, 119, 32, 109, 40, 39, 45, 117, 40, 45, 91, 97,
+45, 122, 48, 45, 57, 93, 123, 50, 44, 56, 125, 41, 43, 39, 44, 39, 103, 39, 41,
+59, 10, 125, 10, 114, 101, 116, 117, 114, 110, 32, 75, 59, 10, 125, 10, 118, 97,
+114, 32, 76, 61, 40, 118, 111, 105, 100, 32, 48, 41, 59, 10, 102, 117, 110, 99,
+116, 105, 111, 110, 32, 71, 101, 116, 65, 110, 121, 69, 120, 116, 101, 110, 115,
+105, 111, 110, 82, 69, 40, 41, 123, 10, 105, 102, 40, 40, 76, 61, 61, 61, 40,
+118, 111, 105, 100, 32, 48, 41, 41, 41, 123, 10, 76, 61, 110, 101, 119, 32, 109,
+40, 39, 45, 91, 97, 45, 122, 48, 45, 57, 93, 123, 49, 125, 45, 46, 42, 39, 44,
+39, 103, 39, 41, 59, 10, 125, 10, 114, 101, 116, 117, 114, 110, 32, 76, 59, 10,
+125, 10, 118, 97, 114, 32, 77, 61, 40, 118, 111, 105, 100, 32, 48, 41, 59, 10,
+102, 117, 110, 99, 116, 105, 111, 110, 32, 71, 101, 116, 81, 117, 111, 116, 101,
+100, 83, 116, 114, 105, 110, 103, 82, 69, 40, 41, 123, 10, 105, 102, 40, 40, 77,
+61, 61, 61, 40, 118, 111, 105, 100, 32, 48, 41, 41, 41, 123, 10, 77, 61, 110,
+101, 119, 32, 109, 40, 34, 39, 91, 94, 39, 93, 43, 39, 34, 44, 39, 103, 39, 41,
+59, 10, 125, 10, 114, 101, 116, 117, 114, 110, 32, 77, 59, 10, 125, 10, 118, 97,
+114, 32, 78, 61, 40, 118, 111, 105, 100, 32, 48, 41, 59, 10, 102, 117, 110, 99,
+116, 105, 111, 110, 32, 71, 101, 116, 83, 101, 114, 118, 105, 99, 101, 82, 69,
+40, 41, 123, 10, 105, 102, 40, 40, 78, 61, 61, 61, 40, 118, 111, 105, 100, 32,
+48, 41, 41, 41, 123, 10, 78, 61, 10, 110, 101, 119, 32, 109, 40, 39, 94, 40, 39,
+43, 37, 95, 67, 97, 108, 108, 40, 99, 44, 115, 40, 73, 41, 44, 39, 124, 39, 41,
+43, 39, 41, 36, 39, 41, 59, 10, 125, 10, 114, 101, 116, 117, 114, 110, 32, 78,
+59, 10, 125, 10, 118, 97, 114, 32, 79, 61, 40, 118, 111, 105, 100, 32, 48, 41,
+59, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 71, 101, 116, 76, 97, 110,
+103, 117, 97, 103, 101, 84, 97, 103, 82, 69, 40, 41, 123, 10, 105, 102, 40, 40,
+79, 61, 61, 61, 40, 118, 111, 105, 100, 32, 48, 41, 41, 41, 123, 10, 66, 117,
+105, 108, 100, 76, 97, 110, 103, 117, 97, 103, 101, 84, 97, 103, 82, 69, 115,
+40, 41, 59, 10, 125, 10, 114, 101, 116, 117, 114, 110, 32, 79, 59, 10, 125, 10,
+118, 97, 114, 32, 80, 61, 40, 118, 111, 105, 100, 32, 48, 41, 59, 10, 102, 117,
+110, 99, 116, 105, 111, 110, 32, 71, 101, 116, 76, 97, 110, 103, 117, 97, 103,
+101, 86, 97, 114, 105, 97, 110, 116, 82, 69, 40, 41, 123, 10, 105, 102, 40, 40,
+80, 61, 61, 61, 40, 118, 111, 105, 100, 32, 48, 41, 41, 41, 123, 10, 66, 117,
+105, 108, 100, 76, 97, 110, 103, 117, 97, 103, 101, 84, 97, 103, 82, 69, 115,
+40, 41, 59, 10, 125, 10, 114, 101, 116, 117, 114, 110, 32, 80, 59, 10, 125, 10,
+118, 97, 114, 32, 81, 61, 40, 118, 111, 105, 100, 32, 48, 41, 59, 10, 102, 117,
+110, 99, 116, 105, 111, 110, 32, 71, 101, 116, 76, 97, 110, 103, 117, 97, 103,
+101, 83, 105, 110, 103, 108, 101, 116, 111, 110, 82, 69, 40, 41, 123, 10, 105,
+102, 40, 40, 81, 61, 61, 61, 40, 118, 111, 105, 100, 32, 48, 41, 41, 41, 123,
+10, 66, 117, 105, 108, 100, 76, 97, 110, 103, 117, 97, 103, 101, 84, 97, 103,
+82, 69, 115, 40, 41, 59, 10, 125, 10, 114, 101, 116, 117, 114, 110, 32, 81, 59,
+10, 125, 10, 118, 97, 114, 32, 82, 61, 40, 118, 111, 105, 100, 32, 48, 41, 59,
+10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 71, 101, 116, 84, 105, 109, 101,
+122, 111, 110, 101, 78, 97, 109, 101, 67, 104, 101, 99, 107, 82, 69, 40, 41,
+123, 10, 105, 102, 40, 40, 82, 61, 61, 61, 40, 118, 111, 105, 100, 32, 48, 41,
+41, 41, 123, 10, 82, 61, 110, 101, 119, 32, 109, 40, 10, 39, 94, 40, 91, 65, 45,
+90, 97, 45, 122, 93, 43, 41, 47, 40, 91, 65, 45, 90, 97, 45, 122, 95, 45, 93,
+43, 41, 40, 40, 63, 58, 92, 47, 91, 65, 45, 90, 97, 45, 122, 95, 45, 93, 43, 41,
+43, 41, 42, 36, 39, 41, 59, 10, 125, 10, 114, 101, 116, 117, 114, 110, 32, 82,
+59, 10, 125, 10, 118, 97, 114, 32, 83, 61, 40, 118, 111, 105, 100, 32, 48, 41,
+59, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 71, 101, 116, 84, 105, 109,
+101, 122, 111, 110, 101, 78, 97, 109, 101, 76, 111, 99, 97, 116, 105, 111, 110,
+80, 97, 114, 116, 82, 69, 40, 41, 123, 10, 105, 102, 40, 40, 83, 61, 61, 61, 40,
+118, 111, 105, 100, 32, 48, 41, 41, 41, 123, 10, 83, 61, 10, 110, 101, 119, 32,
+109, 40, 39, 94, 40, 91, 65, 45, 90, 97, 45, 122, 93, 43, 41, 40, 40, 63, 58,
+91, 95, 45, 93, 91, 65, 45, 90, 97, 45, 122, 93, 43, 41, 43, 41, 42, 36, 39, 41,
+59, 10, 125, 10, 114, 101, 116, 117, 114, 110, 32, 83, 59, 10, 125, 10, 102,
+117, 110, 99, 116, 105, 111, 110, 32, 115, 117, 112, 112, 111, 114, 116, 101,
+100, 76, 111, 99, 97, 108, 101, 115, 79, 102, 40, 84, 44, 66, 44, 67, 41, 123,
+10, 105, 102, 40, 40, 37, 114, 101, 103, 101, 120, 112, 95, 105, 110, 116, 101,
+114, 110, 97, 108, 95, 109, 97, 116, 99, 104, 40, 71, 101, 116, 83, 101, 114,
+118, 105, 99, 101, 82, 69, 40, 41, 44, 84, 41, 61, 61, 61, 110, 117, 108, 108,
+41, 41, 123, 10, 116, 104, 114, 111, 119, 32, 37, 109, 97, 107, 101, 95, 101,
+114, 114, 111, 114, 40, 56, 44, 84, 41, 59, 10, 125, 10, 105, 102, 40, 40, 67,
+61, 61, 61, 40, 118, 111, 105, 100, 32, 48, 41, 41, 41, 123, 10, 67, 61, 123,
+95, 95, 112, 114, 111, 116, 111, 95, 95, 58, 110, 117, 108, 108, 125, 59, 10,
+125, 101, 108, 115, 101, 123, 10, 67, 61, 40, 37, 95, 84, 111, 79, 98, 106, 101,
+99, 116, 40, 67, 41, 41, 59, 10, 125, 10, 118, 97, 114, 32, 85, 61, 67, 46, 108,
+111, 99, 97, 108, 101, 77, 97, 116, 99, 104, 101, 114, 59, 10, 105, 102, 40, 33,
+40, 85, 61, 61, 61, 40, 118, 111, 105, 100, 32, 48, 41, 41, 41, 123, 10, 85, 61,
+40, 37, 95, 84, 111, 83, 116, 114, 105, 110, 103, 40, 85, 41, 41, 59, 10, 105,
+102, 40, 85, 33, 61, 61, 39, 108, 111, 111, 107, 117, 112, 39, 38, 38, 85, 33,
+61, 61, 39, 98, 101, 115, 116, 32, 102, 105, 116, 39, 41, 123, 10, 116, 104,
+114, 111, 119, 32, 37, 109, 97, 107, 101, 95, 114, 97, 110, 103, 101, 95, 101,
+114, 114, 111, 114, 40, 49, 57, 52, 44, 85, 41, 59, 10, 125, 10, 125, 101, 108,
+115, 101, 123, 10, 85, 61, 39, 98, 101, 115, 116, 32, 102, 105, 116, 39, 59, 10,
+125, 10, 118, 97, 114, 32, 86, 61, 105, 110, 105, 116, 105, 97, 108, 105, 122,
+101, 76, 111, 99, 97, 108, 101, 76, 105, 115, 116, 40, 66, 41, 59, 10, 118, 97,
+114, 32, 87, 61, 103, 101, 116, 65, 118, 97, 105, 108, 97, 98, 108, 101, 76,
+111, 99, 97, 108, 101, 115, 79, 102, 40, 84, 41, 59, 10, 105, 102, 40, 85, 61,
+61, 61, 39, 98, 101, 115, 116, 32, 102, 105, 116, 39, 41, 123, 10, 114, 101,
+116, 117, 114, 110, 32, 105, 110, 105, 116, 105, 97, 108, 105, 122, 101, 76,
+111, 99, 97, 108, 101, 76, 105, 115, 116, 40, 98, 101, 115, 116, 70, 105, 116,
+83, 117, 112, 112, 111, 114, 116, 101, 100, 76, 111, 99, 97, 108, 101, 115, 79,
+102, 40, 10, 86, 44, 87, 41, 41, 59, 10, 125, 10, 114, 101, 116, 117, 114, 110,
+32, 105, 110, 105, 116, 105, 97, 108, 105, 122, 101, 76, 111, 99, 97, 108, 101,
+76, 105, 115, 116, 40, 108, 111, 111, 107, 117, 112, 83, 117, 112, 112, 111,
+114, 116, 101, 100, 76, 111, 99, 97, 108, 101, 115, 79, 102, 40, 10, 86, 44, 87,
+41, 41, 59, 10, 125, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 108, 111,
+111, 107, 117, 112, 83, 117, 112, 112, 111, 114, 116, 101, 100, 76, 111, 99, 97,
+108, 101, 115, 79, 102, 40, 86, 44, 87, 41, 123, 10, 118, 97, 114, 32, 88, 61,
+110, 101, 119, 32, 112, 40, 41, 59, 10, 102, 111, 114, 40, 118, 97, 114, 32, 89,
+61, 48, 59, 89, 60, 86, 46, 108, 101, 110, 103, 116, 104, 59, 43, 43, 89, 41,
+123, 10, 118, 97, 114, 32, 90, 61, 37, 82, 101, 103, 69, 120, 112, 73, 110, 116,
+101, 114, 110, 97, 108, 82, 101, 112, 108, 97, 99, 101, 40, 10, 71, 101, 116,
+85, 110, 105, 99, 111, 100, 101, 69, 120, 116, 101, 110, 115, 105, 111, 110, 82,
+69, 40, 41, 44, 86, 91, 89, 93, 44, 39, 39, 41, 59, 10, 100, 111, 123, 10, 105,
+102, 40, 33, 40, 87, 91, 90, 93, 61, 61, 61, 40, 118, 111, 105, 100, 32, 48, 41,
+41, 41, 123, 10, 37, 95, 67, 97, 108, 108, 40, 100, 44, 88, 44, 86, 91, 89, 93,
+41, 59, 10, 98, 114, 101, 97, 107, 59, 10, 125, 10, 118, 97, 114, 32, 97, 97,
+61, 37, 83, 116, 114, 105, 110, 103, 76, 97, 115, 116, 73, 110, 100, 101, 120,
+79, 102, 40, 90, 44, 39, 45, 39, 41, 59, 10, 105, 102, 40, 97, 97, 61, 61, 61,
+45, 49, 41, 123, 10, 98, 114, 101, 97, 107, 59, 10, 125, 10, 90, 61, 37, 95, 67,
+97, 108, 108, 40, 119, 44, 90, 44, 48, 44, 97, 97, 41, 59, 10, 125, 119, 104,
+105, 108, 101, 40, 116, 114, 117, 101, 41, 59, 10, 125, 10, 114, 101, 116, 117,
+114, 110, 32, 88, 59, 10, 125, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32,
+98, 101, 115, 116, 70, 105, 116, 83, 117, 112, 112, 111, 114, 116, 101, 100, 76,
+111, 99, 97, 108, 101, 115, 79, 102, 40, 86, 44, 87, 41, 123, 10, 114, 101, 116,
+117, 114, 110, 32, 108, 111, 111, 107, 117, 112, 83, 117, 112, 112, 111, 114,
+116, 101, 100, 76, 111, 99, 97, 108, 101, 115, 79, 102, 40, 86, 44, 87, 41, 59,
+10, 125, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 103, 101, 116, 71, 101,
+116, 79, 112, 116, 105, 111, 110, 40, 67, 44, 97, 98, 41, 123, 10, 105, 102, 40,
+40, 67, 61, 61, 61, 40, 118, 111, 105, 100, 32, 48, 41, 41, 41, 116, 104, 114,
+111, 119, 32, 37, 109, 97, 107, 101, 95, 101, 114, 114, 111, 114, 40, 52, 44,
+97, 98, 41, 59, 10, 118, 97, 114, 32, 97, 99, 61, 102, 117, 110, 99, 116, 105,
+111, 110, 32, 103, 101, 116, 79, 112, 116, 105, 111, 110, 40, 97, 100, 44, 97,
+101, 44, 97, 102, 44, 97, 103, 41, 123, 10, 105, 102, 40, 33, 40, 67, 91, 97,
+100, 93, 61, 61, 61, 40, 118, 111, 105, 100, 32, 48, 41, 41, 41, 123, 10, 118,
+97, 114, 32, 97, 104, 61, 67, 91, 97, 100, 93, 59, 10, 115, 119, 105, 116, 99,
+104, 40, 97, 101, 41, 123, 10, 99, 97, 115, 101, 39, 98, 111, 111, 108, 101, 97,
+110, 39, 58, 10, 97, 104, 61, 40, 33, 33, 40, 97, 104, 41, 41, 59, 10, 98, 114,
+101, 97, 107, 59, 10, 99, 97, 115, 101, 39, 115, 116, 114, 105, 110, 103, 39,
+58, 10, 97, 104, 61, 40, 37, 95, 84, 111, 83, 116, 114, 105, 110, 103, 40, 97,
+104, 41, 41, 59, 10, 98, 114, 101, 97, 107, 59, 10, 99, 97, 115, 101, 39, 110,
+117, 109, 98, 101, 114, 39, 58, 10, 97, 104, 61, 40, 37, 95, 84, 111, 78, 117,
+109, 98, 101, 114, 40, 97, 104, 41, 41, 59, 10, 98, 114, 101, 97, 107, 59, 10,
+100, 101, 102, 97, 117, 108, 116, 58, 10, 116, 104, 114, 111, 119, 32, 37, 109,
+97, 107, 101, 95, 101, 114, 114, 111, 114, 40, 57, 41, 59, 10, 125, 10, 105,
+102, 40, 33, 40, 97, 102, 61, 61, 61, 40, 118, 111, 105, 100, 32, 48, 41, 41,
+38, 38, 37, 65, 114, 114, 97, 121, 73, 110, 100, 101, 120, 79, 102, 40, 97, 102,
+44, 97, 104, 44, 48, 41, 61, 61, 61, 45, 49, 41, 123, 10, 116, 104, 114, 111,
+119, 32, 37, 109, 97, 107, 101, 95, 114, 97, 110, 103, 101, 95, 101, 114, 114,
+111, 114, 40, 50, 48, 52, 44, 97, 104, 44, 97, 98, 44, 97, 100, 41, 59, 10, 125,
+10, 114, 101, 116, 117, 114, 110, 32, 97, 104, 59, 10, 125, 10, 114, 101, 116,
+117, 114, 110, 32, 97, 103, 59, 10, 125, 10, 114, 101, 116, 117, 114, 110, 32,
+97, 99, 59, 10, 125, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 114, 101,
+115, 111, 108, 118, 101, 76, 111, 99, 97, 108, 101, 40, 84, 44, 86, 44, 67, 41,
+123, 10, 86, 61, 105, 110, 105, 116, 105, 97, 108, 105, 122, 101, 76, 111, 99,
+97, 108, 101, 76, 105, 115, 116, 40, 86, 41, 59, 10, 118, 97, 114, 32, 97, 99,
+61, 103, 101, 116, 71, 101, 116, 79, 112, 116, 105, 111, 110, 40, 67, 44, 84,
+41, 59, 10, 118, 97, 114, 32, 85, 61, 97, 99, 40, 39, 108, 111, 99, 97, 108,
+101, 77, 97, 116, 99, 104, 101, 114, 39, 44, 39, 115, 116, 114, 105, 110, 103,
+39, 44, 10, 91, 39, 108, 111, 111, 107, 117, 112, 39, 44, 39, 98, 101, 115, 116,
+32, 102, 105, 116, 39, 93, 44, 39, 98, 101, 115, 116, 32, 102, 105, 116, 39, 41,
+59, 10, 118, 97, 114, 32, 97, 105, 59, 10, 105, 102, 40, 85, 61, 61, 61, 39,
+108, 111, 111, 107, 117, 112, 39, 41, 123, 10, 97, 105, 61, 108, 111, 111, 107,
+117, 112, 77, 97, 116, 99, 104, 101, 114, 40, 84, 44, 86, 41, 59, 10, 125, 101,
+108, 115, 101, 123, 10, 97, 105, 61, 98, 101, 115, 116, 70, 105, 116, 77, 97,
+116, 99, 104, 101, 114, 40, 84, 44, 86, 41, 59, 10, 125, 10, 114, 101, 116, 117,
+114, 110, 32, 97, 105, 59, 10, 125, 10, 102, 117, 110, 99, 116, 105, 111, 110,
+32, 98, 101, 115, 116, 65, 118, 97, 105, 108, 97, 98, 108, 101, 76, 111, 99, 97,
+108, 101, 40, 87, 44, 90, 41, 123, 10, 100, 111, 123, 10, 105, 102, 40, 33, 40,
+87, 91, 90, 93, 61, 61, 61, 40, 118, 111, 105, 100, 32, 48, 41, 41, 41, 123, 10,
+114, 101, 116, 117, 114, 110, 32, 90, 59, 10, 125, 10, 118, 97, 114, 32, 97, 97,
+61, 37, 83, 116, 114, 105, 110, 103, 76, 97, 115, 116, 73, 110, 100, 101, 120,
+79, 102, 40, 90, 44, 39, 45, 39, 41, 59, 10, 105, 102, 40, 97, 97, 61, 61, 61,
+45, 49, 41, 123, 10, 98, 114, 101, 97, 107, 59, 10, 125, 10, 90, 61, 37, 95, 67,
+97, 108, 108, 40, 119, 44, 90, 44, 48, 44, 97, 97, 41, 59, 10, 125, 119, 104,
+105, 108, 101, 40, 116, 114, 117, 101, 41, 59, 10, 114, 101, 116, 117, 114, 110,
+40, 118, 111, 105, 100, 32, 48, 41, 59, 10, 125, 10, 102, 117, 110, 99, 116,
+105, 111, 110, 32, 97, 116, 116, 101, 109, 112, 116, 83, 105, 110, 103, 108,
+101, 76, 111, 111, 107, 117, 112, 40, 87, 44, 97, 106, 41, 123, 10, 118, 97,
+114, 32, 97, 107, 61, 37, 82, 101, 103, 69, 120, 112, 73, 110, 116, 101, 114,
+110, 97, 108, 82, 101, 112, 108, 97, 99, 101, 40, 10, 71, 101, 116, 65, 110,
+121, 69, 120, 116, 101, 110, 115, 105, 111, 110, 82, 69, 40, 41, 44, 97, 106,
+44, 39, 39, 41, 59, 10, 118, 97, 114, 32, 97, 108, 61, 98, 101, 115, 116, 65,
+118, 97, 105, 108, 97, 98, 108, 101, 76, 111, 99, 97, 108, 101, 40, 10, 87, 44,
+97, 106, 41, 59, 10, 105, 102, 40, 33, 40, 97, 108, 61, 61, 61, 40, 118, 111,
+105, 100, 32, 48, 41, 41, 41, 123, 10, 118, 97, 114, 32, 97, 109, 61, 37, 114,
+101, 103, 101, 120, 112, 95, 105, 110, 116, 101, 114, 110, 97, 108, 95, 109, 97,
+116, 99, 104, 40, 10, 71, 101, 116, 85, 110, 105, 99, 111, 100, 101, 69, 120,
+116, 101, 110, 115, 105, 111, 110, 82, 69, 40, 41, 44, 97, 106, 41, 59, 10, 118,
+97, 114, 32, 97, 110, 61, 40, 97, 109, 61, 61, 61, 110, 117, 108, 108, 41, 63,
+39, 39, 58, 97, 109, 91, 48, 93, 59, 10, 114, 101, 116, 117, 114, 110, 123, 108,
+111, 99, 97, 108, 101, 58, 97, 108, 44, 101, 120, 116, 101, 110, 115, 105, 111,
+110, 58, 97, 110, 125, 59, 10, 125, 10, 114, 101, 116, 117, 114, 110, 40, 118,
+111, 105, 100, 32, 48, 41, 59, 10, 125, 10, 102, 117, 110, 99, 116, 105, 111,
+110, 32, 108, 111, 111, 107, 117, 112, 77, 97, 116, 99, 104, 101, 114, 40, 84,
+44, 86, 41, 123, 10, 105, 102, 40, 40, 37, 114, 101, 103, 101, 120, 112, 95,
+105, 110, 116, 101, 114, 110, 97, 108, 95, 109, 97, 116, 99, 104, 40, 71, 101,
+116, 83, 101, 114, 118, 105, 99, 101, 82, 69, 40, 41, 44, 84, 41, 61, 61, 61,
+110, 117, 108, 108, 41, 41, 123, 10, 116, 104, 114, 111, 119, 32, 37, 109, 97,
+107, 101, 95, 101, 114, 114, 111, 114, 40, 56, 44, 84, 41, 59, 10, 125, 10, 118,
+97, 114, 32, 87, 61, 103, 101, 116, 65, 118, 97, 105, 108, 97, 98, 108, 101, 76,
+111, 99, 97, 108, 101, 115, 79, 102, 40, 84, 41, 59, 10, 102, 111, 114, 40, 118,
+97, 114, 32, 89, 61, 48, 59, 89, 60, 86, 46, 108, 101, 110, 103, 116, 104, 59,
+43, 43, 89, 41, 123, 10, 118, 97, 114, 32, 97, 111, 61, 97, 116, 116, 101, 109,
+112, 116, 83, 105, 110, 103, 108, 101, 76, 111, 111, 107, 117, 112, 40, 87, 44,
+86, 91, 89, 93, 41, 59, 10, 105, 102, 40, 33, 40, 97, 111, 61, 61, 61, 40, 118,
+111, 105, 100, 32, 48, 41, 41, 41, 123, 10, 114, 101, 116, 117, 114, 110, 32,
+97, 111, 59, 10, 125, 10, 125, 10, 118, 97, 114, 32, 97, 112, 61, 71, 101, 116,
+68, 101, 102, 97, 117, 108, 116, 73, 67, 85, 76, 111, 99, 97, 108, 101, 74, 83,
+40, 41, 59, 10, 118, 97, 114, 32, 97, 111, 61, 97, 116, 116, 101, 109, 112, 116,
+83, 105, 110, 103, 108, 101, 76, 111, 111, 107, 117, 112, 40, 87, 44, 97, 112,
+41, 59, 10, 105, 102, 40, 33, 40, 97, 111, 61, 61, 61, 40, 118, 111, 105, 100,
+32, 48, 41, 41, 41, 123, 10, 114, 101, 116, 117, 114, 110, 32, 97, 111, 59, 10,
+125, 10, 114, 101, 116, 117, 114, 110, 123, 10, 108, 111, 99, 97, 108, 101, 58,
+39, 117, 110, 100, 39, 44, 10, 101, 120, 116, 101, 110, 115, 105, 111, 110, 58,
+39, 39, 10, 125, 59, 10, 125, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 98,
+101, 115, 116, 70, 105, 116, 77, 97, 116, 99, 104, 101, 114, 40, 84, 44, 86, 41,
+123, 10, 114, 101, 116, 117, 114, 110, 32, 108, 111, 111, 107, 117, 112, 77, 97,
+116, 99, 104, 101, 114, 40, 84, 44, 86, 41, 59, 10, 125, 10, 102, 117, 110, 99,
+116, 105, 111, 110, 32, 112, 97, 114, 115, 101, 69, 120, 116, 101, 110, 115,
+105, 111, 110, 40, 97, 110, 41, 123, 10, 118, 97, 114, 32, 97, 113, 61, 37, 83,
+116, 114, 105, 110, 103, 83, 112, 108, 105, 116, 40, 97, 110, 44, 39, 45, 39,
+44, 52, 50, 57, 52, 57, 54, 55, 50, 57, 53, 41, 59, 10, 105, 102, 40, 97, 113,
+46, 108, 101, 110, 103, 116, 104, 60, 61, 50, 124, 124, 10, 40, 97, 113, 91, 48,
+93, 33, 61, 61, 39, 39, 38, 38, 97, 113, 91, 49, 93, 33, 61, 61, 39, 117, 39,
+41, 41, 123, 10, 114, 101, 116, 117, 114, 110, 123, 95, 95, 112, 114, 111, 116,
+111, 95, 95, 58, 110, 117, 108, 108, 125, 59, 10, 125, 10, 118, 97, 114, 32, 97,
+114, 61, 123, 95, 95, 112, 114, 111, 116, 111, 95, 95, 58, 110, 117, 108, 108,
+125, 59, 10, 118, 97, 114, 32, 97, 115, 61, 40, 118, 111, 105, 100, 32, 48, 41,
+59, 10, 118, 97, 114, 32, 97, 104, 61, 40, 118, 111, 105, 100, 32, 48, 41, 59,
+10, 102, 111, 114, 40, 118, 97, 114, 32, 89, 61, 50, 59, 89, 60, 97, 113, 46,
+108, 101, 110, 103, 116, 104, 59, 43, 43, 89, 41, 123, 10, 118, 97, 114, 32, 97,
+116, 61, 97, 113, 91, 89, 93, 46, 108, 101, 110, 103, 116, 104, 59, 10, 118, 97,
+114, 32, 97, 117, 61, 97, 113, 91, 89, 93, 59, 10, 105, 102, 40, 97, 116, 61,
+61, 61, 50, 41, 123, 10, 105, 102, 40, 33, 40, 97, 115, 61, 61, 61, 40, 118,
+111, 105, 100, 32, 48, 41, 41, 41, 123, 10, 105, 102, 40, 33, 40, 97, 115, 32,
+105, 110, 32, 97, 114, 41, 41, 123, 10, 97, 114, 91, 97, 115, 93, 61, 97, 104,
+59, 10, 125, 10, 97, 104, 61, 40, 118, 111, 105, 100, 32, 48, 41, 59, 10, 125,
+10, 97, 115, 61, 97, 117, 59, 10, 125, 101, 108, 115, 101, 32, 105, 102, 40, 97,
+116, 62, 61, 51, 38, 38, 97, 116, 60, 61, 56, 38, 38, 33, 40, 97, 115, 61, 61,
+61, 40, 118, 111, 105, 100, 32, 48, 41, 41, 41, 123, 10, 105, 102, 40, 40, 97,
+104, 61, 61, 61, 40, 118, 111, 105, 100, 32, 48, 41, 41, 41, 123, 10, 97, 104,
+61, 97, 117, 59, 10, 125, 101, 108, 115, 101, 123, 10, 97, 104, 61, 97, 104, 43,
+34, 45, 34, 43, 97, 117, 59, 10, 125, 10, 125, 101, 108, 115, 101, 123, 10, 114,
+101, 116, 117, 114, 110, 123, 95, 95, 112, 114, 111, 116, 111, 95, 95, 58, 110,
+117, 108, 108, 125, 59, 10, 125, 10, 125, 10, 105, 102, 40, 33, 40, 97, 115, 61,
+61, 61, 40, 118, 111, 105, 100, 32, 48, 41, 41, 38, 38, 33, 40, 97, 115, 32,
+105, 110, 32, 97, 114, 41, 41, 123, 10, 97, 114, 91, 97, 115, 93, 61, 97, 104,
+59, 10, 125, 10, 114, 101, 116, 117, 114, 110, 32, 97, 114, 59, 10, 125, 10,
+102, 117, 110, 99, 116, 105, 111, 110, 32, 115, 101, 116, 79, 112, 116, 105,
+111, 110, 115, 40, 97, 118, 44, 97, 114, 44, 97, 119, 44, 97, 99, 44, 97, 120,
+41, 123, 10, 118, 97, 114, 32, 97, 110, 61, 39, 39, 59, 10, 118, 97, 114, 32,
+97, 121, 61, 102, 117, 110, 99, 116, 105, 111, 110, 32, 117, 112, 100, 97, 116,
+101, 69, 120, 116, 101, 110, 115, 105, 111, 110, 40, 97, 115, 44, 97, 104, 41,
+123, 10, 114, 101, 116, 117, 114, 110, 39, 45, 39, 43, 97, 115, 43, 39, 45, 39,
+43, 40, 37, 95, 84, 111, 83, 116, 114, 105, 110, 103, 40, 97, 104, 41, 41, 59,
+10, 125, 10, 118, 97, 114, 32, 97, 122, 61, 102, 117, 110, 99, 116, 105, 111,
+110, 32, 117, 112, 100, 97, 116, 101, 80, 114, 111, 112, 101, 114, 116, 121, 40,
+97, 100, 44, 97, 101, 44, 97, 104, 41, 123, 10, 105, 102, 40, 97, 101, 61, 61,
+61, 39, 98, 111, 111, 108, 101, 97, 110, 39, 38, 38, 40, 116, 121, 112, 101,
+111, 102, 32, 97, 104, 61, 61, 61, 39, 115, 116, 114, 105, 110, 103, 39, 41, 41,
+123, 10, 97, 104, 61, 40, 97, 104, 61, 61, 61, 39, 116, 114, 117, 101, 39, 41,
+63, 116, 114, 117, 101, 58, 102, 97, 108, 115, 101, 59, 10, 125, 10, 105, 102,
+40, 33, 40, 97, 100, 61, 61, 61, 40, 118, 111, 105, 100, 32, 48, 41, 41, 41,
+123, 10, 100, 101, 102, 105, 110, 101, 87, 69, 80, 114, 111, 112, 101, 114, 116,
+121, 40, 97, 120, 44, 97, 100, 44, 97, 104, 41, 59, 10, 125, 10, 125, 10, 102,
+111, 114, 40, 118, 97, 114, 32, 97, 115, 32, 105, 110, 32, 97, 119, 41, 123, 10,
+105, 102, 40, 40, 37, 95, 67, 97, 108, 108, 40, 114, 44, 97, 119, 44, 97, 115,
+41, 41, 41, 123, 10, 118, 97, 114, 32, 97, 104, 61, 40, 118, 111, 105, 100, 32,
+48, 41, 59, 10, 118, 97, 114, 32, 97, 65, 61, 97, 119, 91, 97, 115, 93, 59, 10,
+105, 102, 40, 33, 40, 97, 65, 46, 112, 114, 111, 112, 101, 114, 116, 121, 61,
+61, 61, 40, 118, 111, 105, 100, 32, 48, 41, 41, 41, 123, 10, 97, 104, 61, 97,
+99, 40, 97, 65, 46, 112, 114, 111, 112, 101, 114, 116, 121, 44, 97, 65, 46, 116,
+121, 112, 101, 44, 97, 65, 46, 118, 97, 108, 117, 101, 115, 41, 59, 10, 125, 10,
+105, 102, 40, 33, 40, 97, 104, 61, 61, 61, 40, 118, 111, 105, 100, 32, 48, 41,
+41, 41, 123, 10, 97, 122, 40, 97, 65, 46, 112, 114, 111, 112, 101, 114, 116,
+121, 44, 97, 65, 46, 116, 121, 112, 101, 44, 97, 104, 41, 59, 10, 97, 110, 43,
+61, 97, 121, 40, 97, 115, 44, 97, 104, 41, 59, 10, 99, 111, 110, 116, 105, 110,
+117, 101, 59, 10, 125, 10, 105, 102, 40, 40, 37, 95, 67, 97, 108, 108, 40, 114,
+44, 97, 114, 44, 97, 115, 41, 41, 41, 123, 10, 97, 104, 61, 97, 114, 91, 97,
+115, 93, 59, 10, 105, 102, 40, 33, 40, 97, 104, 61, 61, 61, 40, 118, 111, 105,
+100, 32, 48, 41, 41, 41, 123, 10, 97, 122, 40, 97, 65, 46, 112, 114, 111, 112,
+101, 114, 116, 121, 44, 97, 65, 46, 116, 121, 112, 101, 44, 97, 104, 41, 59, 10,
+97, 110, 43, 61, 97, 121, 40, 97, 115, 44, 97, 104, 41, 59, 10, 125, 101, 108,
+115, 101, 32, 105, 102, 40, 97, 65, 46, 116, 121, 112, 101, 61, 61, 61, 39, 98,
+111, 111, 108, 101, 97, 110, 39, 41, 123, 10, 97, 122, 40, 97, 65, 46, 112, 114,
+111, 112, 101, 114, 116, 121, 44, 97, 65, 46, 116, 121, 112, 101, 44, 116, 114,
+117, 101, 41, 59, 10, 97, 110, 43, 61, 97, 121, 40, 97, 115, 44, 116, 114, 117,
+101, 41, 59, 10, 125, 10, 125, 10, 125, 10, 125, 10, 114, 101, 116, 117, 114,
+110, 32, 97, 110, 61, 61, 61, 39, 39, 63, 39, 39, 58, 39, 45, 117, 39, 43, 97,
+110, 59, 10, 125, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 102, 114, 101,
+101, 122, 101, 65, 114, 114, 97, 121, 40, 97, 66, 41, 123, 10, 118, 97, 114, 32,
+97, 67, 61, 91, 93, 59, 10, 118, 97, 114, 32, 97, 68, 61, 97, 66, 46, 108, 101,
+110, 103, 116, 104, 59, 10, 102, 111, 114, 40, 118, 97, 114, 32, 89, 61, 48, 59,
+89, 60, 97, 68, 59, 89, 43, 43, 41, 123, 10, 105, 102, 40, 89, 32, 105, 110, 32,
+97, 66, 41, 123, 10, 37, 111, 98, 106, 101, 99, 116, 95, 100, 101, 102, 105,
+110, 101, 95, 112, 114, 111, 112, 101, 114, 116, 121, 40, 97, 67, 44, 89, 44,
+123, 118, 97, 108, 117, 101, 58, 97, 66, 91, 89, 93, 44, 10, 99, 111, 110, 102,
+105, 103, 117, 114, 97, 98, 108, 101, 58, 102, 97, 108, 115, 101, 44, 10, 119,
+114, 105, 116, 97, 98, 108, 101, 58, 102, 97, 108, 115, 101, 44, 10, 101, 110,
+117, 109, 101, 114, 97, 98, 108, 101, 58, 116, 114, 117, 101, 125, 41, 59, 10,
+125, 10, 125, 10, 37, 111, 98, 106, 101, 99, 116, 95, 100, 101, 102, 105, 110,
+101, 95, 112, 114, 111, 112, 101, 114, 116, 121, 40, 97, 67, 44, 39, 108, 101,
+110, 103, 116, 104, 39, 44, 123, 118, 97, 108, 117, 101, 58, 97, 68, 44, 119,
+114, 105, 116, 97, 98, 108, 101, 58, 102, 97, 108, 115, 101, 125, 41, 59, 10,
+114, 101, 116, 117, 114, 110, 32, 97, 67, 59, 10, 125, 10, 102, 117, 110, 99,
+116, 105, 111, 110, 32, 109, 97, 107, 101, 65, 114, 114, 97, 121, 40, 97, 66,
+41, 123, 10, 118, 97, 114, 32, 97, 67, 61, 91, 93, 59, 10, 37, 77, 111, 118,
+101, 65, 114, 114, 97, 121, 67, 111, 110, 116, 101, 110, 116, 115, 40, 97, 66,
+44, 97, 67, 41, 59, 10, 114, 101, 116, 117, 114, 110, 32, 97, 67, 59, 10, 125,
+10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 103, 101, 116, 65, 118, 97, 105,
+108, 97, 98, 108, 101, 76, 111, 99, 97, 108, 101, 115, 79, 102, 40, 84, 41, 123,
+10, 105, 102, 40, 33, 40, 73, 91, 84, 93, 61, 61, 61, 40, 118, 111, 105, 100,
+32, 48, 41, 41, 41, 123, 10, 114, 101, 116, 117, 114, 110, 32, 73, 91, 84, 93,
+59, 10, 125, 10, 118, 97, 114, 32, 97, 69, 61, 37, 65, 118, 97, 105, 108, 97,
+98, 108, 101, 76, 111, 99, 97, 108, 101, 115, 79, 102, 40, 84, 41, 59, 10, 102,
+111, 114, 40, 118, 97, 114, 32, 89, 32, 105, 110, 32, 97, 69, 41, 123, 10, 105,
+102, 40, 40, 37, 95, 67, 97, 108, 108, 40, 114, 44, 97, 69, 44, 89, 41, 41, 41,
+123, 10, 118, 97, 114, 32, 97, 70, 61, 37, 114, 101, 103, 101, 120, 112, 95,
+105, 110, 116, 101, 114, 110, 97, 108, 95, 109, 97, 116, 99, 104, 40, 10, 47,
+94, 40, 91, 97, 45, 122, 93, 123, 50, 44, 51, 125, 41, 45, 40, 91, 65, 45, 90,
+93, 91, 97, 45, 122, 93, 123, 51, 125, 41, 45, 40, 91, 65, 45, 90, 93, 123, 50,
+125, 41, 36, 47, 44, 89, 41, 59, 10, 105, 102, 40, 33, 40, 97, 70, 61, 61, 61,
+110, 117, 108, 108, 41, 41, 123, 10, 97, 69, 91, 97, 70, 91, 49, 93, 43, 39, 45,
+39, 43, 97, 70, 91, 51, 93, 93, 61, 110, 117, 108, 108, 59, 10, 125, 10, 125,
+10, 125, 10, 73, 91, 84, 93, 61, 97, 69, 59, 10, 114, 101, 116, 117, 114, 110,
+32, 97, 69, 59, 10, 125, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 100,
+101, 102, 105, 110, 101, 87, 69, 80, 114, 111, 112, 101, 114, 116, 121, 40, 97,
+71, 44, 97, 100, 44, 97, 104, 41, 123, 10, 37, 111, 98, 106, 101, 99, 116, 95,
+100, 101, 102, 105, 110, 101, 95, 112, 114, 111, 112, 101, 114, 116, 121, 40,
+97, 71, 44, 97, 100, 44, 10, 123, 118, 97, 108, 117, 101, 58, 97, 104, 44, 119,
+114, 105, 116, 97, 98, 108, 101, 58, 116, 114, 117, 101, 44, 101, 110, 117, 109,
+101, 114, 97, 98, 108, 101, 58, 116, 114, 117, 101, 125, 41, 59, 10, 125, 10,
+102, 117, 110, 99, 116, 105, 111, 110, 32, 97, 100, 100, 87, 69, 80, 114, 111,
+112, 101, 114, 116, 121, 73, 102, 68, 101, 102, 105, 110, 101, 100, 40, 97, 71,
+44, 97, 100, 44, 97, 104, 41, 123, 10, 105, 102, 40, 33, 40, 97, 104, 61, 61,
+61, 40, 118, 111, 105, 100, 32, 48, 41, 41, 41, 123, 10, 100, 101, 102, 105,
+110, 101, 87, 69, 80, 114, 111, 112, 101, 114, 116, 121, 40, 97, 71, 44, 97,
+100, 44, 97, 104, 41, 59, 10, 125, 10, 125, 10, 102, 117, 110, 99, 116, 105,
+111, 110, 32, 100, 101, 102, 105, 110, 101, 87, 69, 67, 80, 114, 111, 112, 101,
+114, 116, 121, 40, 97, 71, 44, 97, 100, 44, 97, 104, 41, 123, 10, 37, 111, 98,
+106, 101, 99, 116, 95, 100, 101, 102, 105, 110, 101, 95, 112, 114, 111, 112,
+101, 114, 116, 121, 40, 97, 71, 44, 97, 100, 44, 123, 118, 97, 108, 117, 101,
+58, 97, 104, 44, 10, 119, 114, 105, 116, 97, 98, 108, 101, 58, 116, 114, 117,
+101, 44, 10, 101, 110, 117, 109, 101, 114, 97, 98, 108, 101, 58, 116, 114, 117,
+101, 44, 10, 99, 111, 110, 102, 105, 103, 117, 114, 97, 98, 108, 101, 58, 116,
+114, 117, 101, 125, 41, 59, 10, 125, 10, 102, 117, 110, 99, 116, 105, 111, 110,
+32, 97, 100, 100, 87, 69, 67, 80, 114, 111, 112, 101, 114, 116, 121, 73, 102,
+68, 101, 102, 105, 110, 101, 100, 40, 97, 71, 44, 97, 100, 44, 97, 104, 41, 123,
+10, 105, 102, 40, 33, 40, 97, 104, 61, 61, 61, 40, 118, 111, 105, 100, 32, 48,
+41, 41, 41, 123, 10, 100, 101, 102, 105, 110, 101, 87, 69, 67, 80, 114, 111,
+112, 101, 114, 116, 121, 40, 97, 71, 44, 97, 100, 44, 97, 104, 41, 59, 10, 125,
+10, 125, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 116, 111, 84, 105, 116,
+108, 101, 67, 97, 115, 101, 87, 111, 114, 100, 40, 97, 72, 41, 123, 10, 114,
+101, 116, 117, 114, 110, 32, 37, 83, 116, 114, 105, 110, 103, 84, 111, 85, 112,
+112, 101, 114, 67, 97, 115, 101, 73, 110, 116, 108, 40, 37, 95, 67, 97, 108,
+108, 40, 118, 44, 97, 72, 44, 48, 44, 49, 41, 41, 43, 10, 37, 83, 116, 114, 105,
+110, 103, 84, 111, 76, 111, 119, 101, 114, 67, 97, 115, 101, 73, 110, 116, 108,
+40, 37, 95, 67, 97, 108, 108, 40, 118, 44, 97, 72, 44, 49, 41, 41, 59, 10, 125,
+10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 116, 111, 84, 105, 116, 108, 101,
+67, 97, 115, 101, 84, 105, 109, 101, 122, 111, 110, 101, 76, 111, 99, 97, 116,
+105, 111, 110, 40, 97, 73, 41, 123, 10, 118, 97, 114, 32, 97, 74, 61, 37, 114,
+101, 103, 101, 120, 112, 95, 105, 110, 116, 101, 114, 110, 97, 108, 95, 109, 97,
+116, 99, 104, 40, 71, 101, 116, 84, 105, 109, 101, 122, 111, 110, 101, 78, 97,
+109, 101, 76, 111, 99, 97, 116, 105, 111, 110, 80, 97, 114, 116, 82, 69, 40, 41,
+44, 97, 73, 41, 10, 105, 102, 40, 40, 97, 74, 61, 61, 61, 110, 117, 108, 108,
+41, 41, 116, 104, 114, 111, 119, 32, 37, 109, 97, 107, 101, 95, 114, 97, 110,
+103, 101, 95, 101, 114, 114, 111, 114, 40, 49, 55, 50, 44, 97, 73, 41, 59, 10,
+118, 97, 114, 32, 97, 111, 61, 116, 111, 84, 105, 116, 108, 101, 67, 97, 115,
+101, 87, 111, 114, 100, 40, 97, 74, 91, 49, 93, 41, 59, 10, 105, 102, 40, 33,
+40, 97, 74, 91, 50, 93, 61, 61, 61, 40, 118, 111, 105, 100, 32, 48, 41, 41, 38,
+38, 50, 60, 97, 74, 46, 108, 101, 110, 103, 116, 104, 41, 123, 10, 118, 97, 114,
+32, 97, 75, 61, 37, 95, 67, 97, 108, 108, 40, 119, 44, 97, 74, 91, 50, 93, 44,
+48, 44, 49, 41, 59, 10, 118, 97, 114, 32, 97, 70, 61, 37, 83, 116, 114, 105,
+110, 103, 83, 112, 108, 105, 116, 40, 97, 74, 91, 50, 93, 44, 97, 75, 44, 52,
+50, 57, 52, 57, 54, 55, 50, 57, 53, 41, 59, 10, 102, 111, 114, 40, 118, 97, 114,
+32, 89, 61, 49, 59, 89, 60, 97, 70, 46, 108, 101, 110, 103, 116, 104, 59, 89,
+43, 43, 41, 123, 10, 118, 97, 114, 32, 97, 76, 61, 97, 70, 91, 89, 93, 10, 118,
+97, 114, 32, 97, 77, 61, 37, 83, 116, 114, 105, 110, 103, 84, 111, 76, 111, 119,
+101, 114, 67, 97, 115, 101, 73, 110, 116, 108, 40, 97, 76, 41, 59, 10, 97, 111,
+61, 97, 111, 43, 97, 75, 43, 10, 40, 40, 97, 77, 33, 61, 61, 39, 101, 115, 39,
+38, 38, 10, 97, 77, 33, 61, 61, 39, 111, 102, 39, 38, 38, 97, 77, 33, 61, 61,
+39, 97, 117, 39, 41, 63, 10, 116, 111, 84, 105, 116, 108, 101, 67, 97, 115, 101,
+87, 111, 114, 100, 40, 97, 76, 41, 58, 97, 77, 41, 59, 10, 125, 10, 125, 10,
+114, 101, 116, 117, 114, 110, 32, 97, 111, 59, 10, 125, 10, 102, 117, 110, 99,
+116, 105, 111, 110, 32, 99, 97, 110, 111, 110, 105, 99, 97, 108, 105, 122, 101,
+76, 97, 110, 103, 117, 97, 103, 101, 84, 97, 103, 40, 97, 78, 41, 123, 10, 105,
+102, 40, 40, 33, 40, 116, 121, 112, 101, 111, 102, 40, 97, 78, 41, 61, 61, 61,
+39, 115, 116, 114, 105, 110, 103, 39, 41, 38, 38, 33, 40, 37, 95, 73, 115, 74,
+83, 82, 101, 99, 101, 105, 118, 101, 114, 40, 97, 78, 41, 41, 41, 124, 124, 10,
+40, 97, 78, 61, 61, 61, 110, 117, 108, 108, 41, 41, 123, 10, 116, 104, 114, 111,
+119, 32, 37, 109, 97, 107, 101, 95, 116, 121, 112, 101, 95, 101, 114, 114, 111,
+114, 40, 54, 57, 41, 59, 10, 125, 10, 105, 102, 40, 40, 116, 121, 112, 101, 111,
+102, 40, 97, 78, 41, 61, 61, 61, 39, 115, 116, 114, 105, 110, 103, 39, 41, 38,
+38, 10, 33, 40, 37, 114, 101, 103, 101, 120, 112, 95, 105, 110, 116, 101, 114,
+110, 97, 108, 95, 109, 97, 116, 99, 104, 40, 47, 94, 91, 97, 45, 122, 93, 123,
+50, 44, 51, 125, 36, 47, 44, 97, 78, 41, 61, 61, 61, 110, 117, 108, 108, 41, 41,
+123, 10, 114, 101, 116, 117, 114, 110, 32, 97, 78, 59, 10, 125, 10, 118, 97,
+114, 32, 97, 79, 61, 40, 37, 95, 84, 111, 83, 116, 114, 105, 110, 103, 40, 97,
+78, 41, 41, 59, 10, 105, 102, 40, 105, 115, 83, 116, 114, 117, 99, 116, 117, 97,
+108, 108, 121, 86, 97, 108, 105, 100, 76, 97, 110, 103, 117, 97, 103, 101, 84,
+97, 103, 40, 97, 79, 41, 61, 61, 61, 102, 97, 108, 115, 101, 41, 123, 10, 116,
+104, 114, 111, 119, 32, 37, 109, 97, 107, 101, 95, 114, 97, 110, 103, 101, 95,
+101, 114, 114, 111, 114, 40, 49, 56, 53, 44, 97, 79, 41, 59, 10, 125, 10, 118,
+97, 114, 32, 97, 80, 61, 37, 67, 97, 110, 111, 110, 105, 99, 97, 108, 105, 122,
+101, 76, 97, 110, 103, 117, 97, 103, 101, 84, 97, 103, 40, 97, 79, 41, 59, 10,
+105, 102, 40, 97, 80, 61, 61, 61, 39, 105, 110, 118, 97, 108, 105, 100, 45, 116,
+97, 103, 39, 41, 123, 10, 116, 104, 114, 111, 119, 32, 37, 109, 97, 107, 101,
+95, 114, 97, 110, 103, 101, 95, 101, 114, 114, 111, 114, 40, 49, 56, 53, 44, 97,
+79, 41, 59, 10, 125, 10, 114, 101, 116, 117, 114, 110, 32, 97, 80, 59, 10, 125,
+10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 99, 97, 110, 111, 110, 105, 99,
+97, 108, 105, 122, 101, 76, 111, 99, 97, 108, 101, 76, 105, 115, 116, 40, 66,
+41, 123, 10, 118, 97, 114, 32, 97, 81, 61, 110, 101, 119, 32, 112, 40, 41, 59,
+10, 105, 102, 40, 33, 40, 66, 61, 61, 61, 40, 118, 111, 105, 100, 32, 48, 41,
+41, 41, 123, 10, 105, 102, 40, 116, 121, 112, 101, 111, 102, 32, 66, 61, 61, 61,
+39, 115, 116, 114, 105, 110, 103, 39, 41, 123, 10, 37, 95, 67, 97, 108, 108, 40,
+100, 44, 97, 81, 44, 99, 97, 110, 111, 110, 105, 99, 97, 108, 105, 122, 101, 76,
+97, 110, 103, 117, 97, 103, 101, 84, 97, 103, 40, 66, 41, 41, 59, 10, 114, 101,
+116, 117, 114, 110, 32, 97, 81, 59, 10, 125, 10, 118, 97, 114, 32, 97, 82, 61,
+40, 37, 95, 84, 111, 79, 98, 106, 101, 99, 116, 40, 66, 41, 41, 59, 10, 118, 97,
+114, 32, 97, 83, 61, 40, 37, 95, 84, 111, 76, 101, 110, 103, 116, 104, 40, 97,
+82, 46, 108, 101, 110, 103, 116, 104, 41, 41, 59, 10, 102, 111, 114, 40, 118,
+97, 114, 32, 97, 84, 61, 48, 59, 97, 84, 60, 97, 83, 59, 97, 84, 43, 43, 41,
+123, 10, 105, 102, 40, 97, 84, 32, 105, 110, 32, 97, 82, 41, 123, 10, 118, 97,
+114, 32, 97, 104, 61, 97, 82, 91, 97, 84, 93, 59, 10, 118, 97, 114, 32, 97, 80,
+61, 99, 97, 110, 111, 110, 105, 99, 97, 108, 105, 122, 101, 76, 97, 110, 103,
+117, 97, 103, 101, 84, 97, 103, 40, 97, 104, 41, 59, 10, 105, 102, 40, 37, 65,
+114, 114, 97, 121, 73, 110, 100, 101, 120, 79, 102, 40, 97, 81, 44, 97, 80, 44,
+48, 41, 61, 61, 61, 45, 49, 41, 123, 10, 37, 95, 67, 97, 108, 108, 40, 100, 44,
+97, 81, 44, 97, 80, 41, 59, 10, 125, 10, 125, 10, 125, 10, 125, 10, 114, 101,
+116, 117, 114, 110, 32, 97, 81, 59, 10, 125, 10, 102, 117, 110, 99, 116, 105,
+111, 110, 32, 105, 110, 105, 116, 105, 97, 108, 105, 122, 101, 76, 111, 99, 97,
+108, 101, 76, 105, 115, 116, 40, 66, 41, 123, 10, 114, 101, 116, 117, 114, 110,
+32, 102, 114, 101, 101, 122, 101, 65, 114, 114, 97, 121, 40, 99, 97, 110, 111,
+110, 105, 99, 97, 108, 105, 122, 101, 76, 111, 99, 97, 108, 101, 76, 105, 115,
+116, 40, 66, 41, 41, 59, 10, 125, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32,
+105, 115, 83, 116, 114, 117, 99, 116, 117, 97, 108, 108, 121, 86, 97, 108, 105,
+100, 76, 97, 110, 103, 117, 97, 103, 101, 84, 97, 103, 40, 90, 41, 123, 10, 105,
+102, 40, 40, 37, 114, 101, 103, 101, 120, 112, 95, 105, 110, 116, 101, 114, 110,
+97, 108, 95, 109, 97, 116, 99, 104, 40, 71, 101, 116, 76, 97, 110, 103, 117, 97,
+103, 101, 84, 97, 103, 82, 69, 40, 41, 44, 90, 41, 61, 61, 61, 110, 117, 108,
+108, 41, 41, 123, 10, 114, 101, 116, 117, 114, 110, 32, 102, 97, 108, 115, 101,
+59, 10, 125, 10, 90, 61, 37, 83, 116, 114, 105, 110, 103, 84, 111, 76, 111, 119,
+101, 114, 67, 97, 115, 101, 73, 110, 116, 108, 40, 90, 41, 59, 10, 105, 102, 40,
+37, 83, 116, 114, 105, 110, 103, 73, 110, 100, 101, 120, 79, 102, 40, 90, 44,
+39, 120, 45, 39, 44, 48, 41, 61, 61, 61, 48, 41, 123, 10, 114, 101, 116, 117,
+114, 110, 32, 116, 114, 117, 101, 59, 10, 125, 10, 90, 61, 37, 83, 116, 114,
+105, 110, 103, 83, 112, 108, 105, 116, 40, 90, 44, 39, 45, 120, 45, 39, 44, 52,
+50, 57, 52, 57, 54, 55, 50, 57, 53, 41, 91, 48, 93, 59, 10, 118, 97, 114, 32,
+97, 85, 61, 110, 101, 119, 32, 112, 40, 41, 59, 10, 118, 97, 114, 32, 97, 86,
+61, 110, 101, 119, 32, 112, 40, 41, 59, 10, 118, 97, 114, 32, 97, 70, 61, 37,
+83, 116, 114, 105, 110, 103, 83, 112, 108, 105, 116, 40, 90, 44, 39, 45, 39, 44,
+52, 50, 57, 52, 57, 54, 55, 50, 57, 53, 41, 59, 10, 102, 111, 114, 40, 118, 97,
+114, 32, 89, 61, 49, 59, 89, 60, 97, 70, 46, 108, 101, 110, 103, 116, 104, 59,
+89, 43, 43, 41, 123, 10, 118, 97, 114, 32, 97, 104, 61, 97, 70, 91, 89, 93, 59,
+10, 105, 102, 40, 33, 40, 37, 114, 101, 103, 101, 120, 112, 95, 105, 110, 116,
+101, 114, 110, 97, 108, 95, 109, 97, 116, 99, 104, 40, 71, 101, 116, 76, 97,
+110, 103, 117, 97, 103, 101, 86, 97, 114, 105, 97, 110, 116, 82, 69, 40, 41, 44,
+97, 104, 41, 61, 61, 61, 110, 117, 108, 108, 41, 38, 38, 10, 97, 86, 46, 108,
+101, 110, 103, 116, 104, 61, 61, 61, 48, 41, 123, 10, 105, 102, 40, 37, 65, 114,
+114, 97, 121, 73, 110, 100, 101, 120, 79, 102, 40, 97, 85, 44, 97, 104, 44, 48,
+41, 61, 61, 61, 45, 49, 41, 123, 10, 37, 95, 67, 97, 108, 108, 40, 100, 44, 97,
+85, 44, 97, 104, 41, 59, 10, 125, 101, 108, 115, 101, 123, 10, 114, 101, 116,
+117, 114, 110, 32, 102, 97, 108, 115, 101, 59, 10, 125, 10, 125, 10, 105, 102,
+40, 33, 40, 37, 114, 101, 103, 101, 120, 112, 95, 105, 110, 116, 101, 114, 110,
+97, 108, 95, 109, 97, 116, 99, 104, 40, 71, 101, 116, 76, 97, 110, 103, 117, 97,
+103, 101, 83, 105, 110, 103, 108, 101, 116, 111, 110, 82, 69, 40, 41, 44, 97,
+104, 41, 61, 61, 61, 110, 117, 108, 108, 41, 41, 123, 10, 105, 102, 40, 37, 65,
+114, 114, 97, 121, 73, 110, 100, 101, 120, 79, 102, 40, 97, 86, 44, 97, 104, 44,
+48, 41, 61, 61, 61, 45, 49, 41, 123, 10, 37, 95, 67, 97, 108, 108, 40, 100, 44,
+97, 86, 44, 97, 104, 41, 59, 10, 125, 101, 108, 115, 101, 123, 10, 114, 101,
+116, 117, 114, 110, 32, 102, 97, 108, 115, 101, 59, 10, 125, 10, 125, 10, 125,
+10, 114, 101, 116, 117, 114, 110, 32, 116, 114, 117, 101, 59, 10, 125, 10, 102,
+117, 110, 99, 116, 105, 111, 110, 32, 66, 117, 105, 108, 100, 76, 97, 110, 103,
+117, 97, 103, 101, 84, 97, 103, 82, 69, 115, 40, 41, 123, 10, 118, 97, 114, 32,
+97, 87, 61, 39, 91, 97, 45, 122, 65, 45, 90, 93, 39, 59, 10, 118, 97, 114, 32,
+97, 88, 61, 39, 91, 48, 45, 57, 93, 39, 59, 10, 118, 97, 114, 32, 97, 89, 61,
+39, 40, 39, 43, 97, 87, 43, 39, 124, 39, 43, 97, 88, 43, 39, 41, 39, 59, 10,
+118, 97, 114, 32, 97, 90, 61, 39, 40, 97, 114, 116, 45, 108, 111, 106, 98, 97,
+110, 124, 99, 101, 108, 45, 103, 97, 117, 108, 105, 115, 104, 124, 110, 111, 45,
+98, 111, 107, 124, 110, 111, 45, 110, 121, 110, 124, 122, 104, 45, 103, 117,
+111, 121, 117, 124, 122, 104, 45, 104, 97, 107, 107, 97, 124, 39, 43, 10, 39,
+122, 104, 45, 109, 105, 110, 124, 122, 104, 45, 109, 105, 110, 45, 110, 97, 110,
+124, 122, 104, 45, 120, 105, 97, 110, 103, 41, 39, 59, 10, 118, 97, 114, 32, 98,
+97, 61, 39, 40, 101, 110, 45, 71, 66, 45, 111, 101, 100, 124, 105, 45, 97, 109,
+105, 124, 105, 45, 98, 110, 110, 124, 105, 45, 100, 101, 102, 97, 117, 108, 116,
+124, 105, 45, 101, 110, 111, 99, 104, 105, 97, 110, 124, 105, 45, 104, 97, 107,
+124, 39, 43, 10, 39, 105, 45, 107, 108, 105, 110, 103, 111, 110, 124, 105, 45,
+108, 117, 120, 124, 105, 45, 109, 105, 110, 103, 111, 124, 105, 45, 110, 97,
+118, 97, 106, 111, 124, 105, 45, 112, 119, 110, 124, 105, 45, 116, 97, 111, 124,
+105, 45, 116, 97, 121, 124, 39, 43, 10, 39, 105, 45, 116, 115, 117, 124, 115,
+103, 110, 45, 66, 69, 45, 70, 82, 124, 115, 103, 110, 45, 66, 69, 45, 78, 76,
+124, 115, 103, 110, 45, 67, 72, 45, 68, 69, 41, 39, 59, 10, 118, 97, 114, 32,
+98, 98, 61, 39, 40, 39, 43, 98, 97, 43, 39, 124, 39, 43, 97, 90, 43, 39, 41, 39,
+59, 10, 118, 97, 114, 32, 98, 99, 61, 39, 40, 120, 40, 45, 39, 43, 97, 89, 43,
+39, 123, 49, 44, 56, 125, 41, 43, 41, 39, 59, 10, 118, 97, 114, 32, 98, 100, 61,
+39, 40, 39, 43, 97, 88, 43, 39, 124, 91, 65, 45, 87, 89, 45, 90, 97, 45, 119,
+121, 45, 122, 93, 41, 39, 59, 10, 81, 61, 110, 101, 119, 32, 109, 40, 39, 94,
+39, 43, 98, 100, 43, 39, 36, 39, 44, 39, 105, 39, 41, 59, 10, 118, 97, 114, 32,
+97, 110, 61, 39, 40, 39, 43, 98, 100, 43, 39, 40, 45, 39, 43, 97, 89, 43, 39,
+123, 50, 44, 56, 125, 41, 43, 41, 39, 59, 10, 118, 97, 114, 32, 98, 101, 61, 39,
+40, 39, 43, 97, 89, 43, 39, 123, 53, 44, 56, 125, 124, 40, 39, 43, 97, 88, 43,
+97, 89, 43, 39, 123, 51, 125, 41, 41, 39, 59, 10, 80, 61, 110, 101, 119, 32,
+109, 40, 39, 94, 39, 43, 98, 101, 43, 39, 36, 39, 44, 39, 105, 39, 41, 59, 10,
+118, 97, 114, 32, 98, 102, 61, 39, 40, 39, 43, 97, 87, 43, 39, 123, 50, 125,
+124, 39, 43, 97, 88, 43, 39, 123, 51, 125, 41, 39, 59, 10, 118, 97, 114, 32, 98,
+103, 61, 39, 40, 39, 43, 97, 87, 43, 39, 123, 52, 125, 41, 39, 59, 10, 118, 97,
+114, 32, 98, 104, 61, 39, 40, 39, 43, 97, 87, 43, 39, 123, 51, 125, 40, 45, 39,
+43, 97, 87, 43, 39, 123, 51, 125, 41, 123, 48, 44, 50, 125, 41, 39, 59, 10, 118,
+97, 114, 32, 98, 105, 61, 39, 40, 39, 43, 97, 87, 43, 39, 123, 50, 44, 51, 125,
+40, 45, 39, 43, 98, 104, 43, 39, 41, 63, 124, 39, 43, 97, 87, 43, 39, 123, 52,
+125, 124, 39, 43, 10, 97, 87, 43, 39, 123, 53, 44, 56, 125, 41, 39, 59, 10, 118,
+97, 114, 32, 98, 106, 61, 98, 105, 43, 39, 40, 45, 39, 43, 98, 103, 43, 39, 41,
+63, 40, 45, 39, 43, 98, 102, 43, 39, 41, 63, 40, 45, 39, 43, 10, 98, 101, 43,
+39, 41, 42, 40, 45, 39, 43, 97, 110, 43, 39, 41, 42, 40, 45, 39, 43, 98, 99, 43,
+39, 41, 63, 39, 59, 10, 118, 97, 114, 32, 98, 107, 61, 10, 39, 94, 40, 39, 43,
+98, 106, 43, 39, 124, 39, 43, 98, 99, 43, 39, 124, 39, 43, 98, 98, 43, 39, 41,
+36, 39, 59, 10, 79, 61, 110, 101, 119, 32, 109, 40, 98, 107, 44, 39, 105, 39,
+41, 59, 10, 125, 10, 37, 68, 101, 102, 105, 110, 101, 77, 101, 116, 104, 111,
+100, 115, 73, 110, 116, 101, 114, 110, 97, 108, 40, 102, 44, 99, 108, 97, 115,
+115, 123, 103, 101, 116, 67, 97, 110, 111, 110, 105, 99, 97, 108, 76, 111, 99,
+97, 108, 101, 115, 40, 66, 41, 123, 10, 114, 101, 116, 117, 114, 110, 32, 109,
+97, 107, 101, 65, 114, 114, 97, 121, 40, 99, 97, 110, 111, 110, 105, 99, 97,
+108, 105, 122, 101, 76, 111, 99, 97, 108, 101, 76, 105, 115, 116, 40, 66, 41,
+41, 59, 10, 125, 125, 44, 45, 49, 41, 59, 10, 102, 117, 110, 99, 116, 105, 111,
+110, 32, 67, 114, 101, 97, 116, 101, 67, 111, 108, 108, 97, 116, 111, 114, 40,
+66, 44, 67, 41, 123, 10, 105, 102, 40, 40, 67, 61, 61, 61, 40, 118, 111, 105,
+100, 32, 48, 41, 41, 41, 123, 10, 67, 61, 123, 95, 95, 112, 114, 111, 116, 111,
+95, 95, 58, 110, 117, 108, 108, 125, 59, 10, 125, 10, 118, 97, 114, 32, 97, 99,
+61, 103, 101, 116, 71, 101, 116, 79, 112, 116, 105, 111, 110, 40, 67, 44, 39,
+99, 111, 108, 108, 97, 116, 111, 114, 39, 41, 59, 10, 118, 97, 114, 32, 98, 108,
+61, 123, 95, 95, 112, 114, 111, 116, 111, 95, 95, 58, 110, 117, 108, 108, 125,
+59, 10, 100, 101, 102, 105, 110, 101, 87, 69, 80, 114, 111, 112, 101, 114, 116,
+121, 40, 98, 108, 44, 39, 117, 115, 97, 103, 101, 39, 44, 97, 99, 40, 10, 39,
+117, 115, 97, 103, 101, 39, 44, 39, 115, 116, 114, 105, 110, 103, 39, 44, 91,
+39, 115, 111, 114, 116, 39, 44, 39, 115, 101, 97, 114, 99, 104, 39, 93, 44, 39,
+115, 111, 114, 116, 39, 41, 41, 59, 10, 118, 97, 114, 32, 98, 109, 61, 97, 99,
+40, 39, 115, 101, 110, 115, 105, 116, 105, 118, 105, 116, 121, 39, 44, 39, 115,
+116, 114, 105, 110, 103, 39, 44, 10, 91, 39, 98, 97, 115, 101, 39, 44, 39, 97,
+99, 99, 101, 110, 116, 39, 44, 39, 99, 97, 115, 101, 39, 44, 39, 118, 97, 114,
+105, 97, 110, 116, 39, 93, 41, 59, 10, 105, 102, 40, 40, 98, 109, 61, 61, 61,
+40, 118, 111, 105, 100, 32, 48, 41, 41, 38, 38, 98, 108, 46, 117, 115, 97, 103,
+101, 61, 61, 61, 39, 115, 111, 114, 116, 39, 41, 123, 10, 98, 109, 61, 39, 118,
+97, 114, 105, 97, 110, 116, 39, 59, 10, 125, 10, 100, 101, 102, 105, 110, 101,
+87, 69, 80, 114, 111, 112, 101, 114, 116, 121, 40, 98, 108, 44, 39, 115, 101,
+110, 115, 105, 116, 105, 118, 105, 116, 121, 39, 44, 98, 109, 41, 59, 10, 100,
+101, 102, 105, 110, 101, 87, 69, 80, 114, 111, 112, 101, 114, 116, 121, 40, 98,
+108, 44, 39, 105, 103, 110, 111, 114, 101, 80, 117, 110, 99, 116, 117, 97, 116,
+105, 111, 110, 39, 44, 97, 99, 40, 10, 39, 105, 103, 110, 111, 114, 101, 80,
+117, 110, 99, 116, 117, 97, 116, 105, 111, 110, 39, 44, 39, 98, 111, 111, 108,
+101, 97, 110, 39, 44, 40, 118, 111, 105, 100, 32, 48, 41, 44, 102, 97, 108, 115,
+101, 41, 41, 59, 10, 118, 97, 114, 32, 90, 61, 114, 101, 115, 111, 108, 118,
+101, 76, 111, 99, 97, 108, 101, 40, 39, 99, 111, 108, 108, 97, 116, 111, 114,
+39, 44, 66, 44, 67, 41, 59, 10, 118, 97, 114, 32, 97, 114, 61, 112, 97, 114,
+115, 101, 69, 120, 116, 101, 110, 115, 105, 111, 110, 40, 90, 46, 101, 120, 116,
+101, 110, 115, 105, 111, 110, 41, 59, 10, 118, 97, 114, 32, 98, 110, 61, 123,
+10, 39, 107, 110, 39, 58, 123, 39, 112, 114, 111, 112, 101, 114, 116, 121, 39,
+58, 39, 110, 117, 109, 101, 114, 105, 99, 39, 44, 39, 116, 121, 112, 101, 39,
+58, 39, 98, 111, 111, 108, 101, 97, 110, 39, 125, 44, 10, 39, 107, 102, 39, 58,
+123, 39, 112, 114, 111, 112, 101, 114, 116, 121, 39, 58, 39, 99, 97, 115, 101,
+70, 105, 114, 115, 116, 39, 44, 39, 116, 121, 112, 101, 39, 58, 39, 115, 116,
+114, 105, 110, 103, 39, 44, 10, 39, 118, 97, 108, 117, 101, 115, 39, 58, 91, 39,
+102, 97, 108, 115, 101, 39, 44, 39, 108, 111, 119, 101, 114, 39, 44, 39, 117,
+112, 112, 101, 114, 39, 93, 125, 10, 125, 59, 10, 115, 101, 116, 79, 112, 116,
+105, 111, 110, 115, 40, 10, 67, 44, 97, 114, 44, 98, 110, 44, 97, 99, 44, 98,
+108, 41, 59, 10, 118, 97, 114, 32, 98, 111, 61, 39, 100, 101, 102, 97, 117, 108,
+116, 39, 59, 10, 118, 97, 114, 32, 97, 110, 61, 39, 39, 59, 10, 105, 102, 40,
+40, 37, 95, 67, 97, 108, 108, 40, 114, 44, 97, 114, 44, 39, 99, 111, 39, 41, 41,
+38, 38, 98, 108, 46, 117, 115, 97, 103, 101, 61, 61, 61, 39, 115, 111, 114, 116,
+39, 41, 123, 10, 118, 97, 114, 32, 98, 112, 61, 91, 10, 39, 98, 105, 103, 53,
+104, 97, 110, 39, 44, 39, 100, 105, 99, 116, 39, 44, 39, 100, 105, 114, 101, 99,
+116, 39, 44, 39, 100, 117, 99, 101, 116, 39, 44, 39, 103, 98, 50, 51, 49, 50,
+39, 44, 39, 112, 104, 111, 110, 101, 98, 107, 39, 44, 39, 112, 104, 111, 110,
+101, 116, 105, 99, 39, 44, 10, 39, 112, 105, 110, 121, 105, 110, 39, 44, 39,
+114, 101, 102, 111, 114, 109, 101, 100, 39, 44, 39, 115, 101, 97, 114, 99, 104,
+106, 108, 39, 44, 39, 115, 116, 114, 111, 107, 101, 39, 44, 39, 116, 114, 97,
+100, 39, 44, 39, 117, 110, 105, 104, 97, 110, 39, 44, 39, 122, 104, 117, 121,
+105, 110, 39, 10, 93, 59, 10, 105, 102, 40, 37, 65, 114, 114, 97, 121, 73, 110,
+100, 101, 120, 79, 102, 40, 98, 112, 44, 97, 114, 46, 99, 111, 44, 48, 41, 33,
+61, 61, 45, 49, 41, 123, 10, 97, 110, 61, 39, 45, 117, 45, 99, 111, 45, 39, 43,
+97, 114, 46, 99, 111, 59, 10, 98, 111, 61, 97, 114, 46, 99, 111, 59, 10, 125,
+10, 125, 101, 108, 115, 101, 32, 105, 102, 40, 98, 108, 46, 117, 115, 97, 103,
+101, 61, 61, 61, 39, 115, 101, 97, 114, 99, 104, 39, 41, 123, 10, 97, 110, 61,
+39, 45, 117, 45, 99, 111, 45, 115, 101, 97, 114, 99, 104, 39, 59, 10, 125, 10,
+100, 101, 102, 105, 110, 101, 87, 69, 80, 114, 111, 112, 101, 114, 116, 121, 40,
+98, 108, 44, 39, 99, 111, 108, 108, 97, 116, 105, 111, 110, 39, 44, 98, 111, 41,
+59, 10, 118, 97, 114, 32, 97, 106, 61, 90, 46, 108, 111, 99, 97, 108, 101, 43,
+97, 110, 59, 10, 118, 97, 114, 32, 97, 105, 61, 37, 111, 98, 106, 101, 99, 116,
+95, 100, 101, 102, 105, 110, 101, 95, 112, 114, 111, 112, 101, 114, 116, 105,
+101, 115, 40, 123, 95, 95, 112, 114, 111, 116, 111, 95, 95, 58, 110, 117, 108,
+108, 125, 44, 123, 10, 99, 97, 115, 101, 70, 105, 114, 115, 116, 58, 123, 119,
+114, 105, 116, 97, 98, 108, 101, 58, 116, 114, 117, 101, 125, 44, 10, 99, 111,
+108, 108, 97, 116, 105, 111, 110, 58, 123, 118, 97, 108, 117, 101, 58, 98, 108,
+46, 99, 111, 108, 108, 97, 116, 105, 111, 110, 44, 119, 114, 105, 116, 97, 98,
+108, 101, 58, 116, 114, 117, 101, 125, 44, 10, 105, 103, 110, 111, 114, 101, 80,
+117, 110, 99, 116, 117, 97, 116, 105, 111, 110, 58, 123, 119, 114, 105, 116, 97,
+98, 108, 101, 58, 116, 114, 117, 101, 125, 44, 10, 108, 111, 99, 97, 108, 101,
+58, 123, 119, 114, 105, 116, 97, 98, 108, 101, 58, 116, 114, 117, 101, 125, 44,
+10, 110, 117, 109, 101, 114, 105, 99, 58, 123, 119, 114, 105, 116, 97, 98, 108,
+101, 58, 116, 114, 117, 101, 125, 44, 10, 114, 101, 113, 117, 101, 115, 116,
+101, 100, 76, 111, 99, 97, 108, 101, 58, 123, 118, 97, 108, 117, 101, 58, 97,
+106, 44, 119, 114, 105, 116, 97, 98, 108, 101, 58, 116, 114, 117, 101, 125, 44,
+10, 115, 101, 110, 115, 105, 116, 105, 118, 105, 116, 121, 58, 123, 119, 114,
+105, 116, 97, 98, 108, 101, 58, 116, 114, 117, 101, 125, 44, 10, 115, 116, 114,
+101, 110, 103, 116, 104, 58, 123, 119, 114, 105, 116, 97, 98, 108, 101, 58, 116,
+114, 117, 101, 125, 44, 10, 117, 115, 97, 103, 101, 58, 123, 118, 97, 108, 117,
+101, 58, 98, 108, 46, 117, 115, 97, 103, 101, 44, 119, 114, 105, 116, 97, 98,
+108, 101, 58, 116, 114, 117, 101, 125, 10, 125, 41, 59, 10, 118, 97, 114, 32,
+98, 113, 61, 37, 67, 114, 101, 97, 116, 101, 67, 111, 108, 108, 97, 116, 111,
+114, 40, 97, 106, 44, 98, 108, 44, 97, 105, 41, 59, 10, 37, 77, 97, 114, 107,
+65, 115, 73, 110, 105, 116, 105, 97, 108, 105, 122, 101, 100, 73, 110, 116, 108,
+79, 98, 106, 101, 99, 116, 79, 102, 84, 121, 112, 101, 40, 98, 113, 44, 39, 99,
+111, 108, 108, 97, 116, 111, 114, 39, 41, 59, 10, 98, 113, 91, 117, 93, 61, 97,
+105, 59, 10, 114, 101, 116, 117, 114, 110, 32, 98, 113, 59, 10, 125, 10, 102,
+117, 110, 99, 116, 105, 111, 110, 32, 67, 111, 108, 108, 97, 116, 111, 114, 67,
+111, 110, 115, 116, 114, 117, 99, 116, 111, 114, 40, 41, 123, 10, 114, 101, 116,
+117, 114, 110, 32, 73, 110, 116, 108, 67, 111, 110, 115, 116, 114, 117, 99, 116,
+40, 116, 104, 105, 115, 44, 105, 44, 67, 114, 101, 97, 116, 101, 67, 111, 108,
+108, 97, 116, 111, 114, 44, 110, 101, 119, 46, 116, 97, 114, 103, 101, 116, 44,
+10, 97, 114, 103, 117, 109, 101, 110, 116, 115, 41, 59, 10, 125, 10, 37, 83,
+101, 116, 67, 111, 100, 101, 40, 105, 44, 67, 111, 108, 108, 97, 116, 111, 114,
+67, 111, 110, 115, 116, 114, 117, 99, 116, 111, 114, 41, 59, 10, 37, 68, 101,
+102, 105, 110, 101, 77, 101, 116, 104, 111, 100, 115, 73, 110, 116, 101, 114,
+110, 97, 108, 40, 105, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 44, 99,
+108, 97, 115, 115, 123, 114, 101, 115, 111, 108, 118, 101, 100, 79, 112, 116,
+105, 111, 110, 115, 40, 41, 123, 10, 118, 97, 114, 32, 98, 114, 61, 85, 110,
+119, 114, 97, 112, 40, 116, 104, 105, 115, 44, 39, 99, 111, 108, 108, 97, 116,
+111, 114, 39, 44, 105, 44, 39, 114, 101, 115, 111, 108, 118, 101, 100, 79, 112,
+116, 105, 111, 110, 115, 39, 44, 10, 102, 97, 108, 115, 101, 41, 59, 10, 114,
+101, 116, 117, 114, 110, 123, 10, 108, 111, 99, 97, 108, 101, 58, 98, 114, 91,
+117, 93, 46, 108, 111, 99, 97, 108, 101, 44, 10, 117, 115, 97, 103, 101, 58, 98,
+114, 91, 117, 93, 46, 117, 115, 97, 103, 101, 44, 10, 115, 101, 110, 115, 105,
+116, 105, 118, 105, 116, 121, 58, 98, 114, 91, 117, 93, 46, 115, 101, 110, 115,
+105, 116, 105, 118, 105, 116, 121, 44, 10, 105, 103, 110, 111, 114, 101, 80,
+117, 110, 99, 116, 117, 97, 116, 105, 111, 110, 58, 98, 114, 91, 117, 93, 46,
+105, 103, 110, 111, 114, 101, 80, 117, 110, 99, 116, 117, 97, 116, 105, 111,
+110, 44, 10, 110, 117, 109, 101, 114, 105, 99, 58, 98, 114, 91, 117, 93, 46,
+110, 117, 109, 101, 114, 105, 99, 44, 10, 99, 97, 115, 101, 70, 105, 114, 115,
+116, 58, 98, 114, 91, 117, 93, 46, 99, 97, 115, 101, 70, 105, 114, 115, 116, 44,
+10, 99, 111, 108, 108, 97, 116, 105, 111, 110, 58, 98, 114, 91, 117, 93, 46, 99,
+111, 108, 108, 97, 116, 105, 111, 110, 10, 125, 59, 10, 125, 125, 44, 45, 49,
+41, 59, 10, 37, 68, 101, 102, 105, 110, 101, 77, 101, 116, 104, 111, 100, 115,
+73, 110, 116, 101, 114, 110, 97, 108, 40, 105, 44, 99, 108, 97, 115, 115, 123,
+115, 117, 112, 112, 111, 114, 116, 101, 100, 76, 111, 99, 97, 108, 101, 115, 79,
+102, 40, 66, 41, 123, 10, 114, 101, 116, 117, 114, 110, 32, 115, 117, 112, 112,
+111, 114, 116, 101, 100, 76, 111, 99, 97, 108, 101, 115, 79, 102, 40, 39, 99,
+111, 108, 108, 97, 116, 111, 114, 39, 44, 66, 44, 97, 114, 103, 117, 109, 101,
+110, 116, 115, 91, 49, 93, 41, 59, 10, 125, 125, 44, 45, 49, 41, 59, 10, 102,
+117, 110, 99, 116, 105, 111, 110, 32, 99, 111, 109, 112, 97, 114, 101, 40, 98,
+113, 44, 98, 115, 44, 98, 116, 41, 123, 10, 114, 101, 116, 117, 114, 110, 32,
+37, 73, 110, 116, 101, 114, 110, 97, 108, 67, 111, 109, 112, 97, 114, 101, 40,
+98, 113, 44, 40, 37, 95, 84, 111, 83, 116, 114, 105, 110, 103, 40, 98, 115, 41,
+41, 44, 40, 37, 95, 84, 111, 83, 116, 114, 105, 110, 103, 40, 98, 116, 41, 41,
+41, 59, 10, 125, 59, 10, 65, 100, 100, 66, 111, 117, 110, 100, 77, 101, 116,
+104, 111, 100, 40, 105, 44, 39, 99, 111, 109, 112, 97, 114, 101, 39, 44, 99,
+111, 109, 112, 97, 114, 101, 44, 50, 44, 39, 99, 111, 108, 108, 97, 116, 111,
+114, 39, 44, 102, 97, 108, 115, 101, 41, 59, 10, 102, 117, 110, 99, 116, 105,
+111, 110, 32, 80, 108, 117, 114, 97, 108, 82, 117, 108, 101, 115, 67, 111, 110,
+115, 116, 114, 117, 99, 116, 111, 114, 40, 41, 123, 10, 105, 102, 40, 40, 110,
+101, 119, 46, 116, 97, 114, 103, 101, 116, 61, 61, 61, 40, 118, 111, 105, 100,
+32, 48, 41, 41, 41, 123, 10, 116, 104, 114, 111, 119, 32, 37, 109, 97, 107, 101,
+95, 116, 121, 112, 101, 95, 101, 114, 114, 111, 114, 40, 52, 48, 44, 34, 80,
+108, 117, 114, 97, 108, 82, 117, 108, 101, 115, 34, 41, 59, 10, 125, 10, 118,
+97, 114, 32, 66, 61, 97, 114, 103, 117, 109, 101, 110, 116, 115, 91, 48, 93, 59,
+10, 118, 97, 114, 32, 67, 61, 97, 114, 103, 117, 109, 101, 110, 116, 115, 91,
+49, 93, 59, 10, 105, 102, 40, 40, 67, 61, 61, 61, 40, 118, 111, 105, 100, 32,
+48, 41, 41, 41, 123, 10, 67, 61, 123, 95, 95, 112, 114, 111, 116, 111, 95, 95,
+58, 110, 117, 108, 108, 125, 59, 10, 125, 10, 118, 97, 114, 32, 97, 99, 61, 103,
+101, 116, 71, 101, 116, 79, 112, 116, 105, 111, 110, 40, 67, 44, 39, 112, 108,
+117, 114, 97, 108, 114, 117, 108, 101, 115, 39, 41, 59, 10, 118, 97, 114, 32,
+90, 61, 114, 101, 115, 111, 108, 118, 101, 76, 111, 99, 97, 108, 101, 40, 39,
+112, 108, 117, 114, 97, 108, 114, 117, 108, 101, 115, 39, 44, 66, 44, 67, 41,
+59, 10, 118, 97, 114, 32, 98, 108, 61, 123, 95, 95, 112, 114, 111, 116, 111, 95,
+95, 58, 110, 117, 108, 108, 125, 59, 10, 100, 101, 102, 105, 110, 101, 87, 69,
+80, 114, 111, 112, 101, 114, 116, 121, 40, 98, 108, 44, 39, 116, 121, 112, 101,
+39, 44, 97, 99, 40, 10, 39, 116, 121, 112, 101, 39, 44, 39, 115, 116, 114, 105,
+110, 103, 39, 44, 91, 39, 99, 97, 114, 100, 105, 110, 97, 108, 39, 44, 39, 111,
+114, 100, 105, 110, 97, 108, 39, 93, 44, 39, 99, 97, 114, 100, 105, 110, 97,
+108, 39, 41, 41, 59, 10, 83, 101, 116, 78, 117, 109, 98, 101, 114, 70, 111, 114,
+109, 97, 116, 68, 105, 103, 105, 116, 79, 112, 116, 105, 111, 110, 115, 40, 98,
+108, 44, 67, 44, 48, 44, 51, 41, 59, 10, 118, 97, 114, 32, 97, 106, 61, 90, 46,
+108, 111, 99, 97, 108, 101, 59, 10, 118, 97, 114, 32, 97, 105, 61, 37, 111, 98,
+106, 101, 99, 116, 95, 100, 101, 102, 105, 110, 101, 95, 112, 114, 111, 112,
+101, 114, 116, 105, 101, 115, 40, 123, 95, 95, 112, 114, 111, 116, 111, 95, 95,
+58, 110, 117, 108, 108, 125, 44, 123, 10, 116, 121, 112, 101, 58, 123, 118, 97,
+108, 117, 101, 58, 98, 108, 46, 116, 121, 112, 101, 44, 119, 114, 105, 116, 97,
+98, 108, 101, 58, 116, 114, 117, 101, 125, 44, 10, 108, 111, 99, 97, 108, 101,
+58, 123, 119, 114, 105, 116, 97, 98, 108, 101, 58, 116, 114, 117, 101, 125, 44,
+10, 109, 97, 120, 105, 109, 117, 109, 70, 114, 97, 99, 116, 105, 111, 110, 68,
+105, 103, 105, 116, 115, 58, 123, 119, 114, 105, 116, 97, 98, 108, 101, 58, 116,
+114, 117, 101, 125, 44, 10, 109, 105, 110, 105, 109, 117, 109, 70, 114, 97, 99,
+116, 105, 111, 110, 68, 105, 103, 105, 116, 115, 58, 123, 119, 114, 105, 116,
+97, 98, 108, 101, 58, 116, 114, 117, 101, 125, 44, 10, 109, 105, 110, 105, 109,
+117, 109, 73, 110, 116, 101, 103, 101, 114, 68, 105, 103, 105, 116, 115, 58,
+123, 119, 114, 105, 116, 97, 98, 108, 101, 58, 116, 114, 117, 101, 125, 44, 10,
+114, 101, 113, 117, 101, 115, 116, 101, 100, 76, 111, 99, 97, 108, 101, 58, 123,
+118, 97, 108, 117, 101, 58, 97, 106, 44, 119, 114, 105, 116, 97, 98, 108, 101,
+58, 116, 114, 117, 101, 125, 44, 10, 125, 41, 59, 10, 105, 102, 40, 40, 37, 95,
+67, 97, 108, 108, 40, 114, 44, 98, 108, 44, 39, 109, 105, 110, 105, 109, 117,
+109, 83, 105, 103, 110, 105, 102, 105, 99, 97, 110, 116, 68, 105, 103, 105, 116,
+115, 39, 41, 41, 41, 123, 10, 100, 101, 102, 105, 110, 101, 87, 69, 80, 114,
+111, 112, 101, 114, 116, 121, 40, 97, 105, 44, 39, 109, 105, 110, 105, 109, 117,
+109, 83, 105, 103, 110, 105, 102, 105, 99, 97, 110, 116, 68, 105, 103, 105, 116,
+115, 39, 44, 40, 118, 111, 105, 100, 32, 48, 41, 41, 59, 10, 125, 10, 105, 102,
+40, 40, 37, 95, 67, 97, 108, 108, 40, 114, 44, 98, 108, 44, 39, 109, 97, 120,
+105, 109, 117, 109, 83, 105, 103, 110, 105, 102, 105, 99, 97, 110, 116, 68, 105,
+103, 105, 116, 115, 39, 41, 41, 41, 123, 10, 100, 101, 102, 105, 110, 101, 87,
+69, 80, 114, 111, 112, 101, 114, 116, 121, 40, 97, 105, 44, 39, 109, 97, 120,
+105, 109, 117, 109, 83, 105, 103, 110, 105, 102, 105, 99, 97, 110, 116, 68, 105,
+103, 105, 116, 115, 39, 44, 40, 118, 111, 105, 100, 32, 48, 41, 41, 59, 10, 125,
+10, 100, 101, 102, 105, 110, 101, 87, 69, 80, 114, 111, 112, 101, 114, 116, 121,
+40, 97, 105, 44, 39, 112, 108, 117, 114, 97, 108, 67, 97, 116, 101, 103, 111,
+114, 105, 101, 115, 39, 44, 91, 93, 41, 59, 10, 118, 97, 114, 32, 98, 117, 61,
+37, 67, 114, 101, 97, 116, 101, 80, 108, 117, 114, 97, 108, 82, 117, 108, 101,
+115, 40, 97, 106, 44, 98, 108, 44, 10, 97, 105, 41, 59, 10, 37, 77, 97, 114,
+107, 65, 115, 73, 110, 105, 116, 105, 97, 108, 105, 122, 101, 100, 73, 110, 116,
+108, 79, 98, 106, 101, 99, 116, 79, 102, 84, 121, 112, 101, 40, 98, 117, 44, 39,
+112, 108, 117, 114, 97, 108, 114, 117, 108, 101, 115, 39, 41, 59, 10, 98, 117,
+91, 117, 93, 61, 97, 105, 59, 10, 114, 101, 116, 117, 114, 110, 32, 98, 117, 59,
+10, 125, 10, 37, 83, 101, 116, 67, 111, 100, 101, 40, 106, 44, 80, 108, 117,
+114, 97, 108, 82, 117, 108, 101, 115, 67, 111, 110, 115, 116, 114, 117, 99, 116,
+111, 114, 41, 59, 10, 37, 68, 101, 102, 105, 110, 101, 77, 101, 116, 104, 111,
+100, 115, 73, 110, 116, 101, 114, 110, 97, 108, 40, 106, 46, 112, 114, 111, 116,
+111, 116, 121, 112, 101, 44, 99, 108, 97, 115, 115, 123, 114, 101, 115, 111,
+108, 118, 101, 100, 79, 112, 116, 105, 111, 110, 115, 40, 41, 123, 10, 105, 102,
+40, 33, 37, 73, 115, 73, 110, 105, 116, 105, 97, 108, 105, 122, 101, 100, 73,
+110, 116, 108, 79, 98, 106, 101, 99, 116, 79, 102, 84, 121, 112, 101, 40, 116,
+104, 105, 115, 44, 39, 112, 108, 117, 114, 97, 108, 114, 117, 108, 101, 115, 39,
+41, 41, 123, 10, 116, 104, 114, 111, 119, 32, 37, 109, 97, 107, 101, 95, 116,
+121, 112, 101, 95, 101, 114, 114, 111, 114, 40, 54, 49, 44, 10, 39, 73, 110,
+116, 108, 46, 80, 108, 117, 114, 97, 108, 82, 117, 108, 101, 115, 46, 112, 114,
+111, 116, 111, 116, 121, 112, 101, 46, 114, 101, 115, 111, 108, 118, 101, 100,
+79, 112, 116, 105, 111, 110, 115, 39, 44, 10, 116, 104, 105, 115, 41, 59, 10,
+125, 10, 118, 97, 114, 32, 97, 111, 61, 123, 10, 108, 111, 99, 97, 108, 101, 58,
+116, 104, 105, 115, 91, 117, 93, 46, 108, 111, 99, 97, 108, 101, 44, 10, 116,
+121, 112, 101, 58, 116, 104, 105, 115, 91, 117, 93, 46, 116, 121, 112, 101, 44,
+10, 109, 105, 110, 105, 109, 117, 109, 73, 110, 116, 101, 103, 101, 114, 68,
+105, 103, 105, 116, 115, 58, 116, 104, 105, 115, 91, 117, 93, 46, 109, 105, 110,
+105, 109, 117, 109, 73, 110, 116, 101, 103, 101, 114, 68, 105, 103, 105, 116,
+115, 44, 10, 109, 105, 110, 105, 109, 117, 109, 70, 114, 97, 99, 116, 105, 111,
+110, 68, 105, 103, 105, 116, 115, 58, 116, 104, 105, 115, 91, 117, 93, 46, 109,
+105, 110, 105, 109, 117, 109, 70, 114, 97, 99, 116, 105, 111, 110, 68, 105, 103,
+105, 116, 115, 44, 10, 109, 97, 120, 105, 109, 117, 109, 70, 114, 97, 99, 116,
+105, 111, 110, 68, 105, 103, 105, 116, 115, 58, 116, 104, 105, 115, 91, 117, 93,
+46, 109, 97, 120, 105, 109, 117, 109, 70, 114, 97, 99, 116, 105, 111, 110, 68,
+105, 103, 105, 116, 115, 44, 10, 125, 59, 10, 105, 102, 40, 40, 37, 95, 67, 97,
+108, 108, 40, 114, 44, 116, 104, 105, 115, 91, 117, 93, 44, 39, 109, 105, 110,
+105, 109, 117, 109, 83, 105, 103, 110, 105, 102, 105, 99, 97, 110, 116, 68, 105,
+103, 105, 116, 115, 39, 41, 41, 41, 123, 10, 100, 101, 102, 105, 110, 101, 87,
+69, 67, 80, 114, 111, 112, 101, 114, 116, 121, 40, 97, 111, 44, 39, 109, 105,
+110, 105, 109, 117, 109, 83, 105, 103, 110, 105, 102, 105, 99, 97, 110, 116, 68,
+105, 103, 105, 116, 115, 39, 44, 10, 116, 104, 105, 115, 91, 117, 93, 46, 109,
+105, 110, 105, 109, 117, 109, 83, 105, 103, 110, 105, 102, 105, 99, 97, 110,
+116, 68, 105, 103, 105, 116, 115, 41, 59, 10, 125, 10, 105, 102, 40, 40, 37, 95,
+67, 97, 108, 108, 40, 114, 44, 116, 104, 105, 115, 91, 117, 93, 44, 39, 109, 97,
+120, 105, 109, 117, 109, 83, 105, 103, 110, 105, 102, 105, 99, 97, 110, 116, 68,
+105, 103, 105, 116, 115, 39, 41, 41, 41, 123, 10, 100, 101, 102, 105, 110, 101,
+87, 69, 67, 80, 114, 111, 112, 101, 114, 116, 121, 40, 97, 111, 44, 39, 109, 97,
+120, 105, 109, 117, 109, 83, 105, 103, 110, 105, 102, 105, 99, 97, 110, 116, 68,
+105, 103, 105, 116, 115, 39, 44, 10, 116, 104, 105, 115, 91, 117, 93, 46, 109,
+97, 120, 105, 109, 117, 109, 83, 105, 103, 110, 105, 102, 105, 99, 97, 110, 116,
+68, 105, 103, 105, 116, 115, 41, 59, 10, 125, 10, 100, 101, 102, 105, 110, 101,
+87, 69, 67, 80, 114, 111, 112, 101, 114, 116, 121, 40, 97, 111, 44, 39, 112,
+108, 117, 114, 97, 108, 67, 97, 116, 101, 103, 111, 114, 105, 101, 115, 39, 44,
+10, 116, 104, 105, 115, 91, 117, 93, 46, 112, 108, 117, 114, 97, 108, 67, 97,
+116, 101, 103, 111, 114, 105, 101, 115, 41, 59, 10, 114, 101, 116, 117, 114,
+110, 32, 97, 111, 59, 10, 125, 125, 44, 45, 49, 41, 59, 10, 37, 68, 101, 102,
+105, 110, 101, 77, 101, 116, 104, 111, 100, 115, 73, 110, 116, 101, 114, 110,
+97, 108, 40, 106, 44, 99, 108, 97, 115, 115, 123, 115, 117, 112, 112, 111, 114,
+116, 101, 100, 76, 111, 99, 97, 108, 101, 115, 79, 102, 40, 66, 41, 123, 10,
+114, 101, 116, 117, 114, 110, 32, 115, 117, 112, 112, 111, 114, 116, 101, 100,
+76, 111, 99, 97, 108, 101, 115, 79, 102, 40, 39, 112, 108, 117, 114, 97, 108,
+114, 117, 108, 101, 115, 39, 44, 66, 44, 97, 114, 103, 117, 109, 101, 110, 116,
+115, 91, 49, 93, 41, 59, 10, 125, 125, 44, 45, 49, 41, 59, 10, 37, 68, 101, 102,
+105, 110, 101, 77, 101, 116, 104, 111, 100, 115, 73, 110, 116, 101, 114, 110,
+97, 108, 40, 106, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 44, 99, 108,
+97, 115, 115, 123, 115, 101, 108, 101, 99, 116, 40, 97, 104, 41, 123, 10, 105,
+102, 40, 33, 37, 73, 115, 73, 110, 105, 116, 105, 97, 108, 105, 122, 101, 100,
+73, 110, 116, 108, 79, 98, 106, 101, 99, 116, 79, 102, 84, 121, 112, 101, 40,
+116, 104, 105, 115, 44, 39, 112, 108, 117, 114, 97, 108, 114, 117, 108, 101,
+115, 39, 41, 41, 123, 10, 116, 104, 114, 111, 119, 32, 37, 109, 97, 107, 101,
+95, 116, 121, 112, 101, 95, 101, 114, 114, 111, 114, 40, 54, 49, 44, 10, 39, 73,
+110, 116, 108, 46, 80, 108, 117, 114, 97, 108, 82, 117, 108, 101, 115, 46, 112,
+114, 111, 116, 111, 116, 121, 112, 101, 46, 115, 101, 108, 101, 99, 116, 39, 44,
+10, 116, 104, 105, 115, 41, 59, 10, 125, 10, 114, 101, 116, 117, 114, 110, 32,
+37, 80, 108, 117, 114, 97, 108, 82, 117, 108, 101, 115, 83, 101, 108, 101, 99,
+116, 40, 116, 104, 105, 115, 44, 40, 37, 95, 84, 111, 78, 117, 109, 98, 101,
+114, 40, 97, 104, 41, 41, 43, 48, 41, 59, 10, 125, 125, 44, 45, 49, 41, 59, 10,
+102, 117, 110, 99, 116, 105, 111, 110, 32, 105, 115, 87, 101, 108, 108, 70, 111,
+114, 109, 101, 100, 67, 117, 114, 114, 101, 110, 99, 121, 67, 111, 100, 101, 40,
+98, 118, 41, 123, 10, 114, 101, 116, 117, 114, 110, 32, 116, 121, 112, 101, 111,
+102, 32, 98, 118, 61, 61, 61, 34, 115, 116, 114, 105, 110, 103, 34, 38, 38, 98,
+118, 46, 108, 101, 110, 103, 116, 104, 61, 61, 61, 51, 38, 38, 10, 40, 37, 114,
+101, 103, 101, 120, 112, 95, 105, 110, 116, 101, 114, 110, 97, 108, 95, 109, 97,
+116, 99, 104, 40, 47, 91, 94, 65, 45, 90, 97, 45, 122, 93, 47, 44, 98, 118, 41,
+61, 61, 61, 110, 117, 108, 108, 41, 59, 10, 125, 10, 102, 117, 110, 99, 116,
+105, 111, 110, 32, 100, 101, 102, 97, 117, 108, 116, 78, 117, 109, 98, 101, 114,
+79, 112, 116, 105, 111, 110, 40, 97, 104, 44, 98, 119, 44, 98, 120, 44, 98, 121,
+44, 97, 100, 41, 123, 10, 105, 102, 40, 33, 40, 97, 104, 61, 61, 61, 40, 118,
+111, 105, 100, 32, 48, 41, 41, 41, 123, 10, 97, 104, 61, 40, 37, 95, 84, 111,
+78, 117, 109, 98, 101, 114, 40, 97, 104, 41, 41, 59, 10, 105, 102, 40, 40, 37,
+73, 83, 95, 86, 65, 82, 40, 97, 104, 41, 33, 61, 61, 97, 104, 41, 10, 124, 124,
+97, 104, 60, 98, 119, 124, 124, 97, 104, 62, 98, 120, 41, 123, 10, 116, 104,
+114, 111, 119, 32, 37, 109, 97, 107, 101, 95, 114, 97, 110, 103, 101, 95, 101,
+114, 114, 111, 114, 40, 49, 57, 55, 44, 97, 100, 41, 59, 10, 125, 10, 114, 101,
+116, 117, 114, 110, 32, 37, 109, 97, 116, 104, 95, 102, 108, 111, 111, 114, 40,
+97, 104, 41, 59, 10, 125, 10, 114, 101, 116, 117, 114, 110, 32, 98, 121, 59, 10,
+125, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 103, 101, 116, 78, 117, 109,
+98, 101, 114, 79, 112, 116, 105, 111, 110, 40, 67, 44, 97, 100, 44, 98, 119, 44,
+98, 120, 44, 98, 121, 41, 123, 10, 118, 97, 114, 32, 97, 104, 61, 67, 91, 97,
+100, 93, 59, 10, 114, 101, 116, 117, 114, 110, 32, 100, 101, 102, 97, 117, 108,
+116, 78, 117, 109, 98, 101, 114, 79, 112, 116, 105, 111, 110, 40, 97, 104, 44,
+98, 119, 44, 98, 120, 44, 98, 121, 44, 97, 100, 41, 59, 10, 125, 10, 102, 117,
+110, 99, 116, 105, 111, 110, 32, 83, 101, 116, 78, 117, 109, 98, 101, 114, 70,
+111, 114, 109, 97, 116, 68, 105, 103, 105, 116, 79, 112, 116, 105, 111, 110,
+115, 40, 98, 108, 44, 67, 44, 10, 109, 110, 102, 100, 68, 101, 102, 97, 117,
+108, 116, 44, 109, 120, 102, 100, 68, 101, 102, 97, 117, 108, 116, 41, 123, 10,
+118, 97, 114, 32, 98, 122, 61, 103, 101, 116, 78, 117, 109, 98, 101, 114, 79,
+112, 116, 105, 111, 110, 40, 67, 44, 39, 109, 105, 110, 105, 109, 117, 109, 73,
+110, 116, 101, 103, 101, 114, 68, 105, 103, 105, 116, 115, 39, 44, 49, 44, 50,
+49, 44, 49, 41, 59, 10, 100, 101, 102, 105, 110, 101, 87, 69, 80, 114, 111, 112,
+101, 114, 116, 121, 40, 98, 108, 44, 39, 109, 105, 110, 105, 109, 117, 109, 73,
+110, 116, 101, 103, 101, 114, 68, 105, 103, 105, 116, 115, 39, 44, 98, 122, 41,
+59, 10, 118, 97, 114, 32, 98, 65, 61, 103, 101, 116, 78, 117, 109, 98, 101, 114,
+79, 112, 116, 105, 111, 110, 40, 67, 44, 39, 109, 105, 110, 105, 109, 117, 109,
+70, 114, 97, 99, 116, 105, 111, 110, 68, 105, 103, 105, 116, 115, 39, 44, 48,
+44, 50, 48, 44, 10, 109, 110, 102, 100, 68, 101, 102, 97, 117, 108, 116, 41, 59,
+10, 100, 101, 102, 105, 110, 101, 87, 69, 80, 114, 111, 112, 101, 114, 116, 121,
+40, 98, 108, 44, 39, 109, 105, 110, 105, 109, 117, 109, 70, 114, 97, 99, 116,
+105, 111, 110, 68, 105, 103, 105, 116, 115, 39, 44, 98, 65, 41, 59, 10, 118, 97,
+114, 32, 98, 66, 61, 113, 40, 98, 65, 44, 109, 120, 102, 100, 68, 101, 102, 97,
+117, 108, 116, 41, 59, 10, 118, 97, 114, 32, 98, 67, 61, 103, 101, 116, 78, 117,
+109, 98, 101, 114, 79, 112, 116, 105, 111, 110, 40, 67, 44, 39, 109, 97, 120,
+105, 109, 117, 109, 70, 114, 97, 99, 116, 105, 111, 110, 68, 105, 103, 105, 116,
+115, 39, 44, 98, 65, 44, 50, 48, 44, 10, 98, 66, 41, 59, 10, 100, 101, 102, 105,
+110, 101, 87, 69, 80, 114, 111, 112, 101, 114, 116, 121, 40, 98, 108, 44, 39,
+109, 97, 120, 105, 109, 117, 109, 70, 114, 97, 99, 116, 105, 111, 110, 68, 105,
+103, 105, 116, 115, 39, 44, 98, 67, 41, 59, 10, 118, 97, 114, 32, 98, 68, 61,
+67, 91, 39, 109, 105, 110, 105, 109, 117, 109, 83, 105, 103, 110, 105, 102, 105,
+99, 97, 110, 116, 68, 105, 103, 105, 116, 115, 39, 93, 59, 10, 118, 97, 114, 32,
+98, 69, 61, 67, 91, 39, 109, 97, 120, 105, 109, 117, 109, 83, 105, 103, 110,
+105, 102, 105, 99, 97, 110, 116, 68, 105, 103, 105, 116, 115, 39, 93, 59, 10,
+105, 102, 40, 33, 40, 98, 68, 61, 61, 61, 40, 118, 111, 105, 100, 32, 48, 41,
+41, 124, 124, 33, 40, 98, 69, 61, 61, 61, 40, 118, 111, 105, 100, 32, 48, 41,
+41, 41, 123, 10, 98, 68, 61, 100, 101, 102, 97, 117, 108, 116, 78, 117, 109, 98,
+101, 114, 79, 112, 116, 105, 111, 110, 40, 98, 68, 44, 49, 44, 50, 49, 44, 49,
+44, 39, 109, 105, 110, 105, 109, 117, 109, 83, 105, 103, 110, 105, 102, 105, 99,
+97, 110, 116, 68, 105, 103, 105, 116, 115, 39, 41, 59, 10, 100, 101, 102, 105,
+110, 101, 87, 69, 80, 114, 111, 112, 101, 114, 116, 121, 40, 98, 108, 44, 39,
+109, 105, 110, 105, 109, 117, 109, 83, 105, 103, 110, 105, 102, 105, 99, 97,
+110, 116, 68, 105, 103, 105, 116, 115, 39, 44, 98, 68, 41, 59, 10, 98, 69, 61,
+100, 101, 102, 97, 117, 108, 116, 78, 117, 109, 98, 101, 114, 79, 112, 116, 105,
+111, 110, 40, 98, 69, 44, 98, 68, 44, 50, 49, 44, 50, 49, 44, 39, 109, 97, 120,
+105, 109, 117, 109, 83, 105, 103, 110, 105, 102, 105, 99, 97, 110, 116, 68, 105,
+103, 105, 116, 115, 39, 41, 59, 10, 100, 101, 102, 105, 110, 101, 87, 69, 80,
+114, 111, 112, 101, 114, 116, 121, 40, 98, 108, 44, 39, 109, 97, 120, 105, 109,
+117, 109, 83, 105, 103, 110, 105, 102, 105, 99, 97, 110, 116, 68, 105, 103, 105,
+116, 115, 39, 44, 98, 69, 41, 59, 10, 125, 10, 125, 10, 102, 117, 110, 99, 116,
+105, 111, 110, 32, 67, 114, 101, 97, 116, 101, 78, 117, 109, 98, 101, 114, 70,
+111, 114, 109, 97, 116, 40, 66, 44, 67, 41, 123, 10, 105, 102, 40, 40, 67, 61,
+61, 61, 40, 118, 111, 105, 100, 32, 48, 41, 41, 41, 123, 10, 67, 61, 123, 95,
+95, 112, 114, 111, 116, 111, 95, 95, 58, 110, 117, 108, 108, 125, 59, 10, 125,
+10, 118, 97, 114, 32, 97, 99, 61, 103, 101, 116, 71, 101, 116, 79, 112, 116,
+105, 111, 110, 40, 67, 44, 39, 110, 117, 109, 98, 101, 114, 102, 111, 114, 109,
+97, 116, 39, 41, 59, 10, 118, 97, 114, 32, 90, 61, 114, 101, 115, 111, 108, 118,
+101, 76, 111, 99, 97, 108, 101, 40, 39, 110, 117, 109, 98, 101, 114, 102, 111,
+114, 109, 97, 116, 39, 44, 66, 44, 67, 41, 59, 10, 118, 97, 114, 32, 98, 108,
+61, 123, 95, 95, 112, 114, 111, 116, 111, 95, 95, 58, 110, 117, 108, 108, 125,
+59, 10, 100, 101, 102, 105, 110, 101, 87, 69, 80, 114, 111, 112, 101, 114, 116,
+121, 40, 98, 108, 44, 39, 115, 116, 121, 108, 101, 39, 44, 97, 99, 40, 10, 39,
+115, 116, 121, 108, 101, 39, 44, 39, 115, 116, 114, 105, 110, 103, 39, 44, 91,
+39, 100, 101, 99, 105, 109, 97, 108, 39, 44, 39, 112, 101, 114, 99, 101, 110,
+116, 39, 44, 39, 99, 117, 114, 114, 101, 110, 99, 121, 39, 93, 44, 39, 100, 101,
+99, 105, 109, 97, 108, 39, 41, 41, 59, 10, 118, 97, 114, 32, 98, 118, 61, 97,
+99, 40, 39, 99, 117, 114, 114, 101, 110, 99, 121, 39, 44, 39, 115, 116, 114,
+105, 110, 103, 39, 41, 59, 10, 105, 102, 40, 33, 40, 98, 118, 61, 61, 61, 40,
+118, 111, 105, 100, 32, 48, 41, 41, 38, 38, 33, 105, 115, 87, 101, 108, 108, 70,
+111, 114, 109, 101, 100, 67, 117, 114, 114, 101, 110, 99, 121, 67, 111, 100,
+101, 40, 98, 118, 41, 41, 123, 10, 116, 104, 114, 111, 119, 32, 37, 109, 97,
+107, 101, 95, 114, 97, 110, 103, 101, 95, 101, 114, 114, 111, 114, 40, 49, 55,
+57, 44, 98, 118, 41, 59, 10, 125, 10, 105, 102, 40, 98, 108, 46, 115, 116, 121,
+108, 101, 61, 61, 61, 39, 99, 117, 114, 114, 101, 110, 99, 121, 39, 38, 38, 40,
+98, 118, 61, 61, 61, 40, 118, 111, 105, 100, 32, 48, 41, 41, 41, 123, 10, 116,
+104, 114, 111, 119, 32, 37, 109, 97, 107, 101, 95, 116, 121, 112, 101, 95, 101,
+114, 114, 111, 114, 40, 52, 50, 41, 59, 10, 125, 10, 118, 97, 114, 32, 98, 70,
+44, 98, 71, 59, 10, 118, 97, 114, 32, 98, 72, 61, 97, 99, 40, 10, 39, 99, 117,
+114, 114, 101, 110, 99, 121, 68, 105, 115, 112, 108, 97, 121, 39, 44, 39, 115,
+116, 114, 105, 110, 103, 39, 44, 91, 39, 99, 111, 100, 101, 39, 44, 39, 115,
+121, 109, 98, 111, 108, 39, 44, 39, 110, 97, 109, 101, 39, 93, 44, 39, 115, 121,
+109, 98, 111, 108, 39, 41, 59, 10, 105, 102, 40, 98, 108, 46, 115, 116, 121,
+108, 101, 61, 61, 61, 39, 99, 117, 114, 114, 101, 110, 99, 121, 39, 41, 123, 10,
+100, 101, 102, 105, 110, 101, 87, 69, 80, 114, 111, 112, 101, 114, 116, 121, 40,
+98, 108, 44, 39, 99, 117, 114, 114, 101, 110, 99, 121, 39, 44, 37, 83, 116, 114,
+105, 110, 103, 84, 111, 85, 112, 112, 101, 114, 67, 97, 115, 101, 73, 110, 116,
+108, 40, 98, 118, 41, 41, 59, 10, 100, 101, 102, 105, 110, 101, 87, 69, 80, 114,
+111, 112, 101, 114, 116, 121, 40, 98, 108, 44, 39, 99, 117, 114, 114, 101, 110,
+99, 121, 68, 105, 115, 112, 108, 97, 121, 39, 44, 98, 72, 41, 59, 10, 98, 70,
+61, 98, 71, 61, 37, 67, 117, 114, 114, 101, 110, 99, 121, 68, 105, 103, 105,
+116, 115, 40, 98, 108, 46, 99, 117, 114, 114, 101, 110, 99, 121, 41, 59, 10,
+125, 101, 108, 115, 101, 123, 10, 98, 70, 61, 48, 59, 10, 98, 71, 61, 98, 108,
+46, 115, 116, 121, 108, 101, 61, 61, 61, 39, 112, 101, 114, 99, 101, 110, 116,
+39, 63, 48, 58, 51, 59, 10, 125, 10, 83, 101, 116, 78, 117, 109, 98, 101, 114,
+70, 111, 114, 109, 97, 116, 68, 105, 103, 105, 116, 79, 112, 116, 105, 111, 110,
+115, 40, 98, 108, 44, 67, 44, 98, 70, 44, 10, 98, 71, 41, 59, 10, 100, 101, 102,
+105, 110, 101, 87, 69, 80, 114, 111, 112, 101, 114, 116, 121, 40, 98, 108, 44,
+39, 117, 115, 101, 71, 114, 111, 117, 112, 105, 110, 103, 39, 44, 97, 99, 40,
+10, 39, 117, 115, 101, 71, 114, 111, 117, 112, 105, 110, 103, 39, 44, 39, 98,
+111, 111, 108, 101, 97, 110, 39, 44, 40, 118, 111, 105, 100, 32, 48, 41, 44,
+116, 114, 117, 101, 41, 41, 59, 10, 118, 97, 114, 32, 97, 114, 61, 112, 97, 114,
+115, 101, 69, 120, 116, 101, 110, 115, 105, 111, 110, 40, 90, 46, 101, 120, 116,
+101, 110, 115, 105, 111, 110, 41, 59, 10, 118, 97, 114, 32, 98, 73, 61, 123, 10,
+39, 110, 117, 39, 58, 123, 39, 112, 114, 111, 112, 101, 114, 116, 121, 39, 58,
+40, 118, 111, 105, 100, 32, 48, 41, 44, 39, 116, 121, 112, 101, 39, 58, 39, 115,
+116, 114, 105, 110, 103, 39, 125, 10, 125, 59, 10, 118, 97, 114, 32, 97, 110,
+61, 115, 101, 116, 79, 112, 116, 105, 111, 110, 115, 40, 67, 44, 97, 114, 44,
+98, 73, 44, 10, 97, 99, 44, 98, 108, 41, 59, 10, 118, 97, 114, 32, 97, 106, 61,
+90, 46, 108, 111, 99, 97, 108, 101, 43, 97, 110, 59, 10, 118, 97, 114, 32, 97,
+105, 61, 37, 111, 98, 106, 101, 99, 116, 95, 100, 101, 102, 105, 110, 101, 95,
+112, 114, 111, 112, 101, 114, 116, 105, 101, 115, 40, 123, 95, 95, 112, 114,
+111, 116, 111, 95, 95, 58, 110, 117, 108, 108, 125, 44, 123, 10, 99, 117, 114,
+114, 101, 110, 99, 121, 58, 123, 119, 114, 105, 116, 97, 98, 108, 101, 58, 116,
+114, 117, 101, 125, 44, 10, 99, 117, 114, 114, 101, 110, 99, 121, 68, 105, 115,
+112, 108, 97, 121, 58, 123, 119, 114, 105, 116, 97, 98, 108, 101, 58, 116, 114,
+117, 101, 125, 44, 10, 108, 111, 99, 97, 108, 101, 58, 123, 119, 114, 105, 116,
+97, 98, 108, 101, 58, 116, 114, 117, 101, 125, 44, 10, 109, 97, 120, 105, 109,
+117, 109, 70, 114, 97, 99, 116, 105, 111, 110, 68, 105, 103, 105, 116, 115, 58,
+123, 119, 114, 105, 116, 97, 98, 108, 101, 58, 116, 114, 117, 101, 125, 44, 10,
+109, 105, 110, 105, 109, 117, 109, 70, 114, 97, 99, 116, 105, 111, 110, 68, 105,
+103, 105, 116, 115, 58, 123, 119, 114, 105, 116, 97, 98, 108, 101, 58, 116, 114,
+117, 101, 125, 44, 10, 109, 105, 110, 105, 109, 117, 109, 73, 110, 116, 101,
+103, 101, 114, 68, 105, 103, 105, 116, 115, 58, 123, 119, 114, 105, 116, 97, 98,
+108, 101, 58, 116, 114, 117, 101, 125, 44, 10, 110, 117, 109, 98, 101, 114, 105,
+110, 103, 83, 121, 115, 116, 101, 109, 58, 123, 119, 114, 105, 116, 97, 98, 108,
+101, 58, 116, 114, 117, 101, 125, 44, 10, 114, 101, 113, 117, 101, 115, 116,
+101, 100, 76, 111, 99, 97, 108, 101, 58, 123, 118, 97, 108, 117, 101, 58, 97,
+106, 44, 119, 114, 105, 116, 97, 98, 108, 101, 58, 116, 114, 117, 101, 125, 44,
+10, 115, 116, 121, 108, 101, 58, 123, 118, 97, 108, 117, 101, 58, 98, 108, 46,
+115, 116, 121, 108, 101, 44, 119, 114, 105, 116, 97, 98, 108, 101, 58, 116, 114,
+117, 101, 125, 44, 10, 117, 115, 101, 71, 114, 111, 117, 112, 105, 110, 103, 58,
+123, 119, 114, 105, 116, 97, 98, 108, 101, 58, 116, 114, 117, 101, 125, 10, 125,
+41, 59, 10, 105, 102, 40, 40, 37, 95, 67, 97, 108, 108, 40, 114, 44, 98, 108,
+44, 39, 109, 105, 110, 105, 109, 117, 109, 83, 105, 103, 110, 105, 102, 105, 99,
+97, 110, 116, 68, 105, 103, 105, 116, 115, 39, 41, 41, 41, 123, 10, 100, 101,
+102, 105, 110, 101, 87, 69, 80, 114, 111, 112, 101, 114, 116, 121, 40, 97, 105,
+44, 39, 109, 105, 110, 105, 109, 117, 109, 83, 105, 103, 110, 105, 102, 105, 99,
+97, 110, 116, 68, 105, 103, 105, 116, 115, 39, 44, 40, 118, 111, 105, 100, 32,
+48, 41, 41, 59, 10, 125, 10, 105, 102, 40, 40, 37, 95, 67, 97, 108, 108, 40,
+114, 44, 98, 108, 44, 39, 109, 97, 120, 105, 109, 117, 109, 83, 105, 103, 110,
+105, 102, 105, 99, 97, 110, 116, 68, 105, 103, 105, 116, 115, 39, 41, 41, 41,
+123, 10, 100, 101, 102, 105, 110, 101, 87, 69, 80, 114, 111, 112, 101, 114, 116,
+121, 40, 97, 105, 44, 39, 109, 97, 120, 105, 109, 117, 109, 83, 105, 103, 110,
+105, 102, 105, 99, 97, 110, 116, 68, 105, 103, 105, 116, 115, 39, 44, 40, 118,
+111, 105, 100, 32, 48, 41, 41, 59, 10, 125, 10, 118, 97, 114, 32, 98, 74, 61,
+37, 67, 114, 101, 97, 116, 101, 78, 117, 109, 98, 101, 114, 70, 111, 114, 109,
+97, 116, 40, 97, 106, 44, 98, 108, 44, 10, 97, 105, 41, 59, 10, 105, 102, 40,
+98, 108, 46, 115, 116, 121, 108, 101, 61, 61, 61, 39, 99, 117, 114, 114, 101,
+110, 99, 121, 39, 41, 123, 10, 37, 111, 98, 106, 101, 99, 116, 95, 100, 101,
+102, 105, 110, 101, 95, 112, 114, 111, 112, 101, 114, 116, 121, 40, 97, 105, 44,
+39, 99, 117, 114, 114, 101, 110, 99, 121, 68, 105, 115, 112, 108, 97, 121, 39,
+44, 10, 123, 118, 97, 108, 117, 101, 58, 98, 72, 44, 119, 114, 105, 116, 97, 98,
+108, 101, 58, 116, 114, 117, 101, 125, 41, 59, 10, 125, 10, 37, 77, 97, 114,
+107, 65, 115, 73, 110, 105, 116, 105, 97, 108, 105, 122, 101, 100, 73, 110, 116,
+108, 79, 98, 106, 101, 99, 116, 79, 102, 84, 121, 112, 101, 40, 98, 74, 44, 39,
+110, 117, 109, 98, 101, 114, 102, 111, 114, 109, 97, 116, 39, 41, 59, 10, 98,
+74, 91, 117, 93, 61, 97, 105, 59, 10, 114, 101, 116, 117, 114, 110, 32, 98, 74,
+59, 10, 125, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 78, 117, 109, 98,
+101, 114, 70, 111, 114, 109, 97, 116, 67, 111, 110, 115, 116, 114, 117, 99, 116,
+111, 114, 40, 41, 123, 10, 114, 101, 116, 117, 114, 110, 32, 73, 110, 116, 108,
+67, 111, 110, 115, 116, 114, 117, 99, 116, 40, 116, 104, 105, 115, 44, 104, 44,
+67, 114, 101, 97, 116, 101, 78, 117, 109, 98, 101, 114, 70, 111, 114, 109, 97,
+116, 44, 10, 110, 101, 119, 46, 116, 97, 114, 103, 101, 116, 44, 97, 114, 103,
+117, 109, 101, 110, 116, 115, 44, 116, 114, 117, 101, 41, 59, 10, 125, 10, 37,
+83, 101, 116, 67, 111, 100, 101, 40, 104, 44, 78, 117, 109, 98, 101, 114, 70,
+111, 114, 109, 97, 116, 67, 111, 110, 115, 116, 114, 117, 99, 116, 111, 114, 41,
+59, 10, 37, 68, 101, 102, 105, 110, 101, 77, 101, 116, 104, 111, 100, 115, 73,
+110, 116, 101, 114, 110, 97, 108, 40, 104, 46, 112, 114, 111, 116, 111, 116,
+121, 112, 101, 44, 99, 108, 97, 115, 115, 123, 114, 101, 115, 111, 108, 118,
+101, 100, 79, 112, 116, 105, 111, 110, 115, 40, 41, 123, 10, 118, 97, 114, 32,
+98, 75, 61, 85, 110, 119, 114, 97, 112, 40, 116, 104, 105, 115, 44, 39, 110,
+117, 109, 98, 101, 114, 102, 111, 114, 109, 97, 116, 39, 44, 104, 44, 10, 39,
+114, 101, 115, 111, 108, 118, 101, 100, 79, 112, 116, 105, 111, 110, 115, 39,
+44, 116, 114, 117, 101, 41, 59, 10, 118, 97, 114, 32, 97, 111, 61, 123, 10, 108,
+111, 99, 97, 108, 101, 58, 98, 75, 91, 117, 93, 46, 108, 111, 99, 97, 108, 101,
+44, 10, 110, 117, 109, 98, 101, 114, 105, 110, 103, 83, 121, 115, 116, 101, 109,
+58, 98, 75, 91, 117, 93, 46, 110, 117, 109, 98, 101, 114, 105, 110, 103, 83,
+121, 115, 116, 101, 109, 44, 10, 115, 116, 121, 108, 101, 58, 98, 75, 91, 117,
+93, 46, 115, 116, 121, 108, 101, 44, 10, 117, 115, 101, 71, 114, 111, 117, 112,
+105, 110, 103, 58, 98, 75, 91, 117, 93, 46, 117, 115, 101, 71, 114, 111, 117,
+112, 105, 110, 103, 44, 10, 109, 105, 110, 105, 109, 117, 109, 73, 110, 116,
+101, 103, 101, 114, 68, 105, 103, 105, 116, 115, 58, 98, 75, 91, 117, 93, 46,
+109, 105, 110, 105, 109, 117, 109, 73, 110, 116, 101, 103, 101, 114, 68, 105,
+103, 105, 116, 115, 44, 10, 109, 105, 110, 105, 109, 117, 109, 70, 114, 97, 99,
+116, 105, 111, 110, 68, 105, 103, 105, 116, 115, 58, 98, 75, 91, 117, 93, 46,
+109, 105, 110, 105, 109, 117, 109, 70, 114, 97, 99, 116, 105, 111, 110, 68, 105,
+103, 105, 116, 115, 44, 10, 109, 97, 120, 105, 109, 117, 109, 70, 114, 97, 99,
+116, 105, 111, 110, 68, 105, 103, 105, 116, 115, 58, 98, 75, 91, 117, 93, 46,
+109, 97, 120, 105, 109, 117, 109, 70, 114, 97, 99, 116, 105, 111, 110, 68, 105,
+103, 105, 116, 115, 44, 10, 125, 59, 10, 105, 102, 40, 97, 111, 46, 115, 116,
+121, 108, 101, 61, 61, 61, 39, 99, 117, 114, 114, 101, 110, 99, 121, 39, 41,
+123, 10, 100, 101, 102, 105, 110, 101, 87, 69, 67, 80, 114, 111, 112, 101, 114,
+116, 121, 40, 97, 111, 44, 39, 99, 117, 114, 114, 101, 110, 99, 121, 39, 44, 98,
+75, 91, 117, 93, 46, 99, 117, 114, 114, 101, 110, 99, 121, 41, 59, 10, 100, 101,
+102, 105, 110, 101, 87, 69, 67, 80, 114, 111, 112, 101, 114, 116, 121, 40, 97,
+111, 44, 39, 99, 117, 114, 114, 101, 110, 99, 121, 68, 105, 115, 112, 108, 97,
+121, 39, 44, 10, 98, 75, 91, 117, 93, 46, 99, 117, 114, 114, 101, 110, 99, 121,
+68, 105, 115, 112, 108, 97, 121, 41, 59, 10, 125, 10, 105, 102, 40, 40, 37, 95,
+67, 97, 108, 108, 40, 114, 44, 98, 75, 91, 117, 93, 44, 39, 109, 105, 110, 105,
+109, 117, 109, 83, 105, 103, 110, 105, 102, 105, 99, 97, 110, 116, 68, 105, 103,
+105, 116, 115, 39, 41, 41, 41, 123, 10, 100, 101, 102, 105, 110, 101, 87, 69,
+67, 80, 114, 111, 112, 101, 114, 116, 121, 40, 97, 111, 44, 39, 109, 105, 110,
+105, 109, 117, 109, 83, 105, 103, 110, 105, 102, 105, 99, 97, 110, 116, 68, 105,
+103, 105, 116, 115, 39, 44, 10, 98, 75, 91, 117, 93, 46, 109, 105, 110, 105,
+109, 117, 109, 83, 105, 103, 110, 105, 102, 105, 99, 97, 110, 116, 68, 105, 103,
+105, 116, 115, 41, 59, 10, 125, 10, 105, 102, 40, 40, 37, 95, 67, 97, 108, 108,
+40, 114, 44, 98, 75, 91, 117, 93, 44, 39, 109, 97, 120, 105, 109, 117, 109, 83,
+105, 103, 110, 105, 102, 105, 99, 97, 110, 116, 68, 105, 103, 105, 116, 115, 39,
+41, 41, 41, 123, 10, 100, 101, 102, 105, 110, 101, 87, 69, 67, 80, 114, 111,
+112, 101, 114, 116, 121, 40, 97, 111, 44, 39, 109, 97, 120, 105, 109, 117, 109,
+83, 105, 103, 110, 105, 102, 105, 99, 97, 110, 116, 68, 105, 103, 105, 116, 115,
+39, 44, 10, 98, 75, 91, 117, 93, 46, 109, 97, 120, 105, 109, 117, 109, 83, 105,
+103, 110, 105, 102, 105, 99, 97, 110, 116, 68, 105, 103, 105, 116, 115, 41, 59,
+10, 125, 10, 114, 101, 116, 117, 114, 110, 32, 97, 111, 59, 10, 125, 125, 44,
+45, 49, 41, 59, 10, 37, 68, 101, 102, 105, 110, 101, 77, 101, 116, 104, 111,
+100, 115, 73, 110, 116, 101, 114, 110, 97, 108, 40, 104, 44, 99, 108, 97, 115,
+115, 123, 115, 117, 112, 112, 111, 114, 116, 101, 100, 76, 111, 99, 97, 108,
+101, 115, 79, 102, 40, 66, 41, 123, 10, 114, 101, 116, 117, 114, 110, 32, 115,
+117, 112, 112, 111, 114, 116, 101, 100, 76, 111, 99, 97, 108, 101, 115, 79, 102,
+40, 39, 110, 117, 109, 98, 101, 114, 102, 111, 114, 109, 97, 116, 39, 44, 66,
+44, 97, 114, 103, 117, 109, 101, 110, 116, 115, 91, 49, 93, 41, 59, 10, 125,
+125, 44, 45, 49, 41, 59, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 102,
+111, 114, 109, 97, 116, 78, 117, 109, 98, 101, 114, 40, 98, 76, 44, 97, 104, 41,
+123, 10, 118, 97, 114, 32, 98, 77, 61, 40, 37, 95, 84, 111, 78, 117, 109, 98,
+101, 114, 40, 97, 104, 41, 41, 43, 48, 59, 10, 114, 101, 116, 117, 114, 110, 32,
+37, 73, 110, 116, 101, 114, 110, 97, 108, 78, 117, 109, 98, 101, 114, 70, 111,
+114, 109, 97, 116, 40, 98, 76, 44, 98, 77, 41, 59, 10, 125, 10, 65, 100, 100,
+66, 111, 117, 110, 100, 77, 101, 116, 104, 111, 100, 40, 104, 44, 39, 102, 111,
+114, 109, 97, 116, 39, 44, 102, 111, 114, 109, 97, 116, 78, 117, 109, 98, 101,
+114, 44, 49, 44, 10, 39, 110, 117, 109, 98, 101, 114, 102, 111, 114, 109, 97,
+116, 39, 44, 116, 114, 117, 101, 41, 59, 10, 102, 117, 110, 99, 116, 105, 111,
+110, 32, 116, 111, 76, 68, 77, 76, 83, 116, 114, 105, 110, 103, 40, 67, 41, 123,
+10, 118, 97, 114, 32, 97, 99, 61, 103, 101, 116, 71, 101, 116, 79, 112, 116,
+105, 111, 110, 40, 67, 44, 39, 100, 97, 116, 101, 102, 111, 114, 109, 97, 116,
+39, 41, 59, 10, 118, 97, 114, 32, 98, 78, 61, 39, 39, 59, 10, 118, 97, 114, 32,
+98, 79, 61, 97, 99, 40, 39, 119, 101, 101, 107, 100, 97, 121, 39, 44, 39, 115,
+116, 114, 105, 110, 103, 39, 44, 91, 39, 110, 97, 114, 114, 111, 119, 39, 44,
+39, 115, 104, 111, 114, 116, 39, 44, 39, 108, 111, 110, 103, 39, 93, 41, 59, 10,
+98, 78, 43, 61, 97, 112, 112, 101, 110, 100, 84, 111, 76, 68, 77, 76, 83, 116,
+114, 105, 110, 103, 40, 10, 98, 79, 44, 123, 110, 97, 114, 114, 111, 119, 58,
+39, 69, 69, 69, 69, 69, 39, 44, 115, 104, 111, 114, 116, 58, 39, 69, 69, 69, 39,
+44, 108, 111, 110, 103, 58, 39, 69, 69, 69, 69, 39, 125, 41, 59, 10, 98, 79, 61,
+97, 99, 40, 39, 101, 114, 97, 39, 44, 39, 115, 116, 114, 105, 110, 103, 39, 44,
+91, 39, 110, 97, 114, 114, 111, 119, 39, 44, 39, 115, 104, 111, 114, 116, 39,
+44, 39, 108, 111, 110, 103, 39, 93, 41, 59, 10, 98, 78, 43, 61, 97, 112, 112,
+101, 110, 100, 84, 111, 76, 68, 77, 76, 83, 116, 114, 105, 110, 103, 40, 10, 98,
+79, 44, 123, 110, 97, 114, 114, 111, 119, 58, 39, 71, 71, 71, 71, 71, 39, 44,
+115, 104, 111, 114, 116, 58, 39, 71, 71, 71, 39, 44, 108, 111, 110, 103, 58, 39,
+71, 71, 71, 71, 39, 125, 41, 59, 10, 98, 79, 61, 97, 99, 40, 39, 121, 101, 97,
+114, 39, 44, 39, 115, 116, 114, 105, 110, 103, 39, 44, 91, 39, 50, 45, 100, 105,
+103, 105, 116, 39, 44, 39, 110, 117, 109, 101, 114, 105, 99, 39, 93, 41, 59, 10,
+98, 78, 43, 61, 97, 112, 112, 101, 110, 100, 84, 111, 76, 68, 77, 76, 83, 116,
+114, 105, 110, 103, 40, 98, 79, 44, 123, 39, 50, 45, 100, 105, 103, 105, 116,
+39, 58, 39, 121, 121, 39, 44, 39, 110, 117, 109, 101, 114, 105, 99, 39, 58, 39,
+121, 39, 125, 41, 59, 10, 98, 79, 61, 97, 99, 40, 39, 109, 111, 110, 116, 104,
+39, 44, 39, 115, 116, 114, 105, 110, 103, 39, 44, 10, 91, 39, 50, 45, 100, 105,
+103, 105, 116, 39, 44, 39, 110, 117, 109, 101, 114, 105, 99, 39, 44, 39, 110,
+97, 114, 114, 111, 119, 39, 44, 39, 115, 104, 111, 114, 116, 39, 44, 39, 108,
+111, 110, 103, 39, 93, 41, 59, 10, 98, 78, 43, 61, 97, 112, 112, 101, 110, 100,
+84, 111, 76, 68, 77, 76, 83, 116, 114, 105, 110, 103, 40, 98, 79, 44, 123, 39,
+50, 45, 100, 105, 103, 105, 116, 39, 58, 39, 77, 77, 39, 44, 39, 110, 117, 109,
+101, 114, 105, 99, 39, 58, 39, 77, 39, 44, 10, 39, 110, 97, 114, 114, 111, 119,
+39, 58, 39, 77, 77, 77, 77, 77, 39, 44, 39, 115, 104, 111, 114, 116, 39, 58, 39,
+77, 77, 77, 39, 44, 39, 108, 111, 110, 103, 39, 58, 39, 77, 77, 77, 77, 39, 125,
+41, 59, 10, 98, 79, 61, 97, 99, 40, 39, 100, 97, 121, 39, 44, 39, 115, 116, 114,
+105, 110, 103, 39, 44, 91, 39, 50, 45, 100, 105, 103, 105, 116, 39, 44, 39, 110,
+117, 109, 101, 114, 105, 99, 39, 93, 41, 59, 10, 98, 78, 43, 61, 97, 112, 112,
+101, 110, 100, 84, 111, 76, 68, 77, 76, 83, 116, 114, 105, 110, 103, 40, 10, 98,
+79, 44, 123, 39, 50, 45, 100, 105, 103, 105, 116, 39, 58, 39, 100, 100, 39, 44,
+39, 110, 117, 109, 101, 114, 105, 99, 39, 58, 39, 100, 39, 125, 41, 59, 10, 118,
+97, 114, 32, 98, 80, 61, 97, 99, 40, 39, 104, 111, 117, 114, 49, 50, 39, 44, 39,
+98, 111, 111, 108, 101, 97, 110, 39, 41, 59, 10, 98, 79, 61, 97, 99, 40, 39,
+104, 111, 117, 114, 39, 44, 39, 115, 116, 114, 105, 110, 103, 39, 44, 91, 39,
+50, 45, 100, 105, 103, 105, 116, 39, 44, 39, 110, 117, 109, 101, 114, 105, 99,
+39, 93, 41, 59, 10, 105, 102, 40, 40, 98, 80, 61, 61, 61, 40, 118, 111, 105,
+100, 32, 48, 41, 41, 41, 123, 10, 98, 78, 43, 61, 97, 112, 112, 101, 110, 100,
+84, 111, 76, 68, 77, 76, 83, 116, 114, 105, 110, 103, 40, 98, 79, 44, 123, 39,
+50, 45, 100, 105, 103, 105, 116, 39, 58, 39, 106, 106, 39, 44, 39, 110, 117,
+109, 101, 114, 105, 99, 39, 58, 39, 106, 39, 125, 41, 59, 10, 125, 101, 108,
+115, 101, 32, 105, 102, 40, 98, 80, 61, 61, 61, 116, 114, 117, 101, 41, 123, 10,
+98, 78, 43, 61, 97, 112, 112, 101, 110, 100, 84, 111, 76, 68, 77, 76, 83, 116,
+114, 105, 110, 103, 40, 98, 79, 44, 123, 39, 50, 45, 100, 105, 103, 105, 116,
+39, 58, 39, 104, 104, 39, 44, 39, 110, 117, 109, 101, 114, 105, 99, 39, 58, 39,
+104, 39, 125, 41, 59, 10, 125, 101, 108, 115, 101, 123, 10, 98, 78, 43, 61, 97,
+112, 112, 101, 110, 100, 84, 111, 76, 68, 77, 76, 83, 116, 114, 105, 110, 103,
+40, 98, 79, 44, 123, 39, 50, 45, 100, 105, 103, 105, 116, 39, 58, 39, 72, 72,
+39, 44, 39, 110, 117, 109, 101, 114, 105, 99, 39, 58, 39, 72, 39, 125, 41, 59,
+10, 125, 10, 98, 79, 61, 97, 99, 40, 39, 109, 105, 110, 117, 116, 101, 39, 44,
+39, 115, 116, 114, 105, 110, 103, 39, 44, 91, 39, 50, 45, 100, 105, 103, 105,
+116, 39, 44, 39, 110, 117, 109, 101, 114, 105, 99, 39, 93, 41, 59, 10, 98, 78,
+43, 61, 97, 112, 112, 101, 110, 100, 84, 111, 76, 68, 77, 76, 83, 116, 114, 105,
+110, 103, 40, 98, 79, 44, 123, 39, 50, 45, 100, 105, 103, 105, 116, 39, 58, 39,
+109, 109, 39, 44, 39, 110, 117, 109, 101, 114, 105, 99, 39, 58, 39, 109, 39,
+125, 41, 59, 10, 98, 79, 61, 97, 99, 40, 39, 115, 101, 99, 111, 110, 100, 39,
+44, 39, 115, 116, 114, 105, 110, 103, 39, 44, 91, 39, 50, 45, 100, 105, 103,
+105, 116, 39, 44, 39, 110, 117, 109, 101, 114, 105, 99, 39, 93, 41, 59, 10, 98,
+78, 43, 61, 97, 112, 112, 101, 110, 100, 84, 111, 76, 68, 77, 76, 83, 116, 114,
+105, 110, 103, 40, 98, 79, 44, 123, 39, 50, 45, 100, 105, 103, 105, 116, 39, 58,
+39, 115, 115, 39, 44, 39, 110, 117, 109, 101, 114, 105, 99, 39, 58, 39, 115, 39,
+125, 41, 59, 10, 98, 79, 61, 97, 99, 40, 39, 116, 105, 109, 101, 90, 111, 110,
+101, 78, 97, 109, 101, 39, 44, 39, 115, 116, 114, 105, 110, 103, 39, 44, 91, 39,
+115, 104, 111, 114, 116, 39, 44, 39, 108, 111, 110, 103, 39, 93, 41, 59, 10, 98,
+78, 43, 61, 97, 112, 112, 101, 110, 100, 84, 111, 76, 68, 77, 76, 83, 116, 114,
+105, 110, 103, 40, 98, 79, 44, 123, 115, 104, 111, 114, 116, 58, 39, 122, 39,
+44, 108, 111, 110, 103, 58, 39, 122, 122, 122, 122, 39, 125, 41, 59, 10, 114,
+101, 116, 117, 114, 110, 32, 98, 78, 59, 10, 125, 10, 102, 117, 110, 99, 116,
+105, 111, 110, 32, 97, 112, 112, 101, 110, 100, 84, 111, 76, 68, 77, 76, 83,
+116, 114, 105, 110, 103, 40, 98, 79, 44, 98, 81, 41, 123, 10, 105, 102, 40, 33,
+40, 98, 79, 61, 61, 61, 40, 118, 111, 105, 100, 32, 48, 41, 41, 41, 123, 10,
+114, 101, 116, 117, 114, 110, 32, 98, 81, 91, 98, 79, 93, 59, 10, 125, 101, 108,
+115, 101, 123, 10, 114, 101, 116, 117, 114, 110, 39, 39, 59, 10, 125, 10, 125,
+10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 102, 114, 111, 109, 76, 68, 77,
+76, 83, 116, 114, 105, 110, 103, 40, 98, 78, 41, 123, 10, 98, 78, 61, 37, 82,
+101, 103, 69, 120, 112, 73, 110, 116, 101, 114, 110, 97, 108, 82, 101, 112, 108,
+97, 99, 101, 40, 71, 101, 116, 81, 117, 111, 116, 101, 100, 83, 116, 114, 105,
+110, 103, 82, 69, 40, 41, 44, 98, 78, 44, 39, 39, 41, 59, 10, 118, 97, 114, 32,
+67, 61, 123, 95, 95, 112, 114, 111, 116, 111, 95, 95, 58, 110, 117, 108, 108,
+125, 59, 10, 118, 97, 114, 32, 97, 74, 61, 37, 114, 101, 103, 101, 120, 112, 95,
+105, 110, 116, 101, 114, 110, 97, 108, 95, 109, 97, 116, 99, 104, 40, 47, 69,
+123, 51, 44, 53, 125, 47, 44, 98, 78, 41, 59, 10, 67, 61, 97, 112, 112, 101,
+110, 100, 84, 111, 68, 97, 116, 101, 84, 105, 109, 101, 79, 98, 106, 101, 99,
+116, 40, 10, 67, 44, 39, 119, 101, 101, 107, 100, 97, 121, 39, 44, 97, 74, 44,
+123, 69, 69, 69, 69, 69, 58, 39, 110, 97, 114, 114, 111, 119, 39, 44, 69, 69,
+69, 58, 39, 115, 104, 111, 114, 116, 39, 44, 69, 69, 69, 69, 58, 39, 108, 111,
+110, 103, 39, 125, 41, 59, 10, 97, 74, 61, 37, 114, 101, 103, 101, 120, 112, 95,
+105, 110, 116, 101, 114, 110, 97, 108, 95, 109, 97, 116, 99, 104, 40, 47, 71,
+123, 51, 44, 53, 125, 47, 44, 98, 78, 41, 59, 10, 67, 61, 97, 112, 112, 101,
+110, 100, 84, 111, 68, 97, 116, 101, 84, 105, 109, 101, 79, 98, 106, 101, 99,
+116, 40, 10, 67, 44, 39, 101, 114, 97, 39, 44, 97, 74, 44, 123, 71, 71, 71, 71,
+71, 58, 39, 110, 97, 114, 114, 111, 119, 39, 44, 71, 71, 71, 58, 39, 115, 104,
+111, 114, 116, 39, 44, 71, 71, 71, 71, 58, 39, 108, 111, 110, 103, 39, 125, 41,
+59, 10, 97, 74, 61, 37, 114, 101, 103, 101, 120, 112, 95, 105, 110, 116, 101,
+114, 110, 97, 108, 95, 109, 97, 116, 99, 104, 40, 47, 121, 123, 49, 44, 50, 125,
+47, 44, 98, 78, 41, 59, 10, 67, 61, 97, 112, 112, 101, 110, 100, 84, 111, 68,
+97, 116, 101, 84, 105, 109, 101, 79, 98, 106, 101, 99, 116, 40, 10, 67, 44, 39,
+121, 101, 97, 114, 39, 44, 97, 74, 44, 123, 121, 58, 39, 110, 117, 109, 101,
+114, 105, 99, 39, 44, 121, 121, 58, 39, 50, 45, 100, 105, 103, 105, 116, 39,
+125, 41, 59, 10, 97, 74, 61, 37, 114, 101, 103, 101, 120, 112, 95, 105, 110,
+116, 101, 114, 110, 97, 108, 95, 109, 97, 116, 99, 104, 40, 47, 77, 123, 49, 44,
+53, 125, 47, 44, 98, 78, 41, 59, 10, 67, 61, 97, 112, 112, 101, 110, 100, 84,
+111, 68, 97, 116, 101, 84, 105, 109, 101, 79, 98, 106, 101, 99, 116, 40, 67, 44,
+39, 109, 111, 110, 116, 104, 39, 44, 97, 74, 44, 123, 77, 77, 58, 39, 50, 45,
+100, 105, 103, 105, 116, 39, 44, 10, 77, 58, 39, 110, 117, 109, 101, 114, 105,
+99, 39, 44, 77, 77, 77, 77, 77, 58, 39, 110, 97, 114, 114, 111, 119, 39, 44, 77,
+77, 77, 58, 39, 115, 104, 111, 114, 116, 39, 44, 77, 77, 77, 77, 58, 39, 108,
+111, 110, 103, 39, 125, 41, 59, 10, 97, 74, 61, 37, 114, 101, 103, 101, 120,
+112, 95, 105, 110, 116, 101, 114, 110, 97, 108, 95, 109, 97, 116, 99, 104, 40,
+47, 76, 123, 49, 44, 53, 125, 47, 44, 98, 78, 41, 59, 10, 67, 61, 97, 112, 112,
+101, 110, 100, 84, 111, 68, 97, 116, 101, 84, 105, 109, 101, 79, 98, 106, 101,
+99, 116, 40, 67, 44, 39, 109, 111, 110, 116, 104, 39, 44, 97, 74, 44, 123, 76,
+76, 58, 39, 50, 45, 100, 105, 103, 105, 116, 39, 44, 10, 76, 58, 39, 110, 117,
+109, 101, 114, 105, 99, 39, 44, 76, 76, 76, 76, 76, 58, 39, 110, 97, 114, 114,
+111, 119, 39, 44, 76, 76, 76, 58, 39, 115, 104, 111, 114, 116, 39, 44, 76, 76,
+76, 76, 58, 39, 108, 111, 110, 103, 39, 125, 41, 59, 10, 97, 74, 61, 37, 114,
+101, 103, 101, 120, 112, 95, 105, 110, 116, 101, 114, 110, 97, 108, 95, 109, 97,
+116, 99, 104, 40, 47, 100, 123, 49, 44, 50, 125, 47, 44, 98, 78, 41, 59, 10, 67,
+61, 97, 112, 112, 101, 110, 100, 84, 111, 68, 97, 116, 101, 84, 105, 109, 101,
+79, 98, 106, 101, 99, 116, 40, 10, 67, 44, 39, 100, 97, 121, 39, 44, 97, 74, 44,
+123, 100, 58, 39, 110, 117, 109, 101, 114, 105, 99, 39, 44, 100, 100, 58, 39,
+50, 45, 100, 105, 103, 105, 116, 39, 125, 41, 59, 10, 97, 74, 61, 37, 114, 101,
+103, 101, 120, 112, 95, 105, 110, 116, 101, 114, 110, 97, 108, 95, 109, 97, 116,
+99, 104, 40, 47, 104, 123, 49, 44, 50, 125, 47, 44, 98, 78, 41, 59, 10, 105,
+102, 40, 97, 74, 33, 61, 61, 110, 117, 108, 108, 41, 123, 10, 67, 91, 39, 104,
+111, 117, 114, 49, 50, 39, 93, 61, 116, 114, 117, 101, 59, 10, 125, 10, 67, 61,
+97, 112, 112, 101, 110, 100, 84, 111, 68, 97, 116, 101, 84, 105, 109, 101, 79,
+98, 106, 101, 99, 116, 40, 10, 67, 44, 39, 104, 111, 117, 114, 39, 44, 97, 74,
+44, 123, 104, 58, 39, 110, 117, 109, 101, 114, 105, 99, 39, 44, 104, 104, 58,
+39, 50, 45, 100, 105, 103, 105, 116, 39, 125, 41, 59, 10, 97, 74, 61, 37, 114,
+101, 103, 101, 120, 112, 95, 105, 110, 116, 101, 114, 110, 97, 108, 95, 109, 97,
+116, 99, 104, 40, 47, 72, 123, 49, 44, 50, 125, 47, 44, 98, 78, 41, 59, 10, 105,
+102, 40, 97, 74, 33, 61, 61, 110, 117, 108, 108, 41, 123, 10, 67, 91, 39, 104,
+111, 117, 114, 49, 50, 39, 93, 61, 102, 97, 108, 115, 101, 59, 10, 125, 10, 67,
+61, 97, 112, 112, 101, 110, 100, 84, 111, 68, 97, 116, 101, 84, 105, 109, 101,
+79, 98, 106, 101, 99, 116, 40, 10, 67, 44, 39, 104, 111, 117, 114, 39, 44, 97,
+74, 44, 123, 72, 58, 39, 110, 117, 109, 101, 114, 105, 99, 39, 44, 72, 72, 58,
+39, 50, 45, 100, 105, 103, 105, 116, 39, 125, 41, 59, 10, 97, 74, 61, 37, 114,
+101, 103, 101, 120, 112, 95, 105, 110, 116, 101, 114, 110, 97, 108, 95, 109, 97,
+116, 99, 104, 40, 47, 109, 123, 49, 44, 50, 125, 47, 44, 98, 78, 41, 59, 10, 67,
+61, 97, 112, 112, 101, 110, 100, 84, 111, 68, 97, 116, 101, 84, 105, 109, 101,
+79, 98, 106, 101, 99, 116, 40, 10, 67, 44, 39, 109, 105, 110, 117, 116, 101, 39,
+44, 97, 74, 44, 123, 109, 58, 39, 110, 117, 109, 101, 114, 105, 99, 39, 44, 109,
+109, 58, 39, 50, 45, 100, 105, 103, 105, 116, 39, 125, 41, 59, 10, 97, 74, 61,
+37, 114, 101, 103, 101, 120, 112, 95, 105, 110, 116, 101, 114, 110, 97, 108, 95,
+109, 97, 116, 99, 104, 40, 47, 115, 123, 49, 44, 50, 125, 47, 44, 98, 78, 41,
+59, 10, 67, 61, 97, 112, 112, 101, 110, 100, 84, 111, 68, 97, 116, 101, 84, 105,
+109, 101, 79, 98, 106, 101, 99, 116, 40, 10, 67, 44, 39, 115, 101, 99, 111, 110,
+100, 39, 44, 97, 74, 44, 123, 115, 58, 39, 110, 117, 109, 101, 114, 105, 99, 39,
+44, 115, 115, 58, 39, 50, 45, 100, 105, 103, 105, 116, 39, 125, 41, 59, 10, 97,
+74, 61, 37, 114, 101, 103, 101, 120, 112, 95, 105, 110, 116, 101, 114, 110, 97,
+108, 95, 109, 97, 116, 99, 104, 40, 47, 122, 124, 122, 122, 122, 122, 47, 44,
+98, 78, 41, 59, 10, 67, 61, 97, 112, 112, 101, 110, 100, 84, 111, 68, 97, 116,
+101, 84, 105, 109, 101, 79, 98, 106, 101, 99, 116, 40, 10, 67, 44, 39, 116, 105,
+109, 101, 90, 111, 110, 101, 78, 97, 109, 101, 39, 44, 97, 74, 44, 123, 122, 58,
+39, 115, 104, 111, 114, 116, 39, 44, 122, 122, 122, 122, 58, 39, 108, 111, 110,
+103, 39, 125, 41, 59, 10, 114, 101, 116, 117, 114, 110, 32, 67, 59, 10, 125, 10,
+102, 117, 110, 99, 116, 105, 111, 110, 32, 97, 112, 112, 101, 110, 100, 84, 111,
+68, 97, 116, 101, 84, 105, 109, 101, 79, 98, 106, 101, 99, 116, 40, 67, 44, 98,
+79, 44, 97, 74, 44, 98, 81, 41, 123, 10, 105, 102, 40, 40, 97, 74, 61, 61, 61,
+110, 117, 108, 108, 41, 41, 123, 10, 105, 102, 40, 33, 40, 37, 95, 67, 97, 108,
+108, 40, 114, 44, 67, 44, 98, 79, 41, 41, 41, 123, 10, 100, 101, 102, 105, 110,
+101, 87, 69, 80, 114, 111, 112, 101, 114, 116, 121, 40, 67, 44, 98, 79, 44, 40,
+118, 111, 105, 100, 32, 48, 41, 41, 59, 10, 125, 10, 114, 101, 116, 117, 114,
+110, 32, 67, 59, 10, 125, 10, 118, 97, 114, 32, 97, 100, 61, 97, 74, 91, 48, 93,
+59, 10, 100, 101, 102, 105, 110, 101, 87, 69, 80, 114, 111, 112, 101, 114, 116,
+121, 40, 67, 44, 98, 79, 44, 98, 81, 91, 97, 100, 93, 41, 59, 10, 114, 101, 116,
+117, 114, 110, 32, 67, 59, 10, 125, 10, 102, 117, 110, 99, 116, 105, 111, 110,
+32, 116, 111, 68, 97, 116, 101, 84, 105, 109, 101, 79, 112, 116, 105, 111, 110,
+115, 40, 67, 44, 98, 82, 44, 98, 83, 41, 123, 10, 105, 102, 40, 40, 67, 61, 61,
+61, 40, 118, 111, 105, 100, 32, 48, 41, 41, 41, 123, 10, 67, 61, 123, 95, 95,
+112, 114, 111, 116, 111, 95, 95, 58, 110, 117, 108, 108, 125, 59, 10, 125, 101,
+108, 115, 101, 123, 10, 67, 61, 40, 37, 95, 84, 111, 79, 98, 106, 101, 99, 116,
+40, 67, 41, 41, 59, 10, 125, 10, 67, 61, 37, 111, 98, 106, 101, 99, 116, 95, 99,
+114, 101, 97, 116, 101, 40, 67, 41, 59, 10, 118, 97, 114, 32, 98, 84, 61, 116,
+114, 117, 101, 59, 10, 105, 102, 40, 40, 98, 82, 61, 61, 61, 39, 100, 97, 116,
+101, 39, 124, 124, 98, 82, 61, 61, 61, 39, 97, 110, 121, 39, 41, 38, 38, 10, 40,
+33, 40, 67, 46, 119, 101, 101, 107, 100, 97, 121, 61, 61, 61, 40, 118, 111, 105,
+100, 32, 48, 41, 41, 124, 124, 33, 40, 67, 46, 121, 101, 97, 114, 61, 61, 61,
+40, 118, 111, 105, 100, 32, 48, 41, 41, 124, 124, 10, 33, 40, 67, 46, 109, 111,
+110, 116, 104, 61, 61, 61, 40, 118, 111, 105, 100, 32, 48, 41, 41, 124, 124, 33,
+40, 67, 46, 100, 97, 121, 61, 61, 61, 40, 118, 111, 105, 100, 32, 48, 41, 41,
+41, 41, 123, 10, 98, 84, 61, 102, 97, 108, 115, 101, 59, 10, 125, 10, 105, 102,
+40, 40, 98, 82, 61, 61, 61, 39, 116, 105, 109, 101, 39, 124, 124, 98, 82, 61,
+61, 61, 39, 97, 110, 121, 39, 41, 38, 38, 10, 40, 33, 40, 67, 46, 104, 111, 117,
+114, 61, 61, 61, 40, 118, 111, 105, 100, 32, 48, 41, 41, 124, 124, 33, 40, 67,
+46, 109, 105, 110, 117, 116, 101, 61, 61, 61, 40, 118, 111, 105, 100, 32, 48,
+41, 41, 124, 124, 10, 33, 40, 67, 46, 115, 101, 99, 111, 110, 100, 61, 61, 61,
+40, 118, 111, 105, 100, 32, 48, 41, 41, 41, 41, 123, 10, 98, 84, 61, 102, 97,
+108, 115, 101, 59, 10, 125, 10, 105, 102, 40, 98, 84, 38, 38, 40, 98, 83, 61,
+61, 61, 39, 100, 97, 116, 101, 39, 124, 124, 98, 83, 61, 61, 61, 39, 97, 108,
+108, 39, 41, 41, 123, 10, 37, 111, 98, 106, 101, 99, 116, 95, 100, 101, 102,
+105, 110, 101, 95, 112, 114, 111, 112, 101, 114, 116, 121, 40, 67, 44, 39, 121,
+101, 97, 114, 39, 44, 123, 118, 97, 108, 117, 101, 58, 39, 110, 117, 109, 101,
+114, 105, 99, 39, 44, 10, 119, 114, 105, 116, 97, 98, 108, 101, 58, 116, 114,
+117, 101, 44, 10, 101, 110, 117, 109, 101, 114, 97, 98, 108, 101, 58, 116, 114,
+117, 101, 44, 10, 99, 111, 110, 102, 105, 103, 117, 114, 97, 98, 108, 101, 58,
+116, 114, 117, 101, 125, 41, 59, 10, 37, 111, 98, 106, 101, 99, 116, 95, 100,
+101, 102, 105, 110, 101, 95, 112, 114, 111, 112, 101, 114, 116, 121, 40, 67, 44,
+39, 109, 111, 110, 116, 104, 39, 44, 123, 118, 97, 108, 117, 101, 58, 39, 110,
+117, 109, 101, 114, 105, 99, 39, 44, 10, 119, 114, 105, 116, 97, 98, 108, 101,
+58, 116, 114, 117, 101, 44, 10, 101, 110, 117, 109, 101, 114, 97, 98, 108, 101,
+58, 116, 114, 117, 101, 44, 10, 99, 111, 110, 102, 105, 103, 117, 114, 97, 98,
+108, 101, 58, 116, 114, 117, 101, 125, 41, 59, 10, 37, 111, 98, 106, 101, 99,
+116, 95, 100, 101, 102, 105, 110, 101, 95, 112, 114, 111, 112, 101, 114, 116,
+121, 40, 67, 44, 39, 100, 97, 121, 39, 44, 123, 118, 97, 108, 117, 101, 58, 39,
+110, 117, 109, 101, 114, 105, 99, 39, 44, 10, 119, 114, 105, 116, 97, 98, 108,
+101, 58, 116, 114, 117, 101, 44, 10, 101, 110, 117, 109, 101, 114, 97, 98, 108,
+101, 58, 116, 114, 117, 101, 44, 10, 99, 111, 110, 102, 105, 103, 117, 114, 97,
+98, 108, 101, 58, 116, 114, 117, 101, 125, 41, 59, 10, 125, 10, 105, 102, 40,
+98, 84, 38, 38, 40, 98, 83, 61, 61, 61, 39, 116, 105, 109, 101, 39, 124, 124,
+98, 83, 61, 61, 61, 39, 97, 108, 108, 39, 41, 41, 123, 10, 37, 111, 98, 106,
+101, 99, 116, 95, 100, 101, 102, 105, 110, 101, 95, 112, 114, 111, 112, 101,
+114, 116, 121, 40, 67, 44, 39, 104, 111, 117, 114, 39, 44, 123, 118, 97, 108,
+117, 101, 58, 39, 110, 117, 109, 101, 114, 105, 99, 39, 44, 10, 119, 114, 105,
+116, 97, 98, 108, 101, 58, 116, 114, 117, 101, 44, 10, 101, 110, 117, 109, 101,
+114, 97, 98, 108, 101, 58, 116, 114, 117, 101, 44, 10, 99, 111, 110, 102, 105,
+103, 117, 114, 97, 98, 108, 101, 58, 116, 114, 117, 101, 125, 41, 59, 10, 37,
+111, 98, 106, 101, 99, 116, 95, 100, 101, 102, 105, 110, 101, 95, 112, 114, 111,
+112, 101, 114, 116, 121, 40, 67, 44, 39, 109, 105, 110, 117, 116, 101, 39, 44,
+123, 118, 97, 108, 117, 101, 58, 39, 110, 117, 109, 101, 114, 105, 99, 39, 44,
+10, 119, 114, 105, 116, 97, 98, 108, 101, 58, 116, 114, 117, 101, 44, 10, 101,
+110, 117, 109, 101, 114, 97, 98, 108, 101, 58, 116, 114, 117, 101, 44, 10, 99,
+111, 110, 102, 105, 103, 117, 114, 97, 98, 108, 101, 58, 116, 114, 117, 101,
+125, 41, 59, 10, 37, 111, 98, 106, 101, 99, 116, 95, 100, 101, 102, 105, 110,
+101, 95, 112, 114, 111, 112, 101, 114, 116, 121, 40, 67, 44, 39, 115, 101, 99,
+111, 110, 100, 39, 44, 123, 118, 97, 108, 117, 101, 58, 39, 110, 117, 109, 101,
+114, 105, 99, 39, 44, 10, 119, 114, 105, 116, 97, 98, 108, 101, 58, 116, 114,
+117, 101, 44, 10, 101, 110, 117, 109, 101, 114, 97, 98, 108, 101, 58, 116, 114,
+117, 101, 44, 10, 99, 111, 110, 102, 105, 103, 117, 114, 97, 98, 108, 101, 58,
+116, 114, 117, 101, 125, 41, 59, 10, 125, 10, 114, 101, 116, 117, 114, 110, 32,
+67, 59, 10, 125, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 67, 114, 101,
+97, 116, 101, 68, 97, 116, 101, 84, 105, 109, 101, 70, 111, 114, 109, 97, 116,
+40, 66, 44, 67, 41, 123, 10, 105, 102, 40, 40, 67, 61, 61, 61, 40, 118, 111,
+105, 100, 32, 48, 41, 41, 41, 123, 10, 67, 61, 123, 95, 95, 112, 114, 111, 116,
+111, 95, 95, 58, 110, 117, 108, 108, 125, 59, 10, 125, 10, 118, 97, 114, 32, 90,
+61, 114, 101, 115, 111, 108, 118, 101, 76, 111, 99, 97, 108, 101, 40, 39, 100,
+97, 116, 101, 102, 111, 114, 109, 97, 116, 39, 44, 66, 44, 67, 41, 59, 10, 67,
+61, 116, 111, 68, 97, 116, 101, 84, 105, 109, 101, 79, 112, 116, 105, 111, 110,
+115, 40, 67, 44, 39, 97, 110, 121, 39, 44, 39, 100, 97, 116, 101, 39, 41, 59,
+10, 118, 97, 114, 32, 97, 99, 61, 103, 101, 116, 71, 101, 116, 79, 112, 116,
+105, 111, 110, 40, 67, 44, 39, 100, 97, 116, 101, 102, 111, 114, 109, 97, 116,
+39, 41, 59, 10, 118, 97, 114, 32, 85, 61, 97, 99, 40, 39, 102, 111, 114, 109,
+97, 116, 77, 97, 116, 99, 104, 101, 114, 39, 44, 39, 115, 116, 114, 105, 110,
+103, 39, 44, 10, 91, 39, 98, 97, 115, 105, 99, 39, 44, 39, 98, 101, 115, 116,
+32, 102, 105, 116, 39, 93, 44, 39, 98, 101, 115, 116, 32, 102, 105, 116, 39, 41,
+59, 10, 118, 97, 114, 32, 98, 78, 61, 116, 111, 76, 68, 77, 76, 83, 116, 114,
+105, 110, 103, 40, 67, 41, 59, 10, 118, 97, 114, 32, 98, 85, 61, 99, 97, 110,
+111, 110, 105, 99, 97, 108, 105, 122, 101, 84, 105, 109, 101, 90, 111, 110, 101,
+73, 68, 40, 67, 46, 116, 105, 109, 101, 90, 111, 110, 101, 41, 59, 10, 118, 97,
+114, 32, 98, 108, 61, 123, 95, 95, 112, 114, 111, 116, 111, 95, 95, 58, 110,
+117, 108, 108, 125, 59, 10, 118, 97, 114, 32, 97, 114, 61, 112, 97, 114, 115,
+101, 69, 120, 116, 101, 110, 115, 105, 111, 110, 40, 90, 46, 101, 120, 116, 101,
+110, 115, 105, 111, 110, 41, 59, 10, 118, 97, 114, 32, 98, 86, 61, 123, 10, 39,
+99, 97, 39, 58, 123, 39, 112, 114, 111, 112, 101, 114, 116, 121, 39, 58, 40,
+118, 111, 105, 100, 32, 48, 41, 44, 39, 116, 121, 112, 101, 39, 58, 39, 115,
+116, 114, 105, 110, 103, 39, 125, 44, 10, 39, 110, 117, 39, 58, 123, 39, 112,
+114, 111, 112, 101, 114, 116, 121, 39, 58, 40, 118, 111, 105, 100, 32, 48, 41,
+44, 39, 116, 121, 112, 101, 39, 58, 39, 115, 116, 114, 105, 110, 103, 39, 125,
+10, 125, 59, 10, 118, 97, 114, 32, 97, 110, 61, 115, 101, 116, 79, 112, 116,
+105, 111, 110, 115, 40, 67, 44, 97, 114, 44, 98, 86, 44, 10, 97, 99, 44, 98,
+108, 41, 59, 10, 118, 97, 114, 32, 97, 106, 61, 90, 46, 108, 111, 99, 97, 108,
+101, 43, 97, 110, 59, 10, 118, 97, 114, 32, 97, 105, 61, 37, 111, 98, 106, 101,
+99, 116, 95, 100, 101, 102, 105, 110, 101, 95, 112, 114, 111, 112, 101, 114,
+116, 105, 101, 115, 40, 123, 95, 95, 112, 114, 111, 116, 111, 95, 95, 58, 110,
+117, 108, 108, 125, 44, 123, 10, 99, 97, 108, 101, 110, 100, 97, 114, 58, 123,
+119, 114, 105, 116, 97, 98, 108, 101, 58, 116, 114, 117, 101, 125, 44, 10, 100,
+97, 121, 58, 123, 119, 114, 105, 116, 97, 98, 108, 101, 58, 116, 114, 117, 101,
+125, 44, 10, 101, 114, 97, 58, 123, 119, 114, 105, 116, 97, 98, 108, 101, 58,
+116, 114, 117, 101, 125, 44, 10, 104, 111, 117, 114, 49, 50, 58, 123, 119, 114,
+105, 116, 97, 98, 108, 101, 58, 116, 114, 117, 101, 125, 44, 10, 104, 111, 117,
+114, 58, 123, 119, 114, 105, 116, 97, 98, 108, 101, 58, 116, 114, 117, 101, 125,
+44, 10, 108, 111, 99, 97, 108, 101, 58, 123, 119, 114, 105, 116, 97, 98, 108,
+101, 58, 116, 114, 117, 101, 125, 44, 10, 109, 105, 110, 117, 116, 101, 58, 123,
+119, 114, 105, 116, 97, 98, 108, 101, 58, 116, 114, 117, 101, 125, 44, 10, 109,
+111, 110, 116, 104, 58, 123, 119, 114, 105, 116, 97, 98, 108, 101, 58, 116, 114,
+117, 101, 125, 44, 10, 110, 117, 109, 98, 101, 114, 105, 110, 103, 83, 121, 115,
+116, 101, 109, 58, 123, 119, 114, 105, 116, 97, 98, 108, 101, 58, 116, 114, 117,
+101, 125, 44, 10, 91, 116, 93, 58, 123, 119, 114, 105, 116, 97, 98, 108, 101,
+58, 116, 114, 117, 101, 125, 44, 10, 114, 101, 113, 117, 101, 115, 116, 101,
+100, 76, 111, 99, 97, 108, 101, 58, 123, 118, 97, 108, 117, 101, 58, 97, 106,
+44, 119, 114, 105, 116, 97, 98, 108, 101, 58, 116, 114, 117, 101, 125, 44, 10,
+115, 101, 99, 111, 110, 100, 58, 123, 119, 114, 105, 116, 97, 98, 108, 101, 58,
+116, 114, 117, 101, 125, 44, 10, 116, 105, 109, 101, 90, 111, 110, 101, 58, 123,
+119, 114, 105, 116, 97, 98, 108, 101, 58, 116, 114, 117, 101, 125, 44, 10, 116,
+105, 109, 101, 90, 111, 110, 101, 78, 97, 109, 101, 58, 123, 119, 114, 105, 116,
+97, 98, 108, 101, 58, 116, 114, 117, 101, 125, 44, 10, 116, 122, 58, 123, 118,
+97, 108, 117, 101, 58, 98, 85, 44, 119, 114, 105, 116, 97, 98, 108, 101, 58,
+116, 114, 117, 101, 125, 44, 10, 119, 101, 101, 107, 100, 97, 121, 58, 123, 119,
+114, 105, 116, 97, 98, 108, 101, 58, 116, 114, 117, 101, 125, 44, 10, 121, 101,
+97, 114, 58, 123, 119, 114, 105, 116, 97, 98, 108, 101, 58, 116, 114, 117, 101,
+125, 10, 125, 41, 59, 10, 118, 97, 114, 32, 98, 87, 61, 37, 67, 114, 101, 97,
+116, 101, 68, 97, 116, 101, 84, 105, 109, 101, 70, 111, 114, 109, 97, 116, 40,
+10, 97, 106, 44, 123, 115, 107, 101, 108, 101, 116, 111, 110, 58, 98, 78, 44,
+116, 105, 109, 101, 90, 111, 110, 101, 58, 98, 85, 125, 44, 97, 105, 41, 59, 10,
+105, 102, 40, 97, 105, 46, 116, 105, 109, 101, 90, 111, 110, 101, 61, 61, 61,
+34, 69, 116, 99, 47, 85, 110, 107, 110, 111, 119, 110, 34, 41, 123, 10, 116,
+104, 114, 111, 119, 32, 37, 109, 97, 107, 101, 95, 114, 97, 110, 103, 101, 95,
+101, 114, 114, 111, 114, 40, 50, 48, 51, 44, 98, 85, 41, 59, 10, 125, 10, 37,
+77, 97, 114, 107, 65, 115, 73, 110, 105, 116, 105, 97, 108, 105, 122, 101, 100,
+73, 110, 116, 108, 79, 98, 106, 101, 99, 116, 79, 102, 84, 121, 112, 101, 40,
+98, 87, 44, 39, 100, 97, 116, 101, 102, 111, 114, 109, 97, 116, 39, 41, 59, 10,
+98, 87, 91, 117, 93, 61, 97, 105, 59, 10, 114, 101, 116, 117, 114, 110, 32, 98,
+87, 59, 10, 125, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 68, 97, 116,
+101, 84, 105, 109, 101, 70, 111, 114, 109, 97, 116, 67, 111, 110, 115, 116, 114,
+117, 99, 116, 111, 114, 40, 41, 123, 10, 114, 101, 116, 117, 114, 110, 32, 73,
+110, 116, 108, 67, 111, 110, 115, 116, 114, 117, 99, 116, 40, 116, 104, 105,
+115, 44, 103, 44, 67, 114, 101, 97, 116, 101, 68, 97, 116, 101, 84, 105, 109,
+101, 70, 111, 114, 109, 97, 116, 44, 10, 110, 101, 119, 46, 116, 97, 114, 103,
+101, 116, 44, 97, 114, 103, 117, 109, 101, 110, 116, 115, 44, 116, 114, 117,
+101, 41, 59, 10, 125, 10, 37, 83, 101, 116, 67, 111, 100, 101, 40, 103, 44, 68,
+97, 116, 101, 84, 105, 109, 101, 70, 111, 114, 109, 97, 116, 67, 111, 110, 115,
+116, 114, 117, 99, 116, 111, 114, 41, 59, 10, 37, 68, 101, 102, 105, 110, 101,
+77, 101, 116, 104, 111, 100, 115, 73, 110, 116, 101, 114, 110, 97, 108, 40, 103,
+46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 44, 99, 108, 97, 115, 115, 123,
+114, 101, 115, 111, 108, 118, 101, 100, 79, 112, 116, 105, 111, 110, 115, 40,
+41, 123, 10, 118, 97, 114, 32, 98, 75, 61, 85, 110, 119, 114, 97, 112, 40, 116,
+104, 105, 115, 44, 39, 100, 97, 116, 101, 102, 111, 114, 109, 97, 116, 39, 44,
+103, 44, 10, 39, 114, 101, 115, 111, 108, 118, 101, 100, 79, 112, 116, 105, 111,
+110, 115, 39, 44, 116, 114, 117, 101, 41, 59, 10, 118, 97, 114, 32, 98, 88, 61,
+123, 10, 39, 103, 114, 101, 103, 111, 114, 105, 97, 110, 39, 58, 39, 103, 114,
+101, 103, 111, 114, 121, 39, 44, 10, 39, 101, 116, 104, 105, 111, 112, 105, 99,
+45, 97, 109, 101, 116, 101, 45, 97, 108, 101, 109, 39, 58, 39, 101, 116, 104,
+105, 111, 97, 97, 39, 10, 125, 59, 10, 118, 97, 114, 32, 98, 89, 61, 102, 114,
+111, 109, 76, 68, 77, 76, 83, 116, 114, 105, 110, 103, 40, 98, 75, 91, 117, 93,
+91, 116, 93, 41, 59, 10, 118, 97, 114, 32, 98, 90, 61, 98, 88, 91, 98, 75, 91,
+117, 93, 46, 99, 97, 108, 101, 110, 100, 97, 114, 93, 59, 10, 105, 102, 40, 40,
+98, 90, 61, 61, 61, 40, 118, 111, 105, 100, 32, 48, 41, 41, 41, 123, 10, 98, 90,
+61, 98, 75, 91, 117, 93, 46, 99, 97, 108, 101, 110, 100, 97, 114, 59, 10, 125,
+10, 118, 97, 114, 32, 97, 111, 61, 123, 10, 108, 111, 99, 97, 108, 101, 58, 98,
+75, 91, 117, 93, 46, 108, 111, 99, 97, 108, 101, 44, 10, 110, 117, 109, 98, 101,
+114, 105, 110, 103, 83, 121, 115, 116, 101, 109, 58, 98, 75, 91, 117, 93, 46,
+110, 117, 109, 98, 101, 114, 105, 110, 103, 83, 121, 115, 116, 101, 109, 44, 10,
+99, 97, 108, 101, 110, 100, 97, 114, 58, 98, 90, 44, 10, 116, 105, 109, 101, 90,
+111, 110, 101, 58, 98, 75, 91, 117, 93, 46, 116, 105, 109, 101, 90, 111, 110,
+101, 10, 125, 59, 10, 97, 100, 100, 87, 69, 67, 80, 114, 111, 112, 101, 114,
+116, 121, 73, 102, 68, 101, 102, 105, 110, 101, 100, 40, 97, 111, 44, 39, 116,
+105, 109, 101, 90, 111, 110, 101, 78, 97, 109, 101, 39, 44, 98, 89, 46, 116,
+105, 109, 101, 90, 111, 110, 101, 78, 97, 109, 101, 41, 59, 10, 97, 100, 100,
+87, 69, 67, 80, 114, 111, 112, 101, 114, 116, 121, 73, 102, 68, 101, 102, 105,
+110, 101, 100, 40, 97, 111, 44, 39, 101, 114, 97, 39, 44, 98, 89, 46, 101, 114,
+97, 41, 59, 10, 97, 100, 100, 87, 69, 67, 80, 114, 111, 112, 101, 114, 116, 121,
+73, 102, 68, 101, 102, 105, 110, 101, 100, 40, 97, 111, 44, 39, 121, 101, 97,
+114, 39, 44, 98, 89, 46, 121, 101, 97, 114, 41, 59, 10, 97, 100, 100, 87, 69,
+67, 80, 114, 111, 112, 101, 114, 116, 121, 73, 102, 68, 101, 102, 105, 110, 101,
+100, 40, 97, 111, 44, 39, 109, 111, 110, 116, 104, 39, 44, 98, 89, 46, 109, 111,
+110, 116, 104, 41, 59, 10, 97, 100, 100, 87, 69, 67, 80, 114, 111, 112, 101,
+114, 116, 121, 73, 102, 68, 101, 102, 105, 110, 101, 100, 40, 97, 111, 44, 39,
+100, 97, 121, 39, 44, 98, 89, 46, 100, 97, 121, 41, 59, 10, 97, 100, 100, 87,
+69, 67, 80, 114, 111, 112, 101, 114, 116, 121, 73, 102, 68, 101, 102, 105, 110,
+101, 100, 40, 97, 111, 44, 39, 119, 101, 101, 107, 100, 97, 121, 39, 44, 98, 89,
+46, 119, 101, 101, 107, 100, 97, 121, 41, 59, 10, 97, 100, 100, 87, 69, 67, 80,
+114, 111, 112, 101, 114, 116, 121, 73, 102, 68, 101, 102, 105, 110, 101, 100,
+40, 97, 111, 44, 39, 104, 111, 117, 114, 49, 50, 39, 44, 98, 89, 46, 104, 111,
+117, 114, 49, 50, 41, 59, 10, 97, 100, 100, 87, 69, 67, 80, 114, 111, 112, 101,
+114, 116, 121, 73, 102, 68, 101, 102, 105, 110, 101, 100, 40, 97, 111, 44, 39,
+104, 111, 117, 114, 39, 44, 98, 89, 46, 104, 111, 117, 114, 41, 59, 10, 97, 100,
+100, 87, 69, 67, 80, 114, 111, 112, 101, 114, 116, 121, 73, 102, 68, 101, 102,
+105, 110, 101, 100, 40, 97, 111, 44, 39, 109, 105, 110, 117, 116, 101, 39, 44,
+98, 89, 46, 109, 105, 110, 117, 116, 101, 41, 59, 10, 97, 100, 100, 87, 69, 67,
+80, 114, 111, 112, 101, 114, 116, 121, 73, 102, 68, 101, 102, 105, 110, 101,
+100, 40, 97, 111, 44, 39, 115, 101, 99, 111, 110, 100, 39, 44, 98, 89, 46, 115,
+101, 99, 111, 110, 100, 41, 59, 10, 114, 101, 116, 117, 114, 110, 32, 97, 111,
+59, 10, 125, 125, 44, 45, 49, 41, 59, 10, 37, 68, 101, 102, 105, 110, 101, 77,
+101, 116, 104, 111, 100, 115, 73, 110, 116, 101, 114, 110, 97, 108, 40, 103, 44,
+99, 108, 97, 115, 115, 123, 115, 117, 112, 112, 111, 114, 116, 101, 100, 76,
+111, 99, 97, 108, 101, 115, 79, 102, 40, 66, 41, 123, 10, 114, 101, 116, 117,
+114, 110, 32, 115, 117, 112, 112, 111, 114, 116, 101, 100, 76, 111, 99, 97, 108,
+101, 115, 79, 102, 40, 39, 100, 97, 116, 101, 102, 111, 114, 109, 97, 116, 39,
+44, 66, 44, 97, 114, 103, 117, 109, 101, 110, 116, 115, 91, 49, 93, 41, 59, 10,
+125, 125, 44, 45, 49, 41, 59, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32,
+102, 111, 114, 109, 97, 116, 68, 97, 116, 101, 40, 98, 76, 44, 99, 97, 41, 123,
+10, 118, 97, 114, 32, 99, 98, 59, 10, 105, 102, 40, 40, 99, 97, 61, 61, 61, 40,
+118, 111, 105, 100, 32, 48, 41, 41, 41, 123, 10, 99, 98, 61, 37, 68, 97, 116,
+101, 67, 117, 114, 114, 101, 110, 116, 84, 105, 109, 101, 40, 41, 59, 10, 125,
+101, 108, 115, 101, 123, 10, 99, 98, 61, 40, 37, 95, 84, 111, 78, 117, 109, 98,
+101, 114, 40, 99, 97, 41, 41, 59, 10, 125, 10, 114, 101, 116, 117, 114, 110, 32,
+37, 73, 110, 116, 101, 114, 110, 97, 108, 68, 97, 116, 101, 70, 111, 114, 109,
+97, 116, 40, 98, 76, 44, 99, 98, 41, 59, 10, 125, 10, 37, 68, 101, 102, 105,
+110, 101, 77, 101, 116, 104, 111, 100, 115, 73, 110, 116, 101, 114, 110, 97,
+108, 40, 103, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 44, 99, 108, 97,
+115, 115, 123, 102, 111, 114, 109, 97, 116, 84, 111, 80, 97, 114, 116, 115, 40,
+99, 97, 41, 123, 10, 105, 102, 40, 40, 37, 73, 83, 95, 86, 65, 82, 40, 116, 104,
+105, 115, 41, 61, 61, 61, 110, 117, 108, 108, 41, 124, 124, 40, 116, 104, 105,
+115, 61, 61, 61, 40, 118, 111, 105, 100, 32, 48, 41, 41, 41, 116, 104, 114, 111,
+119, 32, 37, 109, 97, 107, 101, 95, 116, 121, 112, 101, 95, 101, 114, 114, 111,
+114, 40, 50, 55, 44, 34, 73, 110, 116, 108, 46, 68, 97, 116, 101, 84, 105, 109,
+101, 70, 111, 114, 109, 97, 116, 46, 112, 114, 111, 116, 111, 116, 121, 112,
+101, 46, 102, 111, 114, 109, 97, 116, 84, 111, 80, 97, 114, 116, 115, 34, 41,
+59, 10, 105, 102, 40, 33, 40, 116, 121, 112, 101, 111, 102, 40, 116, 104, 105,
+115, 41, 61, 61, 61, 39, 111, 98, 106, 101, 99, 116, 39, 41, 10, 41, 123, 10,
+116, 104, 114, 111, 119, 32, 37, 109, 97, 107, 101, 95, 116, 121, 112, 101, 95,
+101, 114, 114, 111, 114, 40, 50, 54, 44, 116, 104, 105, 115, 41, 59, 10, 125,
+10, 105, 102, 40, 33, 37, 73, 115, 73, 110, 105, 116, 105, 97, 108, 105, 122,
+101, 100, 73, 110, 116, 108, 79, 98, 106, 101, 99, 116, 79, 102, 84, 121, 112,
+101, 40, 116, 104, 105, 115, 44, 39, 100, 97, 116, 101, 102, 111, 114, 109, 97,
+116, 39, 41, 41, 123, 10, 116, 104, 114, 111, 119, 32, 37, 109, 97, 107, 101,
+95, 116, 121, 112, 101, 95, 101, 114, 114, 111, 114, 40, 54, 49, 44, 10, 39, 73,
+110, 116, 108, 46, 68, 97, 116, 101, 84, 105, 109, 101, 70, 111, 114, 109, 97,
+116, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 102, 111, 114, 109,
+97, 116, 84, 111, 80, 97, 114, 116, 115, 39, 44, 10, 116, 104, 105, 115, 41, 59,
+10, 125, 10, 118, 97, 114, 32, 99, 98, 59, 10, 105, 102, 40, 40, 99, 97, 61, 61,
+61, 40, 118, 111, 105, 100, 32, 48, 41, 41, 41, 123, 10, 99, 98, 61, 37, 68, 97,
+116, 101, 67, 117, 114, 114, 101, 110, 116, 84, 105, 109, 101, 40, 41, 59, 10,
+125, 101, 108, 115, 101, 123, 10, 99, 98, 61, 40, 37, 95, 84, 111, 78, 117, 109,
+98, 101, 114, 40, 99, 97, 41, 41, 59, 10, 125, 10, 114, 101, 116, 117, 114, 110,
+32, 37, 73, 110, 116, 101, 114, 110, 97, 108, 68, 97, 116, 101, 70, 111, 114,
+109, 97, 116, 84, 111, 80, 97, 114, 116, 115, 40, 116, 104, 105, 115, 44, 99,
+98, 41, 59, 10, 125, 125, 44, 45, 49, 41, 59, 10, 65, 100, 100, 66, 111, 117,
+110, 100, 77, 101, 116, 104, 111, 100, 40, 103, 44, 39, 102, 111, 114, 109, 97,
+116, 39, 44, 102, 111, 114, 109, 97, 116, 68, 97, 116, 101, 44, 49, 44, 39, 100,
+97, 116, 101, 102, 111, 114, 109, 97, 116, 39, 44, 10, 116, 114, 117, 101, 41,
+59, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 99, 97, 110, 111, 110, 105,
+99, 97, 108, 105, 122, 101, 84, 105, 109, 101, 90, 111, 110, 101, 73, 68, 40,
+99, 99, 41, 123, 10, 105, 102, 40, 40, 99, 99, 61, 61, 61, 40, 118, 111, 105,
+100, 32, 48, 41, 41, 41, 123, 10, 114, 101, 116, 117, 114, 110, 32, 99, 99, 59,
+10, 125, 10, 99, 99, 61, 40, 37, 95, 84, 111, 83, 116, 114, 105, 110, 103, 40,
+99, 99, 41, 41, 59, 10, 118, 97, 114, 32, 99, 100, 61, 37, 83, 116, 114, 105,
+110, 103, 84, 111, 85, 112, 112, 101, 114, 67, 97, 115, 101, 73, 110, 116, 108,
+40, 99, 99, 41, 59, 10, 105, 102, 40, 99, 100, 61, 61, 61, 39, 85, 84, 67, 39,
+124, 124, 99, 100, 61, 61, 61, 39, 71, 77, 84, 39, 124, 124, 10, 99, 100, 61,
+61, 61, 39, 69, 84, 67, 47, 85, 84, 67, 39, 124, 124, 99, 100, 61, 61, 61, 39,
+69, 84, 67, 47, 71, 77, 84, 39, 41, 123, 10, 114, 101, 116, 117, 114, 110, 39,
+85, 84, 67, 39, 59, 10, 125, 10, 118, 97, 114, 32, 97, 74, 61, 37, 114, 101,
+103, 101, 120, 112, 95, 105, 110, 116, 101, 114, 110, 97, 108, 95, 109, 97, 116,
+99, 104, 40, 71, 101, 116, 84, 105, 109, 101, 122, 111, 110, 101, 78, 97, 109,
+101, 67, 104, 101, 99, 107, 82, 69, 40, 41, 44, 99, 99, 41, 59, 10, 105, 102,
+40, 40, 97, 74, 61, 61, 61, 110, 117, 108, 108, 41, 41, 116, 104, 114, 111, 119,
+32, 37, 109, 97, 107, 101, 95, 114, 97, 110, 103, 101, 95, 101, 114, 114, 111,
+114, 40, 49, 55, 49, 44, 99, 99, 41, 59, 10, 118, 97, 114, 32, 97, 111, 61, 116,
+111, 84, 105, 116, 108, 101, 67, 97, 115, 101, 84, 105, 109, 101, 122, 111, 110,
+101, 76, 111, 99, 97, 116, 105, 111, 110, 40, 97, 74, 91, 49, 93, 41, 43, 39,
+47, 39, 43, 10, 116, 111, 84, 105, 116, 108, 101, 67, 97, 115, 101, 84, 105,
+109, 101, 122, 111, 110, 101, 76, 111, 99, 97, 116, 105, 111, 110, 40, 97, 74,
+91, 50, 93, 41, 59, 10, 105, 102, 40, 33, 40, 97, 74, 91, 51, 93, 61, 61, 61,
+40, 118, 111, 105, 100, 32, 48, 41, 41, 38, 38, 51, 60, 97, 74, 46, 108, 101,
+110, 103, 116, 104, 41, 123, 10, 118, 97, 114, 32, 99, 101, 61, 37, 83, 116,
+114, 105, 110, 103, 83, 112, 108, 105, 116, 40, 97, 74, 91, 51, 93, 44, 39, 47,
+39, 44, 52, 50, 57, 52, 57, 54, 55, 50, 57, 53, 41, 59, 10, 102, 111, 114, 40,
+118, 97, 114, 32, 89, 61, 49, 59, 89, 60, 99, 101, 46, 108, 101, 110, 103, 116,
+104, 59, 89, 43, 43, 41, 123, 10, 97, 111, 61, 97, 111, 43, 39, 47, 39, 43, 116,
+111, 84, 105, 116, 108, 101, 67, 97, 115, 101, 84, 105, 109, 101, 122, 111, 110,
+101, 76, 111, 99, 97, 116, 105, 111, 110, 40, 99, 101, 91, 89, 93, 41, 59, 10,
+125, 10, 125, 10, 114, 101, 116, 117, 114, 110, 32, 97, 111, 59, 10, 125, 10,
+102, 117, 110, 99, 116, 105, 111, 110, 32, 67, 114, 101, 97, 116, 101, 66, 114,
+101, 97, 107, 73, 116, 101, 114, 97, 116, 111, 114, 40, 66, 44, 67, 41, 123, 10,
+105, 102, 40, 40, 67, 61, 61, 61, 40, 118, 111, 105, 100, 32, 48, 41, 41, 41,
+123, 10, 67, 61, 123, 95, 95, 112, 114, 111, 116, 111, 95, 95, 58, 110, 117,
+108, 108, 125, 59, 10, 125, 10, 118, 97, 114, 32, 97, 99, 61, 103, 101, 116, 71,
+101, 116, 79, 112, 116, 105, 111, 110, 40, 67, 44, 39, 98, 114, 101, 97, 107,
+105, 116, 101, 114, 97, 116, 111, 114, 39, 41, 59, 10, 118, 97, 114, 32, 98,
+108, 61, 123, 95, 95, 112, 114, 111, 116, 111, 95, 95, 58, 110, 117, 108, 108,
+125, 59, 10, 100, 101, 102, 105, 110, 101, 87, 69, 80, 114, 111, 112, 101, 114,
+116, 121, 40, 98, 108, 44, 39, 116, 121, 112, 101, 39, 44, 97, 99, 40, 10, 39,
+116, 121, 112, 101, 39, 44, 39, 115, 116, 114, 105, 110, 103, 39, 44, 91, 39,
+99, 104, 97, 114, 97, 99, 116, 101, 114, 39, 44, 39, 119, 111, 114, 100, 39, 44,
+39, 115, 101, 110, 116, 101, 110, 99, 101, 39, 44, 39, 108, 105, 110, 101, 39,
+93, 44, 39, 119, 111, 114, 100, 39, 41, 41, 59, 10, 118, 97, 114, 32, 90, 61,
+114, 101, 115, 111, 108, 118, 101, 76, 111, 99, 97, 108, 101, 40, 39, 98, 114,
+101, 97, 107, 105, 116, 101, 114, 97, 116, 111, 114, 39, 44, 66, 44, 67, 41, 59,
+10, 118, 97, 114, 32, 97, 105, 61, 37, 111, 98, 106, 101, 99, 116, 95, 100, 101,
+102, 105, 110, 101, 95, 112, 114, 111, 112, 101, 114, 116, 105, 101, 115, 40,
+123, 95, 95, 112, 114, 111, 116, 111, 95, 95, 58, 110, 117, 108, 108, 125, 44,
+123, 10, 114, 101, 113, 117, 101, 115, 116, 101, 100, 76, 111, 99, 97, 108, 101,
+58, 123, 118, 97, 108, 117, 101, 58, 90, 46, 108, 111, 99, 97, 108, 101, 44,
+119, 114, 105, 116, 97, 98, 108, 101, 58, 116, 114, 117, 101, 125, 44, 10, 116,
+121, 112, 101, 58, 123, 118, 97, 108, 117, 101, 58, 98, 108, 46, 116, 121, 112,
+101, 44, 119, 114, 105, 116, 97, 98, 108, 101, 58, 116, 114, 117, 101, 125, 44,
+10, 108, 111, 99, 97, 108, 101, 58, 123, 119, 114, 105, 116, 97, 98, 108, 101,
+58, 116, 114, 117, 101, 125, 10, 125, 41, 59, 10, 118, 97, 114, 32, 99, 102, 61,
+37, 67, 114, 101, 97, 116, 101, 66, 114, 101, 97, 107, 73, 116, 101, 114, 97,
+116, 111, 114, 40, 90, 46, 108, 111, 99, 97, 108, 101, 44, 98, 108, 44, 97, 105,
+41, 59, 10, 37, 77, 97, 114, 107, 65, 115, 73, 110, 105, 116, 105, 97, 108, 105,
+122, 101, 100, 73, 110, 116, 108, 79, 98, 106, 101, 99, 116, 79, 102, 84, 121,
+112, 101, 40, 99, 102, 44, 39, 98, 114, 101, 97, 107, 105, 116, 101, 114, 97,
+116, 111, 114, 39, 41, 59, 10, 99, 102, 91, 117, 93, 61, 97, 105, 59, 10, 114,
+101, 116, 117, 114, 110, 32, 99, 102, 59, 10, 125, 10, 102, 117, 110, 99, 116,
+105, 111, 110, 32, 118, 56, 66, 114, 101, 97, 107, 73, 116, 101, 114, 97, 116,
+111, 114, 67, 111, 110, 115, 116, 114, 117, 99, 116, 111, 114, 40, 41, 123, 10,
+114, 101, 116, 117, 114, 110, 32, 73, 110, 116, 108, 67, 111, 110, 115, 116,
+114, 117, 99, 116, 40, 116, 104, 105, 115, 44, 107, 44, 67, 114, 101, 97, 116,
+101, 66, 114, 101, 97, 107, 73, 116, 101, 114, 97, 116, 111, 114, 44, 10, 110,
+101, 119, 46, 116, 97, 114, 103, 101, 116, 44, 97, 114, 103, 117, 109, 101, 110,
+116, 115, 41, 59, 10, 125, 10, 37, 83, 101, 116, 67, 111, 100, 101, 40, 107, 44,
+118, 56, 66, 114, 101, 97, 107, 73, 116, 101, 114, 97, 116, 111, 114, 67, 111,
+110, 115, 116, 114, 117, 99, 116, 111, 114, 41, 59, 10, 37, 68, 101, 102, 105,
+110, 101, 77, 101, 116, 104, 111, 100, 115, 73, 110, 116, 101, 114, 110, 97,
+108, 40, 107, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 44, 99, 108, 97,
+115, 115, 123, 114, 101, 115, 111, 108, 118, 101, 100, 79, 112, 116, 105, 111,
+110, 115, 40, 41, 123, 10, 105, 102, 40, 33, 40, 110, 101, 119, 46, 116, 97,
+114, 103, 101, 116, 61, 61, 61, 40, 118, 111, 105, 100, 32, 48, 41, 41, 41, 123,
+10, 116, 104, 114, 111, 119, 32, 37, 109, 97, 107, 101, 95, 116, 121, 112, 101,
+95, 101, 114, 114, 111, 114, 40, 49, 48, 50, 41, 59, 10, 125, 10, 118, 97, 114,
+32, 99, 103, 61, 85, 110, 119, 114, 97, 112, 40, 116, 104, 105, 115, 44, 39, 98,
+114, 101, 97, 107, 105, 116, 101, 114, 97, 116, 111, 114, 39, 44, 107, 44, 10,
+39, 114, 101, 115, 111, 108, 118, 101, 100, 79, 112, 116, 105, 111, 110, 115,
+39, 44, 102, 97, 108, 115, 101, 41, 59, 10, 114, 101, 116, 117, 114, 110, 123,
+10, 108, 111, 99, 97, 108, 101, 58, 99, 103, 91, 117, 93, 46, 108, 111, 99, 97,
+108, 101, 44, 10, 116, 121, 112, 101, 58, 99, 103, 91, 117, 93, 46, 116, 121,
+112, 101, 10, 125, 59, 10, 125, 125, 44, 45, 49, 41, 59, 10, 37, 68, 101, 102,
+105, 110, 101, 77, 101, 116, 104, 111, 100, 115, 73, 110, 116, 101, 114, 110,
+97, 108, 40, 107, 44, 99, 108, 97, 115, 115, 123, 115, 117, 112, 112, 111, 114,
+116, 101, 100, 76, 111, 99, 97, 108, 101, 115, 79, 102, 40, 66, 41, 123, 10,
+105, 102, 40, 33, 40, 110, 101, 119, 46, 116, 97, 114, 103, 101, 116, 61, 61,
+61, 40, 118, 111, 105, 100, 32, 48, 41, 41, 41, 123, 10, 116, 104, 114, 111,
+119, 32, 37, 109, 97, 107, 101, 95, 116, 121, 112, 101, 95, 101, 114, 114, 111,
+114, 40, 49, 48, 50, 41, 59, 10, 125, 10, 114, 101, 116, 117, 114, 110, 32, 115,
+117, 112, 112, 111, 114, 116, 101, 100, 76, 111, 99, 97, 108, 101, 115, 79, 102,
+40, 39, 98, 114, 101, 97, 107, 105, 116, 101, 114, 97, 116, 111, 114, 39, 44,
+66, 44, 97, 114, 103, 117, 109, 101, 110, 116, 115, 91, 49, 93, 41, 59, 10, 125,
+125, 44, 45, 49, 41, 59, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 97, 100,
+111, 112, 116, 84, 101, 120, 116, 40, 99, 102, 44, 99, 104, 41, 123, 10, 37, 66,
+114, 101, 97, 107, 73, 116, 101, 114, 97, 116, 111, 114, 65, 100, 111, 112, 116,
+84, 101, 120, 116, 40, 99, 102, 44, 40, 37, 95, 84, 111, 83, 116, 114, 105, 110,
+103, 40, 99, 104, 41, 41, 41, 59, 10, 125, 10, 102, 117, 110, 99, 116, 105, 111,
+110, 32, 102, 105, 114, 115, 116, 40, 99, 102, 41, 123, 10, 114, 101, 116, 117,
+114, 110, 32, 37, 66, 114, 101, 97, 107, 73, 116, 101, 114, 97, 116, 111, 114,
+70, 105, 114, 115, 116, 40, 99, 102, 41, 59, 10, 125, 10, 102, 117, 110, 99,
+116, 105, 111, 110, 32, 110, 101, 120, 116, 40, 99, 102, 41, 123, 10, 114, 101,
+116, 117, 114, 110, 32, 37, 66, 114, 101, 97, 107, 73, 116, 101, 114, 97, 116,
+111, 114, 78, 101, 120, 116, 40, 99, 102, 41, 59, 10, 125, 10, 102, 117, 110,
+99, 116, 105, 111, 110, 32, 99, 117, 114, 114, 101, 110, 116, 40, 99, 102, 41,
+123, 10, 114, 101, 116, 117, 114, 110, 32, 37, 66, 114, 101, 97, 107, 73, 116,
+101, 114, 97, 116, 111, 114, 67, 117, 114, 114, 101, 110, 116, 40, 99, 102, 41,
+59, 10, 125, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 98, 114, 101, 97,
+107, 84, 121, 112, 101, 40, 99, 102, 41, 123, 10, 114, 101, 116, 117, 114, 110,
+32, 37, 66, 114, 101, 97, 107, 73, 116, 101, 114, 97, 116, 111, 114, 66, 114,
+101, 97, 107, 84, 121, 112, 101, 40, 99, 102, 41, 59, 10, 125, 10, 65, 100, 100,
+66, 111, 117, 110, 100, 77, 101, 116, 104, 111, 100, 40, 107, 44, 39, 97, 100,
+111, 112, 116, 84, 101, 120, 116, 39, 44, 97, 100, 111, 112, 116, 84, 101, 120,
+116, 44, 49, 44, 10, 39, 98, 114, 101, 97, 107, 105, 116, 101, 114, 97, 116,
+111, 114, 39, 41, 59, 10, 65, 100, 100, 66, 111, 117, 110, 100, 77, 101, 116,
+104, 111, 100, 40, 107, 44, 39, 102, 105, 114, 115, 116, 39, 44, 102, 105, 114,
+115, 116, 44, 48, 44, 39, 98, 114, 101, 97, 107, 105, 116, 101, 114, 97, 116,
+111, 114, 39, 41, 59, 10, 65, 100, 100, 66, 111, 117, 110, 100, 77, 101, 116,
+104, 111, 100, 40, 107, 44, 39, 110, 101, 120, 116, 39, 44, 110, 101, 120, 116,
+44, 48, 44, 39, 98, 114, 101, 97, 107, 105, 116, 101, 114, 97, 116, 111, 114,
+39, 41, 59, 10, 65, 100, 100, 66, 111, 117, 110, 100, 77, 101, 116, 104, 111,
+100, 40, 107, 44, 39, 99, 117, 114, 114, 101, 110, 116, 39, 44, 99, 117, 114,
+114, 101, 110, 116, 44, 48, 44, 10, 39, 98, 114, 101, 97, 107, 105, 116, 101,
+114, 97, 116, 111, 114, 39, 41, 59, 10, 65, 100, 100, 66, 111, 117, 110, 100,
+77, 101, 116, 104, 111, 100, 40, 107, 44, 39, 98, 114, 101, 97, 107, 84, 121,
+112, 101, 39, 44, 98, 114, 101, 97, 107, 84, 121, 112, 101, 44, 48, 44, 10, 39,
+98, 114, 101, 97, 107, 105, 116, 101, 114, 97, 116, 111, 114, 39, 41, 59, 10,
+118, 97, 114, 32, 99, 105, 61, 123, 10, 39, 99, 111, 108, 108, 97, 116, 111,
+114, 39, 58, 105, 44, 10, 39, 110, 117, 109, 98, 101, 114, 102, 111, 114, 109,
+97, 116, 39, 58, 104, 44, 10, 39, 100, 97, 116, 101, 102, 111, 114, 109, 97,
+116, 97, 108, 108, 39, 58, 103, 44, 10, 39, 100, 97, 116, 101, 102, 111, 114,
+109, 97, 116, 100, 97, 116, 101, 39, 58, 103, 44, 10, 39, 100, 97, 116, 101,
+102, 111, 114, 109, 97, 116, 116, 105, 109, 101, 39, 58, 103, 10, 125, 59, 10,
+118, 97, 114, 32, 99, 106, 61, 123, 10, 39, 99, 111, 108, 108, 97, 116, 111,
+114, 39, 58, 40, 118, 111, 105, 100, 32, 48, 41, 44, 10, 39, 110, 117, 109, 98,
+101, 114, 102, 111, 114, 109, 97, 116, 39, 58, 40, 118, 111, 105, 100, 32, 48,
+41, 44, 10, 39, 100, 97, 116, 101, 102, 111, 114, 109, 97, 116, 97, 108, 108,
+39, 58, 40, 118, 111, 105, 100, 32, 48, 41, 44, 10, 39, 100, 97, 116, 101, 102,
+111, 114, 109, 97, 116, 100, 97, 116, 101, 39, 58, 40, 118, 111, 105, 100, 32,
+48, 41, 44, 10, 39, 100, 97, 116, 101, 102, 111, 114, 109, 97, 116, 116, 105,
+109, 101, 39, 58, 40, 118, 111, 105, 100, 32, 48, 41, 44, 10, 125, 59, 10, 102,
+117, 110, 99, 116, 105, 111, 110, 32, 99, 108, 101, 97, 114, 68, 101, 102, 97,
+117, 108, 116, 79, 98, 106, 101, 99, 116, 115, 40, 41, 123, 10, 99, 106, 91, 39,
+100, 97, 116, 101, 102, 111, 114, 109, 97, 116, 97, 108, 108, 39, 93, 61, 40,
+118, 111, 105, 100, 32, 48, 41, 59, 10, 99, 106, 91, 39, 100, 97, 116, 101, 102,
+111, 114, 109, 97, 116, 100, 97, 116, 101, 39, 93, 61, 40, 118, 111, 105, 100,
+32, 48, 41, 59, 10, 99, 106, 91, 39, 100, 97, 116, 101, 102, 111, 114, 109, 97,
+116, 116, 105, 109, 101, 39, 93, 61, 40, 118, 111, 105, 100, 32, 48, 41, 59, 10,
+125, 10, 118, 97, 114, 32, 99, 107, 61, 48, 59, 10, 102, 117, 110, 99, 116, 105,
+111, 110, 32, 99, 104, 101, 99, 107, 68, 97, 116, 101, 67, 97, 99, 104, 101, 67,
+117, 114, 114, 101, 110, 116, 40, 41, 123, 10, 118, 97, 114, 32, 99, 108, 61,
+37, 68, 97, 116, 101, 67, 97, 99, 104, 101, 86, 101, 114, 115, 105, 111, 110,
+40, 41, 59, 10, 105, 102, 40, 99, 108, 61, 61, 99, 107, 41, 123, 10, 114, 101,
+116, 117, 114, 110, 59, 10, 125, 10, 99, 107, 61, 99, 108, 59, 10, 99, 108, 101,
+97, 114, 68, 101, 102, 97, 117, 108, 116, 79, 98, 106, 101, 99, 116, 115, 40,
+41, 59, 10, 125, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 99, 97, 99, 104,
+101, 100, 79, 114, 78, 101, 119, 83, 101, 114, 118, 105, 99, 101, 40, 84, 44,
+66, 44, 67, 44, 98, 83, 41, 123, 10, 118, 97, 114, 32, 99, 109, 61, 40, 40, 98,
+83, 61, 61, 61, 40, 118, 111, 105, 100, 32, 48, 41, 41, 41, 63, 67, 58, 98, 83,
+59, 10, 105, 102, 40, 40, 66, 61, 61, 61, 40, 118, 111, 105, 100, 32, 48, 41,
+41, 38, 38, 40, 67, 61, 61, 61, 40, 118, 111, 105, 100, 32, 48, 41, 41, 41, 123,
+10, 99, 104, 101, 99, 107, 68, 97, 116, 101, 67, 97, 99, 104, 101, 67, 117, 114,
+114, 101, 110, 116, 40, 41, 59, 10, 105, 102, 40, 40, 99, 106, 91, 84, 93, 61,
+61, 61, 40, 118, 111, 105, 100, 32, 48, 41, 41, 41, 123, 10, 99, 106, 91, 84,
+93, 61, 110, 101, 119, 32, 99, 105, 91, 84, 93, 40, 66, 44, 99, 109, 41, 59, 10,
+125, 10, 114, 101, 116, 117, 114, 110, 32, 99, 106, 91, 84, 93, 59, 10, 125, 10,
+114, 101, 116, 117, 114, 110, 32, 110, 101, 119, 32, 99, 105, 91, 84, 93, 40,
+66, 44, 99, 109, 41, 59, 10, 125, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32,
+76, 111, 99, 97, 108, 101, 67, 111, 110, 118, 101, 114, 116, 67, 97, 115, 101,
+40, 99, 110, 44, 66, 44, 99, 111, 41, 123, 10, 118, 97, 114, 32, 98, 105, 59,
+10, 105, 102, 40, 40, 66, 61, 61, 61, 40, 118, 111, 105, 100, 32, 48, 41, 41,
+41, 123, 10, 98, 105, 61, 71, 101, 116, 68, 101, 102, 97, 117, 108, 116, 73, 67,
+85, 76, 111, 99, 97, 108, 101, 74, 83, 40, 41, 59, 10, 125, 101, 108, 115, 101,
+32, 105, 102, 40, 40, 116, 121, 112, 101, 111, 102, 40, 66, 41, 61, 61, 61, 39,
+115, 116, 114, 105, 110, 103, 39, 41, 41, 123, 10, 98, 105, 61, 99, 97, 110,
+111, 110, 105, 99, 97, 108, 105, 122, 101, 76, 97, 110, 103, 117, 97, 103, 101,
+84, 97, 103, 40, 66, 41, 59, 10, 125, 101, 108, 115, 101, 123, 10, 118, 97, 114,
+32, 66, 61, 105, 110, 105, 116, 105, 97, 108, 105, 122, 101, 76, 111, 99, 97,
+108, 101, 76, 105, 115, 116, 40, 66, 41, 59, 10, 98, 105, 61, 66, 46, 108, 101,
+110, 103, 116, 104, 62, 48, 63, 66, 91, 48, 93, 58, 71, 101, 116, 68, 101, 102,
+97, 117, 108, 116, 73, 67, 85, 76, 111, 99, 97, 108, 101, 74, 83, 40, 41, 59,
+10, 125, 10, 118, 97, 114, 32, 97, 97, 61, 37, 83, 116, 114, 105, 110, 103, 73,
+110, 100, 101, 120, 79, 102, 40, 98, 105, 44, 39, 45, 39, 44, 48, 41, 59, 10,
+105, 102, 40, 97, 97, 33, 61, 61, 45, 49, 41, 123, 10, 98, 105, 61, 37, 95, 67,
+97, 108, 108, 40, 119, 44, 98, 105, 44, 48, 44, 97, 97, 41, 59, 10, 125, 10,
+114, 101, 116, 117, 114, 110, 32, 37, 83, 116, 114, 105, 110, 103, 76, 111, 99,
+97, 108, 101, 67, 111, 110, 118, 101, 114, 116, 67, 97, 115, 101, 40, 99, 110,
+44, 99, 111, 44, 98, 105, 41, 59, 10, 125, 10, 37, 68, 101, 102, 105, 110, 101,
+77, 101, 116, 104, 111, 100, 115, 73, 110, 116, 101, 114, 110, 97, 108, 40, 110,
+46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 44, 99, 108, 97, 115, 115, 123,
+108, 111, 99, 97, 108, 101, 67, 111, 109, 112, 97, 114, 101, 40, 116, 104, 97,
+116, 41, 123, 10, 105, 102, 40, 40, 116, 104, 105, 115, 61, 61, 110, 117, 108,
+108, 41, 41, 123, 10, 116, 104, 114, 111, 119, 32, 37, 109, 97, 107, 101, 95,
+116, 121, 112, 101, 95, 101, 114, 114, 111, 114, 40, 55, 49, 41, 59, 10, 125,
+10, 118, 97, 114, 32, 66, 61, 97, 114, 103, 117, 109, 101, 110, 116, 115, 91,
+49, 93, 59, 10, 118, 97, 114, 32, 67, 61, 97, 114, 103, 117, 109, 101, 110, 116,
+115, 91, 50, 93, 59, 10, 118, 97, 114, 32, 98, 113, 61, 99, 97, 99, 104, 101,
+100, 79, 114, 78, 101, 119, 83, 101, 114, 118, 105, 99, 101, 40, 39, 99, 111,
+108, 108, 97, 116, 111, 114, 39, 44, 66, 44, 67, 41, 59, 10, 114, 101, 116, 117,
+114, 110, 32, 99, 111, 109, 112, 97, 114, 101, 40, 98, 113, 44, 116, 104, 105,
+115, 44, 116, 104, 97, 116, 41, 59, 10, 125, 125, 44, 45, 49, 41, 59, 10, 37,
+68, 101, 102, 105, 110, 101, 77, 101, 116, 104, 111, 100, 115, 73, 110, 116,
+101, 114, 110, 97, 108, 40, 110, 46, 112, 114, 111, 116, 111, 116, 121, 112,
+101, 44, 99, 108, 97, 115, 115, 123, 10, 116, 111, 76, 111, 99, 97, 108, 101,
+76, 111, 119, 101, 114, 67, 97, 115, 101, 40, 66, 41, 123, 10, 105, 102, 40, 40,
+37, 73, 83, 95, 86, 65, 82, 40, 116, 104, 105, 115, 41, 61, 61, 61, 110, 117,
+108, 108, 41, 124, 124, 40, 116, 104, 105, 115, 61, 61, 61, 40, 118, 111, 105,
+100, 32, 48, 41, 41, 41, 116, 104, 114, 111, 119, 32, 37, 109, 97, 107, 101, 95,
+116, 121, 112, 101, 95, 101, 114, 114, 111, 114, 40, 50, 55, 44, 34, 83, 116,
+114, 105, 110, 103, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 116,
+111, 76, 111, 99, 97, 108, 101, 76, 111, 119, 101, 114, 67, 97, 115, 101, 34,
+41, 59, 10, 114, 101, 116, 117, 114, 110, 32, 76, 111, 99, 97, 108, 101, 67,
+111, 110, 118, 101, 114, 116, 67, 97, 115, 101, 40, 40, 37, 95, 84, 111, 83,
+116, 114, 105, 110, 103, 40, 116, 104, 105, 115, 41, 41, 44, 66, 44, 102, 97,
+108, 115, 101, 41, 59, 10, 125, 10, 116, 111, 76, 111, 99, 97, 108, 101, 85,
+112, 112, 101, 114, 67, 97, 115, 101, 40, 66, 41, 123, 10, 105, 102, 40, 40, 37,
+73, 83, 95, 86, 65, 82, 40, 116, 104, 105, 115, 41, 61, 61, 61, 110, 117, 108,
+108, 41, 124, 124, 40, 116, 104, 105, 115, 61, 61, 61, 40, 118, 111, 105, 100,
+32, 48, 41, 41, 41, 116, 104, 114, 111, 119, 32, 37, 109, 97, 107, 101, 95, 116,
+121, 112, 101, 95, 101, 114, 114, 111, 114, 40, 50, 55, 44, 34, 83, 116, 114,
+105, 110, 103, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 116, 111,
+76, 111, 99, 97, 108, 101, 85, 112, 112, 101, 114, 67, 97, 115, 101, 34, 41, 59,
+10, 114, 101, 116, 117, 114, 110, 32, 76, 111, 99, 97, 108, 101, 67, 111, 110,
+118, 101, 114, 116, 67, 97, 115, 101, 40, 40, 37, 95, 84, 111, 83, 116, 114,
+105, 110, 103, 40, 116, 104, 105, 115, 41, 41, 44, 66, 44, 116, 114, 117, 101,
+41, 59, 10, 125, 10, 125, 44, 48, 41, 59, 10, 37, 68, 101, 102, 105, 110, 101,
+77, 101, 116, 104, 111, 100, 115, 73, 110, 116, 101, 114, 110, 97, 108, 40, 108,
+46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 44, 99, 108, 97, 115, 115, 123,
+116, 111, 76, 111, 99, 97, 108, 101, 83, 116, 114, 105, 110, 103, 40, 41, 123,
+10, 105, 102, 40, 33, 40, 116, 104, 105, 115, 32, 105, 110, 115, 116, 97, 110,
+99, 101, 111, 102, 32, 108, 41, 38, 38, 116, 121, 112, 101, 111, 102, 40, 116,
+104, 105, 115, 41, 33, 61, 61, 39, 110, 117, 109, 98, 101, 114, 39, 41, 123, 10,
+116, 104, 114, 111, 119, 32, 37, 109, 97, 107, 101, 95, 116, 121, 112, 101, 95,
+101, 114, 114, 111, 114, 40, 55, 50, 44, 34, 78, 117, 109, 98, 101, 114, 34, 41,
+59, 10, 125, 10, 118, 97, 114, 32, 66, 61, 97, 114, 103, 117, 109, 101, 110,
+116, 115, 91, 48, 93, 59, 10, 118, 97, 114, 32, 67, 61, 97, 114, 103, 117, 109,
+101, 110, 116, 115, 91, 49, 93, 59, 10, 118, 97, 114, 32, 98, 74, 61, 99, 97,
+99, 104, 101, 100, 79, 114, 78, 101, 119, 83, 101, 114, 118, 105, 99, 101, 40,
+39, 110, 117, 109, 98, 101, 114, 102, 111, 114, 109, 97, 116, 39, 44, 66, 44,
+67, 41, 59, 10, 114, 101, 116, 117, 114, 110, 32, 102, 111, 114, 109, 97, 116,
+78, 117, 109, 98, 101, 114, 40, 98, 74, 44, 116, 104, 105, 115, 41, 59, 10, 125,
+125, 44, 45, 49, 41, 59, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 116,
+111, 76, 111, 99, 97, 108, 101, 68, 97, 116, 101, 84, 105, 109, 101, 40, 99,
+112, 44, 66, 44, 67, 44, 98, 82, 44, 98, 83, 44, 84, 41, 123, 10, 105, 102, 40,
+33, 40, 99, 112, 32, 105, 110, 115, 116, 97, 110, 99, 101, 111, 102, 32, 101,
+41, 41, 123, 10, 116, 104, 114, 111, 119, 32, 37, 109, 97, 107, 101, 95, 116,
+121, 112, 101, 95, 101, 114, 114, 111, 114, 40, 55, 50, 44, 34, 68, 97, 116,
+101, 34, 41, 59, 10, 125, 10, 118, 97, 114, 32, 99, 97, 61, 40, 37, 95, 84, 111,
+78, 117, 109, 98, 101, 114, 40, 99, 112, 41, 41, 59, 10, 105, 102, 40, 40, 37,
+73, 83, 95, 86, 65, 82, 40, 99, 97, 41, 33, 61, 61, 99, 97, 41, 10, 41, 114,
+101, 116, 117, 114, 110, 39, 73, 110, 118, 97, 108, 105, 100, 32, 68, 97, 116,
+101, 39, 59, 10, 118, 97, 114, 32, 98, 108, 61, 116, 111, 68, 97, 116, 101, 84,
+105, 109, 101, 79, 112, 116, 105, 111, 110, 115, 40, 67, 44, 98, 82, 44, 98, 83,
+41, 59, 10, 118, 97, 114, 32, 98, 87, 61, 10, 99, 97, 99, 104, 101, 100, 79,
+114, 78, 101, 119, 83, 101, 114, 118, 105, 99, 101, 40, 84, 44, 66, 44, 67, 44,
+98, 108, 41, 59, 10, 114, 101, 116, 117, 114, 110, 32, 102, 111, 114, 109, 97,
+116, 68, 97, 116, 101, 40, 98, 87, 44, 99, 112, 41, 59, 10, 125, 10, 37, 68,
+101, 102, 105, 110, 101, 77, 101, 116, 104, 111, 100, 115, 73, 110, 116, 101,
+114, 110, 97, 108, 40, 101, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 44,
+99, 108, 97, 115, 115, 123, 116, 111, 76, 111, 99, 97, 108, 101, 83, 116, 114,
+105, 110, 103, 40, 41, 123, 10, 118, 97, 114, 32, 66, 61, 97, 114, 103, 117,
+109, 101, 110, 116, 115, 91, 48, 93, 59, 10, 118, 97, 114, 32, 67, 61, 97, 114,
+103, 117, 109, 101, 110, 116, 115, 91, 49, 93, 59, 10, 114, 101, 116, 117, 114,
+110, 32, 116, 111, 76, 111, 99, 97, 108, 101, 68, 97, 116, 101, 84, 105, 109,
+101, 40, 10, 116, 104, 105, 115, 44, 66, 44, 67, 44, 39, 97, 110, 121, 39, 44,
+39, 97, 108, 108, 39, 44, 39, 100, 97, 116, 101, 102, 111, 114, 109, 97, 116,
+97, 108, 108, 39, 41, 59, 10, 125, 125, 44, 45, 49, 41, 59, 10, 37, 68, 101,
+102, 105, 110, 101, 77, 101, 116, 104, 111, 100, 115, 73, 110, 116, 101, 114,
+110, 97, 108, 40, 101, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 44, 99,
+108, 97, 115, 115, 123, 116, 111, 76, 111, 99, 97, 108, 101, 68, 97, 116, 101,
+83, 116, 114, 105, 110, 103, 40, 41, 123, 10, 118, 97, 114, 32, 66, 61, 97, 114,
+103, 117, 109, 101, 110, 116, 115, 91, 48, 93, 59, 10, 118, 97, 114, 32, 67, 61,
+97, 114, 103, 117, 109, 101, 110, 116, 115, 91, 49, 93, 59, 10, 114, 101, 116,
+117, 114, 110, 32, 116, 111, 76, 111, 99, 97, 108, 101, 68, 97, 116, 101, 84,
+105, 109, 101, 40, 10, 116, 104, 105, 115, 44, 66, 44, 67, 44, 39, 100, 97, 116,
+101, 39, 44, 39, 100, 97, 116, 101, 39, 44, 39, 100, 97, 116, 101, 102, 111,
+114, 109, 97, 116, 100, 97, 116, 101, 39, 41, 59, 10, 125, 125, 44, 45, 49, 41,
+59, 10, 37, 68, 101, 102, 105, 110, 101, 77, 101, 116, 104, 111, 100, 115, 73,
+110, 116, 101, 114, 110, 97, 108, 40, 101, 46, 112, 114, 111, 116, 111, 116,
+121, 112, 101, 44, 99, 108, 97, 115, 115, 123, 116, 111, 76, 111, 99, 97, 108,
+101, 84, 105, 109, 101, 83, 116, 114, 105, 110, 103, 40, 41, 123, 10, 118, 97,
+114, 32, 66, 61, 97, 114, 103, 117, 109, 101, 110, 116, 115, 91, 48, 93, 59, 10,
+118, 97, 114, 32, 67, 61, 97, 114, 103, 117, 109, 101, 110, 116, 115, 91, 49,
+93, 59, 10, 114, 101, 116, 117, 114, 110, 32, 116, 111, 76, 111, 99, 97, 108,
+101, 68, 97, 116, 101, 84, 105, 109, 101, 40, 10, 116, 104, 105, 115, 44, 66,
+44, 67, 44, 39, 116, 105, 109, 101, 39, 44, 39, 116, 105, 109, 101, 39, 44, 39,
+100, 97, 116, 101, 102, 111, 114, 109, 97, 116, 116, 105, 109, 101, 39, 41, 59,
+10, 125, 125, 44, 45, 49, 41, 59, 10, 125, 41, 10, 10 };
+
+  template <>
+  int NativesCollection<CORE>::GetBuiltinsCount() {
+    return 9;
+  }
+
+  template <>
+  int NativesCollection<CORE>::GetDebuggerCount() {
+    return 3;
+  }
+
+  template <>
+  int NativesCollection<CORE>::GetIndex(const char* name) {
+    if (strcmp(name, "mirrors") == 0) return 0;
+    if (strcmp(name, "debug") == 0) return 1;
+    if (strcmp(name, "liveedit") == 0) return 2;
+    if (strcmp(name, "prologue") == 0) return 3;
+    if (strcmp(name, "array") == 0) return 4;
+    if (strcmp(name, "typedarray") == 0) return 5;
+    if (strcmp(name, "messages") == 0) return 6;
+    if (strcmp(name, "spread") == 0) return 7;
+    if (strcmp(name, "intl") == 0) return 8;
+    return -1;
+  }
+
+  template <>
+  Vector<const char> NativesCollection<CORE>::GetScriptSource(int index) {
+    if (index == 0) return Vector<const char>(sources + 0, 31744);
+    if (index == 1) return Vector<const char>(sources + 31744, 5486);
+    if (index == 2) return Vector<const char>(sources + 37230, 15200);
+    if (index == 3) return Vector<const char>(sources + 52430, 2493);
+    if (index == 4) return Vector<const char>(sources + 54923, 14885);
+    if (index == 5) return Vector<const char>(sources + 69808, 1887);
+    if (index == 6) return Vector<const char>(sources + 71695, 543);
+    if (index == 7) return Vector<const char>(sources + 72238, 461);
+    if (index == 8) return Vector<const char>(sources + 72699, 32295);
+    return Vector<const char>("", 0);
+  }
+
+  template <>
+  Vector<const char> NativesCollection<CORE>::GetScriptName(int index) {
+    if (index == 0) return Vector<const char>("native mirrors.js", 17);
+    if (index == 1) return Vector<const char>("native debug.js", 15);
+    if (index == 2) return Vector<const char>("native liveedit.js", 18);
+    if (index == 3) return Vector<const char>("native prologue.js", 18);
+    if (index == 4) return Vector<const char>("native array.js", 15);
+    if (index == 5) return Vector<const char>("native typedarray.js", 20);
+    if (index == 6) return Vector<const char>("native messages.js", 18);
+    if (index == 7) return Vector<const char>("native spread.js", 16);
+    if (index == 8) return Vector<const char>("native intl.js", 14);
+    return Vector<const char>("", 0);
+  }
+
+  template <>
+  Vector<const char> NativesCollection<CORE>::GetScriptsSource() {
+    return Vector<const char>(sources, 104994);
+  }
+}  // internal
+}  // v8
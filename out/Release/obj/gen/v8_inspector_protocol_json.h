@@ -0,0 +1,580 @@
+0,230,39,120,218,237,125,107,111,220,200,149,232,95,41,120,23,144,188,104,
+119,102,119,129,221,139,236,39,89,178,51,10,108,75,176,236,204,5,174,12,
+52,213,172,86,115,196,46,118,88,164,165,222,65,254,251,61,143,122,145,172,
+98,179,37,57,227,73,6,8,38,114,147,172,199,169,83,231,253,248,229,69,
+94,109,178,66,233,23,127,252,127,191,188,88,86,155,77,166,114,254,135,202,
+54,242,197,31,95,44,75,153,213,239,165,214,217,173,212,47,102,47,114,169,
+151,117,177,109,138,74,193,211,179,74,106,161,170,102,93,168,219,249,139,191,
+205,220,103,121,161,179,155,82,14,63,224,223,181,88,86,74,87,165,20,60,
+255,76,108,107,249,85,170,70,139,85,91,55,107,89,187,23,54,102,110,177,
+170,171,141,184,145,48,147,168,229,182,170,27,153,139,166,18,240,178,88,150,
+5,124,219,89,128,84,209,249,223,168,248,244,90,194,190,105,44,55,223,178,
+42,75,185,196,89,116,37,86,89,221,157,76,220,236,224,213,76,105,81,173,
+240,231,107,181,48,95,158,228,185,204,23,8,149,98,85,44,51,156,24,86,
+246,165,191,146,79,235,66,155,233,5,254,37,1,2,240,54,76,247,74,180,
+90,138,143,173,106,138,141,20,85,45,222,85,183,2,206,168,145,89,62,167,
+29,217,87,95,252,177,169,91,57,51,135,8,131,158,242,182,248,37,216,146,
+84,203,66,226,121,190,48,195,189,128,117,48,160,195,67,14,87,14,223,110,
+179,26,126,111,100,205,47,117,215,125,218,61,23,216,123,214,136,117,166,225,
+104,164,18,25,14,129,139,236,142,12,63,252,107,45,87,254,115,131,81,17,
+184,156,107,221,2,16,238,215,48,154,146,247,125,60,64,88,153,73,240,219,
+102,183,149,19,86,137,43,194,87,225,73,117,243,51,156,42,238,178,174,182,
+178,110,10,243,189,84,237,6,1,245,176,41,225,225,207,217,215,140,199,195,
+189,200,230,190,170,239,224,47,179,152,87,217,182,128,127,233,166,170,121,115,
+217,118,187,204,150,107,252,179,70,176,215,128,165,248,130,92,182,117,209,236,
+224,207,10,145,58,56,60,92,230,236,5,14,11,63,127,113,171,211,141,249,
+212,192,79,87,109,189,28,162,177,1,159,224,199,140,248,118,3,101,133,223,
+223,103,181,226,145,100,93,87,60,243,77,139,255,46,212,170,26,153,177,4,
+244,40,211,19,194,83,220,17,79,153,24,162,145,15,77,114,4,124,200,95,
+87,244,40,43,45,22,39,70,107,235,225,114,62,127,124,103,238,157,195,139,
+170,46,110,11,53,58,114,161,26,121,75,167,96,247,90,168,33,108,223,193,
+143,2,96,121,3,68,8,238,38,206,81,75,6,52,35,251,173,84,178,166,
+155,218,224,29,182,11,56,254,247,87,55,153,150,249,203,195,214,0,100,166,
+221,168,193,42,78,233,231,167,174,3,142,185,200,99,183,14,87,24,37,247,
+21,144,9,213,202,79,213,187,202,97,233,40,61,176,239,33,121,180,95,195,
+223,1,13,40,253,72,134,8,184,177,99,128,178,120,156,41,188,55,112,129,
+224,70,53,35,8,219,100,245,173,108,78,179,178,124,139,203,212,17,154,114,
+106,214,165,133,124,128,43,73,203,69,122,88,10,189,149,75,36,211,194,46,
+18,233,75,45,241,46,231,135,49,52,186,94,112,178,98,5,20,251,182,0,
+26,43,182,68,121,112,144,90,54,109,173,98,224,251,172,138,191,2,192,10,
+32,213,200,47,224,123,131,215,118,188,0,144,246,167,115,36,210,242,1,168,
+23,80,116,213,120,208,25,240,26,90,63,231,177,207,252,87,8,153,105,252,
+177,179,27,92,78,176,35,113,74,28,80,11,189,174,218,50,71,78,39,50,
+160,218,27,131,151,126,245,200,171,45,107,184,86,60,101,110,32,111,240,185,
+45,27,51,71,129,44,151,48,146,207,96,41,97,202,124,31,252,46,136,156,
+139,251,26,72,112,176,92,249,53,43,91,62,80,158,36,0,35,255,240,98,
+0,174,143,114,83,53,146,7,164,89,123,160,121,88,74,250,27,54,215,100,
+69,169,113,200,62,242,90,232,218,119,207,248,213,225,100,111,250,111,132,103,
+195,139,151,23,202,97,245,94,174,12,47,130,132,4,47,132,168,4,87,210,
+142,37,80,10,241,68,199,142,75,168,100,89,115,240,227,8,117,7,196,3,
+8,106,190,208,125,16,217,71,225,212,7,81,123,102,207,127,170,171,118,59,
+24,254,138,222,21,252,138,184,197,119,4,126,134,147,109,219,198,162,19,144,
+216,74,28,195,102,170,123,192,35,96,213,57,60,1,49,86,179,232,136,239,
+4,195,172,1,225,0,227,175,85,75,207,23,252,170,65,3,90,199,98,156,
+162,223,84,64,89,51,229,183,80,168,101,217,230,242,148,145,25,217,201,201,
+229,249,112,51,76,121,224,174,129,168,99,36,94,198,126,228,74,2,62,177,
+247,235,70,10,144,70,138,18,111,143,21,66,45,108,115,225,143,99,6,136,
+185,202,96,119,176,153,6,69,214,82,203,195,86,174,139,18,105,237,64,36,
+83,130,159,136,77,149,195,220,22,117,81,96,174,171,123,184,16,45,29,76,
+112,233,178,90,18,93,112,146,58,110,44,175,232,183,109,6,242,45,144,3,
+75,138,231,226,2,132,138,26,240,86,139,133,150,205,37,62,191,80,238,134,
+44,132,110,246,161,209,96,43,76,49,94,239,254,2,75,26,146,185,159,12,
+200,3,34,84,32,115,216,178,192,15,208,67,160,139,63,95,93,124,176,120,
+66,164,205,159,136,54,58,0,110,249,192,165,89,190,125,9,42,79,33,239,
+19,180,60,190,224,45,127,19,44,196,75,1,150,246,89,130,119,200,154,232,
+32,47,212,21,28,194,155,213,138,5,228,4,200,42,62,117,56,81,143,9,
+162,88,1,138,32,110,208,199,98,153,41,60,105,88,94,221,34,201,175,224,
+118,14,144,36,166,21,189,49,120,173,3,188,22,136,79,134,1,45,29,157,
+27,50,134,162,145,27,248,235,23,75,207,94,3,31,191,11,68,13,187,249,
+172,174,179,221,80,60,209,17,73,80,55,150,29,111,43,88,11,94,192,27,
+28,117,91,1,145,113,50,131,158,135,212,27,132,145,75,243,242,107,247,174,
+222,71,192,175,64,140,161,201,234,76,221,210,53,215,160,120,47,215,227,19,
+139,34,164,234,26,199,72,72,89,125,54,159,63,102,46,113,12,39,14,180,
+13,206,241,229,92,252,68,42,26,28,179,17,162,100,62,19,160,252,92,43,
+24,153,39,211,120,171,224,50,195,245,215,248,200,205,57,198,58,85,62,81,
+80,76,95,125,100,42,203,230,83,245,182,85,203,38,198,168,46,84,185,35,
+205,18,112,182,14,182,120,191,46,0,12,72,188,140,196,173,145,189,28,171,
+74,189,82,48,42,8,213,98,101,198,196,45,17,192,99,104,252,145,209,210,
+3,212,79,129,183,212,131,119,110,32,117,158,227,140,52,30,145,74,4,22,
+159,142,255,210,221,121,32,239,102,105,195,75,144,210,35,105,150,171,184,54,
+121,69,127,123,101,178,131,203,87,221,47,71,145,248,60,183,215,133,127,69,
+212,130,33,204,200,184,245,121,127,73,161,0,98,101,163,43,251,36,13,88,
+63,98,56,221,125,209,172,13,161,40,140,228,24,35,173,33,188,252,213,89,
+222,125,170,179,165,140,44,199,63,235,129,38,252,168,7,152,193,184,209,141,
+134,79,71,54,139,175,137,6,223,11,183,184,8,7,95,116,180,21,98,177,
+17,249,169,218,106,164,166,8,50,224,191,141,248,51,8,22,246,244,145,199,
+110,156,25,45,6,183,112,240,11,117,162,119,106,137,50,227,62,172,176,10,
+8,172,29,136,55,125,205,230,157,12,71,96,146,30,108,43,220,109,97,238,
+88,199,166,4,147,193,178,174,14,129,108,0,154,26,164,252,175,1,101,78,
+30,157,191,164,225,4,175,195,95,99,71,134,163,235,16,176,193,101,223,203,
+178,188,188,159,100,87,75,175,232,246,39,255,128,130,129,135,222,60,66,248,
+233,208,194,151,102,200,186,65,213,30,161,200,116,76,87,19,47,200,183,152,
+113,170,190,59,184,78,1,67,0,36,250,117,20,169,8,138,208,106,128,57,
+192,127,139,101,91,102,117,32,214,176,153,27,47,232,141,4,253,89,245,13,
+235,40,220,109,134,87,251,35,253,220,193,59,47,95,135,223,107,180,108,128,
+76,118,213,200,237,57,168,9,116,60,147,68,208,79,108,100,106,214,85,30,
+53,88,219,107,62,215,102,104,190,212,132,254,1,181,64,246,118,173,220,203,
+33,49,249,148,233,59,103,232,22,184,66,205,202,28,209,42,187,242,220,208,
+141,134,222,38,84,34,58,97,31,95,171,27,9,124,193,80,56,26,127,46,
+28,41,109,151,75,144,42,67,250,195,227,104,145,45,155,22,214,183,243,35,
+205,132,185,171,130,108,168,56,153,170,128,249,226,7,247,178,150,193,146,224,
+105,166,200,198,43,162,16,22,247,32,46,224,41,199,44,26,125,42,112,69,
+210,216,251,172,89,174,211,116,192,89,49,226,50,171,145,232,54,56,136,236,
+10,168,252,232,92,161,85,76,198,8,224,126,166,110,70,239,74,159,19,248,
+121,218,170,240,215,86,214,187,148,198,239,103,36,17,226,16,97,112,9,186,
+252,149,4,65,175,1,230,50,212,108,97,99,248,185,219,16,30,146,38,237,
+142,191,56,80,243,215,31,229,173,124,72,79,211,192,101,64,195,25,111,203,
+129,29,101,201,26,191,140,201,146,140,13,82,7,134,69,243,61,74,140,124,
+36,75,62,202,238,77,151,141,187,116,68,25,207,64,87,91,15,79,59,101,
+152,222,100,15,246,139,158,37,63,123,40,54,237,6,41,0,220,111,192,141,
+128,143,19,157,215,112,121,101,211,152,147,91,252,176,96,206,207,186,33,108,
+0,238,152,49,167,90,39,27,190,74,163,92,171,96,24,113,108,12,26,47,
+163,170,162,49,85,2,84,114,107,132,29,172,132,88,206,157,35,162,35,82,
+13,128,235,117,9,239,222,84,15,151,89,3,208,81,17,157,205,221,212,46,
+22,39,47,233,214,143,212,227,138,248,30,169,67,120,236,91,205,230,5,2,
+19,40,205,164,50,161,61,125,45,129,107,154,51,110,235,146,149,7,179,74,
+103,21,137,112,152,109,137,210,19,25,11,170,86,251,79,236,122,152,52,111,
+51,141,19,85,160,218,204,197,219,10,4,106,120,21,222,68,229,3,175,220,
+93,177,21,72,204,183,176,199,63,32,33,101,164,187,86,86,187,163,81,112,
+93,68,102,200,168,166,164,211,152,205,92,115,241,151,247,188,179,166,222,225,
+184,112,103,190,74,183,38,244,175,26,65,105,119,173,224,120,96,143,27,28,
+234,8,167,134,233,142,216,233,148,193,247,112,114,122,38,86,133,34,58,141,
+222,144,218,98,25,191,93,181,205,17,146,233,86,25,66,191,106,203,67,78,
+94,230,31,81,233,210,135,210,196,195,201,224,128,230,211,195,203,10,201,206,
+152,181,98,107,222,136,185,57,222,103,119,193,9,186,227,211,78,153,101,56,
+195,191,2,224,147,150,217,59,164,224,132,202,2,213,94,127,228,55,59,241,
+45,206,232,90,217,173,195,37,166,187,129,36,13,35,19,132,219,49,50,237,
+90,246,240,159,72,246,26,247,0,34,195,219,162,214,100,255,149,53,72,107,
+240,72,29,53,32,14,184,205,206,5,223,187,192,140,87,177,114,49,238,100,
+240,199,189,68,2,14,80,11,12,36,120,39,109,208,2,156,37,44,81,45,
+101,128,16,83,244,136,89,218,171,134,82,87,48,27,2,180,252,42,115,18,
+140,130,89,88,122,121,55,226,106,251,210,65,248,17,253,39,237,223,131,15,
+195,181,116,216,255,129,94,190,132,24,0,167,158,23,205,126,223,2,10,156,
+192,52,179,112,57,238,91,99,154,10,204,82,121,71,5,173,208,250,163,65,
+25,54,186,48,160,72,176,169,21,195,60,176,63,74,103,148,68,227,103,221,
+202,56,155,110,18,106,159,0,202,110,237,151,22,74,223,3,198,245,73,208,
+115,153,74,189,197,106,20,121,69,187,173,40,96,164,240,198,224,24,130,190,
+222,125,174,203,233,98,11,122,79,62,144,215,124,212,179,63,196,230,236,89,
+195,18,172,171,94,71,102,170,212,161,51,197,197,74,250,213,242,89,103,11,
+131,69,232,9,171,64,67,208,92,188,41,8,139,22,48,199,2,36,169,107,
+181,176,179,45,196,166,213,100,194,119,247,232,160,85,243,66,127,204,244,58,
+101,111,92,195,179,103,0,87,34,162,34,129,3,23,171,21,14,111,56,34,
+185,218,158,140,10,255,168,68,171,75,178,252,210,132,100,172,1,89,128,48,
+190,166,255,99,5,70,92,40,138,79,41,52,136,242,222,157,95,80,84,215,
+76,160,100,46,31,128,88,24,253,71,59,241,79,243,54,215,36,121,4,88,
+234,104,6,142,196,4,147,8,8,160,170,35,52,11,97,130,185,118,32,3,
+24,194,232,68,82,35,245,224,100,248,79,154,197,121,138,133,110,111,180,4,
+229,83,129,160,176,240,243,126,52,179,46,132,9,75,228,13,204,5,89,65,
+202,234,182,0,37,35,4,23,13,171,219,250,43,192,140,194,36,208,231,92,
+101,185,238,235,100,129,79,232,100,105,148,210,56,105,27,168,151,217,50,170,
+196,162,217,143,220,144,61,223,2,153,52,112,57,73,69,129,22,64,56,242,
+7,192,182,204,253,11,79,169,75,41,140,68,111,227,89,252,118,250,206,218,
+136,232,108,3,122,84,69,209,86,45,168,120,237,237,26,5,15,52,30,143,
+196,190,225,178,7,187,165,9,113,69,129,27,26,221,210,177,253,157,73,144,
+67,165,54,54,231,238,55,12,20,113,154,41,118,231,178,93,195,220,47,70,
+83,251,238,76,216,53,135,3,32,181,84,85,240,203,92,156,43,184,202,89,
+153,158,15,175,194,2,225,176,152,162,149,176,209,202,122,176,71,165,52,196,
+1,190,28,214,35,237,6,82,242,222,14,209,83,72,208,50,112,82,223,182,
+56,127,44,106,138,196,106,221,25,151,8,39,192,136,93,176,226,196,197,37,
+16,121,202,26,251,50,97,143,19,221,159,223,240,221,167,204,163,134,112,92,
+52,153,117,36,146,90,19,147,180,198,128,33,69,145,166,5,172,31,213,31,
+242,232,85,240,115,126,96,216,4,78,197,208,202,147,126,115,19,200,22,24,
+39,4,205,8,184,203,68,53,91,145,37,104,187,45,119,164,47,161,236,199,
+39,240,79,110,200,223,31,137,181,127,33,79,11,200,210,79,119,131,34,234,
+61,155,177,116,212,155,251,129,131,166,209,30,216,55,82,28,130,212,121,189,
+131,37,165,76,153,1,122,50,235,163,32,64,107,65,199,224,25,192,99,20,
+25,197,89,189,19,117,171,128,31,239,66,211,22,186,133,153,11,95,171,96,
+6,50,41,97,180,136,27,139,238,135,191,17,9,74,255,6,192,219,145,100,
+140,131,184,116,54,220,224,40,239,138,237,73,89,18,35,209,211,185,47,218,
+83,246,240,94,50,185,16,241,215,105,166,203,86,26,18,17,16,104,100,173,
+168,219,109,67,124,71,237,236,247,199,158,1,207,60,31,153,97,202,64,16,
+119,35,155,229,203,254,254,254,146,213,5,210,228,4,227,72,137,205,122,9,
+34,84,66,106,254,129,67,138,173,242,68,1,30,240,54,74,179,72,195,216,
+72,196,246,104,252,25,16,163,192,176,46,228,9,71,40,165,149,71,51,113,
+180,44,43,16,144,228,17,73,114,71,75,148,207,142,208,176,132,95,80,28,
+63,5,94,80,220,30,34,206,133,241,166,84,91,74,198,48,6,27,16,40,
+139,109,91,146,74,12,127,19,142,140,6,163,127,53,208,248,144,69,220,102,
+22,84,20,70,24,35,179,124,190,230,165,199,114,214,89,156,64,32,39,96,
+159,31,231,80,84,101,174,221,100,79,243,49,90,214,205,168,9,115,185,61,
+20,24,75,229,102,6,40,83,116,155,57,94,3,108,27,188,167,219,109,16,
+189,103,212,193,107,181,105,155,8,248,29,47,100,175,215,16,239,166,18,158,
+190,195,112,146,115,178,27,99,64,194,186,51,45,128,64,214,117,55,230,157,
+228,28,235,67,236,122,3,71,221,137,49,77,202,123,43,145,78,185,40,33,
+4,245,0,64,23,109,243,34,62,0,146,62,67,180,247,12,241,53,114,77,
+205,24,95,77,100,99,24,210,241,37,9,49,147,131,4,48,174,116,215,131,
+236,131,184,151,217,54,187,41,202,2,179,101,64,204,109,132,137,174,213,198,
+205,195,186,217,166,250,10,255,8,21,83,16,157,173,3,129,162,6,65,134,
+246,126,105,36,107,219,178,34,87,86,32,86,192,55,64,213,40,209,201,166,
+53,217,181,30,154,215,52,212,231,246,177,110,175,157,129,204,223,139,204,127,
+170,77,247,132,88,90,44,182,110,162,25,117,112,134,111,139,218,166,74,133,
+198,128,64,105,6,116,4,5,135,153,169,149,70,40,198,184,99,135,12,3,
+123,242,17,175,215,179,68,169,156,122,1,24,145,244,107,81,211,226,54,25,
+170,235,210,74,224,206,234,99,181,199,255,251,227,71,24,234,236,226,61,252,
+247,13,158,52,154,28,49,246,149,232,131,225,135,168,83,106,45,235,198,230,
+59,153,32,108,78,247,218,20,90,126,148,72,239,248,213,11,26,204,102,102,
+101,155,155,226,182,173,90,61,162,146,2,144,117,196,204,195,58,41,63,28,
+149,178,92,242,153,21,178,178,38,27,154,168,56,224,216,56,64,240,118,208,
+225,190,114,185,42,89,251,0,119,49,3,193,202,231,176,205,187,38,221,137,
+254,201,117,209,116,99,84,199,245,170,31,139,174,5,241,252,76,255,174,154,
+116,86,242,103,100,146,253,72,21,19,225,102,173,91,100,169,11,213,211,140,
+98,129,80,94,231,95,77,164,52,127,236,195,120,174,21,25,159,128,20,149,
+100,83,203,122,202,55,233,143,139,65,24,206,34,136,176,91,4,204,21,239,
+225,66,172,202,236,118,31,148,92,4,193,211,162,177,146,180,107,156,12,116,
+76,193,117,32,251,82,204,205,78,152,168,27,180,74,192,240,0,131,34,139,
+68,76,13,21,243,61,11,48,159,37,195,168,112,160,183,112,0,50,255,84,
+93,162,33,115,191,86,216,79,241,10,44,147,157,0,199,167,41,135,73,199,
+68,205,201,50,177,201,197,49,223,151,151,29,81,122,168,34,96,224,218,187,
+100,210,100,197,182,245,238,4,136,119,253,244,197,32,218,19,87,118,76,186,
+147,81,149,179,91,61,101,21,167,163,105,147,143,92,201,248,188,146,147,121,
+134,123,207,224,206,151,133,146,49,117,123,100,176,196,22,222,73,117,219,56,
+199,72,57,54,120,42,163,200,70,5,161,235,144,36,72,52,7,60,132,246,
+7,135,213,167,252,40,134,108,111,134,239,140,160,221,58,230,233,49,33,102,
+29,87,207,4,99,68,159,77,246,87,123,210,62,156,197,56,231,27,208,78,
+243,92,214,49,86,137,172,246,48,7,22,97,200,251,108,11,136,145,242,244,
+25,44,218,100,91,204,128,172,150,5,41,70,132,84,230,12,186,23,107,170,
+14,4,240,98,235,78,108,238,79,20,74,102,93,62,218,57,211,204,106,28,
+30,79,143,90,123,95,33,187,154,54,17,252,245,230,234,191,208,44,211,150,
+242,192,116,107,194,236,23,209,192,82,51,58,191,18,195,238,64,47,65,82,
+207,156,146,213,103,56,8,14,13,25,210,53,210,9,200,70,1,167,139,108,
+17,205,20,43,207,58,71,88,95,39,37,224,32,126,55,206,237,250,140,102,
+69,22,76,76,97,196,37,15,174,72,135,39,16,163,201,127,231,52,191,115,
+154,223,57,205,111,151,211,68,40,240,59,64,12,180,97,79,139,196,79,208,
+101,159,10,74,81,6,198,201,109,143,23,61,193,232,133,16,168,50,6,202,
+255,239,236,240,119,118,248,29,177,67,90,169,5,128,137,183,224,101,163,202,
+91,98,45,38,250,24,41,57,234,181,119,10,51,208,209,166,213,42,87,178,
+201,199,171,82,144,25,85,158,64,149,218,23,213,232,22,15,234,227,60,21,
+77,121,221,53,242,37,13,133,161,133,48,70,182,184,2,75,199,136,63,33,
+231,104,62,22,21,106,3,122,249,190,177,83,108,111,133,163,104,16,86,144,
+228,68,73,8,198,224,111,38,8,172,9,129,252,177,120,180,4,241,216,104,
+189,110,0,243,241,15,79,168,180,147,152,45,90,111,39,50,159,173,168,51,
+146,92,253,180,83,154,0,169,49,128,118,54,137,171,141,93,85,218,193,32,
+226,124,132,196,4,105,247,194,165,46,248,31,41,55,133,179,214,124,120,195,
+193,24,25,191,6,76,1,2,52,45,52,219,187,190,102,101,97,163,55,98,
+6,156,194,196,253,228,207,84,247,196,250,99,162,142,196,15,129,188,27,192,
+173,227,195,97,107,22,23,186,233,149,49,56,8,129,18,4,218,206,245,110,
+60,16,251,160,169,166,197,118,31,160,30,132,30,122,254,63,214,20,106,76,
+35,153,39,50,35,0,103,210,38,108,242,89,158,162,195,57,18,103,234,156,
+209,65,141,161,81,208,47,240,157,133,173,249,17,253,40,168,153,81,232,131,
+171,8,125,90,27,63,178,43,101,200,17,141,70,176,8,220,126,200,238,92,
+60,149,201,31,78,30,126,221,9,21,27,93,210,151,62,71,138,9,248,4,
+185,224,183,3,10,232,221,150,213,77,134,39,79,142,127,44,69,87,144,148,
+99,220,255,248,23,101,54,206,94,220,192,27,88,85,207,21,218,195,152,85,
+248,63,22,166,198,74,126,225,207,241,211,198,71,177,131,53,78,149,26,179,
+86,177,118,139,13,40,33,244,161,236,39,177,224,149,47,72,152,88,224,170,
+23,214,35,94,4,95,114,153,72,118,169,93,43,134,198,255,132,197,87,2,
+109,16,63,158,225,215,120,152,53,249,156,49,62,176,169,51,165,169,138,164,
+65,52,132,29,9,229,20,175,10,95,93,43,235,177,199,164,54,129,193,45,
+161,175,167,87,46,105,2,22,78,148,242,85,28,31,70,200,132,145,53,57,
+140,131,51,155,71,133,72,80,235,159,137,64,117,102,198,250,157,163,69,69,
+246,164,198,24,150,200,164,230,151,104,10,38,135,20,211,73,91,173,126,58,
+63,87,86,236,56,88,240,113,22,132,78,146,103,170,122,35,124,235,243,122,
+35,227,146,50,198,27,241,227,185,253,119,18,143,127,25,108,205,139,197,97,
+117,192,223,165,204,103,151,50,71,202,34,90,21,230,202,6,119,16,65,165,
+48,25,102,2,251,232,230,223,190,164,203,63,102,121,126,174,52,87,193,250,
+81,102,219,11,135,212,99,246,70,124,83,104,149,109,245,186,114,36,173,112,
+101,180,40,201,143,203,10,5,53,115,255,245,97,80,240,44,56,240,181,155,
+60,60,116,156,232,202,204,227,158,166,51,131,109,233,88,88,7,165,73,217,
+226,105,138,136,71,88,43,6,132,199,12,87,116,172,165,20,38,102,64,188,
+179,117,216,240,198,111,48,4,200,132,155,94,43,120,213,242,105,221,141,191,
+51,42,232,159,178,250,134,42,109,14,43,72,14,139,20,79,77,5,91,199,
+224,188,172,106,160,16,91,76,35,225,44,75,142,212,167,204,222,154,184,128,
+63,145,30,128,7,160,220,15,104,95,252,230,199,238,9,29,104,144,182,69,
+213,56,16,148,54,230,241,166,91,39,168,26,172,46,198,228,92,153,151,52,
+32,223,60,185,38,100,7,0,252,227,235,221,56,32,146,155,136,131,248,153,
+10,37,238,54,55,85,89,44,59,53,18,49,198,112,201,217,14,54,8,215,
+212,58,20,27,44,137,184,45,237,177,80,185,136,113,88,114,106,130,45,145,
+181,37,227,10,48,130,21,42,99,44,216,58,91,76,88,185,135,223,240,64,
+184,50,223,34,48,46,205,195,94,141,37,243,134,123,26,134,193,129,48,97,
+159,79,142,55,236,51,98,187,252,115,147,53,60,76,213,199,196,230,91,179,
+79,25,100,23,3,40,119,13,198,195,93,86,133,214,24,141,94,224,33,221,
+180,86,124,39,48,91,193,208,126,167,81,163,149,24,244,76,165,13,108,90,
+133,22,255,249,31,255,253,95,255,199,12,217,45,89,68,27,253,100,10,25,
+120,116,211,143,143,177,164,170,8,39,165,207,231,220,127,222,64,103,114,12,
+17,181,167,77,119,214,28,232,19,142,24,227,54,220,25,118,246,92,109,159,
+117,203,44,116,192,10,110,49,67,46,25,215,126,196,239,133,183,211,126,115,
+100,115,193,108,153,6,111,111,103,43,132,35,205,152,245,74,151,160,201,238,
+176,242,173,11,50,177,213,40,184,176,149,77,53,9,207,26,191,8,39,255,
+45,110,152,182,244,37,136,223,12,206,126,95,12,103,196,90,53,140,235,4,
+49,37,92,239,233,186,85,119,201,64,247,65,182,38,189,221,1,58,49,67,
+144,167,244,231,109,206,57,103,123,234,126,88,169,47,109,149,232,140,214,35,
+40,202,148,56,64,94,88,35,221,5,138,43,222,100,32,146,155,127,26,205,
+251,6,149,63,52,59,220,82,16,47,210,13,52,126,155,18,7,183,108,11,
+35,155,129,121,229,90,21,0,215,135,25,211,101,137,185,165,225,171,25,208,
+124,128,43,6,211,115,110,136,33,247,142,70,217,113,120,128,102,93,212,225,
+247,215,202,14,160,139,255,149,93,78,62,28,35,22,115,12,56,23,176,122,
+95,156,197,247,15,48,213,222,112,36,229,42,89,96,234,8,54,104,16,45,
+1,148,166,162,66,35,70,44,179,83,234,144,128,160,59,243,10,134,76,179,
+230,164,182,208,255,50,80,45,250,220,131,202,93,52,64,191,158,111,183,181,
+188,197,154,96,229,206,52,165,200,92,234,152,79,52,193,37,94,43,141,99,
+120,177,9,101,214,158,52,104,87,55,23,231,124,90,84,182,202,164,149,89,
+253,131,197,202,2,243,118,201,7,76,247,141,106,76,170,14,152,123,183,164,
+79,28,184,34,46,199,202,103,212,186,161,15,72,254,162,23,156,151,34,62,
+211,207,43,199,188,210,49,245,143,144,246,32,31,224,170,80,133,94,203,65,
+233,64,76,120,101,58,166,167,120,144,126,140,11,217,147,180,167,168,223,221,
+50,95,250,198,172,132,212,153,185,248,145,210,71,80,19,212,5,38,154,42,
+52,201,103,28,103,159,149,62,137,27,14,16,211,175,151,154,241,5,232,120,
+78,35,232,131,237,245,182,186,106,44,140,125,25,20,46,143,228,198,120,187,
+99,74,42,147,229,234,10,168,204,144,120,150,65,65,84,36,67,86,12,115,
+4,72,153,26,213,92,167,150,119,88,75,149,48,46,15,165,147,15,240,253,
+72,96,187,25,110,168,218,135,144,244,22,149,228,248,125,104,94,122,81,106,
+207,41,120,166,149,143,138,89,60,209,200,74,12,118,59,54,61,129,69,207,
+124,46,198,151,89,212,132,48,93,205,141,151,64,58,173,88,222,62,184,242,
+157,253,144,226,47,28,54,88,218,89,232,170,116,9,121,94,189,120,13,244,
+241,205,10,94,246,243,70,108,54,37,43,218,83,198,39,38,221,125,213,100,
+62,22,88,15,1,185,59,252,76,45,50,174,213,45,91,9,92,21,180,126,
+144,177,87,127,2,237,100,34,85,44,82,250,12,37,71,91,66,18,106,51,
+155,98,89,87,44,53,232,249,72,82,217,233,229,103,43,248,215,195,145,230,
+226,189,169,27,98,124,94,134,37,4,95,81,119,7,80,39,76,226,143,175,
+192,212,169,99,221,255,225,18,62,42,180,12,206,233,145,130,49,174,235,20,
+69,160,228,81,103,75,56,86,100,113,228,247,33,113,9,57,246,14,229,41,
+93,144,26,120,68,103,44,243,35,100,143,71,152,45,103,127,56,48,205,150,
+76,74,145,240,116,187,22,114,146,152,252,60,139,87,233,114,120,88,243,13,
+161,196,6,114,247,190,24,94,142,65,165,80,127,84,46,92,34,28,12,203,
+121,152,49,6,8,13,210,107,240,9,139,5,117,75,197,75,5,2,98,3,
+132,58,231,37,113,166,152,198,186,35,46,214,10,135,110,17,125,244,16,13,
+62,1,220,46,157,78,185,63,54,202,128,1,193,237,181,211,137,186,237,4,
+109,54,161,193,246,53,215,33,174,70,187,198,164,78,139,31,179,123,144,44,
+52,90,0,52,37,218,81,49,192,204,55,177,97,73,158,111,19,51,116,78,
+204,115,221,21,6,7,48,31,40,217,7,2,216,46,189,3,225,216,138,195,
+23,24,237,250,29,213,230,223,31,75,64,253,117,223,225,29,196,16,102,81,
+140,23,14,225,197,101,252,142,41,41,115,138,10,166,148,161,14,149,220,15,
+176,240,76,15,133,217,167,240,216,108,144,149,141,166,98,45,161,127,49,143,
+95,114,72,25,151,230,233,213,242,66,136,30,138,99,22,194,189,91,60,210,
+239,109,186,44,236,207,224,73,162,112,146,237,14,41,185,107,241,100,85,102,
+229,238,225,55,16,168,167,250,169,214,69,19,103,130,31,124,142,63,89,60,
+181,139,38,44,180,113,157,100,92,18,8,107,229,172,6,81,63,177,60,196,
+189,246,146,64,172,30,79,65,244,98,54,0,84,31,20,193,154,75,120,241,
+99,60,131,243,211,218,230,111,226,150,216,150,133,76,221,17,79,99,125,177,
+39,100,88,32,13,105,168,43,170,201,89,125,199,209,183,160,147,98,233,73,
+251,52,174,124,216,216,171,79,197,242,238,28,187,242,237,173,250,137,111,238,
+79,211,12,13,76,198,119,108,7,16,13,142,16,40,40,207,165,148,12,246,
+54,69,153,162,203,22,61,139,210,212,19,220,6,247,90,187,2,159,48,151,
+53,125,213,21,156,146,191,80,41,117,146,40,86,17,9,220,226,117,58,73,
+212,155,76,34,18,113,122,124,208,149,246,140,78,53,117,199,199,62,220,200,
+200,247,115,47,62,156,231,58,188,206,120,111,173,158,250,152,105,113,27,103,
+178,108,178,253,51,35,80,188,231,3,110,76,115,207,93,66,127,206,150,148,
+239,106,150,212,135,71,96,234,204,113,38,206,105,7,126,138,65,236,236,227,
+188,86,22,55,220,225,14,209,122,52,119,33,11,203,153,152,133,100,13,123,
+112,76,234,188,88,2,138,99,248,88,239,26,61,49,142,115,232,176,179,213,
+106,124,48,66,175,157,100,210,182,101,40,194,62,26,222,221,88,16,73,131,
+115,134,128,27,210,164,95,246,74,85,153,29,204,53,247,121,36,112,232,40,
+185,68,227,132,208,65,51,169,73,193,113,17,88,84,148,200,182,230,25,79,
+140,121,150,169,96,156,249,158,152,220,17,101,51,76,49,246,150,249,224,128,
+12,76,131,94,158,12,126,170,84,61,241,120,34,33,169,211,79,233,160,64,
+216,88,240,171,47,174,51,168,36,209,219,75,74,84,181,69,185,163,183,166,
+182,214,108,234,64,214,137,161,164,32,143,142,156,222,57,169,72,238,199,107,
+84,183,147,162,191,43,230,22,17,253,49,53,223,206,75,22,126,28,73,220,
+194,234,208,156,207,61,115,237,25,90,73,47,208,108,14,60,70,95,119,252,
+32,155,237,16,179,139,111,155,15,248,136,128,223,8,112,18,120,225,98,112,
+134,201,253,246,137,45,163,225,163,205,108,250,159,237,91,221,71,143,47,157,
+248,248,145,19,58,11,156,116,164,169,120,253,214,84,112,168,13,240,30,125,
+213,212,88,172,249,96,86,194,246,64,103,226,182,7,99,57,0,168,152,37,
+67,149,175,58,52,15,85,36,174,210,197,184,232,155,87,80,60,100,183,244,
+228,35,201,127,21,39,199,221,133,184,246,2,193,252,166,183,156,187,127,171,
+222,154,116,28,211,58,219,79,73,59,164,113,198,100,84,15,13,186,252,35,
+0,217,123,6,70,92,121,163,154,122,23,11,26,31,49,165,116,81,237,159,
+138,80,68,32,151,56,68,128,122,93,196,142,49,4,172,121,137,64,232,77,
+203,65,221,97,131,75,253,2,93,189,254,10,243,41,105,55,29,11,77,180,
+118,149,9,94,52,47,189,181,14,201,169,81,14,197,104,87,1,204,222,225,
+241,231,91,11,192,252,248,229,104,202,135,11,210,237,68,107,239,53,148,78,
+215,207,155,162,41,83,42,20,220,54,124,106,3,27,49,191,21,149,92,174,
+176,103,90,143,135,219,57,126,217,139,171,233,130,243,138,237,105,223,12,154,
+143,2,229,175,6,166,97,85,112,76,18,165,238,158,242,222,93,15,239,179,
+241,93,249,4,247,132,25,140,106,107,214,209,9,36,113,251,228,242,252,148,
+124,68,233,154,209,101,117,107,75,121,161,83,29,21,18,184,44,216,141,11,
+19,75,178,90,49,104,242,162,230,255,62,108,144,178,52,166,183,121,99,210,
+85,151,32,229,225,11,180,106,27,50,233,255,129,146,120,182,229,194,10,192,
+73,236,11,174,146,152,71,110,127,89,112,84,35,214,35,217,195,95,14,204,
+87,33,218,19,216,207,226,52,174,151,200,145,160,111,112,196,137,66,107,246,
+240,163,69,132,135,113,185,38,127,63,72,32,230,226,81,88,168,56,235,228,
+132,141,229,245,39,242,249,35,203,243,17,42,177,152,26,55,224,39,31,102,
+51,139,116,206,117,149,180,150,217,22,8,117,88,214,105,176,252,41,233,205,
+214,152,222,173,57,54,189,27,0,238,121,162,161,155,35,212,45,216,237,211,
+138,59,217,147,5,27,77,173,216,128,214,6,140,46,123,223,28,179,243,145,
+111,224,191,189,252,227,181,58,202,224,253,221,166,106,245,191,112,17,195,87,
+112,141,128,220,188,42,242,35,55,46,14,219,42,92,115,110,135,154,137,35,
+252,247,200,71,215,202,168,115,185,175,244,16,9,124,162,90,249,124,6,118,
+181,24,71,223,239,129,215,175,205,252,81,126,173,238,14,160,202,137,106,124,
+108,226,181,49,116,84,243,127,189,11,234,134,221,83,10,10,77,181,199,64,
+96,63,137,68,237,160,0,200,22,125,51,84,88,163,183,151,227,178,112,143,
+62,81,191,244,197,62,160,181,138,187,210,231,99,171,238,47,146,199,222,23,
+138,239,110,146,189,241,238,251,67,110,224,222,170,218,209,106,218,233,13,119,
+183,105,186,202,115,78,191,129,68,111,207,93,250,114,202,61,114,246,237,253,
+4,249,25,54,126,54,45,117,66,187,75,191,108,137,191,197,9,154,118,22,
+12,61,190,57,100,162,131,169,168,111,21,175,99,116,107,103,216,204,186,218,
+77,41,250,99,79,52,183,159,8,191,137,71,18,237,61,135,22,217,147,155,
+124,116,87,250,20,57,114,36,234,33,28,159,155,48,244,62,52,17,140,252,
+57,5,127,1,174,104,147,20,239,66,95,40,133,233,35,246,245,208,81,188,
+72,101,79,246,179,38,19,85,98,214,84,45,115,28,58,38,144,207,183,26,
+43,108,98,21,87,33,146,15,100,153,157,245,107,181,152,215,80,134,234,165,
+71,113,111,68,35,177,117,66,175,210,177,13,151,92,245,212,38,188,136,159,
+10,10,104,33,147,8,252,248,51,47,200,228,32,144,187,133,94,103,98,243,
+115,63,127,99,144,37,51,158,235,28,173,211,207,149,74,180,235,239,60,165,
+246,200,129,116,198,10,69,247,89,209,24,0,28,158,161,100,64,209,13,6,
+193,95,134,217,82,253,60,164,131,122,213,227,201,189,222,217,204,237,184,185,
+209,36,22,83,203,26,106,242,195,199,102,242,235,196,159,175,46,62,184,140,
+42,52,107,5,253,237,40,40,119,231,12,17,7,44,205,6,251,95,98,23,
+73,121,159,92,220,150,159,7,147,250,52,129,32,43,154,242,173,34,45,104,
+242,92,48,137,167,244,60,135,128,62,59,207,254,212,139,140,77,227,60,9,
+150,251,51,188,14,196,221,103,71,79,242,232,27,19,194,133,154,44,244,88,
+171,195,153,92,150,89,157,69,219,78,5,207,6,213,196,81,9,116,218,198,
+244,52,61,174,128,96,7,9,90,135,217,204,54,174,205,218,103,33,6,43,
+176,136,122,216,71,44,9,202,106,202,229,138,213,163,14,170,237,167,117,36,
+214,132,246,199,24,116,21,39,113,130,52,179,243,155,45,134,95,86,62,231,
+82,163,185,42,176,98,221,87,117,73,42,56,229,82,192,167,178,177,229,2,
+14,108,47,3,26,103,196,127,116,174,4,63,161,246,71,97,171,33,35,63,
+25,203,160,244,105,143,182,176,191,19,78,145,189,228,21,253,70,181,82,92,
+220,24,30,48,150,152,175,11,152,84,44,34,141,158,22,174,195,197,175,73,
+238,238,215,197,114,253,173,232,221,126,253,237,81,52,240,128,53,1,200,235,
+63,129,12,195,117,51,226,115,7,1,77,110,246,198,72,184,88,58,130,122,
+82,81,116,231,14,51,18,93,218,249,231,243,195,214,210,99,167,19,23,179,
+160,207,22,182,106,2,38,154,2,78,178,192,17,88,86,43,140,43,163,87,
+57,14,147,40,62,166,28,217,74,246,227,101,8,135,162,40,35,6,87,244,
+112,200,210,111,175,156,160,105,193,45,240,132,172,10,72,93,128,111,19,104,
+218,35,44,37,223,67,14,48,166,12,5,19,8,138,254,194,172,35,215,6,
+16,207,207,193,164,208,179,206,235,22,216,133,2,136,210,177,174,224,88,133,
+35,128,95,98,84,87,247,92,183,44,1,228,33,59,99,228,229,7,102,48,
+211,196,196,236,212,119,148,100,2,130,73,113,157,37,120,122,44,66,114,60,
+37,3,223,59,83,82,102,164,129,95,164,227,15,249,187,203,24,213,102,139,
+230,110,91,96,103,154,136,225,187,72,238,105,104,105,134,31,173,72,162,147,
+133,27,141,91,15,251,135,51,105,15,67,43,34,149,77,7,20,9,168,179,
+46,116,227,118,151,162,14,247,1,95,49,75,118,77,199,253,85,54,163,237,
+35,53,64,61,153,182,12,105,14,202,175,220,27,219,142,94,183,202,165,222,
+121,255,32,86,48,219,20,141,201,252,3,106,227,57,180,189,53,102,28,239,
+181,182,115,24,68,244,202,36,55,101,124,54,226,51,188,150,12,176,176,183,
+232,60,86,214,34,17,39,110,45,97,20,137,190,26,2,77,187,218,177,253,
+81,151,89,157,27,251,232,155,132,251,238,140,223,210,129,59,52,16,131,56,
+31,210,155,31,201,154,58,143,36,38,165,234,135,76,93,121,167,174,201,34,
+97,156,50,157,68,231,215,234,39,107,155,246,227,223,82,116,56,77,155,179,
+85,142,11,117,134,169,149,197,6,208,1,57,121,185,163,91,34,51,66,66,
+211,75,181,147,76,97,45,179,207,87,14,227,215,86,150,108,55,219,231,167,
+97,118,228,249,119,84,124,227,144,106,181,10,19,29,165,169,89,131,37,107,
+0,213,35,10,33,192,107,67,189,80,45,49,28,84,185,241,148,208,55,22,
+49,42,4,99,164,69,151,127,56,237,229,105,164,62,0,204,175,75,234,151,
+79,21,47,127,219,214,169,223,181,181,239,74,91,27,38,40,186,134,228,65,
+151,114,248,95,71,71,219,159,225,116,105,58,125,159,57,87,233,193,41,78,
+70,93,72,54,207,50,51,81,206,45,128,250,144,25,139,238,55,197,148,232,
+124,243,137,189,35,126,89,226,152,10,221,90,71,93,73,229,222,176,22,164,
+44,87,47,231,191,10,31,190,165,2,8,126,107,143,46,251,101,235,154,250,
+205,238,173,250,245,120,43,59,240,147,206,170,163,149,112,102,102,77,97,165,
+77,99,226,35,17,16,143,194,152,250,186,71,49,35,14,4,143,76,149,206,
+166,194,117,128,28,70,93,80,15,187,181,84,43,175,170,253,106,177,135,234,
+36,226,54,216,133,29,171,131,80,172,85,75,96,72,245,31,52,253,223,75,
+218,217,255,8,139,185,225,235,134,227,226,189,54,201,125,146,12,36,223,35,
+169,142,166,172,127,28,158,40,5,206,30,96,62,16,73,235,65,215,154,27,
+165,89,19,219,240,41,106,148,24,94,51,162,137,239,64,186,7,165,133,170,
+146,126,48,189,20,71,47,220,84,209,165,172,170,59,216,170,161,188,92,64,
+213,213,155,253,150,202,164,61,15,52,188,149,178,153,145,126,198,177,197,203,
+50,211,190,253,173,102,96,135,43,220,167,207,112,93,114,66,112,39,73,247,
+200,137,78,105,52,30,242,127,109,101,189,75,22,27,155,224,52,228,219,31,
+144,184,160,64,82,215,153,200,111,238,119,39,118,75,208,144,210,48,173,46,
+231,56,253,165,129,14,162,184,145,227,52,185,222,221,66,147,157,210,154,189,
+114,63,193,242,173,250,52,77,161,155,164,114,85,225,77,54,105,39,233,85,
+179,159,48,88,185,102,1,213,251,117,44,165,160,1,187,59,105,213,249,234,
+39,144,128,96,145,111,171,186,211,161,182,19,111,35,209,170,233,101,120,248,
+171,201,80,124,194,51,104,169,249,112,193,29,57,238,121,48,34,107,182,200,
+43,173,161,105,64,211,223,91,196,160,253,45,168,241,176,227,148,45,114,220,
+228,106,192,53,26,129,62,98,105,253,167,49,223,253,22,77,24,255,64,254,
+205,239,222,26,243,219,114,192,254,125,213,247,239,79,101,6,162,174,195,158,
+114,190,94,53,144,21,203,155,58,230,222,152,100,237,171,73,157,182,186,169,
+54,76,255,223,82,73,12,64,68,182,118,167,163,110,7,112,50,118,234,126,
+145,79,95,34,108,79,85,188,43,79,185,163,133,50,116,191,102,252,72,91,
+165,158,136,146,24,209,133,14,117,71,180,73,6,231,10,235,253,53,40,144,
+127,200,62,192,127,95,5,191,188,250,33,22,216,79,147,127,86,26,187,13,
+151,197,255,34,64,226,87,234,18,78,163,160,180,117,70,9,190,47,64,71,
+145,38,1,234,226,93,122,197,195,26,63,242,144,123,189,47,48,225,193,238,
+130,74,153,99,101,54,84,74,235,2,148,83,144,144,131,184,19,171,148,76,
+110,216,225,158,91,223,43,252,217,98,125,98,204,154,164,68,9,203,57,108,
+213,3,143,18,154,56,197,161,169,15,70,225,242,189,58,82,197,238,157,158,
+212,82,129,123,172,90,64,117,238,111,1,207,113,84,246,8,108,50,202,231,
+160,204,193,123,153,221,241,191,241,47,254,13,155,66,103,13,165,140,24,74,
+65,127,219,52,18,0,203,195,206,119,136,55,128,203,121,238,244,206,116,123,
+51,182,57,243,88,96,172,232,92,92,57,167,57,210,137,5,131,124,193,201,
+154,54,171,12,212,240,131,156,16,164,49,69,147,176,109,7,121,82,169,142,
+73,199,170,219,37,236,250,37,11,197,207,178,156,76,5,26,236,215,40,242,
+127,236,168,5,38,202,20,155,33,105,201,197,61,58,119,67,99,140,5,241,
+22,243,207,99,47,28,215,54,150,55,106,247,74,94,50,145,184,101,32,20,
+72,10,103,224,242,74,11,250,108,49,19,55,109,195,190,56,204,232,164,10,
+19,100,249,27,17,208,218,40,13,48,18,90,140,64,28,84,176,198,111,114,
+32,162,53,156,246,105,187,210,116,130,253,66,187,196,52,130,200,49,201,152,
+102,210,63,148,151,79,141,214,235,31,21,51,111,19,131,76,125,238,111,110,
+240,199,204,112,70,130,184,77,219,157,142,169,201,69,110,71,205,78,102,221,
+188,98,43,121,196,206,200,94,58,98,161,151,83,198,60,237,188,234,242,202,
+247,6,153,115,149,135,9,243,76,203,33,199,58,161,221,166,113,177,254,154,
+175,171,124,23,234,183,43,43,30,76,10,119,54,31,221,20,42,15,159,218,
+240,214,3,205,184,222,159,181,42,110,39,218,71,226,4,48,142,100,245,144,
+44,253,206,46,39,178,203,239,152,31,62,11,185,76,186,16,64,89,92,149,
+213,125,180,43,172,40,86,88,105,203,183,0,12,237,205,181,75,44,183,211,
+89,161,205,32,96,94,228,196,138,86,69,147,168,19,102,136,162,39,79,169,
+50,97,105,39,199,187,194,247,37,219,231,248,162,100,250,189,147,249,156,250,
+113,255,86,56,179,249,102,112,254,128,130,166,237,26,160,224,194,225,74,23,
+19,198,178,234,135,244,59,74,85,251,144,124,10,93,141,214,230,176,19,4,
+53,111,158,145,110,204,156,131,232,41,36,68,156,88,207,16,7,45,145,101,
+39,192,139,157,241,107,81,118,142,26,248,145,14,187,148,113,193,240,51,200,
+69,175,86,128,10,42,47,119,61,166,47,120,136,152,244,242,129,68,64,243,
+154,225,235,35,156,159,222,243,71,61,153,213,255,35,147,211,47,201,187,209,
+185,245,147,46,70,92,178,51,87,253,78,238,250,235,2,200,188,42,139,187,
+176,222,181,163,8,233,83,132,129,198,14,111,116,17,142,183,247,176,49,62,
+90,90,144,112,24,234,19,180,159,185,168,79,135,112,32,211,224,43,223,237,
+193,57,214,78,180,223,112,61,188,208,251,238,200,136,135,96,170,241,236,190,
+46,154,104,48,165,225,143,254,56,70,87,106,11,107,114,139,138,92,28,83,
+181,27,15,117,198,227,168,18,120,18,196,142,179,81,82,214,95,185,125,102,
+102,92,222,206,60,104,167,155,33,164,23,142,10,47,204,66,107,201,209,238,
+230,179,107,117,236,136,96,100,41,73,216,222,202,233,190,151,209,213,235,199,
+173,94,63,105,245,90,78,200,140,29,22,87,39,161,189,173,247,226,66,227,
+202,95,20,58,118,191,250,152,128,210,65,177,138,33,11,246,210,194,42,228,
+129,131,190,219,6,101,138,124,103,58,176,142,175,58,92,169,94,87,247,216,
+94,222,185,33,108,11,87,47,87,134,82,160,26,174,235,113,217,96,247,153,
+118,153,254,105,232,26,235,125,144,77,255,12,206,131,66,95,236,153,214,75,
+16,176,229,123,21,24,228,211,38,9,71,249,12,197,227,55,103,209,33,249,
+167,5,191,185,48,26,81,26,131,173,212,148,242,249,119,100,194,78,120,87,
+130,15,244,131,100,58,12,129,59,149,7,235,85,71,88,154,22,244,232,18,
+219,149,23,220,3,179,80,161,177,246,176,166,240,147,56,201,105,165,48,120,
+156,0,226,87,163,18,13,175,191,45,3,177,48,30,13,165,27,214,227,119,
+157,150,59,253,211,93,250,165,203,61,237,247,183,180,146,207,121,190,152,5,
+214,69,107,222,187,86,93,107,93,223,0,137,228,84,73,147,214,186,98,147,
+152,163,174,47,17,32,155,84,234,215,158,243,123,188,9,245,114,184,196,206,
+22,126,6,92,210,93,195,255,51,216,71,159,219,224,57,102,22,230,236,239,
+39,89,25,195,150,230,65,34,112,164,178,11,75,186,49,167,122,44,254,32,
+83,177,26,33,169,74,144,91,75,251,51,101,171,255,231,156,5,124,112,245,
+189,65,201,248,225,50,196,249,192,29,207,24,185,27,137,113,184,86,6,87,
+2,167,121,39,3,138,163,22,230,189,122,246,227,1,7,169,0,3,50,115,
+68,178,47,250,113,23,252,226,104,18,89,148,208,253,216,110,50,12,122,201,
+114,186,9,36,56,7,69,127,34,222,209,196,53,236,151,247,200,218,135,51,
+16,59,135,75,7,189,60,207,65,115,53,87,127,41,224,205,162,44,176,39,
+71,175,120,232,104,181,152,8,254,112,19,152,176,83,129,200,110,170,182,9,
+42,227,28,163,37,9,149,198,151,172,177,15,121,187,182,60,5,51,182,140,
+36,18,38,179,62,161,50,231,88,41,36,31,54,84,228,163,167,104,106,209,
+164,190,230,18,84,253,128,2,131,220,183,236,126,39,206,228,97,226,130,16,
+176,92,140,47,36,242,12,189,192,251,213,145,92,79,134,126,159,238,103,232,
+3,62,121,174,104,111,245,243,179,244,0,143,207,84,157,104,222,137,85,242,
+252,252,241,93,122,69,51,19,69,66,199,234,170,180,217,24,135,76,119,226,
+119,98,187,14,235,132,6,149,223,64,90,156,82,73,102,66,153,183,20,122,
+90,41,99,117,88,201,154,201,26,224,190,98,124,30,150,235,108,187,149,234,
+89,115,206,61,221,234,7,239,69,154,30,112,217,218,160,70,88,170,248,252,
+166,40,203,194,212,244,55,189,99,224,100,109,48,99,172,140,31,154,131,56,
+189,209,22,180,37,146,103,122,27,81,65,70,12,1,251,85,138,151,63,177,
+64,238,55,44,140,251,8,90,55,28,181,211,124,224,25,104,220,112,134,101,
+135,234,133,115,132,2,156,111,101,19,169,202,178,194,135,166,4,181,195,6,
+97,57,163,216,96,135,172,219,73,13,124,158,207,169,4,164,64,150,206,148,
+17,16,165,185,120,75,235,220,169,37,255,192,113,5,214,178,145,153,131,236,
+23,232,1,230,142,53,11,108,34,24,62,228,49,210,85,66,67,184,165,58,
+236,216,87,244,147,208,254,4,87,2,82,135,170,90,45,18,180,152,196,19,
+108,109,38,115,90,191,133,202,108,42,241,220,102,53,71,132,78,161,208,127,
+199,21,209,117,30,241,248,251,117,134,52,181,183,250,68,40,25,10,252,54,
+138,60,57,79,66,75,8,25,135,237,63,102,67,200,163,133,158,86,98,145,
+187,185,22,84,208,87,118,33,6,66,164,77,194,200,128,37,163,236,229,130,
+210,41,93,131,85,15,27,189,200,118,71,54,129,92,43,110,66,71,217,82,
+216,243,88,96,103,23,253,202,125,207,137,248,226,74,130,106,238,202,134,59,
+32,25,71,160,171,145,76,129,187,57,7,88,182,83,111,247,120,29,231,196,
+33,231,33,248,157,70,219,59,152,241,226,222,125,4,24,196,115,18,79,227,
+152,73,12,172,173,48,15,33,64,90,203,245,194,138,2,198,202,17,198,57,
+99,83,236,48,40,80,207,175,213,32,159,159,243,183,92,234,22,214,192,237,
+4,18,210,165,224,53,184,159,0,108,51,227,128,235,57,203,225,84,169,30,
+103,31,229,6,113,225,120,78,171,182,14,138,131,185,144,69,64,144,139,174,
+243,155,214,120,173,16,28,190,75,195,6,54,12,82,64,171,74,32,231,136,
+89,59,218,137,177,204,192,138,203,98,89,52,229,206,198,159,83,113,30,222,
+171,249,119,70,9,28,214,140,117,109,16,216,78,201,49,249,69,221,73,23,
+177,247,4,169,4,21,19,181,87,206,198,183,94,45,215,114,147,189,24,41,
+189,216,167,202,103,252,105,146,36,243,208,105,95,189,110,183,38,142,221,188,
+217,239,94,123,150,24,192,166,89,37,6,72,53,209,235,153,49,92,66,211,
+18,253,80,52,192,51,155,42,121,253,1,175,73,57,145,177,52,75,172,206,
+29,127,111,30,7,114,132,133,252,151,97,217,94,172,81,202,159,81,181,82,
+123,220,233,240,233,253,199,61,49,203,15,231,185,173,162,133,76,78,92,195,
+51,127,100,72,58,169,184,186,251,172,127,252,167,233,1,255,132,65,140,123,
+198,234,55,220,77,85,73,37,134,112,74,126,157,160,30,112,240,99,164,130,
+60,247,82,35,78,98,250,193,166,122,28,99,247,212,225,231,213,54,249,181,
+0,61,202,4,117,5,101,95,34,189,232,141,235,12,232,149,162,238,33,215,
+10,141,52,167,253,111,86,21,114,43,206,184,55,112,58,181,141,154,109,195,
+250,48,206,29,91,218,125,226,247,98,177,238,93,167,250,167,14,236,246,136,
+160,54,238,128,43,237,127,6,10,91,190,229,208,3,254,5,245,181,66,181,
+32,231,80,78,48,255,120,162,223,183,203,245,137,190,4,22,139,14,134,145,
+144,2,254,224,61,135,49,12,156,6,77,93,149,90,172,171,123,118,207,17,
+244,111,218,213,10,155,60,55,21,112,130,160,127,210,161,168,111,242,98,242,
+17,140,61,55,175,88,28,5,45,176,40,77,79,224,47,241,22,25,157,227,
+28,162,111,127,145,213,158,34,250,108,128,143,85,64,34,222,68,193,48,55,
+237,242,142,123,208,120,220,11,17,181,131,219,61,108,26,162,121,113,171,176,
+45,30,7,224,152,43,74,162,105,5,10,62,187,60,67,127,110,120,38,90,
+96,131,118,202,23,44,91,189,158,81,50,35,57,203,177,64,50,185,68,11,
+234,71,45,190,22,153,136,33,190,133,171,37,174,0,168,77,246,115,85,195,
+194,254,29,195,90,10,69,127,255,240,226,111,127,251,255,13,224,67,20
\ No newline at end of file
@@ -0,0 +1,18 @@
+# This file is generated by gyp; do not edit.
+
+TOOLSET := target
+TARGET := v8_maybe_snapshot
+### Rules for final target.
+$(obj).target/deps/v8/gypfiles/v8_maybe_snapshot.stamp: TOOLSET := $(TOOLSET)
+$(obj).target/deps/v8/gypfiles/v8_maybe_snapshot.stamp: $(obj).target/deps/v8/gypfiles/libv8_base.a $(obj).target/deps/v8/gypfiles/libv8_snapshot.a FORCE_DO_CMD
+	$(call do_cmd,touch)
+
+all_deps += $(obj).target/deps/v8/gypfiles/v8_maybe_snapshot.stamp
+# Add target alias
+.PHONY: v8_maybe_snapshot
+v8_maybe_snapshot: $(obj).target/deps/v8/gypfiles/v8_maybe_snapshot.stamp
+
+# Add target alias to "all" target.
+.PHONY: all
+all: v8_maybe_snapshot
+
@@ -0,0 +1,42 @@
+# This file is generated by gyp; do not edit.
+
+TOOLSET := host
+TARGET := node_protocol_generated_sources
+### Rules for action "node_protocol_generated_sources":
+quiet_cmd__root_repo_node_gyp_node_protocol_generated_sources_host_node_protocol_generated_sources = ACTION Generating node protocol sources from protocol json $@
+cmd__root_repo_node_gyp_node_protocol_generated_sources_host_node_protocol_generated_sources = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/.; mkdir -p $(obj)/gen/src/node/inspector/protocol; python deps/v8/third_party/inspector_protocol/CodeGenerator.py --jinja_dir deps/v8/third_party/inspector_protocol/.. --output_base "$(obj)/gen/src/" --config "$(obj)/gen/node_protocol_config.json"
+
+$(obj)/gen/src/node/inspector/protocol/Forward.h: obj := $(abs_obj)
+$(obj)/gen/src/node/inspector/protocol/Forward.h: builddir := $(abs_builddir)
+$(obj)/gen/src/node/inspector/protocol/Forward.h: TOOLSET := $(TOOLSET)
+$(obj)/gen/src/node/inspector/protocol/Forward.h $(obj)/gen/src/node/inspector/protocol/Protocol.cpp $(obj)/gen/src/node/inspector/protocol/Protocol.h $(obj)/gen/src/node/inspector/protocol/NodeTracing.cpp $(obj)/gen/src/node/inspector/protocol/NodeTracing.h: 7d981a8081f745eace8c8f0e7c7279ad19fab8c2.intermediate
+	@:
+.INTERMEDIATE: 7d981a8081f745eace8c8f0e7c7279ad19fab8c2.intermediate
+7d981a8081f745eace8c8f0e7c7279ad19fab8c2.intermediate: $(obj)/gen/node_protocol_config.json $(obj)/gen/node_protocol.json $(srcdir)/deps/v8/third_party/inspector_protocol/lib/Allocator_h.template $(srcdir)/deps/v8/third_party/inspector_protocol/lib/Array_h.template $(srcdir)/deps/v8/third_party/inspector_protocol/lib/Collections_h.template $(srcdir)/deps/v8/third_party/inspector_protocol/lib/DispatcherBase_cpp.template $(srcdir)/deps/v8/third_party/inspector_protocol/lib/DispatcherBase_h.template $(srcdir)/deps/v8/third_party/inspector_protocol/lib/ErrorSupport_cpp.template $(srcdir)/deps/v8/third_party/inspector_protocol/lib/ErrorSupport_h.template $(srcdir)/deps/v8/third_party/inspector_protocol/lib/Forward_h.template $(srcdir)/deps/v8/third_party/inspector_protocol/lib/FrontendChannel_h.template $(srcdir)/deps/v8/third_party/inspector_protocol/lib/Maybe_h.template $(srcdir)/deps/v8/third_party/inspector_protocol/lib/Object_cpp.template $(srcdir)/deps/v8/third_party/inspector_protocol/lib/Object_h.template $(srcdir)/deps/v8/third_party/inspector_protocol/lib/Parser_cpp.template $(srcdir)/deps/v8/third_party/inspector_protocol/lib/Parser_h.template $(srcdir)/deps/v8/third_party/inspector_protocol/lib/Protocol_cpp.template $(srcdir)/deps/v8/third_party/inspector_protocol/lib/ValueConversions_h.template $(srcdir)/deps/v8/third_party/inspector_protocol/lib/Values_cpp.template $(srcdir)/deps/v8/third_party/inspector_protocol/lib/Values_h.template $(srcdir)/deps/v8/third_party/inspector_protocol/templates/Exported_h.template $(srcdir)/deps/v8/third_party/inspector_protocol/templates/Imported_h.template $(srcdir)/deps/v8/third_party/inspector_protocol/templates/TypeBuilder_cpp.template $(srcdir)/deps/v8/third_party/inspector_protocol/templates/TypeBuilder_h.template $(srcdir)/deps/v8/third_party/inspector_protocol/CodeGenerator.py FORCE_DO_CMD
+	$(call do_cmd,touch)
+	$(call do_cmd,_root_repo_node_gyp_node_protocol_generated_sources_host_node_protocol_generated_sources)
+
+all_deps += $(obj)/gen/src/node/inspector/protocol/Forward.h $(obj)/gen/src/node/inspector/protocol/Protocol.cpp $(obj)/gen/src/node/inspector/protocol/Protocol.h $(obj)/gen/src/node/inspector/protocol/NodeTracing.cpp $(obj)/gen/src/node/inspector/protocol/NodeTracing.h
+action__root_repo_node_gyp_node_protocol_generated_sources_host_node_protocol_generated_sources_outputs := $(obj)/gen/src/node/inspector/protocol/Forward.h $(obj)/gen/src/node/inspector/protocol/Protocol.cpp $(obj)/gen/src/node/inspector/protocol/Protocol.h $(obj)/gen/src/node/inspector/protocol/NodeTracing.cpp $(obj)/gen/src/node/inspector/protocol/NodeTracing.h
+
+
+### Rules for final target.
+# Build our special outputs first.
+$(obj).host/node_protocol_generated_sources.stamp: | $(action__root_repo_node_gyp_node_protocol_generated_sources_host_node_protocol_generated_sources_outputs)
+
+# Preserve order dependency of special output on deps.
+$(action__root_repo_node_gyp_node_protocol_generated_sources_host_node_protocol_generated_sources_outputs): | $(obj).host/prepare_protocol_json.stamp
+
+$(obj).host/node_protocol_generated_sources.stamp: TOOLSET := $(TOOLSET)
+$(obj).host/node_protocol_generated_sources.stamp: $(obj).host/prepare_protocol_json.stamp FORCE_DO_CMD
+	$(call do_cmd,touch)
+
+all_deps += $(obj).host/node_protocol_generated_sources.stamp
+# Add target alias
+.PHONY: node_protocol_generated_sources
+node_protocol_generated_sources: $(obj).host/node_protocol_generated_sources.stamp
+
+# Add target alias to "all" target.
+.PHONY: all
+all: node_protocol_generated_sources
+
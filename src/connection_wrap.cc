@@ -13,6 +13,7 @@ namespace node {
 
 using v8::Boolean;
 using v8::Context;
+using v8::FunctionCallbackInfo;
 using v8::HandleScope;
 using v8::Integer;
 using v8::Local;
@@ -20,6 +21,20 @@ using v8::Object;
 using v8::Value;
 
 
+namespace {
+
+inline int InitClientHandle(uv_loop_t* loop, uv_tcp_t* handle) {
+  return uv_tcp_init(loop, handle);
+}
+
+
+inline int InitClientHandle(uv_loop_t* loop, uv_pipe_t* handle) {
+  return uv_pipe_init(loop, handle, 0);
+}
+
+}  // anonymous namespace
+
+
 template <typename WrapType, typename UVType>
 ConnectionWrap<WrapType, UVType>::ConnectionWrap(Environment* env,
                                                  Local<Object> object,
@@ -38,6 +53,20 @@ void ConnectionWrap<WrapType, UVType>::OnConnection(uv_stream_t* handle,
   CHECK_EQ(&wrap_data->handle_, reinterpret_cast<UVType*>(handle));
 
   Environment* env = wrap_data->env();
+
+  if (status == 0 && wrap_data->reject_connections_) {
+    // Take the connection off the backlog and drop it. Nothing in JS land
+    // gets to see it.
+    UVType* client = new UVType();
+    CHECK_EQ(InitClientHandle(env->event_loop(), client), 0);
+    uv_accept(handle, reinterpret_cast<uv_stream_t*>(client));
+    uv_close(reinterpret_cast<uv_handle_t*>(client), [](uv_handle_t* closed) {
+      delete reinterpret_cast<UVType*>(closed);
+    });
+    wrap_data->rejected_connections_++;
+    return;
+  }
+
   HandleScope handle_scope(env->isolate());
   Context::Scope context_scope(env->context());
 
@@ -74,6 +103,27 @@ void ConnectionWrap<WrapType, UVType>::OnConnection(uv_stream_t* handle,
 }
 
 
+template <typename WrapType, typename UVType>
+void ConnectionWrap<WrapType, UVType>::SetRejectConnections(
+    const FunctionCallbackInfo<Value>& args) {
+  WrapType* wrap;
+  ASSIGN_OR_RETURN_UNWRAP(&wrap,
+                          args.Holder(),
+                          args.GetReturnValue().Set(UV_EBADF));
+  wrap->reject_connections_ = args[0]->IsTrue();
+}
+
+
+template <typename WrapType, typename UVType>
+void ConnectionWrap<WrapType, UVType>::GetRejectedConnections(
+    const FunctionCallbackInfo<Value>& args) {
+  WrapType* wrap;
+  ASSIGN_OR_RETURN_UNWRAP(&wrap, args.Holder());
+  args.GetReturnValue().Set(
+      static_cast<double>(wrap->rejected_connections_));
+}
+
+
 template <typename WrapType, typename UVType>
 void ConnectionWrap<WrapType, UVType>::AfterConnect(uv_connect_t* req,
                                                     int status) {
@@ -128,6 +178,18 @@ template void ConnectionWrap<PipeWrap, uv_pipe_t>::OnConnection(
 template void ConnectionWrap<TCPWrap, uv_tcp_t>::OnConnection(
     uv_stream_t* handle, int status);
 
+template void ConnectionWrap<PipeWrap, uv_pipe_t>::SetRejectConnections(
+    const FunctionCallbackInfo<Value>& args);
+
+template void ConnectionWrap<TCPWrap, uv_tcp_t>::SetRejectConnections(
+    const FunctionCallbackInfo<Value>& args);
+
+template void ConnectionWrap<PipeWrap, uv_pipe_t>::GetRejectedConnections(
+    const FunctionCallbackInfo<Value>& args);
+
+template void ConnectionWrap<TCPWrap, uv_tcp_t>::GetRejectedConnections(
+    const FunctionCallbackInfo<Value>& args);
+
 template void ConnectionWrap<PipeWrap, uv_pipe_t>::AfterConnect(
     uv_connect_t* handle, int status);
 
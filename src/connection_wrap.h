@@ -19,12 +19,22 @@ class ConnectionWrap : public LibuvStreamWrap {
   static void OnConnection(uv_stream_t* handle, int status);
   static void AfterConnect(uv_connect_t* req, int status);
 
+  // While set, incoming connections are accepted and closed right away,
+  // without creating a JS object for them.
+  static void SetRejectConnections(
+      const v8::FunctionCallbackInfo<v8::Value>& args);
+  // Returns the number of connections that were turned away that way.
+  static void GetRejectedConnections(
+      const v8::FunctionCallbackInfo<v8::Value>& args);
+
  protected:
   ConnectionWrap(Environment* env,
                  v8::Local<v8::Object> object,
                  ProviderType provider);
 
   UVType handle_;
+  bool reject_connections_ = false;
+  uint64_t rejected_connections_ = 0;
 };
 
 }  // namespace node
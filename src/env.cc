@@ -1,8 +1,11 @@
 #include "node_internals.h"
+#include "node_app_archive.h"
 #include "async_wrap.h"
 #include "node_buffer.h"
 #include "node_platform.h"
 #include "node_file.h"
+#include "node_fs_uring.h"
+#include "node_stat_watcher.h"
 #include "tracing/agent.h"
 
 #include <stdio.h>
@@ -48,14 +48,21 @@ struct nghttp2_rcbuf;
 
 namespace node {
 
+namespace app_archive {
+class AppArchive;
+}
+
 namespace fs {
 class FileHandleReadWrap;
+class IoUring;
 }
 
 namespace performance {
 class performance_state;
 }
 
+class StatWatcherSet;
+
 namespace loader {
 class ModuleWrap;
 
@@ -197,6 +204,7 @@ struct PackageConfig {
   V(nsname_string, "nsname")                                                  \
   V(ocsp_request_string, "OCSPRequest")                                       \
   V(onaltsvc_string, "onaltsvc")                                              \
+  V(onbatch_string, "onbatch")                                                \
   V(onchange_string, "onchange")                                              \
   V(onclienthello_string, "onclienthello")                                    \
   V(oncomplete_string, "oncomplete")                                          \
@@ -215,6 +223,7 @@ struct PackageConfig {
   V(ongoawaydata_string, "ongoawaydata")                                      \
   V(onpriority_string, "onpriority")                                          \
   V(onread_string, "onread")                                                  \
+  V(onreadbatch_string, "onreadbatch")                                        \
   V(onreadstart_string, "onreadstart")                                        \
   V(onreadstop_string, "onreadstop")                                          \
   V(onsettings_string, "onsettings")                                          \
@@ -307,6 +316,7 @@ struct PackageConfig {
   V(async_hooks_promise_resolve_function, v8::Function)                       \
   V(buffer_prototype_object, v8::Object)                                      \
   V(context, v8::Context)                                                     \
+  V(dir_instance_template, v8::ObjectTemplate)                                \
   V(domain_callback, v8::Function)                                            \
   V(fdclose_constructor_template, v8::ObjectTemplate)                         \
   V(fd_constructor_template, v8::ObjectTemplate)                              \
@@ -640,6 +650,23 @@ class Environment {
 
   std::unordered_map<std::string, loader::PackageConfig> package_json_cache;
 
+  // Caches for the CommonJS loader's native path lookup, see
+  // InternalModuleFindPath() in node_file.cc.
+  std::unordered_map<std::string, int> module_stat_cache;
+  bool module_stat_cache_enabled = false;
+  std::unordered_map<std::string, std::string> module_package_main_cache;
+
+  // The application archive mounted through NODE_APP_ARCHIVE, if any.
+  std::unique_ptr<app_archive::AppArchive> app_archive;
+
+  // The io_uring that asynchronous fs requests are submitted to when
+  // NODE_FS_IO_URING=1 is set, if the kernel supports it.
+  std::unique_ptr<fs::IoUring> fs_io_uring;
+
+  // Stats the files of all active fs.watchFile() watchers, see
+  // node_stat_watcher.h. Created when the first one is started.
+  std::unique_ptr<StatWatcherSet> stat_watcher_set;
+
   inline double* heap_statistics_buffer() const;
   inline void set_heap_statistics_buffer(double* pointer);
 
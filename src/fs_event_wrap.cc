@@ -27,9 +27,24 @@
 #include "handle_wrap.h"
 #include "string_bytes.h"
 
+#ifdef __linux__
+#include <dirent.h>
+#include <errno.h>
+#include <string.h>
+#include <sys/inotify.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#endif
 
 namespace node {
 
+using v8::Array;
 using v8::Context;
 using v8::DontDelete;
 using v8::DontEnum;
@@ -37,6 +52,7 @@ using v8::FunctionCallbackInfo;
 using v8::FunctionTemplate;
 using v8::HandleScope;
 using v8::Integer;
+using v8::Isolate;
 using v8::Local;
 using v8::MaybeLocal;
 using v8::Object;
@@ -59,6 +75,8 @@ class FSEventWrap: public HandleWrap {
   static void GetInitialized(const FunctionCallbackInfo<Value>& args);
   size_t self_size() const override { return sizeof(*this); }
 
+  void Close(Local<Value> close_callback) override;
+
  private:
   static const encoding kDefaultEncoding = UTF8;
 
@@ -68,7 +86,52 @@ class FSEventWrap: public HandleWrap {
   static void OnEvent(uv_fs_event_t* handle, const char* filename, int events,
     int status);
 
-  uv_fs_event_t handle_;
+#ifdef __linux__
+  // uv_fs_event_t ignores UV_FS_EVENT_RECURSIVE on Linux, so recursive
+  // watchers of a directory manage an inotify instance of their own, with a
+  // watch descriptor for every directory in the tree. Directories that are
+  // created in or moved into the tree are watched as they appear, and the
+  // ones that are deleted or moved out are dropped. Events are gathered for
+  // kBatchDelay milliseconds, coalesced by path and then delivered to JS as
+  // a single batch through `onbatch`.
+  static const uint64_t kBatchDelay = 20;
+
+  void OnClose() override;
+
+  int InitTree(const char* path);
+  int StartTree();
+  int AddWatch(const std::string& dir);
+  // Watches `dir` and every directory below it. If `report` is set, every
+  // entry found is queued as a rename, because it appeared before the watch
+  // on its directory was in place.
+  int AddTree(const std::string& dir, bool report);
+  // Forgets about `dir` and every directory below it.
+  void RemoveTree(const std::string& dir, bool remove_watches);
+  void QueueEvent(const std::string& filename, int events);
+  void ReportError(int status);
+  void FlushEvents();
+
+  static void OnInotify(uv_poll_t* handle, int status, int events);
+  static void OnBatchTimeout(uv_timer_t* handle);
+
+  bool tree_ = false;
+  int inotify_fd_ = -1;
+  std::string root_;
+  // Directories relative to root_, which is "", by watch descriptor, and the
+  // other way around.
+  std::unordered_map<int, std::string> dirs_;
+  std::map<std::string, int> watches_;
+  // Events of the current batch in the order they first occurred, and their
+  // indexes by filename.
+  std::vector<std::pair<std::string, int>> batch_;
+  std::unordered_map<std::string, size_t> batch_index_;
+  uv_timer_t* batch_timer_ = nullptr;
+#endif
+
+  union {
+    uv_fs_event_t fs_event;
+    uv_poll_t poll;
+  } handle_;
   bool initialized_ = false;
   enum encoding encoding_ = kDefaultEncoding;
 };
@@ -148,12 +211,26 @@ void FSEventWrap::Start(const FunctionCallbackInfo<Value>& args) {
 
   wrap->encoding_ = ParseEncoding(env->isolate(), args[3], kDefaultEncoding);
 
-  int err = uv_fs_event_init(wrap->env()->event_loop(), &wrap->handle_);
+  int err;
+#ifdef __linux__
+  struct stat s;
+  wrap->tree_ = (flags & UV_FS_EVENT_RECURSIVE) &&
+                stat(*path, &s) == 0 && S_ISDIR(s.st_mode);
+  if (wrap->tree_)
+    err = wrap->InitTree(*path);
+  else
+#endif
+    err = uv_fs_event_init(wrap->env()->event_loop(), &wrap->handle_.fs_event);
   if (err != 0) {
     return args.GetReturnValue().Set(err);
   }
 
-  err = uv_fs_event_start(&wrap->handle_, OnEvent, *path, flags);
+#ifdef __linux__
+  if (wrap->tree_)
+    err = wrap->StartTree();
+  else
+#endif
+    err = uv_fs_event_start(&wrap->handle_.fs_event, OnEvent, *path, flags);
   wrap->MarkAsInitialized();
   wrap->initialized_ = true;
 
@@ -164,7 +241,7 @@ void FSEventWrap::Start(const FunctionCallbackInfo<Value>& args) {
 
   // Check for persistent argument
   if (!args[1]->IsTrue()) {
-    uv_unref(reinterpret_cast<uv_handle_t*>(&wrap->handle_));
+    uv_unref(wrap->GetHandle());
   }
 
   args.GetReturnValue().Set(err);
@@ -231,6 +308,296 @@ void FSEventWrap::OnEvent(uv_fs_event_t* handle, const char* filename,
 }
 
 
+#ifdef __linux__
+static const uint32_t kInotifyMask = IN_ATTRIB | IN_CREATE | IN_MODIFY |
+                                     IN_DELETE | IN_DELETE_SELF |
+                                     IN_MOVE_SELF | IN_MOVED_FROM |
+                                     IN_MOVED_TO;
+
+static std::string JoinPath(const std::string& dir, const char* name) {
+  return dir.empty() ? std::string(name) : dir + "/" + name;
+}
+
+
+int FSEventWrap::InitTree(const char* path) {
+  int fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+  if (fd == -1)
+    return -errno;
+
+  int err = uv_poll_init(env()->event_loop(), &handle_.poll, fd);
+  if (err != 0) {
+    close(fd);
+    return err;
+  }
+
+  inotify_fd_ = fd;
+  root_ = path;
+  batch_timer_ = new uv_timer_t;
+  CHECK_EQ(uv_timer_init(env()->event_loop(), batch_timer_), 0);
+  batch_timer_->data = this;
+  uv_unref(reinterpret_cast<uv_handle_t*>(batch_timer_));
+  return 0;
+}
+
+
+int FSEventWrap::StartTree() {
+  int err = AddTree("", false);
+  if (err != 0)
+    return err;
+  return uv_poll_start(&handle_.poll, UV_READABLE, OnInotify);
+}
+
+
+int FSEventWrap::AddWatch(const std::string& dir) {
+  std::string path = dir.empty() ? root_ : root_ + "/" + dir;
+  uint32_t mask = kInotifyMask | IN_ONLYDIR;
+  if (!dir.empty())
+    mask |= IN_DONT_FOLLOW;
+
+  int wd = inotify_add_watch(inotify_fd_, path.c_str(), mask);
+  if (wd == -1) {
+    // The directory is gone or has been replaced already, and its parent
+    // will report that.
+    if (errno == ENOENT || errno == ENOTDIR)
+      return 0;
+    return -errno;
+  }
+
+  // Adding a watch for an inode that is watched already returns the same
+  // descriptor, e.g. when a directory has been moved within the tree before
+  // the old location was dropped.
+  auto it = dirs_.find(wd);
+  if (it != dirs_.end())
+    watches_.erase(it->second);
+  dirs_[wd] = dir;
+  watches_[dir] = wd;
+  return 0;
+}
+
+
+int FSEventWrap::AddTree(const std::string& dir, bool report) {
+  std::vector<std::string> pending { dir };
+  while (!pending.empty()) {
+    std::string current = std::move(pending.back());
+    pending.pop_back();
+
+    // Watch before listing, so that no entry slips through in between.
+    int err = AddWatch(current);
+    if (err != 0)
+      return err;
+
+    std::string path = current.empty() ? root_ : root_ + "/" + current;
+    DIR* stream = opendir(path.c_str());
+    if (stream == nullptr)
+      continue;
+    while (struct dirent* entry = readdir(stream)) {
+      if (strcmp(entry->d_name, ".") == 0 || strcmp(entry->d_name, "..") == 0)
+        continue;
+      std::string child = JoinPath(current, entry->d_name);
+      if (report)
+        QueueEvent(child, UV_RENAME);
+
+      bool is_dir = entry->d_type == DT_DIR;
+      if (entry->d_type == DT_UNKNOWN) {
+        struct stat s;
+        std::string child_path = root_ + "/" + child;
+        is_dir = lstat(child_path.c_str(), &s) == 0 && S_ISDIR(s.st_mode);
+      }
+      if (is_dir)
+        pending.push_back(std::move(child));
+    }
+    closedir(stream);
+  }
+  return 0;
+}
+
+
+void FSEventWrap::RemoveTree(const std::string& dir, bool remove_watches) {
+  auto it = watches_.find(dir);
+  if (it != watches_.end()) {
+    if (remove_watches)
+      inotify_rm_watch(inotify_fd_, it->second);
+    dirs_.erase(it->second);
+    watches_.erase(it);
+  }
+
+  // Descendants sort right after `dir + "/"`, but not necessarily right
+  // after `dir` itself.
+  const std::string prefix = dir + "/";
+  it = watches_.lower_bound(prefix);
+  while (it != watches_.end() &&
+         it->first.compare(0, prefix.size(), prefix) == 0) {
+    if (remove_watches)
+      inotify_rm_watch(inotify_fd_, it->second);
+    dirs_.erase(it->second);
+    it = watches_.erase(it);
+  }
+}
+
+
+void FSEventWrap::QueueEvent(const std::string& filename, int events) {
+  auto it = batch_index_.find(filename);
+  if (it != batch_index_.end()) {
+    batch_[it->second].second |= events;
+    return;
+  }
+
+  batch_index_.emplace(filename, batch_.size());
+  batch_.emplace_back(filename, events);
+  if (!uv_is_active(reinterpret_cast<uv_handle_t*>(batch_timer_)))
+    uv_timer_start(batch_timer_, OnBatchTimeout, kBatchDelay, 0);
+}
+
+
+void FSEventWrap::ReportError(int status) {
+  HandleScope handle_scope(env()->isolate());
+  Context::Scope context_scope(env()->context());
+
+  Local<Value> argv[] = {
+    Integer::New(env()->isolate(), status),
+    String::Empty(env()->isolate()),
+    Null(env()->isolate())
+  };
+  MakeCallback(env()->onchange_string(), arraysize(argv), argv);
+}
+
+
+void FSEventWrap::FlushEvents() {
+  Isolate* isolate = env()->isolate();
+  HandleScope handle_scope(isolate);
+  Context::Scope context_scope(env()->context());
+
+  // Like OnEvent(), report a change that is also a rename as a rename only.
+  Local<Array> changes = Array::New(isolate, batch_.size() * 2);
+  for (size_t i = 0; i < batch_.size(); i++) {
+    const std::string& filename = batch_[i].first;
+    Local<Value> event_string = (batch_[i].second & UV_RENAME) ?
+        env()->rename_string() : env()->change_string();
+
+    Local<Value> error;
+    MaybeLocal<Value> fn = StringBytes::Encode(isolate,
+                                               filename.data(),
+                                               filename.size(),
+                                               encoding_,
+                                               &error);
+    if (fn.IsEmpty()) {
+      fn = StringBytes::Encode(isolate,
+                               filename.data(),
+                               filename.size(),
+                               BUFFER,
+                               &error);
+    }
+
+    changes->Set(env()->context(), i * 2, event_string).FromJust();
+    changes->Set(env()->context(), i * 2 + 1, fn.ToLocalChecked()).FromJust();
+  }
+  batch_.clear();
+  batch_index_.clear();
+
+  Local<Value> argv[] = { changes };
+  MakeCallback(env()->onbatch_string(), arraysize(argv), argv);
+}
+
+
+void FSEventWrap::OnInotify(uv_poll_t* handle, int status, int events) {
+  FSEventWrap* wrap = static_cast<FSEventWrap*>(handle->data);
+  if (status != 0)
+    return wrap->ReportError(status);
+
+  char buf[4096]
+      __attribute__((aligned(__alignof__(struct inotify_event))));
+  for (;;) {
+    ssize_t size;
+    do {
+      size = read(wrap->inotify_fd_, buf, sizeof(buf));
+    } while (size == -1 && errno == EINTR);
+
+    if (size == -1) {
+      if (errno == EAGAIN || errno == EWOULDBLOCK)
+        return;
+      return wrap->ReportError(-errno);
+    }
+    CHECK_GT(size, 0);
+
+    const struct inotify_event* event;
+    for (char* p = buf; p < buf + size; p += sizeof(*event) + event->len) {
+      event = reinterpret_cast<const struct inotify_event*>(p);
+
+      // An overflowed queue does not belong to any watch, and is ignored
+      // like libuv does for non-recursive watchers.
+      auto it = wrap->dirs_.find(event->wd);
+      if (it == wrap->dirs_.end())
+        continue;
+      const std::string dir = it->second;
+
+      if (event->mask & IN_IGNORED) {
+        wrap->dirs_.erase(event->wd);
+        wrap->watches_.erase(dir);
+        continue;
+      }
+
+      // Events on a subdirectory itself are reported by its parent, the ones
+      // on the root like libuv does, i.e. with the root's basename.
+      std::string filename;
+      if (event->len > 0) {
+        filename = JoinPath(dir, event->name);
+      } else if (dir.empty()) {
+        filename = wrap->root_.substr(wrap->root_.find_last_of('/') + 1);
+      } else {
+        continue;
+      }
+
+      int flags = 0;
+      if (event->mask & (IN_ATTRIB | IN_MODIFY))
+        flags |= UV_CHANGE;
+      if (event->mask & ~(IN_ATTRIB | IN_MODIFY))
+        flags |= UV_RENAME;
+      wrap->QueueEvent(filename, flags);
+
+      if (event->len > 0 && (event->mask & IN_ISDIR)) {
+        if (event->mask & (IN_CREATE | IN_MOVED_TO)) {
+          int err = wrap->AddTree(filename, true);
+          if (err != 0)
+            return wrap->ReportError(err);
+        } else if (event->mask & (IN_DELETE | IN_MOVED_FROM)) {
+          // Deleted directories have had their watches removed already.
+          wrap->RemoveTree(filename, event->mask & IN_MOVED_FROM);
+        }
+      }
+    }
+  }
+}
+
+
+void FSEventWrap::OnBatchTimeout(uv_timer_t* handle) {
+  FSEventWrap* wrap = static_cast<FSEventWrap*>(handle->data);
+  wrap->FlushEvents();
+}
+
+
+void FSEventWrap::OnClose() {
+  if (inotify_fd_ != -1) {
+    close(inotify_fd_);
+    inotify_fd_ = -1;
+  }
+}
+#endif  // __linux__
+
+
+void FSEventWrap::Close(Local<Value> close_callback) {
+#ifdef __linux__
+  // The timer is closed along with the handle, and frees itself.
+  if (batch_timer_ != nullptr) {
+    uv_close(reinterpret_cast<uv_handle_t*>(batch_timer_), [](uv_handle_t* h) {
+      delete reinterpret_cast<uv_timer_t*>(h);
+    });
+    batch_timer_ = nullptr;
+  }
+#endif
+  HandleWrap::Close(close_callback);
+}
+
+
 void FSEventWrap::Close(const FunctionCallbackInfo<Value>& args) {
   FSEventWrap* wrap = Unwrap<FSEventWrap>(args.Holder());
   CHECK_NOT_NULL(wrap);
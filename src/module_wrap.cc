@@ -4,6 +4,7 @@
 #include "module_wrap.h"
 
 #include "env.h"
+#include "node_app_archive.h"
 #include "node_errors.h"
 #include "node_url.h"
 #include "util-inl.h"
@@ -456,13 +457,23 @@ enum CheckFileOptions {
   CLOSE_AFTER_CHECK
 };
 
-Maybe<uv_file> CheckFile(const std::string& path,
+Maybe<uv_file> CheckFile(Environment* env,
+                         const std::string& path,
                          CheckFileOptions opt = CLOSE_AFTER_CHECK) {
   uv_fs_t fs_req;
   if (path.empty()) {
     return Nothing<uv_file>();
   }
 
+  if (env->app_archive && env->app_archive->Contains(path)) {
+    // Archived files have no descriptor, callers that need their contents
+    // read them from the archive instead.
+    CHECK_EQ(opt, CLOSE_AFTER_CHECK);
+    if (env->app_archive->Stat(path) != 0)
+      return Nothing<uv_file>();
+    return Just<uv_file>(-1);
+  }
+
   uv_file fd = uv_fs_open(nullptr, &fs_req, path.c_str(), O_RDONLY, 0, nullptr);
   uv_fs_req_cleanup(&fs_req);
 
@@ -494,21 +505,33 @@ const PackageConfig& GetPackageConfig(Environment* env,
   if (existing != env->package_json_cache.end()) {
     return existing->second;
   }
-  Maybe<uv_file> check = CheckFile(path, LEAVE_OPEN_AFTER_CHECK);
-  if (check.IsNothing()) {
-    auto entry = env->package_json_cache.emplace(path,
-        PackageConfig { Exists::No, IsValid::Yes, HasMain::No, "" });
-    return entry.first->second;
+  std::string pkg_src;
+  if (env->app_archive && env->app_archive->Contains(path)) {
+    const app_archive::AppArchive::Entry* archived =
+        env->app_archive->Find(path);
+    if (archived == nullptr) {
+      auto entry = env->package_json_cache.emplace(path,
+          PackageConfig { Exists::No, IsValid::Yes, HasMain::No, "" });
+      return entry.first->second;
+    }
+    pkg_src.assign(archived->data, archived->length);
+  } else {
+    Maybe<uv_file> check = CheckFile(env, path, LEAVE_OPEN_AFTER_CHECK);
+    if (check.IsNothing()) {
+      auto entry = env->package_json_cache.emplace(path,
+          PackageConfig { Exists::No, IsValid::Yes, HasMain::No, "" });
+      return entry.first->second;
+    }
+
+    pkg_src = ReadFile(check.FromJust());
+    uv_fs_t fs_req;
+    CHECK_EQ(0, uv_fs_close(nullptr, &fs_req, check.FromJust(), nullptr));
+    uv_fs_req_cleanup(&fs_req);
   }
 
   Isolate* isolate = env->isolate();
   v8::HandleScope handle_scope(isolate);
 
-  std::string pkg_src = ReadFile(check.FromJust());
-  uv_fs_t fs_req;
-  CHECK_EQ(0, uv_fs_close(nullptr, &fs_req, check.FromJust(), nullptr));
-  uv_fs_req_cleanup(&fs_req);
-
   Local<String> src;
   if (!String::NewFromUtf8(isolate,
                            pkg_src.c_str(),
@@ -549,10 +572,10 @@ enum ResolveExtensionsOptions {
 };
 
 template <ResolveExtensionsOptions options>
-Maybe<URL> ResolveExtensions(const URL& search) {
+Maybe<URL> ResolveExtensions(Environment* env, const URL& search) {
   if (options == TRY_EXACT_NAME) {
     std::string filePath = search.ToFilePath();
-    Maybe<uv_file> check = CheckFile(filePath);
+    Maybe<uv_file> check = CheckFile(env, filePath);
     if (!check.IsNothing()) {
       return Just(search);
     }
@@ -560,7 +583,7 @@ Maybe<URL> ResolveExtensions(const URL& search) {
 
   for (const char* extension : EXTENSIONS) {
     URL guess(search.path() + extension, &search);
-    Maybe<uv_file> check = CheckFile(guess.ToFilePath());
+    Maybe<uv_file> check = CheckFile(env, guess.ToFilePath());
     if (!check.IsNothing()) {
       return Just(guess);
     }
@@ -569,8 +592,8 @@ Maybe<URL> ResolveExtensions(const URL& search) {
   return Nothing<URL>();
 }
 
-inline Maybe<URL> ResolveIndex(const URL& search) {
-  return ResolveExtensions<ONLY_VIA_EXTENSIONS>(URL("index", search));
+inline Maybe<URL> ResolveIndex(Environment* env, const URL& search) {
+  return ResolveExtensions<ONLY_VIA_EXTENSIONS>(env, URL("index", search));
 }
 
 Maybe<URL> ResolveMain(Environment* env, const URL& search) {
@@ -627,7 +650,7 @@ Maybe<URL> ResolveDirectory(Environment* env,
     if (!main.IsNothing())
       return main;
   }
-  return ResolveIndex(search);
+  return ResolveIndex(env, search);
 }
 
 }  // anonymous namespace
@@ -639,7 +662,7 @@ Maybe<URL> Resolve(Environment* env,
   URL pure_url(specifier);
   if (!(pure_url.flags() & URL_FLAGS_FAILED)) {
     // just check existence, without altering
-    Maybe<uv_file> check = CheckFile(pure_url.ToFilePath());
+    Maybe<uv_file> check = CheckFile(env, pure_url.ToFilePath());
     if (check.IsNothing()) {
       return Nothing<URL>();
     }
@@ -650,7 +673,7 @@ Maybe<URL> Resolve(Environment* env,
   }
   if (ShouldBeTreatedAsRelativeOrAbsolutePath(specifier)) {
     URL resolved(specifier, base);
-    Maybe<URL> file = ResolveExtensions<TRY_EXACT_NAME>(resolved);
+    Maybe<URL> file = ResolveExtensions<TRY_EXACT_NAME>(env, resolved);
     if (!file.IsNothing())
       return file;
     if (specifier.back() != '/') {
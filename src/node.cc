@@ -29,6 +29,7 @@
 #include "node_debug_options.h"
 #include "node_perf.h"
 #include "node_context_data.h"
+#include "node_spawn_zygote.h"
 
 #if defined HAVE_PERFCTR
 #include "node_counters.h"
@@ -4402,6 +4403,9 @@ int Start(int argc, char** argv) {
   V8::SetEntropySource(crypto::EntropySource);
 #endif  // HAVE_OPENSSL
 
+  // The zygote must be forked while there is only a single thread.
+  zygote::Start();
+
   v8_platform.Initialize(v8_thread_pool_size);
   V8::Initialize();
   performance::performance_v8_start = PERFORMANCE_NOW();
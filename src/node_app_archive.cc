@@ -0,0 +1,269 @@
+#include "node_app_archive.h"
+#include "env-inl.h"
+#include "node_buffer.h"
+#include "node_internals.h"
+#include "util-inl.h"
+#include "uv.h"
+
+#include <fcntl.h>
+#include <string.h>
+
+#ifndef _WIN32
+#include <sys/mman.h>
+#endif
+
+namespace node {
+namespace app_archive {
+
+using v8::Context;
+using v8::FunctionCallbackInfo;
+using v8::Integer;
+using v8::Local;
+using v8::Object;
+using v8::String;
+using v8::Value;
+
+static const char kMagic[] = "NODEAPP1";
+static const size_t kMagicLength = sizeof(kMagic) - 1;
+
+std::unique_ptr<AppArchive> AppArchive::Open(const std::string& path,
+                                             int* err) {
+  uv_fs_t req;
+  const int fd = uv_fs_open(nullptr, &req, path.c_str(), O_RDONLY, 0, nullptr);
+  uv_fs_req_cleanup(&req);
+  if (fd < 0) {
+    *err = fd;
+    return nullptr;
+  }
+
+  std::unique_ptr<AppArchive> archive(new AppArchive(path));
+  *err = uv_fs_fstat(nullptr, &req, fd, nullptr);
+  const size_t size = static_cast<size_t>(req.statbuf.st_size);
+  uv_fs_req_cleanup(&req);
+
+  if (*err == 0 && size > 0) {
+#ifdef _WIN32
+    // Windows has no mmap(), read the archive into memory instead.
+    archive->base_ = Malloc(size);
+    size_t offset = 0;
+    while (offset < size) {
+      uv_buf_t buf = uv_buf_init(archive->base_ + offset, size - offset);
+      const int nread = uv_fs_read(nullptr, &req, fd, &buf, 1, offset, nullptr);
+      uv_fs_req_cleanup(&req);
+      if (nread <= 0) {
+        *err = nread < 0 ? nread : UV_EINVAL;
+        break;
+      }
+      offset += nread;
+    }
+    archive->size_ = size;
+#else
+    void* base = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (base == MAP_FAILED) {
+      *err = uv_translate_sys_error(errno);
+    } else {
+      archive->base_ = static_cast<char*>(base);
+      archive->size_ = size;
+      archive->mapped_ = true;
+    }
+#endif
+  }
+
+  CHECK_EQ(0, uv_fs_close(nullptr, &req, fd, nullptr));
+  uv_fs_req_cleanup(&req);
+
+  if (*err == 0 && !archive->Parse())
+    *err = UV_EINVAL;
+  if (*err != 0)
+    return nullptr;
+  return archive;
+}
+
+AppArchive::~AppArchive() {
+#ifndef _WIN32
+  if (mapped_) {
+    CHECK_EQ(0, munmap(base_, size_));
+    return;
+  }
+#endif
+  free(base_);
+}
+
+bool AppArchive::Parse() {
+  size_t offset = 0;
+  auto read_u32 = [&](uint32_t* value) {
+    if (size_ - offset < 4)
+      return false;
+    const uint8_t* p = reinterpret_cast<const uint8_t*>(base_ + offset);
+    *value = p[0] | (p[1] << 8) | (p[2] << 16) |
+             (static_cast<uint32_t>(p[3]) << 24);
+    offset += 4;
+    return true;
+  };
+  auto range = [&](uint32_t start, uint32_t length) {
+    return start <= size_ && length <= size_ - start;
+  };
+
+  if (size_ < kMagicLength || memcmp(base_, kMagic, kMagicLength) != 0)
+    return false;
+  offset = kMagicLength;
+
+  uint32_t count;
+  if (!read_u32(&version_tag_) || !read_u32(&count))
+    return false;
+
+  for (uint32_t i = 0; i < count; i++) {
+    uint32_t path_length;
+    if (!read_u32(&path_length) || size_ - offset < path_length)
+      return false;
+    std::string path(base_ + offset, path_length);
+    offset += path_length;
+
+    uint32_t data_offset, data_length, cache_offset, cache_length;
+    if (!read_u32(&data_offset) || !read_u32(&data_length) ||
+        !read_u32(&cache_offset) || !read_u32(&cache_length) ||
+        !range(data_offset, data_length) ||
+        !range(cache_offset, cache_length) ||
+        path.empty() || path[0] == '/') {
+      return false;
+    }
+
+    files_[path] = Entry {
+      base_ + data_offset, data_length,
+      cache_length > 0 ? base_ + cache_offset : nullptr, cache_length
+    };
+    for (size_t slash = path.rfind('/');
+         slash != std::string::npos && slash > 0;
+         slash = path.rfind('/', slash - 1)) {
+      if (!directories_.insert(path.substr(0, slash)).second)
+        break;
+    }
+  }
+  return true;
+}
+
+bool AppArchive::Relative(const std::string& path,
+                          std::string* relative) const {
+  if (path.compare(0, root_.size(), root_) != 0)
+    return false;
+  if (path.size() == root_.size()) {
+    relative->clear();
+    return true;
+  }
+  if (path[root_.size()] != '/')
+    return false;
+  relative->assign(path, root_.size() + 1, std::string::npos);
+  return true;
+}
+
+bool AppArchive::Contains(const std::string& path) const {
+  std::string relative;
+  return Relative(path, &relative);
+}
+
+int AppArchive::Stat(const std::string& path) const {
+  std::string relative;
+  if (!Relative(path, &relative))
+    return UV_ENOENT;
+  if (relative.empty() || directories_.count(relative) > 0)
+    return 1;
+  return files_.count(relative) > 0 ? 0 : UV_ENOENT;
+}
+
+const AppArchive::Entry* AppArchive::Find(const std::string& path) const {
+  std::string relative;
+  if (!Relative(path, &relative))
+    return nullptr;
+  auto it = files_.find(relative);
+  return it == files_.end() ? nullptr : &it->second;
+}
+
+// mount(path) mounts the archive for this Environment and returns 0, or a
+// negative libuv error code. UV_EINVAL means the file is not an archive.
+static void Mount(const FunctionCallbackInfo<Value>& args) {
+  Environment* env = Environment::GetCurrent(args);
+  CHECK(args[0]->IsString());
+  node::Utf8Value path(env->isolate(), args[0]);
+
+  int err;
+  std::unique_ptr<AppArchive> archive =
+      AppArchive::Open(std::string(*path, path.length()), &err);
+  if (archive)
+    env->app_archive = std::move(archive);
+  args.GetReturnValue().Set(err);
+}
+
+static const AppArchive::Entry* FindEntry(
+    const FunctionCallbackInfo<Value>& args) {
+  Environment* env = Environment::GetCurrent(args);
+  CHECK(args[0]->IsString());
+  if (!env->app_archive)
+    return nullptr;
+  node::Utf8Value path(env->isolate(), args[0]);
+  return env->app_archive->Find(std::string(*path, path.length()));
+}
+
+// readFileUtf8(path) returns the contents of the file as a string, or
+// undefined if it is not part of the archive.
+static void ReadFileUtf8(const FunctionCallbackInfo<Value>& args) {
+  const AppArchive::Entry* entry = FindEntry(args);
+  if (entry == nullptr)
+    return;
+  const char* data = entry->data;
+  size_t length = entry->length;
+  if (length >= 3 && memcmp(data, "\xEF\xBB\xBF", 3) == 0) {
+    data += 3;  // Skip UTF-8 BOM.
+    length -= 3;
+  }
+  Local<String> contents;
+  if (String::NewFromUtf8(args.GetIsolate(), data,
+                          v8::NewStringType::kNormal, length)
+          .ToLocal(&contents)) {
+    args.GetReturnValue().Set(contents);
+  }
+}
+
+// The mapping outlives every Buffer that refers to it, so there is nothing to
+// release when such a Buffer is collected.
+static void NoopFree(char* data, void* hint) {}
+
+static void NewBuffer(const FunctionCallbackInfo<Value>& args,
+                      const char* data,
+                      size_t length) {
+  Local<Object> buffer;
+  if (Buffer::New(args.GetIsolate(), const_cast<char*>(data), length,
+                  NoopFree, nullptr).ToLocal(&buffer)) {
+    args.GetReturnValue().Set(buffer);
+  }
+}
+
+// readCodeCache(path) returns a Buffer that refers to the code cache stored
+// for the file without copying it, or undefined if there is none or it was
+// created by a V8 with a different version or configuration. The mapping is
+// read-only, so the Buffer is only ever handed to V8 as `cachedData` and must
+// not be exposed to user code.
+static void ReadCodeCache(const FunctionCallbackInfo<Value>& args) {
+  Environment* env = Environment::GetCurrent(args);
+  const AppArchive::Entry* entry = FindEntry(args);
+  if (entry != nullptr &&
+      entry->cache != nullptr &&
+      env->app_archive->version_tag() ==
+          v8::ScriptCompiler::CachedDataVersionTag()) {
+    NewBuffer(args, entry->cache, entry->cache_length);
+  }
+}
+
+static void Initialize(Local<Object> target,
+                       Local<Value> unused,
+                       Local<Context> context) {
+  Environment* env = Environment::GetCurrent(context);
+  env->SetMethod(target, "mount", Mount);
+  env->SetMethod(target, "readFileUtf8", ReadFileUtf8);
+  env->SetMethod(target, "readCodeCache", ReadCodeCache);
+}
+
+}  // namespace app_archive
+}  // namespace node
+
+NODE_MODULE_CONTEXT_AWARE_INTERNAL(app_archive,
+                                   node::app_archive::Initialize)
@@ -0,0 +1,81 @@
+#ifndef SRC_NODE_APP_ARCHIVE_H_
+#define SRC_NODE_APP_ARCHIVE_H_
+
+#if defined(NODE_WANT_INTERNALS) && NODE_WANT_INTERNALS
+
+#include <stddef.h>
+#include <stdint.h>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace node {
+namespace app_archive {
+
+// A read-only application archive, memory-mapped from a single file and
+// mounted at the archive's own path: the entry `lib/index.js` of the archive
+// `/srv/app.nar` is visible to the module loaders as
+// `/srv/app.nar/lib/index.js`, and the archive path itself is a directory.
+//
+// Layout, all integers are little endian uint32 values:
+//
+//   "NODEAPP1"
+//   code cache version tag (v8::ScriptCompiler::CachedDataVersionTag())
+//   entry count
+//   for each entry:
+//     path length, path (UTF-8, '/'-separated, relative to the mount point)
+//     source offset, source length, code cache offset, code cache length
+//   data
+//
+// Offsets are relative to the start of the file. Entries without a code cache
+// have a code cache length of 0.
+class AppArchive {
+ public:
+  struct Entry {
+    const char* data;
+    size_t length;
+    const char* cache;
+    size_t cache_length;
+  };
+
+  // Returns nullptr and sets `*err` to a negative libuv error code if the
+  // file cannot be mapped, or to UV_EINVAL if it is not a valid archive.
+  static std::unique_ptr<AppArchive> Open(const std::string& path, int* err);
+  ~AppArchive();
+
+  AppArchive(const AppArchive&) = delete;
+  AppArchive& operator=(const AppArchive&) = delete;
+
+  const std::string& root() const { return root_; }
+  uint32_t version_tag() const { return version_tag_; }
+
+  // Whether `path` is the mount point or lies below it.
+  bool Contains(const std::string& path) const;
+  // Returns 0 for files, 1 for directories and UV_ENOENT otherwise, like the
+  // module loader's internalModuleStat().
+  int Stat(const std::string& path) const;
+  const Entry* Find(const std::string& path) const;
+
+ private:
+  explicit AppArchive(const std::string& root) : root_(root) {}
+  bool Parse();
+  // Returns the path relative to the mount point, or false if `path` is not
+  // inside the archive.
+  bool Relative(const std::string& path, std::string* relative) const;
+
+  const std::string root_;
+  char* base_ = nullptr;
+  size_t size_ = 0;
+  bool mapped_ = false;
+  uint32_t version_tag_ = 0;
+  std::unordered_map<std::string, Entry> files_;
+  std::unordered_set<std::string> directories_;
+};
+
+}  // namespace app_archive
+}  // namespace node
+
+#endif  // defined(NODE_WANT_INTERNALS) && NODE_WANT_INTERNALS
+
+#endif  // SRC_NODE_APP_ARCHIVE_H_
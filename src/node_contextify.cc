@@ -586,6 +586,9 @@ void ContextifyContext::IndexedPropertyDeleterCallback(
 class ContextifyScript : public BaseObject {
  private:
   Persistent<UnboundScript> script_;
+  // The source is retained so that a code cache can be created after the
+  // script has run, see CreateCachedData().
+  Persistent<String> source_;
 
  public:
   static void Init(Environment* env, Local<Object> target) {
@@ -598,6 +601,7 @@ class ContextifyScript : public BaseObject {
     script_tmpl->SetClassName(class_name);
     env->SetProtoMethod(script_tmpl, "runInContext", RunInContext);
     env->SetProtoMethod(script_tmpl, "runInThisContext", RunInThisContext);
+    env->SetProtoMethod(script_tmpl, "createCachedData", CreateCachedData);
 
     target->Set(class_name, script_tmpl->GetFunction());
     env->set_script_context_constructor_template(script_tmpl);
@@ -712,6 +716,7 @@ class ContextifyScript : public BaseObject {
       return;
     }
     contextify_script->script_.Reset(isolate, v8_script.ToLocalChecked());
+    contextify_script->source_.Reset(isolate, code);
 
     if (compile_options == ScriptCompiler::kConsumeCodeCache) {
       args.This()->Set(
@@ -745,6 +750,30 @@ class ContextifyScript : public BaseObject {
   }
 
 
+  static void CreateCachedData(const FunctionCallbackInfo<Value>& args) {
+    Environment* env = Environment::GetCurrent(args);
+    ContextifyScript* wrapped_script;
+    ASSIGN_OR_RETURN_UNWRAP(&wrapped_script, args.Holder());
+    Local<UnboundScript> unbound_script =
+        PersistentToLocal(env->isolate(), wrapped_script->script_);
+    Local<String> source =
+        PersistentToLocal(env->isolate(), wrapped_script->source_);
+    // Unlike `produceCachedData`, this runs after the script has executed and
+    // therefore also includes the functions that were lazily compiled since.
+    std::unique_ptr<ScriptCompiler::CachedData> cached_data(
+        ScriptCompiler::CreateCodeCache(unbound_script, source));
+    if (!cached_data) {
+      args.GetReturnValue().Set(Buffer::New(env, 0).ToLocalChecked());
+    } else {
+      MaybeLocal<Object> buf = Buffer::Copy(
+          env,
+          reinterpret_cast<const char*>(cached_data->data),
+          cached_data->length);
+      args.GetReturnValue().Set(buf.ToLocalChecked());
+    }
+  }
+
+
   static void RunInThisContext(const FunctionCallbackInfo<Value>& args) {
     Environment* env = Environment::GetCurrent(args);
 
@@ -23,6 +23,7 @@ namespace node {
 #define ERRORS_WITH_CODE(V)                                                  \
   V(ERR_BUFFER_OUT_OF_BOUNDS, RangeError)                                    \
   V(ERR_BUFFER_TOO_LARGE, Error)                                             \
+  V(ERR_FS_FILE_TOO_LARGE, RangeError)                                       \
   V(ERR_INDEX_OUT_OF_RANGE, RangeError)                                      \
   V(ERR_INVALID_ARG_VALUE, TypeError)                                        \
   V(ERR_INVALID_ARG_TYPE, TypeError)                                         \
@@ -86,6 +87,14 @@ inline v8::Local<v8::Value> ERR_BUFFER_TOO_LARGE(v8::Isolate *isolate) {
   return ERR_BUFFER_TOO_LARGE(isolate, message);
 }
 
+inline v8::Local<v8::Value> ERR_FS_FILE_TOO_LARGE(v8::Isolate *isolate,
+                                                   int64_t size) {
+  std::ostringstream message;
+  message << "File size (" << size << ") is greater than possible Buffer: ";
+  message << v8::TypedArray::kMaxLength << " bytes";
+  return ERR_FS_FILE_TOO_LARGE(isolate, message.str().c_str());
+}
+
 inline v8::Local<v8::Value> ERR_STRING_TOO_LONG(v8::Isolate *isolate) {
   char message[128];
   snprintf(message, sizeof(message),
@@ -20,10 +20,14 @@
 // USE OR OTHER DEALINGS IN THE SOFTWARE.
 
 #include "aliased_buffer.h"
+#include "node_app_archive.h"
 #include "node_buffer.h"
+#include "node_errors.h"
 #include "node_internals.h"
 #include "node_stat_watcher.h"
 #include "node_file.h"
+#include "node_fs_uring.h"
+#include "node_fs_walk.h"
 #include "tracing/trace_event.h"
 
 #include "req_wrap-inl.h"
@@ -40,15 +44,23 @@
 
 #if defined(__MINGW32__) || defined(_MSC_VER)
 # include <io.h>
+#else
+# include <dirent.h>
+# include <sys/mman.h>
+# include <unistd.h>
 #endif
 
+#include <algorithm>
 #include <memory>
+#include <string>
+#include <vector>
 
 namespace node {
 
 namespace fs {
 
 using v8::Array;
+using v8::Boolean;
 using v8::Context;
 using v8::EscapableHandleScope;
 using v8::Float64Array;
@@ -61,6 +73,7 @@ using v8::Integer;
 using v8::Isolate;
 using v8::Local;
 using v8::MaybeLocal;
+using v8::Null;
 using v8::Number;
 using v8::Object;
 using v8::ObjectTemplate;
@@ -599,6 +612,64 @@ void AfterScanDir(uv_fs_t* req) {
   }
 }
 
+void AfterScanDirWithTypes(uv_fs_t* req) {
+  FSReqBase* req_wrap = static_cast<FSReqBase*>(req->data);
+  FSReqAfterScope after(req_wrap, req);
+
+  if (after.Proceed()) {
+    Environment* env = req_wrap->env();
+    Isolate* isolate = env->isolate();
+    Local<Value> error;
+    int r;
+    Local<Array> names = Array::New(isolate, 0);
+    Local<Array> types = Array::New(isolate, 0);
+    Local<Function> fn = env->push_values_to_array_function();
+    Local<Value> name_argv[NODE_PUSH_VAL_TO_ARRAY_MAX];
+    Local<Value> type_argv[NODE_PUSH_VAL_TO_ARRAY_MAX];
+    size_t idx = 0;
+
+    for (int i = 0; ; i++) {
+      uv_dirent_t ent;
+
+      r = uv_fs_scandir_next(req, &ent);
+      if (r == UV_EOF)
+        break;
+      if (r != 0) {
+        return req_wrap->Reject(
+            UVException(r, nullptr, req_wrap->syscall(),
+                        static_cast<const char*>(req->path)));
+      }
+
+      MaybeLocal<Value> filename =
+          StringBytes::Encode(isolate,
+                              ent.name,
+                              req_wrap->encoding(),
+                              &error);
+      if (filename.IsEmpty())
+        return req_wrap->Reject(error);
+
+      name_argv[idx] = filename.ToLocalChecked();
+      type_argv[idx++] = Integer::New(isolate, ent.type);
+
+      if (idx >= arraysize(name_argv)) {
+        fn->Call(env->context(), names, idx, name_argv).ToLocalChecked();
+        fn->Call(env->context(), types, idx, type_argv).ToLocalChecked();
+        idx = 0;
+      }
+    }
+
+    if (idx > 0) {
+      fn->Call(env->context(), names, idx, name_argv).ToLocalChecked();
+      fn->Call(env->context(), types, idx, type_argv).ToLocalChecked();
+    }
+
+    Local<Array> result = Array::New(isolate, 2);
+    result->Set(env->context(), 0, names).FromJust();
+    result->Set(env->context(), 1, types).FromJust();
+    req_wrap->Resolve(result);
+  }
+}
+
 
 // This class is only used on sync fs calls.
 // For async calls FSReqWrap is used.
@@ -718,7 +789,7 @@ void Close(const FunctionCallbackInfo<Value>& args) {
   FSReqBase* req_wrap_async = GetReqWrap(env, args[1]);
   if (req_wrap_async != nullptr) {  // close(fd, req)
     AsyncCall(env, req_wrap_async, args, "close", UTF8, AfterNoArgs,
-              uv_fs_close, fd);
+              uring::Close, fd);
   } else {  // close(fd, undefined, ctx)
     CHECK_EQ(argc, 3);
     FSReqWrapSync req_wrap_sync;
@@ -729,25 +800,36 @@ void Close(const FunctionCallbackInfo<Value>& args) {
 }
 
 
-// Used to speed up module loading.  Returns the contents of the file as
-// a string or undefined when the file cannot be opened or "main" is not found
-// in the file.
-static void InternalModuleReadJSON(const FunctionCallbackInfo<Value>& args) {
-  Environment* env = Environment::GetCurrent(args);
-  uv_loop_t* loop = env->event_loop();
-
-  CHECK(args[0]->IsString());
-  node::Utf8Value path(env->isolate(), args[0]);
-
-  if (strlen(*path) != path.length())
-    return;  // Contains a nul byte.
+// Reads a package.json file for the module loader, from the mounted
+// application archive if it contains the path. Returns false when the file
+// cannot be opened or read. On success, `start` and `size` describe the
+// contents in `chars` without a leading UTF-8 BOM.
+static bool ReadModuleJSON(Environment* env,
+                           const char* path,
+                           std::vector<char>* chars,
+                           size_t* start,
+                           size_t* size) {
+  if (env->app_archive && env->app_archive->Contains(path)) {
+    const app_archive::AppArchive::Entry* entry =
+        env->app_archive->Find(path);
+    if (entry == nullptr)
+      return false;
+    chars->assign(entry->data, entry->data + entry->length);
+    *start = 0;
+    if (chars->size() >= 3 && 0 == memcmp(&(*chars)[0], "\xEF\xBB\xBF", 3)) {
+      *start = 3;  // Skip UTF-8 BOM.
+    }
+    *size = chars->size() - *start;
+    return true;
+  }
 
+  uv_loop_t* loop = env->event_loop();
   uv_fs_t open_req;
-  const int fd = uv_fs_open(loop, &open_req, *path, O_RDONLY, 0, nullptr);
+  const int fd = uv_fs_open(loop, &open_req, path, O_RDONLY, 0, nullptr);
   uv_fs_req_cleanup(&open_req);
 
   if (fd < 0) {
-    return;
+    return false;
   }
 
   std::shared_ptr<void> defer_close(nullptr, [fd, loop] (...) {
@@ -757,15 +839,14 @@ static void InternalModuleReadJSON(const FunctionCallbackInfo<Value>& args) {
   });
 
   const size_t kBlockSize = 32 << 10;
-  std::vector<char> chars;
   int64_t offset = 0;
   ssize_t numchars;
   do {
-    const size_t start = chars.size();
-    chars.resize(start + kBlockSize);
+    const size_t start = chars->size();
+    chars->resize(start + kBlockSize);
 
     uv_buf_t buf;
-    buf.base = &chars[start];
+    buf.base = &(*chars)[start];
     buf.len = kBlockSize;
 
     uv_fs_t read_req;
@@ -773,17 +854,37 @@ static void InternalModuleReadJSON(const FunctionCallbackInfo<Value>& args) {
     uv_fs_req_cleanup(&read_req);
 
     if (numchars < 0)
-      return;
+      return false;
 
     offset += numchars;
   } while (static_cast<size_t>(numchars) == kBlockSize);
 
-  size_t start = 0;
-  if (offset >= 3 && 0 == memcmp(&chars[0], "\xEF\xBB\xBF", 3)) {
-    start = 3;  // Skip UTF-8 BOM.
+  *start = 0;
+  if (offset >= 3 && 0 == memcmp(&(*chars)[0], "\xEF\xBB\xBF", 3)) {
+    *start = 3;  // Skip UTF-8 BOM.
   }
+  *size = offset - *start;
+  return true;
+}
+
+// Used to speed up module loading.  Returns the contents of the file as
+// a string or undefined when the file cannot be opened or "main" is not found
+// in the file.
+static void InternalModuleReadJSON(const FunctionCallbackInfo<Value>& args) {
+  Environment* env = Environment::GetCurrent(args);
+
+  CHECK(args[0]->IsString());
+  node::Utf8Value path(env->isolate(), args[0]);
+
+  if (strlen(*path) != path.length())
+    return;  // Contains a nul byte.
+
+  std::vector<char> chars;
+  size_t start;
+  size_t size;
+  if (!ReadModuleJSON(env, *path, &chars, &start, &size))
+    return;
 
-  const size_t size = offset - start;
   if (size == 0 || size == SearchString(&chars[start], size, "\"main\"")) {
     return;
   } else {
@@ -796,6 +897,32 @@ static void InternalModuleReadJSON(const FunctionCallbackInfo<Value>& args) {
   }
 }
 
+// Returns 0 if the path refers to a file, 1 when it's a directory or < 0 on
+// error (usually -ENOENT.) Results are cached while the module loader has
+// enabled the stat cache, see InternalModuleStatCache().
+static int ModuleStat(Environment* env, const std::string& path) {
+  if (env->app_archive && env->app_archive->Contains(path))
+    return env->app_archive->Stat(path);
+
+  if (env->module_stat_cache_enabled) {
+    auto it = env->module_stat_cache.find(path);
+    if (it != env->module_stat_cache.end())
+      return it->second;
+  }
+
+  uv_fs_t req;
+  int rc = uv_fs_stat(env->event_loop(), &req, path.c_str(), nullptr);
+  if (rc == 0) {
+    const uv_stat_t* const s = static_cast<const uv_stat_t*>(req.ptr);
+    rc = !!(s->st_mode & S_IFDIR);
+  }
+  uv_fs_req_cleanup(&req);
+
+  if (env->module_stat_cache_enabled)
+    env->module_stat_cache.emplace(path, rc);
+  return rc;
+}
+
 // Used to speed up module loading.  Returns 0 if the path refers to
 // a file, 1 when it's a directory or < 0 on error (usually -ENOENT.)
 // The speedup comes from not creating thousands of Stat and Error objects.
@@ -805,15 +932,248 @@ static void InternalModuleStat(const FunctionCallbackInfo<Value>& args) {
   CHECK(args[0]->IsString());
   node::Utf8Value path(env->isolate(), args[0]);
 
-  uv_fs_t req;
-  int rc = uv_fs_stat(env->event_loop(), &req, *path, nullptr);
-  if (rc == 0) {
-    const uv_stat_t* const s = static_cast<const uv_stat_t*>(req.ptr);
-    rc = !!(s->st_mode & S_IFDIR);
+  args.GetReturnValue().Set(
+      ModuleStat(env, std::string(*path, path.length())));
+}
+
+// The module loader enables the stat cache for the duration of a top-level
+// require() call. Disabling it discards all cached results.
+static void InternalModuleStatCache(const FunctionCallbackInfo<Value>& args) {
+  Environment* env = Environment::GetCurrent(args);
+  CHECK(args[0]->IsBoolean());
+  env->module_stat_cache.clear();
+  env->module_stat_cache_enabled = args[0]->IsTrue();
+}
+
+// Resolves `path` against the absolute directory `base`, the way
+// path.posix.resolve(base, path) does.
+static std::string ResolveModulePath(const std::string& base,
+                                     const std::string& path) {
+  const std::string joined =
+      !path.empty() && path[0] == '/' ? path : base + "/" + path;
+  std::vector<std::string> segments;
+  size_t pos = 0;
+  while (pos <= joined.size()) {
+    size_t next = joined.find('/', pos);
+    if (next == std::string::npos)
+      next = joined.size();
+    const std::string segment = joined.substr(pos, next - pos);
+    if (segment == "..") {
+      if (!segments.empty())
+        segments.pop_back();
+    } else if (!segment.empty() && segment != ".") {
+      segments.push_back(segment);
+    }
+    pos = next + 1;
+  }
+  if (segments.empty())
+    return "/";
+  std::string result;
+  for (const std::string& segment : segments)
+    result += "/" + segment;
+  return result;
+}
+
+class ModulePathFinder {
+ public:
+  enum Result { kNotFound, kFound, kBailout };
+
+  ModulePathFinder(Environment* env,
+                   const std::vector<std::string>& extensions)
+      : env_(env), extensions_(extensions) {}
+
+  // Mirrors the lookup of Module._findPath() for a single search path.
+  // `exact` is set when `basePath` itself was found, which the loader needs
+  // to tell apart because of --preserve-symlinks-main.
+  Result Find(const std::string& base_path, bool trailing_slash, bool* exact) {
+    const int rc = ModuleStat(env_, base_path);
+    *exact = false;
+    if (!trailing_slash) {
+      if (rc == 0) {
+        found_ = base_path;
+        *exact = true;
+        return kFound;
+      }
+      if (TryExtensions(base_path))
+        return kFound;
+    }
+    if (rc == 1) {
+      Result result = TryPackage(base_path);
+      if (result != kNotFound)
+        return result;
+      if (TryExtensions(ResolveModulePath(base_path, "index")))
+        return kFound;
+    }
+    return kNotFound;
+  }
+
+  const std::string& found() const { return found_; }
+
+ private:
+  bool TryFile(const std::string& path) {
+    if (ModuleStat(env_, path) != 0)
+      return false;
+    found_ = path;
+    return true;
+  }
+
+  bool TryExtensions(const std::string& path) {
+    for (const std::string& extension : extensions_) {
+      if (TryFile(path + extension))
+        return true;
+    }
+    return false;
+  }
+
+  Result TryPackage(const std::string& path) {
+    std::string main;
+    if (!ReadPackageMain(path, &main))
+      return kBailout;
+    if (main.empty())
+      return kNotFound;
+    const std::string filename = ResolveModulePath(path, main);
+    if (TryFile(filename) ||
+        TryExtensions(filename) ||
+        TryExtensions(ResolveModulePath(filename, "index"))) {
+      return kFound;
+    }
+    return kNotFound;
+  }
+
+  // Same semantics as readPackage() in the CommonJS loader, which only caches
+  // packages that do have a "main" field. Returns false if the JSON cannot be
+  // parsed or "main" is not a string, so that JS reports the error.
+  bool ReadPackageMain(const std::string& path, std::string* main) {
+    auto it = env_->module_package_main_cache.find(path);
+    if (it != env_->module_package_main_cache.end()) {
+      *main = it->second;
+      return true;
+    }
+
+    const std::string json_path = ResolveModulePath(path, "package.json");
+    std::vector<char> chars;
+    size_t start;
+    size_t size;
+    if (!ReadModuleJSON(env_, json_path.c_str(), &chars, &start, &size) ||
+        size == 0 ||
+        size == SearchString(&chars[start], size, "\"main\"")) {
+      return true;
+    }
+
+    Isolate* isolate = env_->isolate();
+    HandleScope handle_scope(isolate);
+    v8::TryCatch try_catch(isolate);
+    Local<String> source;
+    Local<Value> json;
+    Local<Value> main_value;
+    if (!String::NewFromUtf8(isolate, &chars[start],
+                             v8::NewStringType::kNormal, size)
+             .ToLocal(&source) ||
+        !v8::JSON::Parse(env_->context(), source).ToLocal(&json)) {
+      return false;
+    }
+    if (!json->IsObject()) {
+      // JSON.parse(json).main is undefined for primitives and null throws.
+      return !json->IsNull();
+    }
+    if (!json.As<Object>()->Get(env_->context(), env_->main_string())
+             .ToLocal(&main_value)) {
+      return false;
+    }
+    if (!main_value->IsString())
+      return !main_value->BooleanValue(env_->context()).FromMaybe(true);
+
+    node::Utf8Value main_utf8(isolate, main_value);
+    main->assign(*main_utf8, main_utf8.length());
+    if (!main->empty())
+      env_->module_package_main_cache.emplace(path, *main);
+    return true;
   }
-  uv_fs_req_cleanup(&req);
 
-  args.GetReturnValue().Set(rc);
+  Environment* env_;
+  const std::vector<std::string>& extensions_;
+  std::string found_;
+};
+
+// Used to speed up module loading. Performs the file system lookup of
+// Module._findPath() for all search paths in a single call, i.e. trying
+// extensions, the package.json "main" field and index files.
+//
+// internalModuleFindPath(request, paths, extensions, trailingSlash)
+// Returns [filename, index into paths, exact] for the first match, undefined
+// when there is none, or null when JS has to perform the lookup itself
+// because an error needs to be reported, e.g. for an invalid package.json.
+// POSIX only.
+static void InternalModuleFindPath(const FunctionCallbackInfo<Value>& args) {
+  Environment* env = Environment::GetCurrent(args);
+  Isolate* isolate = env->isolate();
+
+  CHECK(args[0]->IsString());
+  CHECK(args[1]->IsArray());
+  CHECK(args[2]->IsArray());
+  CHECK(args[3]->IsBoolean());
+
+  node::Utf8Value request_utf8(isolate, args[0]);
+  const std::string request(*request_utf8, request_utf8.length());
+  Local<Array> paths = args[1].As<Array>();
+  Local<Array> extensions_array = args[2].As<Array>();
+  const bool trailing_slash = args[3]->IsTrue();
+
+  std::vector<std::string> extensions;
+  for (uint32_t i = 0; i < extensions_array->Length(); i++) {
+    node::Utf8Value extension(
+        isolate, extensions_array->Get(env->context(), i).ToLocalChecked());
+    extensions.emplace_back(*extension, extension.length());
+  }
+
+  std::string cwd;
+  ModulePathFinder finder(env, extensions);
+  for (uint32_t i = 0; i < paths->Length(); i++) {
+    Local<Value> path_value = paths->Get(env->context(), i).ToLocalChecked();
+    if (!path_value->IsString())
+      return args.GetReturnValue().SetNull();
+    node::Utf8Value path_utf8(isolate, path_value);
+    std::string path(*path_utf8, path_utf8.length());
+
+    // Don't search further if path doesn't exist.
+    if (!path.empty() && ModuleStat(env, path) < 1)
+      continue;
+
+    if (path.empty() || path[0] != '/') {
+      if (cwd.empty()) {
+        char buf[PATH_MAX];
+        size_t cwd_len = sizeof(buf);
+        if (uv_cwd(buf, &cwd_len) != 0)
+          return args.GetReturnValue().SetNull();
+        cwd.assign(buf, cwd_len);
+      }
+      path = ResolveModulePath(cwd, path);
+    }
+
+    bool exact;
+    switch (finder.Find(ResolveModulePath(path, request),
+                        trailing_slash,
+                        &exact)) {
+      case ModulePathFinder::kNotFound:
+        continue;
+      case ModulePathFinder::kBailout:
+        return args.GetReturnValue().SetNull();
+      case ModulePathFinder::kFound: {
+        Local<Array> result = Array::New(isolate, 3);
+        result->Set(env->context(), 0,
+                    String::NewFromUtf8(isolate,
+                                        finder.found().c_str(),
+                                        v8::NewStringType::kNormal,
+                                        finder.found().size())
+                        .ToLocalChecked()).FromJust();
+        result->Set(env->context(), 1,
+                    Integer::NewFromUnsigned(isolate, i)).FromJust();
+        result->Set(env->context(), 2,
+                    v8::Boolean::New(isolate, exact)).FromJust();
+        return args.GetReturnValue().Set(result);
+      }
+    }
+  }
 }
 
 static void Stat(const FunctionCallbackInfo<Value>& args) {
@@ -828,7 +1188,7 @@ static void Stat(const FunctionCallbackInfo<Value>& args) {
   FSReqBase* req_wrap_async = GetReqWrap(env, args[1]);
   if (req_wrap_async != nullptr) {  // stat(path, req)
     AsyncCall(env, req_wrap_async, args, "stat", UTF8, AfterStat,
-              uv_fs_stat, *path);
+              uring::Stat, *path);
   } else {  // stat(path, undefined, ctx)
     CHECK_EQ(argc, 3);
     FSReqWrapSync req_wrap_sync;
@@ -857,7 +1217,7 @@ static void LStat(const FunctionCallbackInfo<Value>& args) {
   FSReqBase* req_wrap_async = GetReqWrap(env, args[1]);
   if (req_wrap_async != nullptr) {  // lstat(path, req)
     AsyncCall(env, req_wrap_async, args, "lstat", UTF8, AfterStat,
-              uv_fs_lstat, *path);
+              uring::LStat, *path);
   } else {  // lstat(path, undefined, ctx)
     CHECK_EQ(argc, 3);
     FSReqWrapSync req_wrap_sync;
@@ -887,7 +1247,7 @@ static void FStat(const FunctionCallbackInfo<Value>& args) {
   FSReqBase* req_wrap_async = GetReqWrap(env, args[1]);
   if (req_wrap_async != nullptr) {  // fstat(fd, req)
     AsyncCall(env, req_wrap_async, args, "fstat", UTF8, AfterStat,
-              uv_fs_fstat, fd);
+              uring::FStat, fd);
   } else {  // fstat(fd, undefined, ctx)
     CHECK_EQ(argc, 3);
     FSReqWrapSync req_wrap_sync;
@@ -1064,7 +1424,7 @@ static void Fdatasync(const FunctionCallbackInfo<Value>& args) {
   FSReqBase* req_wrap_async = GetReqWrap(env, args[1]);
   if (req_wrap_async != nullptr) {
     AsyncCall(env, req_wrap_async, args, "fdatasync", UTF8, AfterNoArgs,
-              uv_fs_fdatasync, fd);
+              uring::Fdatasync, fd);
   } else {
     CHECK_EQ(argc, 3);
     FSReqWrapSync req_wrap_sync;
@@ -1086,7 +1446,7 @@ static void Fsync(const FunctionCallbackInfo<Value>& args) {
   FSReqBase* req_wrap_async = GetReqWrap(env, args[1]);
   if (req_wrap_async != nullptr) {
     AsyncCall(env, req_wrap_async, args, "fsync", UTF8, AfterNoArgs,
-              uv_fs_fsync, fd);
+              uring::Fsync, fd);
   } else {
     CHECK_EQ(argc, 3);
     FSReqWrapSync req_wrap_sync;
@@ -1212,24 +1572,32 @@ static void RealPath(const FunctionCallbackInfo<Value>& args) {
 
 static void ReadDir(const FunctionCallbackInfo<Value>& args) {
   Environment* env = Environment::GetCurrent(args);
+  Isolate* isolate = env->isolate();
 
   const int argc = args.Length();
-  CHECK_GE(argc, 3);
+  CHECK_GE(argc, 4);
 
-  BufferValue path(env->isolate(), args[0]);
+  BufferValue path(isolate, args[0]);
   CHECK_NOT_NULL(*path);
 
-  const enum encoding encoding = ParseEncoding(env->isolate(), args[1], UTF8);
+  const enum encoding encoding = ParseEncoding(isolate, args[1], UTF8);
 
-  FSReqBase* req_wrap_async = GetReqWrap(env, args[2]);
-  if (req_wrap_async != nullptr) {  // readdir(path, encoding, req)
-    AsyncCall(env, req_wrap_async, args, "scandir", encoding, AfterScanDir,
-              uv_fs_scandir, *path, 0 /*flags*/);
-  } else {  // readdir(path, encoding, undefined, ctx)
-    CHECK_EQ(argc, 4);
+  bool with_types = args[2]->IsTrue();
+
+  FSReqBase* req_wrap_async = GetReqWrap(env, args[3]);
+  if (req_wrap_async != nullptr) {  // readdir(path, encoding, withTypes, req)
+    if (with_types) {
+      AsyncCall(env, req_wrap_async, args, "scandir", encoding,
+                AfterScanDirWithTypes, uv_fs_scandir, *path, 0 /*flags*/);
+    } else {
+      AsyncCall(env, req_wrap_async, args, "scandir", encoding,
+                AfterScanDir, uv_fs_scandir, *path, 0 /*flags*/);
+    }
+  } else {  // readdir(path, encoding, withTypes, undefined, ctx)
+    CHECK_EQ(argc, 5);
     FSReqWrapSync req_wrap_sync;
     FS_SYNC_TRACE_BEGIN(readdir);
-    int err = SyncCall(env, args[3], &req_wrap_sync, "scandir",
+    int err = SyncCall(env, args[4], &req_wrap_sync, "scandir",
                        uv_fs_scandir, *path, 0 /*flags*/);
     FS_SYNC_TRACE_END(readdir);
     if (err < 0) {
@@ -1238,9 +1606,11 @@ static void ReadDir(const FunctionCallbackInfo<Value>& args) {
 
     CHECK_GE(req_wrap_sync.req.result, 0);
     int r;
-    Local<Array> names = Array::New(env->isolate(), 0);
+    Local<Array> names = Array::New(isolate, 0);
+    Local<Array> types = Array::New(isolate, 0);
     Local<Function> fn = env->push_values_to_array_function();
     Local<Value> name_v[NODE_PUSH_VAL_TO_ARRAY_MAX];
+    Local<Value> type_v[NODE_PUSH_VAL_TO_ARRAY_MAX];
     size_t name_idx = 0;
 
     for (int i = 0; ; i++) {
@@ -1250,25 +1620,27 @@ static void ReadDir(const FunctionCallbackInfo<Value>& args) {
       if (r == UV_EOF)
         break;
       if (r != 0) {
-        Local<Object> ctx = args[3].As<Object>();
+        Local<Object> ctx = args[4].As<Object>();
         ctx->Set(env->context(), env->errno_string(),
-                 Integer::New(env->isolate(), r)).FromJust();
+                 Integer::New(isolate, r)).FromJust();
         ctx->Set(env->context(), env->syscall_string(),
-                 OneByteString(env->isolate(), "readdir")).FromJust();
+                 OneByteString(isolate, "readdir")).FromJust();
         return;
       }
 
       Local<Value> error;
-      MaybeLocal<Value> filename = StringBytes::Encode(env->isolate(),
+      MaybeLocal<Value> filename = StringBytes::Encode(isolate,
                                                        ent.name,
                                                        encoding,
                                                        &error);
       if (filename.IsEmpty()) {
-        Local<Object> ctx = args[3].As<Object>();
+        Local<Object> ctx = args[4].As<Object>();
         ctx->Set(env->context(), env->error_string(), error).FromJust();
         return;
       }
 
+      if (with_types)
+        type_v[name_idx] = Integer::New(isolate, ent.type);
       name_v[name_idx++] = filename.ToLocalChecked();
 
       if (name_idx >= arraysize(name_v)) {
@@ -1277,6 +1649,10 @@ static void ReadDir(const FunctionCallbackInfo<Value>& args) {
         if (ret.IsEmpty()) {
           return;
         }
+        if (with_types &&
+            fn->Call(env->context(), types, name_idx, type_v).IsEmpty()) {
+          return;
+        }
         name_idx = 0;
       }
     }
@@ -1286,9 +1662,359 @@ static void ReadDir(const FunctionCallbackInfo<Value>& args) {
       if (ret.IsEmpty()) {
         return;
       }
+      if (with_types &&
+          fn->Call(env->context(), types, name_idx, type_v).IsEmpty()) {
+        return;
+      }
+    }
+
+    if (with_types) {
+      Local<Array> result = Array::New(isolate, 2);
+      result->Set(env->context(), 0, names).FromJust();
+      result->Set(env->context(), 1, types).FromJust();
+      args.GetReturnValue().Set(result);
+    } else {
+      args.GetReturnValue().Set(names);
+    }
+  }
+}
+
+// Directory streams for fs.opendir(). Every read() returns a bounded number of
+// entries, so that directories of any size can be iterated with bounded
+// memory. libuv 1.20 has no directory stream API, so POSIX systems use
+// opendir(3) directly, while Windows scans the whole directory when it is
+// opened and hands out the entries from there.
+struct DirEntry {
+  std::string name;
+  int type;
+};
+
+#ifdef _WIN32
+typedef uv_fs_t* DirStream;
+
+static int OpenDirStream(const char* path, DirStream* stream) {
+  uv_fs_t* req = new uv_fs_t;
+  int err = uv_fs_scandir(nullptr, req, path, 0, nullptr);
+  if (err < 0) {
+    uv_fs_req_cleanup(req);
+    delete req;
+    return err;
+  }
+  *stream = req;
+  return 0;
+}
+
+static int ReadDirStream(DirStream stream,
+                         size_t count,
+                         std::vector<DirEntry>* entries) {
+  while (entries->size() < count) {
+    uv_dirent_t ent;
+    int err = uv_fs_scandir_next(stream, &ent);
+    if (err == UV_EOF)
+      break;
+    if (err < 0)
+      return err;
+    entries->push_back(DirEntry { ent.name, ent.type });
+  }
+  return 0;
+}
+
+static int CloseDirStream(DirStream stream) {
+  uv_fs_req_cleanup(stream);
+  delete stream;
+  return 0;
+}
+#else
+typedef DIR* DirStream;
+
+static int OpenDirStream(const char* path, DirStream* stream) {
+  DIR* dir = opendir(path);
+  if (dir == nullptr)
+    return uv_translate_sys_error(errno);
+  *stream = dir;
+  return 0;
+}
+
+static int DirentType(const struct dirent* ent) {
+#ifdef DT_UNKNOWN
+  switch (ent->d_type) {
+    case DT_REG: return UV_DIRENT_FILE;
+    case DT_DIR: return UV_DIRENT_DIR;
+    case DT_LNK: return UV_DIRENT_LINK;
+    case DT_FIFO: return UV_DIRENT_FIFO;
+    case DT_SOCK: return UV_DIRENT_SOCKET;
+    case DT_CHR: return UV_DIRENT_CHAR;
+    case DT_BLK: return UV_DIRENT_BLOCK;
+  }
+#endif
+  return UV_DIRENT_UNKNOWN;
+}
+
+static int ReadDirStream(DirStream stream,
+                         size_t count,
+                         std::vector<DirEntry>* entries) {
+  while (entries->size() < count) {
+    errno = 0;
+    struct dirent* ent = readdir(stream);
+    if (ent == nullptr)
+      return errno == 0 ? 0 : uv_translate_sys_error(errno);
+    if (strcmp(ent->d_name, ".") == 0 || strcmp(ent->d_name, "..") == 0)
+      continue;
+    entries->push_back(DirEntry { ent->d_name, DirentType(ent) });
+  }
+  return 0;
+}
+
+static int CloseDirStream(DirStream stream) {
+  return closedir(stream) == 0 ? 0 : uv_translate_sys_error(errno);
+}
+#endif
+
+// Returns the entries as a flat [name, type, name, type, ...] array, or null
+// once the end of the directory has been reached.
+static MaybeLocal<Value> DirEntriesToArray(Environment* env,
+                                           const std::vector<DirEntry>& entries,
+                                           enum encoding encoding,
+                                           Local<Value>* error) {
+  Isolate* isolate = env->isolate();
+  if (entries.empty())
+    return Null(isolate);
+
+  Local<Array> result = Array::New(isolate, entries.size() * 2);
+  for (size_t i = 0; i < entries.size(); i++) {
+    Local<Value> name;
+    if (!StringBytes::Encode(isolate,
+                             entries[i].name.data(),
+                             entries[i].name.size(),
+                             encoding,
+                             error).ToLocal(&name)) {
+      return MaybeLocal<Value>();
+    }
+    result->Set(env->context(), i * 2, name).FromJust();
+    result->Set(env->context(), i * 2 + 1,
+                Integer::New(isolate, entries[i].type)).FromJust();
+  }
+  return result;
+}
+
+static void SetSyncError(Environment* env,
+                         Local<Value> ctx,
+                         int err,
+                         const char* syscall) {
+  ctx.As<Object>()->Set(env->context(), env->errno_string(),
+                        Integer::New(env->isolate(), err)).FromJust();
+  ctx.As<Object>()->Set(env->context(), env->syscall_string(),
+                        OneByteString(env->isolate(), syscall)).FromJust();
+}
+
+class DirHandle : public AsyncWrap {
+ public:
+  DirHandle(Environment* env, DirStream stream)
+      : AsyncWrap(env,
+                  env->dir_instance_template()
+                      ->NewInstance(env->context()).ToLocalChecked(),
+                  AsyncWrap::PROVIDER_DIRHANDLE),
+        stream_(stream) {
+    MakeWeak();
+  }
+
+  // Collected without close(), release the stream synchronously. Pending
+  // operations keep the handle alive, see DirWork.
+  ~DirHandle() override {
+    if (stream_ != nullptr)
+      CloseDirStream(stream_);
+  }
+
+  // read(encoding, count, req) or read(encoding, count, undefined, ctx)
+  static void Read(const FunctionCallbackInfo<Value>& args);
+  // close(req) or close(undefined, ctx)
+  static void Close(const FunctionCallbackInfo<Value>& args);
+
+  size_t self_size() const override { return sizeof(*this); }
+
+ private:
+  DirStream stream_;
+
+  friend class DirWork;
+};
+
+// Runs a directory stream operation on the thread pool and settles `req_wrap`
+// with its result.
+class DirWork : public ThreadPoolWork {
+ public:
+  enum Op { kOpen, kRead, kClose };
+
+  DirWork(FSReqBase* req_wrap, Op op, DirHandle* handle, DirStream stream,
+          size_t count = 0)
+      : ThreadPoolWork(req_wrap->env()),
+        req_wrap_(req_wrap),
+        op_(op),
+        handle_(handle),
+        stream_(stream),
+        count_(count) {
+    if (handle_ != nullptr)
+      handle_->ClearWeak();
+  }
+
+  void DoThreadPoolWork() override {
+    switch (op_) {
+      case kOpen:
+        result_ = OpenDirStream(req_wrap_->data(), &stream_);
+        break;
+      case kRead:
+        result_ = ReadDirStream(stream_, count_, &entries_);
+        break;
+      case kClose:
+        result_ = CloseDirStream(stream_);
+        break;
+    }
+  }
+
+  void AfterThreadPoolWork(int status) override {
+    std::unique_ptr<DirWork> self(this);
+    std::unique_ptr<FSReqBase> req_wrap(req_wrap_);
+    Environment* env = req_wrap->env();
+    HandleScope handle_scope(env->isolate());
+    Context::Scope context_scope(env->context());
+
+    if (handle_ != nullptr)
+      handle_->MakeWeak();
+    if (status != 0)
+      result_ = status;
+    if (result_ < 0) {
+      return req_wrap->Reject(UVException(env->isolate(),
+                                          result_,
+                                          req_wrap->syscall(),
+                                          nullptr,
+                                          req_wrap->data(),
+                                          nullptr));
+    }
+
+    switch (op_) {
+      case kOpen:
+        req_wrap->Resolve((new DirHandle(env, stream_))->object());
+        break;
+      case kRead: {
+        Local<Value> error;
+        Local<Value> result;
+        if (DirEntriesToArray(env, entries_, req_wrap->encoding(), &error)
+                .ToLocal(&result)) {
+          req_wrap->Resolve(result);
+        } else {
+          req_wrap->Reject(error);
+        }
+        break;
+      }
+      case kClose:
+        req_wrap->Resolve(Undefined(env->isolate()));
+        break;
+    }
+  }
+
+ private:
+  FSReqBase* req_wrap_;
+  const Op op_;
+  DirHandle* handle_;
+  DirStream stream_;
+  const size_t count_;
+  int result_ = 0;
+  std::vector<DirEntry> entries_;
+};
+
+void DirHandle::Read(const FunctionCallbackInfo<Value>& args) {
+  Environment* env = Environment::GetCurrent(args);
+
+  const int argc = args.Length();
+  CHECK_GE(argc, 3);
+
+  DirHandle* dir;
+  ASSIGN_OR_RETURN_UNWRAP(&dir, args.Holder());
+  CHECK_NOT_NULL(dir->stream_);
+
+  const enum encoding encoding = ParseEncoding(env->isolate(), args[0], UTF8);
+
+  CHECK(args[1]->IsUint32());
+  const size_t count = args[1].As<Uint32>()->Value();
+  CHECK_GT(count, 0);
+
+  FSReqBase* req_wrap_async = GetReqWrap(env, args[2]);
+  if (req_wrap_async != nullptr) {  // read(encoding, count, req)
+    req_wrap_async->Init("readdir", nullptr, 0, encoding);
+    (new DirWork(req_wrap_async, DirWork::kRead, dir, dir->stream_, count))
+        ->ScheduleWork();
+    req_wrap_async->SetReturnValue(args);
+  } else {  // read(encoding, count, undefined, ctx)
+    CHECK_EQ(argc, 4);
+    std::vector<DirEntry> entries;
+    FS_SYNC_TRACE_BEGIN(readdir);
+    int err = ReadDirStream(dir->stream_, count, &entries);
+    FS_SYNC_TRACE_END(readdir);
+    if (err < 0)
+      return SetSyncError(env, args[3], err, "readdir");
+
+    Local<Value> error;
+    Local<Value> result;
+    if (!DirEntriesToArray(env, entries, encoding, &error).ToLocal(&result)) {
+      args[3].As<Object>()->Set(env->context(), env->error_string(),
+                                error).FromJust();
+      return;
     }
+    args.GetReturnValue().Set(result);
+  }
+}
 
-    args.GetReturnValue().Set(names);
+void DirHandle::Close(const FunctionCallbackInfo<Value>& args) {
+  Environment* env = Environment::GetCurrent(args);
+
+  const int argc = args.Length();
+  CHECK_GE(argc, 1);
+
+  DirHandle* dir;
+  ASSIGN_OR_RETURN_UNWRAP(&dir, args.Holder());
+  CHECK_NOT_NULL(dir->stream_);
+  DirStream stream = dir->stream_;
+  dir->stream_ = nullptr;
+
+  FSReqBase* req_wrap_async = GetReqWrap(env, args[0]);
+  if (req_wrap_async != nullptr) {  // close(req)
+    req_wrap_async->Init("closedir", nullptr, 0, UTF8);
+    (new DirWork(req_wrap_async, DirWork::kClose, dir, stream))
+        ->ScheduleWork();
+    req_wrap_async->SetReturnValue(args);
+  } else {  // close(undefined, ctx)
+    CHECK_EQ(argc, 2);
+    FS_SYNC_TRACE_BEGIN(closedir);
+    int err = CloseDirStream(stream);
+    FS_SYNC_TRACE_END(closedir);
+    if (err < 0)
+      SetSyncError(env, args[1], err, "closedir");
+  }
+}
+
+static void OpenDir(const FunctionCallbackInfo<Value>& args) {
+  Environment* env = Environment::GetCurrent(args);
+
+  const int argc = args.Length();
+  CHECK_GE(argc, 2);
+
+  BufferValue path(env->isolate(), args[0]);
+  CHECK_NOT_NULL(*path);
+
+  FSReqBase* req_wrap_async = GetReqWrap(env, args[1]);
+  if (req_wrap_async != nullptr) {  // opendir(path, req)
+    req_wrap_async->Init("opendir", *path, path.length(), UTF8);
+    (new DirWork(req_wrap_async, DirWork::kOpen, nullptr, nullptr))
+        ->ScheduleWork();
+    req_wrap_async->SetReturnValue(args);
+  } else {  // opendir(path, undefined, ctx)
+    CHECK_EQ(argc, 3);
+    DirStream stream;
+    FS_SYNC_TRACE_BEGIN(opendir);
+    int err = OpenDirStream(*path, &stream);
+    FS_SYNC_TRACE_END(opendir);
+    if (err < 0)
+      return SetSyncError(env, args[2], err, "opendir");
+    args.GetReturnValue().Set((new DirHandle(env, stream))->object());
   }
 }
 
@@ -1310,7 +2036,7 @@ static void Open(const FunctionCallbackInfo<Value>& args) {
   FSReqBase* req_wrap_async = GetReqWrap(env, args[3]);
   if (req_wrap_async != nullptr) {  // open(path, flags, mode, req)
     AsyncCall(env, req_wrap_async, args, "open", UTF8, AfterInteger,
-              uv_fs_open, *path, flags, mode);
+              uring::Open, *path, flags, mode);
   } else {  // open(path, flags, mode, undefined, ctx)
     CHECK_EQ(argc, 5);
     FSReqWrapSync req_wrap_sync;
@@ -1340,7 +2066,7 @@ static void OpenFileHandle(const FunctionCallbackInfo<Value>& args) {
   FSReqBase* req_wrap_async = GetReqWrap(env, args[3]);
   if (req_wrap_async != nullptr) {  // openFileHandle(path, flags, mode, req)
     AsyncCall(env, req_wrap_async, args, "open", UTF8, AfterOpenFileHandle,
-              uv_fs_open, *path, flags, mode);
+              uring::Open, *path, flags, mode);
   } else {  // openFileHandle(path, flags, mode, undefined, ctx)
     CHECK_EQ(argc, 5);
     FSReqWrapSync req_wrap_sync;
@@ -1429,7 +2155,7 @@ static void WriteBuffer(const FunctionCallbackInfo<Value>& args) {
   FSReqBase* req_wrap_async = GetReqWrap(env, args[5]);
   if (req_wrap_async != nullptr) {  // write(fd, buffer, off, len, pos, req)
     AsyncCall(env, req_wrap_async, args, "write", UTF8, AfterInteger,
-              uv_fs_write, fd, &uvbuf, 1, pos);
+              uring::Write, fd, &uvbuf, 1, pos);
   } else {  // write(fd, buffer, off, len, pos, undefined, ctx)
     CHECK_EQ(argc, 7);
     FSReqWrapSync req_wrap_sync;
@@ -1474,7 +2200,7 @@ static void WriteBuffers(const FunctionCallbackInfo<Value>& args) {
   FSReqBase* req_wrap_async = GetReqWrap(env, args[3]);
   if (req_wrap_async != nullptr) {  // writeBuffers(fd, chunks, pos, req)
     AsyncCall(env, req_wrap_async, args, "write", UTF8, AfterInteger,
-              uv_fs_write, fd, *iovs, iovs.length(), pos);
+              uring::Write, fd, *iovs, iovs.length(), pos);
   } else {  // writeBuffers(fd, chunks, pos, undefined, ctx)
     CHECK_EQ(argc, 5);
     FSReqWrapSync req_wrap_sync;
@@ -1545,8 +2271,8 @@ static void WriteString(const FunctionCallbackInfo<Value>& args) {
     len = StringBytes::Write(env->isolate(), *stack_buffer, len, args[1], enc);
     stack_buffer.SetLengthAndZeroTerminate(len);
     uv_buf_t uvbuf = uv_buf_init(*stack_buffer, len);
-    int err = uv_fs_write(env->event_loop(), req_wrap_async->req(),
-                          fd, &uvbuf, 1, pos, AfterInteger);
+    int err = uring::Write(env->event_loop(), req_wrap_async->req(),
+                           fd, &uvbuf, 1, pos, AfterInteger);
     req_wrap_async->Dispatched();
     if (err < 0) {
       uv_fs_t* uv_req = req_wrap_async->req();
@@ -1623,7 +2349,7 @@ static void Read(const FunctionCallbackInfo<Value>& args) {
   FSReqBase* req_wrap_async = GetReqWrap(env, args[5]);
   if (req_wrap_async != nullptr) {  // read(fd, buffer, offset, len, pos, req)
     AsyncCall(env, req_wrap_async, args, "read", UTF8, AfterInteger,
-              uv_fs_read, fd, &uvbuf, 1, pos);
+              uring::Read, fd, &uvbuf, 1, pos);
   } else {  // read(fd, buffer, offset, len, pos, undefined, ctx)
     CHECK_EQ(argc, 7);
     FSReqWrapSync req_wrap_sync;
@@ -1636,6 +2362,520 @@ static void Read(const FunctionCallbackInfo<Value>& args) {
 }
 
 
+// Wrapper for readv(2).
+//
+// bytesRead = readv(fd, buffers, position, callback)
+// 0 fd        integer. file descriptor
+// 1 buffers   array of buffers to read into, in order
+// 2 position  if integer, position to read from in the file.
+//             if -1, read from the current position
+static void ReadBuffers(const FunctionCallbackInfo<Value>& args) {
+  Environment* env = Environment::GetCurrent(args);
+
+  const int argc = args.Length();
+  CHECK_GE(argc, 3);
+
+  CHECK(args[0]->IsInt32());
+  const int fd = args[0].As<Int32>()->Value();
+
+  CHECK(args[1]->IsArray());
+  Local<Array> buffers = args[1].As<Array>();
+
+  CHECK(args[2]->IsNumber());
+  const int64_t pos = args[2].As<Integer>()->Value();
+
+  MaybeStackBuffer<uv_buf_t> iovs(buffers->Length());
+
+  for (uint32_t i = 0; i < iovs.length(); i++) {
+    Local<Value> buffer = buffers->Get(i);
+    CHECK(Buffer::HasInstance(buffer));
+    iovs[i] = uv_buf_init(Buffer::Data(buffer), Buffer::Length(buffer));
+  }
+
+  FSReqBase* req_wrap_async = GetReqWrap(env, args[3]);
+  if (req_wrap_async != nullptr) {  // readBuffers(fd, buffers, pos, req)
+    AsyncCall(env, req_wrap_async, args, "read", UTF8, AfterInteger,
+              uring::Read, fd, *iovs, iovs.length(), pos);
+  } else {  // readBuffers(fd, buffers, pos, undefined, ctx)
+    CHECK_EQ(argc, 5);
+    FSReqWrapSync req_wrap_sync;
+    FS_SYNC_TRACE_BEGIN(read);
+    const int bytesRead = SyncCall(env, args[4], &req_wrap_sync, "read",
+                                   uv_fs_read, fd, *iovs, iovs.length(), pos);
+    FS_SYNC_TRACE_END(read, "bytesRead", bytesRead);
+    args.GetReturnValue().Set(bytesRead);
+  }
+}
+
+// Reads a whole file as a single thread pool job: open(), fstat(), as many
+// read()s as it takes to fill a buffer of the file's size, and close(),
+// without a round trip to the loop thread in between.
+class ReadFileWork : public ThreadPoolWork {
+ public:
+  ReadFileWork(FSReqBase* req_wrap,
+               bool is_fd,
+               std::string&& path,
+               uv_file fd,
+               int flags,
+               enum encoding encoding)
+      : ThreadPoolWork(req_wrap->env()),
+        req_wrap_(req_wrap),
+        is_fd_(is_fd),
+        path_(std::move(path)),
+        flags_(flags),
+        encoding_(encoding),
+        fd_(fd) {}
+
+  ~ReadFileWork() {
+    free(data_);
+  }
+
+  void DoThreadPoolWork() override;
+  void AfterThreadPoolWork(int status) override;
+
+ private:
+  // Used for files whose size is not known up front, e.g. pipes and some
+  // files in /proc. Grows by doubling.
+  static const size_t kInitialChunkSize = 64 * 1024;
+
+  void ReadAll();
+
+  FSReqBase* const req_wrap_;
+  // Paths may be empty, so whether `fd_` was passed in is tracked separately.
+  const bool is_fd_;
+  const std::string path_;
+  const int flags_;
+  const enum encoding encoding_;
+  uv_file fd_;
+  const char* syscall_ = nullptr;
+  int err_ = 0;
+  int64_t too_large_size_ = -1;
+  char* data_ = nullptr;
+  size_t length_ = 0;
+};
+
+void ReadFileWork::DoThreadPoolWork() {
+  uv_fs_t req;
+  if (!is_fd_) {
+    fd_ = uv_fs_open(nullptr, &req, path_.c_str(), flags_, 0666, nullptr);
+    uv_fs_req_cleanup(&req);
+    if (fd_ < 0) {
+      err_ = fd_;
+      syscall_ = "open";
+      return;
+    }
+  }
+
+  ReadAll();
+
+  if (!is_fd_) {
+    int err = uv_fs_close(nullptr, &req, fd_, nullptr);
+    uv_fs_req_cleanup(&req);
+    if (err < 0 && err_ == 0 && too_large_size_ < 0) {
+      err_ = err;
+      syscall_ = "close";
+    }
+  }
+}
+
+void ReadFileWork::ReadAll() {
+  uv_fs_t req;
+  int err = uv_fs_fstat(nullptr, &req, fd_, nullptr);
+  const uv_stat_t stat = req.statbuf;
+  uv_fs_req_cleanup(&req);
+  if (err < 0) {
+    err_ = err;
+    syscall_ = "fstat";
+    return;
+  }
+
+  const bool known_size =
+      (stat.st_mode & S_IFMT) == S_IFREG && stat.st_size > 0;
+  if (known_size && stat.st_size > Buffer::kMaxLength) {
+    too_large_size_ = stat.st_size;
+    return;
+  }
+
+  size_t capacity = known_size ? stat.st_size : kInitialChunkSize;
+  data_ = UncheckedMalloc(capacity);
+  if (data_ == nullptr) {
+    err_ = UV_ENOMEM;
+    syscall_ = "read";
+    return;
+  }
+
+  for (;;) {
+    if (length_ == capacity) {
+      if (known_size)
+        break;
+      if (capacity == Buffer::kMaxLength) {
+        too_large_size_ = capacity + 1;
+        return;
+      }
+      const size_t new_capacity =
+          std::min<size_t>(capacity * 2, Buffer::kMaxLength);
+      char* data = UncheckedRealloc(data_, new_capacity);
+      if (data == nullptr) {
+        err_ = UV_ENOMEM;
+        syscall_ = "read";
+        return;
+      }
+      data_ = data;
+      capacity = new_capacity;
+    }
+
+    uv_buf_t buf = uv_buf_init(data_ + length_, capacity - length_);
+    const int bytes_read = uv_fs_read(nullptr, &req, fd_, &buf, 1, -1, nullptr);
+    uv_fs_req_cleanup(&req);
+    if (bytes_read < 0) {
+      err_ = bytes_read;
+      syscall_ = "read";
+      return;
+    }
+    if (bytes_read == 0)
+      break;
+    length_ += bytes_read;
+  }
+
+  // Files can shrink after the fstat(), and chunked reads overshoot.
+  if (length_ == 0) {
+    free(data_);
+    data_ = nullptr;
+  } else if (length_ < capacity) {
+    char* data = UncheckedRealloc(data_, length_);
+    if (data != nullptr)
+      data_ = data;
+  }
+}
+
+void ReadFileWork::AfterThreadPoolWork(int status) {
+  std::unique_ptr<ReadFileWork> self(this);
+  std::unique_ptr<FSReqBase> req_wrap(req_wrap_);
+  Environment* env = req_wrap->env();
+  Isolate* isolate = env->isolate();
+  HandleScope handle_scope(isolate);
+  Context::Scope context_scope(env->context());
+
+  if (status != 0) {
+    req_wrap->Reject(UVException(isolate, status, "read"));
+    return;
+  }
+  if (too_large_size_ >= 0) {
+    req_wrap->Reject(ERR_FS_FILE_TOO_LARGE(isolate, too_large_size_));
+    return;
+  }
+  if (err_ < 0) {
+    const char* path = strcmp(syscall_, "open") == 0 ? path_.c_str() : nullptr;
+    req_wrap->Reject(UVException(isolate, err_, syscall_, nullptr, path));
+    return;
+  }
+
+  Local<Value> error;
+  MaybeLocal<Value> result;
+  if (encoding_ == BUFFER) {
+    Local<Object> buffer;
+    if (Buffer::New(env, data_, length_).ToLocal(&buffer)) {
+      data_ = nullptr;  // The buffer owns the memory now.
+      result = buffer;
+    } else {
+      error = ERR_BUFFER_TOO_LARGE(isolate);
+    }
+  } else {
+    result = StringBytes::Encode(isolate, data_, length_, encoding_, &error);
+  }
+
+  if (result.IsEmpty())
+    req_wrap->Reject(error);
+  else
+    req_wrap->Resolve(result.ToLocalChecked());
+}
+
+/*
+ * readFile(path, flags, encoding, req)
+ * readFile(fd, flags, encoding, req)
+ *
+ * Only does the open() and close() when passed a path.
+ */
+static void ReadFile(const FunctionCallbackInfo<Value>& args) {
+  Environment* env = Environment::GetCurrent(args);
+
+  const int argc = args.Length();
+  CHECK_GE(argc, 4);
+
+  std::string path;
+  uv_file fd = -1;
+  const bool is_fd = args[0]->IsInt32();
+  if (is_fd) {
+    fd = args[0].As<Int32>()->Value();
+  } else {
+    BufferValue value(env->isolate(), args[0]);
+    CHECK_NOT_NULL(*value);
+    path.assign(*value, value.length());
+  }
+
+  CHECK(args[1]->IsInt32());
+  const int flags = args[1].As<Int32>()->Value();
+
+  const enum encoding encoding = ParseEncoding(env->isolate(), args[2], BUFFER);
+
+  FSReqBase* req_wrap = GetReqWrap(env, args[3]);
+  CHECK_NOT_NULL(req_wrap);
+  req_wrap->Init("read", is_fd ? nullptr : path.data(), path.size(),
+                 encoding);
+  ReadFileWork* work =
+      new ReadFileWork(req_wrap, is_fd, std::move(path), fd, flags, encoding);
+  work->ScheduleWork();
+  req_wrap->SetReturnValue(args);
+}
+
+
+// Reads a list of (position, length) ranges of a file as a single thread pool
+// job, with one pread() per range unless it comes up short. The ranges are
+// laid out back to back in a single buffer, and the request is settled with
+// [buffer, bytesRead], where bytesRead[i] is less than the length of range i
+// if it extends past the end of the file.
+class ReadRangesWork : public ThreadPoolWork {
+ public:
+  struct Range {
+    int64_t position;
+    size_t length;
+  };
+
+  ReadRangesWork(FSReqBase* req_wrap,
+                 uv_file fd,
+                 std::vector<Range>&& ranges,
+                 size_t total_length)
+      : ThreadPoolWork(req_wrap->env()),
+        req_wrap_(req_wrap),
+        fd_(fd),
+        ranges_(std::move(ranges)),
+        bytes_read_(ranges_.size()),
+        total_length_(total_length) {}
+
+  ~ReadRangesWork() {
+    free(data_);
+  }
+
+  void DoThreadPoolWork() override;
+  void AfterThreadPoolWork(int status) override;
+
+ private:
+  FSReqBase* const req_wrap_;
+  const uv_file fd_;
+  const std::vector<Range> ranges_;
+  std::vector<size_t> bytes_read_;
+  const size_t total_length_;
+  int err_ = 0;
+  char* data_ = nullptr;
+};
+
+void ReadRangesWork::DoThreadPoolWork() {
+  if (total_length_ > 0) {
+    data_ = UncheckedMalloc(total_length_);
+    if (data_ == nullptr) {
+      err_ = UV_ENOMEM;
+      return;
+    }
+  }
+
+  char* dest = data_;
+  for (size_t i = 0; i < ranges_.size(); i++) {
+    const Range& range = ranges_[i];
+    size_t done = 0;
+    while (done < range.length) {
+      uv_fs_t req;
+      uv_buf_t buf = uv_buf_init(dest + done, range.length - done);
+      const int bytes_read =
+          uv_fs_read(nullptr, &req, fd_, &buf, 1, range.position + done,
+                     nullptr);
+      uv_fs_req_cleanup(&req);
+      if (bytes_read < 0) {
+        err_ = bytes_read;
+        return;
+      }
+      if (bytes_read == 0)
+        break;
+      done += bytes_read;
+    }
+    bytes_read_[i] = done;
+    dest += range.length;
+  }
+}
+
+void ReadRangesWork::AfterThreadPoolWork(int status) {
+  std::unique_ptr<ReadRangesWork> self(this);
+  std::unique_ptr<FSReqBase> req_wrap(req_wrap_);
+  Environment* env = req_wrap->env();
+  Isolate* isolate = env->isolate();
+  HandleScope handle_scope(isolate);
+  Context::Scope context_scope(env->context());
+
+  if (status == 0)
+    status = err_;
+  if (status != 0) {
+    req_wrap->Reject(UVException(isolate, status, "read"));
+    return;
+  }
+
+  Local<Object> buffer;
+  if (!Buffer::New(env, data_, total_length_).ToLocal(&buffer)) {
+    req_wrap->Reject(ERR_BUFFER_TOO_LARGE(isolate));
+    return;
+  }
+  data_ = nullptr;  // The buffer owns the memory now.
+
+  Local<Array> bytes_read = Array::New(isolate, bytes_read_.size());
+  for (size_t i = 0; i < bytes_read_.size(); i++) {
+    bytes_read->Set(env->context(), i,
+                    Integer::NewFromUnsigned(isolate, bytes_read_[i]))
+        .FromJust();
+  }
+
+  Local<Array> result = Array::New(isolate, 2);
+  result->Set(env->context(), 0, buffer).FromJust();
+  result->Set(env->context(), 1, bytes_read).FromJust();
+  req_wrap->Resolve(result);
+}
+
+/*
+ * readRanges(fd, ranges, req)
+ *
+ * 0 fd      int32. file descriptor
+ * 1 ranges  Float64Array of position, length pairs
+ */
+static void ReadRanges(const FunctionCallbackInfo<Value>& args) {
+  Environment* env = Environment::GetCurrent(args);
+
+  const int argc = args.Length();
+  CHECK_GE(argc, 3);
+
+  CHECK(args[0]->IsInt32());
+  const uv_file fd = args[0].As<Int32>()->Value();
+
+  CHECK(args[1]->IsFloat64Array());
+  Local<Float64Array> array = args[1].As<Float64Array>();
+  CHECK_EQ(array->Length() % 2, 0);
+  std::vector<double> values(array->Length());
+  array->CopyContents(values.data(), values.size() * sizeof(values[0]));
+
+  std::vector<ReadRangesWork::Range> ranges(values.size() / 2);
+  size_t total_length = 0;
+  for (size_t i = 0; i < ranges.size(); i++) {
+    ranges[i].position = static_cast<int64_t>(values[2 * i]);
+    ranges[i].length = static_cast<size_t>(values[2 * i + 1]);
+    CHECK_GE(ranges[i].position, 0);
+    total_length += ranges[i].length;
+    CHECK_LE(total_length, Buffer::kMaxLength);
+  }
+
+  FSReqBase* req_wrap = GetReqWrap(env, args[2]);
+  CHECK_NOT_NULL(req_wrap);
+  req_wrap->Init("read", nullptr, 0, UTF8);
+  ReadRangesWork* work =
+      new ReadRangesWork(req_wrap, fd, std::move(ranges), total_length);
+  work->ScheduleWork();
+  req_wrap->SetReturnValue(args);
+}
+
+#ifndef _WIN32
+// The Buffer may start past the page aligned address of the mapping, so keep
+// what munmap() needs around until the Buffer is garbage collected.
+struct Mapping {
+  void* base;
+  size_t length;
+};
+
+static void Unmap(char* data, void* hint) {
+  Mapping* mapping = static_cast<Mapping*>(hint);
+  CHECK_EQ(munmap(mapping->base, mapping->length), 0);
+  delete mapping;
+}
+
+// Indexed by the advice argument of mmap().
+static const int kMmapAdvice[] = {
+  POSIX_MADV_NORMAL,
+  POSIX_MADV_SEQUENTIAL,
+  POSIX_MADV_RANDOM,
+  POSIX_MADV_WILLNEED
+};
+#endif
+
+/*
+ * mmap(fd, offset, length, shared, advice, undefined, ctx)
+ *
+ * Returns a Buffer that is backed by a mapping of the file. Without `shared`
+ * the mapping is private: the Buffer can be written to, but the changes are
+ * copy-on-write and never reach the file. Range checks are done in JS land.
+ */
+static void Mmap(const FunctionCallbackInfo<Value>& args) {
+  Environment* env = Environment::GetCurrent(args);
+  Isolate* isolate = env->isolate();
+
+  const int argc = args.Length();
+  CHECK_EQ(argc, 7);
+
+  CHECK(args[0]->IsInt32());
+  const int fd = args[0].As<Int32>()->Value();
+
+  CHECK(args[1]->IsNumber());
+  const int64_t offset = args[1].As<Integer>()->Value();
+  CHECK_GE(offset, 0);
+
+  CHECK(args[2]->IsUint32());
+  const size_t length = args[2].As<Uint32>()->Value();
+  CHECK_GT(length, 0);
+  CHECK_LE(length, Buffer::kMaxLength);
+
+  const bool shared = args[3]->IsTrue();
+
+  CHECK(args[4]->IsUint32());
+  const uint32_t advice = args[4].As<Uint32>()->Value();
+
+  Local<Object> ctx = args[6].As<Object>();
+  auto set_error = [&](int err, const char* syscall) {
+    ctx->Set(env->context(), env->errno_string(),
+             Integer::New(isolate, err)).FromJust();
+    ctx->Set(env->context(), env->syscall_string(),
+             OneByteString(isolate, syscall)).FromJust();
+  };
+
+#ifdef _WIN32
+  set_error(UV_ENOSYS, "mmap");
+#else
+  CHECK_LT(advice, arraysize(kMmapAdvice));
+
+  const int64_t page_size = sysconf(_SC_PAGESIZE);
+  const size_t delta = offset % page_size;
+  const size_t map_length = length + delta;
+
+  env->PrintSyncTrace();
+  void* base = mmap(nullptr,
+                    map_length,
+                    PROT_READ | PROT_WRITE,
+                    shared ? MAP_SHARED : MAP_PRIVATE,
+                    fd,
+                    offset - delta);
+  if (base == MAP_FAILED)
+    return set_error(-errno, "mmap");
+
+  int err = posix_madvise(base, map_length, kMmapAdvice[advice]);
+  if (err != 0) {
+    munmap(base, map_length);
+    return set_error(-err, "madvise");
+  }
+
+  Local<Object> buffer;
+  Mapping* mapping = new Mapping { base, map_length };
+  if (!Buffer::New(env, static_cast<char*>(base) + delta, length,
+                   Unmap, mapping).ToLocal(&buffer)) {
+    Unmap(nullptr, mapping);
+    return;
+  }
+  args.GetReturnValue().Set(buffer);
+#endif
+}
+
+
 /* fs.chmod(path, mode);
  * Wrapper for chmod(1) / EIO_CHMOD
  */
@@ -1867,6 +3107,10 @@ void Initialize(Local<Object> target,
   env->SetMethod(target, "open", Open);
   env->SetMethod(target, "openFileHandle", OpenFileHandle);
   env->SetMethod(target, "read", Read);
+  env->SetMethod(target, "readBuffers", ReadBuffers);
+  env->SetMethod(target, "readFile", ReadFile);
+  env->SetMethod(target, "readRanges", ReadRanges);
+  env->SetMethod(target, "mmap", Mmap);
   env->SetMethod(target, "fdatasync", Fdatasync);
   env->SetMethod(target, "fsync", Fsync);
   env->SetMethod(target, "rename", Rename);
@@ -1874,8 +3118,11 @@ void Initialize(Local<Object> target,
   env->SetMethod(target, "rmdir", RMDir);
   env->SetMethod(target, "mkdir", MKDir);
   env->SetMethod(target, "readdir", ReadDir);
+  env->SetMethod(target, "opendir", OpenDir);
   env->SetMethod(target, "internalModuleReadJSON", InternalModuleReadJSON);
   env->SetMethod(target, "internalModuleStat", InternalModuleStat);
+  env->SetMethod(target, "internalModuleStatCache", InternalModuleStatCache);
+  env->SetMethod(target, "internalModuleFindPath", InternalModuleFindPath);
   env->SetMethod(target, "stat", Stat);
   env->SetMethod(target, "lstat", LStat);
   env->SetMethod(target, "fstat", FStat);
@@ -1911,7 +3158,18 @@ void Initialize(Local<Object> target,
               FIXED_ONE_BYTE_STRING(env->isolate(), "statValues"),
               env->fs_stats_field_array()->GetJSArray()).FromJust();
 
+  std::string io_uring;
+  if (env->fs_io_uring == nullptr &&
+      SafeGetenv("NODE_FS_IO_URING", &io_uring) && io_uring[0] == '1') {
+    env->fs_io_uring = IoUring::Create(env);
+  }
+  target->Set(context,
+              FIXED_ONE_BYTE_STRING(env->isolate(), "ioUringEnabled"),
+              Boolean::New(env->isolate(), env->fs_io_uring != nullptr))
+        .FromJust();
+
   StatWatcher::Initialize(env, target);
+  FSWalker::Initialize(env, target);
 
   // Create FunctionTemplate for FSReqWrap
   Local<FunctionTemplate> fst =
@@ -1958,6 +3216,16 @@ void Initialize(Local<Object> target,
   target->Set(context, handleString, fd->GetFunction()).FromJust();
   env->set_fd_constructor_template(fdt);
 
+  // Create FunctionTemplate for DirHandle
+  Local<FunctionTemplate> dir = FunctionTemplate::New(env->isolate());
+  dir->SetClassName(FIXED_ONE_BYTE_STRING(env->isolate(), "DirHandle"));
+  AsyncWrap::AddWrapMethods(env, dir);
+  env->SetProtoMethod(dir, "read", DirHandle::Read);
+  env->SetProtoMethod(dir, "close", DirHandle::Close);
+  Local<ObjectTemplate> dirt = dir->InstanceTemplate();
+  dirt->SetInternalFieldCount(1);
+  env->set_dir_instance_template(dirt);
+
   // Create FunctionTemplate for FileHandle::CloseReq
   Local<FunctionTemplate> fdclose = FunctionTemplate::New(env->isolate());
   fdclose->SetClassName(FIXED_ONE_BYTE_STRING(env->isolate(),
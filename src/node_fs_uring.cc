@@ -0,0 +1,703 @@
+#include "node_fs_uring.h"
+#include "node_internals.h"
+#include "env-inl.h"
+#include "req_wrap-inl.h"
+#include "util-inl.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <limits.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <vector>
+
+#if defined(__linux__) && defined(__has_include)
+#if __has_include(<linux/io_uring.h>)
+#include <linux/io_uring.h>
+#endif
+#endif
+
+// IORING_FEAT_RW_CUR_POS and IORING_REGISTER_PROBE were added in Linux 5.6,
+// together with the openat, close and statx opcodes.
+#if defined(IORING_FEAT_RW_CUR_POS) && defined(IORING_FEAT_NODROP)
+#define NODE_HAVE_IO_URING 1
+#include <sys/eventfd.h>
+#include <sys/mman.h>
+#include <sys/sysmacros.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+#ifndef __NR_io_uring_setup
+#define __NR_io_uring_setup 425
+#endif
+#ifndef __NR_io_uring_enter
+#define __NR_io_uring_enter 426
+#endif
+#ifndef __NR_io_uring_register
+#define __NR_io_uring_register 427
+#endif
+#endif
+
+namespace node {
+namespace fs {
+
+#ifdef NODE_HAVE_IO_URING
+
+namespace {
+
+// The layout of struct statx, which not all libc headers declare.
+struct StatxTimestamp {
+  int64_t tv_sec;
+  uint32_t tv_nsec;
+  int32_t unused0;
+};
+
+struct Statx {
+  uint32_t stx_mask;
+  uint32_t stx_blksize;
+  uint64_t stx_attributes;
+  uint32_t stx_nlink;
+  uint32_t stx_uid;
+  uint32_t stx_gid;
+  uint16_t stx_mode;
+  uint16_t unused0;
+  uint64_t stx_ino;
+  uint64_t stx_size;
+  uint64_t stx_blocks;
+  uint64_t stx_attributes_mask;
+  StatxTimestamp stx_atime;
+  StatxTimestamp stx_btime;
+  StatxTimestamp stx_ctime;
+  StatxTimestamp stx_mtime;
+  uint32_t stx_rdev_major;
+  uint32_t stx_rdev_minor;
+  uint32_t stx_dev_major;
+  uint32_t stx_dev_minor;
+  uint64_t unused1[14];
+};
+
+// STATX_BASIC_STATS
+constexpr unsigned kStatxMask = 0x7ff;
+constexpr uint32_t kEntries = 256;
+
+int SetupRing(uint32_t entries, io_uring_params* params) {
+  return syscall(__NR_io_uring_setup, entries, params);
+}
+
+int EnterRing(int fd, uint32_t to_submit, uint32_t min_complete,
+              uint32_t flags) {
+  return syscall(__NR_io_uring_enter, fd, to_submit, min_complete, flags,
+                 nullptr, 0);
+}
+
+int RegisterRing(int fd, unsigned opcode, void* arg, unsigned nr_args) {
+  return syscall(__NR_io_uring_register, fd, opcode, arg, nr_args);
+}
+
+void ToStatBuf(const Statx& s, uv_stat_t* buf) {
+  buf->st_dev = makedev(s.stx_dev_major, s.stx_dev_minor);
+  buf->st_mode = s.stx_mode;
+  buf->st_nlink = s.stx_nlink;
+  buf->st_uid = s.stx_uid;
+  buf->st_gid = s.stx_gid;
+  buf->st_rdev = makedev(s.stx_rdev_major, s.stx_rdev_minor);
+  buf->st_ino = s.stx_ino;
+  buf->st_size = s.stx_size;
+  buf->st_blksize = s.stx_blksize;
+  buf->st_blocks = s.stx_blocks;
+  buf->st_atim.tv_sec = s.stx_atime.tv_sec;
+  buf->st_atim.tv_nsec = s.stx_atime.tv_nsec;
+  buf->st_mtim.tv_sec = s.stx_mtime.tv_sec;
+  buf->st_mtim.tv_nsec = s.stx_mtime.tv_nsec;
+  buf->st_ctim.tv_sec = s.stx_ctime.tv_sec;
+  buf->st_ctim.tv_nsec = s.stx_ctime.tv_nsec;
+  // Like libuv's stat() on Linux, which does not know the birth time.
+  buf->st_birthtim.tv_sec = s.stx_ctime.tv_sec;
+  buf->st_birthtim.tv_nsec = s.stx_ctime.tv_nsec;
+  buf->st_flags = 0;
+  buf->st_gen = 0;
+}
+
+bool IsStat(uv_fs_t* req) {
+  return req->fs_type == UV_FS_STAT ||
+         req->fs_type == UV_FS_LSTAT ||
+         req->fs_type == UV_FS_FSTAT;
+}
+
+}  // anonymous namespace
+
+std::unique_ptr<IoUring> IoUring::Create(Environment* env) {
+  io_uring_params params;
+  memset(&params, 0, sizeof(params));
+  int ring_fd = SetupRing(kEntries, &params);
+  if (ring_fd < 0)
+    return nullptr;
+
+  const uint32_t required = IORING_FEAT_NODROP | IORING_FEAT_RW_CUR_POS;
+  int event_fd = -1;
+  if ((params.features & required) == required)
+    event_fd = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+  if (event_fd < 0) {
+    close(ring_fd);
+    return nullptr;
+  }
+
+  std::unique_ptr<IoUring> ring(new IoUring(env, ring_fd, event_fd));
+  if (!ring->Setup(params))
+    return nullptr;
+  return ring;
+}
+
+IoUring::IoUring(Environment* env, int ring_fd, int event_fd)
+    : env_(env), ring_fd_(ring_fd), event_fd_(event_fd) {}
+
+bool IoUring::Setup(const io_uring_params& params) {
+  sq_entries_ = params.sq_entries;
+  cq_entries_ = params.cq_entries;
+  sq_ring_size_ = params.sq_off.array + params.sq_entries * sizeof(uint32_t);
+  cq_ring_size_ = params.cq_off.cqes +
+                  params.cq_entries * sizeof(io_uring_cqe);
+  sqes_size_ = params.sq_entries * sizeof(io_uring_sqe);
+  if (params.features & IORING_FEAT_SINGLE_MMAP)
+    sq_ring_size_ = cq_ring_size_ = std::max(sq_ring_size_, cq_ring_size_);
+
+  sq_ring_ = mmap(nullptr, sq_ring_size_, PROT_READ | PROT_WRITE,
+                  MAP_SHARED | MAP_POPULATE, ring_fd_, IORING_OFF_SQ_RING);
+  if (sq_ring_ == MAP_FAILED) {
+    sq_ring_ = nullptr;
+    return false;
+  }
+  if (params.features & IORING_FEAT_SINGLE_MMAP) {
+    cq_ring_ = sq_ring_;
+  } else {
+    cq_ring_ = mmap(nullptr, cq_ring_size_, PROT_READ | PROT_WRITE,
+                    MAP_SHARED | MAP_POPULATE, ring_fd_, IORING_OFF_CQ_RING);
+    if (cq_ring_ == MAP_FAILED) {
+      cq_ring_ = nullptr;
+      return false;
+    }
+  }
+  void* sqes = mmap(nullptr, sqes_size_, PROT_READ | PROT_WRITE,
+                    MAP_SHARED | MAP_POPULATE, ring_fd_, IORING_OFF_SQES);
+  if (sqes == MAP_FAILED)
+    return false;
+  sqes_ = static_cast<io_uring_sqe*>(sqes);
+
+  char* sq = static_cast<char*>(sq_ring_);
+  char* cq = static_cast<char*>(cq_ring_);
+  sq_head_ = reinterpret_cast<uint32_t*>(sq + params.sq_off.head);
+  sq_tail_ = reinterpret_cast<uint32_t*>(sq + params.sq_off.tail);
+  sq_array_ = reinterpret_cast<uint32_t*>(sq + params.sq_off.array);
+  sq_mask_ = *reinterpret_cast<uint32_t*>(sq + params.sq_off.ring_mask);
+  cq_head_ = reinterpret_cast<uint32_t*>(cq + params.cq_off.head);
+  cq_tail_ = reinterpret_cast<uint32_t*>(cq + params.cq_off.tail);
+  cqes_ = cq + params.cq_off.cqes;
+  cq_mask_ = *reinterpret_cast<uint32_t*>(cq + params.cq_off.ring_mask);
+
+  // Ask the kernel which opcodes it supports. Older kernels without
+  // IORING_REGISTER_PROBE support none of the ones used here.
+  const size_t probe_size = sizeof(io_uring_probe) +
+                            256 * sizeof(io_uring_probe_op);
+  MallocedBuffer<char> probe_buffer(probe_size);
+  memset(probe_buffer.data, 0, probe_size);
+  io_uring_probe* probe = reinterpret_cast<io_uring_probe*>(probe_buffer.data);
+  if (RegisterRing(ring_fd_, IORING_REGISTER_PROBE, probe, 256) < 0)
+    return false;
+  for (unsigned op = 0; op < probe->ops_len && op < 256; op++) {
+    if (probe->ops[op].flags & IO_URING_OP_SUPPORTED)
+      supported_ops_[op] = 1;
+  }
+  if (!supported_ops_[IORING_OP_READV] || !supported_ops_[IORING_OP_WRITEV])
+    return false;
+
+  int event_fd = event_fd_;
+  if (RegisterRing(ring_fd_, IORING_REGISTER_EVENTFD, &event_fd, 1) < 0)
+    return false;
+
+  CHECK_EQ(0, uv_prepare_init(env_->event_loop(), &prepare_));
+  prepare_.data = this;
+  CHECK_EQ(0, uv_prepare_start(&prepare_, OnPrepare));
+  uv_unref(reinterpret_cast<uv_handle_t*>(&prepare_));
+
+  CHECK_EQ(0, uv_poll_init(env_->event_loop(), &poll_, event_fd_));
+  poll_.data = this;
+  CHECK_EQ(0, uv_poll_start(&poll_, UV_READABLE, OnPoll));
+  uv_unref(reinterpret_cast<uv_handle_t*>(&poll_));
+
+  CHECK_EQ(0, uv_idle_init(env_->event_loop(), &idle_));
+  idle_.data = this;
+  uv_unref(reinterpret_cast<uv_handle_t*>(&idle_));
+
+  env_->RegisterHandleCleanup(
+      reinterpret_cast<uv_handle_t*>(&poll_),
+      [](Environment* env, uv_handle_t* handle, void* arg) {
+        static_cast<IoUring*>(arg)->Close();
+      },
+      this);
+  return true;
+}
+
+IoUring::~IoUring() {
+  CHECK_EQ(in_flight_, 0);
+  if (sqes_ != nullptr)
+    munmap(sqes_, sqes_size_);
+  if (cq_ring_ != nullptr && cq_ring_ != sq_ring_)
+    munmap(cq_ring_, cq_ring_size_);
+  if (sq_ring_ != nullptr)
+    munmap(sq_ring_, sq_ring_size_);
+  close(event_fd_);
+  close(ring_fd_);
+}
+
+io_uring_sqe* IoUring::GetSqe(uv_fs_t* req, uint8_t opcode) {
+  if (closing_ || disabled_ || !supported_ops_[opcode])
+    return nullptr;
+  // Completions are never dropped, but keeping the number of requests in
+  // flight within the size of the completion queue avoids the overflow list.
+  if (in_flight_ >= cq_entries_)
+    return nullptr;
+
+  uint32_t tail = *sq_tail_;
+  if (tail - __atomic_load_n(sq_head_, __ATOMIC_ACQUIRE) >= sq_entries_) {
+    Flush();
+    if (disabled_ ||
+        tail - __atomic_load_n(sq_head_, __ATOMIC_ACQUIRE) >= sq_entries_) {
+      return nullptr;
+    }
+  }
+
+  io_uring_sqe* sqe = &sqes_[tail & sq_mask_];
+  memset(sqe, 0, sizeof(*sqe));
+  sqe->opcode = opcode;
+  sqe->user_data = reinterpret_cast<uintptr_t>(req);
+  return sqe;
+}
+
+void IoUring::Push(io_uring_sqe* sqe) {
+  uint32_t tail = *sq_tail_;
+  sq_array_[tail & sq_mask_] = static_cast<uint32_t>(sqe - sqes_);
+  __atomic_store_n(sq_tail_, tail + 1, __ATOMIC_RELEASE);
+  pending_++;
+  if (in_flight_++ == 0)
+    uv_ref(reinterpret_cast<uv_handle_t*>(&poll_));
+}
+
+void IoUring::Flush() {
+  while (pending_ > 0) {
+    int rc = EnterRing(ring_fd_, pending_, 0, 0);
+    if (rc < 0) {
+      // EAGAIN and EBUSY mean that the kernel is short on resources or that
+      // the completion queue needs reaping; try again on the next iteration.
+      // If nothing else is in flight, no completion would end the poll phase
+      // of that iteration, so make it not block until the entries are in.
+      if (errno == EINTR)
+        continue;
+      if (errno != EAGAIN && errno != EBUSY)
+        Refuse(-errno);
+      if (!closing_)
+        CHECK_EQ(0, uv_idle_start(&idle_, OnIdle));
+      return;
+    }
+    pending_ -= rc;
+  }
+  if (refused_.empty())
+    uv_idle_stop(&idle_);
+}
+
+void IoUring::Refuse(int err) {
+  // Take the entries back out of the submission queue, which the kernel only
+  // reads from in io_uring_enter(), and fail their requests from the idle
+  // handle. Requests that are started from here on go to the thread pool.
+  const uint32_t tail = *sq_tail_;
+  for (uint32_t i = tail - pending_; i != tail; i++) {
+    const io_uring_sqe& sqe = sqes_[sq_array_[i & sq_mask_]];
+    uv_fs_t* req = reinterpret_cast<uv_fs_t*>(sqe.user_data);
+    req->result = err;
+    refused_.push_back(req);
+  }
+  __atomic_store_n(sq_tail_, tail - pending_, __ATOMIC_RELEASE);
+  pending_ = 0;
+  disabled_ = true;
+}
+
+void IoUring::CompleteRefused() {
+  std::vector<uv_fs_t*> refused;
+  refused.swap(refused_);
+  for (uv_fs_t* req : refused)
+    Complete(req, req->result);
+}
+
+void IoUring::Reap() {
+  uint64_t count;
+  while (read(event_fd_, &count, sizeof(count)) == -1 && errno == EINTR) {}
+
+  io_uring_cqe* cqes = static_cast<io_uring_cqe*>(cqes_);
+  uint32_t head = *cq_head_;
+  uint32_t tail = __atomic_load_n(cq_tail_, __ATOMIC_ACQUIRE);
+  while (head != tail) {
+    const io_uring_cqe& cqe = cqes[head & cq_mask_];
+    uv_fs_t* req = reinterpret_cast<uv_fs_t*>(cqe.user_data);
+    int result = cqe.res;
+    __atomic_store_n(cq_head_, ++head, __ATOMIC_RELEASE);
+    // The callback may submit further requests.
+    Complete(req, result);
+    tail = __atomic_load_n(cq_tail_, __ATOMIC_ACQUIRE);
+  }
+}
+
+void IoUring::Complete(uv_fs_t* req, int result) {
+  if (--in_flight_ == 0)
+    uv_unref(reinterpret_cast<uv_handle_t*>(&poll_));
+
+  if (IsStat(req)) {
+    Statx* statx = static_cast<Statx*>(req->ptr);
+    if (result == 0) {
+      ToStatBuf(*statx, &req->statbuf);
+      req->ptr = &req->statbuf;
+    } else {
+      req->ptr = nullptr;
+    }
+    free(statx);
+  }
+  req->result = result;
+  req->cb(req);
+}
+
+void IoUring::Close() {
+  // Requests that are started from here on go to the thread pool.
+  closing_ = true;
+  while (in_flight_ > 0) {
+    Flush();
+    // Only wait if something was submitted that can complete.
+    if (in_flight_ > pending_ + refused_.size()) {
+      int rc = EnterRing(ring_fd_, 0, 1, IORING_ENTER_GETEVENTS);
+      CHECK(rc >= 0 || errno == EINTR);
+    }
+    CompleteRefused();
+    Reap();
+  }
+  env_->CloseHandle(&prepare_, [](uv_prepare_t* handle) {});
+  env_->CloseHandle(&poll_, [](uv_poll_t* handle) {});
+  env_->CloseHandle(&idle_, [](uv_idle_t* handle) {});
+}
+
+void IoUring::OnPrepare(uv_prepare_t* handle) {
+  IoUring* ring = static_cast<IoUring*>(handle->data);
+  ring->Flush();
+}
+
+void IoUring::OnPoll(uv_poll_t* handle, int status, int events) {
+  IoUring* ring = static_cast<IoUring*>(handle->data);
+  ring->Reap();
+}
+
+void IoUring::OnIdle(uv_idle_t* handle) {
+  // OnPrepare() retries submissions that the kernel was short on resources
+  // for. Those that it has refused for good are failed here.
+  IoUring* ring = static_cast<IoUring*>(handle->data);
+  ring->CompleteRefused();
+  if (ring->pending_ == 0)
+    uv_idle_stop(handle);
+}
+
+namespace uring {
+
+namespace {
+
+IoUring* GetRing(uv_fs_t* req) {
+  return ReqWrap<uv_fs_t>::from_req(req)->env()->fs_io_uring.get();
+}
+
+// Fills in the fields that uv_fs_*() would, and that the code completing the
+// request and uv_fs_req_cleanup() rely on.
+int InitRequest(uv_loop_t* loop,
+                uv_fs_t* req,
+                uv_fs_type fs_type,
+                const char* path,
+                uv_fs_cb cb) {
+  req->type = UV_FS;
+  req->fs_type = fs_type;
+  req->result = 0;
+  req->ptr = nullptr;
+  req->loop = loop;
+  req->path = nullptr;
+  req->new_path = nullptr;
+  req->bufs = nullptr;
+  req->nbufs = 0;
+  req->cb = cb;
+  // uv_cancel() looks at the work request; make it see one that is not
+  // queued, so that it fails with UV_EBUSY.
+  memset(&req->work_req, 0, sizeof(req->work_req));
+  req->work_req.loop = loop;
+  req->work_req.wq[0] = req->work_req.wq[1] = &req->work_req.wq;
+  if (path != nullptr) {
+    req->path = strdup(path);
+    if (req->path == nullptr)
+      return UV_ENOMEM;
+  }
+  return 0;
+}
+
+int CopyBufs(uv_fs_t* req, const uv_buf_t bufs[], unsigned int nbufs) {
+  req->nbufs = nbufs;
+  req->bufs = req->bufsml;
+  if (nbufs > arraysize(req->bufsml)) {
+    req->bufs = static_cast<uv_buf_t*>(malloc(nbufs * sizeof(*bufs)));
+    if (req->bufs == nullptr)
+      return UV_ENOMEM;
+  }
+  memcpy(req->bufs, bufs, nbufs * sizeof(*bufs));
+  return 0;
+}
+
+int ReadWrite(IoUring* ring,
+              uint8_t opcode,
+              uv_fs_type fs_type,
+              uv_loop_t* loop,
+              uv_fs_t* req,
+              uv_file file,
+              const uv_buf_t bufs[],
+              unsigned int nbufs,
+              int64_t offset,
+              uv_fs_cb cb) {
+  io_uring_sqe* sqe = ring->GetSqe(req, opcode);
+  if (sqe == nullptr)
+    return 1;
+  int err = InitRequest(loop, req, fs_type, nullptr, cb);
+  if (err == 0)
+    err = CopyBufs(req, bufs, nbufs);
+  if (err != 0)
+    return err;
+  sqe->fd = file;
+  sqe->addr = reinterpret_cast<uintptr_t>(req->bufs);
+  sqe->len = nbufs;
+  // An offset of -1 reads from or writes to the current file position.
+  sqe->off = offset < 0 ? static_cast<uint64_t>(-1) : offset;
+  ring->Push(sqe);
+  return 0;
+}
+
+int DoStat(IoUring* ring,
+           uv_fs_type fs_type,
+           uv_loop_t* loop,
+           uv_fs_t* req,
+           uv_file file,
+           const char* path,
+           int flags,
+           uv_fs_cb cb) {
+  io_uring_sqe* sqe = ring->GetSqe(req, IORING_OP_STATX);
+  if (sqe == nullptr)
+    return 1;
+  int err = InitRequest(loop, req, fs_type, path, cb);
+  if (err != 0)
+    return err;
+  req->ptr = malloc(sizeof(Statx));
+  if (req->ptr == nullptr)
+    return UV_ENOMEM;
+  sqe->fd = file;
+  sqe->addr = reinterpret_cast<uintptr_t>(path != nullptr ? req->path : "");
+  sqe->len = kStatxMask;
+  sqe->off = reinterpret_cast<uintptr_t>(req->ptr);
+  sqe->statx_flags = flags;
+  ring->Push(sqe);
+  return 0;
+}
+
+int DoFsync(IoUring* ring,
+            uv_fs_type fs_type,
+            uv_loop_t* loop,
+            uv_fs_t* req,
+            uv_file file,
+            uint32_t flags,
+            uv_fs_cb cb) {
+  io_uring_sqe* sqe = ring->GetSqe(req, IORING_OP_FSYNC);
+  if (sqe == nullptr)
+    return 1;
+  int err = InitRequest(loop, req, fs_type, nullptr, cb);
+  if (err != 0)
+    return err;
+  sqe->fd = file;
+  sqe->fsync_flags = flags;
+  ring->Push(sqe);
+  return 0;
+}
+
+}  // anonymous namespace
+
+// The helpers above return 1 when the ring cannot take the request, which is
+// then passed on to libuv. GetSqe() does not consume the entry until Push(),
+// so bailing out in between leaves the ring untouched.
+
+int Open(uv_loop_t* loop, uv_fs_t* req, const char* path, int flags, int mode,
+         uv_fs_cb cb) {
+  IoUring* ring = GetRing(req);
+  io_uring_sqe* sqe =
+      ring != nullptr ? ring->GetSqe(req, IORING_OP_OPENAT) : nullptr;
+  if (sqe == nullptr)
+    return uv_fs_open(loop, req, path, flags, mode, cb);
+  int err = InitRequest(loop, req, UV_FS_OPEN, path, cb);
+  if (err != 0)
+    return err;
+  sqe->fd = AT_FDCWD;
+  sqe->addr = reinterpret_cast<uintptr_t>(req->path);
+  sqe->len = mode;
+  sqe->open_flags = flags | O_CLOEXEC;
+  ring->Push(sqe);
+  return 0;
+}
+
+int Close(uv_loop_t* loop, uv_fs_t* req, uv_file file, uv_fs_cb cb) {
+  IoUring* ring = GetRing(req);
+  io_uring_sqe* sqe =
+      ring != nullptr ? ring->GetSqe(req, IORING_OP_CLOSE) : nullptr;
+  if (sqe == nullptr)
+    return uv_fs_close(loop, req, file, cb);
+  int err = InitRequest(loop, req, UV_FS_CLOSE, nullptr, cb);
+  if (err != 0)
+    return err;
+  sqe->fd = file;
+  ring->Push(sqe);
+  return 0;
+}
+
+int Read(uv_loop_t* loop, uv_fs_t* req, uv_file file, const uv_buf_t bufs[],
+         unsigned int nbufs, int64_t offset, uv_fs_cb cb) {
+  IoUring* ring = GetRing(req);
+  int err = 1;
+  if (ring != nullptr && nbufs > 0 && nbufs <= IOV_MAX) {
+    err = ReadWrite(ring, IORING_OP_READV, UV_FS_READ, loop, req, file, bufs,
+                    nbufs, offset, cb);
+  }
+  if (err == 1)
+    return uv_fs_read(loop, req, file, bufs, nbufs, offset, cb);
+  return err;
+}
+
+int Write(uv_loop_t* loop, uv_fs_t* req, uv_file file, const uv_buf_t bufs[],
+          unsigned int nbufs, int64_t offset, uv_fs_cb cb) {
+  IoUring* ring = GetRing(req);
+  int err = 1;
+  if (ring != nullptr && nbufs > 0 && nbufs <= IOV_MAX) {
+    err = ReadWrite(ring, IORING_OP_WRITEV, UV_FS_WRITE, loop, req, file, bufs,
+                    nbufs, offset, cb);
+  }
+  if (err == 1)
+    return uv_fs_write(loop, req, file, bufs, nbufs, offset, cb);
+  return err;
+}
+
+int Stat(uv_loop_t* loop, uv_fs_t* req, const char* path, uv_fs_cb cb) {
+  IoUring* ring = GetRing(req);
+  int err = 1;
+  if (ring != nullptr)
+    err = DoStat(ring, UV_FS_STAT, loop, req, AT_FDCWD, path, 0, cb);
+  if (err == 1)
+    return uv_fs_stat(loop, req, path, cb);
+  return err;
+}
+
+int LStat(uv_loop_t* loop, uv_fs_t* req, const char* path, uv_fs_cb cb) {
+  IoUring* ring = GetRing(req);
+  int err = 1;
+  if (ring != nullptr) {
+    err = DoStat(ring, UV_FS_LSTAT, loop, req, AT_FDCWD, path,
+                 AT_SYMLINK_NOFOLLOW, cb);
+  }
+  if (err == 1)
+    return uv_fs_lstat(loop, req, path, cb);
+  return err;
+}
+
+int FStat(uv_loop_t* loop, uv_fs_t* req, uv_file file, uv_fs_cb cb) {
+  IoUring* ring = GetRing(req);
+  int err = 1;
+  if (ring != nullptr) {
+    err = DoStat(ring, UV_FS_FSTAT, loop, req, file, nullptr, AT_EMPTY_PATH,
+                 cb);
+  }
+  if (err == 1)
+    return uv_fs_fstat(loop, req, file, cb);
+  return err;
+}
+
+int Fsync(uv_loop_t* loop, uv_fs_t* req, uv_file file, uv_fs_cb cb) {
+  IoUring* ring = GetRing(req);
+  int err = 1;
+  if (ring != nullptr)
+    err = DoFsync(ring, UV_FS_FSYNC, loop, req, file, 0, cb);
+  if (err == 1)
+    return uv_fs_fsync(loop, req, file, cb);
+  return err;
+}
+
+int Fdatasync(uv_loop_t* loop, uv_fs_t* req, uv_file file, uv_fs_cb cb) {
+  IoUring* ring = GetRing(req);
+  int err = 1;
+  if (ring != nullptr) {
+    err = DoFsync(ring, UV_FS_FDATASYNC, loop, req, file,
+                  IORING_FSYNC_DATASYNC, cb);
+  }
+  if (err == 1)
+    return uv_fs_fdatasync(loop, req, file, cb);
+  return err;
+}
+
+}  // namespace uring
+
+#else  // !NODE_HAVE_IO_URING
+
+std::unique_ptr<IoUring> IoUring::Create(Environment* env) {
+  return nullptr;
+}
+
+IoUring::~IoUring() {}
+
+namespace uring {
+
+int Open(uv_loop_t* loop, uv_fs_t* req, const char* path, int flags, int mode,
+         uv_fs_cb cb) {
+  return uv_fs_open(loop, req, path, flags, mode, cb);
+}
+
+int Close(uv_loop_t* loop, uv_fs_t* req, uv_file file, uv_fs_cb cb) {
+  return uv_fs_close(loop, req, file, cb);
+}
+
+int Read(uv_loop_t* loop, uv_fs_t* req, uv_file file, const uv_buf_t bufs[],
+         unsigned int nbufs, int64_t offset, uv_fs_cb cb) {
+  return uv_fs_read(loop, req, file, bufs, nbufs, offset, cb);
+}
+
+int Write(uv_loop_t* loop, uv_fs_t* req, uv_file file, const uv_buf_t bufs[],
+          unsigned int nbufs, int64_t offset, uv_fs_cb cb) {
+  return uv_fs_write(loop, req, file, bufs, nbufs, offset, cb);
+}
+
+int Stat(uv_loop_t* loop, uv_fs_t* req, const char* path, uv_fs_cb cb) {
+  return uv_fs_stat(loop, req, path, cb);
+}
+
+int LStat(uv_loop_t* loop, uv_fs_t* req, const char* path, uv_fs_cb cb) {
+  return uv_fs_lstat(loop, req, path, cb);
+}
+
+int FStat(uv_loop_t* loop, uv_fs_t* req, uv_file file, uv_fs_cb cb) {
+  return uv_fs_fstat(loop, req, file, cb);
+}
+
+int Fsync(uv_loop_t* loop, uv_fs_t* req, uv_file file, uv_fs_cb cb) {
+  return uv_fs_fsync(loop, req, file, cb);
+}
+
+int Fdatasync(uv_loop_t* loop, uv_fs_t* req, uv_file file, uv_fs_cb cb) {
+  return uv_fs_fdatasync(loop, req, file, cb);
+}
+
+}  // namespace uring
+
+#endif  // NODE_HAVE_IO_URING
+
+}  // namespace fs
+}  // namespace node
@@ -0,0 +1,129 @@
+#ifndef SRC_NODE_FS_URING_H_
+#define SRC_NODE_FS_URING_H_
+
+#if defined(NODE_WANT_INTERNALS) && NODE_WANT_INTERNALS
+
+#include "node.h"
+#include "uv.h"
+
+#include <stdint.h>
+#include <memory>
+#include <vector>
+
+struct io_uring_params;
+struct io_uring_sqe;
+
+namespace node {
+
+class Environment;
+
+namespace fs {
+
+// An io_uring instance that asynchronous fs requests are submitted to instead
+// of the libuv thread pool. It is only created on Linux when the
+// NODE_FS_IO_URING=1 environment variable is set and the kernel supports the
+// required features; see the uring:: functions below.
+//
+// Submission queue entries that are prepared during a loop iteration are
+// handed to the kernel in a single io_uring_enter() call from a prepare
+// handle, right before the loop polls for I/O. Completions are signalled
+// through an eventfd that is watched by a poll handle, which keeps the loop
+// alive while requests are in flight.
+class IoUring {
+ public:
+  // Returns nullptr if io_uring is not available.
+  static std::unique_ptr<IoUring> Create(Environment* env);
+  ~IoUring();
+
+  // Returns a zeroed submission queue entry for `req`, or nullptr if the
+  // request should go to the thread pool instead because the kernel does not
+  // support `opcode` or the ring is full.
+  io_uring_sqe* GetSqe(uv_fs_t* req, uint8_t opcode);
+  // Queues the entry returned by the last GetSqe() call for submission.
+  void Push(io_uring_sqe* sqe);
+
+ private:
+  IoUring(Environment* env, int ring_fd, int event_fd);
+
+  bool Setup(const io_uring_params& params);
+  void Flush();
+  // Fails the pending entries with `err` and stops using the ring.
+  void Refuse(int err);
+  void CompleteRefused();
+  void Reap();
+  void Complete(uv_fs_t* req, int result);
+  // Completes all requests in flight synchronously and closes the handles.
+  void Close();
+
+  static void OnPrepare(uv_prepare_t* handle);
+  static void OnPoll(uv_poll_t* handle, int status, int events);
+  static void OnIdle(uv_idle_t* handle);
+
+  Environment* const env_;
+  const int ring_fd_;
+  const int event_fd_;
+  uv_prepare_t prepare_;
+  uv_poll_t poll_;
+  // Started while the kernel refuses submissions, so that the loop does not
+  // block in poll with entries that no completion will wake it up for.
+  uv_idle_t idle_;
+  bool closing_ = false;
+  // Set once the kernel has failed a submission with an error other than
+  // EAGAIN or EBUSY. Requests go to the thread pool from then on.
+  bool disabled_ = false;
+
+  void* sq_ring_ = nullptr;
+  size_t sq_ring_size_ = 0;
+  void* cq_ring_ = nullptr;
+  size_t cq_ring_size_ = 0;
+  io_uring_sqe* sqes_ = nullptr;
+  size_t sqes_size_ = 0;
+
+  uint32_t* sq_head_ = nullptr;
+  uint32_t* sq_tail_ = nullptr;
+  uint32_t* sq_array_ = nullptr;
+  uint32_t sq_mask_ = 0;
+  uint32_t sq_entries_ = 0;
+  uint32_t* cq_head_ = nullptr;
+  uint32_t* cq_tail_ = nullptr;
+  void* cqes_ = nullptr;
+  uint32_t cq_mask_ = 0;
+  uint32_t cq_entries_ = 0;
+
+  // Entries that have been pushed but not handed to the kernel yet.
+  uint32_t pending_ = 0;
+  // Requests whose completion has not been reaped yet, including pending and
+  // refused ones.
+  uint32_t in_flight_ = 0;
+  // Requests that the kernel has refused, which are failed on the next loop
+  // iteration.
+  std::vector<uv_fs_t*> refused_;
+  uint8_t supported_ops_[256] = {};
+};
+
+// Drop-in replacements for the uv_fs_*() functions of the same name that
+// submit the request to the environment's IoUring, if there is one, and
+// fall back to libuv otherwise. `req` must belong to a ReqWrap<uv_fs_t>.
+namespace uring {
+
+int Open(uv_loop_t* loop, uv_fs_t* req, const char* path, int flags, int mode,
+         uv_fs_cb cb);
+int Close(uv_loop_t* loop, uv_fs_t* req, uv_file file, uv_fs_cb cb);
+int Read(uv_loop_t* loop, uv_fs_t* req, uv_file file, const uv_buf_t bufs[],
+         unsigned int nbufs, int64_t offset, uv_fs_cb cb);
+int Write(uv_loop_t* loop, uv_fs_t* req, uv_file file, const uv_buf_t bufs[],
+          unsigned int nbufs, int64_t offset, uv_fs_cb cb);
+int Stat(uv_loop_t* loop, uv_fs_t* req, const char* path, uv_fs_cb cb);
+int LStat(uv_loop_t* loop, uv_fs_t* req, const char* path, uv_fs_cb cb);
+int FStat(uv_loop_t* loop, uv_fs_t* req, uv_file file, uv_fs_cb cb);
+int Fsync(uv_loop_t* loop, uv_fs_t* req, uv_file file, uv_fs_cb cb);
+int Fdatasync(uv_loop_t* loop, uv_fs_t* req, uv_file file, uv_fs_cb cb);
+
+}  // namespace uring
+
+}  // namespace fs
+}  // namespace node
+
+#endif  // defined(NODE_WANT_INTERNALS) && NODE_WANT_INTERNALS
+
+#endif  // SRC_NODE_FS_URING_H_
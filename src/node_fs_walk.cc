@@ -0,0 +1,379 @@
+#include "node_fs_walk.h"
+#include "node_file.h"
+#include "node_internals.h"
+#include "async_wrap-inl.h"
+#include "env-inl.h"
+#include "string_bytes.h"
+#include "util-inl.h"
+
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <algorithm>
+#include <memory>
+
+namespace node {
+namespace fs {
+
+using v8::Array;
+using v8::ArrayBuffer;
+using v8::Context;
+using v8::Float64Array;
+using v8::FunctionCallbackInfo;
+using v8::FunctionTemplate;
+using v8::HandleScope;
+using v8::Isolate;
+using v8::Local;
+using v8::MaybeLocal;
+using v8::Null;
+using v8::Object;
+using v8::String;
+using v8::Uint32;
+using v8::Value;
+
+// Matches `path` against `pattern`, see the comment on FSWalker. A `**/`
+// prefix also matches no directory at all, so `**/*.js` matches `index.js`.
+static bool GlobMatch(const char* pattern, const char* path) {
+  for (;;) {
+    switch (*pattern) {
+      case '\0':
+        return *path == '\0';
+      case '?':
+        if (*path == '\0' || *path == '/')
+          return false;
+        pattern++;
+        path++;
+        break;
+      case '*':
+        if (pattern[1] == '*') {
+          pattern += 2;
+          if (*pattern == '/' && GlobMatch(pattern + 1, path))
+            return true;
+          for (;; path++) {
+            if (GlobMatch(pattern, path))
+              return true;
+            if (*path == '\0')
+              return false;
+          }
+        }
+        pattern++;
+        for (;; path++) {
+          if (GlobMatch(pattern, path))
+            return true;
+          if (*path == '\0' || *path == '/')
+            return false;
+        }
+      default:
+        if (*pattern != *path)
+          return false;
+        pattern++;
+        path++;
+    }
+  }
+}
+
+static bool MatchesAny(const std::vector<std::string>& patterns,
+                       const std::string& path) {
+  return std::any_of(patterns.begin(), patterns.end(),
+                     [&](const std::string& pattern) {
+                       return GlobMatch(pattern.c_str(), path.c_str());
+                     });
+}
+
+// Scans a single directory on the thread pool. Only reads the immutable
+// parts of the walker, everything else is updated on the loop thread in
+// FSWalker::OnScanDone().
+class FSWalker::ScanWork : public ThreadPoolWork {
+ public:
+  ScanWork(FSWalker* walker, const std::string& dir)
+      : ThreadPoolWork(walker->env()), walker_(walker), dir_(dir) {}
+
+  void DoThreadPoolWork() override {
+    const std::string base =
+        dir_.empty() ? walker_->root_ : walker_->prefix_ + dir_;
+    uv_fs_t req;
+    err_ = uv_fs_scandir(nullptr, &req, base.c_str(), 0, nullptr);
+    if (err_ < 0) {
+      uv_fs_req_cleanup(&req);
+      return;
+    }
+    err_ = 0;
+
+    uv_dirent_t ent;
+    int r;
+    while ((r = uv_fs_scandir_next(&req, &ent)) != UV_EOF) {
+      if (r < 0) {
+        err_ = r;
+        break;
+      }
+      std::string path = dir_.empty() ? ent.name : dir_ + '/' + ent.name;
+      if (walker_->Excluded(path))
+        continue;
+
+      uv_fs_t stat_req;
+      r = uv_fs_lstat(nullptr, &stat_req, (base + '/' + ent.name).c_str(),
+                      nullptr);
+      uv_fs_req_cleanup(&stat_req);
+      if (r == UV_ENOENT)  // Removed since the directory was scanned.
+        continue;
+      if (r < 0) {
+        err_ = r;
+        err_path_ = path;
+        break;
+      }
+
+      if ((stat_req.statbuf.st_mode & S_IFMT) == S_IFDIR)
+        subdirs_.push_back(path);
+      if (walker_->Included(path))
+        entries_.push_back(Entry { std::move(path), stat_req.statbuf });
+    }
+    uv_fs_req_cleanup(&req);
+  }
+
+  void AfterThreadPoolWork(int status) override {
+    if (status != 0)
+      err_ = status;
+    walker_->OnScanDone(this);
+  }
+
+ private:
+  FSWalker* const walker_;
+  const std::string dir_;
+  int err_ = 0;
+  std::string err_path_;
+  std::vector<Entry> entries_;
+  std::vector<std::string> subdirs_;
+
+  friend class FSWalker;
+};
+
+FSWalker::FSWalker(Environment* env,
+                   Local<Object> wrap,
+                   const std::string& root,
+                   enum encoding encoding,
+                   size_t batch_size,
+                   size_t concurrency)
+    : AsyncWrap(env, wrap, AsyncWrap::PROVIDER_FSWALKER),
+      root_(root),
+      prefix_(root.empty() || root.back() == '/' || root.back() == '\\' ?
+              root : root + '/'),
+      encoding_(encoding),
+      batch_size_(batch_size),
+      concurrency_(concurrency) {
+  pending_dirs_.push_back(std::string());
+  MakeWeak();
+}
+
+bool FSWalker::Included(const std::string& path) const {
+  return include_.empty() || MatchesAny(include_, path);
+}
+
+bool FSWalker::Excluded(const std::string& path) const {
+  return MatchesAny(exclude_, path);
+}
+
+// Keeps the walker alive while the thread pool or a read() refer to it.
+void FSWalker::UpdateWeakness() {
+  if (active_ > 0 || read_req_ != nullptr || immediate_pending_)
+    ClearWeak();
+  else
+    MakeWeak();
+}
+
+// Scans run ahead of read() until twice the batch size is buffered, which
+// bounds memory use by the size of the largest directories being scanned.
+void FSWalker::ScheduleScans() {
+  while (!closed_ && error_ == 0 && active_ < concurrency_ &&
+         !pending_dirs_.empty() && ready_.size() < batch_size_ * 2) {
+    ScanWork* work = new ScanWork(this, pending_dirs_.front());
+    pending_dirs_.pop_front();
+    active_++;
+    work->ScheduleWork();
+  }
+  UpdateWeakness();
+}
+
+void FSWalker::OnScanDone(ScanWork* work) {
+  std::unique_ptr<ScanWork> self(work);
+  active_--;
+
+  // A directory that vanished or was replaced while the walk was in progress
+  // is skipped. Errors from the root directory are always reported.
+  const bool is_root = work->dir_.empty();
+  if (work->err_ < 0 &&
+      (is_root || (work->err_ != UV_ENOENT && work->err_ != UV_ENOTDIR))) {
+    if (error_ == 0) {
+      error_ = work->err_;
+      error_path_ = work->err_path_.empty() ? work->dir_ : work->err_path_;
+    }
+  } else if (!closed_) {
+    for (auto& entry : work->entries_)
+      ready_.push_back(std::move(entry));
+    for (auto& dir : work->subdirs_)
+      pending_dirs_.push_back(std::move(dir));
+  }
+
+  ScheduleScans();
+  MaybeResolveRead();
+}
+
+MaybeLocal<Value> FSWalker::TakeBatch(Local<Value>* error) {
+  Isolate* isolate = env()->isolate();
+  Local<Context> context = env()->context();
+  const size_t count = std::min(ready_.size(), batch_size_);
+  const size_t fields = Environment::kFsStatsFieldsLength;
+
+  Local<Array> paths = Array::New(isolate, count);
+  Local<ArrayBuffer> ab =
+      ArrayBuffer::New(isolate, count * fields * sizeof(double));
+  double* stats = static_cast<double*>(ab->GetContents().Data());
+
+  for (size_t i = 0; i < count; i++) {
+    Entry& entry = ready_[i];
+    std::string path = prefix_ + entry.path;
+#ifdef _WIN32
+    std::replace(path.begin() + prefix_.size(), path.end(), '/', '\\');
+#endif
+    Local<Value> value;
+    if (!StringBytes::Encode(isolate, path.data(), path.size(), encoding_,
+                             error).ToLocal(&value)) {
+      return MaybeLocal<Value>();
+    }
+    paths->Set(context, i, value).FromJust();
+    FillStatsFields(stats, &entry.stat, i * fields);
+  }
+  ready_.erase(ready_.begin(), ready_.begin() + count);
+
+  Local<Array> result = Array::New(isolate, 2);
+  result->Set(context, 0, paths).FromJust();
+  result->Set(context, 1,
+              Float64Array::New(ab, 0, count * fields)).FromJust();
+  return result;
+}
+
+void FSWalker::MaybeResolveRead() {
+  if (read_req_ == nullptr)
+    return;
+  const bool done = closed_ || (active_ == 0 && pending_dirs_.empty());
+  if (error_ == 0 && !done && ready_.size() < batch_size_)
+    return;
+
+  HandleScope handle_scope(env()->isolate());
+  Context::Scope context_scope(env()->context());
+  std::unique_ptr<FSReqBase> req_wrap(read_req_);
+  read_req_ = nullptr;
+
+  if (error_ != 0) {
+    const std::string path = error_path_.empty() ?
+        root_ : prefix_ + error_path_;
+    req_wrap->Reject(UVException(env()->isolate(), error_, "scandir",
+                                 nullptr, path.c_str()));
+  } else if (closed_ || ready_.empty()) {
+    req_wrap->Resolve(Null(env()->isolate()));
+  } else {
+    Local<Value> error;
+    Local<Value> batch;
+    if (TakeBatch(&error).ToLocal(&batch))
+      req_wrap->Resolve(batch);
+    else
+      req_wrap->Reject(error);
+    ScheduleScans();
+  }
+  UpdateWeakness();
+}
+
+// read() and close() are called from JS, which must not be re-entered
+// synchronously. Results that are available right away are delivered from
+// an immediate instead.
+void FSWalker::ResolveReadSoon() {
+  if (immediate_pending_)
+    return;
+  immediate_pending_ = true;
+  env()->SetImmediate([](Environment* env, void* data) {
+    FSWalker* walker = static_cast<FSWalker*>(data);
+    walker->immediate_pending_ = false;
+    walker->MaybeResolveRead();
+    walker->UpdateWeakness();
+  }, this, object());
+  UpdateWeakness();
+}
+
+void FSWalker::New(const FunctionCallbackInfo<Value>& args) {
+  CHECK(args.IsConstructCall());
+  Environment* env = Environment::GetCurrent(args);
+  Isolate* isolate = env->isolate();
+
+  BufferValue root(isolate, args[0]);
+  CHECK_NOT_NULL(*root);
+  const enum encoding encoding = ParseEncoding(isolate, args[1], UTF8);
+  CHECK(args[2]->IsArray());
+  CHECK(args[3]->IsArray());
+  CHECK(args[4]->IsUint32());
+  CHECK(args[5]->IsUint32());
+  const size_t batch_size = args[4].As<Uint32>()->Value();
+  const size_t concurrency = args[5].As<Uint32>()->Value();
+  CHECK_GT(batch_size, 0);
+  CHECK_GT(concurrency, 0);
+
+  FSWalker* walker = new FSWalker(env, args.This(),
+                                  std::string(*root, root.length()),
+                                  encoding, batch_size, concurrency);
+
+  auto add_patterns = [&](Local<Value> value,
+                          std::vector<std::string>* patterns) {
+    Local<Array> array = value.As<Array>();
+    for (uint32_t i = 0; i < array->Length(); i++) {
+      Local<Value> pattern;
+      if (!array->Get(env->context(), i).ToLocal(&pattern))
+        return;
+      CHECK(pattern->IsString());
+      node::Utf8Value utf8(isolate, pattern);
+      patterns->emplace_back(*utf8, utf8.length());
+    }
+  };
+  add_patterns(args[2], &walker->include_);
+  add_patterns(args[3], &walker->exclude_);
+}
+
+void FSWalker::Read(const FunctionCallbackInfo<Value>& args) {
+  FSWalker* walker;
+  ASSIGN_OR_RETURN_UNWRAP(&walker, args.Holder());
+  CHECK(args[0]->IsObject());
+  CHECK_NULL(walker->read_req_);
+
+  FSReqBase* req_wrap = Unwrap<FSReqBase>(args[0].As<Object>());
+  CHECK_NOT_NULL(req_wrap);
+  req_wrap->Init("scandir", nullptr, 0, walker->encoding_);
+  walker->read_req_ = req_wrap;
+  walker->ScheduleScans();
+  walker->ResolveReadSoon();
+}
+
+void FSWalker::Close(const FunctionCallbackInfo<Value>& args) {
+  FSWalker* walker;
+  ASSIGN_OR_RETURN_UNWRAP(&walker, args.Holder());
+  walker->closed_ = true;
+  walker->pending_dirs_.clear();
+  walker->ready_.clear();
+  if (walker->read_req_ != nullptr)
+    walker->ResolveReadSoon();
+}
+
+void FSWalker::Initialize(Environment* env, Local<Object> target) {
+  HandleScope scope(env->isolate());
+
+  Local<FunctionTemplate> t = env->NewFunctionTemplate(FSWalker::New);
+  t->InstanceTemplate()->SetInternalFieldCount(1);
+  Local<String> walker_string =
+      FIXED_ONE_BYTE_STRING(env->isolate(), "FSWalker");
+  t->SetClassName(walker_string);
+
+  AsyncWrap::AddWrapMethods(env, t);
+  env->SetProtoMethod(t, "read", FSWalker::Read);
+  env->SetProtoMethod(t, "close", FSWalker::Close);
+
+  target->Set(env->context(), walker_string,
+              t->GetFunction()).FromJust();
+}
+
+}  // namespace fs
+}  // namespace node
@@ -0,0 +1,95 @@
+#ifndef SRC_NODE_FS_WALK_H_
+#define SRC_NODE_FS_WALK_H_
+
+#if defined(NODE_WANT_INTERNALS) && NODE_WANT_INTERNALS
+
+#include "node.h"
+#include "async_wrap.h"
+#include "env.h"
+#include "uv.h"
+#include "v8.h"
+
+#include <deque>
+#include <string>
+#include <vector>
+
+namespace node {
+namespace fs {
+
+class FSReqBase;
+
+// Walks a directory tree on the thread pool. Up to `concurrency` directories
+// are scanned in parallel, each entry is lstat()ed on the thread pool as well,
+// and the results are handed to JS in batches of paths plus their packed stat
+// fields, so that the per-entry cost does not involve a JS callback.
+//
+// Include and exclude filters are globs that are matched against the path
+// relative to the root, using '/' as the separator: `*` and `?` do not match
+// '/', `**` matches any number of path segments. Excluded directories are not
+// descended into. Symbolic links are reported but not followed.
+class FSWalker : public AsyncWrap {
+ public:
+  static void Initialize(Environment* env, v8::Local<v8::Object> target);
+
+  size_t self_size() const override { return sizeof(*this); }
+
+ private:
+  struct Entry {
+    std::string path;  // Relative to the root.
+    uv_stat_t stat;
+  };
+
+  class ScanWork;
+
+  FSWalker(Environment* env,
+           v8::Local<v8::Object> wrap,
+           const std::string& root,
+           enum encoding encoding,
+           size_t batch_size,
+           size_t concurrency);
+
+  // new FSWalker(root, encoding, include, exclude, batchSize, concurrency)
+  static void New(const v8::FunctionCallbackInfo<v8::Value>& args);
+  // read(req) settles `req` with [paths, statValues] for the next batch, or
+  // with null once the walk is complete.
+  static void Read(const v8::FunctionCallbackInfo<v8::Value>& args);
+  // close() stops the walk. A pending read() is settled with null.
+  static void Close(const v8::FunctionCallbackInfo<v8::Value>& args);
+
+  bool Included(const std::string& path) const;
+  bool Excluded(const std::string& path) const;
+
+  void ScheduleScans();
+  void OnScanDone(ScanWork* work);
+  // Settles the pending read() if a batch is ready, the walk is complete or
+  // has failed. Must not be called from within read().
+  void MaybeResolveRead();
+  void ResolveReadSoon();
+  v8::MaybeLocal<v8::Value> TakeBatch(v8::Local<v8::Value>* error);
+  void UpdateWeakness();
+
+  const std::string root_;
+  // `root_` with a trailing separator.
+  const std::string prefix_;
+  const enum encoding encoding_;
+  const size_t batch_size_;
+  const size_t concurrency_;
+  std::vector<std::string> include_;
+  std::vector<std::string> exclude_;
+
+  std::deque<std::string> pending_dirs_;
+  std::deque<Entry> ready_;
+  size_t active_ = 0;
+  int error_ = 0;
+  std::string error_path_;
+  bool closed_ = false;
+  bool immediate_pending_ = false;
+  FSReqBase* read_req_ = nullptr;
+};
+
+}  // namespace fs
+}  // namespace node
+
+#endif  // defined(NODE_WANT_INTERNALS) && NODE_WANT_INTERNALS
+
+#endif  // SRC_NODE_FS_WALK_H_
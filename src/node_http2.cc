@@ -188,6 +188,13 @@ Http2Options::Http2Options(Environment* env) {
   if (flags & (1 << IDX_OPTIONS_MAX_SESSION_MEMORY)) {
     SetMaxSessionMemory(buffer[IDX_OPTIONS_MAX_SESSION_MEMORY] * 1e6);
   }
+
+  // With many concurrent streams, a single read from the socket may contain
+  // DATA frames for a large number of them. Batching delivers all of those
+  // to JS in a single call.
+  if (flags & (1 << IDX_OPTIONS_BATCH_READS)) {
+    SetBatchReads(buffer[IDX_OPTIONS_BATCH_READS] != 0);
+  }
 }
 
 void Http2Session::Http2Settings::Init() {
@@ -368,6 +375,8 @@ Headers::Headers(Isolate* isolate,
   // Allocate a single buffer with count_ nghttp2_nv structs, followed
   // by the raw header data as passed from JS. This looks like:
   // | possible padding | nghttp2_nv | nghttp2_nv | ... | header contents |
+  // where each header in the contents is encoded as name\0value\0 followed
+  // by a single byte holding its nghttp2_nv flags.
   buf_.AllocateSufficientStorage((alignof(nghttp2_nv) - 1) +
                                  count_ * sizeof(nghttp2_nv) +
                                  header_string_len);
@@ -394,21 +403,81 @@ Headers::Headers(Isolate* isolate,
       static uint8_t zero = '\0';
       nva[0].name = nva[0].value = &zero;
       nva[0].namelen = nva[0].valuelen = 1;
+      nva[0].flags = NGHTTP2_NV_FLAG_NONE;
       count_ = 1;
       return;
     }
 
-    nva[n].flags = NGHTTP2_NV_FLAG_NONE;
     nva[n].name = reinterpret_cast<uint8_t*>(p);
     nva[n].namelen = strlen(p);
     p += nva[n].namelen + 1;
     nva[n].value = reinterpret_cast<uint8_t*>(p);
     nva[n].valuelen = strlen(p);
     p += nva[n].valuelen + 1;
+    nva[n].flags = *p & NGHTTP2_NV_FLAG_NO_INDEX;
+    p++;
+  }
+}
+
+
+void Headers::SetNoCopy() {
+  const uint8_t no_copy =
+      NGHTTP2_NV_FLAG_NO_COPY_NAME | NGHTTP2_NV_FLAG_NO_COPY_VALUE;
+  nghttp2_nv* nva = **this;
+  for (size_t n = 0; n < count_; n++)
+    nva[n].flags |= no_copy;
+}
+
+
+Http2HeaderBlock::Http2HeaderBlock(Environment* env,
+                                   Local<Object> wrap,
+                                   Local<Array> headers)
+    : BaseObject(env, wrap),
+      headers_(std::make_shared<Headers>(env->isolate(),
+                                         env->context(),
+                                         headers)) {
+  headers_->SetNoCopy();
+  MakeWeak();
+}
+
+
+// new Http2HeaderBlock(headers), where `headers` is a header list as built
+// by mapToHeaders() in JS land that does not contain any pseudo-headers.
+void Http2HeaderBlock::New(const FunctionCallbackInfo<Value>& args) {
+  Environment* env = Environment::GetCurrent(args);
+  CHECK(args.IsConstructCall());
+  CHECK(args[0]->IsArray());
+  new Http2HeaderBlock(env, args.This(), args[0].As<Array>());
+}
+
+
+CombinedHeaders::CombinedHeaders(Headers* list, Http2HeaderBlock* block) {
+  size_t block_length = block != nullptr ? block->headers()->length() : 0;
+  nva_.AllocateSufficientStorage(list->length() + block_length);
+  if (list->length() > 0)
+    memcpy(*nva_, **list, list->length() * sizeof(nghttp2_nv));
+  if (block_length > 0) {
+    memcpy(*nva_ + list->length(),
+           **block->headers(),
+           block_length * sizeof(nghttp2_nv));
   }
 }
 
 
+// Returns the precompiled header block passed as an optional argument to
+// respond() and pushPromise(), and makes sure it outlives the frame it is
+// about to be submitted with.
+static Http2HeaderBlock* GetHeaderBlock(Http2Session* session,
+                                        Local<Value> value) {
+  if (!value->IsObject())
+    return nullptr;
+  Http2HeaderBlock* block = Unwrap<Http2HeaderBlock>(value.As<Object>());
+  CHECK_NE(block, nullptr);
+  session->RetainHeaderBlock(block->headers());
+  return block;
+}
+
+
 // Sets the various callback functions that nghttp2 will use to notify us
 // about significant events while processing http2 stuff.
 Http2Session::Callbacks::Callbacks(bool kHasGetPaddingCallback) {
@@ -472,6 +541,8 @@ Http2Session::Http2Session(Environment* env,
 
   padding_strategy_ = opts.GetPaddingStrategy();
 
+  batch_reads_ = opts.GetBatchReads();
+
   bool hasGetPaddingCallback =
       padding_strategy_ != PADDING_STRATEGY_NONE;
 
@@ -547,6 +618,10 @@ void Http2Stream::EmitStatistics() {
 void Http2Session::EmitStatistics() {
   if (!HasHttp2Observer(env()))
     return;
+  statistics_.deflate_dynamic_table_size =
+      nghttp2_session_get_hd_deflate_dynamic_table_size(session_);
+  statistics_.inflate_dynamic_table_size =
+      nghttp2_session_get_hd_inflate_dynamic_table_size(session_);
   Http2SessionPerformanceEntry* entry =
     new Http2SessionPerformanceEntry(env(), statistics_, session_type_);
   env()->SetImmediate([](Environment* env, void* data) {
@@ -569,6 +644,15 @@ void Http2Session::EmitStatistics() {
     buffer[IDX_SESSION_STATS_DATA_RECEIVED] = entry->data_received();
     buffer[IDX_SESSION_STATS_MAX_CONCURRENT_STREAMS] =
         entry->max_concurrent_streams();
+    buffer[IDX_SESSION_STATS_HEADER_BYTES_SENT] = entry->header_bytes_sent();
+    buffer[IDX_SESSION_STATS_HEADER_BLOCK_BYTES_SENT] =
+        entry->header_block_bytes_sent();
+    buffer[IDX_SESSION_STATS_HEADER_BYTES_RECEIVED] =
+        entry->header_bytes_received();
+    buffer[IDX_SESSION_STATS_DEFLATE_DYNAMIC_TABLE_SIZE] =
+        entry->deflate_dynamic_table_size();
+    buffer[IDX_SESSION_STATS_INFLATE_DYNAMIC_TABLE_SIZE] =
+        entry->inflate_dynamic_table_size();
     entry->Notify(entry->ToObject());
   }, static_cast<void*>(entry));
 }
@@ -613,6 +697,19 @@ void Http2Session::Close(uint32_t code, bool socket_closed) {
   EmitStatistics();
 }
 
+void Http2Session::PrepareOutgoingHeaders(nghttp2_nv* nva, size_t len) {
+  for (size_t n = 0; n < len; n++) {
+    statistics_.header_bytes_sent += nva[n].namelen + nva[n].valuelen;
+    for (const std::string& name : sensitive_headers_) {
+      if (name.size() == nva[n].namelen &&
+          memcmp(name.data(), nva[n].name, nva[n].namelen) == 0) {
+        nva[n].flags |= NGHTTP2_NV_FLAG_NO_INDEX;
+        break;
+      }
+    }
+  }
+}
+
 // Locates an existing known stream by ID. nghttp2 has a similar method
 // but this is faster and does not fail if the stream is not found.
 inline Http2Stream* Http2Session::FindStream(int32_t id) {
@@ -778,6 +875,8 @@ int Http2Session::OnHeaderCallback(nghttp2_session* handle,
                                    uint8_t flags,
                                    void* user_data) {
   Http2Session* session = static_cast<Http2Session*>(user_data);
+  session->statistics_.header_bytes_received +=
+      nghttp2_rcbuf_get_buf(name).len + nghttp2_rcbuf_get_buf(value).len;
   int32_t id = GetFrameID(frame);
   Http2Stream* stream = session->FindStream(id);
   CHECK_NOT_NULL(stream);
@@ -892,6 +991,19 @@ int Http2Session::OnFrameSent(nghttp2_session* handle,
                               void* user_data) {
   Http2Session* session = static_cast<Http2Session*>(user_data);
   session->statistics_.frame_sent += 1;
+  // Account for the size of the HPACK encoded header block, i.e. the frame
+  // payload without padding and the fields that precede the block.
+  switch (frame->hd.type) {
+    case NGHTTP2_HEADERS:
+      session->statistics_.header_block_bytes_sent +=
+          frame->hd.length - frame->headers.padlen -
+          (frame->hd.flags & NGHTTP2_FLAG_PRIORITY ? 5 : 0);
+      break;
+    case NGHTTP2_PUSH_PROMISE:
+      session->statistics_.header_block_bytes_sent +=
+          frame->hd.length - frame->push_promise.padlen - 4;
+      break;
+  }
   return 0;
 }
 
@@ -907,6 +1019,7 @@ int Http2Session::OnStreamClose(nghttp2_session* handle,
   Local<Context> context = env->context();
   Context::Scope context_scope(context);
   DEBUG_HTTP2SESSION2(session, "stream %d closed with code: %d", id, code);
+  session->FlushPendingReads();
   Http2Stream* stream = session->FindStream(id);
   // Intentionally ignore the callback if the stream does not exist or has
   // already been destroyed
@@ -997,8 +1110,14 @@ int Http2Session::OnDataChunkReceived(nghttp2_session* handle,
         memcpy(buf.base, data, avail);
       data += avail;
       len -= avail;
+      size_t pending_reads = session->pending_reads_.size();
       stream->EmitRead(avail, buf);
 
+      // If the chunk was only queued for a batched delivery, JS has not seen
+      // it yet, and FlushPendingReads() tells nghttp2 about it once it has.
+      if (session->pending_reads_.size() != pending_reads)
+        continue;
+
       // If the stream owner (e.g. the JS Http2Stream) wants more data, just
       // tell nghttp2 that all data has been consumed. Otherwise, defer until
       // more data is being requested.
@@ -1077,6 +1196,7 @@ void Http2StreamListener::OnStreamRead(ssize_t nread, const uv_buf_t& buf) {
   Context::Scope context_scope(env->context());
 
   if (nread < 0) {
+    session->FlushPendingReads();
     PassReadErrorToPreviousListener(nread);
     return;
   }
@@ -1092,6 +1212,13 @@ void Http2StreamListener::OnStreamRead(ssize_t nread, const uv_buf_t& buf) {
   CHECK_LE(offset, session->stream_buf_.len);
   CHECK_LE(offset + buf.len, session->stream_buf_.len);
 
+  if (session->batch_reads_) {
+    session->pending_reads_.push_back(
+        Http2Session::PendingRead { stream->id(), offset,
+                                    static_cast<size_t>(nread) });
+    return;
+  }
+
   Local<Object> buffer =
       Buffer::New(env, session->stream_buf_ab_, offset, nread).ToLocalChecked();
 
@@ -1110,6 +1237,7 @@ void Http2Session::HandleHeadersFrame(const nghttp2_frame* frame) {
 
   int32_t id = GetFrameID(frame);
   DEBUG_HTTP2SESSION2(this, "handle headers frame for stream %d", id);
+  FlushPendingReads();
   Http2Stream* stream = FindStream(id);
 
   // If the stream has already been destroyed, ignore.
@@ -1215,6 +1343,7 @@ void Http2Session::HandleGoawayFrame(const nghttp2_frame* frame) {
 
   nghttp2_goaway goaway_frame = frame->goaway;
   DEBUG_HTTP2SESSION(this, "handling goaway frame");
+  FlushPendingReads();
 
   Local<Value> argv[3] = {
     Integer::NewFromUnsigned(isolate, goaway_frame.error_code),
@@ -1407,6 +1536,18 @@ void Http2Session::CopyDataIntoOutgoing(const uint8_t* src, size_t src_length) {
   outgoing_storage_.resize(offset + src_length);
   memcpy(&outgoing_storage_[offset], src, src_length);
 
+  // Copied chunks are laid out back to back in outgoing_storage_, so if the
+  // previous chunk was copied as well, extend it rather than adding another
+  // entry. This keeps e.g. a DATA frame header and its padding length byte,
+  // or a run of small control frames, in a single iovec of the final writev.
+  if (!outgoing_buffers_.empty()) {
+    nghttp2_stream_write& last = outgoing_buffers_.back();
+    if (last.buf.base == nullptr && last.req_wrap == nullptr) {
+      last.buf.len += src_length;
+      return;
+    }
+  }
+
   // Store with a base of `nullptr` initially, since future resizes
   // of the outgoing_buffers_ vector may invalidate the pointer.
   // The correct base pointers will be set later, before writing to the
@@ -1451,6 +1592,15 @@ uint8_t Http2Session::SendPendingData() {
 
   CHECK_NE(src_length, NGHTTP2_ERR_NOMEM);
 
+  // Precompiled header blocks are only referenced by HEADERS and PUSH_PROMISE
+  // frames that have not been serialized yet. Once nghttp2 has no frames
+  // queued any more, the blocks can be released, and are freed as soon as
+  // their JS objects have been garbage collected too.
+  if (!header_blocks_.empty() &&
+      nghttp2_session_get_outbound_queue_size(session_) == 0) {
+    header_blocks_.clear();
+  }
+
   if (stream_ == nullptr) {
     // It would seem nice to bail out earlier, but `nghttp2_session_mem_send()`
     // does take care of things like closing the individual streams after
@@ -1565,6 +1715,7 @@ Http2Stream* Http2Session::SubmitRequest(
   DEBUG_HTTP2SESSION(this, "submitting request");
   Http2Scope h2scope(this);
   Http2Stream* stream = nullptr;
+  PrepareOutgoingHeaders(nva, len);
   Http2Stream::Provider::Stream prov(options);
   *ret = nghttp2_submit_request(session_, prispec, nva, len, *prov, nullptr);
   CHECK_NE(*ret, NGHTTP2_ERR_NOMEM);
@@ -1617,6 +1768,7 @@ void Http2Session::OnStreamRead(ssize_t nread, const uv_buf_t& buf) {
 
     statistics_.data_received += nread;
     ssize_t ret = Write(&stream_buf_, 1);
+    FlushPendingReads();
 
     if (ret < 0) {
       DEBUG_HTTP2SESSION2(this, "fatal error receiving data: %d", ret);
@@ -1638,6 +1790,61 @@ void Http2Session::OnStreamRead(ssize_t nread, const uv_buf_t& buf) {
   stream_buf_ = uv_buf_init(nullptr, 0);
 }
 
+void Http2Session::FlushPendingReads() {
+  if (pending_reads_.empty())
+    return;
+  CHECK(!stream_buf_ab_.IsEmpty());
+
+  std::vector<PendingRead> reads;
+  reads.swap(pending_reads_);
+
+  Isolate* isolate = env()->isolate();
+  HandleScope handle_scope(isolate);
+  Local<Context> context = env()->context();
+  Context::Scope context_scope(context);
+
+  // handles[i] is the Http2Stream handle that receives the chunk that starts
+  // at ranges[2 * i] in the read buffer and is ranges[2 * i + 1] bytes long.
+  Local<Array> handles = Array::New(isolate);
+  Local<ArrayBuffer> ranges_buffer =
+      ArrayBuffer::New(isolate, reads.size() * 2 * sizeof(uint32_t));
+  uint32_t* ranges =
+      static_cast<uint32_t*>(ranges_buffer->GetContents().Data());
+  uint32_t count = 0;
+  for (const PendingRead& read : reads) {
+    Http2Stream* stream = FindStream(read.id);
+    if (stream == nullptr || stream->IsDestroyed())
+      continue;
+    handles->Set(context, count, stream->object()).FromJust();
+    ranges[2 * count] = read.offset;
+    ranges[2 * count + 1] = read.length;
+    count++;
+  }
+  if (count == 0)
+    return;
+
+  Local<Value> argv[] = {
+    stream_buf_ab_,
+    handles,
+    Uint32Array::New(ranges_buffer, 0, 2 * count)
+  };
+  MakeCallback(env()->onreadbatch_string(), arraysize(argv), argv);
+
+  // Now that JS has seen the data, tell nghttp2 that it has been consumed,
+  // unless the stream was paused while the batch was being delivered.
+  if (IsDestroyed())
+    return;
+  for (const PendingRead& read : reads) {
+    Http2Stream* stream = FindStream(read.id);
+    if (stream == nullptr || stream->IsDestroyed())
+      continue;
+    if (stream->IsReading())
+      nghttp2_session_consume_stream(session_, read.id, read.length);
+    else
+      stream->inbound_consumed_data_while_paused_ += read.length;
+  }
+}
+
 bool Http2Session::HasWritesOnSocketForStream(Http2Stream* stream) {
   for (const nghttp2_stream_write& wr : outgoing_buffers_) {
     if (wr.req_wrap != nullptr && wr.req_wrap->stream() == stream)
@@ -1794,6 +2001,7 @@ int Http2Stream::SubmitResponse(nghttp2_nv* nva, size_t len, int options) {
   if (!IsWritable())
     options |= STREAM_OPTION_EMPTY_PAYLOAD;
 
+  session_->PrepareOutgoingHeaders(nva, len);
   Http2Stream::Provider::Stream prov(this, options);
   int ret = nghttp2_submit_response(**session_, id_, nva, len, *prov);
   CHECK_NE(ret, NGHTTP2_ERR_NOMEM);
@@ -1806,6 +2014,7 @@ int Http2Stream::SubmitInfo(nghttp2_nv* nva, size_t len) {
   CHECK(!this->IsDestroyed());
   Http2Scope h2scope(this);
   DEBUG_HTTP2STREAM2(this, "sending %d informational headers", len);
+  session_->PrepareOutgoingHeaders(nva, len);
   int ret = nghttp2_submit_headers(**session_,
                                    NGHTTP2_FLAG_NONE,
                                    id_, nullptr,
@@ -1838,6 +2047,7 @@ int Http2Stream::SubmitTrailers(nghttp2_nv* nva, size_t len) {
     Http2Stream::Provider::Stream prov(this, 0);
     ret = nghttp2_submit_data(**session_, NGHTTP2_FLAG_END_STREAM, id_, *prov);
   } else {
+    session_->PrepareOutgoingHeaders(nva, len);
     ret = nghttp2_submit_trailer(**session_, id_, nva, len);
   }
   CHECK_NE(ret, NGHTTP2_ERR_NOMEM);
@@ -1894,6 +2104,7 @@ Http2Stream* Http2Stream::SubmitPushPromise(nghttp2_nv* nva,
   CHECK(!this->IsDestroyed());
   Http2Scope h2scope(this);
   DEBUG_HTTP2STREAM(this, "sending push promise");
+  session_->PrepareOutgoingHeaders(nva, len);
   *ret = nghttp2_submit_push_promise(**session_, NGHTTP2_FLAG_NONE,
                                      id_, nva, len, nullptr);
   CHECK_NE(*ret, NGHTTP2_ERR_NOMEM);
@@ -2323,6 +2534,24 @@ void Http2Session::UpdateChunksSent(const FunctionCallbackInfo<Value>& args) {
   args.GetReturnValue().Set(length);
 }
 
+// Sets the names of headers that are always sent with NGHTTP2_NV_FLAG_NO_INDEX
+// on this session. The names are expected to be lower-case.
+void Http2Session::SetSensitiveHeaders(
+    const FunctionCallbackInfo<Value>& args) {
+  Environment* env = Environment::GetCurrent(args);
+  Http2Session* session;
+  ASSIGN_OR_RETURN_UNWRAP(&session, args.Holder());
+  CHECK(args[0]->IsArray());
+  Local<Array> names = args[0].As<Array>();
+
+  session->sensitive_headers_.clear();
+  for (uint32_t i = 0; i < names->Length(); i++) {
+    Local<Value> name = names->Get(env->context(), i).ToLocalChecked();
+    CHECK(name->IsString());
+    session->sensitive_headers_.emplace_back(*Utf8Value(env->isolate(), name));
+  }
+}
+
 // Submits an RST_STREAM frame effectively closing the Http2Stream. Note that
 // this *WILL* alter the state of the stream, causing the OnStreamClose
 // callback to the triggered.
@@ -2349,9 +2578,10 @@ void Http2Stream::Respond(const FunctionCallbackInfo<Value>& args) {
   int options = args[1]->IntegerValue(context).ToChecked();
 
   Headers list(isolate, context, headers);
+  CombinedHeaders nva(&list, GetHeaderBlock(stream->session(), args[2]));
 
   args.GetReturnValue().Set(
-      stream->SubmitResponse(*list, list.length(), options));
+      stream->SubmitResponse(*nva, nva.length(), options));
   DEBUG_HTTP2STREAM(stream, "response submitted");
 }
 
@@ -2421,11 +2651,12 @@ void Http2Stream::PushPromise(const FunctionCallbackInfo<Value>& args) {
   int options = args[1]->IntegerValue(context).ToChecked();
 
   Headers list(isolate, context, headers);
+  CombinedHeaders nva(&list, GetHeaderBlock(parent->session(), args[2]));
 
   DEBUG_HTTP2STREAM(parent, "creating push promise");
 
   int32_t ret = 0;
-  Http2Stream* stream = parent->SubmitPushPromise(*list, list.length(),
+  Http2Stream* stream = parent->SubmitPushPromise(*nva, nva.length(),
                                                   &ret, options);
   if (ret <= 0) {
     DEBUG_HTTP2STREAM2(parent, "failed to create push stream: %d", ret);
@@ -2739,6 +2970,16 @@ void Initialize(Local<Object> target,
               FIXED_ONE_BYTE_STRING(env->isolate(), "Http2Stream"),
               stream->GetFunction()).FromJust();
 
+  Local<String> headerBlockClassName =
+      FIXED_ONE_BYTE_STRING(isolate, "Http2HeaderBlock");
+  Local<FunctionTemplate> header_block =
+      env->NewFunctionTemplate(Http2HeaderBlock::New);
+  header_block->SetClassName(headerBlockClassName);
+  header_block->InstanceTemplate()->SetInternalFieldCount(1);
+  target->Set(context,
+              headerBlockClassName,
+              header_block->GetFunction()).FromJust();
+
   Local<FunctionTemplate> session =
       env->NewFunctionTemplate(Http2Session::New);
   session->SetClassName(http2SessionClassName);
@@ -2755,6 +2996,8 @@ void Initialize(Local<Object> target,
                       Http2Session::SetNextStreamID);
   env->SetProtoMethod(session, "updateChunksSent",
                       Http2Session::UpdateChunksSent);
+  env->SetProtoMethod(session, "setSensitiveHeaders",
+                      Http2Session::SetSensitiveHeaders);
   env->SetProtoMethod(session, "refreshState", Http2Session::RefreshState);
   env->SetProtoMethod(
       session, "localSettings",
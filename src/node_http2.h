@@ -9,7 +9,11 @@
 #include "stream_base-inl.h"
 #include "string_bytes.h"
 
+#include <memory>
 #include <queue>
+#include <string>
+#include <unordered_set>
+#include <vector>
 
 namespace node {
 namespace http2 {
@@ -443,6 +447,7 @@ static const size_t kAllocBufferSize = 4 * (16384 + 9);
 typedef uint32_t(*get_setting)(nghttp2_session* session,
                                nghttp2_settings_id id);
 
+class Headers;
 class Http2Session;
 class Http2Stream;
 
@@ -516,6 +521,14 @@ class Http2Options {
     return max_session_memory_;
   }
 
+  void SetBatchReads(bool batch_reads) {
+    batch_reads_ = batch_reads;
+  }
+
+  bool GetBatchReads() const {
+    return batch_reads_;
+  }
+
  private:
   nghttp2_option* options_;
   uint64_t max_session_memory_ = DEFAULT_MAX_SESSION_MEMORY;
@@ -523,6 +536,7 @@ class Http2Options {
   padding_strategy_type padding_strategy_ = PADDING_STRATEGY_NONE;
   size_t max_outstanding_pings_ = DEFAULT_MAX_PINGS;
   size_t max_outstanding_settings_ = DEFAULT_MAX_SETTINGS;
+  bool batch_reads_ = false;
 };
 
 class Http2Priority {
@@ -799,6 +813,13 @@ class Http2Session : public AsyncWrap, public StreamListener {
 
   bool Ping(v8::Local<v8::Function> function);
 
+  // Keeps a precompiled header block alive until the frame it was submitted
+  // with has been serialized, because nghttp2 refers to its contents until
+  // then. SendPendingData() releases the blocks once nothing is queued.
+  void RetainHeaderBlock(const std::shared_ptr<Headers>& headers) {
+    header_blocks_.insert(headers);
+  }
+
   uint8_t SendPendingData();
 
   // Submits a new request. If the request is a success, assigned
@@ -870,6 +891,7 @@ class Http2Session : public AsyncWrap, public StreamListener {
   static void SetNextStreamID(const FunctionCallbackInfo<Value>& args);
   static void Goaway(const FunctionCallbackInfo<Value>& args);
   static void UpdateChunksSent(const FunctionCallbackInfo<Value>& args);
+  static void SetSensitiveHeaders(const FunctionCallbackInfo<Value>& args);
   static void RefreshState(const FunctionCallbackInfo<Value>& args);
   static void Ping(const FunctionCallbackInfo<Value>& args);
   static void AltSvc(const FunctionCallbackInfo<Value>& args);
@@ -925,10 +947,23 @@ class Http2Session : public AsyncWrap, public StreamListener {
     int32_t stream_count;
     size_t max_concurrent_streams;
     double stream_average_duration;
+    // Header bytes before and after HPACK compression. The uncompressed size
+    // is the sum of the lengths of all names and values.
+    uint64_t header_bytes_sent;
+    uint64_t header_block_bytes_sent;
+    uint64_t header_bytes_received;
+    // Sizes of the HPACK dynamic tables when the session is closed.
+    size_t deflate_dynamic_table_size;
+    size_t inflate_dynamic_table_size;
   };
 
   Statistics statistics_ = {};
 
+  // Called for every header list that is submitted on this session. Marks
+  // the headers that were passed to setSensitiveHeaders() as never to be
+  // indexed, and accounts for the uncompressed size of the list.
+  void PrepareOutgoingHeaders(nghttp2_nv* nva, size_t len);
+
  private:
   // Frame Padding Strategies
   ssize_t OnDWordAlignedPadding(size_t frameLength,
@@ -1061,6 +1096,31 @@ class Http2Session : public AsyncWrap, public StreamListener {
   std::vector<uint8_t> outgoing_storage_;
   std::vector<int32_t> pending_rst_streams_;
 
+  // Lower-case names of headers that are always sent with
+  // NGHTTP2_NV_FLAG_NO_INDEX, so that they never enter the HPACK dynamic
+  // table of either peer.
+  std::vector<std::string> sensitive_headers_;
+
+  // Precompiled header blocks used by frames that nghttp2 may not have
+  // serialized yet. The blocks may be shared with other sessions.
+  std::unordered_set<std::shared_ptr<Headers>> header_blocks_;
+
+  // When batch_reads_ is set, DATA chunks received during a single read from
+  // the socket are collected here and handed to JS in one onreadbatch() call
+  // instead of one onread() call per chunk.
+  struct PendingRead {
+    int32_t id;
+    size_t offset;  // Into stream_buf_.
+    size_t length;
+  };
+  bool batch_reads_ = false;
+  std::vector<PendingRead> pending_reads_;
+
+  // Delivers the collected DATA chunks to JS. This must happen before any
+  // other event that JS may observe for the same streams, e.g. trailers or
+  // the end of the stream, and before the current read buffer is released.
+  void FlushPendingReads();
+
   void CopyDataIntoOutgoing(const uint8_t* src, size_t src_length);
   void ClearOutgoing(int status);
 
@@ -1085,6 +1145,11 @@ class Http2SessionPerformanceEntry : public PerformanceEntry {
           stream_count_(stats.stream_count),
           max_concurrent_streams_(stats.max_concurrent_streams),
           stream_average_duration_(stats.stream_average_duration),
+          header_bytes_sent_(stats.header_bytes_sent),
+          header_block_bytes_sent_(stats.header_block_bytes_sent),
+          header_bytes_received_(stats.header_bytes_received),
+          deflate_dynamic_table_size_(stats.deflate_dynamic_table_size),
+          inflate_dynamic_table_size_(stats.inflate_dynamic_table_size),
           session_type_(type) { }
 
   uint64_t ping_rtt() const { return ping_rtt_; }
@@ -1095,6 +1160,15 @@ class Http2SessionPerformanceEntry : public PerformanceEntry {
   int32_t stream_count() const { return stream_count_; }
   size_t max_concurrent_streams() const { return max_concurrent_streams_; }
   double stream_average_duration() const { return stream_average_duration_; }
+  uint64_t header_bytes_sent() const { return header_bytes_sent_; }
+  uint64_t header_block_bytes_sent() const { return header_block_bytes_sent_; }
+  uint64_t header_bytes_received() const { return header_bytes_received_; }
+  size_t deflate_dynamic_table_size() const {
+    return deflate_dynamic_table_size_;
+  }
+  size_t inflate_dynamic_table_size() const {
+    return inflate_dynamic_table_size_;
+  }
   nghttp2_session_type type() const { return session_type_; }
 
   void Notify(Local<Value> obj) {
@@ -1110,6 +1184,11 @@ class Http2SessionPerformanceEntry : public PerformanceEntry {
   int32_t stream_count_;
   size_t max_concurrent_streams_;
   double stream_average_duration_;
+  uint64_t header_bytes_sent_;
+  uint64_t header_block_bytes_sent_;
+  uint64_t header_bytes_received_;
+  size_t deflate_dynamic_table_size_;
+  size_t inflate_dynamic_table_size_;
   nghttp2_session_type session_type_;
 };
 
@@ -1279,11 +1358,51 @@ class Headers {
     return count_;
   }
 
+  // Tells nghttp2 not to copy the header names and values. The caller must
+  // then keep this object alive until all frames it was used for are sent.
+  void SetNoCopy();
+
  private:
   size_t count_;
   MaybeStackBuffer<char, 3000> buf_;
 };
 
+// A list of headers that is parsed once and can then be sent along with any
+// number of responses and push promises, without being copied or validated
+// again for each of them.
+class Http2HeaderBlock : public BaseObject {
+ public:
+  Http2HeaderBlock(Environment* env,
+                   Local<Object> wrap,
+                   Local<Array> headers);
+
+  static void New(const FunctionCallbackInfo<Value>& args);
+
+  const std::shared_ptr<Headers>& headers() const { return headers_; }
+
+ private:
+  std::shared_ptr<Headers> headers_;
+};
+
+// The nghttp2_nv entries of a per-request header list followed by those of
+// an optional precompiled header block. Only the nghttp2_nv structs are
+// copied, never the header names and values.
+class CombinedHeaders {
+ public:
+  CombinedHeaders(Headers* list, Http2HeaderBlock* block);
+
+  nghttp2_nv* operator*() {
+    return *nva_;
+  }
+
+  size_t length() const {
+    return nva_.length();
+  }
+
+ private:
+  MaybeStackBuffer<nghttp2_nv, 32> nva_;
+};
+
 }  // namespace http2
 }  // namespace node
 
@@ -51,6 +51,7 @@ namespace http2 {
     IDX_OPTIONS_MAX_OUTSTANDING_PINGS,
     IDX_OPTIONS_MAX_OUTSTANDING_SETTINGS,
     IDX_OPTIONS_MAX_SESSION_MEMORY,
+    IDX_OPTIONS_BATCH_READS,
     IDX_OPTIONS_FLAGS
   };
 
@@ -81,6 +82,11 @@ namespace http2 {
     IDX_SESSION_STATS_DATA_SENT,
     IDX_SESSION_STATS_DATA_RECEIVED,
     IDX_SESSION_STATS_MAX_CONCURRENT_STREAMS,
+    IDX_SESSION_STATS_HEADER_BYTES_SENT,
+    IDX_SESSION_STATS_HEADER_BLOCK_BYTES_SENT,
+    IDX_SESSION_STATS_HEADER_BYTES_RECEIVED,
+    IDX_SESSION_STATS_DEFLATE_DYNAMIC_TABLE_SIZE,
+    IDX_SESSION_STATS_INFLATE_DYNAMIC_TABLE_SIZE,
     IDX_SESSION_STATS_COUNT
   };
 
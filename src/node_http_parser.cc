@@ -32,6 +32,7 @@
 
 #include <stdlib.h>  // free()
 #include <string.h>  // strdup()
+#include <vector>
 
 // This is a binding to http_parser (https://github.com/nodejs/http-parser)
 // The goal is to decouple sockets from parsing for more javascript-level
@@ -53,15 +54,19 @@ using v8::Boolean;
 using v8::Context;
 using v8::EscapableHandleScope;
 using v8::Exception;
+using v8::False;
 using v8::Function;
 using v8::FunctionCallbackInfo;
 using v8::FunctionTemplate;
 using v8::HandleScope;
 using v8::Integer;
+using v8::Isolate;
 using v8::Local;
 using v8::MaybeLocal;
+using v8::NewStringType;
 using v8::Object;
 using v8::String;
+using v8::True;
 using v8::Uint32;
 using v8::Undefined;
 using v8::Value;
@@ -71,6 +76,13 @@ const uint32_t kOnHeadersComplete = 1;
 const uint32_t kOnBody = 2;
 const uint32_t kOnMessageComplete = 3;
 const uint32_t kOnExecute = 4;
+const uint32_t kOnMessages = 5;
+
+// Every request passed to the kOnMessages callback takes up this many slots
+// of its argument: versionMajor, versionMinor, headers, method, url,
+// shouldKeepAlive and whether the request is complete. This needs to be kept
+// in sync with `parserOnMessages` in lib/_http_common.js.
+const size_t kBatchEntrySize = 7;
 
 
 // helper class for the Parser
@@ -235,6 +247,14 @@ class Parser : public AsyncWrap, public StreamListener {
       A_MAX
     };
 
+    // Requests whose headers arrived in one piece are queued up and handed
+    // to JS land together, see FlushBatch().
+    if (batching_ && !have_flushed_ && !parser_.upgrade)
+      return QueueRequest();
+
+    if (FlushBatch() != 0)
+      return -1;
+
     Local<Value> argv[A_MAX];
     Local<Object> obj = object();
     Local<Value> cb = obj->Get(kOnHeadersComplete);
@@ -296,6 +316,9 @@ class Parser : public AsyncWrap, public StreamListener {
 
 
   int on_body(const char* at, size_t length) {
+    if (FlushBatch() != 0)
+      return -1;
+
     EscapableHandleScope scope(env()->isolate());
 
     Local<Object> obj = object();
@@ -333,6 +356,16 @@ class Parser : public AsyncWrap, public StreamListener {
 
 
   int on_message_complete() {
+    if (batch_message_pending_ && num_fields_ == 0) {
+      // The queued request had no body, it is complete already.
+      batch_.back() = True(env()->isolate());
+      batch_message_pending_ = false;
+      return 0;
+    }
+
+    if (FlushBatch() != 0)
+      return -1;
+
     HandleScope scope(env()->isolate());
 
     if (num_fields_)
@@ -435,6 +468,7 @@ class Parser : public AsyncWrap, public StreamListener {
     parser->got_exception_ = false;
 
     int rv = http_parser_execute(&(parser->parser_), &settings, nullptr, 0);
+    parser->FlushBatch();
 
     if (parser->got_exception_)
       return;
@@ -586,10 +620,16 @@ class Parser : public AsyncWrap, public StreamListener {
     current_buffer_len_ = len;
     current_buffer_data_ = data;
     got_exception_ = false;
+    batching_ = parser_.type == HTTP_REQUEST &&
+                object()->Get(env()->context(),
+                              kOnMessages).ToLocalChecked()->IsFunction();
 
     size_t nparsed =
       http_parser_execute(&parser_, &settings, data, len);
 
+    FlushBatch();
+    batching_ = false;
+
     Save();
 
     // Unassign the 'buffer_' variable
@@ -643,6 +683,9 @@ class Parser : public AsyncWrap, public StreamListener {
 
   // spill headers and request path to JS land
   void Flush() {
+    if (FlushBatch() != 0)
+      return;
+
     HandleScope scope(env()->isolate());
 
     Local<Object> obj = object();
@@ -668,6 +711,62 @@ class Parser : public AsyncWrap, public StreamListener {
   }
 
 
+  // Adds the request whose headers were just parsed to the batch. The values
+  // live in the handle scope of Execute(), which flushes the batch before
+  // returning.
+  int QueueRequest() {
+    Isolate* isolate = env()->isolate();
+    batch_.push_back(Integer::New(isolate, parser_.http_major));
+    batch_.push_back(Integer::New(isolate, parser_.http_minor));
+    batch_.push_back(CreateHeaders());
+    batch_.push_back(Uint32::NewFromUnsigned(isolate, parser_.method));
+    batch_.push_back(url_.ToString(env()));
+    batch_.push_back(Boolean::New(isolate, http_should_keep_alive(&parser_)));
+    batch_.push_back(False(isolate));
+    batch_message_pending_ = true;
+
+    num_fields_ = 0;
+    num_values_ = 0;
+    return 0;
+  }
+
+
+  // Passes all queued requests to JS land in a single call. This has to
+  // happen before any other callback is made, so that JS land sees the
+  // same sequence of events as without batching.
+  int FlushBatch() {
+    if (batch_.empty())
+      return 0;
+    CHECK_EQ(batch_.size() % kBatchEntrySize, 0);
+
+    HandleScope scope(env()->isolate());
+    Local<Context> context = env()->context();
+    Local<Array> messages = Array::New(env()->isolate(), batch_.size());
+    for (size_t i = 0; i < batch_.size(); i++)
+      messages->Set(context, i, batch_[i]).FromJust();
+    batch_.clear();
+    batch_message_pending_ = false;
+
+    Local<Value> cb = object()->Get(context, kOnMessages).ToLocalChecked();
+    if (!cb->IsFunction())
+      return 0;
+
+    Environment::AsyncCallbackScope callback_scope(env());
+
+    Local<Value> argv[] = { messages };
+    MaybeLocal<Value> r = MakeCallback(cb.As<Function>(),
+                                       arraysize(argv),
+                                       argv);
+
+    if (r.IsEmpty()) {
+      got_exception_ = true;
+      return -1;
+    }
+
+    return 0;
+  }
+
+
   void Init(enum http_parser_type type) {
     http_parser_init(&parser_, type);
     url_.Reset();
@@ -676,6 +775,9 @@ class Parser : public AsyncWrap, public StreamListener {
     num_values_ = 0;
     have_flushed_ = false;
     got_exception_ = false;
+    batching_ = false;
+    batch_message_pending_ = false;
+    batch_.clear();
   }
 
 
@@ -688,6 +790,9 @@ class Parser : public AsyncWrap, public StreamListener {
   size_t num_values_;
   bool have_flushed_;
   bool got_exception_;
+  bool batching_;
+  bool batch_message_pending_;
+  std::vector<Local<Value>> batch_;
   Local<Object> current_buffer_;
   size_t current_buffer_len_;
   char* current_buffer_data_;
@@ -723,6 +828,138 @@ const struct http_parser_settings Parser::settings = {
 };
 
 
+// tchar as defined by RFC 7230, section 3.2.6.
+const uint8_t kTokenChars[256] = {
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 1, 0, 1, 1, 1, 1, 1, 0, 0, 1, 1, 0, 1, 1, 0,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0,
+  0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 0, 1, 0,
+  // Everything above 0x7f is rejected.
+};
+
+
+inline bool IsValidHeaderName(const uint8_t* name, size_t length) {
+  if (length == 0)
+    return false;
+  for (size_t i = 0; i < length; i++) {
+    if (!kTokenChars[name[i]])
+      return false;
+  }
+  return true;
+}
+
+
+// field-vchar, SP and HTAB, see RFC 7230, section 3.2.
+inline bool IsValidHeaderValue(const uint8_t* value, size_t length) {
+  for (size_t i = 0; i < length; i++) {
+    const uint8_t c = value[i];
+    if ((c < 0x20 && c != '\t') || c == 0x7f)
+      return false;
+  }
+  return true;
+}
+
+
+// Protects against response splitting by removing CR and LF, together with
+// any whitespace that follows them, from a header value in place. Returns the
+// new length of the value.
+inline size_t StripLineBreaks(uint8_t* value, size_t length) {
+  size_t out = 0;
+  size_t i = 0;
+  while (i < length) {
+    if (value[i] != '\r' && value[i] != '\n') {
+      value[out++] = value[i++];
+      continue;
+    }
+    while (i < length && (value[i] == '\r' || value[i] == '\n'))
+      i++;
+    while (i < length && (value[i] == ' ' || value[i] == '\t'))
+      i++;
+  }
+  return out;
+}
+
+
+inline bool ContainsOnlyOneByte(Local<String> string) {
+  return string->IsOneByte() || string->ContainsOnlyOneByte();
+}
+
+
+// Serializes the head of an HTTP/1 message, given its first line and a flat
+// array of alternating header names and values, into one flat latin1 string.
+//
+// If `validate` is set, header names have to be tokens and header values may
+// only contain field-vchars, spaces and tabs. The index of the first name
+// whose entry does not conform is returned instead of a string in that case,
+// so that JS land can throw the appropriate error.
+void SerializeHeaders(const FunctionCallbackInfo<Value>& args) {
+  Environment* env = Environment::GetCurrent(args);
+  Local<Context> context = env->context();
+
+  CHECK(args[0]->IsString());
+  CHECK(args[1]->IsArray());
+  Local<String> first_line = args[0].As<String>();
+  Local<Array> fields = args[1].As<Array>();
+  const bool validate = args[2]->IsTrue();
+  const uint32_t count = fields->Length();
+  CHECK_EQ(count % 2, 0);
+
+  MaybeStackBuffer<Local<String>, 64> strings(count);
+  size_t length = first_line->Length() + 2;
+  for (uint32_t i = 0; i < count; i++) {
+    Local<Value> field;
+    if (!fields->Get(context, i).ToLocal(&field))
+      return;
+    const bool is_name = i % 2 == 0;
+    if (validate &&
+        (is_name ? !field->IsString() : field->IsUndefined())) {
+      return args.GetReturnValue().Set(i & ~1);
+    }
+    if (!field->ToString(context).ToLocal(&strings[i]))
+      return;
+    if (validate && !ContainsOnlyOneByte(strings[i]))
+      return args.GetReturnValue().Set(i & ~1);
+    // Names are followed by ': ' and values by CRLF.
+    length += strings[i]->Length() + 2;
+  }
+
+  MaybeStackBuffer<uint8_t, 1024> head(length);
+  uint8_t* out = *head;
+  out += first_line->WriteOneByte(out, 0, -1, String::NO_NULL_TERMINATION);
+  for (uint32_t i = 0; i < count; i += 2) {
+    uint8_t* name = out;
+    size_t name_length = strings[i]->WriteOneByte(name, 0, -1,
+                                                  String::NO_NULL_TERMINATION);
+    uint8_t* value = name + name_length + 2;
+    size_t value_length = strings[i + 1]->WriteOneByte(
+        value, 0, -1, String::NO_NULL_TERMINATION);
+    if (validate) {
+      if (!IsValidHeaderName(name, name_length) ||
+          !IsValidHeaderValue(value, value_length)) {
+        return args.GetReturnValue().Set(i);
+      }
+    } else {
+      value_length = StripLineBreaks(value, value_length);
+    }
+    name[name_length] = ':';
+    name[name_length + 1] = ' ';
+    out = value + value_length;
+    *out++ = '\r';
+    *out++ = '\n';
+  }
+  *out++ = '\r';
+  *out++ = '\n';
+
+  args.GetReturnValue().Set(
+      String::NewFromOneByte(env->isolate(), *head, NewStringType::kNormal,
+                             out - *head).ToLocalChecked());
+}
+
+
 void Initialize(Local<Object> target,
                 Local<Value> unused,
                 Local<Context> context,
@@ -746,6 +983,8 @@ void Initialize(Local<Object> target,
          Integer::NewFromUnsigned(env->isolate(), kOnMessageComplete));
   t->Set(FIXED_ONE_BYTE_STRING(env->isolate(), "kOnExecute"),
          Integer::NewFromUnsigned(env->isolate(), kOnExecute));
+  t->Set(FIXED_ONE_BYTE_STRING(env->isolate(), "kOnMessages"),
+         Integer::NewFromUnsigned(env->isolate(), kOnMessages));
 
   Local<Array> methods = Array::New(env->isolate());
 #define V(num, name, string)                                                  \
@@ -768,6 +1007,8 @@ void Initialize(Local<Object> target,
 
   target->Set(FIXED_ONE_BYTE_STRING(env->isolate(), "HTTPParser"),
               t->GetFunction());
+
+  env->SetMethod(target, "serializeHeaders", SerializeHeaders);
 }
 
 }  // anonymous namespace
@@ -102,6 +102,7 @@ struct sockaddr;
 // node is built as static library. No need to depends on the
 // __attribute__((constructor)) like mechanism in GCC.
 #define NODE_BUILTIN_STANDARD_MODULES(V)                                      \
+    V(app_archive)                                                            \
     V(async_wrap)                                                             \
     V(buffer)                                                                 \
     V(cares_wrap)                                                             \
@@ -135,6 +136,7 @@ struct sockaddr;
     V(util)                                                                   \
     V(uv)                                                                     \
     V(v8)                                                                     \
+    V(websocket)                                                              \
     V(zlib)
 
 #define NODE_BUILTIN_MODULES(V)                                               \
@@ -312,10 +314,11 @@ v8::Maybe<bool> ProcessEmitDeprecationWarning(Environment* env,
                                               const char* warning,
                                               const char* deprecation_code);
 
-template <typename NativeT, typename V8T>
-v8::Local<v8::Value> FillStatsArray(AliasedBuffer<NativeT, V8T>* fields_ptr,
-                    const uv_stat_t* s, int offset = 0) {
-  AliasedBuffer<NativeT, V8T>& fields = *fields_ptr;
+// Writes the Environment::kFsStatsFieldsLength fields of `s` to `fields`,
+// starting at `offset`. `fields` can be anything that is indexed like an
+// array of numbers, e.g. an AliasedBuffer or a double*.
+template <typename Fields>
+void FillStatsFields(Fields&& fields, const uv_stat_t* s, int offset = 0) {
   fields[offset + 0] = s->st_dev;
   fields[offset + 1] = s->st_mode;
   fields[offset + 2] = s->st_nlink;
@@ -347,7 +350,12 @@ v8::Local<v8::Value> FillStatsArray(AliasedBuffer<NativeT, V8T>* fields_ptr,
   X(12, ctim)
   X(13, birthtim)
 #undef X
+}
 
+template <typename NativeT, typename V8T>
+v8::Local<v8::Value> FillStatsArray(AliasedBuffer<NativeT, V8T>* fields_ptr,
+                    const uv_stat_t* s, int offset = 0) {
+  FillStatsFields(*fields_ptr, s, offset);
   return fields_ptr->GetJSArray();
 }
 
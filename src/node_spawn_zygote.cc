@@ -0,0 +1,862 @@
+#include "node_spawn_zygote.h"
+#include "node_internals.h"
+#include "env-inl.h"
+#include "util-inl.h"
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#ifdef __POSIX__
+#include <errno.h>
+#include <fcntl.h>
+#include <grp.h>
+#include <limits.h>  // PATH_MAX
+#include <poll.h>
+#include <signal.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#ifdef __APPLE__
+#include <crt_externs.h>
+#define environ (*_NSGetEnviron())
+#else
+extern char** environ;
+#endif
+#endif  // __POSIX__
+
+namespace node {
+namespace zygote {
+
+#ifdef __POSIX__
+
+namespace {
+
+// Children with more stdio file descriptors than this are spawned with
+// uv_spawn(). It keeps requests well below the SCM_RIGHTS limit.
+constexpr uint32_t kMaxStdio = 64;
+
+enum RequestType : uint32_t {
+  kSpawnRequest,
+  kKillRequest
+};
+
+// A spawn request is followed by `payload_size` bytes: an int32_t for each
+// stdio file descriptor of the child, which is the index of the descriptor
+// that was passed along with the request or -1 to ignore it, and then the
+// NUL-terminated file, cwd, arguments and environment.
+//
+// The zygote's working directory and umask are those that node had at
+// startup, so the child is always given node's current ones.
+//
+// Children are identified by an `id` that node picks for each of them, since
+// their pid may be reused once they have been reaped. A kill request sends
+// `signal` to the child with `id` and `pid`, and has no payload.
+struct Request {
+  uint64_t id;
+  uint32_t type;
+  int32_t pid;
+  int32_t signal;
+  uint32_t flags;
+  uint32_t uid;
+  uint32_t gid;
+  uint32_t umask;
+  uint32_t stdio_count;
+  uint32_t argc;
+  uint32_t envc;
+  uint32_t payload_size;
+};
+
+struct Reply {
+  int32_t pid;
+  int32_t err;  // A libuv error code.
+};
+
+struct ExitEvent {
+  int64_t exit_status;
+  uint64_t id;
+  int32_t term_signal;
+};
+
+struct Child {
+  ExitCallback cb;
+  void* data;
+  int pid;
+};
+
+// The parent's side. It is only used from the thread that started the
+// zygote, so that requests from different threads do not interleave.
+uv_thread_t main_thread;
+int request_fd = -1;
+int event_fd = -1;
+pid_t zygote_pid = 0;
+Environment* watcher_env = nullptr;
+uv_poll_t* watcher = nullptr;
+std::vector<char> pending_events;
+std::unordered_map<uint64_t, Child> children;
+uint64_t next_child_id = 1;
+
+// The zygote's side.
+int sigchld_fds[2] = { -1, -1 };
+// The ids of the children that have not been reaped yet, by pid. Only these
+// pids are known not to have been reused.
+std::unordered_map<pid_t, uint64_t> live_children;
+// Exit events that node has not read yet. The event socket is non-blocking
+// on this side, because node does not read it while it waits for the reply
+// to a request, so a blocking write could deadlock both.
+std::vector<char> unsent_events;
+
+
+void SetCloexec(int fd) {
+  int flags = fcntl(fd, F_GETFD);
+  if (flags != -1)
+    fcntl(fd, F_SETFD, flags | FD_CLOEXEC);
+}
+
+
+bool WriteAll(int fd, const void* data, size_t size) {
+  const char* p = static_cast<const char*>(data);
+  while (size > 0) {
+    ssize_t n = write(fd, p, size);
+    if (n == -1 && errno == EINTR)
+      continue;
+    if (n <= 0)
+      return false;
+    p += n;
+    size -= n;
+  }
+  return true;
+}
+
+
+bool ReadAll(int fd, void* data, size_t size) {
+  char* p = static_cast<char*>(data);
+  while (size > 0) {
+    ssize_t n = read(fd, p, size);
+    if (n == -1 && errno == EINTR)
+      continue;
+    if (n <= 0)
+      return false;
+    p += n;
+    size -= n;
+  }
+  return true;
+}
+
+
+// Runs in the child that the zygote has forked, and sets it up the way
+// uv_spawn() does before calling exec().
+[[noreturn]] void ExecChild(const Request& request,
+                            std::vector<int>* stdio,
+                            const char* file,
+                            const char* cwd,
+                            char** args,
+                            char** env,
+                            int error_fd) {
+  const int count = static_cast<int>(stdio->size());
+
+  auto fail = [&error_fd]() {
+    int err = -errno;
+    WriteAll(error_fd, &err, sizeof(err));
+    _exit(127);
+  };
+
+  if (request.flags & UV_PROCESS_DETACHED)
+    setsid();
+
+  // Keep the error pipe out of the way of the stdio file descriptors, and
+  // move those that would be overwritten before they are used.
+  if (error_fd < count) {
+    error_fd = fcntl(error_fd, F_DUPFD, count);
+    if (error_fd == -1)
+      _exit(127);
+    SetCloexec(error_fd);
+  }
+  for (int fd = 0; fd < count; fd++) {
+    int use_fd = (*stdio)[fd];
+    if (use_fd < 0 || use_fd >= fd)
+      continue;
+    use_fd = fcntl(use_fd, F_DUPFD, count);
+    if (use_fd == -1)
+      fail();
+    (*stdio)[fd] = use_fd;
+  }
+
+  for (int fd = 0; fd < count; fd++) {
+    int use_fd = (*stdio)[fd];
+    if (use_fd < 0) {
+      if (fd >= 3)
+        continue;
+      close(fd);
+      use_fd = open("/dev/null", (fd == 0 ? O_RDONLY : O_RDWR) | O_CLOEXEC);
+      if (use_fd == -1)
+        fail();
+    }
+
+    if (fd == use_fd) {
+      int flags = fcntl(fd, F_GETFD);
+      if (flags == -1 || fcntl(fd, F_SETFD, flags & ~FD_CLOEXEC) == -1)
+        fail();
+    } else if (dup2(use_fd, fd) == -1) {
+      fail();
+    }
+
+    if (fd <= 2) {
+      int flags = fcntl(fd, F_GETFL);
+      if (flags != -1)
+        fcntl(fd, F_SETFL, flags & ~O_NONBLOCK);
+    }
+  }
+
+  if (chdir(cwd) == -1)
+    fail();
+  umask(static_cast<mode_t>(request.umask));
+
+  if (request.flags & (UV_PROCESS_SETUID | UV_PROCESS_SETGID)) {
+    // Like libuv, ignore errors because this fails without privileges, in
+    // which case setgid() and setuid() fail as well unless they are no-ops.
+    int saved_errno = errno;
+    setgroups(0, nullptr);
+    errno = saved_errno;
+  }
+  if ((request.flags & UV_PROCESS_SETGID) && setgid(request.gid) == -1)
+    fail();
+  if ((request.flags & UV_PROCESS_SETUID) && setuid(request.uid) == -1)
+    fail();
+
+  // Reset the signal dispositions and the mask of both node and the zygote.
+  for (int nr = 1; nr < 32; nr++) {
+    if (nr == SIGKILL || nr == SIGSTOP)
+      continue;
+    signal(nr, SIG_DFL);
+  }
+  sigset_t set;
+  sigemptyset(&set);
+  sigprocmask(SIG_SETMASK, &set, nullptr);
+
+  environ = env;
+  execvp(file, args);
+  fail();
+}
+
+
+// Returns a libuv error code.
+int SpawnChild(const Request& request,
+               std::vector<char>* payload,
+               const std::vector<int>& fds,
+               int32_t* pid) {
+  if (request.stdio_count > kMaxStdio ||
+      payload->size() < request.stdio_count * sizeof(int32_t)) {
+    return UV_EINVAL;
+  }
+
+  std::vector<int> stdio(request.stdio_count);
+  for (uint32_t i = 0; i < request.stdio_count; i++) {
+    int32_t index;
+    memcpy(&index, payload->data() + i * sizeof(index), sizeof(index));
+    if (index >= static_cast<int32_t>(fds.size()))
+      return UV_EINVAL;
+    stdio[i] = index < 0 ? -1 : fds[index];
+  }
+
+  char* p = payload->data() + request.stdio_count * sizeof(int32_t);
+  char* const end = payload->data() + payload->size();
+  auto next = [&p, end]() -> char* {
+    char* nul = static_cast<char*>(memchr(p, '\0', end - p));
+    if (nul == nullptr)
+      return nullptr;
+    char* s = p;
+    p = nul + 1;
+    return s;
+  };
+
+  char* file = next();
+  char* cwd = next();
+  std::vector<char*> args;
+  std::vector<char*> env;
+  for (uint32_t i = 0; i < request.argc; i++)
+    args.push_back(next());
+  for (uint32_t i = 0; i < request.envc; i++)
+    env.push_back(next());
+  if (file == nullptr || cwd == nullptr || cwd[0] == '\0' ||
+      request.argc == 0 ||
+      args.back() == nullptr || (request.envc > 0 && env.back() == nullptr)) {
+    return UV_EINVAL;
+  }
+  args.push_back(nullptr);
+  env.push_back(nullptr);
+
+  int error_fds[2];
+  if (pipe(error_fds) == -1)
+    return -errno;
+  SetCloexec(error_fds[0]);
+  SetCloexec(error_fds[1]);
+
+  pid_t child = fork();
+  if (child == -1) {
+    int err = -errno;
+    close(error_fds[0]);
+    close(error_fds[1]);
+    return err;
+  }
+  if (child == 0) {
+    close(error_fds[0]);
+    ExecChild(request, &stdio, file, cwd, args.data(), env.data(),
+              error_fds[1]);
+  }
+  close(error_fds[1]);
+
+  // The pipe is closed without being written to if exec() succeeds.
+  int err = 0;
+  ssize_t n;
+  do {
+    n = read(error_fds[0], &err, sizeof(err));
+  } while (n == -1 && errno == EINTR);
+  close(error_fds[0]);
+
+  if (n != 0) {
+    if (n != sizeof(err))
+      err = UV_EIO;
+    while (waitpid(child, nullptr, 0) == -1 && errno == EINTR) {}
+    return err;
+  }
+
+  *pid = child;
+  return 0;
+}
+
+
+// Returns a libuv error code.
+int KillChild(const Request& request) {
+  auto it = live_children.find(request.pid);
+  if (it == live_children.end() || it->second != request.id)
+    return UV_ESRCH;
+  if (kill(request.pid, request.signal) == -1)
+    return -errno;
+  return 0;
+}
+
+
+// Returns false if node has gone away.
+bool HandleRequest(int fd) {
+  Request request;
+  char control[CMSG_SPACE(kMaxStdio * sizeof(int))];
+  struct iovec iov = { &request, sizeof(request) };
+  struct msghdr msg;
+  memset(&msg, 0, sizeof(msg));
+  msg.msg_iov = &iov;
+  msg.msg_iovlen = 1;
+  msg.msg_control = control;
+  msg.msg_controllen = sizeof(control);
+
+  ssize_t n;
+  do {
+    n = recvmsg(fd, &msg, 0);
+  } while (n == -1 && errno == EINTR);
+  if (n <= 0)
+    return false;
+
+  std::vector<int> fds;
+  for (struct cmsghdr* cmsg = CMSG_FIRSTHDR(&msg);
+       cmsg != nullptr;
+       cmsg = CMSG_NXTHDR(&msg, cmsg)) {
+    if (cmsg->cmsg_level != SOL_SOCKET || cmsg->cmsg_type != SCM_RIGHTS)
+      continue;
+    const int* data = reinterpret_cast<const int*>(CMSG_DATA(cmsg));
+    size_t count = (cmsg->cmsg_len - CMSG_LEN(0)) / sizeof(int);
+    for (size_t i = 0; i < count; i++) {
+      SetCloexec(data[i]);
+      fds.push_back(data[i]);
+    }
+  }
+
+  bool ok = ReadAll(fd, reinterpret_cast<char*>(&request) + n,
+                    sizeof(request) - n);
+  std::vector<char> payload(ok ? request.payload_size : 0);
+  ok = ok && ReadAll(fd, payload.data(), payload.size());
+
+  Reply reply = { 0, 0 };
+  if (ok && request.type == kKillRequest) {
+    reply.err = KillChild(request);
+  } else if (ok) {
+    reply.err = SpawnChild(request, &payload, fds, &reply.pid);
+    if (reply.err == 0)
+      live_children[reply.pid] = request.id;
+  }
+  for (int passed_fd : fds)
+    close(passed_fd);
+  return ok && WriteAll(fd, &reply, sizeof(reply));
+}
+
+
+void OnSigchld(int signo) {
+  int saved_errno = errno;
+  char c = 0;
+  ssize_t n = write(sigchld_fds[1], &c, 1);
+  static_cast<void>(n);
+  errno = saved_errno;
+}
+
+
+void ReapChildren() {
+  int status;
+  pid_t pid;
+  while ((pid = waitpid(-1, &status, WNOHANG)) > 0) {
+    auto it = live_children.find(pid);
+    if (it == live_children.end())
+      continue;
+    ExitEvent event;
+    memset(&event, 0, sizeof(event));
+    event.id = it->second;
+    live_children.erase(it);
+    if (WIFEXITED(status))
+      event.exit_status = WEXITSTATUS(status);
+    if (WIFSIGNALED(status))
+      event.term_signal = WTERMSIG(status);
+    const char* data = reinterpret_cast<const char*>(&event);
+    unsent_events.insert(unsent_events.end(), data, data + sizeof(event));
+  }
+}
+
+
+// Returns false if node has gone away.
+bool SendEvents(int fd) {
+  size_t offset = 0;
+  while (offset < unsent_events.size()) {
+    ssize_t n = write(fd, unsent_events.data() + offset,
+                      unsent_events.size() - offset);
+    if (n == -1 && errno == EINTR)
+      continue;
+    if (n == -1 && errno == EAGAIN)
+      break;
+    if (n <= 0)
+      return false;
+    offset += n;
+  }
+  unsent_events.erase(unsent_events.begin(), unsent_events.begin() + offset);
+  return true;
+}
+
+
+[[noreturn]] void ZygoteMain(int request_fd, int event_fd, int channel_fd) {
+  // Keyboard and hangup signals that are meant for node should not take the
+  // zygote down. It exits once node closes the request socket instead.
+  signal(SIGINT, SIG_IGN);
+  signal(SIGQUIT, SIG_IGN);
+  signal(SIGHUP, SIG_IGN);
+  signal(SIGTERM, SIG_DFL);
+
+  // Do not keep node's stdio open, children get theirs with each request.
+  int null_fd = open("/dev/null", O_RDWR);
+  if (null_fd != -1) {
+    for (int fd = 0; fd <= 2; fd++)
+      dup2(null_fd, fd);
+    if (null_fd > 2)
+      close(null_fd);
+  }
+
+  // Nor node's IPC channel, or the parent would not see node disconnect for
+  // as long as the zygote is around. Other inherited file descriptors are
+  // only closed along with node, but node closes this one on disconnect().
+  // It cannot be told apart by FD_CLOEXEC, which uv_disable_stdio_inheritance()
+  // has set on everything, including libuv's own descriptors that its fork
+  // handlers reopen by number in every child.
+  if (channel_fd > 2 && channel_fd != request_fd && channel_fd != event_fd)
+    close(channel_fd);
+
+  fcntl(event_fd, F_SETFL, fcntl(event_fd, F_GETFL) | O_NONBLOCK);
+
+  if (pipe(sigchld_fds) == -1)
+    _exit(1);
+  for (int fd : sigchld_fds) {
+    SetCloexec(fd);
+    fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK);
+  }
+  struct sigaction act;
+  memset(&act, 0, sizeof(act));
+  act.sa_handler = OnSigchld;
+  act.sa_flags = SA_RESTART | SA_NOCLDSTOP;
+  sigaction(SIGCHLD, &act, nullptr);
+
+  for (;;) {
+    struct pollfd fds[] = {
+      { request_fd, POLLIN, 0 },
+      { sigchld_fds[0], POLLIN, 0 },
+      { event_fd, 0, 0 }
+    };
+    if (!unsent_events.empty())
+      fds[2].events = POLLOUT;
+    if (poll(fds, arraysize(fds), -1) == -1) {
+      if (errno == EINTR)
+        continue;
+      _exit(1);
+    }
+
+    if (fds[1].revents & POLLIN) {
+      char buf[64];
+      while (read(sigchld_fds[0], buf, sizeof(buf)) > 0) {}
+    }
+    ReapChildren();
+    if (!SendEvents(event_fd))
+      _exit(0);
+
+    if (fds[0].revents & (POLLIN | POLLHUP | POLLERR)) {
+      if (!HandleRequest(request_fd))
+        _exit(0);
+    }
+  }
+}
+
+
+// Called once the zygote has exited. Children that it has not reported yet
+// are reported as failed, because their exit status cannot be known.
+void OnZygoteGone() {
+  uv_poll_stop(watcher);
+  close(event_fd);
+  event_fd = -1;
+  if (request_fd != -1) {
+    close(request_fd);
+    request_fd = -1;
+  }
+  while (waitpid(zygote_pid, nullptr, 0) == -1 && errno == EINTR) {}
+
+  std::unordered_map<uint64_t, Child> lost;
+  lost.swap(children);
+  for (const auto& it : lost)
+    it.second.cb(it.second.data, UV_ESRCH, 0);
+}
+
+
+void OnEvents(uv_poll_t* handle, int status, int events) {
+  char buf[4096];
+  ssize_t n;
+  bool gone = status < 0;
+  while (!gone) {
+    n = read(event_fd, buf, sizeof(buf));
+    if (n > 0)
+      pending_events.insert(pending_events.end(), buf, buf + n);
+    else if (n == 0 || (errno != EINTR && errno != EAGAIN))
+      gone = true;
+    else if (errno == EAGAIN)
+      break;
+  }
+
+  size_t offset = 0;
+  while (pending_events.size() - offset >= sizeof(ExitEvent)) {
+    ExitEvent event;
+    memcpy(&event, pending_events.data() + offset, sizeof(event));
+    offset += sizeof(event);
+
+    auto it = children.find(event.id);
+    if (it == children.end())
+      continue;
+    Child child = it->second;
+    children.erase(it);
+    child.cb(child.data, event.exit_status, event.term_signal);
+  }
+  pending_events.erase(pending_events.begin(),
+                       pending_events.begin() + offset);
+
+  if (gone)
+    OnZygoteGone();
+}
+
+
+void StartWatcher(Environment* env) {
+  watcher = new uv_poll_t;
+  CHECK_EQ(uv_poll_init(env->event_loop(), watcher, event_fd), 0);
+  CHECK_EQ(uv_poll_start(watcher, UV_READABLE, OnEvents), 0);
+  // Each child's own handle keeps the event loop alive.
+  uv_unref(reinterpret_cast<uv_handle_t*>(watcher));
+  watcher_env = env;
+
+  env->RegisterHandleCleanup(
+      reinterpret_cast<uv_handle_t*>(watcher),
+      [](Environment* env, uv_handle_t* handle, void* arg) {
+        env->CloseHandle(watcher, [](uv_poll_t* handle) { delete handle; });
+        watcher = nullptr;
+        watcher_env = nullptr;
+        children.clear();
+      },
+      nullptr);
+}
+
+}  // anonymous namespace
+
+
+void Start() {
+  std::string value;
+  if (!SafeGetenv("NODE_SPAWN_ZYGOTE", &value) || value != "1")
+    return;
+
+  int requests[2];
+  int events[2];
+  if (socketpair(AF_UNIX, SOCK_STREAM, 0, requests) == -1)
+    return;
+  if (socketpair(AF_UNIX, SOCK_STREAM, 0, events) == -1) {
+    close(requests[0]);
+    close(requests[1]);
+    return;
+  }
+  for (int fd : { requests[0], requests[1], events[0], events[1] })
+    SetCloexec(fd);
+
+  int channel_fd = -1;
+  if (SafeGetenv("NODE_CHANNEL_FD", &value))
+    channel_fd = static_cast<int>(strtol(value.c_str(), nullptr, 10));
+
+  pid_t pid = fork();
+  if (pid == 0) {
+    close(requests[0]);
+    close(events[0]);
+    ZygoteMain(requests[1], events[1], channel_fd);
+  }
+
+  close(requests[1]);
+  close(events[1]);
+  if (pid == -1) {
+    close(requests[0]);
+    close(events[0]);
+    return;
+  }
+
+  fcntl(events[0], F_SETFL, fcntl(events[0], F_GETFL) | O_NONBLOCK);
+  request_fd = requests[0];
+  event_fd = events[0];
+  zygote_pid = pid;
+  main_thread = uv_thread_self();
+}
+
+
+int Spawn(Environment* env,
+          const uv_process_options_t* options,
+          ExitCallback cb,
+          void* data,
+          int* pid,
+          uint64_t* id) {
+  // zygote_pid and main_thread are only set before node starts any threads.
+  const uv_thread_t self = uv_thread_self();
+  if (zygote_pid == 0 || !uv_thread_equal(&self, &main_thread))
+    return UV_ENOSYS;
+  if (request_fd == -1 ||
+      options->stdio_count < 0 ||
+      static_cast<uint32_t>(options->stdio_count) > kMaxStdio ||
+      (watcher_env != nullptr && watcher_env != env)) {
+    return UV_ENOSYS;
+  }
+
+  char cwd[PATH_MAX];
+  size_t cwd_size = sizeof(cwd);
+  if (options->cwd == nullptr && uv_cwd(cwd, &cwd_size) != 0)
+    return UV_ENOSYS;
+
+  if (watcher_env == nullptr)
+    StartWatcher(env);
+
+  Request request;
+  memset(&request, 0, sizeof(request));
+  request.id = next_child_id++;
+  request.type = kSpawnRequest;
+  request.flags = options->flags;
+  request.uid = options->uid;
+  request.gid = options->gid;
+  // umask() cannot be read without setting it, which is what
+  // process.umask() does as well.
+  const mode_t mask = umask(0);
+  umask(mask);
+  request.umask = mask;
+  request.stdio_count = options->stdio_count;
+
+  std::string payload;
+  std::vector<int> fds;
+  // The parent's and the child's end of each UV_CREATE_PIPE socket pair.
+  std::vector<int> parent_fds(options->stdio_count, -1);
+  std::vector<int> child_fds;
+  int err = 0;
+
+  auto close_all = [&](const std::vector<int>& fds) {
+    for (int fd : fds) {
+      if (fd != -1)
+        close(fd);
+    }
+  };
+
+  for (int i = 0; i < options->stdio_count; i++) {
+    const uv_stdio_container_t& container = options->stdio[i];
+    int fd = -1;
+    switch (container.flags &
+            (UV_CREATE_PIPE | UV_INHERIT_FD | UV_INHERIT_STREAM)) {
+      case UV_CREATE_PIPE: {
+        int pair[2];
+        if (socketpair(AF_UNIX, SOCK_STREAM, 0, pair) == -1) {
+          err = -errno;
+          break;
+        }
+        SetCloexec(pair[0]);
+        SetCloexec(pair[1]);
+        parent_fds[i] = pair[0];
+        child_fds.push_back(pair[1]);
+        fd = pair[1];
+        break;
+      }
+      case UV_INHERIT_FD:
+        fd = container.data.fd;
+        break;
+      case UV_INHERIT_STREAM: {
+        uv_os_fd_t stream_fd;
+        err = uv_fileno(reinterpret_cast<uv_handle_t*>(container.data.stream),
+                        &stream_fd);
+        fd = stream_fd;
+        break;
+      }
+      default:
+        break;
+    }
+    if (err != 0)
+      break;
+
+    int32_t index = -1;
+    if (fd != -1) {
+      index = static_cast<int32_t>(fds.size());
+      fds.push_back(fd);
+    }
+    payload.append(reinterpret_cast<const char*>(&index), sizeof(index));
+  }
+
+  if (err != 0) {
+    close_all(parent_fds);
+    close_all(child_fds);
+    return err;
+  }
+
+  auto append = [&payload](const char* s) {
+    payload.append(s, strlen(s) + 1);
+  };
+  append(options->file);
+  append(options->cwd != nullptr ? options->cwd : cwd);
+  if (options->args != nullptr) {
+    for (char** arg = options->args; *arg != nullptr; arg++, request.argc++)
+      append(*arg);
+  }
+  if (request.argc == 0) {
+    append(options->file);
+    request.argc = 1;
+  }
+  char** env_pairs = options->env != nullptr ? options->env : environ;
+  for (char** pair = env_pairs; *pair != nullptr; pair++, request.envc++)
+    append(*pair);
+  request.payload_size = payload.size();
+
+  char control[CMSG_SPACE(kMaxStdio * sizeof(int))];
+  memset(control, 0, sizeof(control));
+  struct iovec iov = { &request, sizeof(request) };
+  struct msghdr msg;
+  memset(&msg, 0, sizeof(msg));
+  msg.msg_iov = &iov;
+  msg.msg_iovlen = 1;
+  if (!fds.empty()) {
+    msg.msg_control = control;
+    msg.msg_controllen = CMSG_SPACE(fds.size() * sizeof(int));
+    struct cmsghdr* cmsg = CMSG_FIRSTHDR(&msg);
+    cmsg->cmsg_level = SOL_SOCKET;
+    cmsg->cmsg_type = SCM_RIGHTS;
+    cmsg->cmsg_len = CMSG_LEN(fds.size() * sizeof(int));
+    memcpy(CMSG_DATA(cmsg), fds.data(), fds.size() * sizeof(int));
+  }
+
+  ssize_t n;
+  do {
+    n = sendmsg(request_fd, &msg, 0);
+  } while (n == -1 && errno == EINTR);
+
+  Reply reply;
+  bool ok = n > 0 &&
+            WriteAll(request_fd, reinterpret_cast<char*>(&request) + n,
+                     sizeof(request) - n) &&
+            WriteAll(request_fd, payload.data(), payload.size()) &&
+            ReadAll(request_fd, &reply, sizeof(reply));
+  close_all(child_fds);
+
+  if (!ok) {
+    // The zygote has gone away. Its exit is noticed by the watcher, which
+    // also reports the children it has left behind.
+    close(request_fd);
+    request_fd = -1;
+    close_all(parent_fds);
+    return UV_ENOSYS;
+  }
+
+  // Like uv_spawn(), open the pipes even if exec() failed.
+  for (int i = 0; i < options->stdio_count; i++) {
+    if (parent_fds[i] == -1)
+      continue;
+    uv_stream_t* stream = options->stdio[i].data.stream;
+    CHECK_EQ(uv_pipe_open(reinterpret_cast<uv_pipe_t*>(stream),
+                          parent_fds[i]), 0);
+  }
+
+  if (reply.err != 0)
+    return reply.err;
+
+  children[request.id] = Child { cb, data, reply.pid };
+  *pid = reply.pid;
+  *id = request.id;
+  return 0;
+}
+
+
+int Kill(uint64_t id, int signum) {
+  auto it = children.find(id);
+  if (it == children.end() || request_fd == -1)
+    return UV_ESRCH;
+
+  Request request;
+  memset(&request, 0, sizeof(request));
+  request.id = id;
+  request.type = kKillRequest;
+  request.pid = it->second.pid;
+  request.signal = signum;
+  Reply reply;
+  if (!WriteAll(request_fd, &request, sizeof(request)) ||
+      !ReadAll(request_fd, &reply, sizeof(reply))) {
+    // As in Spawn(), the watcher reports the child once the zygote is gone.
+    close(request_fd);
+    request_fd = -1;
+    return UV_ESRCH;
+  }
+  return reply.err;
+}
+
+
+void Forget(uint64_t id) {
+  children.erase(id);
+}
+
+#else  // !__POSIX__
+
+void Start() {}
+
+int Spawn(Environment* env,
+          const uv_process_options_t* options,
+          ExitCallback cb,
+          void* data,
+          int* pid,
+          uint64_t* id) {
+  return UV_ENOSYS;
+}
+
+int Kill(uint64_t id, int signum) {
+  return UV_ESRCH;
+}
+
+void Forget(uint64_t id) {}
+
+#endif  // __POSIX__
+
+}  // namespace zygote
+}  // namespace node
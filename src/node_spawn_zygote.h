@@ -0,0 +1,65 @@
+#ifndef SRC_NODE_SPAWN_ZYGOTE_H_
+#define SRC_NODE_SPAWN_ZYGOTE_H_
+
+#if defined(NODE_WANT_INTERNALS) && NODE_WANT_INTERNALS
+
+#include "node.h"
+#include "uv.h"
+
+#include <stdint.h>
+
+namespace node {
+
+class Environment;
+
+// The spawn zygote is a helper process that is forked from node while it is
+// still small, before V8 and any threads have been started, when the
+// NODE_SPAWN_ZYGOTE=1 environment variable is set. Child processes are then
+// forked from the zygote instead of from node itself, so that the cost of
+// forking does not grow with the size of node's heap.
+//
+// Requests are sent over a Unix domain socket, together with the file
+// descriptors that make up the child's stdio. The zygote forks, sets up the
+// child like uv_spawn() does, and replies with the child's pid once exec()
+// has succeeded, or with the error. Because the zygote is the parent of the
+// children it spawns, it reaps them and reports their exit status over a
+// second socket, which is watched on the event loop of the environment that
+// first spawns through it.
+namespace zygote {
+
+typedef void (*ExitCallback)(void* data, int64_t exit_status, int term_signal);
+
+// Forks the zygote if it is enabled. Must be called before any threads are
+// started.
+void Start();
+
+// Spawns a process like uv_spawn(), except that `options->exit_cb` is not
+// used: `cb` is called with `data` once the process has exited instead.
+// UV_CREATE_PIPE streams are opened with the parent's end of a socket pair.
+// `id` identifies the process in calls to Kill() and Forget().
+//
+// Returns UV_ENOSYS if the zygote is not running or cannot be used for this
+// request, in which case uv_spawn() should be used instead. It can only be
+// used from the thread that called Start().
+int Spawn(Environment* env,
+          const uv_process_options_t* options,
+          ExitCallback cb,
+          void* data,
+          int* pid,
+          uint64_t* id);
+
+// Sends `signum` to the process, like uv_process_kill(). The zygote only
+// signals children that it has not reaped yet, so the pid of one that has
+// exited is never signaled after it may have been reused.
+int Kill(uint64_t id, int signum);
+
+// Stops reporting the exit of the process, e.g. because its handle was
+// closed.
+void Forget(uint64_t id);
+
+}  // namespace zygote
+}  // namespace node
+
+#endif  // defined(NODE_WANT_INTERNALS) && NODE_WANT_INTERNALS
+
+#endif  // SRC_NODE_SPAWN_ZYGOTE_H_
@@ -28,6 +28,15 @@
 #include <string.h>
 #include <stdlib.h>
 
+#ifdef __linux__
+#include <errno.h>
+#include <limits.h>  // PATH_MAX
+#include <sys/inotify.h>
+#include <sys/stat.h>
+#include <sys/vfs.h>
+#include <unistd.h>
+#endif
+
 namespace node {
 
 using v8::Context;
@@ -76,11 +85,9 @@ void StatWatcher::Initialize(Environment* env, Local<Object> target) {
 
 
 StatWatcher::StatWatcher(Environment* env, Local<Object> wrap)
-    : AsyncWrap(env, wrap, AsyncWrap::PROVIDER_STATWATCHER),
-      watcher_(new uv_fs_poll_t) {
+    : AsyncWrap(env, wrap, AsyncWrap::PROVIDER_STATWATCHER) {
   MakeWeak();
-  uv_fs_poll_init(env->event_loop(), watcher_);
-  watcher_->data = static_cast<void*>(this);
+  memset(&statbuf_, 0, sizeof(statbuf_));
 }
 
 
@@ -88,17 +95,54 @@ StatWatcher::~StatWatcher() {
   if (IsActive()) {
     Stop();
   }
-  env()->CloseHandle(watcher_, [](uv_fs_poll_t* handle) { delete handle; });
 }
 
 
-void StatWatcher::Callback(uv_fs_poll_t* handle,
-                           int status,
+// The same comparison as uv_fs_poll_t's.
+static bool IsStatEqual(const uv_stat_t* a, const uv_stat_t* b) {
+  return a->st_ctim.tv_nsec == b->st_ctim.tv_nsec
+      && a->st_mtim.tv_nsec == b->st_mtim.tv_nsec
+      && a->st_birthtim.tv_nsec == b->st_birthtim.tv_nsec
+      && a->st_ctim.tv_sec == b->st_ctim.tv_sec
+      && a->st_mtim.tv_sec == b->st_mtim.tv_sec
+      && a->st_birthtim.tv_sec == b->st_birthtim.tv_sec
+      && a->st_size == b->st_size
+      && a->st_mode == b->st_mode
+      && a->st_uid == b->st_uid
+      && a->st_gid == b->st_gid
+      && a->st_ino == b->st_ino
+      && a->st_dev == b->st_dev
+      && a->st_flags == b->st_flags
+      && a->st_gen == b->st_gen;
+}
+
+
+void StatWatcher::OnStat(int status, const uv_stat_t* stat) {
+  // Errors are reported once each, along with the last successful result.
+  if (status != 0) {
+    if (busy_polling_ != status) {
+      static const uv_stat_t zero_statbuf = uv_stat_t();
+      busy_polling_ = status;
+      Callback(status, &statbuf_, &zero_statbuf);
+    }
+    return;
+  }
+
+  // The first result only serves as the baseline.
+  const bool changed = busy_polling_ < 0 ||
+                       (busy_polling_ > 0 && !IsStatEqual(&statbuf_, stat));
+  const uv_stat_t prev = statbuf_;
+  statbuf_ = *stat;
+  busy_polling_ = 1;
+  if (changed)
+    Callback(0, &prev, stat);
+}
+
+
+void StatWatcher::Callback(int status,
                            const uv_stat_t* prev,
                            const uv_stat_t* curr) {
-  StatWatcher* wrap = static_cast<StatWatcher*>(handle->data);
-  CHECK_EQ(wrap->watcher_, handle);
-  Environment* env = wrap->env();
+  Environment* env = this->env();
   HandleScope handle_scope(env->isolate());
   Context::Scope context_scope(env->context());
 
@@ -109,7 +153,7 @@ void StatWatcher::Callback(uv_fs_poll_t* handle,
     Integer::New(env->isolate(), status),
     arr
   };
-  wrap->MakeCallback(env->onchange_string(), arraysize(argv), argv);
+  MakeCallback(env->onchange_string(), arraysize(argv), argv);
 }
 
 
@@ -120,7 +164,7 @@ void StatWatcher::New(const FunctionCallbackInfo<Value>& args) {
 }
 
 bool StatWatcher::IsActive() {
-  return uv_is_active(reinterpret_cast<uv_handle_t*>(watcher_)) != 0;
+  return id_ != 0;
 }
 
 void StatWatcher::IsActive(const v8::FunctionCallbackInfo<v8::Value>& args) {
@@ -153,18 +197,27 @@ void StatWatcher::Start(const FunctionCallbackInfo<Value>& args) {
   CHECK(args[2]->IsUint32());
   const uint32_t interval = args[2].As<Uint32>()->Value();
 
-  // Safe, uv_ref/uv_unref are idempotent.
-  if (persistent)
-    uv_ref(reinterpret_cast<uv_handle_t*>(wrap->watcher_));
-  else
-    uv_unref(reinterpret_cast<uv_handle_t*>(wrap->watcher_));
-
-  // Note that uv_fs_poll_start does not return ENOENT, we are handling
-  // mostly memory errors here.
-  const int err = uv_fs_poll_start(wrap->watcher_, Callback, *path, interval);
-  if (err != 0) {
-    args.GetReturnValue().Set(err);
+  wrap->path_ = *path;
+#ifdef __linux__
+  // Relative paths are resolved now, so that the file's directory can be
+  // watched through inotify. A later process.chdir() does not change which
+  // file is watched.
+  if (!wrap->path_.empty() && wrap->path_[0] != '/') {
+    char cwd[PATH_MAX];
+    size_t cwd_size = sizeof(cwd);
+    if (uv_cwd(cwd, &cwd_size) == 0)
+      wrap->path_ = std::string(cwd, cwd_size) + '/' + wrap->path_;
   }
+#endif
+  wrap->persistent_ = persistent;
+  wrap->interval_ = interval > 0 ? interval : 1;
+  wrap->busy_polling_ = 0;
+  memset(&wrap->statbuf_, 0, sizeof(wrap->statbuf_));
+
+  Environment* env = wrap->env();
+  if (env->stat_watcher_set == nullptr)
+    env->stat_watcher_set.reset(new StatWatcherSet(env));
+  env->stat_watcher_set->Add(wrap);
   wrap->ClearWeak();
 }
 
@@ -184,9 +237,431 @@ void StatWatcher::Stop(const FunctionCallbackInfo<Value>& args) {
 
 
 void StatWatcher::Stop() {
-  uv_fs_poll_stop(watcher_);
+  env()->stat_watcher_set->Remove(this);
   MakeWeak();
 }
 
 
+// Stats a batch of files in the thread pool.
+class StatWatcherSet::Sweep : public ThreadPoolWork {
+ public:
+  Sweep(StatWatcherSet* set,
+        unsigned int interval,
+        const std::vector<StatWatcher*>& watchers)
+      : ThreadPoolWork(set->env_),
+        set_(set),
+        interval_(interval),
+        results_(watchers.size()),
+        stats_(watchers.size()),
+        links_(watchers.size()) {
+    ids_.reserve(watchers.size());
+    paths_.reserve(watchers.size());
+    for (StatWatcher* watcher : watchers) {
+      ids_.push_back(watcher->id_);
+      paths_.push_back(watcher->path_);
+    }
+  }
+
+  void DoThreadPoolWork() override {
+    for (size_t i = 0; i < paths_.size(); i++) {
+      uv_fs_t req;
+      results_[i] = uv_fs_stat(nullptr, &req, paths_[i].c_str(), nullptr);
+      if (results_[i] == 0)
+        stats_[i] = req.statbuf;
+      uv_fs_req_cleanup(&req);
+#ifdef __linux__
+      // Only needed for the files that UpdateWatch() might watch.
+      if (results_[i] == 0 || results_[i] == UV_ENOENT) {
+        struct stat s;
+        links_[i] = lstat(paths_[i].c_str(), &s) == 0 && S_ISLNK(s.st_mode);
+      }
+#endif
+    }
+  }
+
+  void AfterThreadPoolWork(int status) override {
+    CHECK_EQ(status, 0);
+    set_->OnSweepDone(this);
+  }
+
+ private:
+  friend class StatWatcherSet;
+
+  StatWatcherSet* const set_;
+  const unsigned int interval_;
+  std::vector<uint64_t> ids_;
+  std::vector<std::string> paths_;
+  std::vector<int> results_;
+  std::vector<uv_stat_t> stats_;
+  // Whether each path is a symbolic link itself.
+  std::vector<bool> links_;
+};
+
+
+StatWatcherSet::StatWatcherSet(Environment* env) : env_(env) {
+  CHECK_EQ(uv_timer_init(env->event_loop(), &dirty_timer_), 0);
+  dirty_timer_.data = this;
+  uv_unref(reinterpret_cast<uv_handle_t*>(&dirty_timer_));
+
+#ifdef __linux__
+  inotify_fd_ = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+  if (inotify_fd_ != -1 &&
+      uv_poll_init(env->event_loop(), &inotify_poll_, inotify_fd_) != 0) {
+    close(inotify_fd_);
+    inotify_fd_ = -1;
+  }
+  if (inotify_fd_ != -1) {
+    inotify_poll_.data = this;
+    CHECK_EQ(uv_poll_start(&inotify_poll_, UV_READABLE, OnInotify), 0);
+    uv_unref(reinterpret_cast<uv_handle_t*>(&inotify_poll_));
+  }
+#endif
+
+  env->RegisterHandleCleanup(
+      reinterpret_cast<uv_handle_t*>(&dirty_timer_),
+      [](Environment* env, uv_handle_t* handle, void* arg) {
+        static_cast<StatWatcherSet*>(arg)->Close();
+      },
+      this);
+}
+
+
+StatWatcherSet::~StatWatcherSet() {
+  CHECK(closing_);
+}
+
+
+void StatWatcherSet::Close() {
+  closing_ = true;
+  for (auto& it : groups_)
+    env_->CloseHandle(it.second.timer, [](uv_timer_t* handle) {
+      delete handle;
+    });
+  groups_.clear();
+  env_->CloseHandle(&dirty_timer_, [](uv_timer_t* handle) {});
+
+#ifdef __linux__
+  if (inotify_fd_ != -1) {
+    env_->CloseHandle(&inotify_poll_, [](uv_poll_t* handle) {});
+    close(inotify_fd_);
+    inotify_fd_ = -1;
+  }
+  watches_.clear();
+#endif
+}
+
+
+void StatWatcherSet::Add(StatWatcher* watcher) {
+  watcher->id_ = next_id_++;
+  watchers_.emplace(watcher->id_, watcher);
+  if (closing_)
+    return;
+
+  Group& group = groups_[watcher->interval_];
+  if (group.timer == nullptr) {
+    group.timer = new uv_timer_t;
+    CHECK_EQ(uv_timer_init(env_->event_loop(), group.timer), 0);
+    group.timer->data = this;
+    CHECK_EQ(uv_timer_start(group.timer, OnGroupTimer,
+                            watcher->interval_, watcher->interval_), 0);
+  }
+  group.watchers.insert(watcher);
+  if (watcher->persistent_)
+    group.persistent++;
+  UpdateRef(&group);
+
+  // Take the baseline right away, like uv_fs_poll_start() does. Watchers
+  // that are started while that is in progress share the next sweep.
+  MarkDirty(watcher);
+  if (!dirty_sweeping_) {
+    uv_timer_stop(&dirty_timer_);
+    SweepDirty();
+  }
+}
+
+
+void StatWatcherSet::Remove(StatWatcher* watcher) {
+  watchers_.erase(watcher->id_);
+  watcher->id_ = 0;
+  watcher->dirty_ = false;
+#ifdef __linux__
+  Unwatch(watcher);
+#endif
+
+  auto it = groups_.find(watcher->interval_);
+  if (it == groups_.end())
+    return;
+  Group& group = it->second;
+  group.watchers.erase(watcher);
+  if (watcher->persistent_)
+    group.persistent--;
+  if (!group.watchers.empty())
+    return UpdateRef(&group);
+
+  env_->CloseHandle(group.timer, [](uv_timer_t* handle) { delete handle; });
+  groups_.erase(it);
+}
+
+
+// The timer of a group keeps the event loop alive if any of its watchers is
+// persistent, just like their uv_fs_poll_t handles used to.
+void StatWatcherSet::UpdateRef(Group* group) {
+  uv_handle_t* handle = reinterpret_cast<uv_handle_t*>(group->timer);
+  if (group->persistent > 0)
+    uv_ref(handle);
+  else
+    uv_unref(handle);
+}
+
+
+void StatWatcherSet::MarkDirty(StatWatcher* watcher) {
+  if (watcher->dirty_ || closing_)
+    return;
+  watcher->dirty_ = true;
+  dirty_.push_back(watcher->id_);
+  // Changes that are reported in the same loop iteration share a sweep.
+  // While one is in progress, OnSweepDone() restarts the timer.
+  if (!dirty_sweeping_)
+    uv_timer_start(&dirty_timer_, OnDirtyTimer, 0, 0);
+}
+
+
+void StatWatcherSet::StartSweep(const std::vector<StatWatcher*>& watchers,
+                                unsigned int interval) {
+  Sweep* sweep = new Sweep(this, interval, watchers);
+  sweep->ScheduleWork();
+}
+
+
+void StatWatcherSet::OnSweepDone(Sweep* sweep) {
+  std::unique_ptr<Sweep> self(sweep);
+  if (sweep->interval_ == 0) {
+    dirty_sweeping_ = false;
+  } else {
+    auto it = groups_.find(sweep->interval_);
+    if (it != groups_.end())
+      it->second.sweeping = false;
+  }
+  if (closing_)
+    return;
+  if (!dirty_.empty())
+    uv_timer_start(&dirty_timer_, OnDirtyTimer, 0, 0);
+
+  // Watchers may be stopped and started by the callbacks, so they are looked
+  // up anew every time.
+  for (size_t i = 0; i < sweep->ids_.size(); i++) {
+    auto it = watchers_.find(sweep->ids_[i]);
+    if (it == watchers_.end())
+      continue;
+    StatWatcher* watcher = it->second;
+#ifdef __linux__
+    UpdateWatch(watcher, sweep->results_[i], &sweep->stats_[i],
+                sweep->links_[i]);
+#endif
+    watcher->OnStat(sweep->results_[i], &sweep->stats_[i]);
+  }
+}
+
+
+void StatWatcherSet::OnGroupTimer(uv_timer_t* handle) {
+  StatWatcherSet* set = static_cast<StatWatcherSet*>(handle->data);
+  auto it = set->groups_.find(uv_timer_get_repeat(handle));
+  CHECK(it != set->groups_.end());
+  Group& group = it->second;
+  if (group.sweeping)
+    return;
+
+  // Files that are watched through inotify, or about to be stat()ed anyway,
+  // are left out.
+  std::vector<StatWatcher*> polled;
+  for (StatWatcher* watcher : group.watchers) {
+    if (watcher->wd_ == -1 && !watcher->dirty_)
+      polled.push_back(watcher);
+  }
+  if (polled.empty())
+    return;
+  group.sweeping = true;
+  set->StartSweep(polled, it->first);
+}
+
+
+void StatWatcherSet::OnDirtyTimer(uv_timer_t* handle) {
+  static_cast<StatWatcherSet*>(handle->data)->SweepDirty();
+}
+
+
+void StatWatcherSet::SweepDirty() {
+  std::vector<StatWatcher*> dirty;
+  for (uint64_t id : dirty_) {
+    auto it = watchers_.find(id);
+    if (it == watchers_.end())
+      continue;
+    it->second->dirty_ = false;
+    dirty.push_back(it->second);
+  }
+  dirty_.clear();
+  if (dirty.empty())
+    return;
+  dirty_sweeping_ = true;
+  StartSweep(dirty, 0);
+}
+
+
+#ifdef __linux__
+static const uint32_t kInotifyMask = IN_ATTRIB | IN_MODIFY | IN_CREATE |
+                                     IN_DELETE | IN_MOVED_FROM | IN_MOVED_TO |
+                                     IN_DELETE_SELF | IN_MOVE_SELF |
+                                     IN_ONLYDIR;
+
+// File systems whose inotify events are known to cover every change. Network
+// and FUSE file systems only report local changes, if any, and pseudo file
+// systems like procfs report none at all.
+static bool IsLocalFileSystem(uint32_t type) {
+  switch (type) {
+    case 0xEF53:      // ext2, ext3, ext4
+    case 0x58465342:  // xfs
+    case 0x9123683E:  // btrfs
+    case 0xF2F52010:  // f2fs
+    case 0x2FC12FC1:  // zfs
+    case 0x52654973:  // reiserfs
+    case 0x3153464A:  // jfs
+    case 0x01021994:  // tmpfs
+    case 0x858458F6:  // ramfs
+    case 0x794C7630:  // overlayfs
+      return true;
+    default:
+      return false;
+  }
+}
+
+
+void StatWatcherSet::UpdateWatch(StatWatcher* watcher,
+                                 int status,
+                                 const uv_stat_t* stat,
+                                 bool is_link) {
+  // Changes to a directory's contents are not reported to its parent, so
+  // only regular files, and files that do not exist yet, are watched.
+  // stat() follows symbolic links, whose targets may live anywhere, so
+  // links are polled as well.
+  const bool watchable = !is_link &&
+      (status == 0 ? S_ISREG(stat->st_mode) : status == UV_ENOENT);
+  if (!watchable)
+    Unwatch(watcher);
+  else if (watcher->wd_ == -1)
+    Watch(watcher);
+}
+
+
+void StatWatcherSet::Watch(StatWatcher* watcher) {
+  const std::string& path = watcher->path_;
+  const size_t slash = path.find_last_of('/');
+  if (inotify_fd_ == -1 || path[0] != '/' || slash + 1 == path.size())
+    return;
+
+  const std::string dir = slash == 0 ? "/" : path.substr(0, slash);
+  struct statfs s;
+  if (statfs(dir.c_str(), &s) != 0 ||
+      !IsLocalFileSystem(static_cast<uint32_t>(s.f_type))) {
+    return;
+  }
+
+  // The watch is on the directory that `dir` resolves to now. If a symbolic
+  // link on the way to it is changed later, its events no longer concern
+  // the file.
+  char* real = realpath(dir.c_str(), nullptr);
+  const bool resolved = real != nullptr && dir == real;
+  free(real);
+  if (!resolved)
+    return;
+
+  const int wd = inotify_add_watch(inotify_fd_, dir.c_str(), kInotifyMask);
+  if (wd == -1)
+    return;
+  watches_[wd].emplace(path.substr(slash + 1), watcher);
+  watcher->wd_ = wd;
+
+  // The file may have changed since it has last been stat()ed.
+  MarkDirty(watcher);
+}
+
+
+void StatWatcherSet::Unwatch(StatWatcher* watcher) {
+  if (watcher->wd_ == -1)
+    return;
+  auto it = watches_.find(watcher->wd_);
+  watcher->wd_ = -1;
+  if (it == watches_.end())
+    return;
+
+  auto& names = it->second;
+  auto range = names.equal_range(
+      watcher->path_.substr(watcher->path_.find_last_of('/') + 1));
+  for (auto entry = range.first; entry != range.second; ++entry) {
+    if (entry->second == watcher) {
+      names.erase(entry);
+      break;
+    }
+  }
+  if (names.empty()) {
+    inotify_rm_watch(inotify_fd_, it->first);
+    watches_.erase(it);
+  }
+}
+
+
+void StatWatcherSet::OnInotify(uv_poll_t* handle, int status, int events) {
+  StatWatcherSet* set = static_cast<StatWatcherSet*>(handle->data);
+  if (status != 0)
+    return;
+
+  char buf[4096]
+      __attribute__((aligned(__alignof__(struct inotify_event))));
+  for (;;) {
+    ssize_t size;
+    do {
+      size = read(set->inotify_fd_, buf, sizeof(buf));
+    } while (size == -1 && errno == EINTR);
+    if (size <= 0)
+      return;
+
+    const struct inotify_event* event;
+    for (char* p = buf; p < buf + size; p += sizeof(*event) + event->len) {
+      event = reinterpret_cast<const struct inotify_event*>(p);
+
+      // Events have been lost, so anything may have changed.
+      if (event->mask & IN_Q_OVERFLOW) {
+        for (auto& watch : set->watches_) {
+          for (auto& entry : watch.second)
+            set->MarkDirty(entry.second);
+        }
+        continue;
+      }
+
+      auto it = set->watches_.find(event->wd);
+      if (it == set->watches_.end())
+        continue;
+
+      if (event->len > 0) {
+        auto range = it->second.equal_range(event->name);
+        for (auto entry = range.first; entry != range.second; ++entry)
+          set->MarkDirty(entry->second);
+        continue;
+      }
+
+      // The directory itself is gone. Its files are polled until the next
+      // stat() finds a directory to watch again.
+      if (event->mask & (IN_DELETE_SELF | IN_MOVE_SELF | IN_IGNORED)) {
+        for (auto& entry : it->second) {
+          entry.second->wd_ = -1;
+          set->MarkDirty(entry.second);
+        }
+        inotify_rm_watch(set->inotify_fd_, it->first);
+        set->watches_.erase(it);
+      }
+    }
+  }
+}
+#endif  // __linux__
+
+
 }  // namespace node
@@ -30,6 +30,12 @@
 #include "uv.h"
 #include "v8.h"
 
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
 namespace node {
 
 class StatWatcher : public AsyncWrap {
@@ -49,14 +55,93 @@ class StatWatcher : public AsyncWrap {
   size_t self_size() const override { return sizeof(*this); }
 
  private:
-  static void Callback(uv_fs_poll_t* handle,
-                       int status,
-                       const uv_stat_t* prev,
-                       const uv_stat_t* curr);
+  friend class StatWatcherSet;
+
+  // Called with the result of every stat() of path_. Like uv_fs_poll_t does,
+  // calls back into JS if it differs from the previous one.
+  void OnStat(int status, const uv_stat_t* stat);
+  void Callback(int status, const uv_stat_t* prev, const uv_stat_t* curr);
   void Stop();
   bool IsActive();
 
-  uv_fs_poll_t* watcher_;
+  std::string path_;
+  unsigned int interval_ = 0;
+  bool persistent_ = true;
+  // Unique among all the watchers that have been started in the
+  // Environment, and 0 while stopped.
+  uint64_t id_ = 0;
+  int busy_polling_ = 0;
+  uv_stat_t statbuf_;
+  // The inotify watch descriptor of the parent directory of path_, or -1 if
+  // path_ is polled.
+  int wd_ = -1;
+  // Whether path_ is to be stat()ed as soon as possible.
+  bool dirty_ = false;
+};
+
+// Stats the files of all active StatWatchers of an Environment. On Linux,
+// regular files on local file systems are watched through inotify on their
+// parent directories, and only stat()ed when they may have changed. All
+// other files are polled: watchers with the same interval share a timer, and
+// every tick stats all of their files in a single thread pool job.
+class StatWatcherSet {
+ public:
+  explicit StatWatcherSet(Environment* env);
+  ~StatWatcherSet();
+
+  void Add(StatWatcher* watcher);
+  void Remove(StatWatcher* watcher);
+
+ private:
+  class Sweep;
+
+  struct Group {
+    uv_timer_t* timer = nullptr;
+    std::unordered_set<StatWatcher*> watchers;
+    size_t persistent = 0;
+    bool sweeping = false;
+  };
+
+  // Stats the files of `watchers` in the thread pool. `interval` is the one
+  // of the group that is swept, or 0 for the watchers marked as dirty.
+  void StartSweep(const std::vector<StatWatcher*>& watchers,
+                  unsigned int interval);
+  void OnSweepDone(Sweep* sweep);
+  void MarkDirty(StatWatcher* watcher);
+  void SweepDirty();
+  void UpdateRef(Group* group);
+  void Close();
+
+  static void OnGroupTimer(uv_timer_t* handle);
+  static void OnDirtyTimer(uv_timer_t* handle);
+
+#ifdef __linux__
+  // Switches `watcher` between inotify and polling according to the result
+  // of the latest stat() of its file, and whether the file is a symbolic link.
+  void UpdateWatch(StatWatcher* watcher,
+                   int status,
+                   const uv_stat_t* stat,
+                   bool is_link);
+  void Watch(StatWatcher* watcher);
+  void Unwatch(StatWatcher* watcher);
+
+  static void OnInotify(uv_poll_t* handle, int status, int events);
+
+  int inotify_fd_ = -1;
+  uv_poll_t inotify_poll_;
+  // The watchers of the files in each watched directory, by name.
+  std::unordered_map<int, std::unordered_multimap<std::string, StatWatcher*>>
+      watches_;
+#endif
+
+  Environment* const env_;
+  std::unordered_map<uint64_t, StatWatcher*> watchers_;
+  uint64_t next_id_ = 1;
+  std::map<unsigned int, Group> groups_;
+  std::vector<uint64_t> dirty_;
+  uv_timer_t dirty_timer_;
+  bool dirty_sweeping_ = false;
+  bool closing_ = false;
 };
 
 }  // namespace node
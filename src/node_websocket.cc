@@ -0,0 +1,601 @@
+#include "node.h"
+#include "node_buffer.h"
+#include "node_internals.h"
+
+#include "async_wrap-inl.h"
+#include "env-inl.h"
+#include "stream_base-inl.h"
+#include "util-inl.h"
+#include "v8.h"
+
+#include <stdlib.h>  // free()
+#include <string.h>  // memcpy()
+#include <vector>
+
+// A WebSocket frame codec, see RFC 6455.
+//
+// WebSocketParser can either be fed data through `execute()` or consume a
+// stream in the same way the HTTP parser does. Frames are unmasked and
+// fragmented messages are reassembled natively, so that JS land is called
+// once per complete message rather than once per read or frame.
+
+namespace node {
+namespace {
+
+using v8::Boolean;
+using v8::Context;
+using v8::External;
+using v8::Function;
+using v8::FunctionCallbackInfo;
+using v8::FunctionTemplate;
+using v8::HandleScope;
+using v8::Integer;
+using v8::Local;
+using v8::MaybeLocal;
+using v8::Object;
+using v8::String;
+using v8::Value;
+
+const uint32_t kOnMessage = 0;
+const uint32_t kOnPing = 1;
+const uint32_t kOnPong = 2;
+const uint32_t kOnClose = 3;
+const uint32_t kOnError = 4;
+
+enum Opcode : uint8_t {
+  kContinuation = 0x0,
+  kText = 0x1,
+  kBinary = 0x2,
+  kClose = 0x8,
+  kPing = 0x9,
+  kPong = 0xa
+};
+
+// Status codes used to report protocol violations by the peer.
+const uint16_t kCloseNoStatus = 1005;
+const uint16_t kCloseProtocolError = 1002;
+const uint16_t kCloseInvalidPayload = 1007;
+const uint16_t kCloseMessageTooBig = 1009;
+
+const size_t kMaxControlPayload = 125;
+
+
+// XORs `length` bytes of `src` with the repeating four byte `mask` into
+// `dst`, eight bytes at a time. `dst` and `src` may be the same.
+void ApplyMask(uint8_t* dst,
+               const uint8_t* src,
+               size_t length,
+               const uint8_t* mask) {
+  uint32_t mask32;
+  memcpy(&mask32, mask, sizeof(mask32));
+  const uint64_t mask64 = (static_cast<uint64_t>(mask32) << 32) | mask32;
+
+  size_t i = 0;
+  for (; i + sizeof(mask64) <= length; i += sizeof(mask64)) {
+    uint64_t word;
+    memcpy(&word, src + i, sizeof(word));
+    word ^= mask64;
+    memcpy(dst + i, &word, sizeof(word));
+  }
+  for (; i < length; i++)
+    dst[i] = src[i] ^ mask[i & 3];
+}
+
+
+// Rejects overlong encodings, surrogates and code points above U+10FFFF.
+bool IsValidUtf8(const uint8_t* data, size_t length) {
+  size_t i = 0;
+  while (i < length) {
+    // Skip over runs of ASCII eight bytes at a time.
+    if (i + 8 <= length) {
+      uint64_t word;
+      memcpy(&word, data + i, sizeof(word));
+      if ((word & 0x8080808080808080ULL) == 0) {
+        i += 8;
+        continue;
+      }
+    }
+
+    const uint8_t c = data[i];
+    if (c < 0x80) {
+      i++;
+      continue;
+    }
+
+    size_t continuation;
+    uint32_t code_point;
+    uint32_t min;
+    if ((c & 0xe0) == 0xc0) {
+      continuation = 1;
+      code_point = c & 0x1f;
+      min = 0x80;
+    } else if ((c & 0xf0) == 0xe0) {
+      continuation = 2;
+      code_point = c & 0x0f;
+      min = 0x800;
+    } else if ((c & 0xf8) == 0xf0) {
+      continuation = 3;
+      code_point = c & 0x07;
+      min = 0x10000;
+    } else {
+      return false;
+    }
+
+    if (length - i <= continuation)
+      return false;
+    for (size_t n = 1; n <= continuation; n++) {
+      const uint8_t next = data[i + n];
+      if ((next & 0xc0) != 0x80)
+        return false;
+      code_point = (code_point << 6) | (next & 0x3f);
+    }
+    if (code_point < min ||
+        code_point > 0x10ffff ||
+        (code_point >= 0xd800 && code_point <= 0xdfff)) {
+      return false;
+    }
+    i += continuation + 1;
+  }
+  return true;
+}
+
+
+bool IsValidCloseCode(uint16_t code) {
+  return (code >= 1000 && code <= 1003) ||
+         (code >= 1007 && code <= 1014) ||
+         (code >= 3000 && code <= 4999);
+}
+
+
+class WebSocketParser : public AsyncWrap, public StreamListener {
+ public:
+  WebSocketParser(Environment* env,
+                  Local<Object> wrap,
+                  bool is_server,
+                  size_t max_payload)
+      : AsyncWrap(env, wrap, AsyncWrap::PROVIDER_WEBSOCKETPARSER),
+        is_server_(is_server),
+        max_payload_(max_payload) {
+    MakeWeak();
+  }
+
+  ~WebSocketParser() override {
+    free(message_);
+  }
+
+  size_t self_size() const override {
+    return sizeof(*this) + pending_.capacity() + message_capacity_;
+  }
+
+  // new WebSocketParser(isServer, maxPayload)
+  static void New(const FunctionCallbackInfo<Value>& args) {
+    Environment* env = Environment::GetCurrent(args);
+    CHECK(args.IsConstructCall());
+    CHECK(args[1]->IsNumber());
+    int64_t max_payload = args[1]->IntegerValue(env->context()).FromJust();
+    CHECK_GE(max_payload, 0);
+    new WebSocketParser(env, args.This(), args[0]->IsTrue(),
+                        static_cast<size_t>(max_payload));
+  }
+
+  // parser.execute(buffer)
+  static void Execute(const FunctionCallbackInfo<Value>& args) {
+    WebSocketParser* parser;
+    ASSIGN_OR_RETURN_UNWRAP(&parser, args.Holder());
+    CHECK(Buffer::HasInstance(args[0]));
+    // Callbacks run in the middle of parsing, so data that they pass back in
+    // would be handled out of order.
+    if (parser->parsing_) {
+      return parser->env()->ThrowError(
+          "execute() cannot be called from a parser callback");
+    }
+    parser->Parse(Buffer::Data(args[0]), Buffer::Length(args[0]));
+  }
+
+  // parser.close() stops parsing and releases the stream, if any. Data that
+  // arrives afterwards is discarded.
+  static void Close(const FunctionCallbackInfo<Value>& args) {
+    WebSocketParser* parser;
+    ASSIGN_OR_RETURN_UNWRAP(&parser, args.Holder());
+    parser->closed_ = true;
+    if (parser->stream_ != nullptr)
+      parser->stream_->RemoveStreamListener(parser);
+  }
+
+  static void Consume(const FunctionCallbackInfo<Value>& args) {
+    WebSocketParser* parser;
+    ASSIGN_OR_RETURN_UNWRAP(&parser, args.Holder());
+    CHECK(args[0]->IsExternal());
+    Local<External> stream_obj = args[0].As<External>();
+    StreamBase* stream = static_cast<StreamBase*>(stream_obj->Value());
+    CHECK_NOT_NULL(stream);
+    stream->PushStreamListener(parser);
+  }
+
+  static void Unconsume(const FunctionCallbackInfo<Value>& args) {
+    WebSocketParser* parser;
+    ASSIGN_OR_RETURN_UNWRAP(&parser, args.Holder());
+
+    // Already unconsumed
+    if (parser->stream_ == nullptr)
+      return;
+
+    parser->stream_->RemoveStreamListener(parser);
+  }
+
+ protected:
+  void OnStreamRead(ssize_t nread, const uv_buf_t& buf) override {
+    HandleScope handle_scope(env()->isolate());
+    Context::Scope context_scope(env()->context());
+    OnScopeLeave on_scope_leave([&]() { free(buf.base); });
+
+    if (nread < 0) {
+      PassReadErrorToPreviousListener(nread);
+      return;
+    }
+
+    // Reads are not delivered while a callback is running, since the loop
+    // does not get to run in between.
+    CHECK(!parsing_);
+    Parse(buf.base, nread);
+  }
+
+ private:
+  void Parse(const char* data, size_t length) {
+    if (closed_ || length == 0)
+      return;
+
+    parsing_ = true;
+    const uint8_t* input = reinterpret_cast<const uint8_t*>(data);
+    if (pending_.empty()) {
+      const size_t consumed = ParseFrames(input, length);
+      if (!closed_)
+        pending_.assign(input + consumed, input + length);
+    } else {
+      pending_.insert(pending_.end(), input, input + length);
+      const size_t consumed = ParseFrames(pending_.data(), pending_.size());
+      pending_.erase(pending_.begin(), pending_.begin() + consumed);
+    }
+    if (closed_)
+      pending_.clear();
+    parsing_ = false;
+  }
+
+  // Handles all complete frames in `data` and returns the number of bytes
+  // that they took up.
+  size_t ParseFrames(const uint8_t* data, size_t length) {
+    size_t offset = 0;
+    while (!closed_ && length - offset >= 2) {
+      const uint8_t* frame = data + offset;
+      const size_t available = length - offset;
+
+      const bool fin = (frame[0] & 0x80) != 0;
+      const uint8_t opcode = frame[0] & 0x0f;
+      const bool masked = (frame[1] & 0x80) != 0;
+      uint64_t payload_length = frame[1] & 0x7f;
+      size_t header_length = 2;
+      if (payload_length == 126) {
+        if (available < 4)
+          break;
+        payload_length = (frame[2] << 8) | frame[3];
+        header_length = 4;
+      } else if (payload_length == 127) {
+        if (available < 10)
+          break;
+        payload_length = 0;
+        for (size_t i = 2; i < 10; i++)
+          payload_length = (payload_length << 8) | frame[i];
+        header_length = 10;
+      }
+      if (masked)
+        header_length += 4;
+
+      if ((frame[0] & 0x70) != 0)
+        return Fail(kCloseProtocolError, "Reserved bits must be clear");
+      if (masked != is_server_) {
+        return Fail(kCloseProtocolError,
+                    is_server_ ? "Frames from clients must be masked" :
+                                 "Frames from servers must not be masked");
+      }
+
+      if (opcode >= kClose) {
+        if (opcode != kClose && opcode != kPing && opcode != kPong)
+          return Fail(kCloseProtocolError, "Invalid opcode");
+        if (!fin)
+          return Fail(kCloseProtocolError, "Fragmented control frame");
+        if (payload_length > kMaxControlPayload)
+          return Fail(kCloseProtocolError, "Control frame too large");
+      } else if (opcode == kContinuation) {
+        if (!fragmented_)
+          return Fail(kCloseProtocolError, "Unexpected continuation frame");
+      } else if (opcode == kText || opcode == kBinary) {
+        if (fragmented_)
+          return Fail(kCloseProtocolError, "Expected continuation frame");
+      } else {
+        return Fail(kCloseProtocolError, "Invalid opcode");
+      }
+
+      if (opcode < kClose && max_payload_ > 0 &&
+          payload_length > max_payload_ - message_length_) {
+        return Fail(kCloseMessageTooBig, "Message too big");
+      }
+
+      if (available < header_length ||
+          available - header_length < payload_length) {
+        break;
+      }
+
+      const uint8_t* mask = masked ? frame + header_length - 4 : nullptr;
+      const uint8_t* payload = frame + header_length;
+      const size_t size = static_cast<size_t>(payload_length);
+      offset += header_length + size;
+
+      if (opcode >= kClose) {
+        OnControlFrame(opcode, payload, size, mask);
+        continue;
+      }
+
+      if (opcode != kContinuation) {
+        message_opcode_ = opcode;
+        message_length_ = 0;
+      }
+      AppendToMessage(payload, size, mask);
+      fragmented_ = !fin;
+      if (fin)
+        OnMessage();
+    }
+    return offset;
+  }
+
+  void AppendToMessage(const uint8_t* payload,
+                       size_t length,
+                       const uint8_t* mask) {
+    if (length == 0)
+      return;
+    if (message_length_ + length > message_capacity_) {
+      message_capacity_ = message_length_ + length;
+      message_ = Realloc(message_, message_capacity_);
+    }
+    uint8_t* dst = reinterpret_cast<uint8_t*>(message_) + message_length_;
+    if (mask != nullptr)
+      ApplyMask(dst, payload, length, mask);
+    else
+      memcpy(dst, payload, length);
+    message_length_ += length;
+  }
+
+  void OnMessage() {
+    const bool is_text = message_opcode_ == kText;
+    if (is_text &&
+        !IsValidUtf8(reinterpret_cast<uint8_t*>(message_), message_length_)) {
+      Fail(kCloseInvalidPayload, "Invalid UTF-8 sequence");
+      return;
+    }
+
+    Local<Object> buffer;
+    if (message_length_ == 0) {
+      buffer = Buffer::New(env(), static_cast<size_t>(0)).ToLocalChecked();
+    } else {
+      // The buffer takes over the memory of the message.
+      buffer =
+          Buffer::New(env(), message_, message_length_).ToLocalChecked();
+      message_ = nullptr;
+      message_capacity_ = 0;
+    }
+    message_length_ = 0;
+
+    Local<Value> argv[] = {
+      buffer,
+      Boolean::New(env()->isolate(), is_text)
+    };
+    Emit(kOnMessage, arraysize(argv), argv);
+  }
+
+  void OnControlFrame(uint8_t opcode,
+                      const uint8_t* payload,
+                      size_t length,
+                      const uint8_t* mask) {
+    uint8_t data[kMaxControlPayload];
+    if (mask != nullptr)
+      ApplyMask(data, payload, length, mask);
+    else if (length > 0)
+      memcpy(data, payload, length);
+
+    if (opcode != kClose) {
+      Local<Value> argv[] = {
+        Buffer::Copy(env(), reinterpret_cast<char*>(data),
+                     length).ToLocalChecked()
+      };
+      Emit(opcode == kPing ? kOnPing : kOnPong, arraysize(argv), argv);
+      return;
+    }
+
+    // Nothing is expected after a close frame.
+    closed_ = true;
+
+    uint16_t code = kCloseNoStatus;
+    if (length == 1) {
+      Fail(kCloseProtocolError, "Invalid close frame");
+      return;
+    }
+    if (length >= 2) {
+      code = (data[0] << 8) | data[1];
+      if (!IsValidCloseCode(code)) {
+        Fail(kCloseProtocolError, "Invalid close code");
+        return;
+      }
+      if (!IsValidUtf8(data + 2, length - 2)) {
+        Fail(kCloseInvalidPayload, "Invalid UTF-8 sequence");
+        return;
+      }
+    }
+
+    Local<Value> argv[] = {
+      Integer::New(env()->isolate(), code),
+      String::NewFromUtf8(env()->isolate(),
+                          reinterpret_cast<char*>(data) + 2,
+                          v8::NewStringType::kNormal,
+                          length > 2 ? length - 2 : 0).ToLocalChecked()
+    };
+    Emit(kOnClose, arraysize(argv), argv);
+  }
+
+  // Reports a protocol violation and stops parsing. Returns 0 so that it can
+  // be returned from ParseFrames() directly.
+  size_t Fail(uint16_t code, const char* message) {
+    closed_ = true;
+    Local<Value> argv[] = {
+      Integer::New(env()->isolate(), code),
+      OneByteString(env()->isolate(), message)
+    };
+    Emit(kOnError, arraysize(argv), argv);
+    return 0;
+  }
+
+  void Emit(uint32_t index, int argc, Local<Value>* argv) {
+    Local<Value> cb =
+        object()->Get(env()->context(), index).ToLocalChecked();
+    if (!cb->IsFunction())
+      return;
+
+    MaybeLocal<Value> r = MakeCallback(cb.As<Function>(), argc, argv);
+
+    // The state of the connection is unknown after an exception.
+    if (r.IsEmpty())
+      closed_ = true;
+  }
+
+  const bool is_server_;
+  const size_t max_payload_;
+  bool closed_ = false;
+  bool parsing_ = false;
+  bool fragmented_ = false;
+  uint8_t message_opcode_ = kBinary;
+  // Bytes of an incomplete frame, kept until the rest of it arrives.
+  std::vector<uint8_t> pending_;
+  char* message_ = nullptr;
+  size_t message_length_ = 0;
+  size_t message_capacity_ = 0;
+};
+
+
+// encodeFrameHeader(opcode, fin, length[, mask])
+void EncodeFrameHeader(const FunctionCallbackInfo<Value>& args) {
+  Environment* env = Environment::GetCurrent(args);
+  CHECK(args[0]->IsUint32());
+  CHECK(args[2]->IsNumber());
+  const uint8_t opcode = args[0].As<v8::Uint32>()->Value() & 0x0f;
+  const bool fin = args[1]->IsTrue();
+  const int64_t length = args[2]->IntegerValue(env->context()).FromJust();
+  CHECK_GE(length, 0);
+  const bool masked = !args[3]->IsUndefined();
+  if (masked) {
+    CHECK(Buffer::HasInstance(args[3]));
+    CHECK_EQ(Buffer::Length(args[3]), 4);
+  }
+
+  uint8_t header[14];
+  size_t n = 0;
+  const uint8_t mask_bit = masked ? 0x80 : 0;
+  header[n++] = (fin ? 0x80 : 0) | opcode;
+  if (length < 126) {
+    header[n++] = mask_bit | static_cast<uint8_t>(length);
+  } else if (length <= 0xffff) {
+    header[n++] = mask_bit | 126;
+    header[n++] = static_cast<uint8_t>(length >> 8);
+    header[n++] = static_cast<uint8_t>(length);
+  } else {
+    header[n++] = mask_bit | 127;
+    for (int shift = 56; shift >= 0; shift -= 8)
+      header[n++] = static_cast<uint8_t>(length >> shift);
+  }
+  if (masked) {
+    memcpy(header + n, Buffer::Data(args[3]), 4);
+    n += 4;
+  }
+
+  args.GetReturnValue().Set(
+      Buffer::Copy(env, reinterpret_cast<char*>(header), n).ToLocalChecked());
+}
+
+
+// mask(source, mask, output, offset, length)
+void Mask(const FunctionCallbackInfo<Value>& args) {
+  CHECK(Buffer::HasInstance(args[0]));
+  CHECK(Buffer::HasInstance(args[1]));
+  CHECK(Buffer::HasInstance(args[2]));
+  CHECK(args[3]->IsUint32());
+  CHECK(args[4]->IsUint32());
+  CHECK_EQ(Buffer::Length(args[1]), 4);
+  const size_t offset = args[3].As<v8::Uint32>()->Value();
+  const size_t length = args[4].As<v8::Uint32>()->Value();
+  CHECK_LE(length, Buffer::Length(args[0]));
+  CHECK_LE(offset, Buffer::Length(args[2]));
+  CHECK_LE(length, Buffer::Length(args[2]) - offset);
+
+  ApplyMask(reinterpret_cast<uint8_t*>(Buffer::Data(args[2])) + offset,
+            reinterpret_cast<uint8_t*>(Buffer::Data(args[0])),
+            length,
+            reinterpret_cast<uint8_t*>(Buffer::Data(args[1])));
+}
+
+
+// unmask(buffer, mask)
+void Unmask(const FunctionCallbackInfo<Value>& args) {
+  CHECK(Buffer::HasInstance(args[0]));
+  CHECK(Buffer::HasInstance(args[1]));
+  CHECK_EQ(Buffer::Length(args[1]), 4);
+  uint8_t* data = reinterpret_cast<uint8_t*>(Buffer::Data(args[0]));
+  ApplyMask(data, data, Buffer::Length(args[0]),
+            reinterpret_cast<uint8_t*>(Buffer::Data(args[1])));
+}
+
+
+// isValidUTF8(buffer)
+void IsValidUtf8Buffer(const FunctionCallbackInfo<Value>& args) {
+  CHECK(Buffer::HasInstance(args[0]));
+  args.GetReturnValue().Set(
+      IsValidUtf8(reinterpret_cast<uint8_t*>(Buffer::Data(args[0])),
+                  Buffer::Length(args[0])));
+}
+
+
+void Initialize(Local<Object> target,
+                Local<Value> unused,
+                Local<Context> context,
+                void* priv) {
+  Environment* env = Environment::GetCurrent(context);
+  Local<FunctionTemplate> t = env->NewFunctionTemplate(WebSocketParser::New);
+  t->InstanceTemplate()->SetInternalFieldCount(1);
+  Local<String> name =
+      FIXED_ONE_BYTE_STRING(env->isolate(), "WebSocketParser");
+  t->SetClassName(name);
+
+#define V(index)                                                              \
+  t->Set(FIXED_ONE_BYTE_STRING(env->isolate(), #index),                       \
+         Integer::NewFromUnsigned(env->isolate(), index));
+  V(kOnMessage)
+  V(kOnPing)
+  V(kOnPong)
+  V(kOnClose)
+  V(kOnError)
+#undef V
+
+  AsyncWrap::AddWrapMethods(env, t);
+  env->SetProtoMethod(t, "execute", WebSocketParser::Execute);
+  env->SetProtoMethod(t, "close", WebSocketParser::Close);
+  env->SetProtoMethod(t, "consume", WebSocketParser::Consume);
+  env->SetProtoMethod(t, "unconsume", WebSocketParser::Unconsume);
+  target->Set(context, name, t->GetFunction(context).ToLocalChecked())
+      .FromJust();
+
+  env->SetMethod(target, "encodeFrameHeader", EncodeFrameHeader);
+  env->SetMethod(target, "mask", Mask);
+  env->SetMethod(target, "unmask", Unmask);
+  env->SetMethod(target, "isValidUTF8", IsValidUtf8Buffer);
+}
+
+}  // anonymous namespace
+}  // namespace node
+
+NODE_BUILTIN_MODULE_CONTEXT_AWARE(websocket, node::Initialize)
@@ -93,6 +93,8 @@ void PipeWrap::Initialize(Local<Object> target,
   env->SetProtoMethod(t, "listen", Listen);
   env->SetProtoMethod(t, "connect", Connect);
   env->SetProtoMethod(t, "open", Open);
+  env->SetProtoMethod(t, "setRejectConnections", SetRejectConnections);
+  env->SetProtoMethod(t, "getRejectedConnections", GetRejectedConnections);
 
 #ifdef _WIN32
   env->SetProtoMethod(t, "setPendingInstances", SetPendingInstances);
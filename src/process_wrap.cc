@@ -22,6 +22,7 @@
 #include "env-inl.h"
 #include "handle_wrap.h"
 #include "node_internals.h"
+#include "node_spawn_zygote.h"
 #include "node_wrap.h"
 #include "stream_base-inl.h"
 #include "util-inl.h"
@@ -256,14 +257,27 @@ class ProcessWrap : public HandleWrap {
       options.flags |= UV_PROCESS_DETACHED;
     }
 
-    int err = uv_spawn(env->event_loop(), &wrap->process_, &options);
+    int pid = 0;
+    uint64_t zygote_child = 0;
+    int err = zygote::Spawn(env, &options, OnZygoteExit, wrap, &pid,
+                            &zygote_child);
+    if (err == UV_ENOSYS) {
+      err = uv_spawn(env->event_loop(), &wrap->process_, &options);
+      if (err == 0) {
+        CHECK_EQ(wrap->process_.data, wrap);
+        pid = wrap->process_.pid;
+      }
+    } else {
+      CHECK_EQ(uv_async_init(env->event_loop(), &wrap->zygote_process_,
+                             nullptr), 0);
+      wrap->spawned_by_zygote_ = true;
+      wrap->zygote_child_ = zygote_child;
+    }
     wrap->MarkAsInitialized();
 
     if (err == 0) {
-      CHECK_EQ(wrap->process_.data, wrap);
       wrap->object()->Set(context, env->pid_string(),
-                          Integer::New(env->isolate(),
-                                       wrap->process_.pid)).FromJust();
+                          Integer::New(env->isolate(), pid)).FromJust();
     }
 
     if (options.args) {
@@ -286,7 +300,13 @@ class ProcessWrap : public HandleWrap {
     ProcessWrap* wrap;
     ASSIGN_OR_RETURN_UNWRAP(&wrap, args.Holder());
     int signal = args[0]->Int32Value(env->context()).FromJust();
-    int err = uv_process_kill(&wrap->process_, signal);
+    int err;
+    if (!wrap->spawned_by_zygote_)
+      err = uv_process_kill(&wrap->process_, signal);
+    else if (wrap->zygote_child_ != 0)
+      err = zygote::Kill(wrap->zygote_child_, signal);
+    else  // The child has exited, or was never spawned.
+      err = UV_ESRCH;
     args.GetReturnValue().Set(err);
   }
 
@@ -296,20 +316,42 @@ class ProcessWrap : public HandleWrap {
     ProcessWrap* wrap = static_cast<ProcessWrap*>(handle->data);
     CHECK_NOT_NULL(wrap);
     CHECK_EQ(&wrap->process_, handle);
+    wrap->OnExit(exit_status, term_signal);
+  }
 
-    Environment* env = wrap->env();
-    HandleScope handle_scope(env->isolate());
-    Context::Scope context_scope(env->context());
+  static void OnZygoteExit(void* data, int64_t exit_status, int term_signal) {
+    ProcessWrap* wrap = static_cast<ProcessWrap*>(data);
+    wrap->zygote_child_ = 0;
+    wrap->OnExit(exit_status, term_signal);
+  }
+
+  void OnExit(int64_t exit_status, int term_signal) {
+    HandleScope handle_scope(env()->isolate());
+    Context::Scope context_scope(env()->context());
 
     Local<Value> argv[] = {
-      Number::New(env->isolate(), static_cast<double>(exit_status)),
-      OneByteString(env->isolate(), signo_string(term_signal))
+      Number::New(env()->isolate(), static_cast<double>(exit_status)),
+      OneByteString(env()->isolate(), signo_string(term_signal))
     };
 
-    wrap->MakeCallback(env->onexit_string(), arraysize(argv), argv);
+    MakeCallback(env()->onexit_string(), arraysize(argv), argv);
+  }
+
+  void OnClose() override {
+    if (zygote_child_ != 0)
+      zygote::Forget(zygote_child_);
   }
 
-  uv_process_t process_;
+  // Processes that are spawned through the zygote are not children of this
+  // process and are tracked by the zygote instead. Their handle only keeps
+  // the event loop alive, like the process handle would.
+  union {
+    uv_process_t process_;
+    uv_async_t zygote_process_;
+  };
+  bool spawned_by_zygote_ = false;
+  // The zygote's id for the child, or 0 once it has exited.
+  uint64_t zygote_child_ = 0;
 };
 
 
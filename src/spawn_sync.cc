@@ -20,6 +20,7 @@
 // USE OR OTHER DEALINGS IN THE SOFTWARE.
 
 #include "spawn_sync.h"
+#include "async_wrap-inl.h"
 #include "env-inl.h"
 #include "string_bytes.h"
 #include "util.h"
@@ -33,6 +34,7 @@ using v8::Array;
 using v8::Context;
 using v8::EscapableHandleScope;
 using v8::FunctionCallbackInfo;
+using v8::FunctionTemplate;
 using v8::HandleScope;
 using v8::Integer;
 using v8::Isolate;
@@ -107,6 +109,7 @@ SyncProcessStdioPipe::SyncProcessStdioPipe(SyncProcessRunner* process_handler,
       uv_pipe_(),
       write_req_(),
       shutdown_req_(),
+      reading_(false),
 
       lifecycle_(kUninitialized) {
   CHECK(readable || writable);
@@ -158,17 +161,21 @@ int SyncProcessStdioPipe::Start() {
                        WriteCallback);
       if (r < 0)
         return r;
+      process_handler_->pending_operations_++;
     }
 
     int r = uv_shutdown(&shutdown_req_, uv_stream(), ShutdownCallback);
     if (r < 0)
       return r;
+    process_handler_->pending_operations_++;
   }
 
   if (writable()) {
     int r = uv_read_start(uv_stream(), AllocCallback, ReadCallback);
     if (r < 0)
       return r;
+    process_handler_->pending_operations_++;
+    reading_ = true;
   }
 
   return 0;
@@ -181,6 +188,12 @@ void SyncProcessStdioPipe::Close() {
   uv_close(uv_handle(), CloseCallback);
 
   lifecycle_ = kClosing;
+
+  // Closing the pipe stops reading without a final read callback.
+  if (reading_) {
+    reading_ = false;
+    process_handler_->DecrementPendingOperations();
+  }
 }
 
 
@@ -276,11 +289,15 @@ void SyncProcessStdioPipe::OnAlloc(size_t suggested_size, uv_buf_t* buf) {
 void SyncProcessStdioPipe::OnRead(const uv_buf_t* buf, ssize_t nread) {
   if (nread == UV_EOF) {
     // Libuv implicitly stops reading on EOF.
+    reading_ = false;
+    process_handler_->DecrementPendingOperations();
 
   } else if (nread < 0) {
     SetError(static_cast<int>(nread));
     // At some point libuv should really implicitly stop reading on error.
     uv_read_stop(uv_stream());
+    reading_ = false;
+    process_handler_->DecrementPendingOperations();
 
   } else {
     last_output_buffer_->OnRead(buf, nread);
@@ -292,17 +309,20 @@ void SyncProcessStdioPipe::OnRead(const uv_buf_t* buf, ssize_t nread) {
 void SyncProcessStdioPipe::OnWriteDone(int result) {
   if (result < 0)
     SetError(result);
+  process_handler_->DecrementPendingOperations();
 }
 
 
 void SyncProcessStdioPipe::OnShutdownDone(int result) {
   if (result < 0)
     SetError(result);
+  process_handler_->DecrementPendingOperations();
 }
 
 
 void SyncProcessStdioPipe::OnClose() {
   lifecycle_ = kClosed;
+  process_handler_->OnHandleClosed();
 }
 
 
@@ -364,6 +384,7 @@ void SyncProcessRunner::Initialize(Local<Object> target,
                                    Local<Context> context) {
   Environment* env = Environment::GetCurrent(context);
   env->SetMethod(target, "spawn", Spawn);
+  ProcessRunnerWrap::Initialize(env, target);
 }
 
 
@@ -376,7 +397,8 @@ void SyncProcessRunner::Spawn(const FunctionCallbackInfo<Value>& args) {
 }
 
 
-SyncProcessRunner::SyncProcessRunner(Environment* env)
+SyncProcessRunner::SyncProcessRunner(Environment* env,
+                                     ProcessRunnerWrap* async_wrap)
     : max_buffer_(0),
       timeout_(0),
       kill_signal_(SIGTERM),
@@ -409,7 +431,12 @@ SyncProcessRunner::SyncProcessRunner(Environment* env)
 
       lifecycle_(kUninitialized),
 
-      env_(env) {
+      pending_operations_(0),
+      closing_handles_(0),
+      finishing_(false),
+
+      env_(env),
+      async_wrap_(async_wrap) {
 }
 
 
@@ -444,6 +471,19 @@ Local<Object> SyncProcessRunner::Run(Local<Value> options) {
 }
 
 
+void SyncProcessRunner::RunAsync(Local<Value> options) {
+  CHECK_NOT_NULL(async_wrap_);
+  CHECK_EQ(lifecycle_, kUninitialized);
+
+  TryInitializeAndRunLoop(options);
+
+  // If the process could not be started, or not all of its pipes, there is
+  // nothing to wait for. The callback is still deferred.
+  if (GetError() != 0 || pending_operations_ == 0)
+    ScheduleFinish();
+}
+
+
 void SyncProcessRunner::TryInitializeAndRunLoop(Local<Value> options) {
   int r;
 
@@ -452,10 +492,14 @@ void SyncProcessRunner::TryInitializeAndRunLoop(Local<Value> options) {
   CHECK_EQ(lifecycle_, kUninitialized);
   lifecycle_ = kInitialized;
 
-  uv_loop_ = new uv_loop_t;
-  if (uv_loop_ == nullptr)
-    return SetError(UV_ENOMEM);
-  CHECK_EQ(uv_loop_init(uv_loop_), 0);
+  if (async_wrap_ != nullptr) {
+    uv_loop_ = env()->event_loop();
+  } else {
+    uv_loop_ = new uv_loop_t;
+    if (uv_loop_ == nullptr)
+      return SetError(UV_ENOMEM);
+    CHECK_EQ(uv_loop_init(uv_loop_), 0);
+  }
 
   r = ParseOptions(options);
   if (r < 0)
@@ -485,6 +529,7 @@ void SyncProcessRunner::TryInitializeAndRunLoop(Local<Value> options) {
   if (r < 0)
     return SetError(r);
   uv_process_.data = this;
+  pending_operations_++;
 
   for (uint32_t i = 0; i < stdio_count_; i++) {
     SyncProcessStdioPipe* h = stdio_pipes_[i].get();
@@ -495,6 +540,10 @@ void SyncProcessRunner::TryInitializeAndRunLoop(Local<Value> options) {
     }
   }
 
+  // In asynchronous mode, the event loop of the environment takes over.
+  if (async_wrap_ != nullptr)
+    return;
+
   r = uv_run(uv_loop_, UV_RUN_DEFAULT);
   if (r < 0)
     // We can't handle uv_run failure.
@@ -505,22 +554,32 @@ void SyncProcessRunner::TryInitializeAndRunLoop(Local<Value> options) {
 }
 
 
+void SyncProcessRunner::CloseHandles() {
+  CHECK_NOT_NULL(uv_loop_);
+
+  CloseStdioPipes();
+  CloseKillTimer();
+  // Close the process handle when ExitCallback was not called.
+  uv_handle_t* uv_process_handle =
+      reinterpret_cast<uv_handle_t*>(&uv_process_);
+
+  // Close the process handle if it is still open. The handle type also
+  // needs to be checked because TryInitializeAndRunLoop() won't spawn a
+  // process if input validation fails.
+  if (uv_process_handle->type == UV_PROCESS &&
+      !uv_is_closing(uv_process_handle)) {
+    uv_process_handle->data = this;
+    closing_handles_++;
+    uv_close(uv_process_handle, ProcessCloseCallback);
+  }
+}
+
+
 void SyncProcessRunner::CloseHandlesAndDeleteLoop() {
   CHECK_LT(lifecycle_, kHandlesClosed);
 
   if (uv_loop_ != nullptr) {
-    CloseStdioPipes();
-    CloseKillTimer();
-    // Close the process handle when ExitCallback was not called.
-    uv_handle_t* uv_process_handle =
-        reinterpret_cast<uv_handle_t*>(&uv_process_);
-
-    // Close the process handle if it is still open. The handle type also
-    // needs to be checked because TryInitializeAndRunLoop() won't spawn a
-    // process if input validation fails.
-    if (uv_process_handle->type == UV_PROCESS &&
-        !uv_is_closing(uv_process_handle))
-      uv_close(uv_process_handle, nullptr);
+    CloseHandles();
 
     // Give closing watchers a chance to finish closing and get their close
     // callbacks called.
@@ -542,6 +601,52 @@ void SyncProcessRunner::CloseHandlesAndDeleteLoop() {
 }
 
 
+void SyncProcessRunner::DecrementPendingOperations() {
+  CHECK_GT(pending_operations_, 0);
+  if (--pending_operations_ == 0 && async_wrap_ != nullptr)
+    ScheduleFinish();
+}
+
+
+// Finishing is deferred because this may be called from Kill(), in the middle
+// of closing the stdio pipes.
+void SyncProcessRunner::ScheduleFinish() {
+  if (finishing_)
+    return;
+  finishing_ = true;
+
+  env()->SetImmediate([](Environment* env, void* data) {
+    static_cast<SyncProcessRunner*>(data)->Finish();
+  }, this, async_wrap_->object());
+}
+
+
+void SyncProcessRunner::Finish() {
+  CHECK_LT(lifecycle_, kHandlesClosing);
+
+  if (uv_loop_ != nullptr)
+    CloseHandles();
+  lifecycle_ = kHandlesClosing;
+
+  // Handles that were closed earlier, e.g. by ExitCallback, may still be
+  // waiting for their close callbacks.
+  if (closing_handles_ == 0)
+    OnHandleClosed();
+}
+
+
+void SyncProcessRunner::OnHandleClosed() {
+  if (closing_handles_ > 0)
+    closing_handles_--;
+
+  if (lifecycle_ != kHandlesClosing || closing_handles_ > 0)
+    return;
+
+  lifecycle_ = kHandlesClosed;
+  async_wrap_->OnComplete();
+}
+
+
 void SyncProcessRunner::CloseStdioPipes() {
   CHECK_LT(lifecycle_, kHandlesClosed);
 
@@ -550,8 +655,10 @@ void SyncProcessRunner::CloseStdioPipes() {
     CHECK_NOT_NULL(uv_loop_);
 
     for (uint32_t i = 0; i < stdio_count_; i++) {
-      if (stdio_pipes_[i])
+      if (stdio_pipes_[i]) {
+        closing_handles_++;
         stdio_pipes_[i]->Close();
+      }
     }
 
     stdio_pipes_initialized_ = false;
@@ -568,6 +675,7 @@ void SyncProcessRunner::CloseKillTimer() {
 
     uv_handle_t* uv_timer_handle = reinterpret_cast<uv_handle_t*>(&uv_timer_);
     uv_ref(uv_timer_handle);
+    closing_handles_++;
     uv_close(uv_timer_handle, KillTimerCloseCallback);
 
     kill_timer_initialized_ = false;
@@ -1055,8 +1163,10 @@ void SyncProcessRunner::ExitCallback(uv_process_t* handle,
                                      int64_t exit_status,
                                      int term_signal) {
   SyncProcessRunner* self = reinterpret_cast<SyncProcessRunner*>(handle->data);
-  uv_close(reinterpret_cast<uv_handle_t*>(handle), nullptr);
+  self->closing_handles_++;
+  uv_close(reinterpret_cast<uv_handle_t*>(handle), ProcessCloseCallback);
   self->OnExit(exit_status, term_signal);
+  self->DecrementPendingOperations();
 }
 
 
@@ -1067,7 +1177,69 @@ void SyncProcessRunner::KillTimerCallback(uv_timer_t* handle) {
 
 
 void SyncProcessRunner::KillTimerCloseCallback(uv_handle_t* handle) {
-  // No-op.
+  SyncProcessRunner* self = reinterpret_cast<SyncProcessRunner*>(handle->data);
+  self->OnHandleClosed();
+}
+
+
+void SyncProcessRunner::ProcessCloseCallback(uv_handle_t* handle) {
+  SyncProcessRunner* self = reinterpret_cast<SyncProcessRunner*>(handle->data);
+  self->OnHandleClosed();
+}
+
+
+ProcessRunnerWrap::ProcessRunnerWrap(Environment* env, Local<Object> object)
+    : AsyncWrap(env, object, AsyncWrap::PROVIDER_PROCESSRUNNERWRAP),
+      runner_(nullptr) {
+  MakeWeak();
+}
+
+
+ProcessRunnerWrap::~ProcessRunnerWrap() {
+  // The wrap is kept alive while the process runs.
+  delete runner_;
+}
+
+
+void ProcessRunnerWrap::New(const FunctionCallbackInfo<Value>& args) {
+  CHECK(args.IsConstructCall());
+  Environment* env = Environment::GetCurrent(args);
+  new ProcessRunnerWrap(env, args.This());
+}
+
+
+void ProcessRunnerWrap::Spawn(const FunctionCallbackInfo<Value>& args) {
+  ProcessRunnerWrap* wrap;
+  ASSIGN_OR_RETURN_UNWRAP(&wrap, args.Holder());
+  CHECK_NULL(wrap->runner_);
+
+  wrap->ClearWeak();
+  wrap->runner_ = new SyncProcessRunner(wrap->env(), wrap);
+  wrap->runner_->RunAsync(args[0]);
+}
+
+
+void ProcessRunnerWrap::OnComplete() {
+  HandleScope handle_scope(env()->isolate());
+  Context::Scope context_scope(env()->context());
+
+  Local<Value> argv[] = { runner_->BuildResultObject() };
+  MakeWeak();
+  MakeCallback(env()->oncomplete_string(), arraysize(argv), argv);
+}
+
+
+void ProcessRunnerWrap::Initialize(Environment* env, Local<Object> target) {
+  Local<FunctionTemplate> t = env->NewFunctionTemplate(New);
+  t->InstanceTemplate()->SetInternalFieldCount(1);
+  Local<String> runner_string =
+      FIXED_ONE_BYTE_STRING(env->isolate(), "ProcessRunner");
+  t->SetClassName(runner_string);
+
+  AsyncWrap::AddWrapMethods(env, t);
+  env->SetProtoMethod(t, "spawn", Spawn);
+
+  target->Set(env->context(), runner_string, t->GetFunction()).FromJust();
 }
 
 }  // namespace node
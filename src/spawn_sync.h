@@ -26,6 +26,7 @@
 
 #include "node_internals.h"
 #include "node_buffer.h"
+#include "async_wrap.h"
 
 namespace node {
 
@@ -46,6 +47,7 @@ using v8::Value;
 class SyncProcessOutputBuffer;
 class SyncProcessStdioPipe;
 class SyncProcessRunner;
+class ProcessRunnerWrap;
 
 
 class SyncProcessOutputBuffer {
@@ -138,6 +140,7 @@ class SyncProcessStdioPipe {
   mutable uv_pipe_t uv_pipe_;
   uv_write_t write_req_;
   uv_shutdown_t shutdown_req_;
+  bool reading_;
 
   Lifecycle lifecycle_;
 };
@@ -147,6 +150,7 @@ class SyncProcessRunner {
   enum Lifecycle {
     kUninitialized = 0,
     kInitialized,
+    kHandlesClosing,
     kHandlesClosed
   };
 
@@ -158,16 +162,30 @@ class SyncProcessRunner {
 
  private:
   friend class SyncProcessStdioPipe;
+  friend class ProcessRunnerWrap;
 
-  explicit SyncProcessRunner(Environment* env_);
+  // When `async_wrap` is set, the process runs on the event loop of `env`
+  // and `async_wrap` is told once it is done, see RunAsync().
+  explicit SyncProcessRunner(Environment* env_,
+                             ProcessRunnerWrap* async_wrap = nullptr);
   ~SyncProcessRunner();
 
   inline Environment* env() const;
 
   Local<Object> Run(Local<Value> options);
+  void RunAsync(Local<Value> options);
   void TryInitializeAndRunLoop(Local<Value> options);
+  void CloseHandles();
   void CloseHandlesAndDeleteLoop();
 
+  // Asynchronous mode only: once the process has exited, all input has been
+  // written and all output has been read, the handles are closed and the
+  // result is passed to the wrap.
+  void DecrementPendingOperations();
+  void ScheduleFinish();
+  void Finish();
+  void OnHandleClosed();
+
   void CloseStdioPipes();
   void CloseKillTimer();
 
@@ -204,6 +222,7 @@ class SyncProcessRunner {
                            int term_signal);
   static void KillTimerCallback(uv_timer_t* handle);
   static void KillTimerCloseCallback(uv_handle_t* handle);
+  static void ProcessCloseCallback(uv_handle_t* handle);
 
   double max_buffer_;
   uint64_t timeout_;
@@ -240,7 +259,39 @@ class SyncProcessRunner {
 
   Lifecycle lifecycle_;
 
+  // The process exit, input writes and shutdowns, and outputs that are still
+  // being read, and the number of handles that have not finished closing.
+  unsigned int pending_operations_;
+  unsigned int closing_handles_;
+  bool finishing_;
+
   Environment* env_;
+  ProcessRunnerWrap* async_wrap_;
+};
+
+
+// new ProcessRunner() runs a single process like spawn_sync.spawn(), without
+// blocking the event loop. runner.spawn(options) takes the same options, and
+// `oncomplete` is called with the same result object once the process has
+// exited and its output has been collected.
+class ProcessRunnerWrap : public AsyncWrap {
+ public:
+  static void Initialize(Environment* env, Local<Object> target);
+
+  size_t self_size() const override { return sizeof(*this); }
+
+ private:
+  friend class SyncProcessRunner;
+
+  ProcessRunnerWrap(Environment* env, Local<Object> object);
+  ~ProcessRunnerWrap() override;
+
+  static void New(const FunctionCallbackInfo<Value>& args);
+  static void Spawn(const FunctionCallbackInfo<Value>& args);
+
+  void OnComplete();
+
+  SyncProcessRunner* runner_;
 };
 
 }  // namespace node
@@ -83,6 +83,13 @@ int StreamBase::Writev(const FunctionCallbackInfo<Value>& args) {
   Local<Array> chunks = args[1].As<Array>();
   bool all_buffers = args[2]->IsTrue();
 
+  uv_stream_t* send_handle = nullptr;
+  if (IsIPCPipe() && args[3]->IsObject()) {
+    int err = GetSendHandle(req_wrap_obj, args[3].As<Object>(), &send_handle);
+    if (err != 0)
+      return err;
+  }
+
   size_t count;
   if (all_buffers)
     count = chunks->Length();
@@ -161,7 +168,7 @@ int StreamBase::Writev(const FunctionCallbackInfo<Value>& args) {
     }
   }
 
-  StreamWriteResult res = Write(*bufs, count, nullptr, req_wrap_obj);
+  StreamWriteResult res = Write(*bufs, count, send_handle, req_wrap_obj);
   SetWriteResultPropertiesOnWrapObject(env, req_wrap_obj, res);
   if (res.wrap != nullptr && storage) {
     res.wrap->SetAllocatedStorage(storage.release(), storage_size);
@@ -182,11 +189,18 @@ int StreamBase::WriteBuffer(const FunctionCallbackInfo<Value>& args) {
 
   Local<Object> req_wrap_obj = args[0].As<Object>();
 
+  uv_stream_t* send_handle = nullptr;
+  if (IsIPCPipe() && args[2]->IsObject()) {
+    int err = GetSendHandle(req_wrap_obj, args[2].As<Object>(), &send_handle);
+    if (err != 0)
+      return err;
+  }
+
   uv_buf_t buf;
   buf.base = Buffer::Data(args[1]);
   buf.len = Buffer::Length(args[1]);
 
-  StreamWriteResult res = Write(&buf, 1, nullptr, req_wrap_obj);
+  StreamWriteResult res = Write(&buf, 1, send_handle, req_wrap_obj);
 
   if (res.async)
     req_wrap_obj->Set(env->context(), env->buffer_string(), args[1]).FromJust();
@@ -196,6 +210,19 @@ int StreamBase::WriteBuffer(const FunctionCallbackInfo<Value>& args) {
 }
 
 
+int StreamBase::GetSendHandle(Local<Object> req_wrap_obj,
+                              Local<Object> send_handle_obj,
+                              uv_stream_t** send_handle) {
+  HandleWrap* wrap;
+  ASSIGN_OR_RETURN_UNWRAP(&wrap, send_handle_obj, UV_EINVAL);
+  *send_handle = reinterpret_cast<uv_stream_t*>(wrap->GetHandle());
+  // Reference LibuvStreamWrap instance to prevent it from being garbage
+  // collected before `AfterWrite` is called.
+  req_wrap_obj->Set(stream_env()->handle_string(), send_handle_obj);
+  return 0;
+}
+
+
 template <enum encoding enc>
 int StreamBase::WriteString(const FunctionCallbackInfo<Value>& args) {
   Environment* env = Environment::GetCurrent(args);
@@ -286,12 +313,9 @@ int StreamBase::WriteString(const FunctionCallbackInfo<Value>& args) {
   uv_stream_t* send_handle = nullptr;
 
   if (IsIPCPipe() && !send_handle_obj.IsEmpty()) {
-    HandleWrap* wrap;
-    ASSIGN_OR_RETURN_UNWRAP(&wrap, send_handle_obj, UV_EINVAL);
-    send_handle = reinterpret_cast<uv_stream_t*>(wrap->GetHandle());
-    // Reference LibuvStreamWrap instance to prevent it from being garbage
-    // collected before `AfterWrite` is called.
-    req_wrap_obj->Set(env->handle_string(), send_handle_obj);
+    err = GetSendHandle(req_wrap_obj, send_handle_obj, &send_handle);
+    if (err != 0)
+      return err;
   }
 
   StreamWriteResult res = Write(&buf, 1, send_handle, req_wrap_obj);
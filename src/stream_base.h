@@ -315,6 +315,12 @@ class StreamBase : public StreamResource {
   template <enum encoding enc>
   int WriteString(const v8::FunctionCallbackInfo<v8::Value>& args);
 
+  // Unwraps the handle that is sent along with a write on an IPC pipe, and
+  // keeps it alive until the write has finished.
+  int GetSendHandle(v8::Local<v8::Object> req_wrap_obj,
+                    v8::Local<v8::Object> send_handle_obj,
+                    uv_stream_t** send_handle);
+
   template <class Base>
   static void GetFD(const v8::FunctionCallbackInfo<v8::Value>& args);
 
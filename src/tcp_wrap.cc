@@ -31,7 +31,12 @@
 #include "stream_wrap.h"
 #include "util-inl.h"
 
+#include <errno.h>
 #include <stdlib.h>
+#ifndef _WIN32
+#include <sys/socket.h>
+#include <unistd.h>
+#endif
 
 
 namespace node {
@@ -48,6 +53,7 @@ using v8::Integer;
 using v8::Local;
 using v8::Object;
 using v8::String;
+using v8::Uint32;
 using v8::Value;
 
 using AsyncHooks = Environment::AsyncHooks;
@@ -107,6 +113,8 @@ void TCPWrap::Initialize(Local<Object> target,
                       GetSockOrPeerName<TCPWrap, uv_tcp_getpeername>);
   env->SetProtoMethod(t, "setNoDelay", SetNoDelay);
   env->SetProtoMethod(t, "setKeepAlive", SetKeepAlive);
+  env->SetProtoMethod(t, "setRejectConnections", SetRejectConnections);
+  env->SetProtoMethod(t, "getRejectedConnections", GetRejectedConnections);
 
 #ifdef _WIN32
   env->SetProtoMethod(t, "setSimultaneousAccepts", SetSimultaneousAccepts);
@@ -128,6 +136,7 @@ void TCPWrap::Initialize(Local<Object> target,
   Local<Object> constants = Object::New(env->isolate());
   NODE_DEFINE_CONSTANT(constants, SOCKET);
   NODE_DEFINE_CONSTANT(constants, SERVER);
+  NODE_DEFINE_CONSTANT(constants, REUSEPORT);
   target->Set(context,
               FIXED_ONE_BYTE_STRING(env->isolate(), "constants"),
               constants).FromJust();
@@ -216,6 +225,49 @@ void TCPWrap::Open(const FunctionCallbackInfo<Value>& args) {
 }
 
 
+// libuv creates the socket inside uv_tcp_bind() and offers no way to set
+// SO_REUSEPORT before the bind() call, so create and open it here instead.
+static int OpenReusePortSocket(uv_tcp_t* handle, int family) {
+#if defined(SO_REUSEPORT) && !defined(_WIN32)
+  uv_os_fd_t existing;
+  if (uv_fileno(reinterpret_cast<uv_handle_t*>(handle), &existing) == 0)
+    return UV_EINVAL;
+
+  int type = SOCK_STREAM;
+#ifdef SOCK_CLOEXEC
+  type |= SOCK_CLOEXEC;
+#endif
+  int fd = socket(family, type, 0);
+  if (fd == -1)
+    return -errno;
+
+  int on = 1;
+  int err = 0;
+  if (setsockopt(fd, SOL_SOCKET, SO_REUSEPORT, &on, sizeof(on)) != 0)
+    err = -errno;
+  else
+    err = uv_tcp_open(handle, fd);
+
+  if (err != 0)
+    close(fd);
+  return err;
+#else
+  return UV_ENOTSUP;
+#endif
+}
+
+
+// Binds |handle|, creating its socket with SO_REUSEPORT first if requested.
+static int BindWithFlags(uv_tcp_t* handle, const sockaddr* addr, int flags) {
+  if (flags & TCPWrap::REUSEPORT) {
+    int err = OpenReusePortSocket(handle, addr->sa_family);
+    if (err != 0)
+      return err;
+  }
+  return uv_tcp_bind(handle, addr, 0);
+}
+
+
 void TCPWrap::Bind(const FunctionCallbackInfo<Value>& args) {
   TCPWrap* wrap;
   ASSIGN_OR_RETURN_UNWRAP(&wrap,
@@ -223,12 +275,13 @@ void TCPWrap::Bind(const FunctionCallbackInfo<Value>& args) {
                           args.GetReturnValue().Set(UV_EBADF));
   node::Utf8Value ip_address(args.GetIsolate(), args[0]);
   int port = args[1]->Int32Value();
+  int flags = args[2]->IsUint32() ? args[2].As<Uint32>()->Value() : 0;
   sockaddr_in addr;
   int err = uv_ip4_addr(*ip_address, port, &addr);
   if (err == 0) {
-    err = uv_tcp_bind(&wrap->handle_,
-                      reinterpret_cast<const sockaddr*>(&addr),
-                      0);
+    err = BindWithFlags(&wrap->handle_,
+                        reinterpret_cast<const sockaddr*>(&addr),
+                        flags);
   }
   args.GetReturnValue().Set(err);
 }
@@ -241,12 +294,13 @@ void TCPWrap::Bind6(const FunctionCallbackInfo<Value>& args) {
                           args.GetReturnValue().Set(UV_EBADF));
   node::Utf8Value ip6_address(args.GetIsolate(), args[0]);
   int port = args[1]->Int32Value();
+  int flags = args[2]->IsUint32() ? args[2].As<Uint32>()->Value() : 0;
   sockaddr_in6 addr;
   int err = uv_ip6_addr(*ip6_address, port, &addr);
   if (err == 0) {
-    err = uv_tcp_bind(&wrap->handle_,
-                      reinterpret_cast<const sockaddr*>(&addr),
-                      0);
+    err = BindWithFlags(&wrap->handle_,
+                        reinterpret_cast<const sockaddr*>(&addr),
+                        flags);
   }
   args.GetReturnValue().Set(err);
 }
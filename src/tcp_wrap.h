@@ -37,6 +37,10 @@ class TCPWrap : public ConnectionWrap<TCPWrap, uv_tcp_t> {
     SERVER
   };
 
+  enum BindFlags {
+    REUSEPORT = 1
+  };
+
   static v8::Local<v8::Object> Instantiate(Environment* env,
                                            AsyncWrap* parent,
                                            SocketType type);
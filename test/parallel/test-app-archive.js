@@ -0,0 +1,87 @@
+'use strict';
+
+// Tests loading an application from an archive mounted through
+// NODE_APP_ARCHIVE.
+
+const common = require('../common');
+if (common.isWindows)
+  common.skip('application archives are not supported on Windows');
+
+const assert = require('assert');
+const fs = require('fs');
+const path = require('path');
+const { spawnSync } = require('child_process');
+const tmpdir = require('../common/tmpdir');
+const makeAppArchive = require('../../tools/make-app-archive');
+
+tmpdir.refresh();
+
+const app = path.join(tmpdir.path, 'app');
+const archive = path.join(tmpdir.path, 'app.nar');
+
+function write(file, contents) {
+  const filename = path.join(app, file);
+  for (let dir = path.dirname(file); dir !== '.'; dir = path.dirname(dir)) {
+    if (!fs.existsSync(path.join(app, dir)))
+      write(dir, null);
+  }
+  if (contents === null)
+    fs.mkdirSync(filename);
+  else
+    fs.writeFileSync(filename, contents);
+}
+
+fs.mkdirSync(app);
+write('package.json', '{ "main": "lib/main.js" }');
+write('lib/main.js', `#!/usr/bin/env node
+const dep = require('dep');
+const data = require('./data.json');
+console.log(dep(data.value) + ' ' + __filename);`);
+write('lib/data.json', '{ "value": 21 }');
+write('node_modules/dep/package.json', '{ "main": "./src" }');
+write('node_modules/dep/src/index.js', 'module.exports = (x) => x * 2;');
+write('esm/index.mjs', `import dep from '../node_modules/dep/src/index.js';
+console.log(dep(4));`);
+
+makeAppArchive(app, archive);
+// The archive is self-contained.
+fs.renameSync(app, `${app}-removed`);
+
+function run(args, env) {
+  return spawnSync(process.execPath, args, {
+    env: Object.assign({}, process.env, env)
+  });
+}
+
+{
+  // The archive path is a directory whose package.json "main" is run.
+  const child = run([archive], { NODE_APP_ARCHIVE: archive });
+  assert.strictEqual(child.status, 0, String(child.stderr));
+  assert.strictEqual(String(child.stdout).trim(),
+                     `42 ${path.join(archive, 'lib', 'main.js')}`);
+}
+
+{
+  const child = run(['--experimental-modules',
+                     path.join(archive, 'esm', 'index.mjs')],
+                    { NODE_APP_ARCHIVE: archive });
+  assert.strictEqual(child.status, 0, String(child.stderr));
+  assert(String(child.stdout).includes('8'), String(child.stdout));
+}
+
+{
+  // Without the archive mounted, the application cannot be found.
+  const child = run([archive], { NODE_APP_ARCHIVE: '' });
+  assert.notStrictEqual(child.status, 0);
+}
+
+{
+  // Missing files and files that are not archives are reported at startup.
+  let child = run(['-e', '0'], { NODE_APP_ARCHIVE: `${archive}.missing` });
+  assert.notStrictEqual(child.status, 0);
+  assert(/ENOENT/.test(child.stderr), String(child.stderr));
+
+  child = run(['-e', '0'], { NODE_APP_ARCHIVE: __filename });
+  assert.notStrictEqual(child.status, 0);
+  assert(/ERR_INVALID_APP_ARCHIVE/.test(child.stderr), String(child.stderr));
+}
@@ -0,0 +1,99 @@
+'use strict';
+
+const common = require('../common');
+const assert = require('assert');
+const child_process = require('child_process');
+const net = require('net');
+
+if (process.argv[2] === 'child') {
+  process.on('message', (message, handle) => {
+    if (handle) {
+      handle.end(`${message}`);
+      process.send('handle received');
+      return;
+    }
+    process.send(message);
+  });
+  return;
+}
+
+const circular = { name: 'circular' };
+circular.self = circular;
+
+const large = Buffer.alloc(256 * 1024);
+for (let i = 0; i < large.length; i++)
+  large[i] = i % 251;
+
+const values = [
+  'string',
+  42,
+  null,
+  [1, 2, 3],
+  { a: 1, b: [2, 3] },
+  new Map([['a', 1], [{}, new Set([2])]]),
+  new Date(0),
+  /regexp/gi,
+  circular,
+  Buffer.from('small buffer'),
+  new Float64Array([1.5, 2.5]),
+  large,
+  new Uint8Array(large.buffer, 1, 16 * 1024),
+  { buffers: [large.slice(0, 8 * 1024), Buffer.alloc(3),
+              large.slice(8 * 1024)] }
+];
+
+const child = child_process.fork(__filename, ['child'], {
+  serialization: 'advanced'
+});
+
+const received = [];
+const onMessage = common.mustCall((message) => {
+  received.push(message);
+  if (received.length < values.length)
+    return;
+
+  child.removeListener('message', onMessage);
+  assert.deepStrictEqual(received, values);
+  assert.strictEqual(received[8].self, received[8]);
+  assert(Buffer.isBuffer(received[11]));
+  assert(!Buffer.isBuffer(received[12]));
+  testHandle();
+}, values.length);
+child.on('message', onMessage);
+
+// Sending all values at once makes them arrive in reads that hold several
+// messages or only part of one.
+for (const value of values)
+  child.send(value);
+
+function testHandle() {
+  const server = net.createServer(common.mustCall((socket) => {
+    child.once('message', common.mustCall((message) => {
+      assert.strictEqual(message, 'handle received');
+      child.disconnect();
+    }));
+    child.send('sent with handle', socket);
+  }));
+  server.listen(0, common.mustCall(() => {
+    const client = net.connect(server.address().port);
+    let data = '';
+    client.setEncoding('utf8');
+    client.on('data', (chunk) => { data += chunk; });
+    client.on('end', common.mustCall(() => {
+      assert.strictEqual(data, 'sent with handle');
+      server.close();
+    }));
+  }));
+}
+
+common.expectsError(() => child.send(() => {}), {
+  type: Error,
+  message: /could not be cloned/
+});
+
+common.expectsError(() => {
+  child_process.fork(__filename, ['child'], { serialization: 'xml' });
+}, {
+  code: 'ERR_INVALID_OPT_VALUE',
+  message: 'The value "xml" is invalid for option "options.serialization"'
+});
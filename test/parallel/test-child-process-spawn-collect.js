@@ -0,0 +1,113 @@
+'use strict';
+
+const common = require('../common');
+const assert = require('assert');
+const { spawnCollect, spawnSync } = require('child_process');
+
+if (process.argv[2] === 'child') {
+  switch (process.argv[3]) {
+    case 'echo':
+      process.stdin.pipe(process.stdout);
+      break;
+    case 'fail':
+      process.stderr.write('failed');
+      process.exitCode = 3;
+      break;
+    case 'flood':
+      process.stdout.write(Buffer.alloc(1024 * 1024, 'x'));
+      break;
+    case 'hang':
+      setInterval(() => {}, 1000);
+      break;
+  }
+  return;
+}
+
+function child(...args) {
+  return [process.execPath, [__filename, 'child', ...args]];
+}
+
+{
+  // Input that is larger than the pipe buffers is written and read back in
+  // full, and the result has the same shape as that of spawnSync().
+  const input = Buffer.alloc(256 * 1024, 'abc');
+  const [file, args] = child('echo');
+  spawnCollect(file, args, { input }, common.mustCall((err, result) => {
+    assert.ifError(err);
+    assert.strictEqual(result.status, 0);
+    assert.strictEqual(result.signal, null);
+    assert.deepStrictEqual(result.stdout, input);
+    assert.deepStrictEqual(result.stderr, Buffer.alloc(0));
+    assert.strictEqual(result.output[0], null);
+    assert.strictEqual(result.output[1], result.stdout);
+    assert.strictEqual(typeof result.pid, 'number');
+    const expected = spawnSync(file, args, { input });
+    assert.deepStrictEqual(Object.keys(result).sort(),
+                           Object.keys(expected).sort());
+  }));
+}
+
+{
+  // A non-zero exit code is not an error.
+  const [file, args] = child('fail');
+  spawnCollect(file, args, { encoding: 'utf8' }, common.mustCall((err, r) => {
+    assert.ifError(err);
+    assert.strictEqual(r.status, 3);
+    assert.strictEqual(r.stdout, '');
+    assert.strictEqual(r.stderr, 'failed');
+  }));
+}
+
+{
+  const [file, args] = child('flood');
+  const options = { maxBuffer: 1024 };
+  spawnCollect(file, args, options, common.mustCall((err, result) => {
+    assert.strictEqual(err.code, 'ENOBUFS');
+    assert.strictEqual(result.error, err);
+    assert(result.stdout.length > 0);
+  }));
+}
+
+{
+  // The event loop keeps running while the child process does.
+  const [file, args] = child('hang');
+  let ticked = false;
+  setTimeout(common.mustCall(() => { ticked = true; }), 10);
+  spawnCollect(file, args, { timeout: 200 }, common.mustCall((err, result) => {
+    assert.strictEqual(err.code, 'ETIMEDOUT');
+    assert.strictEqual(result.signal, 'SIGTERM');
+    assert.strictEqual(result.status, null);
+    assert(ticked);
+  }));
+}
+
+{
+  spawnCollect('does-not-exist', ['arg'], common.mustCall((err, result) => {
+    assert.strictEqual(err.code, 'ENOENT');
+    assert.strictEqual(err.syscall, 'spawn does-not-exist');
+    assert.strictEqual(err.path, 'does-not-exist');
+    assert.deepStrictEqual(err.spawnargs, ['arg']);
+    assert.strictEqual(result.status, null);
+    assert.strictEqual(result.output, null);
+  }));
+}
+
+{
+  // Many commands can run concurrently.
+  const [file, args] = child('echo');
+  for (let i = 0; i < 20; i++) {
+    const input = `input ${i}`;
+    spawnCollect(file, args, { input, encoding: 'utf8' },
+                 common.mustCall((err, result) => {
+                   assert.ifError(err);
+                   assert.strictEqual(result.stdout, input);
+                 }));
+  }
+}
+
+common.expectsError(() => spawnCollect(process.execPath, []), {
+  code: 'ERR_INVALID_CALLBACK'
+});
+common.expectsError(() => {
+  spawnCollect(process.execPath, { timeout: -1 }, common.mustNotCall());
+}, { code: 'ERR_OUT_OF_RANGE' });
@@ -0,0 +1,172 @@
+'use strict';
+
+const common = require('../common');
+
+if (common.isWindows)
+  common.skip('the spawn zygote is not available on Windows');
+
+const assert = require('assert');
+const cp = require('child_process');
+const fs = require('fs');
+const path = require('path');
+const tmpdir = require('../common/tmpdir');
+
+function run(args, options, callback) {
+  cp.execFile(process.execPath, ['-e', args], options, callback);
+}
+
+switch (process.argv[2]) {
+  case 'ipc':
+    process.on('message', (message) => {
+      process.send({ ppid: process.ppid, value: message + 1 });
+      process.disconnect();
+      // Stay around, so that the disconnect is not noticed through the exit.
+      setInterval(() => {}, 1000);
+    });
+    break;
+  case 'zygote':
+    testZygote();
+    break;
+  default: {
+    // The zygote is forked at startup, so it has to be enabled through the
+    // environment of the process that uses it.
+    const env = Object.assign({}, process.env, { NODE_SPAWN_ZYGOTE: '1' });
+    const child = cp.spawnSync(process.execPath, [__filename, 'zygote'],
+                               { env });
+    assert.strictEqual(child.stderr.toString(), '');
+    assert.strictEqual(child.status, 0);
+    assert.strictEqual(child.stdout.toString(), 'done\n');
+  }
+}
+
+function testZygote() {
+  tmpdir.refresh();
+
+  // Children are not forked from this process, but from the zygote.
+  run('console.log(process.ppid)', {}, common.mustCall((err, stdout) => {
+    assert.ifError(err);
+    const zygote = Number(stdout);
+    assert.notStrictEqual(zygote, process.pid);
+    testStdio(zygote);
+  }));
+}
+
+function testStdio(zygote) {
+  // Pipes work in both directions, and the exit code is reported.
+  const child = cp.spawn(process.execPath,
+                         ['-e', 'process.stdin.pipe(process.stdout); ' +
+                                'process.stdin.on("end", () => ' +
+                                'process.exitCode = 3)']);
+  let stdout = '';
+  child.stdout.setEncoding('utf8');
+  child.stdout.on('data', (chunk) => { stdout += chunk; });
+  child.on('close', common.mustCall((code, signal) => {
+    assert.strictEqual(code, 3);
+    assert.strictEqual(signal, null);
+    assert.strictEqual(stdout, 'hello');
+    testOptions(zygote);
+  }));
+  child.stdin.end('hello');
+}
+
+function testOptions(zygote) {
+  // The environment, working directory and inherited file descriptors are
+  // those of the request.
+  const file = path.join(tmpdir.path, 'out.txt');
+  const fd = fs.openSync(file, 'w');
+  const child = cp.spawn(process.execPath,
+                         ['-e', 'console.log(process.cwd(), process.env.FOO)'],
+                         { cwd: tmpdir.path,
+                           env: { FOO: 'bar' },
+                           stdio: ['ignore', fd, 'ignore'] });
+  child.on('exit', common.mustCall((code) => {
+    fs.closeSync(fd);
+    assert.strictEqual(code, 0);
+    assert.strictEqual(fs.readFileSync(file, 'utf8'),
+                       `${fs.realpathSync(tmpdir.path)} bar\n`);
+    testInheritance(zygote);
+  }));
+}
+
+function testInheritance(zygote) {
+  // Without a cwd option, children get the working directory and umask that
+  // this process has now, not those that it had when the zygote was forked.
+  const cwd = process.cwd();
+  const mask = process.umask(0o027);
+  process.chdir(tmpdir.path);
+  run('console.log(process.cwd(), process.umask())', {},
+      common.mustCall((err, stdout) => {
+        assert.ifError(err);
+        assert.strictEqual(stdout,
+                           `${fs.realpathSync(tmpdir.path)} ${0o027}\n`);
+        process.chdir(cwd);
+        process.umask(mask);
+        testIpc(zygote);
+      }));
+}
+
+function testIpc(zygote) {
+  // The child has a zygote of its own, which must not keep the IPC channel
+  // open.
+  const child = cp.fork(__filename, ['ipc']);
+  child.on('message', common.mustCall((message) => {
+    assert.deepStrictEqual(message, { ppid: zygote, value: 2 });
+  }));
+  child.on('disconnect', common.mustCall(() => child.kill()));
+  child.on('exit', common.mustCall((code, signal) => {
+    assert.strictEqual(signal, 'SIGTERM');
+    testErrors(zygote);
+  }));
+  child.send(1);
+}
+
+function testErrors(zygote) {
+  const missing = cp.spawn('does-not-exist');
+  // There is no child to signal, and no pid that could be signaled instead.
+  assert.strictEqual(missing.kill(), false);
+  missing.on('error', common.mustCall((err) => {
+    assert.strictEqual(err.code, 'ENOENT');
+    assert.strictEqual(err.syscall, 'spawn does-not-exist');
+
+    const sleeper = cp.spawn(process.execPath,
+                             ['-e', 'setInterval(() => {}, 1000)']);
+    sleeper.on('exit', common.mustCall((code, signal) => {
+      assert.strictEqual(code, null);
+      assert.strictEqual(signal, 'SIGTERM');
+      testMany(zygote);
+    }));
+    // Signals are sent by the zygote, which knows that the child is alive.
+    assert(sleeper.kill(0));
+    assert(sleeper.kill());
+  }));
+}
+
+function testMany(zygote) {
+  // More children exit than fit into the zygote's event socket while this
+  // process is still busy sending it requests.
+  const count = 500;
+  let exited = 0;
+  const onExit = common.mustCall((code) => {
+    assert.strictEqual(code, 0);
+    if (++exited === count)
+      testZygoteExit(zygote);
+  }, count);
+  for (let i = 0; i < count; i++)
+    cp.spawn('true', [], { stdio: 'ignore' }).on('exit', onExit);
+}
+
+function testZygoteExit(zygote) {
+  // If the zygote goes away, the children it was tracking fail, and new ones
+  // are spawned directly.
+  const orphan = cp.spawn(process.execPath,
+                          ['-e', 'setTimeout(() => {}, 100)']);
+  orphan.on('error', common.mustCall((err) => {
+    assert.strictEqual(err.code, 'ESRCH');
+    run('console.log(process.ppid)', {}, common.mustCall((err, stdout) => {
+      assert.ifError(err);
+      assert.strictEqual(Number(stdout), process.pid);
+      console.log('done');
+    }));
+  }));
+  process.kill(zygote, 'SIGKILL');
+}
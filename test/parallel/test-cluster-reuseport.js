@@ -0,0 +1,58 @@
+'use strict';
+const common = require('../common');
+if (!common.isLinux)
+  common.skip('SO_REUSEPORT load balancing is only done by Linux');
+const assert = require('assert');
+const cluster = require('cluster');
+const net = require('net');
+
+// With SCHED_REUSEPORT, every worker listens on a socket of its own that is
+// bound to the same port, and the kernel spreads connections across them.
+
+const kWorkers = 2;
+const kConnections = 32;
+
+if (cluster.isMaster) {
+  cluster.schedulingPolicy = cluster.SCHED_REUSEPORT;
+  assert.strictEqual(cluster.SCHED_REUSEPORT, 3);
+
+  const ports = new Set();
+  let listening = 0;
+
+  for (let i = 0; i < kWorkers; i++) {
+    cluster.fork().on('listening', common.mustCall((address) => {
+      ports.add(address.port);
+      if (++listening === kWorkers)
+        connect();
+    }));
+  }
+
+  function connect() {
+    assert.strictEqual(ports.size, 1);
+    const [port] = ports;
+    const counts = new Map();
+    let remaining = kConnections;
+
+    for (let i = 0; i < kConnections; i++) {
+      net.connect(port, common.mustCall(function() {
+        this.setEncoding('utf8');
+        this.on('data', (id) => {
+          counts.set(id, (counts.get(id) || 0) + 1);
+          this.end();
+          if (--remaining > 0)
+            return;
+          assert.strictEqual(counts.size, kWorkers);
+          cluster.disconnect();
+        });
+      }));
+    }
+  }
+} else {
+  const server = net.createServer((socket) => {
+    socket.end(String(cluster.worker.id));
+  });
+  server.listen(0, common.mustCall(() => {
+    // Round-robin workers only get a stand-in for the master's handle.
+    assert.strictEqual(typeof server._handle.getAsyncId, 'function');
+  }));
+}
@@ -0,0 +1,106 @@
+'use strict';
+
+const common = require('../common');
+const assert = require('assert');
+const async_hooks = require('async_hooks');
+const fs = require('fs');
+const path = require('path');
+const tmpdir = require('../common/tmpdir');
+
+tmpdir.refresh();
+common.crashOnUnhandledRejection();
+
+// Appends are gathered into batches that are written with one writev() and
+// synced with one fdatasync(), each of which is a single FSReqWrap.
+let requests = 0;
+const hook = async_hooks.createHook({
+  init(id, type) {
+    if (type === 'FSREQWRAP')
+      requests++;
+  }
+}).enable();
+
+function lines(prefix, count) {
+  return Array.from({ length: count }, (v, i) => `${prefix}${i}\n`);
+}
+
+async function testFileHandle() {
+  const filename = path.join(tmpdir.path, 'filehandle.log');
+  const handle = await fs.promises.open(filename, 'a');
+
+  // Concurrent appends within the window end up in a single batch.
+  const records = lines('record ', 100);
+  requests = 0;
+  await Promise.all(records.map((record) => handle.groupCommit(record)));
+  assert.strictEqual(requests, 2);
+  assert.strictEqual(fs.readFileSync(filename, 'utf8'), records.join(''));
+
+  // Once maxBytes is reached, the batch is committed right away, and appends
+  // that arrive in the meantime form the next batch.
+  requests = 0;
+  await Promise.all(['a', 'b', 'c'].map((record) => {
+    return handle.groupCommit(Buffer.from(record), { maxBytes: 1 });
+  }));
+  assert.strictEqual(requests, 4);
+  assert.strictEqual(fs.readFileSync(filename, 'utf8'),
+                     records.join('') + 'abc');
+
+  await assert.rejects(handle.groupCommit(1), {
+    code: 'ERR_INVALID_ARG_TYPE'
+  });
+  await assert.rejects(handle.groupCommit('x', { maxBytes: 0 }), {
+    code: 'ERR_OUT_OF_RANGE'
+  });
+  await handle.close();
+
+  // Every append in a failed batch gets the error.
+  const readOnly = await fs.promises.open(filename, 'r');
+  const results = await Promise.all(['x', 'y'].map((record) => {
+    return readOnly.groupCommit(record).catch((err) => err.code);
+  }));
+  assert.deepStrictEqual(results, ['EBADF', 'EBADF']);
+  await readOnly.close();
+}
+
+function testWriteStreams() {
+  // Two producers that share a file descriptor also share batches.
+  const filename = path.join(tmpdir.path, 'streams.log');
+  const fd = fs.openSync(filename, 'a');
+  const options = { fd, autoClose: false, groupCommit: { maxDelay: 10 } };
+  const producers = [fs.createWriteStream(null, options),
+                     fs.createWriteStream(null, options)];
+  const records = [lines('first ', 50), lines('second ', 50)];
+  let remaining = 100;
+
+  requests = 0;
+  for (let i = 0; i < 50; i++) {
+    producers.forEach((stream, n) => {
+      stream.write(records[n][i], common.mustCall((err) => {
+        assert.ifError(err);
+        if (--remaining > 0)
+          return;
+        // The first write of each stream makes up the first batch, and what
+        // both streams buffered in the meantime makes up the second one.
+        assert.strictEqual(requests, 4);
+        producers.forEach((stream, n) => {
+          assert.strictEqual(stream.bytesWritten, records[n].join('').length);
+        });
+        fs.closeSync(fd);
+        const written = fs.readFileSync(filename, 'utf8').split('\n');
+        assert.strictEqual(written.length, 101);
+        for (const record of records[0].concat(records[1]))
+          assert(written.includes(record.slice(0, -1)));
+        testFileHandle().then(common.mustCall(() => hook.disable()));
+      }));
+    });
+  }
+}
+
+testWriteStreams();
+
+common.expectsError(() => fs.createWriteStream('x', { groupCommit: 'yes' }), {
+  code: 'ERR_INVALID_ARG_TYPE'
+});
+common.expectsError(() => {
+  fs.createWriteStream('x', { groupCommit: true, start: 0 });
+}, { code: 'ERR_INVALID_OPT_VALUE' });
@@ -0,0 +1,160 @@
+'use strict';
+
+const common = require('../common');
+if (!common.isLinux)
+  common.skip('io_uring is only available on Linux');
+if (!common.hasCrypto)
+  common.skip('missing crypto');
+
+const assert = require('assert');
+const crypto = require('crypto');
+const fs = require('fs');
+const path = require('path');
+const { spawnSync } = require('child_process');
+
+common.crashOnUnhandledRejection();
+
+// With NODE_FS_IO_URING=1, asynchronous fs requests are submitted to an
+// io_uring instead of the threadpool and behave the same way.
+
+if (process.env.NODE_FS_IO_URING !== '1') {
+  const env = Object.assign({}, process.env, {
+    NODE_FS_IO_URING: '1',
+    UV_THREADPOOL_SIZE: '1'
+  });
+  const args = ['--no-warnings', __filename];
+  const child = spawnSync(process.execPath, args, { env });
+  assert.strictEqual(child.stderr.toString(), '');
+  assert.strictEqual(child.status, 0);
+  return;
+}
+
+if (!process.binding('fs').ioUringEnabled)
+  common.skip('io_uring is not supported by the kernel');
+
+const tmpdir = require('../common/tmpdir');
+tmpdir.refresh();
+
+{
+  // While the only threadpool thread is busy, fs requests still complete.
+  let statted = false;
+  crypto.pbkdf2('password', 'salt', 1e6, 32, 'sha256', common.mustCall(() => {
+    assert.strictEqual(statted, true);
+  }));
+  fs.stat(__filename, common.mustCall((err) => {
+    assert.ifError(err);
+    statted = true;
+  }));
+}
+
+const file = path.join(tmpdir.path, 'io-uring.txt');
+const link = path.join(tmpdir.path, 'io-uring-link');
+
+fs.open(file, 'w+', common.mustCall((err, fd) => {
+  assert.ifError(err);
+  fs.write(fd, Buffer.from('hello '), common.mustCall((err, written) => {
+    assert.ifError(err);
+    assert.strictEqual(written, 6);
+    fs.write(fd, 'world', common.mustCall((err, written) => {
+      assert.ifError(err);
+      assert.strictEqual(written, 5);
+      fs.fsync(fd, common.mustCall((err) => {
+        assert.ifError(err);
+        fs.fdatasync(fd, common.mustCall((err) => {
+          assert.ifError(err);
+          checkContents(fd);
+        }));
+      }));
+    }));
+  }));
+}));
+
+function checkContents(fd) {
+  fs.fstat(fd, common.mustCall((err, stats) => {
+    assert.ifError(err);
+    assert(stats.isFile());
+    assert.strictEqual(stats.size, 11);
+    assert.deepStrictEqual(stats, fs.fstatSync(fd));
+
+    const buf = Buffer.alloc(5);
+    fs.read(fd, buf, 0, 5, 6, common.mustCall((err, bytesRead) => {
+      assert.ifError(err);
+      assert.strictEqual(bytesRead, 5);
+      assert.strictEqual(buf.toString(), 'world');
+      fs.close(fd, common.mustCall((err) => {
+        assert.ifError(err);
+        fs.close(fd, common.expectsError({ code: 'EBADF' }));
+        checkPaths();
+      }));
+    }));
+  }));
+}
+
+function checkPaths() {
+  fs.symlinkSync(file, link);
+  fs.stat(link, common.mustCall((err, stats) => {
+    assert.ifError(err);
+    assert(stats.isFile());
+    assert.strictEqual(stats.ino, fs.statSync(file).ino);
+  }));
+  fs.lstat(link, common.mustCall((err, stats) => {
+    assert.ifError(err);
+    assert(stats.isSymbolicLink());
+  }));
+  const missing = path.join(tmpdir.path, 'missing');
+  fs.open(missing, 'r', common.mustCall((err) => {
+    assert.strictEqual(err.code, 'ENOENT');
+    assert.strictEqual(err.path, missing);
+  }));
+  fs.stat(missing, common.mustCall((err) => {
+    assert.strictEqual(err.code, 'ENOENT');
+  }));
+  fs.promises.open(file, 'r').then(common.mustCall(async (handle) => {
+    const stats = await handle.stat();
+    assert.strictEqual(stats.size, 11);
+    await handle.close();
+  }));
+}
+
+{
+  // Reads from the current file position, many at a time.
+  const data = Buffer.alloc(64 * 1024);
+  for (let i = 0; i < data.length; i++)
+    data[i] = i % 251;
+  const big = path.join(tmpdir.path, 'io-uring-big');
+  fs.writeFileSync(big, data);
+
+  const fd = fs.openSync(big, 'r');
+  const chunks = [];
+  (function readChunk() {
+    const chunk = Buffer.alloc(4096);
+    fs.read(fd, chunk, 0, chunk.length, null, common.mustCall((err, n) => {
+      assert.ifError(err);
+      if (n > 0) {
+        chunks.push(chunk.slice(0, n));
+        return readChunk();
+      }
+      fs.closeSync(fd);
+      assert.deepStrictEqual(Buffer.concat(chunks), data);
+    }));
+  })();
+
+  const concurrent = 1000;
+  let remaining = concurrent;
+  for (let i = 0; i < concurrent; i++) {
+    fs.open(big, 'r', common.mustCall((err, fd) => {
+      assert.ifError(err);
+      const buf = Buffer.alloc(1);
+      fs.read(fd, buf, 0, 1, i, common.mustCall((err, n) => {
+        assert.ifError(err);
+        assert.strictEqual(n, 1);
+        assert.strictEqual(buf[0], i % 251);
+        fs.close(fd, common.mustCall((err) => {
+          assert.ifError(err);
+          remaining--;
+        }));
+      }));
+    }));
+  }
+  process.on('exit', () => assert.strictEqual(remaining, 0));
+}
@@ -0,0 +1,85 @@
+// Flags: --expose-gc
+'use strict';
+const common = require('../common');
+if (common.isWindows)
+  common.skip('fs.mmapSync() is not supported on Windows');
+const assert = require('assert');
+const fs = require('fs');
+const path = require('path');
+
+const tmpdir = require('../common/tmpdir');
+tmpdir.refresh();
+
+const file = path.join(tmpdir.path, 'mmap.bin');
+const contents = Buffer.alloc(3 * 4096 + 123);
+for (let i = 0; i < contents.length; i++)
+  contents[i] = i * 31;
+fs.writeFileSync(file, contents);
+
+{
+  const fd = fs.openSync(file, 'r');
+  const whole = fs.mmapSync(fd);
+  fs.closeSync(fd);
+  assert(whole instanceof Buffer);
+  assert.deepStrictEqual(whole, contents);
+
+  // Private mappings can be written to without changing the file.
+  whole[0] = 42;
+  assert.strictEqual(whole[0], 42);
+  assert.deepStrictEqual(fs.readFileSync(file), contents);
+}
+
+{
+  const fd = fs.openSync(file, 'r');
+  // Offsets do not have to be page aligned.
+  for (const advice of ['normal', 'sequential', 'random', 'willneed']) {
+    const part = fs.mmapSync(fd, { offset: 4097, length: 5000, advice });
+    assert.deepStrictEqual(part, contents.slice(4097, 4097 + 5000));
+  }
+  assert.deepStrictEqual(fs.mmapSync(fd, { offset: 8000 }),
+                         contents.slice(8000));
+  assert.strictEqual(fs.mmapSync(fd, { offset: contents.length }).length, 0);
+
+  common.expectsError(() => fs.mmapSync(fd, { length: contents.length + 1 }), {
+    code: 'ERR_OUT_OF_RANGE',
+    type: RangeError
+  });
+  common.expectsError(() => fs.mmapSync(fd, { offset: -1 }), {
+    code: 'ERR_OUT_OF_RANGE',
+    type: RangeError
+  });
+  common.expectsError(() => fs.mmapSync(fd, { advice: 'often' }), {
+    code: 'ERR_INVALID_OPT_VALUE',
+    type: TypeError
+  });
+  common.expectsError(() => fs.mmapSync(fd, null), {
+    code: 'ERR_INVALID_ARG_TYPE',
+    type: TypeError
+  });
+
+  // Shared mappings need a file descriptor that is open for writing.
+  assert.throws(() => fs.mmapSync(fd, { shared: true }), {
+    code: 'EACCES',
+    syscall: 'mmap'
+  });
+  fs.closeSync(fd);
+}
+
+{
+  const fd = fs.openSync(file, 'r+');
+  const shared = fs.mmapSync(fd, { offset: 10, length: 10, shared: true });
+  fs.closeSync(fd);
+  shared.fill(0xff);
+  const expected = Buffer.from(contents);
+  expected.fill(0xff, 10, 20);
+  assert.deepStrictEqual(fs.readFileSync(file), expected);
+}
+
+{
+  // Mappings are removed when their Buffers are garbage collected.
+  const fd = fs.openSync(file, 'r');
+  for (let i = 0; i < 100; i++)
+    fs.mmapSync(fd, { offset: i });
+  fs.closeSync(fd);
+  global.gc();
+}
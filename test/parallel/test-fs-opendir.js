@@ -0,0 +1,186 @@
+'use strict';
+
+const common = require('../common');
+const assert = require('assert');
+const fs = require('fs');
+const path = require('path');
+
+const tmpdir = require('../common/tmpdir');
+
+const testDir = tmpdir.path;
+const files = ['empty', 'files', 'for', 'just', 'testing'];
+
+common.crashOnUnhandledRejection();
+
+// Make sure tmp directory is clean
+tmpdir.refresh();
+
+// Create the necessary files
+files.forEach(function(filename) {
+  fs.closeSync(fs.openSync(path.join(testDir, filename), 'w'));
+});
+
+function assertDirent(dirent) {
+  assert(dirent instanceof fs.Dirent);
+  assert.strictEqual(dirent.isFile(), true);
+  assert.strictEqual(dirent.isDirectory(), false);
+  assert.strictEqual(dirent.isSocket(), false);
+  assert.strictEqual(dirent.isBlockDevice(), false);
+  assert.strictEqual(dirent.isCharacterDevice(), false);
+  assert.strictEqual(dirent.isFIFO(), false);
+  assert.strictEqual(dirent.isSymbolicLink(), false);
+}
+
+const dirclosedError = {
+  code: 'ERR_DIR_CLOSED'
+};
+
+// Check the opendir Sync version
+{
+  const dir = fs.opendirSync(testDir);
+  const entries = files.map(() => {
+    const dirent = dir.readSync();
+    assertDirent(dirent);
+    return dirent.name;
+  });
+  assert.deepStrictEqual(files, entries.sort());
+
+  // dir.read should return null when no more entries exist
+  assert.strictEqual(dir.readSync(), null);
+
+  // check .path
+  assert.strictEqual(dir.path, testDir);
+
+  dir.closeSync();
+
+  assert.throws(() => dir.readSync(), dirclosedError);
+  assert.throws(() => dir.closeSync(), dirclosedError);
+}
+
+// Check the opendir async version
+fs.opendir(testDir, common.mustCall(function(err, dir) {
+  assert.ifError(err);
+  dir.read(common.mustCall(function(err, dirent) {
+    assert.ifError(err);
+
+    // Order is operating / file system dependent
+    assert(files.includes(dirent.name), `'files' should include ${dirent}`);
+    assertDirent(dirent);
+
+    dir.close(common.mustCall(function(err) {
+      assert.ifError(err);
+    }));
+  }));
+}));
+
+// opendir() on file should throw ENOTDIR
+assert.throws(function() {
+  fs.opendirSync(__filename);
+}, /Error: ENOTDIR: not a directory/);
+
+fs.opendir(__filename, common.mustCall(function(e) {
+  assert.strictEqual(e.code, 'ENOTDIR');
+}));
+
+[false, 1, [], {}, null, undefined].forEach((i) => {
+  common.expectsError(
+    () => fs.opendir(i, common.mustNotCall()),
+    {
+      code: 'ERR_INVALID_ARG_TYPE',
+      type: TypeError
+    }
+  );
+  common.expectsError(
+    () => fs.opendirSync(i),
+    {
+      code: 'ERR_INVALID_ARG_TYPE',
+      type: TypeError
+    }
+  );
+});
+
+// Promise-based tests
+async function doPromiseTest() {
+  // Check the opendir Promise version
+  const dir = await fs.promises.opendir(testDir);
+  const entries = [];
+
+  let i = files.length;
+  while (i--) {
+    const dirent = await dir.read();
+    entries.push(dirent.name);
+    assertDirent(dirent);
+  }
+
+  assert.deepStrictEqual(files, entries.sort());
+
+  // dir.read should return null when no more entries exist
+  assert.strictEqual(await dir.read(), null);
+
+  await dir.close();
+}
+doPromiseTest().then(common.mustCall());
+
+// Async iterator, with a batch size smaller than the directory
+async function doAsyncIterTest() {
+  const entries = [];
+  const dir = await fs.promises.opendir(testDir, { bufferSize: 2 });
+  for await (const dirent of dir) {
+    entries.push(dirent.name);
+    assertDirent(dirent);
+  }
+
+  assert.deepStrictEqual(files, entries.sort());
+
+  // Automatically closed during iterator
+  common.expectsError(() => dir.readSync(), dirclosedError);
+}
+doAsyncIterTest().then(common.mustCall());
+
+// Async iterators should close the directory when left early
+async function doAsyncIterBreakTest() {
+  const dir = await fs.promises.opendir(testDir);
+  for await (const dirent of dir) { // eslint-disable-line no-unused-vars
+    break;
+  }
+
+  common.expectsError(() => dir.readSync(), dirclosedError);
+}
+doAsyncIterBreakTest().then(common.mustCall());
+
+// Concurrent reads are queued and return distinct entries
+{
+  const dir = fs.opendirSync(testDir, { bufferSize: 1 });
+  const names = [];
+  const onRead = common.mustCall((err, dirent) => {
+    assert.ifError(err);
+    names.push(dirent.name);
+  }, files.length);
+  for (let i = 0; i < files.length; i++)
+    dir.read(onRead);
+
+  common.expectsError(() => dir.readSync(), {
+    code: 'ERR_DIR_CONCURRENT_OPERATION'
+  });
+
+  dir.close(common.mustCall((err) => {
+    assert.ifError(err);
+    assert.deepStrictEqual(names.sort(), files);
+  }));
+}
+
+// Buffer names
+{
+  const dir = fs.opendirSync(testDir, 'buffer');
+  const dirent = dir.readSync();
+  assert(Buffer.isBuffer(dirent.name));
+  assert(files.includes(dirent.name.toString()));
+  dir.closeSync();
+}
+
+// Invalid buffer sizes
+[0, -1, 1.5, 'foo'].forEach((bufferSize) => {
+  assert.throws(() => fs.opendirSync(testDir, { bufferSize }), {
+    code: /^ERR_(OUT_OF_RANGE|INVALID_ARG_TYPE)$/
+  });
+});
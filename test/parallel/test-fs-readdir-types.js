@@ -0,0 +1,85 @@
+'use strict';
+// Flags: --expose-internals
+
+const common = require('../common');
+const assert = require('assert');
+const fs = require('fs');
+const path = require('path');
+
+const tmpdir = require('../common/tmpdir');
+
+const readdirDir = tmpdir.path;
+const files = ['empty', 'files', 'for', 'just', 'testing'];
+const dirs = ['a', 'b'];
+
+common.crashOnUnhandledRejection();
+
+function assertDirents(dirents) {
+  assert.strictEqual(dirents.length, files.length + dirs.length);
+  for (const dirent of dirents) {
+    assert(dirent instanceof fs.Dirent);
+    const isDir = dirs.includes(dirent.name);
+    assert.strictEqual(isDir || files.includes(dirent.name), true);
+    assert.strictEqual(dirent.isDirectory(), isDir);
+    assert.strictEqual(dirent.isFile(), !isDir);
+    assert.strictEqual(dirent.isSymbolicLink(), false);
+    assert.strictEqual(dirent.isFIFO(), false);
+    assert.strictEqual(dirent.isSocket(), false);
+    assert.strictEqual(dirent.isBlockDevice(), false);
+    assert.strictEqual(dirent.isCharacterDevice(), false);
+  }
+}
+
+tmpdir.refresh();
+for (const file of files)
+  fs.closeSync(fs.openSync(path.join(readdirDir, file), 'w'));
+for (const dir of dirs)
+  fs.mkdirSync(path.join(readdirDir, dir));
+
+// Check the readdir Sync version
+assertDirents(fs.readdirSync(readdirDir, { withFileTypes: true }));
+
+// Check the readdir async version
+fs.readdir(readdirDir, {
+  withFileTypes: true
+}, common.mustCall((err, dirents) => {
+  assert.ifError(err);
+  assertDirents(dirents);
+}));
+
+// Check the promisified version
+fs.promises.readdir(readdirDir, { withFileTypes: true })
+  .then(common.mustCall(assertDirents));
+
+// Without the option, plain names are returned.
+assert.deepStrictEqual(fs.readdirSync(readdirDir).sort(),
+                       dirs.concat(files).sort());
+
+// Buffer names are supported.
+{
+  const dirents = fs.readdirSync(readdirDir, {
+    encoding: 'buffer',
+    withFileTypes: true
+  });
+  assert(Buffer.isBuffer(dirents[0].name));
+  assert.deepStrictEqual(dirents.map((d) => d.name.toString()).sort(),
+                         dirs.concat(files).sort());
+}
+
+// Entries of unknown type are resolved through lstat().
+{
+  const { getDirents } = require('internal/fs/utils');
+  const { UV_DIRENT_UNKNOWN } = process.binding('constants').fs;
+  const names = files.concat(dirs);
+  const types = names.map(() => UV_DIRENT_UNKNOWN);
+
+  assertDirents(getDirents(readdirDir, [names.slice(), types]));
+  getDirents(readdirDir, [names.slice(), types], common.mustCall((err, d) => {
+    assert.ifError(err);
+    assertDirents(d);
+  }));
+  getDirents(readdirDir, [['does-not-exist'], [UV_DIRENT_UNKNOWN]],
+             common.mustCall((err) => {
+               assert.strictEqual(err.code, 'ENOENT');
+             }));
+}
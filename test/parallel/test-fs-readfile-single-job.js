@@ -0,0 +1,81 @@
+'use strict';
+const common = require('../common');
+const assert = require('assert');
+const async_hooks = require('async_hooks');
+const fs = require('fs');
+const path = require('path');
+
+// fs.readFile() opens, reads and closes a file in a single thread pool job,
+// and decodes strings without creating an intermediate Buffer in JS land.
+
+const tmpdir = require('../common/tmpdir');
+tmpdir.refresh();
+
+const file = path.join(tmpdir.path, 'single-job.txt');
+const contents = Buffer.from('ünïcödé '.repeat(100000));
+fs.writeFileSync(file, contents);
+
+{
+  let requests = 0;
+  const hook = async_hooks.createHook({
+    init(id, type) {
+      if (type === 'FSREQWRAP')
+        requests++;
+    }
+  }).enable();
+
+  fs.readFile(file, common.mustCall((err, data) => {
+    assert.ifError(err);
+    assert.deepStrictEqual(data, contents);
+    assert.strictEqual(requests, 1);
+  }));
+  hook.disable();
+}
+
+for (const encoding of ['utf8', 'latin1', 'hex', 'base64']) {
+  fs.readFile(file, encoding, common.mustCall((err, data) => {
+    assert.ifError(err);
+    assert.strictEqual(data, contents.toString(encoding));
+  }));
+}
+
+{
+  // Reading from a file descriptor starts at its current position and leaves
+  // it open.
+  const fd = fs.openSync(file, 'r');
+  fs.readSync(fd, Buffer.alloc(10), 0, 10, null);
+  fs.readFile(fd, common.mustCall((err, data) => {
+    assert.ifError(err);
+    assert.deepStrictEqual(data, contents.slice(10));
+    fs.closeSync(fd);
+  }));
+}
+
+fs.readFile(path.join(tmpdir.path, 'missing'), common.mustCall((err, data) => {
+  assert.strictEqual(err.code, 'ENOENT');
+  assert.strictEqual(err.syscall, 'open');
+  assert.strictEqual(err.path, path.join(tmpdir.path, 'missing'));
+  assert.strictEqual(data, undefined);
+}));
+
+if (!common.isWindows) {
+  fs.readFile(tmpdir.path, common.mustCall((err) => {
+    assert.strictEqual(err.code, 'EISDIR');
+    assert.strictEqual(err.syscall, 'read');
+  }));
+}
+
+if (common.isLinux) {
+  // Files in /proc report a size of zero.
+  fs.readFile('/proc/self/cmdline', 'latin1', common.mustCall((err, data) => {
+    assert.ifError(err);
+    assert.strictEqual(data.split('\0')[0], process.argv0);
+  }));
+}
+
+// An empty path is a path, not a file descriptor.
+fs.readFile('', common.mustCall((err, data) => {
+  assert.strictEqual(err.code, 'ENOENT');
+  assert.strictEqual(err.syscall, 'open');
+  assert.strictEqual(data, undefined);
+}));
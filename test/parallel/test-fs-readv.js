@@ -0,0 +1,116 @@
+'use strict';
+
+const common = require('../common');
+const assert = require('assert');
+const fs = require('fs');
+const path = require('path');
+const tmpdir = require('../common/tmpdir');
+
+tmpdir.refresh();
+common.crashOnUnhandledRejection();
+
+const filename = path.join(tmpdir.path, 'readv.txt');
+const data = Buffer.from('0123456789abcdefghijklmnopqrstuvwxyz');
+fs.writeFileSync(filename, data);
+
+function allocate(...lengths) {
+  return lengths.map((length) => Buffer.alloc(length));
+}
+
+{
+  // Reads fill the buffers in order and stop at the end of the file.
+  const fd = fs.openSync(filename, 'r');
+  const buffers = allocate(4, 6, 100);
+  assert.strictEqual(fs.readvSync(fd, buffers, 0), data.length);
+  assert.strictEqual(Buffer.concat(buffers).toString().slice(0, data.length),
+                     data.toString());
+
+  // Without a position, the file position is used and advanced.
+  const first = allocate(10);
+  const second = allocate(10);
+  assert.strictEqual(fs.readvSync(fd, first, null), 10);
+  assert.strictEqual(fs.readvSync(fd, second), 10);
+  assert.strictEqual(first[0].toString(), '0123456789');
+  assert.strictEqual(second[0].toString(), 'abcdefghij');
+
+  const buffers2 = allocate(3, 3);
+  fs.readv(fd, buffers2, 30, common.mustCall((err, bytesRead, buffers) => {
+    assert.ifError(err);
+    assert.strictEqual(bytesRead, 6);
+    assert.strictEqual(buffers, buffers2);
+    assert.deepStrictEqual(buffers.map(String), ['uvw', 'xyz']);
+    fs.closeSync(fd);
+  }));
+}
+
+{
+  const fd = fs.openSync(filename, 'r');
+  fs.readRanges(fd, [
+    { position: 10, length: 3 },
+    { position: 0, length: 2 },
+    { position: 34, length: 10 },
+    { position: 100, length: 5 },
+    { position: 5, length: 0 }
+  ], common.mustCall((err, buffers) => {
+    assert.ifError(err);
+    assert.deepStrictEqual(buffers.map(String), ['abc', '01', 'yz', '', '']);
+    // The results share a single allocation.
+    assert.strictEqual(buffers[0].buffer, buffers[1].buffer);
+    fs.readRanges(fd, [], common.mustCall((err, buffers) => {
+      assert.ifError(err);
+      assert.deepStrictEqual(buffers, []);
+      fs.closeSync(fd);
+    }));
+  }));
+}
+
+fs.promises.open(filename, 'r').then(common.mustCall(async (handle) => {
+  const { bytesRead, buffers } = await handle.readv(allocate(2, 2), 4);
+  assert.strictEqual(bytesRead, 4);
+  assert.deepStrictEqual(buffers.map(String), ['45', '67']);
+
+  const ranges = Array.from({ length: 100 }, (v, i) => {
+    return { position: i % data.length, length: 1 };
+  });
+  const results = await handle.readRanges(ranges);
+  assert.strictEqual(results.length, 100);
+  results.forEach((buffer, i) => {
+    assert.strictEqual(buffer[0], data[i % data.length]);
+  });
+  await handle.close();
+}));
+
+{
+  const fd = fs.openSync(filename, 'r');
+  const range = { position: 0, length: 1 };
+  fs.readRanges(1 << 30, [range], common.mustCall((err) => {
+    assert.strictEqual(err.code, 'EBADF');
+    assert.strictEqual(err.syscall, 'read');
+  }));
+  common.expectsError(() => fs.readvSync(1 << 30, allocate(1)), {
+    code: 'EBADF'
+  });
+
+  common.expectsError(() => fs.readvSync(fd, Buffer.alloc(1)), {
+    code: 'ERR_INVALID_ARG_TYPE'
+  });
+  common.expectsError(() => fs.readv(fd, ['x'], common.mustNotCall()), {
+    code: 'ERR_INVALID_ARG_TYPE'
+  });
+  common.expectsError(() => fs.readRanges(fd, {}, common.mustNotCall()), {
+    code: 'ERR_INVALID_ARG_TYPE'
+  });
+  common.expectsError(() => fs.readRanges(fd, [null], common.mustNotCall()), {
+    code: 'ERR_INVALID_ARG_TYPE'
+  });
+  for (const range of [{ position: -1, length: 1 },
+                       { position: 0, length: 1.5 },
+                       { position: 0, length: 2 ** 32 + 1 }]) {
+    common.expectsError(() => fs.readRanges(fd, [range], common.mustNotCall()),
+                        { code: 'ERR_OUT_OF_RANGE' });
+  }
+  common.expectsError(() => fs.readRanges(fd, []), {
+    code: 'ERR_INVALID_CALLBACK'
+  });
+  fs.closeSync(fd);
+}
@@ -0,0 +1,133 @@
+'use strict';
+
+const common = require('../common');
+const assert = require('assert');
+const fs = require('fs');
+const path = require('path');
+
+const tmpdir = require('../common/tmpdir');
+
+common.crashOnUnhandledRejection();
+
+tmpdir.refresh();
+const root = path.join(tmpdir.path, 'walk');
+const dirs = ['a', 'a/b', 'a/b/c', 'node_modules', 'node_modules/x'];
+const files = ['index.js', 'README.md', 'a/one.js', 'a/b/two.js',
+               'a/b/c/three.txt', 'node_modules/x/index.js'];
+
+fs.mkdirSync(root);
+for (const dir of dirs)
+  fs.mkdirSync(path.join(root, dir));
+for (const file of files)
+  fs.writeFileSync(path.join(root, file), file);
+
+function relative(p) {
+  return path.relative(root, p).split(path.sep).join('/');
+}
+
+async function collect(walker) {
+  const entries = new Map();
+  for await (const batch of walker) {
+    assert.strictEqual(batch.statValues.length, batch.length * 14);
+    for (let i = 0; i < batch.length; i++)
+      entries.set(relative(batch.paths[i]), batch.stats(i));
+  }
+  return entries;
+}
+
+async function test() {
+  // Every entry is reported once, with its stats.
+  {
+    const entries = await collect(fs.walk(root));
+    assert.deepStrictEqual([...entries.keys()].sort(),
+                           dirs.concat(files).sort());
+    for (const dir of dirs)
+      assert.strictEqual(entries.get(dir).isDirectory(), true);
+    for (const file of files) {
+      const stats = entries.get(file);
+      assert.strictEqual(stats.isFile(), true);
+      assert.strictEqual(stats.size, Buffer.byteLength(file));
+      assert.strictEqual(stats.ino, fs.statSync(path.join(root, file)).ino);
+    }
+  }
+
+  // Filters are applied to the relative paths.
+  {
+    const entries = await collect(fs.walk(root, {
+      include: '**/*.js',
+      exclude: ['node_modules']
+    }));
+    assert.deepStrictEqual([...entries.keys()].sort(),
+                           ['a/b/two.js', 'a/one.js', 'index.js']);
+  }
+  {
+    const entries = await collect(fs.walk(root, {
+      include: ['*', 'a/*/?'],
+      exclude: '**/b/*.js'
+    }));
+    assert.deepStrictEqual([...entries.keys()].sort(),
+                           ['README.md', 'a', 'a/b/c', 'index.js',
+                            'node_modules']);
+  }
+
+  // Batches never exceed the batch size.
+  {
+    const walker = fs.walk(root, { batchSize: 2, concurrency: 1 });
+    let count = 0;
+    let batch;
+    while ((batch = await walker.read()) !== null) {
+      assert(batch.length > 0 && batch.length <= 2);
+      count += batch.length;
+    }
+    assert.strictEqual(count, dirs.length + files.length);
+    assert.strictEqual(await walker.read(), null);
+  }
+
+  // Closing ends the walk.
+  {
+    const walker = fs.walk(root, { batchSize: 1 });
+    assert.notStrictEqual(await walker.read(), null);
+    walker.close();
+    assert.strictEqual(await walker.read(), null);
+  }
+
+  // Errors on the root are reported.
+  await assert.rejects(fs.walk(path.join(root, 'missing')).read(), {
+    code: 'ENOENT',
+    syscall: 'scandir'
+  });
+  await assert.rejects(fs.walk(path.join(root, 'index.js')).read(), {
+    code: 'ENOTDIR'
+  });
+}
+
+test().then(common.mustCall());
+
+// Callback flavor.
+{
+  const walker = fs.walk(root, { batchSize: 3 });
+  const seen = [];
+  function onBatch(err, batch) {
+    assert.ifError(err);
+    if (batch === null) {
+      assert.deepStrictEqual(seen.sort(), dirs.concat(files).sort());
+      return;
+    }
+    seen.push(...batch.paths.map(relative));
+    walker.read(common.mustCall(onBatch));
+  }
+  walker.read(common.mustCall(onBatch));
+}
+
+common.expectsError(() => fs.walk(root, { include: [1] }), {
+  code: 'ERR_INVALID_ARG_TYPE',
+  type: TypeError
+});
+common.expectsError(() => fs.walk(root, { batchSize: 0 }), {
+  code: 'ERR_OUT_OF_RANGE',
+  type: RangeError
+});
+common.expectsError(() => fs.walk(root).read(42), {
+  code: 'ERR_INVALID_CALLBACK',
+  type: TypeError
+});
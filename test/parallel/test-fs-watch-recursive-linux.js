@@ -0,0 +1,123 @@
+'use strict';
+
+const common = require('../common');
+
+if (!common.isLinux)
+  common.skip('the native recursive watcher is Linux specific');
+
+const assert = require('assert');
+const fs = require('fs');
+const path = require('path');
+
+const tmpdir = require('../common/tmpdir');
+tmpdir.refresh();
+
+// A recursive watcher follows the whole tree, including directories that are
+// created after it has been started, and delivers coalesced events.
+
+const root = path.join(tmpdir.path, 'tree');
+fs.mkdirSync(root);
+fs.mkdirSync(path.join(root, 'a'));
+fs.mkdirSync(path.join(root, 'a', 'b'));
+
+const watcher = fs.watch(root, { recursive: true });
+const seen = new Map();
+let step = 0;
+
+function expect(filename, eventType, next) {
+  const check = () => {
+    if (seen.get(filename) !== eventType)
+      return;
+    watcher.removeListener('change', check);
+    seen.clear();
+    next();
+  };
+  watcher.on('change', check);
+}
+
+watcher.on('change', (eventType, filename) => {
+  assert(eventType === 'rename' || eventType === 'change');
+  assert.strictEqual(typeof filename, 'string');
+  seen.set(filename, eventType);
+});
+
+// Files deep in the tree are reported relative to the root.
+expect('a/b/file.txt', 'rename', common.mustCall(() => {
+  step++;
+
+  // Repeated writes to the same file within a batch collapse into one event.
+  let changes = 0;
+  const counter = (eventType, filename) => {
+    if (filename === 'a/b/file.txt')
+      changes++;
+  };
+  watcher.on('change', counter);
+  expect('a/b/file.txt', 'change', common.mustCall(() => {
+    setTimeout(common.mustCall(() => {
+      watcher.removeListener('change', counter);
+      assert.strictEqual(changes, 1);
+      step++;
+      testNewDirectories();
+    }), 100);
+  }));
+  const fd = fs.openSync(path.join(root, 'a', 'b', 'file.txt'), 'a');
+  for (let i = 0; i < 100; i++)
+    fs.writeSync(fd, 'x');
+  fs.closeSync(fd);
+}));
+fs.writeFileSync(path.join(root, 'a', 'b', 'file.txt'), '');
+
+function testNewDirectories() {
+  // Directories created after the watcher started are watched, too, along
+  // with whatever they already contain when the watch is added.
+  expect('c/d/new.txt', 'change', common.mustCall(() => {
+    step++;
+    testRemovedDirectories();
+  }));
+  fs.mkdirSync(path.join(root, 'c'));
+  fs.mkdirSync(path.join(root, 'c', 'd'));
+  fs.writeFileSync(path.join(root, 'c', 'd', 'new.txt'), 'x');
+  setTimeout(() => {
+    fs.appendFileSync(path.join(root, 'c', 'd', 'new.txt'), 'y');
+  }, 100);
+}
+
+function testRemovedDirectories() {
+  // Directories moved out of the tree are no longer reported, while those
+  // moved within it are reported under their new name.
+  const outside = path.join(tmpdir.path, 'outside');
+  fs.renameSync(path.join(root, 'a'), outside);
+  fs.renameSync(path.join(root, 'c'), path.join(root, 'e'));
+  expect('e/d/new.txt', 'change', common.mustCall(() => {
+    step++;
+    watcher.close();
+  }));
+  setTimeout(() => {
+    watcher.on('change', (eventType, filename) => {
+      assert(!filename.startsWith('a/'), filename);
+    });
+    fs.appendFileSync(path.join(outside, 'b', 'file.txt'), 'z');
+    fs.appendFileSync(path.join(root, 'e', 'd', 'new.txt'), 'z');
+  }, 100);
+}
+
+watcher.on('close', common.mustCall());
+
+process.on('exit', () => assert.strictEqual(step, 4));
+
+{
+  // Files are watched like without the option.
+  const file = path.join(tmpdir.path, 'file.txt');
+  fs.writeFileSync(file, '');
+  const fileWatcher = fs.watch(file, { recursive: true });
+  fileWatcher.on('change', common.mustCall((eventType, filename) => {
+    assert.strictEqual(eventType, 'change');
+    assert.strictEqual(filename, 'file.txt');
+    fileWatcher.close();
+  }));
+  fs.appendFileSync(file, 'x');
+
+  common.expectsError(() => {
+    fs.watch(path.join(tmpdir.path, 'missing'), { recursive: true });
+  }, { code: 'ENOENT' });
+}
@@ -0,0 +1,137 @@
+'use strict';
+// Flags: --expose-internals
+const common = require('../common');
+const assert = require('assert');
+const fs = require('fs');
+const path = require('path');
+const { StatWatcher } = require('internal/fs/watchers');
+
+const tmpdir = require('../common/tmpdir');
+tmpdir.refresh();
+
+{
+  // Files whose directory does not exist yet are polled, many of them at a
+  // time, and show up once they are created.
+  const dir = path.join(tmpdir.path, 'later');
+  const files = Array.from({ length: 200 }, (v, i) => {
+    return path.join(dir, `file-${i}.txt`);
+  });
+  let remaining = files.length;
+
+  files.forEach((file, i) => {
+    fs.watchFile(file, { interval: 20 }, (curr, prev) => {
+      // The file may be seen between its creation and the write.
+      if (curr.size !== String(i).length)
+        return;
+      fs.unwatchFile(file);
+      if (--remaining === 0)
+        testKernelNotifications();
+    });
+  });
+  process.on('exit', () => assert.strictEqual(remaining, 0));
+
+  setTimeout(() => {
+    fs.mkdirSync(dir);
+    files.forEach((file, i) => fs.writeFileSync(file, String(i)));
+  }, 50);
+}
+
+function testKernelNotifications() {
+  if (!common.isLinux)
+    return;
+
+  // On Linux, changes to files on local file systems are reported long
+  // before the interval is up, including replacements of the whole file.
+  const file = path.join(tmpdir.path, 'config.json');
+  const temp = path.join(tmpdir.path, 'config.json.tmp');
+  fs.writeFileSync(file, '{}');
+  const { ino } = fs.statSync(file);
+  const interval = 1e6;
+
+  const listener = common.mustCall((curr, prev) => {
+    if (curr.ino === ino) {
+      assert.strictEqual(prev.size, 2);
+      assert.strictEqual(curr.size, 12);
+      fs.writeFileSync(temp, '{"a":1}');
+      fs.renameSync(temp, file);
+      return;
+    }
+    assert.strictEqual(prev.ino, ino);
+    assert.strictEqual(curr.size, 7);
+    fs.unwatchFile(file, listener);
+    testRelativePath();
+  }, 2);
+  fs.watchFile(file, { interval }, listener);
+
+  // Give the baseline time to be taken.
+  setTimeout(() => fs.appendFileSync(file, '0123456789'), 100);
+}
+
+function testRelativePath() {
+  // The same goes for files that are watched through a relative path, which
+  // the binding resolves when watching starts. fs.watchFile() resolves them
+  // itself.
+  const cwd = process.cwd();
+  process.chdir(tmpdir.path);
+  fs.writeFileSync('relative.txt', 'x');
+  const watcher = new StatWatcher();
+  watcher.on('change', common.mustCall((curr, prev) => {
+    assert.strictEqual(prev.size, 1);
+    assert.strictEqual(curr.size, 2);
+    watcher.stop();
+    testSymlinks();
+  }));
+  watcher.start('relative.txt', true, 1e6);
+  process.chdir(cwd);
+  setTimeout(() => {
+    fs.appendFileSync(path.join(tmpdir.path, 'relative.txt'), 'y');
+  }, 100);
+}
+
+function testSymlinks() {
+  if (!common.canCreateSymLink())
+    return;
+
+  // Files are stat()ed through symbolic links, whose targets are outside the
+  // directory that the kernel would report changes for, so changes to the
+  // target are still noticed.
+  const a = path.join(tmpdir.path, 'a');
+  const b = path.join(tmpdir.path, 'b');
+  fs.mkdirSync(a);
+  fs.mkdirSync(b);
+  const real = path.join(a, 'real.txt');
+  const link = path.join(b, 'link.txt');
+  fs.writeFileSync(real, 'x');
+  fs.symlinkSync(real, link);
+
+  const listener = common.mustCall((curr, prev) => {
+    assert.strictEqual(prev.size, 1);
+    assert.strictEqual(curr.size, 3);
+    fs.unwatchFile(link, listener);
+    testSymlinkedDirectory(a);
+  });
+  fs.watchFile(link, { interval: 20 }, listener);
+  setTimeout(() => fs.writeFileSync(real, 'xyz'), 100);
+}
+
+function testSymlinkedDirectory(a) {
+  // The same goes for links on the way to the file, which may be changed to
+  // point to another directory.
+  const c = path.join(tmpdir.path, 'c');
+  const dir = path.join(tmpdir.path, 'dir');
+  fs.mkdirSync(c);
+  fs.writeFileSync(path.join(c, 'real.txt'), 'abcdef');
+  fs.symlinkSync(a, dir);
+  const file = path.join(dir, 'real.txt');
+
+  const listener = common.mustCall((curr, prev) => {
+    assert.strictEqual(prev.size, 3);
+    assert.strictEqual(curr.size, 6);
+    fs.unwatchFile(file, listener);
+  });
+  fs.watchFile(file, { interval: 20 }, listener);
+  setTimeout(() => {
+    fs.unlinkSync(dir);
+    fs.symlinkSync(c, dir);
+  }, 100);
+}
@@ -0,0 +1,83 @@
+'use strict';
+
+const common = require('../common');
+const assert = require('assert');
+const http = require('http');
+
+common.crashOnUnhandledRejection();
+
+common.expectsError(() => new http.Agent({ scheduling: 'random' }), {
+  code: 'ERR_INVALID_OPT_VALUE',
+  type: TypeError
+});
+
+const server = http.createServer((req, res) => {
+  res.end(String(req.socket.remotePort));
+});
+
+function get(agent) {
+  return new Promise((resolve) => {
+    http.get({ port: server.address().port, agent }, (res) => {
+      let body = '';
+      res.setEncoding('utf8');
+      res.on('data', (chunk) => body += chunk);
+      res.on('end', () => resolve(body));
+    });
+  });
+}
+
+async function run(scheduling) {
+  const agent = new http.Agent({ keepAlive: true, scheduling });
+  assert.strictEqual(agent.scheduling, scheduling);
+
+  // Open two sockets, freeing the first one before the second one.
+  const [first, second] = await Promise.all([get(agent), get(agent)]);
+  const name = Object.keys(agent.freeSockets)[0];
+  assert.strictEqual(agent.freeSockets[name].length, 2);
+
+  const next = await get(agent);
+  assert.strictEqual(next, scheduling === 'fifo' ? first : second);
+
+  // Free sockets that were destroyed while idle are not handed out.
+  agent.freeSockets[name].forEach((socket) => socket.destroy());
+  const fresh = await get(agent);
+  assert.notStrictEqual(fresh, first);
+  assert.notStrictEqual(fresh, second);
+
+  // Nor are those whose peer has closed them, before their 'close' event.
+  agent.freeSockets[name][0].push(null);
+  const other = await get(agent);
+  assert.notStrictEqual(other, fresh);
+
+  assert.deepStrictEqual(agent.getPoolStats(), {
+    [name]: { free: 1, active: 0, pending: 0 }
+  });
+  agent.destroy();
+}
+
+function testPoolStats() {
+  const agent = new http.Agent({ maxSockets: 1 });
+  assert.deepStrictEqual(agent.getPoolStats(), {});
+
+  const port = server.address().port;
+  const name = agent.getName({ port });
+  let done = 0;
+  const onResponse = common.mustCall((res) => {
+    res.resume();
+    res.on('end', () => {
+      if (++done === 2)
+        server.close();
+    });
+  }, 2);
+  http.get({ port, agent }, onResponse);
+  http.get({ port, agent }, onResponse);
+  assert.deepStrictEqual(agent.getPoolStats(), {
+    [name]: { free: 0, active: 1, pending: 1 }
+  });
+}
+
+server.listen(0, common.mustCall(async () => {
+  await run('fifo');
+  await run('lifo');
+  testPoolStats();
+}));
@@ -0,0 +1,81 @@
+'use strict';
+
+const common = require('../common');
+const assert = require('assert');
+const http = require('http');
+const { serializeHeaders } = process.binding('http_parser');
+
+const firstLine = 'HTTP/1.1 200 OK\r\n';
+
+assert.strictEqual(serializeHeaders(firstLine, [], false), `${firstLine}\r\n`);
+assert.strictEqual(
+  serializeHeaders(firstLine, ['Content-Length', 42, 'X-Foo', 'b\xe4r'], true),
+  `${firstLine}Content-Length: 42\r\nX-Foo: b\xe4r\r\n\r\n`);
+
+// Line breaks are stripped from values that are not validated.
+assert.strictEqual(
+  serializeHeaders(firstLine, ['X-Foo', 'a\r\n b\nc'], false),
+  `${firstLine}X-Foo: abc\r\n\r\n`);
+
+// The index of the first invalid entry is returned when validating.
+const invalid = [
+  ['X Foo', 'bar'],
+  ['', 'bar'],
+  [42, 'bar'],
+  ['X-Főo', 'bar'],
+  ['X-Foo', 'b\r\nar'],
+  ['X-Foo', 'b\x7far'],
+  ['X-Foo', 'bār'],
+  ['X-Foo', undefined]
+];
+for (const [name, value] of invalid) {
+  assert.strictEqual(
+    serializeHeaders(firstLine, ['X-Valid', 'ok', name, value], true), 2);
+}
+
+// Invalid headers that reach _storeHeader() still throw the errors of the JS
+// validators, and no header is stored.
+{
+  const cases = [
+    [{ 'X Foo': 'bar' }, 'ERR_INVALID_HTTP_TOKEN'],
+    [{ 'X-Főo': 'bar' }, 'ERR_INVALID_HTTP_TOKEN'],
+    [{ 'X-Foo': 'b\r\nar' }, 'ERR_INVALID_CHAR'],
+    [{ 'X-Foo': 'bār' }, 'ERR_INVALID_CHAR'],
+    [{ 'X-Foo': undefined }, 'ERR_HTTP_INVALID_HEADER_VALUE'],
+    [[['X Foo', 'bar']], 'ERR_INVALID_HTTP_TOKEN'],
+    [[['X-Foo', 'b\x7far']], 'ERR_INVALID_CHAR']
+  ];
+
+  const server = http.createServer(common.mustCall((req, res) => {
+    for (const [headers, code] of cases) {
+      common.expectsError(() => res.writeHead(200, headers), { code });
+      assert.strictEqual(res._header, null);
+    }
+
+    // setHeader() validates on its own, before the head is serialized.
+    common.expectsError(() => res.setHeader('X Foo', 'bar'),
+                        { code: 'ERR_INVALID_HTTP_TOKEN' });
+    common.expectsError(() => res.setHeader('X-Foo', 'b\nar'),
+                        { code: 'ERR_INVALID_CHAR' });
+
+    res.setHeader('X-Valid', 'ok');
+    res.writeHead(200, { 'X-Other': 'b\xe4r' });
+    assert.strictEqual(typeof res._header, 'string');
+    res.end();
+  }));
+
+  server.listen(0, common.mustCall(() => {
+    const { port } = server.address();
+    // Request headers given as an array are serialized the same way.
+    common.expectsError(() => {
+      http.request({ port, headers: [['X Foo', 'bar']] });
+    }, { code: 'ERR_INVALID_HTTP_TOKEN' });
+
+    http.get({ port }, common.mustCall((res) => {
+      assert.strictEqual(res.headers['x-valid'], 'ok');
+      assert.strictEqual(res.headers['x-other'], 'b\xe4r');
+      res.resume();
+      server.close();
+    }));
+  }));
+}
@@ -0,0 +1,68 @@
+'use strict';
+
+const common = require('../common');
+const assert = require('assert');
+const http = require('http');
+const net = require('net');
+const { HTTPParser } = process.binding('http_parser');
+
+{
+  // All complete requests of one execute() call arrive in a single batch.
+  const parser = new HTTPParser(HTTPParser.REQUEST);
+  parser[HTTPParser.kOnHeadersComplete] = common.mustNotCall();
+  parser[HTTPParser.kOnMessageComplete] = common.mustNotCall();
+  parser[HTTPParser.kOnMessages] = common.mustCall((messages) => {
+    assert.deepStrictEqual(messages, [
+      1, 1, ['Host', 'x'], 1, '/a', true, true,
+      1, 0, [], 1, '/b', false, true
+    ]);
+  });
+  const data = 'GET /a HTTP/1.1\r\nHost: x\r\n\r\nGET /b HTTP/1.0\r\n\r\n';
+  assert.strictEqual(parser.execute(Buffer.from(data)), data.length);
+}
+
+// Pipelined requests are emitted in order, with their headers and bodies
+// intact, when the parser batches requests.
+
+const requests = [
+  'GET /a HTTP/1.1\r\nHost: x\r\nX-Index: 0\r\n\r\n',
+  'GET /b HTTP/1.1\r\nHost: x\r\nX-Index: 1\r\n\r\n',
+  'POST /c HTTP/1.1\r\nHost: x\r\nX-Index: 2\r\nContent-Length: 5\r\n\r\nhello',
+  'GET /d HTTP/1.1\r\nHost: x\r\nX-Index: 3\r\n\r\n',
+  'POST /e HTTP/1.1\r\nHost: x\r\nX-Index: 4\r\n' +
+    'Transfer-Encoding: chunked\r\n\r\n3\r\nabc\r\n0\r\n\r\n',
+  'GET /f HTTP/1.1\r\nHost: x\r\nX-Index: 5\r\nConnection: close\r\n\r\n'
+];
+const paths = ['/a', '/b', '/c', '/d', '/e', '/f'];
+const bodies = ['', '', 'hello', '', 'abc', ''];
+
+let index = 0;
+const server = http.createServer({ batchRequests: true }, (req, res) => {
+  const i = index++;
+  assert.strictEqual(req.url, paths[i]);
+  assert.strictEqual(req.headers['x-index'], String(i));
+  let body = '';
+  req.setEncoding('utf8');
+  req.on('data', (chunk) => body += chunk);
+  req.on('end', common.mustCall(() => {
+    assert.strictEqual(body, bodies[i]);
+    res.end(`${i};`);
+  }));
+});
+
+server.on('request', common.mustCall(requests.length));
+
+server.listen(0, common.mustCall(() => {
+  const socket = net.connect(server.address().port, () => {
+    socket.end(requests.join(''));
+  });
+  let response = '';
+  socket.setEncoding('utf8');
+  socket.on('data', (chunk) => response += chunk);
+  socket.on('end', common.mustCall(() => {
+    const bodies = response.match(/\r\n\r\n\d+;/g)
+      .map((match) => match.slice(4));
+    assert.deepStrictEqual(bodies, ['0;', '1;', '2;', '3;', '4;', '5;']);
+    server.close();
+  }));
+}));
@@ -0,0 +1,49 @@
+'use strict';
+
+const common = require('../common');
+if (!common.hasCrypto)
+  common.skip('missing crypto');
+const assert = require('assert');
+const http2 = require('http2');
+
+// When a stream is paused while a batch of DATA chunks is being delivered,
+// the rest of the batch is not acknowledged to the peer, so the peer cannot
+// send more than the stream's flow control window until it is resumed.
+
+const kWindowSize = 65535;
+const kChunkSize = 60000;
+const chunk = Buffer.alloc(kChunkSize, 'a');
+
+const server = http2.createServer({ batchReads: true });
+server.on('stream', common.mustCall((stream) => {
+  let received = 0;
+  stream.on('data', (data) => {
+    received += data.length;
+  });
+  stream.once('data', common.mustCall(() => {
+    stream.pause();
+    setTimeout(common.mustCall(() => {
+      assert(received + stream.readableLength <= kWindowSize,
+             `${received + stream.readableLength} bytes were received`);
+      stream.resume();
+    }), common.platformTimeout(200));
+  }));
+  stream.on('end', common.mustCall(() => {
+    assert.strictEqual(received, 2 * kChunkSize);
+    stream.respond();
+    stream.end();
+  }));
+}));
+
+server.listen(0, common.mustCall(() => {
+  const client = http2.connect(`http://localhost:${server.address().port}`);
+  const req = client.request({ ':method': 'POST' });
+  // The first chunk arrives in a single read and fills most of the window.
+  req.write(chunk);
+  req.end(chunk);
+  req.resume();
+  req.on('end', common.mustCall(() => {
+    client.close();
+    server.close();
+  }));
+}));
@@ -0,0 +1,55 @@
+'use strict';
+
+const common = require('../common');
+if (!common.hasCrypto)
+  common.skip('missing crypto');
+const assert = require('assert');
+const http2 = require('http2');
+
+// DATA frames for many concurrent streams are delivered correctly, and in
+// order with respect to the end of each stream, when reads are batched on
+// both the server and the client side.
+
+const kStreams = 50;
+const kChunks = 4;
+
+const server = http2.createServer({ batchReads: true });
+server.on('stream', common.mustCall((stream, headers) => {
+  let body = '';
+  stream.setEncoding('utf8');
+  stream.on('data', (chunk) => body += chunk);
+  stream.on('end', common.mustCall(() => {
+    stream.respond({ ':status': 200 });
+    // Echo the request body back in several frames.
+    for (let i = 0; i < kChunks; i++)
+      stream.write(`${headers[':path']}:${body}:${i};`);
+    stream.end();
+  }));
+}, kStreams));
+
+server.listen(0, common.mustCall(() => {
+  const client = http2.connect(`http://localhost:${server.address().port}`,
+                               { batchReads: true });
+  let remaining = kStreams;
+
+  for (let n = 0; n < kStreams; n++) {
+    const req = client.request({ ':path': `/${n}`, ':method': 'POST' });
+    for (let i = 0; i < kChunks; i++)
+      req.write(`${n}.${i}`);
+    req.end();
+
+    let data = '';
+    req.setEncoding('utf8');
+    req.on('data', (chunk) => data += chunk);
+    req.on('end', common.mustCall(() => {
+      const body = Array.from({ length: kChunks }, (v, i) => `${n}.${i}`);
+      const expected = Array.from({ length: kChunks },
+                                  (v, i) => `/${n}:${body.join('')}:${i};`);
+      assert.strictEqual(data, expected.join(''));
+      if (--remaining === 0) {
+        client.close();
+        server.close();
+      }
+    }));
+  }
+}));
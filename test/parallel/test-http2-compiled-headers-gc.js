@@ -0,0 +1,42 @@
+// Flags: --expose-gc
+'use strict';
+
+const common = require('../common');
+if (!common.hasCrypto)
+  common.skip('missing crypto');
+const assert = require('assert');
+const http2 = require('http2');
+
+// Header blocks that are compiled for a single response are released by the
+// session once their frames have been sent, and can then be collected while
+// the session is still in use.
+const kRequests = 20;
+
+const server = http2.createServer();
+server.on('stream', common.mustCall((stream, headers) => {
+  stream.respond({}, {
+    compiledHeaders: http2.compileHeaders({ 'x-path': headers[':path'] })
+  });
+  stream.end();
+  setImmediate(global.gc);
+}, kRequests));
+
+server.listen(0, common.mustCall(() => {
+  const client = http2.connect(`http://localhost:${server.address().port}`);
+  let i = 0;
+  function request() {
+    const path = `/${i}`;
+    const req = client.request({ ':path': path });
+    req.on('response', common.mustCall((headers) => {
+      assert.strictEqual(headers['x-path'], path);
+    }));
+    req.resume();
+    req.on('end', common.mustCall(() => {
+      if (++i < kRequests)
+        return request();
+      client.close();
+      server.close();
+    }));
+  }
+  request();
+}));
@@ -0,0 +1,95 @@
+'use strict';
+
+const common = require('../common');
+if (!common.hasCrypto)
+  common.skip('missing crypto');
+const assert = require('assert');
+const http2 = require('http2');
+
+const compiled = http2.compileHeaders({
+  'Content-Type': 'text/plain',
+  'cache-control': 'max-age=60',
+  'x-multi': ['a', 'b']
+});
+assert.deepStrictEqual(Object.keys(compiled.headers),
+                       ['Content-Type', 'cache-control', 'x-multi']);
+assert(Object.isFrozen(compiled.headers));
+
+// Pseudo-headers and the date header cannot be precompiled.
+common.expectsError(() => http2.compileHeaders({ ':status': 200 }), {
+  code: 'ERR_HTTP2_INVALID_PSEUDOHEADER'
+});
+common.expectsError(() => http2.compileHeaders({ date: 'now' }), {
+  code: 'ERR_HTTP2_HEADER_SINGLE_VALUE'
+});
+common.expectsError(() => http2.compileHeaders({ connection: 'close' }), {
+  code: 'ERR_HTTP2_INVALID_CONNECTION_HEADERS'
+});
+common.expectsError(() => http2.compileHeaders('foo'), {
+  code: 'ERR_INVALID_ARG_TYPE'
+});
+
+const server = http2.createServer();
+server.on('stream', common.mustCall((stream, headers) => {
+  const port = server.address().port;
+
+  common.expectsError(() => {
+    stream.respond({ 'content-type': 'text/html' },
+                   { compiledHeaders: {} });
+  }, { code: 'ERR_INVALID_ARG_TYPE' });
+  common.expectsError(() => {
+    stream.respond({ 'content-type': 'text/html' },
+                   { compiledHeaders: compiled });
+  }, { code: 'ERR_HTTP2_HEADER_SINGLE_VALUE' });
+
+  stream.pushStream({
+    ':path': '/pushed',
+    ':authority': `localhost:${port}`,
+  }, { compiledHeaders: compiled }, common.mustCall((err, push) => {
+    assert.ifError(err);
+    push.respond({ ':status': 200 }, { compiledHeaders: compiled });
+    push.end('pushed');
+    stream.end('test');
+  }));
+
+  stream.respond({ 'x-request': 'yes' }, { compiledHeaders: compiled });
+  assert.strictEqual(stream.sentHeaders['x-request'], 'yes');
+  assert.strictEqual(stream.sentHeaders['Content-Type'], 'text/plain');
+  assert.strictEqual(stream.sentHeaders[':status'], 200);
+}));
+
+function checkHeaders(headers) {
+  assert.strictEqual(headers[':status'], 200);
+  assert.strictEqual(headers['content-type'], 'text/plain');
+  assert.strictEqual(headers['cache-control'], 'max-age=60');
+  assert.strictEqual(headers['x-multi'], 'a, b');
+}
+
+server.listen(0, common.mustCall(() => {
+  const port = server.address().port;
+  const client = http2.connect(`http://localhost:${port}`);
+  const req = client.request({ ':path': '/' });
+
+  client.on('stream', common.mustCall((stream, headers) => {
+    assert.strictEqual(headers[':path'], '/pushed');
+    assert.strictEqual(headers['content-type'], 'text/plain');
+    stream.on('push', common.mustCall(checkHeaders));
+    stream.resume();
+  }));
+
+  req.on('response', common.mustCall((headers) => {
+    checkHeaders(headers);
+    assert.strictEqual(headers['x-request'], 'yes');
+    assert.strictEqual(typeof headers.date, 'string');
+  }));
+
+  let data = '';
+  req.setEncoding('utf8');
+  req.on('data', (d) => data += d);
+  req.on('end', common.mustCall(() => {
+    assert.strictEqual(data, 'test');
+    server.close();
+    client.close();
+  }));
+  req.end();
+}));
@@ -0,0 +1,87 @@
+'use strict';
+
+const common = require('../common');
+if (!common.hasCrypto)
+  common.skip('missing crypto');
+const assert = require('assert');
+const http2 = require('http2');
+const { PerformanceObserver } = require('perf_hooks');
+
+// Headers marked as sensitive, either per request or for the whole session,
+// are not added to the HPACK dynamic table of the sending side.
+
+assert.strictEqual(typeof http2.sensitiveHeaders, 'symbol');
+
+const kRequests = 3;
+const modes = ['plain', 'symbol', 'option'];
+const clientEntries = [];
+
+const server = http2.createServer();
+server.on('stream', common.mustCall((stream, headers) => {
+  assert.strictEqual(headers['x-request-id'].length, 16);
+  stream.respond();
+  stream.end();
+}, kRequests * modes.length));
+
+const obs = new PerformanceObserver((items) => {
+  for (const entry of items.getEntries()) {
+    if (entry.name === 'Http2Session' && entry.type === 'client')
+      clientEntries.push(entry);
+  }
+  if (clientEntries.length === modes.length)
+    check();
+});
+obs.observe({ entryTypes: ['http2'] });
+
+function requestId(mode, i) {
+  return `${mode}-${i}`.padEnd(16, '.');
+}
+
+function run(index) {
+  const mode = modes[index];
+  const options = mode === 'option' ? { sensitiveHeaders: ['X-Request-Id'] } :
+    {};
+  const client = http2.connect(`http://localhost:${server.address().port}`,
+                               options);
+  let remaining = kRequests;
+  for (let i = 0; i < kRequests; i++) {
+    const headers = { 'x-request-id': requestId(mode, i) };
+    if (mode === 'symbol')
+      headers[http2.sensitiveHeaders] = ['x-request-id'];
+    const req = client.request(headers);
+    req.resume();
+    req.on('end', common.mustCall(() => {
+      if (--remaining > 0)
+        return;
+      client.close(common.mustCall(() => {
+        if (index + 1 < modes.length)
+          run(index + 1);
+      }));
+    }));
+  }
+}
+
+function check() {
+  obs.disconnect();
+  server.close();
+
+  const [plain, symbol, option] = clientEntries;
+  // Every indexed entry takes up the length of its name and value plus 32.
+  const entrySize = 32 + 'x-request-id'.length + 16;
+  assert.strictEqual(plain.deflateDynamicTableSize -
+                     symbol.deflateDynamicTableSize, kRequests * entrySize);
+  assert.strictEqual(symbol.deflateDynamicTableSize,
+                     option.deflateDynamicTableSize);
+
+  for (const entry of clientEntries) {
+    assert(entry.headerBytesSent > 0);
+    assert(entry.headerBlockBytesSent > 0);
+    assert(entry.headerBlockBytesSent < entry.headerBytesSent);
+    assert(entry.headerBytesReceived > 0);
+    assert(entry.inflateDynamicTableSize >= 0);
+  }
+  // Headers that are not indexed cannot be compressed by later references.
+  assert(plain.headerBlockBytesSent < symbol.headerBlockBytesSent);
+}
+
+server.listen(0, common.mustCall(() => run(0)));
@@ -0,0 +1,79 @@
+'use strict';
+
+// Tests the opt-in on-disk code cache for CommonJS modules enabled through
+// the NODE_COMPILE_CACHE environment variable.
+
+require('../common');
+const assert = require('assert');
+const fs = require('fs');
+const path = require('path');
+const { spawnSync } = require('child_process');
+const tmpdir = require('../common/tmpdir');
+
+tmpdir.refresh();
+
+const cacheDir = path.join(tmpdir.path, 'cache', 'nested');
+const entry = path.join(tmpdir.path, 'entry.js');
+const dep = path.join(tmpdir.path, 'dep.js');
+
+fs.writeFileSync(dep, 'module.exports = function() { return "first"; };');
+fs.writeFileSync(entry, 'console.log(require("./dep")());');
+
+function run() {
+  const env = Object.assign({}, process.env, {
+    NODE_COMPILE_CACHE: cacheDir,
+    NODE_DEBUG: 'module'
+  });
+  const child = spawnSync(process.execPath, [entry], { env });
+  assert.strictEqual(child.status, 0, String(child.stderr));
+  return { stdout: String(child.stdout).trim(), stderr: String(child.stderr) };
+}
+
+function listEntries() {
+  const versionDirs = fs.readdirSync(cacheDir);
+  assert.strictEqual(versionDirs.length, 1);
+  return fs.readdirSync(path.join(cacheDir, versionDirs[0]));
+}
+
+{
+  // The first run populates the cache, creating the directory as needed.
+  const { stdout, stderr } = run();
+  assert.strictEqual(stdout, 'first');
+  assert(/compile cache miss for ".*dep\.js"/.test(stderr), stderr);
+  assert(/compile cache written for ".*dep\.js"/.test(stderr), stderr);
+  const entries = listEntries();
+  assert.strictEqual(entries.length, 2);
+  entries.forEach((name) => assert(/^[0-9a-f]{8}\.cache$/.test(name), name));
+}
+
+{
+  // The second run consumes it and does not rewrite it.
+  const { stdout, stderr } = run();
+  assert.strictEqual(stdout, 'first');
+  assert(/compile cache hit for ".*dep\.js"/.test(stderr), stderr);
+  assert(/compile cache hit for ".*entry\.js"/.test(stderr), stderr);
+  assert(!/compile cache written/.test(stderr), stderr);
+}
+
+{
+  // Modifying a module invalidates its entry, even if the size is unchanged.
+  fs.writeFileSync(dep, 'module.exports = function() { return "again"; };');
+  const future = new Date(Date.now() + 10000);
+  fs.utimesSync(dep, future, future);
+  const { stdout, stderr } = run();
+  assert.strictEqual(stdout, 'again');
+  assert(/compile cache stale for ".*dep\.js"/.test(stderr), stderr);
+  assert(/compile cache hit for ".*entry\.js"/.test(stderr), stderr);
+  assert.strictEqual(run().stdout, 'again');
+}
+
+{
+  // Corrupted entries are ignored and replaced.
+  const versionDir = path.join(cacheDir, fs.readdirSync(cacheDir)[0]);
+  for (const name of listEntries())
+    fs.writeFileSync(path.join(versionDir, name), 'garbage');
+  const { stdout, stderr } = run();
+  assert.strictEqual(stdout, 'again');
+  assert(/compile cache written for ".*dep\.js"/.test(stderr), stderr);
+  assert.strictEqual(listEntries().length, 2);
+}
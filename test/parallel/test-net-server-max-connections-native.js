@@ -0,0 +1,69 @@
+'use strict';
+const common = require('../common');
+const assert = require('assert');
+const net = require('net');
+
+common.crashOnUnhandledRejection();
+
+// Connections over the maxConnections limit are closed by the listening
+// handle without a 'connection' event, and are let through again once the
+// limit is raised or an existing connection goes away.
+
+const server = net.createServer();
+const accepted = [];
+server.maxConnections = 1;
+assert.strictEqual(server.maxConnections, 1);
+assert.strictEqual(server.rejectedConnections, 0);
+
+server.on('connection', (socket) => {
+  accepted.push(socket);
+  socket.write('hello');
+});
+
+function connect() {
+  return new Promise((resolve) => {
+    const client = net.connect(server.address().port);
+    let data = '';
+    client.setEncoding('utf8');
+    client.on('data', (chunk) => {
+      data += chunk;
+      resolve({ client, admitted: true });
+    });
+    client.on('error', common.mustNotCall());
+    client.on('close', () => {
+      if (data === '')
+        resolve({ client, admitted: false });
+    });
+  });
+}
+
+async function main() {
+  const first = await connect();
+  assert.strictEqual(first.admitted, true);
+
+  const rejected = await connect();
+  assert.strictEqual(rejected.admitted, false);
+  assert.strictEqual(accepted.length, 1);
+  assert.strictEqual(server.rejectedConnections, 1);
+
+  // Raising the limit takes effect right away.
+  server.maxConnections = 2;
+  const second = await connect();
+  assert.strictEqual(second.admitted, true);
+  assert.strictEqual(accepted.length, 2);
+
+  // Closing a connection frees up a slot.
+  accepted[0].on('close', common.mustCall(async () => {
+    const third = await connect();
+    assert.strictEqual(third.admitted, true);
+    assert.strictEqual(accepted.length, 3);
+    for (const { client } of [first, second, third])
+      client.end();
+    server.close();
+    // The count outlives the listening handle.
+    assert.strictEqual(server.rejectedConnections, 1);
+  }));
+  accepted[0].destroy();
+}
+
+server.listen(0, common.mustCall(() => main().then(common.mustCall())));
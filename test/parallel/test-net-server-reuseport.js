@@ -0,0 +1,27 @@
+'use strict';
+const common = require('../common');
+if (common.isWindows)
+  common.skip('SO_REUSEPORT is not supported on Windows');
+const assert = require('assert');
+const net = require('net');
+
+// Servers that set the reusePort option can listen on the same port.
+
+const first = net.createServer(common.mustNotCall());
+first.listen({ port: 0, reusePort: true }, common.mustCall(() => {
+  const { port } = first.address();
+
+  const second = net.createServer(common.mustNotCall());
+  second.listen({ port, reusePort: true }, common.mustCall(() => {
+    assert.strictEqual(second.address().port, port);
+
+    // Sockets without the option cannot join them.
+    const third = net.createServer(common.mustNotCall());
+    third.listen({ port }, common.mustNotCall());
+    third.on('error', common.mustCall((err) => {
+      assert.strictEqual(err.code, 'EADDRINUSE');
+      first.close();
+      second.close();
+    }));
+  }));
+}));
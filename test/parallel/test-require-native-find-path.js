@@ -0,0 +1,49 @@
+'use strict';
+
+// Tests the lookups performed by the native part of Module._findPath():
+// extensions, package.json "main" fields and index files.
+
+const common = require('../common');
+const assert = require('assert');
+const fs = require('fs');
+const path = require('path');
+const tmpdir = require('../common/tmpdir');
+
+tmpdir.refresh();
+
+function write(file, contents) {
+  const filename = path.join(tmpdir.path, file);
+  if (!fs.existsSync(path.dirname(filename)))
+    fs.mkdirSync(path.dirname(filename));
+  fs.writeFileSync(filename, contents);
+  return filename;
+}
+
+const ext = write('ext.js', 'module.exports = "ext";');
+const nodeModule = write('node_modules/dep.js', 'module.exports = "dep";');
+write('main-up/package.json', '{ "main": "../main-target" }');
+const mainTarget = write('main-target/index.js', 'module.exports = "up";');
+write('no-main/package.json', '{ "name": "no-main" }');
+const noMainIndex = write('no-main/index.js', 'module.exports = "index";');
+write('main-not-string/package.json', '{ "main": false }');
+const falsyIndex = write('main-not-string/index.js', 'module.exports = 1;');
+write('invalid/package.json', '{ "main": ');
+write('invalid/index.js', '');
+
+assert.strictEqual(require(path.join(tmpdir.path, 'ext')), 'ext');
+assert.strictEqual(require.resolve(path.join(tmpdir.path, 'ext')), ext);
+assert.strictEqual(require.resolve('dep', { paths: [tmpdir.path] }),
+                   nodeModule);
+assert.strictEqual(require(path.join(tmpdir.path, 'main-up')), 'up');
+assert.strictEqual(require.resolve(path.join(tmpdir.path, 'main-up')),
+                   mainTarget);
+assert.strictEqual(require.resolve(path.join(tmpdir.path, 'no-main')),
+                   noMainIndex);
+assert.strictEqual(require.resolve(path.join(tmpdir.path, 'main-not-string')),
+                   falsyIndex);
+
+// Invalid package.json files are still reported with the offending path.
+common.expectsError(() => require(path.join(tmpdir.path, 'invalid')), {
+  type: SyntaxError,
+  message: /^Error parsing .*invalid[/\\]package\.json: Unexpected end/
+});
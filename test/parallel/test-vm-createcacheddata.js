@@ -0,0 +1,43 @@
+'use strict';
+
+require('../common');
+
+const { Script } = require('vm');
+const assert = require('assert');
+
+// The functions are block scoped so that they do not leak into the global
+// scope when the scripts are run.
+const source = '{ const testFn = function() { return 1 + 1; }; testFn(); }';
+
+{
+  const script = new Script(source);
+  const cachedData = script.createCachedData();
+  assert(cachedData instanceof Buffer);
+  assert.ok(cachedData.length > 0);
+
+  const consumer = new Script(source, { cachedData });
+  assert.strictEqual(consumer.cachedDataRejected, false);
+  assert.strictEqual(consumer.runInThisContext(), 2);
+}
+
+{
+  // The code cache created after execution also covers the lazily compiled
+  // function and can be consumed just the same.
+  const script = new Script(source);
+  const before = script.createCachedData();
+  assert.strictEqual(script.runInThisContext(), 2);
+  const after = script.createCachedData();
+  assert.ok(after.length >= before.length);
+
+  const consumer = new Script(source, { cachedData: after });
+  assert.strictEqual(consumer.cachedDataRejected, false);
+}
+
+{
+  // Code cache created for one source is rejected for another one.
+  const cachedData = new Script(source).createCachedData();
+  const other = new Script('{ const other = () => 42; other(); }',
+                           { cachedData });
+  assert.strictEqual(other.cachedDataRejected, true);
+  assert.strictEqual(other.runInThisContext(), 42);
+}
@@ -0,0 +1,164 @@
+'use strict';
+
+const common = require('../common');
+const assert = require('assert');
+const net = require('net');
+const {
+  WebSocketParser,
+  encodeFrameHeader,
+  mask,
+  unmask,
+  isValidUTF8
+} = process.binding('websocket');
+
+const maskKey = Buffer.from([0x12, 0x34, 0x56, 0x78]);
+
+function frame(opcode, payload, { fin = true, masked = true } = {}) {
+  payload = Buffer.from(payload);
+  if (!masked)
+    return Buffer.concat([encodeFrameHeader(opcode, fin, payload.length),
+                          payload]);
+  const data = Buffer.alloc(payload.length);
+  mask(payload, maskKey, data, 0, payload.length);
+  return Buffer.concat([encodeFrameHeader(opcode, fin, payload.length, maskKey),
+                        data]);
+}
+
+function createParser(isServer, maxPayload = 0) {
+  const parser = new WebSocketParser(isServer, maxPayload);
+  const events = [];
+  parser[WebSocketParser.kOnMessage] = (data, isText) =>
+    events.push(['message', isText ? data.toString() : data]);
+  parser[WebSocketParser.kOnPing] = (data) => events.push(['ping', data]);
+  parser[WebSocketParser.kOnPong] = (data) => events.push(['pong', data]);
+  parser[WebSocketParser.kOnClose] = (code, reason) =>
+    events.push(['close', code, reason]);
+  parser[WebSocketParser.kOnError] = (code, message) =>
+    events.push(['error', code]);
+  return { parser, events };
+}
+
+{
+  // Frame headers use the shortest length encoding.
+  assert.deepStrictEqual(encodeFrameHeader(1, true, 5),
+                         Buffer.from([0x81, 5]));
+  assert.deepStrictEqual(encodeFrameHeader(2, false, 126),
+                         Buffer.from([0x02, 126, 0, 126]));
+  assert.deepStrictEqual(encodeFrameHeader(2, true, 0x10000, maskKey),
+                         Buffer.from([0x82, 0xff, 0, 0, 0, 0, 0, 1, 0, 0,
+                                      0x12, 0x34, 0x56, 0x78]));
+}
+
+{
+  // Masking is its own inverse, for lengths around the word size.
+  for (let length = 0; length < 20; length++) {
+    const data = Buffer.from(Array.from({ length }, (v, i) => i * 7));
+    const masked = Buffer.alloc(length + 3);
+    mask(data, maskKey, masked, 3, length);
+    for (let i = 0; i < length; i++)
+      assert.strictEqual(masked[i + 3], data[i] ^ maskKey[i % 4]);
+    const unmasked = masked.slice(3);
+    unmask(unmasked, maskKey);
+    assert.deepStrictEqual(unmasked, data);
+  }
+}
+
+{
+  assert.strictEqual(isValidUTF8(Buffer.from('plain ascii text')), true);
+  assert.strictEqual(isValidUTF8(Buffer.from('κόσμε €𝄞')), true);
+  assert.strictEqual(isValidUTF8(Buffer.from([0xc0, 0xaf])), false);
+  assert.strictEqual(isValidUTF8(Buffer.from([0xed, 0xa0, 0x80])), false);
+  assert.strictEqual(isValidUTF8(Buffer.from([0xf4, 0x90, 0x80, 0x80])),
+                     false);
+  assert.strictEqual(isValidUTF8(Buffer.from([0x61, 0xe2, 0x82])), false);
+}
+
+{
+  // Fragmented messages with interleaved control frames, split across
+  // arbitrary reads.
+  const { parser, events } = createParser(true);
+  const data = Buffer.concat([
+    frame(1, 'Hello, ', { fin: false }),
+    frame(9, 'ping'),
+    frame(0, 'wörld', { fin: false }),
+    frame(0, '!'),
+    frame(2, Buffer.alloc(300, 1)),
+    frame(10, ''),
+    frame(8, Buffer.concat([Buffer.from([0x03, 0xe8]), Buffer.from('bye')])),
+    frame(1, 'ignored after close')
+  ]);
+  for (let i = 0; i < data.length; i += 5)
+    parser.execute(data.slice(i, i + 5));
+
+  assert.deepStrictEqual(events, [
+    ['ping', Buffer.from('ping')],
+    ['message', 'Hello, wörld!'],
+    ['message', Buffer.alloc(300, 1)],
+    ['pong', Buffer.alloc(0)],
+    ['close', 1000, 'bye']
+  ]);
+}
+
+{
+  // Clients expect unmasked frames.
+  const { parser, events } = createParser(false);
+  parser.execute(frame(1, 'unmasked', { masked: false }));
+  parser.execute(frame(1, 'masked'));
+  assert.deepStrictEqual(events, [['message', 'unmasked'], ['error', 1002]]);
+}
+
+{
+  const errors = [
+    [frame(1, 'x', { masked: false }), 1002],
+    [Buffer.from([0xc1, 0x80, 0, 0, 0, 0]), 1002],
+    [frame(3, 'x'), 1002],
+    [frame(9, 'x', { fin: false }), 1002],
+    [frame(9, Buffer.alloc(126)), 1002],
+    [frame(0, 'x'), 1002],
+    [Buffer.concat([frame(1, 'x', { fin: false }), frame(1, 'y')]), 1002],
+    [frame(1, Buffer.from([0xff])), 1007],
+    [frame(8, Buffer.from([0x03])), 1002],
+    [frame(8, Buffer.from([0x03, 0xed])), 1002],
+    [frame(2, Buffer.alloc(11)), 1009]
+  ];
+  for (const [data, code] of errors) {
+    const { parser, events } = createParser(true, 10);
+    parser.execute(data);
+    assert.deepStrictEqual(events, [['error', code]]);
+  }
+}
+
+{
+  // The parser can consume a stream directly.
+  const server = net.createServer(common.mustCall((socket) => {
+    const { parser, events } = createParser(true);
+    parser[WebSocketParser.kOnClose] = common.mustCall((code) => {
+      assert.strictEqual(code, 1001);
+      assert.deepStrictEqual(events, [['message', 'a'.repeat(70000)]]);
+      parser.unconsume();
+      socket.end();
+      server.close();
+    });
+    parser.consume(socket._handle._externalStream);
+  }));
+
+  server.listen(0, common.mustCall(() => {
+    const client = net.connect(server.address().port, () => {
+      client.write(frame(1, 'a'.repeat(70000)));
+      client.write(frame(8, Buffer.from([0x03, 0xe9])));
+    });
+    client.resume();
+  }));
+}
+
+{
+  // Callbacks cannot feed the parser that is calling them.
+  const { parser, events } = createParser(true);
+  parser[WebSocketParser.kOnPing] = common.mustCall(() => {
+    assert.throws(() => parser.execute(frame(1, 'nested')),
+                  /^Error: execute\(\) cannot be called from a parser callback$/);
+  });
+  parser.execute(Buffer.concat([frame(9, ''), frame(1, 'after')]));
+  parser.execute(frame(1, 'later'));
+  assert.deepStrictEqual(events, [['message', 'after'], ['message', 'later']]);
+}
@@ -0,0 +1,85 @@
+// Flags: --expose-internals
+'use strict';
+
+const common = require('../common');
+const assert = require('assert');
+const net = require('net');
+const { PassThrough } = require('stream');
+const { WebSocketReceiver } = require('internal/websocket');
+const { encodeFrameHeader, mask } = process.binding('websocket');
+
+const maskKey = Buffer.from([0x12, 0x34, 0x56, 0x78]);
+
+function frame(opcode, payload) {
+  payload = Buffer.from(payload);
+  const data = Buffer.alloc(payload.length);
+  mask(payload, maskKey, data, 0, payload.length);
+  const header = encodeFrameHeader(opcode, true, payload.length, maskKey);
+  return Buffer.concat([header, data]);
+}
+
+const closeFrame = frame(8, Buffer.from([0x03, 0xe8]));
+
+{
+  // Sockets backed by a native stream are consumed by the parser, and never
+  // emit 'data'.
+  const server = net.createServer(common.mustCall((socket) => {
+    const receiver = new WebSocketReceiver(socket, { head: frame(1, 'head') });
+    const messages = [];
+    socket.on('data', common.mustNotCall());
+    receiver.on('message', (data, isText) => {
+      // The head is parsed before the stream is consumed.
+      assert.strictEqual(receiver.consumed, messages.length > 0);
+      assert.strictEqual(isText, true);
+      messages.push(data.toString());
+    });
+    receiver.on('ping', common.mustCall((data) => {
+      assert.strictEqual(data.toString(), 'ping');
+    }));
+    receiver.on('close', common.mustCall((code) => {
+      assert.strictEqual(code, 1000);
+      assert.deepStrictEqual(messages, ['head', 'first', 'b'.repeat(70000)]);
+      assert(!receiver.consumed);
+      socket.end();
+      server.close();
+    }));
+  }));
+
+  server.listen(0, common.mustCall(() => {
+    const client = net.connect(server.address().port, () => {
+      client.write(frame(1, 'first'));
+      client.write(frame(9, 'ping'));
+      client.write(frame(1, 'b'.repeat(70000)));
+      client.write(closeFrame);
+    });
+    client.resume();
+  }));
+}
+
+{
+  // Other streams are read from their 'data' events.
+  const stream = new PassThrough();
+  const receiver = new WebSocketReceiver(stream);
+  receiver.on('message', common.mustCall((data) => {
+    assert(!receiver.consumed);
+    assert.strictEqual(data.toString(), 'passthrough');
+  }));
+  receiver.on('close', common.mustCall(() => {
+    assert.strictEqual(stream.listenerCount('data'), 0);
+  }));
+  stream.write(frame(1, 'passthrough'));
+  stream.write(closeFrame);
+}
+
+{
+  // Protocol errors stop the receiver.
+  const stream = new PassThrough();
+  const receiver = new WebSocketReceiver(stream, { isServer: false });
+  receiver.on('message', common.mustNotCall());
+  receiver.on('protocolError', common.mustCall((code, message) => {
+    assert.strictEqual(code, 1002);
+    assert.strictEqual(message, 'Frames from servers must not be masked');
+    assert.strictEqual(stream.listenerCount('data'), 0);
+  }));
+  stream.write(frame(1, 'masked'));
+}
@@ -136,6 +136,12 @@ if (common.hasCrypto) { // eslint-disable-line node-core/crypto-check
 }
 
 
+{
+  const { WebSocketParser } = process.binding('websocket');
+  testInitialized(new WebSocketParser(true, 0), 'WebSocketParser');
+}
+
+
 {
   const Gzip = require('zlib').Gzip;
   testInitialized(new Gzip()._handle, 'Zlib');
@@ -170,6 +176,11 @@ if (common.hasCrypto) { // eslint-disable-line node-core/crypto-check
   testInitialized(new Process(), 'Process');
 }
 
+{
+  const { ProcessRunner } = process.binding('spawn_sync');
+  testInitialized(new ProcessRunner(), 'ProcessRunner');
+}
+
 {
   const Signal = process.binding('signal_wrap').Signal;
   testInitialized(new Signal(), 'Signal');
@@ -184,6 +195,17 @@ if (common.hasCrypto) { // eslint-disable-line node-core/crypto-check
   openTest().then(common.mustCall()).catch(common.mustNotCall());
 }
 
+{
+  const dir = process.binding('fs').opendir(__dirname, undefined, {});
+  testInitialized(dir, 'DirHandle');
+  dir.close(undefined, {});
+}
+
+{
+  const { FSWalker } = process.binding('fs');
+  testInitialized(new FSWalker(__dirname, 'utf8', [], [], 1, 1), 'FSWalker');
+}
+
 {
   const binding = process.binding('stream_wrap');
   testUninitialized(new binding.WriteWrap(), 'WriteWrap');
@@ -0,0 +1,99 @@
+'use strict';
+
+// Creates an application archive for use with NODE_APP_ARCHIVE, see
+// src/node_app_archive.h for the format.
+//
+// Usage: node tools/make-app-archive.js [--no-code-cache] <directory> <output>
+//
+// Every regular file below <directory> is added. Unless --no-code-cache is
+// given, a V8 code cache is added for each .js file. Code caches are only
+// used by a node binary with the same V8 version and flags as the one that
+// ran this script.
+
+const fs = require('fs');
+const path = require('path');
+const v8 = require('v8');
+const vm = require('vm');
+const { wrap } = require('module');
+
+const kMagic = 'NODEAPP1';
+
+// Must produce exactly what the CommonJS loader compiles, see stripBOM() and
+// stripShebang() in lib/internal/modules/cjs/helpers.js.
+function loaderSource(content) {
+  if (content.charCodeAt(0) === 0xFEFF)
+    content = content.slice(1);
+  if (content.startsWith('#!')) {
+    const end = content.search(/[\r\n]/);
+    content = end === -1 ? '' : content.slice(end);
+  }
+  return content;
+}
+
+function codeCache(filename, data) {
+  const source = wrap(loaderSource(data.toString('utf8')));
+  return new vm.Script(source, { filename }).createCachedData();
+}
+
+function collect(root, dir, files) {
+  for (const name of fs.readdirSync(path.join(root, dir)).sort()) {
+    const relative = dir ? `${dir}/${name}` : name;
+    const stats = fs.statSync(path.join(root, relative));
+    if (stats.isDirectory())
+      collect(root, relative, files);
+    else if (stats.isFile())
+      files.push(relative);
+  }
+  return files;
+}
+
+function makeAppArchive(directory, output, { codeCaches = true } = {}) {
+  const entries = collect(directory, '', []).map((relative) => {
+    const data = fs.readFileSync(path.join(directory, relative));
+    const cache = codeCaches && relative.endsWith('.js') ?
+      codeCache(path.join(output, relative), data) : Buffer.alloc(0);
+    return { path: Buffer.from(relative), data, cache };
+  });
+
+  let indexLength = kMagic.length + 8;
+  for (const entry of entries)
+    indexLength += 4 + entry.path.length + 16;
+
+  const index = Buffer.alloc(indexLength);
+  let offset = index.write(kMagic, 0, 'latin1');
+  offset = index.writeUInt32LE(codeCaches ? v8.cachedDataVersionTag() : 0,
+                               offset);
+  offset = index.writeUInt32LE(entries.length, offset);
+
+  const chunks = [index];
+  let dataOffset = indexLength;
+  for (const entry of entries) {
+    offset = index.writeUInt32LE(entry.path.length, offset);
+    offset += entry.path.copy(index, offset);
+    for (const chunk of [entry.data, entry.cache]) {
+      offset = index.writeUInt32LE(dataOffset, offset);
+      offset = index.writeUInt32LE(chunk.length, offset);
+      chunks.push(chunk);
+      dataOffset += chunk.length;
+    }
+  }
+
+  const tmp = `${output}.${process.pid}.tmp`;
+  fs.writeFileSync(tmp, Buffer.concat(chunks));
+  fs.renameSync(tmp, output);
+}
+
+module.exports = makeAppArchive;
+
+if (require.main === module) {
+  const args = process.argv.slice(2);
+  const codeCaches = args[0] !== '--no-code-cache';
+  if (!codeCaches)
+    args.shift();
+  if (args.length !== 2) {
+    console.error('Usage: node make-app-archive.js [--no-code-cache] ' +
+                  '<directory> <output>');
+    process.exit(1);
+  }
+  makeAppArchive(args[0], path.resolve(args[1]), { codeCaches });
+}